@@ -0,0 +1,145 @@
+#include "Benchmark.h"
+#include <Wire.h>
+
+#ifdef BENCHMARK
+
+// LED1 (pin 10), also as its port bit on the ATmega328 for the direct write
+#define LED_PIN  10
+#define LED_PORT PORTB
+#define LED_BIT  PB2
+
+// Cycles ahead of the current count that the ISR latency test sets its compare match
+#define ISR_LEAD_CYCLES 64
+
+namespace {
+  struct Timing {
+    uint32_t best;
+    uint32_t worst;
+  };
+
+  // Reached from the timed lambdas, which cannot capture
+  Adafruit_NeoPixel* bench_strip = nullptr;
+  MCP47X6* bench_dac = nullptr;
+  uint8_t bench_dac_value = 0;
+
+  uint32_t call_overhead = 0;
+  volatile uint16_t timer1_wraps = 0;
+  volatile uint16_t isr_entry_count = 0;
+  volatile bool isr_fired = false;
+
+  // Timer1 extended to 32 bits by its overflow count, 268 s at clk/1
+  uint32_t cycles_now() {
+    uint8_t sreg = SREG;
+    cli();
+    uint16_t wraps = timer1_wraps;
+    uint16_t count = TCNT1;
+    // An overflow whose ISR has not run yet
+    if ((TIFR1 & _BV(TOV1)) && count < 0x8000) wraps++;
+    SREG = sreg;
+    return ((uint32_t)wraps << 16) | count;
+  }
+
+  void add_run(Timing& timing, uint32_t cycles) {
+    if (cycles < timing.best) timing.best = cycles;
+    if (cycles > timing.worst) timing.worst = cycles;
+  }
+
+  // Not inlined, so every op pays the same call overhead, which is
+  // subtracted
+  __attribute__((noinline)) Timing time_op(void (*op)(), void (*prepare)() = nullptr) {
+    Timing timing = {0xffffffff, 0};
+    for (uint8_t run = 0; run < BENCHMARK_RUNS; run++) {
+      if (prepare) prepare();
+      uint32_t start = cycles_now();
+      op();
+      uint32_t end = cycles_now();
+      add_run(timing, end - start - call_overhead);
+    }
+    return timing;
+  }
+
+  // Cycles from a Timer1 compare match to the first statement of its ISR
+  Timing time_isr_entry() {
+    Timing timing = {0xffffffff, 0};
+    for (uint8_t run = 0; run < BENCHMARK_RUNS; run++) {
+      isr_fired = false;
+      OCR1B = TCNT1 + ISR_LEAD_CYCLES;
+      TIFR1 = _BV(OCF1B);
+      TIMSK1 |= _BV(OCIE1B);
+      while (!isr_fired) {}
+      TIMSK1 &= ~_BV(OCIE1B);
+      add_run(timing, (uint16_t)(isr_entry_count - OCR1B));
+    }
+    return timing;
+  }
+
+  void print_timing(const __FlashStringHelper* name, Timing timing) {
+    Serial.print(name);
+    for (uint8_t i = strlen_P((PGM_P)name); i < 24; i++) Serial.print(' ');
+    Serial.print(timing.best);
+    Serial.print(F(" / "));
+    Serial.print(timing.worst);
+    Serial.print(F(" cycles, "));
+    Serial.print(timing.best / (F_CPU / 1000000.0), 2);
+    Serial.println(F(" us"));
+    // Drain the TX buffer, so its interrupts stay out of the next timing
+    Serial.flush();
+  }
+}
+
+ISR(TIMER1_OVF_vect) {
+  timer1_wraps++;
+}
+
+// The latency includes the interrupt response, the vector jump and the
+// compiler's register saves before the TCNT1 read
+ISR(TIMER1_COMPB_vect) {
+  isr_entry_count = TCNT1;
+  isr_fired = true;
+}
+
+void run_benchmark(Adafruit_NeoPixel& strip, MCP47X6& dac, uint8_t dac_address, uint8_t dac_value) {
+  bench_strip = &strip;
+  bench_dac = &dac;
+  bench_dac_value = dac_value;
+
+  Serial.begin(BENCHMARK_BAUD);
+  Serial.print(F("BENCHMARK at "));
+  Serial.print(F_CPU / 1000000);
+  Serial.print(F(" MHz, best / worst of "));
+  Serial.println(BENCHMARK_RUNS);
+
+  // Timer1 free running at clk/1, normal mode, counting its overflows
+  TCCR1A = 0;
+  TCCR1B = _BV(CS10);
+  TIFR1 = _BV(TOV1);
+  TIMSK1 = _BV(TOIE1);
+
+  Timing overhead = time_op([]() {});
+  call_overhead = overhead.best;
+  print_timing(F("call overhead"), overhead);
+
+  print_timing(F("digitalWrite"), time_op([]() { digitalWrite(LED_PIN, HIGH); }));
+  print_timing(F("port write"), time_op([]() { LED_PORT |= _BV(LED_BIT); }));
+  print_timing(F("micros"), time_op([]() { micros(); }));
+  print_timing(F("millis"), time_op([]() { millis(); }));
+  // show() first waits out the 300 us latch of the previous frame
+  print_timing(F("show, 16 pixels"), time_op([]() { bench_strip->show(); },
+                                             []() { while (!bench_strip->canShow()) {} }));
+  print_timing(F("DAC setOutputLevel"), time_op([]() { bench_dac->setOutputLevel(bench_dac_value); }));
+  Wire.beginTransmission(dac_address);
+  if (Wire.endTransmission() == 0) {
+    Serial.println(F("  DAC acknowledged"));
+  } else {
+    Serial.println(F("  DAC not found, timed to its NACK"));
+  }
+  print_timing(F("ISR entry"), time_isr_entry());
+
+  TIMSK1 = 0;
+  TCCR1B = 0;
+  digitalWrite(LED_PIN, LOW);
+  Serial.println(F("END"));
+  Serial.flush();
+}
+
+#endif
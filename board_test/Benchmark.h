@@ -0,0 +1,24 @@
+#pragma once
+
+#include <arduino.h>
+#include <Adafruit_NeoPixel.h>
+#include <MCP47X6.h>
+
+// Self-benchmark, run once at startup before the test loop and reported over
+// serial at BENCHMARK_BAUD. Each operation runs BENCHMARK_RUNS times, timed
+// in CPU cycles on Timer1 at clk/1, extended to 32 bits by counting its
+// overflows; the best run is the operation's own cost, the worst adds
+// whatever interrupt landed in it (the core's Timer0 overflow, Timer1's
+// own). Song decode cycles are measured by the firmware itself
+// (SONG_BENCHMARK in VoiceBackend.h), since the songs are not part of this
+// sketch. With no DAC on the bus, the DAC write is timed up to its NACK.
+//
+// Runs the same under simavr: make -C board_test bench builds the sketch
+// with SIMAVR_TRACE (SimMcu.c) and prints the report up to its END line;
+// there a model DAC acknowledges the write.
+#define BENCHMARK
+#define BENCHMARK_BAUD 115200
+#define BENCHMARK_RUNS 32
+
+// Leaves Timer1 stopped and LED1 off
+void run_benchmark(Adafruit_NeoPixel& strip, MCP47X6& dac, uint8_t dac_address, uint8_t dac_value);
@@ -0,0 +1,13 @@
+// Compiled as C: the simavr section macros use C99 designated initializers.
+// Define SIMAVR_TRACE to give the image the .mmcu section simavr reads the
+// MCU and clock from, so the benchmark runs on simavr as on the board:
+// make -C board_test bench. Requires the simavr headers
+// (avr_mcu_section.h) on the include path.
+#if defined(SIMAVR_TRACE) && defined(__AVR_ATmega328P__)
+
+#include <avr/io.h>
+#include <simavr/avr/avr_mcu_section.h>
+
+AVR_MCU(F_CPU, "atmega328p");
+
+#endif
@@ -3,6 +3,7 @@
 #include <Wire.h>
 
 #include <Adafruit_NeoPixel.h>
+#include "Benchmark.h"
 #ifdef __AVR__
   #include <avr/power.h>
 #endif
@@ -72,6 +73,11 @@ void setup() {
   DAC.saveSettings();
   DAC.setOutputLevel(dac_value);
 
+  #ifdef BENCHMARK
+  // Before Timer1 and Timer2 are set up for the PWM test below
+  run_benchmark(strip, DAC, DAC_ADDRESS, dac_value);
+  #endif
+
   pinMode(9, OUTPUT); // Timer 1, output A
   // COM1A1 (0x80) = non-inverted PWM output to channel A (pin 9)
   // WGM11 (0x02) = fast PWM mode, ICR1 as TOP
@@ -0,0 +1,104 @@
+// Runs the board_test benchmark (Benchmark.cpp) under simavr and prints its
+// serial report, up to its END line. The image must be built with
+// SIMAVR_TRACE: its .mmcu section (SimMcu.c) names the MCU and clock.
+//
+//   simavr_bench board_test.ino.elf
+//
+// A write-only device ACKs the DAC's address, so the DAC write is timed as
+// on the board. Exits non-zero if the firmware stops or no END arrives
+// within BENCH_LIMIT_S of simulated time; see the Makefile for the build.
+#include <stdint.h>
+#include <stdio.h>
+#include <string.h>
+#include <sim_avr.h>
+#include <sim_elf.h>
+#include <sim_io.h>
+#include <avr_uart.h>
+#include <avr_twi.h>
+
+// The MCP47X6 DAC's address (board_test.ino)
+#define DAC_ADDRESS  0x60
+#define BENCH_LIMIT_S 10
+#define LINE_MAX     128
+
+static avr_t* avr = NULL;
+static avr_irq_t* twi_input = NULL;
+static uint8_t dac_selected = 0;
+
+static char line[LINE_MAX];
+static size_t line_length = 0;
+static int done = 0;
+
+// Each report line to stdout as it completes; the core ends them with CR LF
+static void on_uart(struct avr_irq_t* irq, uint32_t value, void* param) {
+  if (value == '\r') return;
+  if (value != '\n') {
+    if (line_length < LINE_MAX - 1) line[line_length++] = value;
+    return;
+  }
+  line[line_length] = 0;
+  line_length = 0;
+  printf("%s\n", line);
+  if (!strcmp(line, "END")) done = 1;
+}
+
+// A write-only device at DAC_ADDRESS: ACKs its address and every byte
+static void on_twi(struct avr_irq_t* irq, uint32_t value, void* param) {
+  avr_twi_msg_irq_t msg;
+  msg.u.v = value;
+  if (msg.u.twi.msg & TWI_COND_STOP) dac_selected = 0;
+  if (msg.u.twi.msg & TWI_COND_START) {
+    dac_selected = (msg.u.twi.addr >> 1) == DAC_ADDRESS ? msg.u.twi.addr : 0;
+  }
+  if (dac_selected && (msg.u.twi.msg & (TWI_COND_START | TWI_COND_WRITE))) {
+    avr_raise_irq(twi_input, avr_twi_irq_msg(TWI_COND_ACK, dac_selected, 1));
+  }
+}
+
+int main(int argc, char** argv) {
+  if (argc != 2) {
+    fprintf(stderr, "usage: simavr_bench <board_test.elf>\n");
+    return 2;
+  }
+  elf_firmware_t firmware = {{0}};
+  if (elf_read_firmware(argv[1], &firmware)) {
+    fprintf(stderr, "%s: cannot read the firmware\n", argv[1]);
+    return 2;
+  }
+  if (!firmware.mmcu[0] || !firmware.frequency) {
+    fprintf(stderr, "%s: no .mmcu section; build with SIMAVR_TRACE\n", argv[1]);
+    return 2;
+  }
+  avr = avr_make_mcu_by_name(firmware.mmcu);
+  if (!avr) {
+    fprintf(stderr, "simavr has no %s\n", firmware.mmcu);
+    return 2;
+  }
+  avr_init(avr);
+  avr_load_firmware(avr, &firmware);
+
+  // The report goes to stdout a line at a time, not simavr's console
+  uint32_t uart_flags = 0;
+  avr_ioctl(avr, AVR_IOCTL_UART_GET_FLAGS('0'), &uart_flags);
+  uart_flags &= ~AVR_UART_FLAG_STDIO;
+  avr_ioctl(avr, AVR_IOCTL_UART_SET_FLAGS('0'), &uart_flags);
+  avr_irq_register_notify(avr_io_getirq(avr, AVR_IOCTL_UART_GETIRQ('0'), UART_IRQ_OUTPUT), on_uart, NULL);
+
+  twi_input = avr_io_getirq(avr, AVR_IOCTL_TWI_GETIRQ(0), TWI_IRQ_INPUT);
+  avr_irq_register_notify(avr_io_getirq(avr, AVR_IOCTL_TWI_GETIRQ(0), TWI_IRQ_OUTPUT), on_twi, NULL);
+
+  uint64_t limit_ns = (uint64_t)BENCH_LIMIT_S * 1000000000;
+  while (!done) {
+    int state = avr_run(avr);
+    if (state == cpu_Done || state == cpu_Crashed) {
+      fprintf(stderr, "firmware stopped (state %d) before END\n", state);
+      return 1;
+    }
+    if (avr_cycles_to_nsec(avr, avr->cycle) >= limit_ns) {
+      fprintf(stderr, "no END after %d s\n", BENCH_LIMIT_S);
+      return 1;
+    }
+  }
+  avr_terminate(avr);
+  return 0;
+}
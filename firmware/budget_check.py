@@ -0,0 +1,661 @@
+import argparse
+import bisect
+import fnmatch
+import os
+import re
+import subprocess
+import sys
+
+from typing import Dict, List, NamedTuple, Optional, Set, Tuple
+
+# Static worst-case cycle and stack analysis of the DRSSTC firmware's ISRs
+# and the loop's hot functions, from the avr-objdump disassembly of the
+# built .elf. Exits non-zero when a figure is over its budget or cannot be
+# bounded (a loop with no entry in the bound tables, an unlisted indirect
+# call, recursion), so it can fail the build.
+#
+# budget_test/Makefile runs it as arduino-cli's post-link hook on the .elf
+# (make firmware), so the build fails with it; the same
+# recipe.hooks.objcopy.postobjcopy pattern in the AVR core's
+# platform.local.txt runs it on every IDE build. The default builds carry
+# the debug line info (-g) that loops are bounded by. make check there runs
+# it on a hand-written listing against the figures worked out by hand.
+#
+# The model is the AVR instruction timing: every branch is taken when that
+# is longer, every loop runs its bound, and an ISR adds its interrupt
+# response and vector jump. Wait states, other interrupts and the time
+# interrupts are masked elsewhere are not counted.
+
+# Worst-case cycles (16 per us) and stack bytes; ISRs are named by vector
+BUDGETS = {
+    'TIMER2_OVF': (200, 24),     # Timer2 voice sub-period: 64 us = 1024 cycles
+    'TIMER0_COMPA': (300, 32),   # TIMER0_VOICE builds: Timer2's plus the clock
+    'TIMER1_OVF': (2400, 32),    # pulse trains; waits out a full-width pulse (2040 cycles)
+    'TIMER1_COMPA': (100, 16),   # 16-bit voice notes 21-22: output toggled twice per period
+    'TIMER3_COMPA': (100, 16),   # the same on the ATmega2560's other 16-bit voices
+    'TIMER4_COMPA': (100, 16),
+    'TIMER5_COMPA': (100, 16),
+    'WDT': (400, 32),            # silences every voice
+    'EE_READY': (250, 32),       # one fault log byte
+    'PCINT2': (150, 24),         # sync follower's start bit capture on RX (ATmega328P)
+    'PCINT1': (150, 24),         # the same on the ATmega2560
+    'PCINT0': (150, 32),         # OCD input on the ATmega328P
+    'play_midi': (32000, 64),    # LOOP_DEADLINE_US (LoopMonitor.h)
+    'play_midi_note': (2000, 40),  # Timer1 note_on and off each wait out a pulse
+    'silence_midi': (800, 32),
+    'ocd_int': (100, 16),
+    'timebase_us': (100, 8),     # one retry of the overflow count read
+}
+ISR_BUDGET = (400, 40)           # any other ISR, from the Arduino core
+HOT_FUNCTIONS = ['play_midi', 'play_midi_note', 'silence_midi', 'ocd_int', 'timebase_us']
+
+# Most iterations of each loop, by source file and text of a line in its
+# header or latch. Fixed-length loops over NUM_VOICES may be unrolled.
+SOURCE_LOOP_BOUNDS = {
+    ('MIDIPlayer.cpp', 'length < HUFFMAN_MAX_BITS'): 15,
+    ('MIDIPlayer.cpp', 'while (!(byte_value & 0x80))'): 4,            # 5-byte varint
+    ('MIDIPlayer.cpp', 'while (true) {'): 33,                         # pulse train queue + 1
+    ('MIDIPlayer.cpp', 'run <= arg'): 32,
+    ('MIDIPlayer.cpp', 'while (length-- && pixel < NUM_LEDS)'): 16,
+    ('MIDIPlayer.cpp', 'pixel < NUM_LEDS; pixel++'): 16,
+    # read_led_cue()'s frame copies, when inlined
+    ('MIDIPlayer.cpp', 'memset(led_cue_frame, arg & LED_PALETTE_MASK, NUM_LEDS)'): 16,
+    ('MIDIPlayer.cpp', 'memcpy(frame, led_cue_frame, NUM_LEDS)'): 16,
+    ('MIDIPlayer.cpp', 'while (metronome_ticks > current_ticks_per_beat)'): 2,
+    # Events due at one call: a chord on and off on every song voice
+    ('MIDIPlayer.cpp', 'while ((long)(timestamp - prev_mark_us) >= (long)rem_us)'): 16,
+    ('VoiceRouter.cpp', 'song_voice < MAX_SONG_VOICES'): 8,
+    ('VoiceRouter.cpp', 'voice < NUM_VOICES'): 4,
+    ('VoiceBackendMock.cpp', 'voice < NUM_VOICES'): 4,
+    # Re-read when the ISR updates the count mid-read; it cannot twice
+    ('Timebase.cpp', 'while (overflows != timer0_overflow_count)'): 2,
+    ('Timebase.cpp', 'while (ms != timer0_millis)'): 2,
+    ('VoiceBackendAVR.cpp', 'while (us != clock_us)'): 2,
+    ('VoiceBackendAVR.cpp', 'while (ms != clock_ms)'): 2,
+    # 255 ticks of 8 cycles, at 8 cycles per pass (two lds, compare, branch)
+    ('PulseTrain.cpp', 'while (TCNT1 <= current_duty)'): 256,
+    # A 20 us pulse and the wrap guard: ~480 cycles at about 10 per pass
+    ('VoiceBackendAVR.cpp', 'while (count < gate_on || count > last)'): 48,
+}
+# Loops in code without line info (libgcc, avr-libc), by function
+FUNCTION_LOOP_BOUNDS = {
+    '__udivmodqi4': 8,
+    '__udivmodhi4': 16,
+    '__udivmodsi4': 32,
+    # Byte loops; the longest length the hot paths pass is NUM_LEDS
+    'memset': 16,
+    'memcpy': 16,
+}
+
+# Targets of indirect calls, by the function or ISR making them
+INDIRECT_CALLS = {
+    'INT*': ['ocd_int', 'nothing'],  # attachInterrupt() handlers (WInterrupts.c)
+    'TWI': [],                       # slave callbacks; the DAC bus is master only
+}
+
+# Jump table dispatch for switch statements (libgcc); Z = table + index
+TABLEJUMPS = ['__tablejump2__', '__tablejump__']
+
+VECTOR_NAMES = {
+    'atmega328p': {1: 'INT0', 2: 'INT1', 3: 'PCINT0', 4: 'PCINT1', 5: 'PCINT2', 6: 'WDT',
+                   7: 'TIMER2_COMPA', 9: 'TIMER2_OVF', 11: 'TIMER1_COMPA', 13: 'TIMER1_OVF',
+                   14: 'TIMER0_COMPA', 16: 'TIMER0_OVF', 18: 'USART_RX', 19: 'USART_UDRE',
+                   22: 'EE_READY', 24: 'TWI'},
+    'atmega2560': {1: 'INT0', 2: 'INT1', 3: 'INT2', 4: 'INT3', 5: 'INT4', 6: 'INT5', 7: 'INT6',
+                   8: 'INT7', 9: 'PCINT0', 10: 'PCINT1', 11: 'PCINT2', 12: 'WDT',
+                   13: 'TIMER2_COMPA', 15: 'TIMER2_OVF', 17: 'TIMER1_COMPA', 20: 'TIMER1_OVF',
+                   21: 'TIMER0_COMPA', 23: 'TIMER0_OVF', 25: 'USART0_RX', 26: 'USART0_UDRE',
+                   30: 'EE_READY', 32: 'TIMER3_COMPA', 36: 'USART1_RX', 37: 'USART1_UDRE', 39: 'TWI',
+                   42: 'TIMER4_COMPA', 47: 'TIMER5_COMPA', 51: 'USART2_RX', 52: 'USART2_UDRE',
+                   54: 'USART3_RX', 55: 'USART3_UDRE'},
+}
+# Devices with a 22-bit PC push 3-byte return addresses and take a cycle longer
+# to call, return and enter an interrupt
+PC22_MCUS = ['atmega2560', 'atmega2561']
+
+BRANCHES = {'brbc', 'brbs', 'breq', 'brne', 'brcs', 'brcc', 'brsh', 'brlo', 'brmi', 'brpl',
+            'brge', 'brlt', 'brhs', 'brhc', 'brts', 'brtc', 'brvs', 'brvc', 'brie', 'brid'}
+SKIPS = {'cpse', 'sbrc', 'sbrs', 'sbic', 'sbis'}
+ONE_CYCLE = {'add', 'adc', 'sub', 'subi', 'sbc', 'sbci', 'and', 'andi', 'or', 'ori', 'eor',
+             'com', 'neg', 'sbr', 'cbr', 'inc', 'dec', 'tst', 'clr', 'ser', 'cp', 'cpc', 'cpi',
+             'mov', 'movw', 'ldi', 'in', 'out', 'lsl', 'lsr', 'rol', 'ror', 'asr', 'swap',
+             'bset', 'bclr', 'bst', 'bld', 'sec', 'clc', 'sen', 'cln', 'sez', 'clz', 'sei',
+             'cli', 'ses', 'cls', 'sev', 'clv', 'set', 'clt', 'seh', 'clh', 'nop', 'sleep', 'wdr'}
+TWO_CYCLES = {'adiw', 'sbiw', 'mul', 'muls', 'mulsu', 'fmul', 'fmuls', 'fmulsu', 'rjmp', 'ijmp',
+              'eijmp', 'ld', 'ldd', 'st', 'std', 'lds', 'sts', 'push', 'pop', 'sbi', 'cbi'}
+THREE_CYCLES = {'jmp', 'lpm', 'elpm'}
+# (16-bit PC, 22-bit PC)
+CALL_CYCLES = {'call': (4, 5), 'rcall': (3, 4), 'icall': (3, 4), 'eicall': (4, 4),
+               'ret': (4, 5), 'reti': (4, 5)}
+ISR_ENTRY_CYCLES = (4 + 3, 5 + 3)  # interrupt response, then the vector table's jmp
+
+SYMBOL_LINE = re.compile(r'^([0-9a-f]+) <(.+)>:$')
+INSTRUCTION_LINE = re.compile(r'^\s+([0-9a-f]+):\t((?:[0-9a-f]{2} )+)\s*\t?(.*)$')
+SOURCE_LINE = re.compile(r'^(.+):(\d+)(?: \(discriminator \d+\))?$')
+
+
+class AnalysisError(Exception):
+    pass
+
+
+class Instruction(NamedTuple):
+    addr: int
+    size: int
+    mnemonic: str
+    operands: str
+    target: Optional[int]
+    line: Optional[str]  # 'path:line' of its source, from the debug info
+
+
+class Function(NamedTuple):
+    name: str
+    start: int
+    end: int
+
+
+class Result(NamedTuple):
+    cycles: int
+    stack: int
+
+
+def base_name(symbol: str) -> str:
+    # play_midi_note(unsigned char, ...) [clone .constprop.0] -> play_midi_note
+    name = symbol.replace('(anonymous namespace)::', '')
+    name = re.sub(r' \[clone [^\]]*\]', '', name)
+    if '(' in name:
+        return name[:name.index('(')]
+    return name.split('.')[0]
+
+
+def parse_operands(text: str) -> Tuple[str, str]:
+    operands, _, comment = text.partition(';')
+    return operands.strip(), comment.strip()
+
+
+def branch_target(addr: int, size: int, mnemonic: str, operands: str, comment: str) -> Optional[int]:
+    if mnemonic in ('jmp', 'call'):
+        match = re.match(r'0x([0-9a-f]+)', operands)
+        return int(match.group(1), 16) if match else None
+    if mnemonic in BRANCHES or mnemonic in ('rjmp', 'rcall'):
+        match = re.search(r'\.([+-]\d+)', operands)
+        if match:
+            return addr + size + int(match.group(1))
+        match = re.match(r'0x([0-9a-f]+)', comment)
+        return int(match.group(1), 16) if match else None
+    return None
+
+
+class Program:
+    def __init__(self, listing: List[str]):
+        symbols = list()  # (addr, name)
+        self.instructions = dict()
+        self.memory = dict()
+        line = None
+        in_text = False
+        for text in listing:
+            text = text.rstrip('\r\n')
+            if text.startswith('Disassembly of section'):
+                in_text = text.split()[-1].rstrip(':') == '.text'
+                continue
+            if not in_text or not text:
+                continue
+            match = SYMBOL_LINE.match(text)
+            if match:
+                symbols.append((int(match.group(1), 16), match.group(2)))
+                line = None
+                continue
+            match = INSTRUCTION_LINE.match(text)
+            if match:
+                addr = int(match.group(1), 16)
+                raw = bytes.fromhex(match.group(2))
+                for i, value in enumerate(raw):
+                    self.memory[addr + i] = value
+                fields = match.group(3).split('\t', 1)
+                mnemonic = fields[0].strip()
+                operands, comment = parse_operands(fields[1] if len(fields) > 1 else '')
+                self.instructions[addr] = Instruction(addr, len(raw), mnemonic, operands,
+                                                      branch_target(addr, len(raw), mnemonic, operands, comment),
+                                                      line)
+                continue
+            match = SOURCE_LINE.match(text)
+            if match and not text[0].isspace():
+                line = '%s:%s' % (match.group(1).replace('\\', '/'), match.group(2))
+        self.addrs = sorted(self.instructions)
+
+        # Symbols at the same address are aliases of one function. Assembly
+        # routines also label their insides (__udivmodsi4_ep), so a symbol
+        # only bounds a function for calls and jump tables; jumps follow the
+        # code wherever it goes.
+        self.starts = sorted(set(addr for addr, _ in symbols))
+        ends = self.starts[1:] + [self.addrs[-1] + 2 if self.addrs else 0]
+        self.functions = dict()
+        for start, end in zip(self.starts, ends):
+            name = next(name for addr, name in symbols if addr == start)
+            self.functions[start] = Function(name, start, end)
+        self.by_name = dict()
+        for addr, name in symbols:
+            self.by_name.setdefault(base_name(name), []).append(self.functions[addr])
+
+    def function_at(self, addr: int) -> Function:
+        i = bisect.bisect_right(self.starts, addr) - 1
+        if i < 0:
+            raise AnalysisError('no function at 0x%x' % addr)
+        return self.functions[self.starts[i]]
+
+    def following(self, addr: int, count: int) -> List[Instruction]:
+        i = bisect.bisect_right(self.addrs, addr)
+        return [self.instructions[a] for a in self.addrs[i:i + count]]
+
+    def preceding(self, addr: int, count: int) -> List[Instruction]:
+        i = bisect.bisect_left(self.addrs, addr)
+        return [self.instructions[a] for a in self.addrs[max(0, i - count):i]]
+
+    def read_word(self, addr: int) -> Optional[int]:
+        if addr not in self.memory or addr + 1 not in self.memory:
+            return None
+        return self.memory[addr] | self.memory[addr + 1] << 8
+
+
+def immediate(operands: str) -> int:
+    return int(operands.split(',')[1].strip(), 0)
+
+
+class Analyzer:
+    def __init__(self, program: Program, mcu: str, source_dir: str):
+        self.program = program
+        self.pc22 = mcu in PC22_MCUS
+        self.pc_bytes = 3 if self.pc22 else 2
+        self.vectors = VECTOR_NAMES.get(mcu, {})
+        self.source_dir = source_dir
+        self.sources = dict()
+        self.results = dict()
+        self.active = set()
+
+    def label(self, func: Function) -> str:
+        name = base_name(func.name)
+        match = re.match(r'__vector_(\d+)$', name)
+        if match:
+            return self.vectors.get(int(match.group(1)), name)
+        return name
+
+    def cycles(self, mnemonic: str) -> int:
+        if mnemonic in CALL_CYCLES:
+            return CALL_CYCLES[mnemonic][1 if self.pc22 else 0]
+        if mnemonic in ONE_CYCLE or mnemonic in BRANCHES or mnemonic in SKIPS:
+            return 1
+        if mnemonic in TWO_CYCLES:
+            return 2
+        if mnemonic in THREE_CYCLES:
+            return 3
+        raise AnalysisError('unknown instruction %s' % mnemonic)
+
+    def source_text(self, line: str) -> str:
+        path, _, number = line.rpartition(':')
+        if path not in self.sources:
+            self.sources[path] = list()
+            for candidate in (os.path.join(self.source_dir, os.path.basename(path)), path):
+                if os.path.isfile(candidate):
+                    with open(candidate, errors='replace') as inf:
+                        self.sources[path] = inf.readlines()
+                    break
+        lines = self.sources[path]
+        number = int(number)
+        return lines[number - 1] if 0 < number <= len(lines) else ''
+
+    def loop_bound(self, header: int, latches: Set[int]) -> int:
+        # Lines of the header, and of each latch's branch and the compare before it
+        lines = [self.program.instructions[header].line]
+        for latch in latches:
+            lines += [ins.line for ins in self.program.preceding(latch, 2)]
+            lines.append(self.program.instructions[latch].line)
+        bounds = list()
+        for line in set(line for line in lines if line):
+            text = self.source_text(line)
+            filename = os.path.basename(line.rpartition(':')[0])
+            bounds += [bound for (where, pattern), bound in SOURCE_LOOP_BOUNDS.items()
+                       if where == filename and pattern in text]
+        if bounds:
+            return max(bounds)
+        func = self.program.function_at(header)
+        for name, bound in FUNCTION_LOOP_BOUNDS.items():
+            if base_name(func.name) == name or base_name(func.name).startswith(name + '_'):
+                return bound
+        where = ', '.join(sorted(set(os.path.basename(line) for line in lines if line))) or 'no line info'
+        raise AnalysisError('unbounded loop at 0x%x in %s (%s)' % (header, self.label(func), where))
+
+    def callee(self, target: int) -> Tuple[Function, Result]:
+        func = self.program.function_at(target)
+        if func.start != target:
+            raise AnalysisError('call into the middle of %s' % func.name)
+        return func, self.analyze(func)
+
+    def indirect_targets(self, ins: Instruction) -> List[Function]:
+        label = self.label(self.program.function_at(ins.addr))
+        for pattern, names in INDIRECT_CALLS.items():
+            if fnmatch.fnmatchcase(label, pattern):
+                return [target for name in names for target in self.program.by_name.get(name, [])]
+        raise AnalysisError('indirect call in %s: list its targets in INDIRECT_CALLS' % label)
+
+    def table_targets(self, jump: Instruction) -> List[int]:
+        # The jump is preceded by subi r30, lo8(-table) and sbci r31, hi8(-table)
+        func = self.program.function_at(jump.addr)
+        low = high = None
+        for ins in reversed(self.program.preceding(jump.addr, 6)):
+            if ins.mnemonic == 'subi' and ins.operands.startswith('r30') and low is None:
+                low = immediate(ins.operands)
+            elif ins.mnemonic == 'sbci' and ins.operands.startswith('r31') and high is None:
+                high = immediate(ins.operands)
+        if low is None or high is None:
+            raise AnalysisError('jump table in %s without its address' % self.label(func))
+        # Entries are word addresses; the table ends where they leave the function
+        table = 2 * ((-(low | high << 8)) & 0xffff)
+        targets = list()
+        while True:
+            word = self.program.read_word(table + 2 * len(targets))
+            if word is None or not func.start <= 2 * word < func.end or 2 * word not in self.program.instructions:
+                break
+            targets.append(2 * word)
+        if not targets:
+            raise AnalysisError('empty jump table in %s' % self.label(func))
+        return targets
+
+    def frame_size(self, addrs: List[int]) -> int:
+        # Saved registers and the locals frame the prologue allocates
+        frame = 0
+        for addr in sorted(addrs):
+            ins = self.program.instructions[addr]
+            if ins.mnemonic == 'push':
+                frame += 1
+            elif ins.mnemonic == 'rcall' and ins.target == ins.addr + ins.size:
+                frame += self.pc_bytes
+            elif ins.mnemonic == 'in' and ins.operands.replace(' ', '') == 'r28,0x3d':
+                following = self.program.following(addr, 4)
+                for j, next_ins in enumerate(following):
+                    if next_ins.mnemonic == 'sbiw' and next_ins.operands.startswith('r28'):
+                        frame += immediate(next_ins.operands)
+                        break
+                    if next_ins.mnemonic == 'subi' and next_ins.operands.startswith('r28') \
+                            and j + 1 < len(following) and following[j + 1].mnemonic == 'sbci':
+                        frame += (-(immediate(next_ins.operands) | immediate(following[j + 1].operands) << 8)) & 0xffff
+                        break
+        return frame
+
+    def step(self, ins: Instruction) -> Tuple[int, List[Tuple[int, int]], int]:
+        # Cycles of the instruction and any call it makes, its successors with
+        # their extra cycles when taken, and the stack its calls use
+        m = ins.mnemonic
+        following = ins.addr + ins.size
+        if m in BRANCHES:
+            return 1, [(following, 0), (ins.target, 1)], 0
+        if m in SKIPS:
+            skipped = self.program.instructions.get(following)
+            if skipped is None:
+                raise AnalysisError('skip past the code at 0x%x' % ins.addr)
+            return 1, [(following, 0), (following + skipped.size, 1 if skipped.size == 2 else 2)], 0
+        if m in ('ret', 'reti'):
+            return self.cycles(m), [], 0
+        if m in ('ijmp', 'eijmp'):
+            func = self.program.function_at(ins.addr)
+            if base_name(func.name) in TABLEJUMPS:
+                return self.cycles(m), [], 0
+            raise AnalysisError('indirect jump in %s' % self.label(func))
+        if m in ('rjmp', 'jmp'):
+            func = self.program.function_at(ins.target)
+            if func.start == ins.target and base_name(func.name) in TABLEJUMPS:
+                _, result = self.callee(ins.target)
+                return self.cycles(m) + result.cycles, [(t, 0) for t in self.table_targets(ins)], result.stack
+            # Within the function, or a tail call
+            return self.cycles(m), [(ins.target, 0)], 0
+        if m in ('call', 'rcall'):
+            if ins.target == following:
+                return self.cycles(m), [(following, 0)], 0  # frame allocation
+            _, result = self.callee(ins.target)
+            return self.cycles(m) + result.cycles, [(following, 0)], self.pc_bytes + result.stack
+        if m in ('icall', 'eicall'):
+            results = [self.analyze(target) for target in self.indirect_targets(ins)]
+            cycles = max([r.cycles for r in results], default=0)
+            stack = max([r.stack for r in results], default=0)
+            return self.cycles(m) + cycles, [(following, 0)], self.pc_bytes + stack
+        return self.cycles(m), [(following, 0)], 0
+
+    def analyze(self, func: Function) -> Result:
+        if func.start in self.results:
+            return self.results[func.start]
+        if func.start in self.active:
+            raise AnalysisError('recursion through %s' % func.name)
+        self.active.add(func.start)
+        try:
+            weight = dict()
+            succ = dict()
+            call_stack = 0
+            pending = [func.start]
+            while pending:
+                addr = pending.pop()
+                if addr in weight:
+                    continue
+                ins = self.program.instructions.get(addr)
+                if ins is None:
+                    raise AnalysisError('jump to 0x%x, not an instruction, from %s' % (addr, func.name))
+                cycles, edges, stack = self.step(ins)
+                weight[addr] = cycles
+                succ[addr] = dict()
+                for target, extra in edges:
+                    succ[addr][target] = max(succ[addr].get(target, 0), extra)
+                    pending.append(target)
+                call_stack = max(call_stack, stack)
+            cycles = longest_path(func.start, weight, succ, self.loop_bound)
+            result = Result(cycles, self.frame_size(list(weight)) + call_stack)
+        finally:
+            self.active.discard(func.start)
+        self.results[func.start] = result
+        return result
+
+
+def immediate_dominators(entry: int, succ: Dict[int, Dict[int, int]]) -> Dict[int, int]:
+    # Cooper, Harvey and Kennedy's iteration over reverse postorder
+    postorder = list()
+    seen = {entry}
+    stack = [(entry, iter(succ[entry]))]
+    while stack:
+        node, children = stack[-1]
+        for child in children:
+            if child not in seen:
+                seen.add(child)
+                stack.append((child, iter(succ[child])))
+                break
+        else:
+            postorder.append(node)
+            stack.pop()
+    index = {n: i for i, n in enumerate(postorder)}
+    preds = {n: [] for n in postorder}
+    for n in postorder:
+        for v in succ[n]:
+            preds[v].append(n)
+    idom = {entry: entry}
+    changed = True
+    while changed:
+        changed = False
+        for n in reversed(postorder):
+            if n == entry:
+                continue
+            new = None
+            for p in preds[n]:
+                if p not in idom:
+                    continue
+                if new is None:
+                    new = p
+                    continue
+                a, b = p, new
+                while a != b:
+                    while index[a] < index[b]:
+                        a = idom[a]
+                    while index[b] < index[a]:
+                        b = idom[b]
+                new = a
+            if idom.get(n) != new:
+                idom[n] = new
+                changed = True
+    return idom
+
+
+def dominates(idom: Dict[int, int], a: int, b: int) -> bool:
+    while b != a:
+        if idom[b] == b:
+            return False
+        b = idom[b]
+    return True
+
+
+def topological_order(start: int, nodes: Set[int], succ: Dict[int, Dict[int, int]]) -> List[int]:
+    # Nodes reachable from start within nodes, ignoring edges back to start
+    order = list()
+    state = {start: 1}
+    stack = [(start, iter(succ[start]))]
+    while stack:
+        node, children = stack[-1]
+        for child in children:
+            if child not in nodes or child == start:
+                continue
+            if state.get(child) == 1:
+                raise AnalysisError('irreducible control flow at 0x%x' % child)
+            if child not in state:
+                state[child] = 1
+                stack.append((child, iter(succ[child])))
+                break
+        else:
+            state[node] = 2
+            order.append(node)
+            stack.pop()
+    return order[::-1]
+
+
+def longest_path(entry: int, weight: Dict[int, int], succ: Dict[int, Dict[int, int]], bound_of) -> int:
+    # Collapses each natural loop, innermost first, into its header: the
+    # header costs the loop's bound times its longest iteration, and each
+    # exit edge carries the longest path from the header to it
+    weight = dict(weight)
+    succ = {n: dict(edges) for n, edges in succ.items()}
+    preds = {n: set() for n in succ}
+    for n in succ:
+        for v in succ[n]:
+            preds[v].add(n)
+    idom = immediate_dominators(entry, succ)
+    latches = dict()
+    for n in succ:
+        for v in succ[n]:
+            if dominates(idom, v, n):
+                latches.setdefault(v, set()).add(n)
+    bodies = dict()
+    for header, tails in latches.items():
+        body = {header}
+        pending = list(tails)
+        while pending:
+            n = pending.pop()
+            if n not in body:
+                body.add(n)
+                pending.extend(preds[n])
+        bodies[header] = body
+
+    rep = {n: n for n in succ}
+    for header in sorted(bodies, key=lambda h: len(bodies[h])):
+        bound = bound_of(header, latches[header])
+        body = set(rep[n] for n in bodies[header])
+        dist = {header: weight[header]}
+        for n in topological_order(header, body, succ):
+            for v, extra in succ[n].items():
+                if v in body and v != header:
+                    dist[v] = max(dist.get(v, 0), dist[n] + extra + weight[v])
+        iteration = max(dist[n] + succ[n][header] for n in body if n in dist and header in succ[n])
+        exits = dict()
+        for n in body:
+            for v, extra in succ.get(n, {}).items():
+                if v not in body and n in dist:
+                    exits[v] = max(exits.get(v, 0), dist[n] + extra)
+        if not exits:
+            raise AnalysisError('loop at 0x%x never exits' % header)
+        for n in body - {header}:
+            del weight[n]
+            del succ[n]
+        weight[header] = bound * iteration
+        succ[header] = exits
+        for n in rep:
+            if rep[n] in body:
+                rep[n] = header
+
+    dist = {entry: weight[entry]}
+    for n in topological_order(entry, set(succ), succ):
+        for v, extra in succ[n].items():
+            dist[v] = max(dist.get(v, 0), dist[n] + extra + weight[v])
+    exits = [dist[n] for n in dist if not succ[n]]
+    if not exits:
+        raise AnalysisError('no return from 0x%x' % entry)
+    return max(exits)
+
+
+def read_listing(args) -> List[str]:
+    if args.listing:
+        with open(args.listing) as inf:
+            return inf.readlines()
+    output = subprocess.run([args.objdump, '-d', '-l', '-C', args.elf], check=True,
+                            stdout=subprocess.PIPE, universal_newlines=True).stdout
+    return output.splitlines()
+
+
+def budget_of(label: str, isr: bool) -> Tuple[int, int]:
+    if label in BUDGETS:
+        return BUDGETS[label]
+    return ISR_BUDGET if isr else (0, 0)
+
+
+if __name__ == '__main__':
+    parser = argparse.ArgumentParser(description='Check worst-case cycles and stack depth of the DRSSTC '
+                                                 'firmware ISRs and hot functions against their budgets',
+                                     add_help=True)
+    parser.add_argument('--elf', metavar='PATH', type=str, nargs='?', required=False,
+                        help='Firmware image built with debug info')
+    parser.add_argument('--listing', metavar='PATH', type=str, nargs='?', required=False,
+                        help='Saved output of avr-objdump -d -l -C, instead of --elf')
+    parser.add_argument('--objdump', metavar='PATH', type=str, nargs='?', required=False,
+                        default='avr-objdump', help='avr-objdump to disassemble with')
+    parser.add_argument('--mcu', metavar='MCU', type=str, nargs='?', required=False,
+                        default='atmega328p', help='atmega328p or atmega2560')
+    parser.add_argument('--source', metavar='DIR', type=str, nargs='?', required=False,
+                        default=os.path.join(os.path.dirname(os.path.abspath(__file__)), 'drsstc_firmware'),
+                        help='Sketch sources, for matching loops to SOURCE_LOOP_BOUNDS')
+    args = parser.parse_args()
+    if bool(args.elf) == bool(args.listing):
+        parser.error('give exactly one of --elf and --listing')
+
+    program = Program(read_listing(args))
+    analyzer = Analyzer(program, args.mcu, args.source)
+    roots = [(func, True) for func in program.functions.values()
+             if re.match(r'__vector_\d+$', base_name(func.name))]
+    for name in HOT_FUNCTIONS:
+        found = program.by_name.get(name, [])
+        if not found:
+            print('%-28s inlined into its callers' % name)
+        roots += [(func, False) for func in found]
+
+    failed = False
+    deepest_isr = 0
+    print('%-28s %8s %8s %6s %6s' % ('', 'cycles', 'budget', 'stack', 'budget'))
+    for func, isr in roots:
+        label = analyzer.label(func)
+        try:
+            result = analyzer.analyze(func)
+        except AnalysisError as error:
+            print('%-28s FAILED: %s' % (label, error))
+            failed = True
+            continue
+        cycles, stack = result
+        if isr:
+            cycles += ISR_ENTRY_CYCLES[1 if analyzer.pc22 else 0]
+            stack += analyzer.pc_bytes
+            deepest_isr = max(deepest_isr, stack)
+        cycle_budget, stack_budget = budget_of(label, isr)
+        over = (cycle_budget and cycles > cycle_budget) or (stack_budget and stack > stack_budget)
+        failed = failed or bool(over)
+        print('%-28s %8d %8s %6d %6s%s' % (label, cycles, cycle_budget or '-', stack, stack_budget or '-',
+                                           '  OVER BUDGET' if over else ''))
+    print('Any ISR may add up to %d bytes of stack to the figures above' % deepest_isr)
+    sys.exit(1 if failed else 0)
@@ -0,0 +1,9 @@
+// Fixture lines for listing.lst's debug info: budget_check.py matches loops
+// by the text of these lines, copied from the sketch
+bool play_midi() {
+    for (uint8_t pixel = 0; pixel < NUM_LEDS; pixel++)
+      if (restruck) play_midi_note(entry.note, entry.volume, entry.song_voice);
+      memset(led_cue_frame, arg & LED_PALETTE_MASK, NUM_LEDS);
+      memcpy(frame, led_cue_frame, NUM_LEDS);
+
+void play_midi_note(uint8_t note, uint8_t volume, uint8_t song_voice) {
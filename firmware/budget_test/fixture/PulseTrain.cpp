@@ -0,0 +1,3 @@
+// Fixture lines for listing.lst's debug info
+void pulse_train_isr() {
+  while (TCNT1 <= current_duty) {}
@@ -1,491 +1,44 @@
 #include "MIDIPlayer.h"
 
-// converted from invent1.mid - 1439 bytes total
+// converted from invent1.mid - 598 bytes total (964 bytes before Huffman coding)
 extern const byte BACH_INVENTION[] PROGMEM = 
 {
-      0x01,0xf0,0x2a,0x4a,0xca, //      0 BEGIN PROGRAM (240 ticks/beat, tempo = 697674 us/beat)
-                0xbc,0xbc,0x05, //     60 T1 ON, NOTE  60 VOLUME  5
-                0xbc,0xbe,0x05, //     60 T1 ON, NOTE  62 VOLUME  5
-                0xbc,0xc0,0x05, //     60 T1 ON, NOTE  64 VOLUME  5
-                0xbc,0xc1,0x05, //     60 T1 ON, NOTE  65 VOLUME  5
-                0xbc,0xbe,0x05, //     60 T1 ON, NOTE  62 VOLUME  5
-                0xbc,0xc0,0x05, //     60 T1 ON, NOTE  64 VOLUME  5
-                0xbc,0xbc,0x05, //     60 T1 ON, NOTE  60 VOLUME  5
-                0xbc,0xc3,0x05, //     60 T1 ON, NOTE  67 VOLUME  5
-                0xbc,0x30,0x05, //     60 T2 ON, NOTE  48 VOLUME  5
-                0xbc,0xc8,0x05, //     60 T1 ON, NOTE  72 VOLUME  5
-                0x80,0x32,0x05, //      0 T2 ON, NOTE  50 VOLUME  5
-                0xbc,0x34,0x05, //     60 T2 ON, NOTE  52 VOLUME  5
-                0xbc,0xc7,0x05, //     60 T1 ON, NOTE  71 VOLUME  5
-                0x80,0x35,0x05, //      0 T2 ON, NOTE  53 VOLUME  5
-                0x9e,0xc5,0x05, //     30 T1 ON, NOTE  69 VOLUME  5
-                0x9e,0xc7,0x05, //     30 T1 ON, NOTE  71 VOLUME  5
-                0x80,0x32,0x05, //      0 T2 ON, NOTE  50 VOLUME  5
-                0xbc,0xc8,0x05, //     60 T1 ON, NOTE  72 VOLUME  5
-                0x80,0x34,0x05, //      0 T2 ON, NOTE  52 VOLUME  5
-                0xbc,0x30,0x05, //     60 T2 ON, NOTE  48 VOLUME  5
-                0xbc,0xca,0x05, //     60 T1 ON, NOTE  74 VOLUME  5
-                0x80,0x37,0x05, //      0 T2 ON, NOTE  55 VOLUME  5
-                0xbc,0xc3,0x05, //     60 T1 ON, NOTE  67 VOLUME  5
-                0xbc,0xc5,0x05, //     60 T1 ON, NOTE  69 VOLUME  5
-                0x80,0x2b,0x05, //      0 T2 ON, NOTE  43 VOLUME  5
-                0xbc,0xc7,0x05, //     60 T1 ON, NOTE  71 VOLUME  5
-                0xbc,0xc8,0x05, //     60 T1 ON, NOTE  72 VOLUME  5
-                     0x80,0x00, //      0 T2 OFF
-                0xbc,0xc5,0x05, //     60 T1 ON, NOTE  69 VOLUME  5
-                0xbc,0xc7,0x05, //     60 T1 ON, NOTE  71 VOLUME  5
-                0xbc,0xc3,0x05, //     60 T1 ON, NOTE  67 VOLUME  5
-                0xbc,0xca,0x05, //     60 T1 ON, NOTE  74 VOLUME  5
-                0xbc,0x37,0x05, //     60 T2 ON, NOTE  55 VOLUME  5
-                0xbc,0xcf,0x05, //     60 T1 ON, NOTE  79 VOLUME  5
-                0x80,0x39,0x05, //      0 T2 ON, NOTE  57 VOLUME  5
-                0xbc,0x3b,0x05, //     60 T2 ON, NOTE  59 VOLUME  5
-                0xbc,0xcd,0x05, //     60 T1 ON, NOTE  77 VOLUME  5
-                0x80,0x3c,0x05, //      0 T2 ON, NOTE  60 VOLUME  5
-                0x9e,0xcc,0x05, //     30 T1 ON, NOTE  76 VOLUME  5
-                0x9e,0xcd,0x05, //     30 T1 ON, NOTE  77 VOLUME  5
-                0x80,0x39,0x05, //      0 T2 ON, NOTE  57 VOLUME  5
-                0xbc,0xcf,0x05, //     60 T1 ON, NOTE  79 VOLUME  5
-                0x80,0x3b,0x05, //      0 T2 ON, NOTE  59 VOLUME  5
-                0xbc,0x37,0x05, //     60 T2 ON, NOTE  55 VOLUME  5
-                0xbc,0xcc,0x05, //     60 T1 ON, NOTE  76 VOLUME  5
-                0x80,0x3c,0x05, //      0 T2 ON, NOTE  60 VOLUME  5
-                0xbc,0xd1,0x05, //     60 T1 ON, NOTE  81 VOLUME  5
-                0xbc,0xcf,0x05, //     60 T1 ON, NOTE  79 VOLUME  5
-                0x80,0x3b,0x05, //      0 T2 ON, NOTE  59 VOLUME  5
-                0xbc,0xcd,0x05, //     60 T1 ON, NOTE  77 VOLUME  5
-                0xbc,0xcc,0x05, //     60 T1 ON, NOTE  76 VOLUME  5
-                0x80,0x3c,0x05, //      0 T2 ON, NOTE  60 VOLUME  5
-                0xbc,0xcf,0x05, //     60 T1 ON, NOTE  79 VOLUME  5
-                0xbc,0xcd,0x05, //     60 T1 ON, NOTE  77 VOLUME  5
-                0x80,0x3e,0x05, //      0 T2 ON, NOTE  62 VOLUME  5
-                0xbc,0xd1,0x05, //     60 T1 ON, NOTE  81 VOLUME  5
-                0xbc,0xcf,0x05, //     60 T1 ON, NOTE  79 VOLUME  5
-                0x80,0x40,0x05, //      0 T2 ON, NOTE  64 VOLUME  5
-                0xbc,0xcd,0x05, //     60 T1 ON, NOTE  77 VOLUME  5
-                0xbc,0xcc,0x05, //     60 T1 ON, NOTE  76 VOLUME  5
-                0x80,0x37,0x05, //      0 T2 ON, NOTE  55 VOLUME  5
-                0xbc,0xca,0x05, //     60 T1 ON, NOTE  74 VOLUME  5
-                0xbc,0xc8,0x05, //     60 T1 ON, NOTE  72 VOLUME  5
-                0x80,0x39,0x05, //      0 T2 ON, NOTE  57 VOLUME  5
-                0xbc,0xcc,0x05, //     60 T1 ON, NOTE  76 VOLUME  5
-                0xbc,0xca,0x05, //     60 T1 ON, NOTE  74 VOLUME  5
-                0x80,0x3b,0x05, //      0 T2 ON, NOTE  59 VOLUME  5
-                0xbc,0xcd,0x05, //     60 T1 ON, NOTE  77 VOLUME  5
-                0xbc,0xcc,0x05, //     60 T1 ON, NOTE  76 VOLUME  5
-                0x80,0x3c,0x05, //      0 T2 ON, NOTE  60 VOLUME  5
-                0xbc,0xca,0x05, //     60 T1 ON, NOTE  74 VOLUME  5
-                0xbc,0xc8,0x05, //     60 T1 ON, NOTE  72 VOLUME  5
-                0x80,0x34,0x05, //      0 T2 ON, NOTE  52 VOLUME  5
-                0xbc,0xc7,0x05, //     60 T1 ON, NOTE  71 VOLUME  5
-                0xbc,0xc5,0x05, //     60 T1 ON, NOTE  69 VOLUME  5
-                0x80,0x36,0x05, //      0 T2 ON, NOTE  54 VOLUME  5
-                0xbc,0xc8,0x05, //     60 T1 ON, NOTE  72 VOLUME  5
-                0xbc,0xc7,0x05, //     60 T1 ON, NOTE  71 VOLUME  5
-                0x80,0x37,0x05, //      0 T2 ON, NOTE  55 VOLUME  5
-                0xbc,0xca,0x05, //     60 T1 ON, NOTE  74 VOLUME  5
-                0xbc,0xc8,0x05, //     60 T1 ON, NOTE  72 VOLUME  5
-                0x80,0x39,0x05, //      0 T2 ON, NOTE  57 VOLUME  5
-                0xbc,0xc7,0x05, //     60 T1 ON, NOTE  71 VOLUME  5
-                0xbc,0xc5,0x05, //     60 T1 ON, NOTE  69 VOLUME  5
-                0x80,0x3b,0x05, //      0 T2 ON, NOTE  59 VOLUME  5
-                0xbc,0xc3,0x05, //     60 T1 ON, NOTE  67 VOLUME  5
-                0xbc,0xc2,0x05, //     60 T1 ON, NOTE  66 VOLUME  5
-                0x80,0x3c,0x05, //      0 T2 ON, NOTE  60 VOLUME  5
-                0xbc,0xc5,0x05, //     60 T1 ON, NOTE  69 VOLUME  5
-                0xbc,0xc3,0x05, //     60 T1 ON, NOTE  67 VOLUME  5
-                0xbc,0xc7,0x05, //     60 T1 ON, NOTE  71 VOLUME  5
-                0xbc,0xc5,0x05, //     60 T1 ON, NOTE  69 VOLUME  5
-                     0xb2,0x00, //     50 T2 OFF
-                0x8a,0x32,0x05, //     10 T2 ON, NOTE  50 VOLUME  5
-                0xbc,0xbe,0x05, //     60 T1 ON, NOTE  62 VOLUME  5
-                0x80,0x34,0x05, //      0 T2 ON, NOTE  52 VOLUME  5
-                0xbc,0x36,0x05, //     60 T2 ON, NOTE  54 VOLUME  5
-                0xbc,0xc8,0x05, //     60 T1 ON, NOTE  72 VOLUME  5
-                0x80,0x37,0x05, //      0 T2 ON, NOTE  55 VOLUME  5
-                0x9e,0xc7,0x05, //     30 T1 ON, NOTE  71 VOLUME  5
-                0x9e,0xc8,0x05, //     30 T1 ON, NOTE  72 VOLUME  5
-                0x80,0x34,0x05, //      0 T2 ON, NOTE  52 VOLUME  5
-                0xbc,0x36,0x05, //     60 T2 ON, NOTE  54 VOLUME  5
-                0xbc,0xca,0x05, //     60 T1 ON, NOTE  74 VOLUME  5
-                0x80,0x32,0x05, //      0 T2 ON, NOTE  50 VOLUME  5
-                0xbc,0xc7,0x05, //     60 T1 ON, NOTE  71 VOLUME  5
-                0x80,0x37,0x05, //      0 T2 ON, NOTE  55 VOLUME  5
-                0xbc,0xc5,0x05, //     60 T1 ON, NOTE  69 VOLUME  5
-                0xbc,0xc3,0x05, //     60 T1 ON, NOTE  67 VOLUME  5
-                0x80,0x2f,0x05, //      0 T2 ON, NOTE  47 VOLUME  5
-                0xbc,0xc2,0x05, //     60 T1 ON, NOTE  66 VOLUME  5
-                0xbc,0xc0,0x05, //     60 T1 ON, NOTE  64 VOLUME  5
-                0x80,0x30,0x05, //      0 T2 ON, NOTE  48 VOLUME  5
-                0xbc,0xc3,0x05, //     60 T1 ON, NOTE  67 VOLUME  5
-                0xbc,0xc2,0x05, //     60 T1 ON, NOTE  66 VOLUME  5
-                0x80,0x32,0x05, //      0 T2 ON, NOTE  50 VOLUME  5
-                0xbc,0xc5,0x05, //     60 T1 ON, NOTE  69 VOLUME  5
-                0xbc,0xc3,0x05, //     60 T1 ON, NOTE  67 VOLUME  5
-                0x80,0x34,0x05, //      0 T2 ON, NOTE  52 VOLUME  5
-                0xbc,0xc7,0x05, //     60 T1 ON, NOTE  71 VOLUME  5
-                0xbc,0xc5,0x05, //     60 T1 ON, NOTE  69 VOLUME  5
-                0x80,0x36,0x05, //      0 T2 ON, NOTE  54 VOLUME  5
-                0xbc,0xc8,0x05, //     60 T1 ON, NOTE  72 VOLUME  5
-                0xbc,0xc7,0x05, //     60 T1 ON, NOTE  71 VOLUME  5
-                0x80,0x37,0x05, //      0 T2 ON, NOTE  55 VOLUME  5
-                0xbc,0xca,0x05, //     60 T1 ON, NOTE  74 VOLUME  5
-                0xbc,0xc8,0x05, //     60 T1 ON, NOTE  72 VOLUME  5
-                0x80,0x34,0x05, //      0 T2 ON, NOTE  52 VOLUME  5
-                0xbc,0xcc,0x05, //     60 T1 ON, NOTE  76 VOLUME  5
-                0xbc,0xca,0x05, //     60 T1 ON, NOTE  74 VOLUME  5
-                0x80,0x2f,0x05, //      0 T2 ON, NOTE  47 VOLUME  5
-                0xbc,0xc7,0x05, //     60 T1 ON, NOTE  71 VOLUME  5
-                0x9e,0xc8,0x05, //     30 T1 ON, NOTE  72 VOLUME  5
-                0x9e,0xca,0x05, //     30 T1 ON, NOTE  74 VOLUME  5
-                0xbc,0xcf,0x05, //     60 T1 ON, NOTE  79 VOLUME  5
-                0x80,0x30,0x05, //      0 T2 ON, NOTE  48 VOLUME  5
-                0xbc,0xc7,0x05, //     60 T1 ON, NOTE  71 VOLUME  5
-                0x80,0x32,0x05, //      0 T2 ON, NOTE  50 VOLUME  5
-                0x9e,0xc8,0x05, //     30 T1 ON, NOTE  72 VOLUME  5
-                0x9e,0xc7,0x05, //     30 T1 ON, NOTE  71 VOLUME  5
-                0xbc,0xc5,0x05, //     60 T1 ON, NOTE  69 VOLUME  5
-                0x80,0x26,0x05, //      0 T2 ON, NOTE  38 VOLUME  5
-                0xbc,0xc3,0x05, //     60 T1 ON, NOTE  67 VOLUME  5
-                     0xbc,0x00, //     60 T2 OFF
-                0xbc,0x2b,0x05, //     60 T2 ON, NOTE  43 VOLUME  5
-                0xbc,0xad,0x05, //     60 T1 ON, NOTE  45 VOLUME  5
-                     0x80,0x00, //      0 T2 OFF
-                0xbc,0xaf,0x05, //     60 T1 ON, NOTE  47 VOLUME  5
-                0xbc,0xb0,0x05, //     60 T1 ON, NOTE  48 VOLUME  5
-                0xbc,0xad,0x05, //     60 T1 ON, NOTE  45 VOLUME  5
-                0xbc,0xaf,0x05, //     60 T1 ON, NOTE  47 VOLUME  5
-                0xbc,0xab,0x05, //     60 T1 ON, NOTE  43 VOLUME  5
-                0xbc,0xb2,0x05, //     60 T1 ON, NOTE  50 VOLUME  5
-                0xbc,0x43,0x05, //     60 T2 ON, NOTE  67 VOLUME  5
-                0xbc,0xc5,0x05, //     60 T1 ON, NOTE  69 VOLUME  5
-                0x80,0x37,0x05, //      0 T2 ON, NOTE  55 VOLUME  5
-                0xbc,0xc7,0x05, //     60 T1 ON, NOTE  71 VOLUME  5
-                0xbc,0xc8,0x05, //     60 T1 ON, NOTE  72 VOLUME  5
-                0x80,0x36,0x05, //      0 T2 ON, NOTE  54 VOLUME  5
-                0xbc,0xc5,0x05, //     60 T1 ON, NOTE  69 VOLUME  5
-                0xbc,0xc7,0x05, //     60 T1 ON, NOTE  71 VOLUME  5
-                0x80,0x37,0x05, //      0 T2 ON, NOTE  55 VOLUME  5
-                0xbc,0xc3,0x05, //     60 T1 ON, NOTE  67 VOLUME  5
-                0xbc,0xc2,0x05, //     60 T1 ON, NOTE  66 VOLUME  5
-                0x80,0x39,0x05, //      0 T2 ON, NOTE  57 VOLUME  5
-                0xbc,0x32,0x05, //     60 T2 ON, NOTE  50 VOLUME  5
-                0xbc,0xb4,0x05, //     60 T1 ON, NOTE  52 VOLUME  5
-                     0x80,0x00, //      0 T2 OFF
-                0xbc,0xb6,0x05, //     60 T1 ON, NOTE  54 VOLUME  5
-                0xbc,0xb7,0x05, //     60 T1 ON, NOTE  55 VOLUME  5
-                0xbc,0xb4,0x05, //     60 T1 ON, NOTE  52 VOLUME  5
-                0xbc,0xb6,0x05, //     60 T1 ON, NOTE  54 VOLUME  5
-                0xbc,0xb2,0x05, //     60 T1 ON, NOTE  50 VOLUME  5
-                0xbc,0xb9,0x05, //     60 T1 ON, NOTE  57 VOLUME  5
-                0xbc,0x45,0x05, //     60 T2 ON, NOTE  69 VOLUME  5
-                0xbc,0xc7,0x05, //     60 T1 ON, NOTE  71 VOLUME  5
-                0x80,0x3e,0x05, //      0 T2 ON, NOTE  62 VOLUME  5
-                0xbc,0xc8,0x05, //     60 T1 ON, NOTE  72 VOLUME  5
-                0xbc,0xca,0x05, //     60 T1 ON, NOTE  74 VOLUME  5
-                0x80,0x3c,0x05, //      0 T2 ON, NOTE  60 VOLUME  5
-                0xbc,0xc7,0x05, //     60 T1 ON, NOTE  71 VOLUME  5
-                0xbc,0xc8,0x05, //     60 T1 ON, NOTE  72 VOLUME  5
-                0x80,0x3e,0x05, //      0 T2 ON, NOTE  62 VOLUME  5
-                0xbc,0xc5,0x05, //     60 T1 ON, NOTE  69 VOLUME  5
-                0xbc,0xc7,0x05, //     60 T1 ON, NOTE  71 VOLUME  5
-                0x80,0x37,0x05, //      0 T2 ON, NOTE  55 VOLUME  5
-                0xbc,0x43,0x05, //     60 T2 ON, NOTE  67 VOLUME  5
-                0xbc,0xc1,0x05, //     60 T1 ON, NOTE  65 VOLUME  5
-                     0x80,0x00, //      0 T2 OFF
-                0xbc,0xc0,0x05, //     60 T1 ON, NOTE  64 VOLUME  5
-                0xbc,0xbe,0x05, //     60 T1 ON, NOTE  62 VOLUME  5
-                0xbc,0xc1,0x05, //     60 T1 ON, NOTE  65 VOLUME  5
-                0xbc,0xc0,0x05, //     60 T1 ON, NOTE  64 VOLUME  5
-                0xbc,0xc3,0x05, //     60 T1 ON, NOTE  67 VOLUME  5
-                0xbc,0xc1,0x05, //     60 T1 ON, NOTE  65 VOLUME  5
-                0xbc,0x4a,0x05, //     60 T2 ON, NOTE  74 VOLUME  5
-                0xbc,0xc8,0x05, //     60 T1 ON, NOTE  72 VOLUME  5
-                0x80,0x40,0x05, //      0 T2 ON, NOTE  64 VOLUME  5
-                0xbc,0xc7,0x05, //     60 T1 ON, NOTE  71 VOLUME  5
-                0xbc,0xc5,0x05, //     60 T1 ON, NOTE  69 VOLUME  5
-                0x80,0x41,0x05, //      0 T2 ON, NOTE  65 VOLUME  5
-                0xbc,0xc8,0x05, //     60 T1 ON, NOTE  72 VOLUME  5
-                0xbc,0xc7,0x05, //     60 T1 ON, NOTE  71 VOLUME  5
-                0x80,0x3e,0x05, //      0 T2 ON, NOTE  62 VOLUME  5
-                0xbc,0xca,0x05, //     60 T1 ON, NOTE  74 VOLUME  5
-                0xbc,0xc8,0x05, //     60 T1 ON, NOTE  72 VOLUME  5
-                0x80,0x40,0x05, //      0 T2 ON, NOTE  64 VOLUME  5
-                0xbc,0x45,0x05, //     60 T2 ON, NOTE  69 VOLUME  5
-                0xbc,0xc3,0x05, //     60 T1 ON, NOTE  67 VOLUME  5
-                     0x80,0x00, //      0 T2 OFF
-                0xbc,0xc1,0x05, //     60 T1 ON, NOTE  65 VOLUME  5
-                0xbc,0xc0,0x05, //     60 T1 ON, NOTE  64 VOLUME  5
-                0xbc,0xc3,0x05, //     60 T1 ON, NOTE  67 VOLUME  5
-                0xbc,0xc1,0x05, //     60 T1 ON, NOTE  65 VOLUME  5
-                0xbc,0xc5,0x05, //     60 T1 ON, NOTE  69 VOLUME  5
-                0xbc,0xc3,0x05, //     60 T1 ON, NOTE  67 VOLUME  5
-                0xbc,0x4c,0x05, //     60 T2 ON, NOTE  76 VOLUME  5
-                0xbc,0xca,0x05, //     60 T1 ON, NOTE  74 VOLUME  5
-                0x80,0x41,0x05, //      0 T2 ON, NOTE  65 VOLUME  5
-                0xbc,0xc8,0x05, //     60 T1 ON, NOTE  72 VOLUME  5
-                0xbc,0xc7,0x05, //     60 T1 ON, NOTE  71 VOLUME  5
-                0x80,0x43,0x05, //      0 T2 ON, NOTE  67 VOLUME  5
-                0xbc,0xca,0x05, //     60 T1 ON, NOTE  74 VOLUME  5
-                0xbc,0xc9,0x05, //     60 T1 ON, NOTE  73 VOLUME  5
-                0x80,0x40,0x05, //      0 T2 ON, NOTE  64 VOLUME  5
-                0xbc,0xcc,0x05, //     60 T1 ON, NOTE  76 VOLUME  5
-                0xbc,0xca,0x05, //     60 T1 ON, NOTE  74 VOLUME  5
-                0x80,0x41,0x05, //      0 T2 ON, NOTE  65 VOLUME  5
-                0xbc,0x46,0x05, //     60 T2 ON, NOTE  70 VOLUME  5
-                0xbc,0xc9,0x05, //     60 T1 ON, NOTE  73 VOLUME  5
-                0x80,0x45,0x05, //      0 T2 ON, NOTE  69 VOLUME  5
-                0xbc,0x43,0x05, //     60 T2 ON, NOTE  67 VOLUME  5
-                0xbc,0xca,0x05, //     60 T1 ON, NOTE  74 VOLUME  5
-                0x80,0x41,0x05, //      0 T2 ON, NOTE  65 VOLUME  5
-                0xbc,0x45,0x05, //     60 T2 ON, NOTE  69 VOLUME  5
-                0xbc,0xcc,0x05, //     60 T1 ON, NOTE  76 VOLUME  5
-                0x80,0x43,0x05, //      0 T2 ON, NOTE  67 VOLUME  5
-                0xbc,0x46,0x05, //     60 T2 ON, NOTE  70 VOLUME  5
-                0xbc,0xcd,0x05, //     60 T1 ON, NOTE  77 VOLUME  5
-                0x80,0x45,0x05, //      0 T2 ON, NOTE  69 VOLUME  5
-                0xbc,0x43,0x05, //     60 T2 ON, NOTE  67 VOLUME  5
-                0xbc,0xc5,0x05, //     60 T1 ON, NOTE  69 VOLUME  5
-                0x80,0x41,0x05, //      0 T2 ON, NOTE  65 VOLUME  5
-                0xbc,0x40,0x05, //     60 T2 ON, NOTE  64 VOLUME  5
-                0xbc,0xc7,0x05, //     60 T1 ON, NOTE  71 VOLUME  5
-                0x80,0x3e,0x05, //      0 T2 ON, NOTE  62 VOLUME  5
-                0xbc,0x41,0x05, //     60 T2 ON, NOTE  65 VOLUME  5
-                0xbc,0xc9,0x05, //     60 T1 ON, NOTE  73 VOLUME  5
-                0x80,0x40,0x05, //      0 T2 ON, NOTE  64 VOLUME  5
-                0xbc,0x43,0x05, //     60 T2 ON, NOTE  67 VOLUME  5
-                0xbc,0xca,0x05, //     60 T1 ON, NOTE  74 VOLUME  5
-                0x80,0x41,0x05, //      0 T2 ON, NOTE  65 VOLUME  5
-                0xbc,0x40,0x05, //     60 T2 ON, NOTE  64 VOLUME  5
-                0xbc,0xc2,0x05, //     60 T1 ON, NOTE  66 VOLUME  5
-                0x80,0x3e,0x05, //      0 T2 ON, NOTE  62 VOLUME  5
-                0xbc,0x3c,0x05, //     60 T2 ON, NOTE  60 VOLUME  5
-                0xbc,0xc4,0x05, //     60 T1 ON, NOTE  68 VOLUME  5
-                0x80,0x3b,0x05, //      0 T2 ON, NOTE  59 VOLUME  5
-                0xbc,0x3e,0x05, //     60 T2 ON, NOTE  62 VOLUME  5
-                0xbc,0xc5,0x05, //     60 T1 ON, NOTE  69 VOLUME  5
-                0x80,0x3c,0x05, //      0 T2 ON, NOTE  60 VOLUME  5
-                0xbc,0x40,0x05, //     60 T2 ON, NOTE  64 VOLUME  5
-                0xbc,0xc7,0x05, //     60 T1 ON, NOTE  71 VOLUME  5
-                0x80,0x3e,0x05, //      0 T2 ON, NOTE  62 VOLUME  5
-                0xbc,0x3c,0x05, //     60 T2 ON, NOTE  60 VOLUME  5
-                0xbc,0xc8,0x05, //     60 T1 ON, NOTE  72 VOLUME  5
-                0x80,0x3b,0x05, //      0 T2 ON, NOTE  59 VOLUME  5
-                0xbc,0x39,0x05, //     60 T2 ON, NOTE  57 VOLUME  5
-                0xbc,0xca,0x05, //     60 T1 ON, NOTE  74 VOLUME  5
-                0x80,0x38,0x05, //      0 T2 ON, NOTE  56 VOLUME  5
-                0xbc,0x3b,0x05, //     60 T2 ON, NOTE  59 VOLUME  5
-                0xbc,0x39,0x05, //     60 T2 ON, NOTE  57 VOLUME  5
-                0xbc,0x3c,0x05, //     60 T2 ON, NOTE  60 VOLUME  5
-                0xbc,0xbb,0x05, //     60 T1 ON, NOTE  59 VOLUME  5
-                     0x80,0x00, //      0 T2 OFF
-                0xbc,0x40,0x05, //     60 T2 ON, NOTE  64 VOLUME  5
-                0xbc,0xc2,0x05, //     60 T1 ON, NOTE  66 VOLUME  5
-                0x80,0x34,0x05, //      0 T2 ON, NOTE  52 VOLUME  5
-                0xbc,0xc4,0x05, //     60 T1 ON, NOTE  68 VOLUME  5
-                0xbc,0xc5,0x05, //     60 T1 ON, NOTE  69 VOLUME  5
-                0x80,0x3e,0x05, //      0 T2 ON, NOTE  62 VOLUME  5
-                0x9e,0x3c,0x05, //     30 T2 ON, NOTE  60 VOLUME  5
-                0x9e,0xc2,0x05, //     30 T1 ON, NOTE  66 VOLUME  5
-                0x80,0x3e,0x05, //      0 T2 ON, NOTE  62 VOLUME  5
-                0xbc,0xc4,0x05, //     60 T1 ON, NOTE  68 VOLUME  5
-                0xbc,0xc0,0x05, //     60 T1 ON, NOTE  64 VOLUME  5
-                     0x80,0x00, //      0 T2 OFF
-                0xbc,0xcc,0x05, //     60 T1 ON, NOTE  76 VOLUME  5
-                0x80,0x3c,0x05, //      0 T2 ON, NOTE  60 VOLUME  5
-                0xbc,0xca,0x05, //     60 T1 ON, NOTE  74 VOLUME  5
-                0x80,0x3b,0x05, //      0 T2 ON, NOTE  59 VOLUME  5
-                0xbc,0xc8,0x05, //     60 T1 ON, NOTE  72 VOLUME  5
-                0x80,0x39,0x05, //      0 T2 ON, NOTE  57 VOLUME  5
-                0xbc,0xcc,0x05, //     60 T1 ON, NOTE  76 VOLUME  5
-                0x80,0x37,0x05, //      0 T2 ON, NOTE  55 VOLUME  5
-                0xbc,0xca,0x05, //     60 T1 ON, NOTE  74 VOLUME  5
-                0x80,0x36,0x05, //      0 T2 ON, NOTE  54 VOLUME  5
-                0xbc,0xc8,0x05, //     60 T1 ON, NOTE  72 VOLUME  5
-                0x80,0x39,0x05, //      0 T2 ON, NOTE  57 VOLUME  5
-                0xbc,0xc7,0x05, //     60 T1 ON, NOTE  71 VOLUME  5
-                0x80,0x38,0x05, //      0 T2 ON, NOTE  56 VOLUME  5
-                0xbc,0xca,0x05, //     60 T1 ON, NOTE  74 VOLUME  5
-                0x80,0x3b,0x05, //      0 T2 ON, NOTE  59 VOLUME  5
-                0xbc,0xc8,0x05, //     60 T1 ON, NOTE  72 VOLUME  5
-                0x80,0x39,0x05, //      0 T2 ON, NOTE  57 VOLUME  5
-                0xbc,0xd1,0x05, //     60 T1 ON, NOTE  81 VOLUME  5
-                0x80,0x3c,0x05, //      0 T2 ON, NOTE  60 VOLUME  5
-                0xbc,0xd0,0x05, //     60 T1 ON, NOTE  80 VOLUME  5
-                0x80,0x3b,0x05, //      0 T2 ON, NOTE  59 VOLUME  5
-                0xbc,0xd3,0x05, //     60 T1 ON, NOTE  83 VOLUME  5
-                0x80,0x3e,0x05, //      0 T2 ON, NOTE  62 VOLUME  5
-                0xbc,0xd1,0x05, //     60 T1 ON, NOTE  81 VOLUME  5
-                0x80,0x3c,0x05, //      0 T2 ON, NOTE  60 VOLUME  5
-                0xbc,0xcc,0x05, //     60 T1 ON, NOTE  76 VOLUME  5
-                0x80,0x40,0x05, //      0 T2 ON, NOTE  64 VOLUME  5
-                0xbc,0xcd,0x05, //     60 T1 ON, NOTE  77 VOLUME  5
-                0x80,0x3e,0x05, //      0 T2 ON, NOTE  62 VOLUME  5
-                0xbc,0xca,0x05, //     60 T1 ON, NOTE  74 VOLUME  5
-                0x80,0x41,0x05, //      0 T2 ON, NOTE  65 VOLUME  5
-                0xbc,0xc4,0x05, //     60 T1 ON, NOTE  68 VOLUME  5
-                0x80,0x40,0x05, //      0 T2 ON, NOTE  64 VOLUME  5
-                0xbc,0xcd,0x05, //     60 T1 ON, NOTE  77 VOLUME  5
-                0xbc,0xcc,0x05, //     60 T1 ON, NOTE  76 VOLUME  5
-                0x80,0x39,0x05, //      0 T2 ON, NOTE  57 VOLUME  5
-                0xbc,0xca,0x05, //     60 T1 ON, NOTE  74 VOLUME  5
-                0xbc,0xc8,0x05, //     60 T1 ON, NOTE  72 VOLUME  5
-                0x80,0x40,0x05, //      0 T2 ON, NOTE  64 VOLUME  5
-                0x9e,0xca,0x05, //     30 T1 ON, NOTE  74 VOLUME  5
-                0x9e,0xc8,0x05, //     30 T1 ON, NOTE  72 VOLUME  5
-                0xbc,0xc7,0x05, //     60 T1 ON, NOTE  71 VOLUME  5
-                0x80,0x34,0x05, //      0 T2 ON, NOTE  52 VOLUME  5
-                0xbc,0xc5,0x05, //     60 T1 ON, NOTE  69 VOLUME  5
-                0xbc,0x39,0x05, //     60 T2 ON, NOTE  57 VOLUME  5
-                0xbc,0xd1,0x05, //     60 T1 ON, NOTE  81 VOLUME  5
-                0xbc,0xcf,0x05, //     60 T1 ON, NOTE  79 VOLUME  5
-                0x80,0x2d,0x05, //      0 T2 ON, NOTE  45 VOLUME  5
-                0xbc,0xcd,0x05, //     60 T1 ON, NOTE  77 VOLUME  5
-                0xbc,0xcc,0x05, //     60 T1 ON, NOTE  76 VOLUME  5
-                     0x80,0x00, //      0 T2 OFF
-                0xbc,0xcf,0x05, //     60 T1 ON, NOTE  79 VOLUME  5
-                0xbc,0xcd,0x05, //     60 T1 ON, NOTE  77 VOLUME  5
-                0xbc,0xd1,0x05, //     60 T1 ON, NOTE  81 VOLUME  5
-                0xbc,0xcf,0x05, //     60 T1 ON, NOTE  79 VOLUME  5
-                0xbc,0x40,0x05, //     60 T2 ON, NOTE  64 VOLUME  5
-                0xbc,0x3e,0x05, //     60 T2 ON, NOTE  62 VOLUME  5
-                0xbc,0x3c,0x05, //     60 T2 ON, NOTE  60 VOLUME  5
-                0xbc,0x3b,0x05, //     60 T2 ON, NOTE  59 VOLUME  5
-                0xbc,0x3e,0x05, //     60 T2 ON, NOTE  62 VOLUME  5
-                0xbc,0x3d,0x05, //     60 T2 ON, NOTE  61 VOLUME  5
-                0xbc,0x40,0x05, //     60 T2 ON, NOTE  64 VOLUME  5
-                0xbc,0x3e,0x05, //     60 T2 ON, NOTE  62 VOLUME  5
-                     0xb2,0x80, //     50 T1 OFF
-                0x8a,0xcc,0x05, //     10 T1 ON, NOTE  76 VOLUME  5
-                0xbc,0xcd,0x05, //     60 T1 ON, NOTE  77 VOLUME  5
-                0xbc,0xcf,0x05, //     60 T1 ON, NOTE  79 VOLUME  5
-                0xbc,0xd1,0x05, //     60 T1 ON, NOTE  81 VOLUME  5
-                0xbc,0xcd,0x05, //     60 T1 ON, NOTE  77 VOLUME  5
-                0xbc,0xcf,0x05, //     60 T1 ON, NOTE  79 VOLUME  5
-                0xbc,0xcc,0x05, //     60 T1 ON, NOTE  76 VOLUME  5
-                0xbc,0xcd,0x05, //     60 T1 ON, NOTE  77 VOLUME  5
-                     0xb2,0x00, //     50 T2 OFF
-                0x8a,0x39,0x05, //     10 T2 ON, NOTE  57 VOLUME  5
-                0xbc,0x3b,0x05, //     60 T2 ON, NOTE  59 VOLUME  5
-                0xbc,0x3c,0x05, //     60 T2 ON, NOTE  60 VOLUME  5
-                0xbc,0x3e,0x05, //     60 T2 ON, NOTE  62 VOLUME  5
-                0xbc,0x3b,0x05, //     60 T2 ON, NOTE  59 VOLUME  5
-                0xbc,0x3c,0x05, //     60 T2 ON, NOTE  60 VOLUME  5
-                0xbc,0x39,0x05, //     60 T2 ON, NOTE  57 VOLUME  5
-                0xbc,0xbb,0x05, //     60 T1 ON, NOTE  59 VOLUME  5
-                     0x80,0x00, //      0 T2 OFF
-                0xbc,0x4f,0x05, //     60 T2 ON, NOTE  79 VOLUME  5
-                0xbc,0x4d,0x05, //     60 T2 ON, NOTE  77 VOLUME  5
-                0xbc,0x4c,0x05, //     60 T2 ON, NOTE  76 VOLUME  5
-                0xbc,0x4a,0x05, //     60 T2 ON, NOTE  74 VOLUME  5
-                0xbc,0x4d,0x05, //     60 T2 ON, NOTE  77 VOLUME  5
-                0xbc,0x4c,0x05, //     60 T2 ON, NOTE  76 VOLUME  5
-                0xbc,0x4f,0x05, //     60 T2 ON, NOTE  79 VOLUME  5
-                0xbc,0x4d,0x05, //     60 T2 ON, NOTE  77 VOLUME  5
-                     0xb2,0x80, //     50 T1 OFF
-                0x8a,0xbe,0x05, //     10 T1 ON, NOTE  62 VOLUME  5
-                0xbc,0xbc,0x05, //     60 T1 ON, NOTE  60 VOLUME  5
-                0xbc,0xbb,0x05, //     60 T1 ON, NOTE  59 VOLUME  5
-                0xbc,0xb9,0x05, //     60 T1 ON, NOTE  57 VOLUME  5
-                0xbc,0xbc,0x05, //     60 T1 ON, NOTE  60 VOLUME  5
-                0xbc,0xbb,0x05, //     60 T1 ON, NOTE  59 VOLUME  5
-                0xbc,0xbe,0x05, //     60 T1 ON, NOTE  62 VOLUME  5
-                0xbc,0xbc,0x05, //     60 T1 ON, NOTE  60 VOLUME  5
-                     0xb2,0x00, //     50 T2 OFF
-                0x8a,0x4a,0x05, //     10 T2 ON, NOTE  74 VOLUME  5
-                0xbc,0x4c,0x05, //     60 T2 ON, NOTE  76 VOLUME  5
-                0xbc,0x4d,0x05, //     60 T2 ON, NOTE  77 VOLUME  5
-                0xbc,0x4f,0x05, //     60 T2 ON, NOTE  79 VOLUME  5
-                0xbc,0x4c,0x05, //     60 T2 ON, NOTE  76 VOLUME  5
-                0xbc,0x4d,0x05, //     60 T2 ON, NOTE  77 VOLUME  5
-                0xbc,0x4a,0x05, //     60 T2 ON, NOTE  74 VOLUME  5
-                0xbc,0x4c,0x05, //     60 T2 ON, NOTE  76 VOLUME  5
-                     0xb2,0x80, //     50 T1 OFF
-                0x8a,0xb7,0x05, //     10 T1 ON, NOTE  55 VOLUME  5
-                0xbc,0xb9,0x05, //     60 T1 ON, NOTE  57 VOLUME  5
-                0xbc,0xba,0x05, //     60 T1 ON, NOTE  58 VOLUME  5
-                0xbc,0xbc,0x05, //     60 T1 ON, NOTE  60 VOLUME  5
-                0xbc,0xb9,0x05, //     60 T1 ON, NOTE  57 VOLUME  5
-                0xbc,0xba,0x05, //     60 T1 ON, NOTE  58 VOLUME  5
-                0xbc,0xb7,0x05, //     60 T1 ON, NOTE  55 VOLUME  5
-                0xbc,0xb9,0x05, //     60 T1 ON, NOTE  57 VOLUME  5
-                     0xb2,0x00, //     50 T2 OFF
-                0x8a,0x48,0x05, //     10 T2 ON, NOTE  72 VOLUME  5
-                0xbc,0xca,0x05, //     60 T1 ON, NOTE  74 VOLUME  5
-                0x80,0x3a,0x05, //      0 T2 ON, NOTE  58 VOLUME  5
-                0xbc,0xcc,0x05, //     60 T1 ON, NOTE  76 VOLUME  5
-                0xbc,0xcd,0x05, //     60 T1 ON, NOTE  77 VOLUME  5
-                0x80,0x39,0x05, //      0 T2 ON, NOTE  57 VOLUME  5
-                0xbc,0xca,0x05, //     60 T1 ON, NOTE  74 VOLUME  5
-                0xbc,0xcc,0x05, //     60 T1 ON, NOTE  76 VOLUME  5
-                0x80,0x37,0x05, //      0 T2 ON, NOTE  55 VOLUME  5
-                0xbc,0xc8,0x05, //     60 T1 ON, NOTE  72 VOLUME  5
-                0xbc,0xca,0x05, //     60 T1 ON, NOTE  74 VOLUME  5
-                0x80,0x35,0x05, //      0 T2 ON, NOTE  53 VOLUME  5
-                0xbc,0xcc,0x05, //     60 T1 ON, NOTE  76 VOLUME  5
-                0xbc,0xcd,0x05, //     60 T1 ON, NOTE  77 VOLUME  5
-                0x80,0x3e,0x05, //      0 T2 ON, NOTE  62 VOLUME  5
-                0xbc,0xcf,0x05, //     60 T1 ON, NOTE  79 VOLUME  5
-                0xbc,0xd1,0x05, //     60 T1 ON, NOTE  81 VOLUME  5
-                0x80,0x3c,0x05, //      0 T2 ON, NOTE  60 VOLUME  5
-                0xbc,0xcd,0x05, //     60 T1 ON, NOTE  77 VOLUME  5
-                0xbc,0xcf,0x05, //     60 T1 ON, NOTE  79 VOLUME  5
-                0x80,0x3a,0x05, //      0 T2 ON, NOTE  58 VOLUME  5
-                0xbc,0xcc,0x05, //     60 T1 ON, NOTE  76 VOLUME  5
-                0xbc,0xcd,0x05, //     60 T1 ON, NOTE  77 VOLUME  5
-                0x80,0x39,0x05, //      0 T2 ON, NOTE  57 VOLUME  5
-                0xbc,0xcf,0x05, //     60 T1 ON, NOTE  79 VOLUME  5
-                0xbc,0xd1,0x05, //     60 T1 ON, NOTE  81 VOLUME  5
-                0x80,0x41,0x05, //      0 T2 ON, NOTE  65 VOLUME  5
-                0xbc,0xd3,0x05, //     60 T1 ON, NOTE  83 VOLUME  5
-                0xbc,0xd4,0x05, //     60 T1 ON, NOTE  84 VOLUME  5
-                0x80,0x40,0x05, //      0 T2 ON, NOTE  64 VOLUME  5
-                0xbc,0xd1,0x05, //     60 T1 ON, NOTE  81 VOLUME  5
-                0xbc,0xd3,0x05, //     60 T1 ON, NOTE  83 VOLUME  5
-                0x80,0x3e,0x05, //      0 T2 ON, NOTE  62 VOLUME  5
-                0xbc,0xcf,0x05, //     60 T1 ON, NOTE  79 VOLUME  5
-                0xbc,0xd4,0x05, //     60 T1 ON, NOTE  84 VOLUME  5
-                0x80,0x40,0x05, //      0 T2 ON, NOTE  64 VOLUME  5
-                0xbc,0x32,0x05, //     60 T2 ON, NOTE  50 VOLUME  5
-                0xbc,0xcf,0x05, //     60 T1 ON, NOTE  79 VOLUME  5
-                0x80,0x34,0x05, //      0 T2 ON, NOTE  52 VOLUME  5
-                0xbc,0x35,0x05, //     60 T2 ON, NOTE  53 VOLUME  5
-                0xbc,0xcc,0x05, //     60 T1 ON, NOTE  76 VOLUME  5
-                0x80,0x37,0x05, //      0 T2 ON, NOTE  55 VOLUME  5
-                0x9e,0xcd,0x05, //     30 T1 ON, NOTE  77 VOLUME  5
-                0x9e,0xcc,0x05, //     30 T1 ON, NOTE  76 VOLUME  5
-                0x80,0x34,0x05, //      0 T2 ON, NOTE  52 VOLUME  5
-                0xbc,0xca,0x05, //     60 T1 ON, NOTE  74 VOLUME  5
-                0x80,0x35,0x05, //      0 T2 ON, NOTE  53 VOLUME  5
-                0xbc,0xc8,0x05, //     60 T1 ON, NOTE  72 VOLUME  5
-                0x80,0x32,0x05, //      0 T2 ON, NOTE  50 VOLUME  5
-                0xbc,0x34,0x05, //     60 T2 ON, NOTE  52 VOLUME  5
-                0xbc,0xc6,0x05, //     60 T1 ON, NOTE  70 VOLUME  5
-                0xbc,0xc5,0x05, //     60 T1 ON, NOTE  69 VOLUME  5
-                0x80,0x30,0x05, //      0 T2 ON, NOTE  48 VOLUME  5
-                0xbc,0xc3,0x05, //     60 T1 ON, NOTE  67 VOLUME  5
-                0xbc,0xc1,0x05, //     60 T1 ON, NOTE  65 VOLUME  5
-                0x80,0x32,0x05, //      0 T2 ON, NOTE  50 VOLUME  5
-                0xbc,0xc5,0x05, //     60 T1 ON, NOTE  69 VOLUME  5
-                0xbc,0xc3,0x05, //     60 T1 ON, NOTE  67 VOLUME  5
-                0x80,0x34,0x05, //      0 T2 ON, NOTE  52 VOLUME  5
-                0xbc,0xc6,0x05, //     60 T1 ON, NOTE  70 VOLUME  5
-                0xbc,0xc5,0x05, //     60 T1 ON, NOTE  69 VOLUME  5
-                0x80,0x35,0x05, //      0 T2 ON, NOTE  53 VOLUME  5
-                0xbc,0xc7,0x05, //     60 T1 ON, NOTE  71 VOLUME  5
-                0x80,0x32,0x05, //      0 T2 ON, NOTE  50 VOLUME  5
-                0xbc,0xc8,0x05, //     60 T1 ON, NOTE  72 VOLUME  5
-                0x80,0x34,0x05, //      0 T2 ON, NOTE  52 VOLUME  5
-                0xbc,0xc0,0x05, //     60 T1 ON, NOTE  64 VOLUME  5
-                0x80,0x35,0x05, //      0 T2 ON, NOTE  53 VOLUME  5
-                0xbc,0xbe,0x05, //     60 T1 ON, NOTE  62 VOLUME  5
-                0x80,0x37,0x05, //      0 T2 ON, NOTE  55 VOLUME  5
-                0xbc,0xc8,0x05, //     60 T1 ON, NOTE  72 VOLUME  5
-                0xbc,0xc1,0x05, //     60 T1 ON, NOTE  65 VOLUME  5
-                0x80,0x2b,0x05, //      0 T2 ON, NOTE  43 VOLUME  5
-                0xbc,0xc7,0x05, //     60 T1 ON, NOTE  71 VOLUME  5
-                0xbc,0xc8,0x05, //     60 T1 ON, NOTE  72 VOLUME  5
-                0x80,0x43,0x05, //      0 T2 ON, NOTE  67 VOLUME  5
-                0x07,0xc0,0x01, //    960 BOTH OFF
-                     0x80,0x05  //      0 END PROGRAM
+0x00,0x00,0x01,0x01,0x01,0x0a,0x09,0x06,0x0a,0x05,0x0e,0x00,0x00,0x00,0x00,0x00, // HUFFMAN TABLE (57 symbols)
+0x15,0x25,0x05,0x3c,0x3e,0x40,0x43,0x45,0x47,0x48,0x4a,0x4c,0x4d,0x32,0x34,0x37,
+0x39,0x3b,0x41,0x4f,0x51,0x55,0x20,0x30,0x35,0x36,0x42,0x80,0x2b,0x2f,0x3a,0x44,
+0x46,0x49,0x53,0x65,0x75,0x90,0x01,0x2d,0x38,0x54,0xf0,0x00,0x07,0x26,0x2a,0x3d,
+0x3f,0x50,0x8a,0x9e,0xb2,0xbc,0xbf,0xc0,0xca,
+0xfa,0x7e,0x3f,0x5a,0xff,0xff,0xe7,0x7f,0xeb,0xf9,0xfe,0xff,0x3f,0xfb,0xb8,0xe1,
+0xe4,0x0d,0x47,0x90,0x1c,0x45,0xb9,0x94,0x58,0x36,0x24,0xd7,0x4e,0x25,0xc4,0xd6,
+0x05,0x16,0x2d,0xcc,0xaa,0xc8,0x89,0x25,0xe0,0x4c,0xa7,0x22,0x44,0xc8,0x95,0x6c,
+0x8d,0x96,0x6d,0xa1,0x74,0xee,0x2d,0xc5,0xd6,0x66,0xcb,0x46,0xc8,0xb2,0x71,0xb9,
+0xb2,0xd0,0xb9,0x64,0xe3,0x62,0xe9,0xe6,0xe6,0xca,0x05,0xcb,0x2c,0x8a,0x94,0x59,
+0x96,0x2a,0xb4,0x2e,0x59,0x38,0xa9,0x45,0x89,0x32,0x4b,0xa9,0x42,0x6b,0x22,0xa5,
+0x16,0x64,0xc9,0x2d,0x08,0x9d,0x93,0x89,0x11,0x26,0x4b,0xbf,0xbe,0x03,0xd6,0x2d,
+0xd4,0xa2,0xcb,0x89,0xf1,0x45,0x8b,0x75,0x2a,0xb0,0x26,0xb2,0x24,0x45,0x78,0x9d,
+0x88,0x2e,0x64,0x4e,0xcb,0x02,0x44,0x56,0x24,0xc9,0x2e,0xa5,0x09,0xac,0x8a,0x94,
+0x58,0x96,0x2a,0xbc,0x49,0xf1,0x4e,0x2a,0x6c,0xb9,0x93,0x58,0x71,0x4e,0x26,0x49,
+0x7e,0x84,0x7f,0x26,0xf0,0x3e,0xbc,0x8f,0x13,0x99,0xf5,0x3c,0x4f,0x03,0x06,0x89,
+0x25,0x91,0x32,0x8b,0xa9,0x22,0x6b,0x22,0x27,0x65,0x9b,0x60,0x63,0xc8,0xea,0x64,
+0x62,0x75,0x30,0x33,0x69,0x13,0x4f,0x28,0x55,0x38,0x99,0x44,0xf2,0x44,0xd6,0x4d,
+0x13,0x5e,0x44,0x07,0x9a,0x90,0x22,0x6a,0xd5,0x28,0xa0,0x4c,0x92,0xd4,0xa1,0x34,
+0xf2,0xa5,0x14,0x1a,0x44,0x79,0x1a,0x90,0x22,0x6a,0x48,0x8b,0x58,0xaa,0xd4,0xa1,
+0x35,0x12,0xa7,0xaa,0x81,0x62,0xab,0x56,0xf4,0x3d,0x54,0x9a,0x25,0x56,0xad,0x22,
+0xca,0x2d,0xe8,0x5d,0x49,0xa2,0x49,0x6a,0xd0,0x26,0x9e,0xda,0x9e,0xaa,0x0d,0x12,
+0xab,0x56,0x81,0xd9,0x3d,0x9c,0x79,0xad,0x19,0xe4,0x93,0x9a,0x04,0xd3,0xd9,0xc5,
+0x16,0x8d,0x99,0x55,0xf6,0x6d,0x1b,0x36,0x71,0xa7,0x26,0x81,0xd9,0x62,0x79,0x92,
+0x4f,0x93,0xb8,0xec,0x9e,0x79,0x90,0xe4,0x59,0x38,0xaa,0xd0,0xa2,0xcc,0xb2,0xc8,
+0xaa,0xea,0x51,0x66,0x4d,0x7d,0x8a,0xad,0x0a,0x2c,0xcd,0xd3,0x8f,0xe1,0x68,0x7b,
+0x27,0x9b,0xa7,0x16,0x50,0x2e,0x9e,0x55,0x6a,0x79,0xa8,0x17,0x2c,0xb3,0x2a,0x51,
+0x43,0x8a,0xf1,0x42,0x6b,0x12,0x4d,0x99,0xb9,0xb2,0xfa,0x97,0x2d,0xc8,0xd8,0xb9,
+0xb9,0xb3,0x41,0x9e,0xce,0x6d,0x19,0xed,0xfb,0x34,0x19,0xff,0x3f,0x16,0x2e,0x6c,
+0x6e,0x5c,0xd8,0xb1,0x7e,0xfe,0xf9,0xb6,0x8c,0xe6,0x7b,0x68,0xce,0x6c,0xcd,0x39,
+0x36,0xcd,0x76,0xb3,0x55,0xae,0xd6,0x6d,0x9a,0xff,0x3f,0x0f,0x1c,0x68,0x66,0x38,
+0xd0,0x78,0xee,0xfe,0xf5,0x6b,0x35,0xdb,0x66,0xb3,0x5d,0xaa,0xd6,0xf9,0xf8,0xc8,
+0xcc,0xf2,0x1c,0x66,0x79,0x19,0x19,0xf7,0xf7,0xa1,0x55,0xe4,0x58,0xba,0xcc,0xa9,
+0x65,0x91,0x42,0xab,0xa1,0x62,0xe9,0xe6,0xc6,0xe9,0xc5,0xcd,0x97,0x91,0x62,0xeb,
+0x33,0x63,0x75,0xa9,0xec,0x7d,0xd4,0x0d,0xcf,0x64,0xf3,0x63,0xee,0xa0,0xd8,0x1b,
+0x2c,0x5b,0xa1,0x65,0x97,0x17,0xe2,0xcb,0x12,0xab,0xa1,0x45,0x83,0x62,0x7a,0x12,
+0x5c,0xc8,0x9a,0xac,0x09,0x11,0x58,0x9e,0x84,0x97,0x42,0x6b,0x02,0x8b,0x12,0x0b,
+0xa0,0xf5,0x91,0x43,0x55,0xe0,0x4c,0xa2,0x8f,0xfb,0xf4,0xfd,0xd8
 };
@@ -0,0 +1,70 @@
+#include "EventQueue.h"
+#include "StateMachine.h"
+#include "LEDRing.h"
+#include "FaultLog.h"
+#include "LoopMonitor.h"
+
+NotifyQueue<8> ocd_notifications;
+NotifyQueue<4> pulse_train_notifications;
+NotifyQueue<8> player_notifications;
+NotifyQueue<4> state_notifications;
+
+unsigned long ocd_count = 0;
+unsigned long pulse_train_underruns = 0;
+unsigned long player_notifications_dropped = 0;
+
+namespace {
+  void on_state_change(uint16_t arg) {
+    #ifdef SERIAL_LOGGING
+      log_state_change(arg >> 8, arg & 0xff);
+      // With the state machine's own lines for the change, this can outrun
+      // the serial TX buffer and wait for the UART
+      loop_monitor_restart();
+    #endif
+    led_on_state_change(arg & 0xff);
+    fault_log_record(LOG_STATE, arg & 0xff);
+  }
+
+  void on_beat(uint16_t beat_num) {
+    if (!beat_num) {
+      // Song (re)started: fresh background with the red indicator at 0,
+      // ending the previous song's cues
+      led_metronome_restart();
+      return;
+    }
+    #ifdef SERIAL_LOGGING
+      // Serial message bar:beat for the beat just completed
+      Serial.print(((beat_num - 1) >> 2) + 1);
+      Serial.print(":");
+      Serial.println(((beat_num - 1) & 0x03) + 1);
+    #endif
+    led_metronome_beat(beat_num);
+  }
+}
+
+void dispatch_notifications() {
+  Notification note;
+
+  uint8_t ocd_trips = ocd_notifications.take_dropped();
+  while (ocd_notifications.pop(note)) ocd_trips++;
+  ocd_count += ocd_trips;
+  fault_log_ocd(ocd_trips);
+
+  while (pulse_train_notifications.pop(note)) pulse_train_underruns++;
+  pulse_train_underruns += pulse_train_notifications.take_dropped();
+
+  // State changes first, so a song start repaints over the new state's LEDs
+  while (state_notifications.pop(note)) on_state_change(note.arg);
+  uint8_t lost_states = state_notifications.take_dropped();
+  if (lost_states) fault_log_record(LOG_STATES_DROPPED, lost_states);
+  player_notifications_dropped += player_notifications.take_dropped();
+  while (player_notifications.pop(note)) {
+    if (note.type == NOTIFY_BEAT) {
+      on_beat(note.arg);
+    } else if (note.type == NOTIFY_LED_CUE) {
+      led_show_cue(note.arg);
+    }
+  }
+
+  fault_log_update();
+}
@@ -0,0 +1,100 @@
+#pragma once
+
+#include <arduino.h>
+
+// Single-producer, single-consumer ring buffer for handing records between
+// an ISR and the main loop without masking interrupts. Each index is a byte
+// written by one side only, so its reads are atomic; the barriers keep the
+// compiler from moving a record's copy across the index that publishes or
+// frees it. SIZE must be a power of two, at most 128.
+#define SPSC_BARRIER() asm volatile("" ::: "memory")
+
+template <typename T, uint8_t SIZE>
+class SpscQueue {
+public:
+  // Only while the other side is stopped
+  void clear() { head = tail = 0; }
+
+  bool empty() const { return head == tail; }
+
+  // Producer side; returns false when the queue is full
+  bool push(const T& item) {
+    uint8_t t = tail;
+    if ((uint8_t)(t - head) == SIZE) return false;
+    SPSC_BARRIER();
+    items[t & MASK] = item;
+    SPSC_BARRIER();
+    tail = t + 1;
+    return true;
+  }
+
+  // Consumer side; returns false when the queue is empty
+  bool pop(T& item) {
+    uint8_t h = head;
+    if (h == tail) return false;
+    SPSC_BARRIER();
+    item = items[h & MASK];
+    SPSC_BARRIER();
+    head = h + 1;
+    return true;
+  }
+
+private:
+  static const uint8_t MASK = SIZE - 1;
+  T items[SIZE];
+  // Free-running, so all SIZE entries are usable
+  volatile uint8_t head = 0; // next entry the consumer reads
+  volatile uint8_t tail = 0; // next entry the producer writes
+};
+
+// Notifications from ISRs and the playback path, drained by the main loop
+// so that slow consumers (NeoPixel show(), Serial) never run inside them
+#define NOTIFY_OCD       1 // over-current detector tripped
+#define NOTIFY_UNDERRUN  2 // pulse train ISR found no queued period
+#define NOTIFY_BEAT      3 // metronome beat; arg = beat number (0 = restart)
+#define NOTIFY_STATE     4 // state change; arg = old state << 8 | new state
+#define NOTIFY_LED_CUE   5 // song LED cue in led_cue_frame; arg = cue kind (LEDRing.h)
+
+struct Notification {
+  uint8_t type;
+  uint16_t arg;
+};
+
+// One queue per producer. A full queue drops the notification and counts
+// it, so counters kept by the consumer stay exact; dispatch_notifications()
+// takes every queue's count (lost state changes go to the fault log).
+template <uint8_t SIZE>
+class NotifyQueue : public SpscQueue<Notification, SIZE> {
+public:
+  // Producer side
+  void post(uint8_t type, uint16_t arg = 0) {
+    Notification note = {type, arg};
+    if (!this->push(note)) dropped++;
+  }
+
+  // Consumer side: notifications dropped since the last call
+  uint8_t take_dropped() {
+    uint8_t count = dropped;
+    uint8_t new_drops = count - dropped_seen;
+    dropped_seen = count;
+    return new_drops;
+  }
+
+private:
+  volatile uint8_t dropped = 0;
+  uint8_t dropped_seen = 0;
+};
+
+extern NotifyQueue<8> ocd_notifications;         // OCD pin interrupt
+extern NotifyQueue<4> pulse_train_notifications; // Timer1 ISR in pulse-train mode
+extern NotifyQueue<8> player_notifications;      // song playback
+extern NotifyQueue<4> state_notifications;       // state machine
+
+// Totals kept by the consumer; read them from the main loop only
+extern unsigned long ocd_count;
+extern unsigned long pulse_train_underruns;
+extern unsigned long player_notifications_dropped; // beats and LED cues lost
+
+// Drains every producer's queue into the LED, logging and fault log
+// consumers; called once per main loop
+void dispatch_notifications();
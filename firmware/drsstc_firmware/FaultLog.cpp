@@ -0,0 +1,162 @@
+#include "FaultLog.h"
+#include "EventQueue.h"
+#include "Timebase.h"
+#include <avr/wdt.h>
+
+#define LOG_RECORD_SIZE   8
+#define LOG_SLOTS         ((E2END + 1) / LOG_RECORD_SIZE)
+#define LOG_SEQ_EMPTY     0xffff // erased EEPROM
+#define LOG_QUEUE_SIZE    8
+#define OCD_BURST_GAP     500    // ms without a trip that ends a burst
+
+namespace {
+  struct LogRecord {
+    uint16_t seq;
+    uint8_t type;
+    uint8_t arg;
+    uint32_t time_ms;
+  };
+  static_assert(sizeof(LogRecord) == LOG_RECORD_SIZE, "EEPROM record layout");
+
+  // Filled by the main loop, written out by the EEPROM-ready ISR
+  SpscQueue<LogRecord, LOG_QUEUE_SIZE> log_queue;
+  uint16_t next_seq = 0;
+  uint8_t dropped_records = 0;
+
+  // ISR state: record being written, next byte of it and its slot address
+  LogRecord writing;
+  uint8_t write_index = LOG_RECORD_SIZE;
+  uint16_t write_addr = 0;
+
+  // OCD burst in progress
+  uint8_t ocd_trips = 0;
+  unsigned long ocd_first_ms = 0;
+  unsigned long ocd_last_ms = 0;
+
+  uint16_t next_in_sequence(uint16_t seq) {
+    seq++;
+    return seq == LOG_SEQ_EMPTY ? 0 : seq;
+  }
+
+  // Safe against the ISR, which moves EEAR between bytes. A write in
+  // progress is waited out with interrupts enabled; once they are masked,
+  // the ISR cannot start another.
+  uint8_t read_eeprom(uint16_t addr) {
+    uint8_t sreg = SREG;
+    while (true) {
+      while (EECR & _BV(EEPE)) {}
+      cli();
+      if (!(EECR & _BV(EEPE))) break;
+      SREG = sreg;
+    }
+    EEAR = addr;
+    EECR |= _BV(EERE);
+    uint8_t value = EEDR;
+    SREG = sreg;
+    return value;
+  }
+
+  uint16_t read_seq(uint16_t slot) {
+    uint16_t addr = slot * LOG_RECORD_SIZE;
+    return read_eeprom(addr) | (read_eeprom(addr + 1) << 8);
+  }
+
+  bool queue_record(uint8_t type, uint8_t arg, uint32_t time_ms) {
+    LogRecord record = {next_seq, type, arg, time_ms};
+    if (!log_queue.push(record)) return false;
+    next_seq = next_in_sequence(next_seq);
+    // Single sbi, so it cannot race the ISR clearing it
+    EECR |= _BV(EERIE);
+    return true;
+  }
+
+  void print_hex(uint8_t value) {
+    if (value < 0x10) Serial.print('0');
+    Serial.print(value, HEX);
+  }
+}
+
+void init_fault_log() {
+  // The newest record is the one its successor does not follow; an erased
+  // EEPROM starts at slot 0
+  uint16_t newest = LOG_SLOTS - 1;
+  next_seq = 0;
+  for (uint16_t slot = 0; slot < LOG_SLOTS; slot++) {
+    uint16_t seq = read_seq(slot);
+    if (seq == LOG_SEQ_EMPTY) continue;
+    uint16_t following = read_seq(slot + 1 < LOG_SLOTS ? slot + 1 : 0);
+    if (following != next_in_sequence(seq)) {
+      newest = slot;
+      next_seq = next_in_sequence(seq);
+      break;
+    }
+  }
+  write_addr = (newest + 1 < LOG_SLOTS ? newest + 1 : 0) * LOG_RECORD_SIZE;
+  write_index = LOG_RECORD_SIZE;
+  fault_log_record(LOG_BOOT, 0);
+}
+
+void fault_log_record(uint8_t type, uint8_t arg) {
+  if (!queue_record(type, arg, timebase_ms()) && dropped_records < 0xff) dropped_records++;
+}
+
+void fault_log_ocd(uint8_t trips) {
+  if (!trips) return;
+  unsigned long timestamp = timebase_ms();
+  if (!ocd_trips) ocd_first_ms = timestamp;
+  ocd_last_ms = timestamp;
+  ocd_trips = (ocd_trips + trips < 0xff) ? ocd_trips + trips : 0xff;
+}
+
+void fault_log_update() {
+  if (ocd_trips && timebase_ms() - ocd_last_ms > OCD_BURST_GAP
+      && queue_record(LOG_OCD, ocd_trips, ocd_first_ms)) {
+    ocd_trips = 0;
+  }
+  if (dropped_records && log_queue.empty()) {
+    uint8_t count = dropped_records;
+    dropped_records = 0;
+    fault_log_record(LOG_DROPPED, count);
+  }
+}
+
+void fault_log_dump() {
+  Serial.print(F("FAULT LOG "));
+  Serial.println(E2END + 1);
+  for (uint16_t addr = 0; addr <= E2END; addr++) {
+    print_hex(read_eeprom(addr));
+    if ((addr & 0x0f) == 0x0f) {
+      Serial.println();
+      // Blocks for seconds, so it feeds the loop watchdog
+      wdt_reset();
+    }
+  }
+  Serial.println(F("END"));
+}
+
+// Writes one byte per interrupt. The interrupt stays pending while the
+// EEPROM is idle, so it is disabled whenever the queue is empty.
+ISR(EE_READY_vect) {
+  if (write_index == LOG_RECORD_SIZE) {
+    if (!log_queue.pop(writing)) {
+      EECR &= ~_BV(EERIE);
+      return;
+    }
+    write_index = 0;
+  }
+  // Payload first, sequence number (bytes 0-1) last
+  uint8_t offset = (write_index + 2) & (LOG_RECORD_SIZE - 1);
+  uint8_t value = ((const uint8_t*)&writing)[offset];
+  EEAR = write_addr + offset;
+  EECR |= _BV(EERE);
+  if (EEDR != value) {
+    EEDR = value;
+    // EEMPE arms EEPE for 4 cycles; interrupts are already masked
+    EECR |= _BV(EEMPE);
+    EECR |= _BV(EEPE);
+  }
+  if (++write_index == LOG_RECORD_SIZE) {
+    write_addr += LOG_RECORD_SIZE;
+    if (write_addr >= LOG_SLOTS * LOG_RECORD_SIZE) write_addr = 0;
+  }
+}
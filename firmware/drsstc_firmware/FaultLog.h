@@ -0,0 +1,42 @@
+#pragma once
+
+#include <arduino.h>
+
+// Persistent fault and state log, a ring of 8-byte records over the whole
+// EEPROM (128 records on the ATmega328, 512 on the ATmega2560). Records are
+// queued in RAM and written one byte per EEPROM-ready interrupt, so the
+// ~3.4 ms per-byte write never blocks the loop.
+//
+// Wear leveling: the ring is written in order, so every cell is written once
+// per lap (100k erase cycles = 12.8M records on the 328), and bytes that
+// already hold the right value are skipped.
+//
+// Each record carries a 16-bit sequence number; the boot scan resumes after
+// the last record whose successor breaks the sequence. The sequence bytes
+// are written last, so a record torn by a power-off is found as the oldest
+// one, not the newest. Timestamps are ms since that boot's LOG_BOOT record.
+#define LOG_BOOT     1 // power-up or reset
+#define LOG_STATE    2 // arg = new state
+#define LOG_TIMEOUT  3 // arg = state that timed out
+#define LOG_OCD      4 // OCD burst; arg = trips (saturating), time = first trip
+#define LOG_DROPPED  5 // arg = records lost to a full RAM queue
+#define LOG_OVERRUN  6 // new worst loop; arg = phase << 5 | 8 ms steps (LoopMonitor.h)
+#define LOG_WATCHDOG 7 // logged at the boot after; arg = phase that stalled
+#define LOG_THERMAL  8 // song cut at the thermal limit; arg = song index (ThermalModel.h)
+#define LOG_STATES_DROPPED 9 // arg = state changes lost to a full notification queue
+
+// Finds the end of the ring and logs LOG_BOOT; call once in setup()
+void init_fault_log();
+
+// Queues a record stamped with the current time; returns immediately
+void fault_log_record(uint8_t type, uint8_t arg);
+
+// OCD trips are merged into one LOG_OCD record per burst
+void fault_log_ocd(uint8_t trips);
+
+// Closes OCD bursts and reports dropped records; call from the main loop
+void fault_log_update();
+
+// Prints the raw EEPROM as hex for the host decoder (fault_log_decoder.py);
+// blocks for about 3 s at 9600 baud
+void fault_log_dump();
@@ -3,6 +3,7 @@
 #include "pin_definitions.h"
 #include "LEDRing.h"
 #include "StateMachine.h"
+#include "Timebase.h"
 
 #define DEFAULT_BRIGHTNESS 50
 
@@ -21,6 +22,38 @@ void reset_led_strip() {
 }
 
 
+namespace {
+  // RGB, before the strip's brightness scaling
+  const uint8_t LED_PALETTE[16][3] PROGMEM = {
+    {0, 0, 0},
+    {255, 0, 0}, {255, 128, 0}, {255, 255, 0}, {128, 255, 0},
+    {0, 255, 0}, {0, 255, 128}, {0, 255, 255}, {0, 128, 255},
+    {0, 0, 255}, {128, 0, 255}, {255, 0, 255}, {255, 0, 128},
+    {255, 255, 255}, {32, 32, 32}, {255, 160, 64}};
+
+  bool cue_shown = false;
+
+  void paint_cue_frame() {
+    for (unsigned int pixel = 0; pixel < NUM_LEDS; pixel++) {
+      const uint8_t* color = LED_PALETTE[led_cue_frame[pixel]];
+      led_strip.setPixelColor(pixel, pgm_read_byte(color), pgm_read_byte(color + 1), pgm_read_byte(color + 2));
+    }
+    led_strip.show();
+  }
+}
+
+uint8_t led_cue_frame[NUM_LEDS];
+
+void led_show_cue(uint8_t kind) {
+  if (kind == LED_CUE_METRONOME) {
+    cue_shown = false;
+    init_led_metronome();
+  } else {
+    cue_shown = true;
+    paint_cue_frame();
+  }
+}
+
 void metronome_background(unsigned int pixel) {
   unsigned int seq = (pixel + NUM_LEDS - METRONOME_OFFSET) & NUM_LED_MASK;
   if (seq & 0x03 == 0) {
@@ -43,6 +76,7 @@ void init_led_metronome() {
 }
 
 void led_metronome_beat(unsigned int beat_num) {
+  if (cue_shown) return;
   const unsigned int on_pixel = (beat_num + METRONOME_OFFSET) & NUM_LED_MASK;
   const unsigned int off_pixel = (on_pixel + NUM_LEDS - 1) & NUM_LED_MASK;
 
@@ -54,6 +88,14 @@ void led_metronome_beat(unsigned int beat_num) {
   led_strip.show();
 }
 
+void led_metronome_restart() {
+  cue_shown = false;
+  for (unsigned int pixel = 0; pixel < NUM_LEDS; pixel++) {
+    metronome_background(pixel);
+  }
+  led_metronome_beat(0);
+}
+
 namespace {
   #define LED_ANIMATION_FRAMESTEP 20
   #define LED_CYCLE_LENGTH 5000
@@ -73,16 +115,15 @@ namespace {
 }
 
 void init_led_strip_cycle() {
-  led_animation_mark = millis();
+  led_animation_mark = timebase_ms();
   led_animation_index = 0;
   paint_led_strip_cycle();
 }
 
 void led_strip_cycle() {
-  unsigned long timestamp = millis();
-  if (led_animation_mark == 0 || led_animation_mark > timestamp) led_animation_mark = timestamp;
-  if (led_animation_mark + LED_ANIMATION_FRAMESTEP > timestamp) return;
-  led_animation_index += ((led_animation_mark - timestamp) * MAX_HUE) / LED_CYCLE_LENGTH;
+  unsigned long timestamp = timebase_ms();
+  if (timestamp - led_animation_mark < LED_ANIMATION_FRAMESTEP) return;
+  led_animation_index += ((timestamp - led_animation_mark) * MAX_HUE) / LED_CYCLE_LENGTH;
   led_animation_mark = timestamp;
   paint_led_strip_cycle();
 }
@@ -100,15 +141,14 @@ void led_strip_solid(uint16_t hue) {
 void init_led_strip_flash(uint16_t hue, unsigned long period) {
   led_flash_hue = hue;
   led_flash_period = period;
-  led_animation_mark = millis();
+  led_animation_mark = timebase_ms();
   led_animation_index = 0;
   reset_led_strip();
 }
 
 void led_strip_flash() {
-  unsigned long timestamp = millis();
-  if (led_animation_mark == 0 || led_animation_mark > timestamp) led_animation_mark = timestamp;  
-  if (led_animation_mark + led_flash_period > timestamp) return;
+  unsigned long timestamp = timebase_ms();
+  if (timestamp - led_animation_mark < led_flash_period) return;
   led_animation_mark += led_flash_period;
   led_animation_index = 1 - led_animation_index;
   if (led_animation_index) {
@@ -122,6 +162,8 @@ void led_strip_flash() {
 void led_on_state_change(int new_state) {
   const uint16_t ORANGE = 5000;
   const uint16_t GREEN = 21000;
+  // Cues last until the song ends; a pause keeps them
+  if (new_state != MUSIC_PLAY && new_state != MUSIC_PAUSE) cue_shown = false;
   switch (new_state) {
     case STARTUP:
     case MUSIC_INT:
@@ -132,7 +174,11 @@ void led_on_state_change(int new_state) {
       break;
     case MUSIC_PLAY:
     case MUSIC_PAUSE:
-      init_led_metronome();
+      if (cue_shown) {
+        paint_cue_frame();
+      } else {
+        init_led_metronome();
+      }
       break;
     case LIGHT_SHOW:
       init_led_strip_cycle();
@@ -26,6 +26,38 @@ void init_led_metronome();
 
 void led_metronome_beat(unsigned int beat_num);
 
+// Song (re)started: the background with the beat at 0, ending any cue, in
+// one frame
+void led_metronome_restart();
+
 void led_on_state_change(int new_state);
 
+// LED cues: ring frames pre-rendered by the converter (--led_cues) and
+// carried in the song after OPCODE_LED_CUE. The player decodes each cue
+// into led_cue_frame, one palette index per pixel, and posts
+// NOTIFY_LED_CUE; the main loop paints the frame from the fixed palette,
+// with no per-frame computation. Cues decoded between two loops merge, the
+// later one winning. Once a cue is shown, beats no longer repaint the ring
+// until LED_CUE_METRONOME or the next song.
+//
+// A cue is one byte, KKKAAAAA: the kind below and its argument.
+#define LED_CUE_FILL      0x00 // every pixel from palette index A
+#define LED_CUE_RUNS      0x20 // A + 1 run bytes follow, LLLLPPPP: length - 1, palette index
+#define LED_CUE_ROTATE    0x40 // frame turned A pixels towards higher pixels
+#define LED_CUE_METRONOME 0x60 // ring back to the beat display
+#define LED_CUE_KIND_MASK 0xe0
+#define LED_CUE_ARG_MASK  0x1f
+#define LED_RUN_SHIFT     4
+#define LED_PALETTE_MASK  0x0f
+
+// Palette: off, the 12 pitch classes from C around the hue circle, then
+// white, dim white and warm white
+#define LED_PALETTE_OFF   0
+#define LED_PALETTE_PITCH 1
+
+extern uint8_t led_cue_frame[NUM_LEDS];
+
+// Shows the cue frame, or the beat display for LED_CUE_METRONOME
+void led_show_cue(uint8_t kind);
+
 void led_update();
@@ -0,0 +1,136 @@
+#include "LoopMonitor.h"
+
+#ifdef LOOP_MONITOR
+
+#include <avr/wdt.h>
+#include "StateMachine.h" // SERIAL_LOGGING flag
+#include "Timebase.h"
+#include "VoiceBackend.h"
+#include "FaultLog.h"
+
+// LOG_OVERRUN arg: phase in the top 3 bits, loop time in 8 ms steps below
+#define OVERRUN_PHASE_SHIFT 5
+#define OVERRUN_MS_SHIFT    3
+#define OVERRUN_MAX_STEPS   0x1f
+
+// Set by the watchdog ISR for the next boot
+#define WATCHDOG_MARKER 0xa55a
+
+namespace {
+  // .noinit is left alone by the startup code, so these survive the reset
+  volatile uint16_t watchdog_marker __attribute__((section(".noinit")));
+  uint8_t watchdog_phase __attribute__((section(".noinit")));
+  bool watchdog_reset = false;
+
+  volatile uint8_t current_phase = LOOP_PHASE_COMMS; // read by the ISR
+  bool loop_running = false;
+  unsigned long loop_start_us = 0;
+  unsigned long phase_start_us = 0;
+  unsigned long longest_phase_us = 0;
+  uint8_t longest_phase = LOOP_PHASE_COMMS;
+
+  unsigned long overruns = 0;
+  unsigned long worst_loop_us = 0;
+  uint8_t worst_loop_phase = LOOP_PHASE_COMMS;
+
+  #ifdef SERIAL_LOGGING
+    const char PHASE_NAMES[LOOP_NUM_PHASES][7] PROGMEM =
+      {"comms", "state", "notify", "leds", "output", "report"};
+  #endif
+
+  // WDCE opens a 4-cycle window for changing WDE and the prescaler
+  void set_watchdog(uint8_t control) {
+    uint8_t sreg = SREG;
+    cli();
+    wdt_reset();
+    WDTCSR = _BV(WDCE) | _BV(WDE);
+    WDTCSR = control;
+    SREG = sreg;
+  }
+
+  void end_phase(unsigned long timestamp) {
+    unsigned long elapsed = timestamp - phase_start_us;
+    if (elapsed >= longest_phase_us) {
+      longest_phase_us = elapsed;
+      longest_phase = current_phase;
+    }
+    phase_start_us = timestamp;
+  }
+
+  void end_loop(unsigned long timestamp) {
+    unsigned long elapsed = timestamp - loop_start_us;
+    if (elapsed <= LOOP_DEADLINE_US) return;
+    overruns++;
+    if (elapsed <= worst_loop_us) return;
+    worst_loop_us = elapsed;
+    worst_loop_phase = longest_phase;
+    unsigned long steps = (elapsed / 1000) >> OVERRUN_MS_SHIFT;
+    fault_log_record(LOG_OVERRUN, (longest_phase << OVERRUN_PHASE_SHIFT)
+                     | (steps < OVERRUN_MAX_STEPS ? steps : OVERRUN_MAX_STEPS));
+  }
+}
+
+void init_loop_monitor() {
+  // WDRF forces WDE on, so it must be cleared before the watchdog can be stopped
+  MCUSR &= ~_BV(WDRF);
+  set_watchdog(0);
+  watchdog_reset = (watchdog_marker == WATCHDOG_MARKER);
+  watchdog_marker = 0;
+}
+
+void start_loop_monitor() {
+  if (watchdog_reset) fault_log_record(LOG_WATCHDOG, watchdog_phase);
+  // Prescaler bits WDP3 and WDP2..0, as wdt_enable() sets them
+  uint8_t prescale = (LOOP_WATCHDOG_TIMEOUT & 0x08 ? _BV(WDP3) : 0) | (LOOP_WATCHDOG_TIMEOUT & 0x07);
+  set_watchdog(_BV(WDIE) | _BV(WDE) | prescale);
+  loop_running = false;
+}
+
+void loop_monitor_begin() {
+  // The loop came back after the watchdog silenced the voices; let the reset finish
+  if (watchdog_marker == WATCHDOG_MARKER) while (true) {}
+  unsigned long timestamp = timebase_us();
+  wdt_reset();
+  if (loop_running) {
+    end_phase(timestamp);
+    end_loop(timestamp);
+  }
+  loop_running = true;
+  loop_start_us = timestamp;
+  phase_start_us = timestamp;
+  longest_phase_us = 0;
+  current_phase = LOOP_PHASE_COMMS;
+}
+
+void loop_phase(uint8_t phase) {
+  end_phase(timebase_us());
+  current_phase = phase;
+}
+
+void loop_monitor_restart() {
+  unsigned long timestamp = timebase_us();
+  loop_start_us = timestamp;
+  phase_start_us = timestamp;
+  longest_phase_us = 0;
+}
+
+void loop_monitor_report() {
+  #ifdef SERIAL_LOGGING
+    Serial.print(F("Loop: "));
+    Serial.print(overruns);
+    Serial.print(F(" overruns, worst "));
+    Serial.print(worst_loop_us);
+    Serial.print(F(" us in "));
+    Serial.println((const __FlashStringHelper*)PHASE_NAMES[worst_loop_phase]);
+  #endif
+}
+
+// First timeout: the loop has stalled, so the gates are silenced here. The
+// hardware clears WDIE on entry, so the next timeout resets the board.
+ISR(WDT_vect) {
+  voice_kill_all();
+  watchdog_phase = current_phase;
+  watchdog_marker = WATCHDOG_MARKER;
+}
+
+#endif
@@ -0,0 +1,56 @@
+#pragma once
+
+#include <arduino.h>
+
+// Loop deadline monitor. loop() marks the start of each of its phases; a
+// loop longer than LOOP_DEADLINE_US is an overrun, counted and blamed on its
+// longest phase. Each new worst overrun is written to the fault log as
+// LOG_OVERRUN, so a production run leaves its worst-case loop time behind.
+//
+// Behind it, the watchdog runs in interrupt-and-reset mode. It is fed once
+// per loop and by deliberate waits (timebase_delay_ms(), the fault log
+// dump). When the loop stalls for LOOP_WATCHDOG_TIMEOUT (a Wire hang on the
+// DAC bus, say), the watchdog ISR stops every voice timer with its gate low;
+// one more timeout later the watchdog resets the board, and the next boot
+// logs LOG_WATCHDOG with the phase that stalled. A stall with interrupts
+// masked holds off both stages.
+//
+// Old Nano bootloaders do not disable the watchdog after a watchdog reset
+// and loop in the bootloader; those boards need Optiboot for this monitor.
+#define LOOP_MONITOR
+#define LOOP_DEADLINE_US      2000       // one song event per ms, with room for an LED frame
+#define LOOP_WATCHDOG_TIMEOUT WDTO_250MS // from avr/wdt.h
+
+// Phases of loop(), in order
+#define LOOP_PHASE_COMMS   0  // sync link or serial commands
+#define LOOP_PHASE_STATE   1  // state machine
+#define LOOP_PHASE_NOTIFY  2  // notification dispatch and fault log
+#define LOOP_PHASE_LEDS    3  // LED ring
+#define LOOP_PHASE_OUTPUT  4  // slow pulse, song playback or test mode
+#define LOOP_PHASE_REPORT  5  // serial heartbeat
+#define LOOP_NUM_PHASES    6
+
+#ifdef LOOP_MONITOR
+// First thing in setup(): a watchdog reset leaves the watchdog running
+void init_loop_monitor();
+// Last thing in setup(), after init_fault_log(): arms the watchdog
+void start_loop_monitor();
+
+// Ends the previous loop and starts LOOP_PHASE_COMMS; call first in loop()
+void loop_monitor_begin();
+void loop_phase(uint8_t phase);
+// Restarts the current loop's deadline, after a wait that is not the loop's
+// own work: a deliberate wait, or a logging build's serial lines waiting for
+// the UART
+void loop_monitor_restart();
+
+// Overrun count and worst loop, for the serial heartbeat
+void loop_monitor_report();
+#else
+inline void init_loop_monitor() {}
+inline void start_loop_monitor() {}
+inline void loop_monitor_begin() {}
+inline void loop_phase(uint8_t phase) {}
+inline void loop_monitor_restart() {}
+inline void loop_monitor_report() {}
+#endif
@@ -1,81 +1,193 @@
 #include "StateMachine.h" // SERIAL_LOGGING flag
 #include "MIDIPlayer.h"
 #include "pin_definitions.h"
+#include "EventQueue.h"
+#include "Timebase.h"
+#include "VoiceBackend.h"
+#include "VoiceRouter.h"
+#include "PulseTrain.h"
+#include "SmfPlayer.h"
+#include "ThermalModel.h"
 #include "LEDRing.h"
 
 int midi_instruction_count = 0;
 
 namespace {
-  const uint16_t PRESCALE1_VALUES[] = {1, 8, 64, 256, 1024};
-  const uint16_t PRESCALE2_VALUES[] = {1, 8, 32, 64, 128, 256, 1024};
-
-  #define TIMER1_MIDI_OFFSET 21
-  // Lookup table in Flash memory for 107 MIDI notes
-  const uint16_t timer1_frequencies[] PROGMEM = 
-    {9090,8580,64792,                                                            // octave 0
-     61155,57723,54483,51425,48539,45814,43243,40816,38525,36363,34322,32395,
-     30577,28861,27241,25712,24269,22907,21621,20407,19262,18181,17160,16197,
-     15288,14430,13620,12855,12134,11453,10810,10203,9630,9090,8580,64792,
-     61155,57723,54483,51425,48539,45814,43243,40816,38525,36363,34322,32395,
-     30577,28861,27241,25712,24269,22907,21621,20407,19262,18181,17160,16197,
-     15288,14430,13620,12855,12134,11453,10810,10203,9630,9090,8580,8098,
-     7644,7214,6809,6427,6066,5726,5404,5101,4815,4544,4289,4049,
-     3821,3607,3404,3213,3033,2862,2702,2550,2407,2272,2144,2024,
-     1910,1803,1702,1606,1516,1431,1350,1275};                                   // octave 9
-     
-  uint8_t timer1_prescale_cs_bits(uint8_t midi_note) {
-    if (midi_note <= 22) {
-      return 3;
-    } else if (midi_note <= 58) {
-      return 2;
-    } else {
-      return 1;
+  // Song bytes are read as a stream, either directly from flash or through a
+  // canonical Huffman decoder. A Huffman coded song starts with HUFFMAN_MARKER,
+  // followed by the number of codes of each length, the symbols in code order,
+  // and the MSB-first bit stream.
+  #define HUFFMAN_MARKER   0x00
+  #define HUFFMAN_MAX_BITS 15
+
+  const byte* song_pointer = nullptr;
+  const byte* huffman_table = nullptr;  // nullptr for uncoded songs
+  byte huffman_buffer = 0;
+  uint8_t huffman_bits_left = 0;
+
+  byte read_huffman_byte() {
+    uint16_t code = 0;
+    uint16_t first = 0;
+    uint16_t index = 0;
+    for (uint8_t length = 0; length < HUFFMAN_MAX_BITS; length++) {
+      if (!huffman_bits_left) {
+        huffman_buffer = pgm_read_byte(song_pointer++);
+        huffman_bits_left = 8;
+      }
+      code |= huffman_buffer >> 7;
+      huffman_buffer <<= 1;
+      huffman_bits_left--;
+
+      uint8_t count = pgm_read_byte(huffman_table + length);
+      if (code - first < count)
+        return pgm_read_byte(huffman_table + HUFFMAN_MAX_BITS + index + (code - first));
+      index += count;
+      first = (first + count) << 1;
+      code <<= 1;
     }
+    return 0;
   }
 
-  #define TIMER2_MIDI_OFFSET 35
-  const uint8_t timer2_frequencies[] PROGMEM = 
-    {252,                                               // octave 1
-     238,224,212,200,189,178,168,158,149,141,133,126,
-     118,112,105,99,94,88,83,79,74,70,66,252,
-     238,224,212,200,189,178,168,158,149,141,133,252,
-     238,224,212,200,189,178,168,158,149,141,133,252,
-     238,224,212,200,189,178,168,158,149,141,133,252,
-     238,224,212,200,189,178,168,158,149,141,133,126,
-     118,112,105,99,94,88,83,79,74,70,66,252,
-     238,224,212,200,189,178,168,158};                 // octave 9
-
-  uint8_t timer2_prescale_cs_bits(uint8_t midi_note) {
-    if (midi_note <= 58) {
-      return 7;
-    } else if (midi_note <= 70) {
-      return 6;
-    } else if (midi_note <= 82) {
-      return 5;
-    } else if (midi_note <= 94) {
-      return 4;
-    } else if (midi_note <= 118) {
-      return 3;
-    } else {
-      return 2;
-    }
+  inline byte read_song_byte() {
+    if (!huffman_table) return pgm_read_byte(song_pointer++);
+    return read_huffman_byte();
   }
 
-  const byte* read_varint(const byte* pointer, unsigned long& value) {
-    if (!pointer) return nullptr;
-    byte byte_value = *(pointer++);
+  // Varint whose first byte has already been read
+  void read_varint(unsigned long& value, byte byte_value) {
     value = byte_value & 0x7f;
     while (!(byte_value & 0x80)) {
-      byte_value = *(pointer++);
+      byte_value = read_song_byte();
       value = (value << 7) + (unsigned long)(byte_value & 0x7f);
     }
-    return pointer;
   }
 
-  unsigned long peek_varint(const byte* pointer) {
-    unsigned long value = 0;
-    read_varint(pointer, value);
-    return value;
+  void read_varint(unsigned long& value) {
+    read_varint(value, read_song_byte());
+  }
+
+  // A pre-rendered song starts with PULSE_TRAIN_MARKER (never the first byte
+  // of the ticks/beat varint), then one record per Timer1 period:
+  //   varint (period << 1 | new width) - ticks until the next record
+  //   width byte                       - pulse ticks, when new width is set
+  // A zero varint ends the song.
+  #define PULSE_TRAIN_MARKER 0x80
+  // Rests longer than one timer period are split into periods of this length
+  #define PULSE_TRAIN_SPLIT  0x8000
+
+  bool pulse_train_song = false;
+  unsigned long pulse_period = 0; // ticks of the current record not yet queued
+  uint8_t pulse_width = 0;        // from the last record that set one
+  bool pulse_queued = false;      // the current record's pulse is queued
+
+  void stop_pulse_train() {
+    if (!pulse_train_song) return;
+    pulse_train_stop();
+    pulse_train_song = false;
+  }
+
+  // Decodes records until the ISR's queue is full
+  void fill_pulse_train() {
+    while (true) {
+      if (!pulse_period) {
+        unsigned long record;
+        read_varint(record);
+        if (!record) {
+          pulse_train_end();
+          song_pointer = nullptr;
+          return;
+        }
+        if (record & 1) pulse_width = read_song_byte();
+        pulse_period = record >> 1;
+        pulse_queued = false;
+        midi_instruction_count++;
+      }
+      uint16_t period_top;
+      if (pulse_period > PULSE_TRAIN_MAX_PERIOD) {
+        period_top = PULSE_TRAIN_SPLIT - 1;
+      } else {
+        period_top = pulse_period - 1;
+      }
+      // Only the first period of a split record carries the pulse
+      uint8_t width = pulse_queued ? 0 : thermal_throttle(pulse_width);
+      if (!pulse_train_push(period_top, width)) return;
+      thermal_add_pulse(width);
+      pulse_queued = true;
+      pulse_period -= (unsigned long)period_top + 1;
+    }
+  }
+
+  void open_song(const byte* midi_pointer) {
+    huffman_table = nullptr;
+    huffman_bits_left = 0;
+    if (pgm_read_byte(midi_pointer) == HUFFMAN_MARKER) {
+      huffman_table = midi_pointer + 1;
+      uint16_t num_symbols = 0;
+      for (uint8_t length = 0; length < HUFFMAN_MAX_BITS; length++)
+        num_symbols += pgm_read_byte(huffman_table + length);
+      midi_pointer = huffman_table + HUFFMAN_MAX_BITS + num_symbols;
+    }
+    song_pointer = midi_pointer;
+  }
+
+  // Song events start with a single byte DDDTVVVV:
+  //   DDD  = index into the song's delta table, or DELTA_ESCAPE if a varint delta follows
+  //   T    = 1 for song voice 0, 0 for song voice 1; higher voices use the extended voice opcodes
+  //   VVVV = note volume (note byte follows), VOLUME_NOTE_OFF, or VOLUME_EXTENDED (opcode byte follows)
+  #define DELTA_TABLE_SIZE  7
+  #define DELTA_ESCAPE      7
+  #define DELTA_CODE_SHIFT  5
+  #define EVENT_VOICE0      0x10
+  #define EVENT_VOLUME_MASK 0x0f
+  #define VOLUME_NOTE_OFF   0x00
+  #define VOLUME_EXTENDED   0x0f
+
+  // Extended opcodes
+  #define OPCODE_BOTH_OFF   0x01
+  #define OPCODE_SET_TEMPO  0x02
+  #define OPCODE_VOICE_ON   0x03 // voice, note, volume bytes follow
+  #define OPCODE_VOICE_OFF  0x04 // voice byte follows
+  #define OPCODE_END        0x05
+  #define OPCODE_LED_CUE    0x06 // cue byte and its runs follow (LEDRing.h)
+
+  // Most common deltas of the current song, read from the song header
+  uint16_t delta_table[DELTA_TABLE_SIZE];
+
+  // Event byte and delta of the next event, read ahead of playback
+  byte next_event = 0;
+  unsigned long next_ticks = 0;
+
+  void read_event_header() {
+    next_event = read_song_byte();
+    byte delta_code = next_event >> DELTA_CODE_SHIFT;
+    if (delta_code == DELTA_ESCAPE) {
+      read_varint(next_ticks);
+    } else {
+      next_ticks = delta_table[delta_code];
+    }
+  }
+
+  // Renders the cue into led_cue_frame; the main loop shows it
+  void read_led_cue() {
+    byte cue = read_song_byte();
+    byte arg = cue & LED_CUE_ARG_MASK;
+    byte kind = cue & LED_CUE_KIND_MASK;
+    if (kind == LED_CUE_FILL) {
+      memset(led_cue_frame, arg & LED_PALETTE_MASK, NUM_LEDS);
+    } else if (kind == LED_CUE_RUNS) {
+      uint8_t pixel = 0;
+      for (uint8_t run = 0; run <= arg; run++) {
+        byte run_byte = read_song_byte();
+        uint8_t length = (run_byte >> LED_RUN_SHIFT) + 1;
+        while (length-- && pixel < NUM_LEDS) led_cue_frame[pixel++] = run_byte & LED_PALETTE_MASK;
+      }
+    } else if (kind == LED_CUE_ROTATE) {
+      uint8_t frame[NUM_LEDS];
+      memcpy(frame, led_cue_frame, NUM_LEDS);
+      for (uint8_t pixel = 0; pixel < NUM_LEDS; pixel++)
+        led_cue_frame[(pixel + arg) & NUM_LED_MASK] = frame[pixel];
+    }
+    player_notifications.post(NOTIFY_LED_CUE, kind);
   }
 
   unsigned long current_tempo = 500000;        // us per beat (500000 = 120 bpm)
@@ -91,190 +203,135 @@ namespace {
       metronome_ticks = 0;
       metronome_beat = 0;
 
-      // Initalize LED metronome with red beat indicator in 0 position
-      init_led_metronome();
-      led_metronome_beat(0);
+      // Beat 0 resets the LED metronome, with the red beat indicator at 0
+      player_notifications.post(NOTIFY_BEAT, 0);
     }
   
     void update_metronome(unsigned long timestamp, bool force_mark) {
-      // Catch micros wraparound
-      if (metronome_mark_us == 0 || metronome_mark_us > timestamp)
-        metronome_mark_us = timestamp;
-  
       unsigned long new_ticks = metronome_ticks + ((timestamp - metronome_mark_us) * current_ticks_per_beat) / current_tempo;
       if (force_mark || new_ticks > current_ticks_per_beat) {
         metronome_ticks = new_ticks;
+        metronome_mark_us = timestamp;
         while (metronome_ticks > current_ticks_per_beat) {
           // Rollover
           metronome_ticks -= current_ticks_per_beat;
-          #ifdef SERIAL_LOGGING
-            // Serial message bar:beat
-            Serial.print((metronome_beat >> 2) + 1);
-            Serial.print(":");
-            Serial.println((metronome_beat & 0x03) + 1);
-          #endif
           metronome_beat++;
-          led_metronome_beat(metronome_beat);
+          // Logged and shown on the LEDs from the main loop
+          player_notifications.post(NOTIFY_BEAT, metronome_beat);
         }
       }
     }
   
     void pause_metronome() {
-      update_metronome(micros(), true);
-      metronome_mark_us = 0;
+      update_metronome(timebase_us(), true);
     }
   
     void resume_metronome() {
-      metronome_mark_us = micros();
+      metronome_mark_us = timebase_us();
     }
   #endif
   
-  const byte* play_midi_pointer(const byte* pointer, unsigned long timestamp) {
-    if (!pointer) return nullptr;
-    unsigned long beats = 0;
-    pointer = read_varint(pointer, beats);
-    byte note = *(pointer++);
-    bool timer1 = (note & 0x80);
-    note &= 0x7f;
-    if (note == 0) {
-      silence_midi(timer1);      
-    } else if (note == 1) {   // Silence both
-      set_pwm_off();
-    } else if (note == 2) {   // Change tempo
-      #ifdef METRONOME
-        update_metronome(timestamp, true);
-      #endif
-      pointer = read_varint(pointer, current_tempo);
-    } else if (note == 5) {   // End of file
-      pointer = nullptr;
+  // Plays the pending event and reads ahead to the next one; returns false at the end of the song
+  bool play_midi_event(unsigned long timestamp) {
+    uint8_t voice = (next_event & EVENT_VOICE0) ? 0 : 1;
+    byte volume = next_event & EVENT_VOLUME_MASK;
+    midi_instruction_count++;
+    if (volume == VOLUME_NOTE_OFF) {
+      silence_midi(voice);
+    } else if (volume != VOLUME_EXTENDED) {
+      play_midi_note(read_song_byte(), volume, voice);
     } else {
-      byte volume = *(pointer++);
-      play_midi_note(note, volume, timer1);
+      byte opcode = read_song_byte();
+      if (opcode == OPCODE_BOTH_OFF) {
+        set_pwm_off();
+      } else if (opcode == OPCODE_VOICE_ON) {
+        voice = read_song_byte();
+        byte note = read_song_byte();
+        play_midi_note(note, read_song_byte(), voice);
+      } else if (opcode == OPCODE_VOICE_OFF) {
+        silence_midi(read_song_byte());
+      } else if (opcode == OPCODE_SET_TEMPO) {
+        #ifdef METRONOME
+          update_metronome(timestamp, true);
+        #endif
+        read_varint(current_tempo);
+      } else if (opcode == OPCODE_LED_CUE) {
+        read_led_cue();
+      } else if (opcode == OPCODE_END) {
+        return false;
+      }
     }
-    midi_instruction_count++;
-    return pointer;
-  }
-
-  inline void set_timer1_prescale(uint8_t CS_bits = 1) {
-    CS_bits = (CS_bits == 0) ? 1 : (CS_bits > 5 ? 5 : CS_bits);
-    
-    // WGM13 + WGM12 (0x18) = fast PWM mode, ICR1 as TOP
-    TCCR1B = _BV(WGM13) | _BV(WGM12) | CS_bits;
-  }
-  
-  // Default value = 128x
-  inline void set_timer2_prescale(uint8_t CS_bits = 5) {
-    CS_bits = (CS_bits == 0) ? 1 : (CS_bits > 7 ? 7 : CS_bits);
-    
-    // WGM22 (0x08) = fast PWM mode, OCR2A as TOP
-    TCCR2B = _BV(WGM22) | CS_bits;
+    read_event_header();
+    return true;
   }
 } // namespace
 
-void setup_timers() {
-  // Initialize PWM_1 timer
-  // WGM11  (0x02) = fast PWM mode, ICR1 as TOP
-  TCCR1A = _BV(WGM11);
-  // Sets TCCR1B register
-  set_timer1_prescale();
-  OCR1A = 0;
-  ICR1 = 65535; // Lowest frequency at 1x prescale = 244 Hz
-
-  // Initialize PWM_2 timer
-  // WGM21 + WGM20 (0x03) = fast PWM mode, OCR2A as TOP
-  TCCR2A = _BV(WGM21) | _BV(WGM20);
-  // Sets TCCR2B register
-  set_timer2_prescale();
-  OCR2B = 0;
-  OCR2A = 255; // Lowest frequency at 128x prescale = 488 Hz
-}
-
-void silence_midi(bool timer1) {
-  if (timer1) {
-    TCCR1A = _BV(WGM11);
-    digitalWrite(PWM_1, LOW);
-  } else {
-    TCCR2A = _BV(WGM21) | _BV(WGM20);
-    digitalWrite(PWM_2, LOW);
-  }
+void silence_midi(uint8_t voice) {
+  router_note_off(voice);
 }
 
+// Silences every voice the backend provides, ending any pulse train
 void set_pwm_off() {
-  silence_midi(true);
-  silence_midi(false);
+  stop_pulse_train();
+  router_all_off();
 }
 
-// Coil frequency = 250 kHz
-// Arduino frequency = 16 MHz = 64 * (250 kHz)
-// Coil half-cycle = 32 Arduino clock cycles
-#define COIL_FREQ_CYCLES_HALF 32
-#define MAX_VOLUME 10
-
-// Volume is interpreted as a number of cycles
-void play_midi_note(uint8_t note, uint8_t volume, bool timer1) {
-  if (note & 0x80) return;
-  if (timer1) {
-    if (note < TIMER1_MIDI_OFFSET) return;
-    uint8_t cs_bits = timer1_prescale_cs_bits(note);
-    uint16_t prescale_value = PRESCALE1_VALUES[cs_bits - 1];
-    // Logic on the board forces switching on the full cycle only; so a volume level of 1 targets a 0.5 cycle ON time
-    uint16_t tgt_duty = (min(volume, MAX_VOLUME) * COIL_FREQ_CYCLES_HALF) / prescale_value;
-    tgt_duty = (tgt_duty > 0) ? tgt_duty - 1 : 0;
-    uint16_t freq = timer1_frequencies[note - TIMER1_MIDI_OFFSET];
-    set_timer1_prescale(cs_bits);
-    
-    OCR1A = tgt_duty >= freq ? freq - 1 : (uint8_t)tgt_duty;
-    ICR1 = freq;
-
-    // Initialize PWM_1 timer
-    // COM1A1 (0x80) = non-inverted PWM output to timer 1 channel A (pin 9)
-    // WGM11  (0x02) = fast PWM mode, ICR1 as TOP
-    TCCR1A = _BV(COM1A1) | _BV(WGM11);
-  } else {
-    if (note < TIMER2_MIDI_OFFSET) return;    
-    uint8_t cs_bits = timer2_prescale_cs_bits(note);
-    uint16_t prescale_value = PRESCALE2_VALUES[cs_bits - 1];
-    uint16_t tgt_duty = (min(volume, MAX_VOLUME) * COIL_FREQ_CYCLES_HALF) / prescale_value;
-    tgt_duty = (tgt_duty > 0) ? tgt_duty - 1 : 0;
-    uint8_t freq = timer2_frequencies[note - TIMER2_MIDI_OFFSET];
-    set_timer2_prescale(cs_bits);
-    
-    OCR2B = tgt_duty >= freq ? freq - 1 : (uint8_t)tgt_duty;
-    OCR2A = freq;
-
-    // Initialize PWM_2 timer
-    // COM2B1 (0x20) = non-inverted PWM output to timer 2 channel B (pin 3)
-    // WGM21 + WGM20 (0x03) = fast PWM mode, OCR2A as TOP
-    TCCR2A = _BV(COM2B1) | _BV(WGM21) | _BV(WGM20);
-  }
+// Volume is interpreted as a number of cycles; the router picks the hardware voice
+void play_midi_note(uint8_t note, uint8_t volume, uint8_t voice) {
+  router_note_on(voice, note, thermal_throttle(volume));
 }
 
 namespace {
-  const byte* current_midi_pointer = nullptr;
-
   bool is_paused = false;
   unsigned long prev_mark_us = 0;
+  unsigned long song_start_us = 0;
+  unsigned long pause_start_us = 0;
+
+  #ifdef SMF_PLAYBACK
+    // Playing a file from the SD card (SmfPlayer.h)
+    bool smf_song = false;
+
+    void stop_smf() {
+      if (!smf_song) return;
+      smf_stop();
+      smf_song = false;
+    }
+  #endif
 }
 
 bool play_midi() {
-  if (is_paused || !current_midi_pointer) return false;
-  unsigned long timestamp = micros();
-  
-  // catch micros wraparound
-  if (prev_mark_us == 0 || prev_mark_us > timestamp) 
-    prev_mark_us = timestamp;
+  #ifdef SMF_PLAYBACK
+  if (smf_song) {
+    if (is_paused) return false;
+    if (smf_play(timebase_us())) return true;
+    smf_song = false;
+    #ifdef SERIAL_LOGGING
+      Serial.println(F("End of song"));
+    #endif
+    return false;
+  }
+  #endif
+  if (pulse_train_song) {
+    if (is_paused) return false;
+    if (song_pointer) fill_pulse_train();
+    if (!pulse_train_finished()) return true;
+    #ifdef SERIAL_LOGGING
+      Serial.println(F("End of song"));
+    #endif
+    return false;
+  }
+  if (is_paused || !song_pointer) return false;
+  unsigned long timestamp = timebase_us();
     
-  unsigned long next_ticks = peek_varint(current_midi_pointer);
+  // Signed difference, so the mark may be ahead of the timestamp and either may wrap
   unsigned long rem_us = next_ticks * current_tempo / current_ticks_per_beat;
-  while (timestamp >= prev_mark_us + rem_us) {
+  while ((long)(timestamp - prev_mark_us) >= (long)rem_us) {
     prev_mark_us += rem_us;
-    current_midi_pointer = play_midi_pointer(current_midi_pointer, timestamp);
     
-    if (current_midi_pointer) {
-      next_ticks = peek_varint(current_midi_pointer);
+    if (play_midi_event(timestamp)) {
       rem_us = next_ticks * current_tempo / current_ticks_per_beat;      
     } else {
-      prev_mark_us = 0;
+      song_pointer = nullptr;
       #ifdef SERIAL_LOGGING
         Serial.println(F("End of song"));
       #endif
@@ -291,6 +348,10 @@ bool play_midi() {
 
 void pause_midi() {
   is_paused = true;
+  pause_start_us = timebase_us();
+  if (pulse_train_song) pulse_train_pause(true);
+  // Sounding notes would keep gating the coil with the run switch off
+  router_all_off();
   #ifdef METRONOME
     pause_metronome();
   #endif
@@ -298,24 +359,70 @@ void pause_midi() {
 
 void resume_midi() {
   is_paused = false;
+  if (pulse_train_song) pulse_train_pause(false);
+  // Hold the song position while paused
+  unsigned long paused_us = timebase_us() - pause_start_us;
+  prev_mark_us += paused_us;
+  song_start_us += paused_us;
+  #ifdef SMF_PLAYBACK
+    if (smf_song) smf_shift_position(-(long)paused_us);
+  #endif
   #ifdef METRONOME
     resume_metronome();
   #endif
 }
 
 void start_midi(const byte* midi_pointer) {
-  current_midi_pointer = midi_pointer;
+  #ifdef SMF_PLAYBACK
+    stop_smf();
+  #endif
+  stop_pulse_train();
+  // A song abandoned while paused leaves the flag set
+  is_paused = false;
+  open_song(midi_pointer);
+
+  byte first_byte = read_song_byte();
+  if (first_byte == PULSE_TRAIN_MARKER) {
+    set_pwm_off();
+    pulse_train_song = true;
+    pulse_period = 0;
+    pulse_width = 0;
+    pulse_train_start();
+    fill_pulse_train();
+    song_start_us = timebase_us();
+    return;
+  }
 
-  // Read initial resolution and tempo from song file
-  current_midi_pointer = read_varint(current_midi_pointer, current_ticks_per_beat);
-  current_midi_pointer = read_varint(current_midi_pointer, current_tempo);
+  // Read initial resolution, tempo and delta table from song file
+  read_varint(current_ticks_per_beat, first_byte);
+  read_varint(current_tempo);
+  for (uint8_t i = 0; i < DELTA_TABLE_SIZE; i++) {
+    unsigned long delta = 0;
+    read_varint(delta);
+    delta_table[i] = delta;
+  }
+  read_event_header();
   
-  prev_mark_us = micros();
+  prev_mark_us = timebase_us();
+  song_start_us = prev_mark_us;
   #ifdef METRONOME
     reset_metronome(prev_mark_us);
   #endif
 }
 
+unsigned long get_midi_position_us(unsigned long timestamp) {
+  return timestamp - song_start_us;
+}
+
+void shift_midi_position(long offset_us) {
+  // Moving the marks back plays the song further ahead
+  prev_mark_us -= offset_us;
+  song_start_us -= offset_us;
+  #ifdef SMF_PLAYBACK
+    if (smf_song) smf_shift_position(offset_us);
+  #endif
+}
+
 namespace {
   #define NUM_SONGS 5
   const byte* songs[] = {
@@ -326,6 +433,20 @@ namespace {
     BACH_INVENTION};
   int prev_song_index = -1;
 
+  // SyncLink sends the song index as a single 7-bit byte
+  #define MAX_SONG_COUNT 0x80
+  static_assert(NUM_SONGS <= MAX_SONG_COUNT, "song index must fit in 7 bits");
+
+  // Files on the SD card follow the flash songs, as far as the index reaches
+  int song_count() {
+    #ifdef SMF_PLAYBACK
+      int count = NUM_SONGS + smf_song_count();
+      return count < MAX_SONG_COUNT ? count : MAX_SONG_COUNT;
+    #else
+      return NUM_SONGS;
+    #endif
+  }
+
   #ifdef SERIAL_LOGGING
     const String song_names[] PROGMEM = {
       "Marriage of Figaro", 
@@ -338,10 +459,26 @@ namespace {
 
 void load_next_song() { 
   // Select a new song different from the last played
-  int song_index = random(NUM_SONGS);
-  while (song_index == prev_song_index) 
-    song_index = random(NUM_SONGS);  
+  int song_index = random(song_count());
+  while (song_index == prev_song_index && song_count() > 1) 
+    song_index = random(song_count());  
     
+  load_song(song_index);
+}
+
+void load_song(int song_index) {
+  if (song_index < 0 || song_index >= song_count()) return;
+
+  #ifdef SMF_PLAYBACK
+  if (song_index >= NUM_SONGS) {
+    set_pwm_off();
+    song_start_us = timebase_us();
+    smf_song = smf_start(song_index - NUM_SONGS, song_start_us);
+    prev_song_index = song_index;
+    return;
+  }
+  #endif
+
   #ifdef SERIAL_LOGGING
     Serial.print(F("Playing song: "));
     Serial.println(song_names[song_index]);
@@ -351,11 +488,118 @@ void load_next_song() {
   prev_song_index = song_index;
 }
 
+int get_song_index() {
+  return prev_song_index;
+}
+
+#ifdef SONG_BENCHMARK
+  #ifndef SERIAL_LOGGING
+    #error "SONG_BENCHMARK reports over SERIAL_LOGGING"
+  #endif
+
+namespace {
+  // Wraps of Timer1 at clk/1, every 4.1 ms. PulseTrain owns the overflow
+  // vector, so the channel B match at MAX counts them, flagged at the same
+  // clock as TOV1.
+  volatile uint16_t bench_wraps = 0;
+}
+
+ISR(TIMER1_COMPB_vect) {
+  bench_wraps++;
+}
+
+void bench_cycles_start() {
+  TCCR1B = 0;
+  TCCR1A = 0;
+  TCNT1 = 0;
+  OCR1B = 0xffff;
+  bench_wraps = 0;
+  TIFR1 = _BV(OCF1B);
+  TIMSK1 = _BV(OCIE1B);
+  TCCR1B = _BV(CS10);
+}
+
+uint32_t bench_cycles() {
+  uint8_t sreg = SREG;
+  cli();
+  uint16_t wraps = bench_wraps;
+  uint16_t count = TCNT1;
+  // A wrap whose ISR has not run yet, with interrupts masked by the caller
+  // or here
+  if ((TIFR1 & _BV(OCF1B)) && count < 0x8000) wraps++;
+  SREG = sreg;
+  return ((uint32_t)wraps << 16) | count;
+}
+
+void bench_cycles_stop() {
+  TIMSK1 = 0;
+  TCCR1B = 0;
+}
+
+// Decodes each song start to end without waiting out its timing, counting
+// CPU cycles around each event with bench_cycles(). Interrupts stay enabled
+// so the wraps are counted, and an event's cycles include the ISRs that land
+// in it: the timebase's Timer0 overflow, about 0.5%, with the serial output
+// drained first. Prints the events, total and worst-case cycles per event,
+// and the share of the CPU decoding takes when the song plays in real time.
+// Pulse-train songs drive Timer1 themselves and are skipped.
+void benchmark_song_decode() {
+  bench_cycles_start();
+  uint32_t start = bench_cycles();
+  uint32_t overhead = bench_cycles() - start;
+
+  Serial.println(F("Song decode: events, cycles, worst event, CPU"));
+  for (int i = 0; i < NUM_SONGS; i++) {
+    Serial.print(song_names[i]);
+    Serial.print(F(": "));
+    open_song(songs[i]);
+    if (read_song_byte() == PULSE_TRAIN_MARKER) {
+      Serial.println(F("pulse train, skipped"));
+      continue;
+    }
+    start_midi(songs[i]);
+    Serial.flush();
+
+    unsigned long events = 0;
+    unsigned long total_cycles = 0;
+    uint32_t worst_cycles = 0;
+    unsigned long song_us = 0;
+    bool playing = true;
+    while (playing) {
+      song_us += next_ticks * current_tempo / current_ticks_per_beat;
+      start = bench_cycles();
+      playing = play_midi_event(prev_mark_us + song_us);
+      uint32_t cycles = bench_cycles() - start - overhead;
+      events++;
+      total_cycles += cycles;
+      if (cycles > worst_cycles) worst_cycles = cycles;
+    }
+    song_pointer = nullptr;
+    set_pwm_off();
+
+    Serial.print(events);
+    Serial.print(F(", "));
+    Serial.print(total_cycles);
+    Serial.print(F(", "));
+    Serial.print(worst_cycles);
+    Serial.print(F(", "));
+    Serial.print(100.0 * total_cycles / ((float)song_us * (F_CPU / 1000000)), 3);
+    Serial.println(F("%"));
+  }
+  bench_cycles_stop();
+}
+#endif
+
 void send_single_pulse(unsigned long us) {
     set_pwm_off();
     
-    // Toggle timer 1 pin for a few us
-    digitalWrite(PWM_1, HIGH);
+    // Toggle timer 1 pin for a few us, with interrupts masked so no ISR
+    // (the core's Timer0 overflow, or a Timer0 voice's sub-period) stretches it
+    uint8_t sreg = SREG;
+    cli();
+    digitalWrite(voice_pin(0), HIGH);
     delayMicroseconds(us);
-    digitalWrite(PWM_1, LOW);
+    digitalWrite(voice_pin(0), LOW);
+    SREG = sreg;
+    thermal_add_pulse(us * 2);
 }
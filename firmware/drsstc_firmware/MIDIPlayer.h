@@ -6,23 +6,39 @@
 
 extern int midi_instruction_count;
 
-void setup_timers();
-
-void play_midi_note(uint8_t note, uint8_t volume = 1, bool timer1 = true);
-void silence_midi(bool timer1 = true);
+// Song voices, mapped onto the hardware voices by the router (see VoiceRouter.h)
+void play_midi_note(uint8_t note, uint8_t volume = 1, uint8_t voice = 0);
+void silence_midi(uint8_t voice = 0);
 void set_pwm_off();
 
-void start_midi(byte* midi_pointer);
+void start_midi(const byte* midi_pointer);
 bool play_midi();   // Returns false when song is over
 void pause_midi();
 void resume_midi();
 
+// Song timeline, for synchronizing several controllers
+unsigned long get_midi_position_us(unsigned long timestamp);
+void shift_midi_position(long offset_us);
+
 extern const byte BACH_INVENTION[] PROGMEM;
 extern const byte MARRIAGE_OF_FIGARO[] PROGMEM;
 extern const byte ODE_TO_JOY[] PROGMEM;
 extern const byte WILLIAM_TELL[] PROGMEM;
 extern const byte SUGAR_PLUM_FAIRY[] PROGMEM;
+// Test patterns built from scores at compile time (TestPatterns.cpp)
+extern const byte* const TEST_SCALE;
+extern const byte* const TEST_CHORDS;
 void load_next_song();
+void load_song(int song_index);
+int get_song_index();
 
 
 void send_single_pulse(unsigned long us);
+
+// SONG_BENCHMARK builds (VoiceBackend.h): decode cycles of each song, over serial
+void benchmark_song_decode();
+// SONG_BENCHMARK builds: CPU cycles on Timer1 at clk/1, extended to 32 bits
+// by counting its wraps; start() takes Timer1 and stop() releases it
+void bench_cycles_start();
+uint32_t bench_cycles();
+void bench_cycles_stop();
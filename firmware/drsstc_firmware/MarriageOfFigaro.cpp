@@ -1,2196 +1,161 @@
 #include "MIDIPlayer.h"
 
-// converted from mfig.mid - 6540 bytes total
+// converted from mfig.mid - 2469 bytes total (4404 bytes before Huffman coding)
 extern const byte MARRIAGE_OF_FIGARO[] PROGMEM = 
 {
-           0xb0,0x0e,0x27,0x87, //      0 BEGIN PROGRAM (48 ticks/beat, tempo = 234375 us/beat)
-                0x80,0xb2,0x08, //      0 T1 ON, NOTE  50 VOLUME  8
-                0x98,0xb1,0x08, //     24 T1 ON, NOTE  49 VOLUME  8
-                0x98,0xb2,0x08, //     24 T1 ON, NOTE  50 VOLUME  8
-                0x98,0xb1,0x08, //     24 T1 ON, NOTE  49 VOLUME  8
-                0x98,0xb2,0x08, //     24 T1 ON, NOTE  50 VOLUME  8
-                     0xb0,0x01, //     48 BOTH OFF
-                0xb0,0xb2,0x08, //     48 T1 ON, NOTE  50 VOLUME  8
-                0x98,0xb1,0x08, //     24 T1 ON, NOTE  49 VOLUME  8
-                0x98,0xb2,0x08, //     24 T1 ON, NOTE  50 VOLUME  8
-                0x98,0xb4,0x08, //     24 T1 ON, NOTE  52 VOLUME  8
-                0x98,0xb6,0x08, //     24 T1 ON, NOTE  54 VOLUME  8
-                0x98,0xb4,0x08, //     24 T1 ON, NOTE  52 VOLUME  8
-                0x98,0xb6,0x08, //     24 T1 ON, NOTE  54 VOLUME  8
-                0x98,0xb7,0x08, //     24 T1 ON, NOTE  55 VOLUME  8
-                0x98,0xb9,0x08, //     24 T1 ON, NOTE  57 VOLUME  8
-                0x98,0xb8,0x08, //     24 T1 ON, NOTE  56 VOLUME  8
-                0x98,0xb9,0x08, //     24 T1 ON, NOTE  57 VOLUME  8
-                0x98,0xb8,0x08, //     24 T1 ON, NOTE  56 VOLUME  8
-                0x98,0xb9,0x08, //     24 T1 ON, NOTE  57 VOLUME  8
-                     0xb0,0x01, //     48 BOTH OFF
-                0xb0,0xb9,0x08, //     48 T1 ON, NOTE  57 VOLUME  8
-                0x98,0xb8,0x08, //     24 T1 ON, NOTE  56 VOLUME  8
-                0x98,0xb9,0x08, //     24 T1 ON, NOTE  57 VOLUME  8
-                0x98,0xba,0x08, //     24 T1 ON, NOTE  58 VOLUME  8
-                0x98,0xbb,0x08, //     24 T1 ON, NOTE  59 VOLUME  8
-                0x98,0xb9,0x08, //     24 T1 ON, NOTE  57 VOLUME  8
-                0x98,0xb7,0x08, //     24 T1 ON, NOTE  55 VOLUME  8
-                0x98,0xb6,0x08, //     24 T1 ON, NOTE  54 VOLUME  8
-                0x98,0xb4,0x08, //     24 T1 ON, NOTE  52 VOLUME  8
-                0x98,0xb3,0x08, //     24 T1 ON, NOTE  51 VOLUME  8
-                0x98,0xb4,0x08, //     24 T1 ON, NOTE  52 VOLUME  8
-                0x98,0xb6,0x08, //     24 T1 ON, NOTE  54 VOLUME  8
-                0x98,0xb7,0x08, //     24 T1 ON, NOTE  55 VOLUME  8
-                0x98,0xb6,0x08, //     24 T1 ON, NOTE  54 VOLUME  8
-                0x98,0xb4,0x08, //     24 T1 ON, NOTE  52 VOLUME  8
-                0x98,0xb2,0x08, //     24 T1 ON, NOTE  50 VOLUME  8
-                0x98,0xb1,0x08, //     24 T1 ON, NOTE  49 VOLUME  8
-                0x98,0xb2,0x08, //     24 T1 ON, NOTE  50 VOLUME  8
-                0x98,0xb4,0x08, //     24 T1 ON, NOTE  52 VOLUME  8
-                0x98,0xb2,0x08, //     24 T1 ON, NOTE  50 VOLUME  8
-                0x98,0xb1,0x08, //     24 T1 ON, NOTE  49 VOLUME  8
-                0x98,0xad,0x08, //     24 T1 ON, NOTE  45 VOLUME  8
-                0x98,0xaf,0x08, //     24 T1 ON, NOTE  47 VOLUME  8
-                0x98,0xb1,0x08, //     24 T1 ON, NOTE  49 VOLUME  8
-                0x98,0xb2,0x08, //     24 T1 ON, NOTE  50 VOLUME  8
-                0x98,0xbe,0x08, //     24 T1 ON, NOTE  62 VOLUME  8
-                0x98,0xb2,0x08, //     24 T1 ON, NOTE  50 VOLUME  8
-                0x98,0xbe,0x08, //     24 T1 ON, NOTE  62 VOLUME  8
-                0x98,0xb2,0x08, //     24 T1 ON, NOTE  50 VOLUME  8
-                0x98,0xbe,0x08, //     24 T1 ON, NOTE  62 VOLUME  8
-                0x98,0xb2,0x08, //     24 T1 ON, NOTE  50 VOLUME  8
-                0x98,0xbe,0x08, //     24 T1 ON, NOTE  62 VOLUME  8
-                0x98,0xc5,0x08, //     24 T1 ON, NOTE  69 VOLUME  8
-                0x98,0xbe,0x08, //     24 T1 ON, NOTE  62 VOLUME  8
-                0x98,0xb2,0x08, //     24 T1 ON, NOTE  50 VOLUME  8
-                0x98,0xbe,0x08, //     24 T1 ON, NOTE  62 VOLUME  8
-                0x98,0xb2,0x08, //     24 T1 ON, NOTE  50 VOLUME  8
-                0x98,0xbe,0x08, //     24 T1 ON, NOTE  62 VOLUME  8
-                0x98,0xc9,0x05, //     24 T1 ON, NOTE  73 VOLUME  5
-                0x98,0xbe,0x08, //     24 T1 ON, NOTE  62 VOLUME  8
-                0x98,0xc2,0x05, //     24 T1 ON, NOTE  66 VOLUME  5
-                0x98,0xbe,0x08, //     24 T1 ON, NOTE  62 VOLUME  8
-                0x98,0xc2,0x05, //     24 T1 ON, NOTE  66 VOLUME  5
-                0x98,0xbe,0x08, //     24 T1 ON, NOTE  62 VOLUME  8
-                0x98,0xc5,0x05, //     24 T1 ON, NOTE  69 VOLUME  5
-                0x98,0xbe,0x08, //     24 T1 ON, NOTE  62 VOLUME  8
-                0x98,0xca,0x05, //     24 T1 ON, NOTE  74 VOLUME  5
-                0x98,0xbe,0x08, //     24 T1 ON, NOTE  62 VOLUME  8
-                0x98,0xce,0x05, //     24 T1 ON, NOTE  78 VOLUME  5
-                0x98,0xbe,0x08, //     24 T1 ON, NOTE  62 VOLUME  8
-                0x98,0xb2,0x08, //     24 T1 ON, NOTE  50 VOLUME  8
-                0x98,0xbe,0x08, //     24 T1 ON, NOTE  62 VOLUME  8
-                0x98,0xb2,0x08, //     24 T1 ON, NOTE  50 VOLUME  8
-                0x98,0xbe,0x08, //     24 T1 ON, NOTE  62 VOLUME  8
-                0x98,0xcc,0x05, //     24 T1 ON, NOTE  76 VOLUME  5
-                0x98,0xbe,0x08, //     24 T1 ON, NOTE  62 VOLUME  8
-                0x98,0xca,0x05, //     24 T1 ON, NOTE  74 VOLUME  5
-                0x98,0xbe,0x08, //     24 T1 ON, NOTE  62 VOLUME  8
-                0x98,0xc5,0x05, //     24 T1 ON, NOTE  69 VOLUME  5
-                0x98,0xbe,0x08, //     24 T1 ON, NOTE  62 VOLUME  8
-                0x98,0xca,0x05, //     24 T1 ON, NOTE  74 VOLUME  5
-                0x98,0xbe,0x08, //     24 T1 ON, NOTE  62 VOLUME  8
-                0x98,0xce,0x05, //     24 T1 ON, NOTE  78 VOLUME  5
-                0x98,0xbe,0x08, //     24 T1 ON, NOTE  62 VOLUME  8
-                0x98,0xca,0x08, //     24 T1 ON, NOTE  74 VOLUME  8
-                0x98,0xbe,0x08, //     24 T1 ON, NOTE  62 VOLUME  8
-                0x98,0xb2,0x08, //     24 T1 ON, NOTE  50 VOLUME  8
-                0x98,0xbe,0x08, //     24 T1 ON, NOTE  62 VOLUME  8
-                0x98,0xb2,0x08, //     24 T1 ON, NOTE  50 VOLUME  8
-                0x98,0xbe,0x08, //     24 T1 ON, NOTE  62 VOLUME  8
-                0x98,0xb2,0x08, //     24 T1 ON, NOTE  50 VOLUME  8
-                0x98,0xbe,0x08, //     24 T1 ON, NOTE  62 VOLUME  8
-                0x98,0xcc,0x05, //     24 T1 ON, NOTE  76 VOLUME  5
-                0x98,0xbe,0x08, //     24 T1 ON, NOTE  62 VOLUME  8
-                0x98,0xb2,0x08, //     24 T1 ON, NOTE  50 VOLUME  8
-                0x98,0xbe,0x08, //     24 T1 ON, NOTE  62 VOLUME  8
-                0x98,0xb2,0x08, //     24 T1 ON, NOTE  50 VOLUME  8
-                0x98,0xbe,0x08, //     24 T1 ON, NOTE  62 VOLUME  8
-                0x98,0xcf,0x05, //     24 T1 ON, NOTE  79 VOLUME  5
-                0x98,0xbe,0x08, //     24 T1 ON, NOTE  62 VOLUME  8
-                0x98,0xce,0x05, //     24 T1 ON, NOTE  78 VOLUME  5
-                0x98,0xbe,0x08, //     24 T1 ON, NOTE  62 VOLUME  8
-                0x98,0xce,0x05, //     24 T1 ON, NOTE  78 VOLUME  5
-                0x98,0xbe,0x08, //     24 T1 ON, NOTE  62 VOLUME  8
-                0x98,0xcc,0x05, //     24 T1 ON, NOTE  76 VOLUME  5
-                0x8c,0xd5,0x08, //     12 T1 ON, NOTE  85 VOLUME  8
-                0x8c,0xbe,0x08, //     12 T1 ON, NOTE  62 VOLUME  8
-                0x8c,0xd5,0x08, //     12 T1 ON, NOTE  85 VOLUME  8
-                0x8c,0xcf,0x05, //     12 T1 ON, NOTE  79 VOLUME  5
-                0x98,0xbe,0x08, //     24 T1 ON, NOTE  62 VOLUME  8
-                0x98,0xce,0x05, //     24 T1 ON, NOTE  78 VOLUME  5
-                0x98,0xbe,0x08, //     24 T1 ON, NOTE  62 VOLUME  8
-                0x98,0xce,0x05, //     24 T1 ON, NOTE  78 VOLUME  5
-                0x98,0xbe,0x08, //     24 T1 ON, NOTE  62 VOLUME  8
-                0x98,0xcc,0x05, //     24 T1 ON, NOTE  76 VOLUME  5
-                0x8c,0xd5,0x08, //     12 T1 ON, NOTE  85 VOLUME  8
-                0x8c,0xbe,0x08, //     12 T1 ON, NOTE  62 VOLUME  8
-                0x8c,0xd5,0x08, //     12 T1 ON, NOTE  85 VOLUME  8
-                0x8c,0xcf,0x05, //     12 T1 ON, NOTE  79 VOLUME  5
-                0x98,0xbe,0x08, //     24 T1 ON, NOTE  62 VOLUME  8
-                0x98,0xce,0x05, //     24 T1 ON, NOTE  78 VOLUME  5
-                0xe0,0xc7,0x08, //     96 T1 ON, NOTE  71 VOLUME  8
-                0xe0,0xc5,0x08, //     96 T1 ON, NOTE  69 VOLUME  8
-                0xe0,0xc3,0x08, //     96 T1 ON, NOTE  67 VOLUME  8
-                0xe0,0xc2,0x05, //     96 T1 ON, NOTE  66 VOLUME  5
-                0x98,0xb1,0x08, //     24 T1 ON, NOTE  49 VOLUME  8
-                0x98,0xb2,0x08, //     24 T1 ON, NOTE  50 VOLUME  8
-                0x98,0xb1,0x08, //     24 T1 ON, NOTE  49 VOLUME  8
-                0x98,0xb2,0x08, //     24 T1 ON, NOTE  50 VOLUME  8
-                     0xb0,0x01, //     48 BOTH OFF
-                0xb0,0xce,0x05, //     48 T1 ON, NOTE  78 VOLUME  5
-                0x98,0xb1,0x08, //     24 T1 ON, NOTE  49 VOLUME  8
-                0x98,0xb2,0x08, //     24 T1 ON, NOTE  50 VOLUME  8
-                0x98,0xb4,0x08, //     24 T1 ON, NOTE  52 VOLUME  8
-                0x98,0xb6,0x08, //     24 T1 ON, NOTE  54 VOLUME  8
-                0x98,0xb4,0x08, //     24 T1 ON, NOTE  52 VOLUME  8
-                0x98,0xb6,0x08, //     24 T1 ON, NOTE  54 VOLUME  8
-                0x98,0xb7,0x08, //     24 T1 ON, NOTE  55 VOLUME  8
-                0x98,0xcc,0x05, //     24 T1 ON, NOTE  76 VOLUME  5
-                0x98,0xb8,0x08, //     24 T1 ON, NOTE  56 VOLUME  8
-                0x98,0xb9,0x08, //     24 T1 ON, NOTE  57 VOLUME  8
-                0x98,0xb8,0x08, //     24 T1 ON, NOTE  56 VOLUME  8
-                0x98,0xb9,0x08, //     24 T1 ON, NOTE  57 VOLUME  8
-                     0xb0,0x01, //     48 BOTH OFF
-                0x98,0xce,0x05, //     24 T1 ON, NOTE  78 VOLUME  5
-                0x98,0xcf,0x05, //     24 T1 ON, NOTE  79 VOLUME  5
-                0x98,0xb8,0x08, //     24 T1 ON, NOTE  56 VOLUME  8
-                0x98,0xb9,0x08, //     24 T1 ON, NOTE  57 VOLUME  8
-                0x98,0xba,0x08, //     24 T1 ON, NOTE  58 VOLUME  8
-                0x98,0xce,0x05, //     24 T1 ON, NOTE  78 VOLUME  5
-                0x98,0xb9,0x08, //     24 T1 ON, NOTE  57 VOLUME  8
-                0x98,0xb7,0x08, //     24 T1 ON, NOTE  55 VOLUME  8
-                0x98,0xb6,0x08, //     24 T1 ON, NOTE  54 VOLUME  8
-                0x98,0xcf,0x05, //     24 T1 ON, NOTE  79 VOLUME  5
-                0x98,0xb3,0x08, //     24 T1 ON, NOTE  51 VOLUME  8
-                0x98,0xb4,0x08, //     24 T1 ON, NOTE  52 VOLUME  8
-                0x98,0xce,0x05, //     24 T1 ON, NOTE  78 VOLUME  5
-                0x98,0xcc,0x05, //     24 T1 ON, NOTE  76 VOLUME  5
-                0x98,0xb6,0x08, //     24 T1 ON, NOTE  54 VOLUME  8
-                0x98,0xb4,0x08, //     24 T1 ON, NOTE  52 VOLUME  8
-                0x98,0xce,0x05, //     24 T1 ON, NOTE  78 VOLUME  5
-                0x98,0xcf,0x05, //     24 T1 ON, NOTE  79 VOLUME  5
-                0x98,0xb2,0x08, //     24 T1 ON, NOTE  50 VOLUME  8
-                0x98,0xb4,0x08, //     24 T1 ON, NOTE  52 VOLUME  8
-                0x98,0xb2,0x08, //     24 T1 ON, NOTE  50 VOLUME  8
-                0x98,0xcc,0x05, //     24 T1 ON, NOTE  76 VOLUME  5
-                0x98,0xad,0x08, //     24 T1 ON, NOTE  45 VOLUME  8
-                0x98,0xaf,0x08, //     24 T1 ON, NOTE  47 VOLUME  8
-                0x98,0xb1,0x08, //     24 T1 ON, NOTE  49 VOLUME  8
-                0x98,0xca,0x05, //     24 T1 ON, NOTE  74 VOLUME  5
-                0x98,0xbe,0x08, //     24 T1 ON, NOTE  62 VOLUME  8
-                0x98,0xb2,0x08, //     24 T1 ON, NOTE  50 VOLUME  8
-                0x98,0xbe,0x08, //     24 T1 ON, NOTE  62 VOLUME  8
-                0x98,0xb2,0x08, //     24 T1 ON, NOTE  50 VOLUME  8
-                0x98,0xbe,0x08, //     24 T1 ON, NOTE  62 VOLUME  8
-                0x98,0xb2,0x08, //     24 T1 ON, NOTE  50 VOLUME  8
-                0x98,0xbe,0x08, //     24 T1 ON, NOTE  62 VOLUME  8
-                0x98,0xc5,0x08, //     24 T1 ON, NOTE  69 VOLUME  8
-                0x98,0xbe,0x08, //     24 T1 ON, NOTE  62 VOLUME  8
-                0x98,0xb2,0x08, //     24 T1 ON, NOTE  50 VOLUME  8
-                0x98,0xbe,0x08, //     24 T1 ON, NOTE  62 VOLUME  8
-                0x98,0xb2,0x08, //     24 T1 ON, NOTE  50 VOLUME  8
-                0x98,0xbe,0x08, //     24 T1 ON, NOTE  62 VOLUME  8
-                0x98,0xc9,0x05, //     24 T1 ON, NOTE  73 VOLUME  5
-                0x98,0xbe,0x08, //     24 T1 ON, NOTE  62 VOLUME  8
-                0x98,0xc2,0x05, //     24 T1 ON, NOTE  66 VOLUME  5
-                0x98,0xbe,0x08, //     24 T1 ON, NOTE  62 VOLUME  8
-                0x98,0xc2,0x05, //     24 T1 ON, NOTE  66 VOLUME  5
-                0x98,0xbe,0x08, //     24 T1 ON, NOTE  62 VOLUME  8
-                0x98,0xc5,0x05, //     24 T1 ON, NOTE  69 VOLUME  5
-                0x98,0xbe,0x08, //     24 T1 ON, NOTE  62 VOLUME  8
-                0x98,0xca,0x05, //     24 T1 ON, NOTE  74 VOLUME  5
-                0x98,0xbe,0x08, //     24 T1 ON, NOTE  62 VOLUME  8
-                0x98,0xce,0x05, //     24 T1 ON, NOTE  78 VOLUME  5
-                0x98,0xbe,0x08, //     24 T1 ON, NOTE  62 VOLUME  8
-                0x98,0xb2,0x08, //     24 T1 ON, NOTE  50 VOLUME  8
-                0x98,0xbe,0x08, //     24 T1 ON, NOTE  62 VOLUME  8
-                0x98,0xb2,0x08, //     24 T1 ON, NOTE  50 VOLUME  8
-                0x98,0xbe,0x08, //     24 T1 ON, NOTE  62 VOLUME  8
-                0x98,0xcc,0x05, //     24 T1 ON, NOTE  76 VOLUME  5
-                0x98,0xbe,0x08, //     24 T1 ON, NOTE  62 VOLUME  8
-                0x98,0xca,0x05, //     24 T1 ON, NOTE  74 VOLUME  5
-                0x98,0xbe,0x08, //     24 T1 ON, NOTE  62 VOLUME  8
-                0x98,0xc5,0x05, //     24 T1 ON, NOTE  69 VOLUME  5
-                0x98,0xbe,0x08, //     24 T1 ON, NOTE  62 VOLUME  8
-                0x98,0xca,0x05, //     24 T1 ON, NOTE  74 VOLUME  5
-                0x98,0xbe,0x08, //     24 T1 ON, NOTE  62 VOLUME  8
-                0x98,0xce,0x05, //     24 T1 ON, NOTE  78 VOLUME  5
-                0x98,0xbe,0x08, //     24 T1 ON, NOTE  62 VOLUME  8
-                0x98,0xca,0x08, //     24 T1 ON, NOTE  74 VOLUME  8
-                0x98,0xbe,0x08, //     24 T1 ON, NOTE  62 VOLUME  8
-                0x98,0xb2,0x08, //     24 T1 ON, NOTE  50 VOLUME  8
-                0x98,0xbe,0x08, //     24 T1 ON, NOTE  62 VOLUME  8
-                0x98,0xb2,0x08, //     24 T1 ON, NOTE  50 VOLUME  8
-                0x98,0xbe,0x08, //     24 T1 ON, NOTE  62 VOLUME  8
-                0x98,0xb2,0x08, //     24 T1 ON, NOTE  50 VOLUME  8
-                0x98,0xbe,0x08, //     24 T1 ON, NOTE  62 VOLUME  8
-                0x98,0xcc,0x05, //     24 T1 ON, NOTE  76 VOLUME  5
-                0x98,0xbe,0x08, //     24 T1 ON, NOTE  62 VOLUME  8
-                0x98,0xb2,0x08, //     24 T1 ON, NOTE  50 VOLUME  8
-                0x98,0xbe,0x08, //     24 T1 ON, NOTE  62 VOLUME  8
-                0x98,0xb2,0x08, //     24 T1 ON, NOTE  50 VOLUME  8
-                0x98,0xbe,0x08, //     24 T1 ON, NOTE  62 VOLUME  8
-                0x98,0xcf,0x05, //     24 T1 ON, NOTE  79 VOLUME  5
-                0x98,0xbe,0x08, //     24 T1 ON, NOTE  62 VOLUME  8
-                0x98,0xce,0x05, //     24 T1 ON, NOTE  78 VOLUME  5
-                0x98,0xbe,0x08, //     24 T1 ON, NOTE  62 VOLUME  8
-                0x98,0xce,0x05, //     24 T1 ON, NOTE  78 VOLUME  5
-                0x98,0xbe,0x08, //     24 T1 ON, NOTE  62 VOLUME  8
-                0x98,0xcc,0x05, //     24 T1 ON, NOTE  76 VOLUME  5
-                0x8c,0xd5,0x08, //     12 T1 ON, NOTE  85 VOLUME  8
-                0x8c,0xbe,0x08, //     12 T1 ON, NOTE  62 VOLUME  8
-                0x8c,0xd5,0x08, //     12 T1 ON, NOTE  85 VOLUME  8
-                0x8c,0xcf,0x05, //     12 T1 ON, NOTE  79 VOLUME  5
-                0x98,0xbe,0x08, //     24 T1 ON, NOTE  62 VOLUME  8
-                0x98,0xce,0x05, //     24 T1 ON, NOTE  78 VOLUME  5
-                0x98,0xbe,0x08, //     24 T1 ON, NOTE  62 VOLUME  8
-                0x98,0xce,0x05, //     24 T1 ON, NOTE  78 VOLUME  5
-                0x98,0xbe,0x08, //     24 T1 ON, NOTE  62 VOLUME  8
-                0x98,0xcc,0x05, //     24 T1 ON, NOTE  76 VOLUME  5
-                0x8c,0xd5,0x08, //     12 T1 ON, NOTE  85 VOLUME  8
-                0x8c,0xbe,0x08, //     12 T1 ON, NOTE  62 VOLUME  8
-                0x8c,0xd5,0x08, //     12 T1 ON, NOTE  85 VOLUME  8
-                0x8c,0xcf,0x05, //     12 T1 ON, NOTE  79 VOLUME  5
-                0x98,0xbe,0x08, //     24 T1 ON, NOTE  62 VOLUME  8
-                0x98,0xce,0x05, //     24 T1 ON, NOTE  78 VOLUME  5
-                0xe0,0xc7,0x08, //     96 T1 ON, NOTE  71 VOLUME  8
-                0xe0,0xc5,0x08, //     96 T1 ON, NOTE  69 VOLUME  8
-                0xe0,0xc3,0x08, //     96 T1 ON, NOTE  67 VOLUME  8
-                0xe0,0xb2,0x08, //     96 T1 ON, NOTE  50 VOLUME  8
-                0x98,0xb9,0x08, //     24 T1 ON, NOTE  57 VOLUME  8
-                0x98,0xb2,0x08, //     24 T1 ON, NOTE  50 VOLUME  8
-                0x98,0xb9,0x08, //     24 T1 ON, NOTE  57 VOLUME  8
-                0x98,0xb2,0x08, //     24 T1 ON, NOTE  50 VOLUME  8
-                0x98,0xb9,0x08, //     24 T1 ON, NOTE  57 VOLUME  8
-                0x98,0xb2,0x08, //     24 T1 ON, NOTE  50 VOLUME  8
-                0x98,0xb9,0x08, //     24 T1 ON, NOTE  57 VOLUME  8
-                0x98,0xb2,0x08, //     24 T1 ON, NOTE  50 VOLUME  8
-                0x98,0xb9,0x08, //     24 T1 ON, NOTE  57 VOLUME  8
-                0x98,0xb2,0x08, //     24 T1 ON, NOTE  50 VOLUME  8
-                0x98,0xb9,0x08, //     24 T1 ON, NOTE  57 VOLUME  8
-                0x98,0xb2,0x08, //     24 T1 ON, NOTE  50 VOLUME  8
-                0x98,0xb9,0x08, //     24 T1 ON, NOTE  57 VOLUME  8
-                0x98,0xb2,0x08, //     24 T1 ON, NOTE  50 VOLUME  8
-                0x98,0xb9,0x08, //     24 T1 ON, NOTE  57 VOLUME  8
-                0x98,0xb2,0x08, //     24 T1 ON, NOTE  50 VOLUME  8
-                0x98,0xb9,0x08, //     24 T1 ON, NOTE  57 VOLUME  8
-                0x98,0xb2,0x08, //     24 T1 ON, NOTE  50 VOLUME  8
-                0x98,0xb9,0x08, //     24 T1 ON, NOTE  57 VOLUME  8
-                0x98,0xb2,0x08, //     24 T1 ON, NOTE  50 VOLUME  8
-                0x98,0xb9,0x08, //     24 T1 ON, NOTE  57 VOLUME  8
-                0x98,0xb2,0x08, //     24 T1 ON, NOTE  50 VOLUME  8
-                0x98,0xb9,0x08, //     24 T1 ON, NOTE  57 VOLUME  8
-                0x98,0xb2,0x08, //     24 T1 ON, NOTE  50 VOLUME  8
-                0x98,0xb9,0x08, //     24 T1 ON, NOTE  57 VOLUME  8
-                0x98,0xb2,0x08, //     24 T1 ON, NOTE  50 VOLUME  8
-                0x98,0xb9,0x08, //     24 T1 ON, NOTE  57 VOLUME  8
-                0x98,0xb2,0x08, //     24 T1 ON, NOTE  50 VOLUME  8
-                0x98,0xb9,0x08, //     24 T1 ON, NOTE  57 VOLUME  8
-                0x98,0xb2,0x08, //     24 T1 ON, NOTE  50 VOLUME  8
-                0x98,0xb9,0x08, //     24 T1 ON, NOTE  57 VOLUME  8
-                0x98,0xb2,0x08, //     24 T1 ON, NOTE  50 VOLUME  8
-                0x98,0xb9,0x08, //     24 T1 ON, NOTE  57 VOLUME  8
-                0x98,0xb2,0x08, //     24 T1 ON, NOTE  50 VOLUME  8
-                0x98,0xb9,0x08, //     24 T1 ON, NOTE  57 VOLUME  8
-                0x98,0xb2,0x08, //     24 T1 ON, NOTE  50 VOLUME  8
-                0x98,0xb9,0x08, //     24 T1 ON, NOTE  57 VOLUME  8
-                0x98,0xb2,0x08, //     24 T1 ON, NOTE  50 VOLUME  8
-                0x98,0xb9,0x08, //     24 T1 ON, NOTE  57 VOLUME  8
-                0x98,0xb2,0x08, //     24 T1 ON, NOTE  50 VOLUME  8
-                0x98,0xb9,0x08, //     24 T1 ON, NOTE  57 VOLUME  8
-                0x98,0xb2,0x08, //     24 T1 ON, NOTE  50 VOLUME  8
-                0x98,0xb9,0x08, //     24 T1 ON, NOTE  57 VOLUME  8
-                0x98,0xb2,0x08, //     24 T1 ON, NOTE  50 VOLUME  8
-                0x98,0xb9,0x08, //     24 T1 ON, NOTE  57 VOLUME  8
-                0x98,0xb2,0x08, //     24 T1 ON, NOTE  50 VOLUME  8
-                0x98,0xb9,0x08, //     24 T1 ON, NOTE  57 VOLUME  8
-                0x98,0xb2,0x08, //     24 T1 ON, NOTE  50 VOLUME  8
-                0x98,0xbb,0x08, //     24 T1 ON, NOTE  59 VOLUME  8
-                0x98,0xb2,0x08, //     24 T1 ON, NOTE  50 VOLUME  8
-                0x98,0xbb,0x08, //     24 T1 ON, NOTE  59 VOLUME  8
-                0x98,0xb2,0x08, //     24 T1 ON, NOTE  50 VOLUME  8
-                0x98,0xbb,0x08, //     24 T1 ON, NOTE  59 VOLUME  8
-                0x98,0xb2,0x08, //     24 T1 ON, NOTE  50 VOLUME  8
-                0x98,0xbb,0x08, //     24 T1 ON, NOTE  59 VOLUME  8
-                0x98,0xca,0x08, //     24 T1 ON, NOTE  74 VOLUME  8
-                0x98,0xb4,0x08, //     24 T1 ON, NOTE  52 VOLUME  8
-                0x98,0xb6,0x08, //     24 T1 ON, NOTE  54 VOLUME  8
-                0x98,0xb7,0x08, //     24 T1 ON, NOTE  55 VOLUME  8
-                0x98,0xb9,0x08, //     24 T1 ON, NOTE  57 VOLUME  8
-                0x98,0xbb,0x08, //     24 T1 ON, NOTE  59 VOLUME  8
-                0x98,0xbc,0x08, //     24 T1 ON, NOTE  60 VOLUME  8
-                0x98,0xbe,0x08, //     24 T1 ON, NOTE  62 VOLUME  8
-                0x98,0xcf,0x05, //     24 T1 ON, NOTE  79 VOLUME  5
-                0x98,0xbe,0x08, //     24 T1 ON, NOTE  62 VOLUME  8
-                0x98,0xcf,0x05, //     24 T1 ON, NOTE  79 VOLUME  5
-                0x98,0xbe,0x08, //     24 T1 ON, NOTE  62 VOLUME  8
-                0x98,0xce,0x05, //     24 T1 ON, NOTE  78 VOLUME  5
-                0x98,0xbe,0x08, //     24 T1 ON, NOTE  62 VOLUME  8
-                0x98,0xce,0x05, //     24 T1 ON, NOTE  78 VOLUME  5
-                0x98,0xbe,0x08, //     24 T1 ON, NOTE  62 VOLUME  8
-                0x98,0xcf,0x05, //     24 T1 ON, NOTE  79 VOLUME  5
-                0x98,0xbe,0x08, //     24 T1 ON, NOTE  62 VOLUME  8
-                0x98,0xcf,0x05, //     24 T1 ON, NOTE  79 VOLUME  5
-                0x98,0xbe,0x08, //     24 T1 ON, NOTE  62 VOLUME  8
-                0x98,0xcf,0x05, //     24 T1 ON, NOTE  79 VOLUME  5
-                0x98,0xbe,0x08, //     24 T1 ON, NOTE  62 VOLUME  8
-                0x98,0xcf,0x05, //     24 T1 ON, NOTE  79 VOLUME  5
-                0x98,0xbe,0x08, //     24 T1 ON, NOTE  62 VOLUME  8
-                0x98,0xce,0x05, //     24 T1 ON, NOTE  78 VOLUME  5
-                0x98,0xd1,0x08, //     24 T1 ON, NOTE  81 VOLUME  8
-                0xf8,0xad,0x08, //    120 T1 ON, NOTE  45 VOLUME  8
-                0x98,0xd1,0x08, //     24 T1 ON, NOTE  81 VOLUME  8
-                0x98,0xaa,0x08, //     24 T1 ON, NOTE  42 VOLUME  8
-                0x98,0xd1,0x08, //     24 T1 ON, NOTE  81 VOLUME  8
-                0x98,0xa6,0x08, //     24 T1 ON, NOTE  38 VOLUME  8
-                0x98,0xd1,0x08, //     24 T1 ON, NOTE  81 VOLUME  8
-                0xc8,0xad,0x08, //     72 T1 ON, NOTE  45 VOLUME  8
-                0x98,0xd1,0x08, //     24 T1 ON, NOTE  81 VOLUME  8
-                0x98,0xaa,0x08, //     24 T1 ON, NOTE  42 VOLUME  8
-                0x98,0xd1,0x08, //     24 T1 ON, NOTE  81 VOLUME  8
-                0x98,0xa6,0x08, //     24 T1 ON, NOTE  38 VOLUME  8
-                0x98,0xd1,0x08, //     24 T1 ON, NOTE  81 VOLUME  8
-                0xc8,0xad,0x08, //     72 T1 ON, NOTE  45 VOLUME  8
-                0x98,0xd1,0x08, //     24 T1 ON, NOTE  81 VOLUME  8
-                0x98,0xaa,0x08, //     24 T1 ON, NOTE  42 VOLUME  8
-                0x98,0xd1,0x08, //     24 T1 ON, NOTE  81 VOLUME  8
-                0x98,0xad,0x08, //     24 T1 ON, NOTE  45 VOLUME  8
-                0x98,0xd1,0x08, //     24 T1 ON, NOTE  81 VOLUME  8
-                0x98,0xaa,0x08, //     24 T1 ON, NOTE  42 VOLUME  8
-                0x98,0xd1,0x08, //     24 T1 ON, NOTE  81 VOLUME  8
-                0x98,0xad,0x08, //     24 T1 ON, NOTE  45 VOLUME  8
-                0x98,0xd1,0x08, //     24 T1 ON, NOTE  81 VOLUME  8
-                0x98,0xaa,0x08, //     24 T1 ON, NOTE  42 VOLUME  8
-                0x98,0xd5,0x08, //     24 T1 ON, NOTE  85 VOLUME  8
-                0x98,0xd3,0x08, //     24 T1 ON, NOTE  83 VOLUME  8
-                0x98,0xd1,0x08, //     24 T1 ON, NOTE  81 VOLUME  8
-                0x98,0xbe,0x08, //     24 T1 ON, NOTE  62 VOLUME  8
-                0x98,0xbd,0x08, //     24 T1 ON, NOTE  61 VOLUME  8
-                0x98,0xbb,0x08, //     24 T1 ON, NOTE  59 VOLUME  8
-                0x98,0xb9,0x08, //     24 T1 ON, NOTE  57 VOLUME  8
-                0x98,0xbe,0x08, //     24 T1 ON, NOTE  62 VOLUME  8
-                0x98,0xbd,0x08, //     24 T1 ON, NOTE  61 VOLUME  8
-                0x98,0xbb,0x08, //     24 T1 ON, NOTE  59 VOLUME  8
-                0x98,0xb9,0x08, //     24 T1 ON, NOTE  57 VOLUME  8
-                0x98,0xb7,0x08, //     24 T1 ON, NOTE  55 VOLUME  8
-                0x98,0xb6,0x08, //     24 T1 ON, NOTE  54 VOLUME  8
-                0x98,0xb4,0x08, //     24 T1 ON, NOTE  52 VOLUME  8
-                0x98,0xb2,0x08, //     24 T1 ON, NOTE  50 VOLUME  8
-                0x98,0xc9,0x08, //     24 T1 ON, NOTE  73 VOLUME  8
-                0x98,0xb1,0x08, //     24 T1 ON, NOTE  49 VOLUME  8
-                0x98,0xb4,0x08, //     24 T1 ON, NOTE  52 VOLUME  8
-                0x98,0xb9,0x08, //     24 T1 ON, NOTE  57 VOLUME  8
-                0x98,0xad,0x08, //     24 T1 ON, NOTE  45 VOLUME  8
-                0x98,0xb1,0x08, //     24 T1 ON, NOTE  49 VOLUME  8
-                0x98,0xcf,0x08, //     24 T1 ON, NOTE  79 VOLUME  8
-                0x98,0xb9,0x08, //     24 T1 ON, NOTE  57 VOLUME  8
-                0x98,0xce,0x08, //     24 T1 ON, NOTE  78 VOLUME  8
-                0x98,0xb2,0x08, //     24 T1 ON, NOTE  50 VOLUME  8
-                0x98,0xb6,0x08, //     24 T1 ON, NOTE  54 VOLUME  8
-                0x98,0xb9,0x08, //     24 T1 ON, NOTE  57 VOLUME  8
-                0x98,0xad,0x08, //     24 T1 ON, NOTE  45 VOLUME  8
-                0x98,0xb2,0x08, //     24 T1 ON, NOTE  50 VOLUME  8
-                0x98,0xca,0x05, //     24 T1 ON, NOTE  74 VOLUME  5
-                0x98,0xb9,0x08, //     24 T1 ON, NOTE  57 VOLUME  8
-                0x98,0xc9,0x08, //     24 T1 ON, NOTE  73 VOLUME  8
-                0x98,0xb1,0x08, //     24 T1 ON, NOTE  49 VOLUME  8
-                0x98,0xb4,0x08, //     24 T1 ON, NOTE  52 VOLUME  8
-                0x98,0xb9,0x08, //     24 T1 ON, NOTE  57 VOLUME  8
-                0x98,0xad,0x08, //     24 T1 ON, NOTE  45 VOLUME  8
-                0x98,0xb1,0x08, //     24 T1 ON, NOTE  49 VOLUME  8
-                0x98,0xcf,0x08, //     24 T1 ON, NOTE  79 VOLUME  8
-                0x98,0xb9,0x08, //     24 T1 ON, NOTE  57 VOLUME  8
-                0x98,0xce,0x08, //     24 T1 ON, NOTE  78 VOLUME  8
-                0x98,0xb2,0x08, //     24 T1 ON, NOTE  50 VOLUME  8
-                0x98,0xb6,0x08, //     24 T1 ON, NOTE  54 VOLUME  8
-                0x98,0xb9,0x08, //     24 T1 ON, NOTE  57 VOLUME  8
-                0x98,0xad,0x08, //     24 T1 ON, NOTE  45 VOLUME  8
-                0x98,0xb2,0x08, //     24 T1 ON, NOTE  50 VOLUME  8
-                0x98,0xca,0x05, //     24 T1 ON, NOTE  74 VOLUME  5
-                0x98,0xb9,0x08, //     24 T1 ON, NOTE  57 VOLUME  8
-                0x98,0xc9,0x08, //     24 T1 ON, NOTE  73 VOLUME  8
-                0x98,0xb1,0x08, //     24 T1 ON, NOTE  49 VOLUME  8
-                0x98,0xcc,0x08, //     24 T1 ON, NOTE  76 VOLUME  8
-                0x98,0xb9,0x08, //     24 T1 ON, NOTE  57 VOLUME  8
-                0x98,0xce,0x08, //     24 T1 ON, NOTE  78 VOLUME  8
-                0x98,0xb2,0x08, //     24 T1 ON, NOTE  50 VOLUME  8
-                0x98,0xce,0x08, //     24 T1 ON, NOTE  78 VOLUME  8
-                0x98,0xb9,0x08, //     24 T1 ON, NOTE  57 VOLUME  8
-                0x98,0xcc,0x08, //     24 T1 ON, NOTE  76 VOLUME  8
-                0x98,0xb1,0x08, //     24 T1 ON, NOTE  49 VOLUME  8
-                0x98,0xcc,0x08, //     24 T1 ON, NOTE  76 VOLUME  8
-                0x98,0xb9,0x08, //     24 T1 ON, NOTE  57 VOLUME  8
-                0x98,0xce,0x08, //     24 T1 ON, NOTE  78 VOLUME  8
-                0x98,0xb2,0x08, //     24 T1 ON, NOTE  50 VOLUME  8
-                0x98,0xce,0x08, //     24 T1 ON, NOTE  78 VOLUME  8
-                0x98,0xb9,0x08, //     24 T1 ON, NOTE  57 VOLUME  8
-                0x98,0xad,0x08, //     24 T1 ON, NOTE  45 VOLUME  8
-                0x02,0xa0,0x01, //    288 BOTH OFF
-                0xe0,0xc5,0x05, //     96 T1 ON, NOTE  69 VOLUME  5
-                0x98,0xc9,0x05, //     24 T1 ON, NOTE  73 VOLUME  5
-                0x98,0xc5,0x05, //     24 T1 ON, NOTE  69 VOLUME  5
-                0x98,0xc9,0x05, //     24 T1 ON, NOTE  73 VOLUME  5
-                0x98,0xc5,0x05, //     24 T1 ON, NOTE  69 VOLUME  5
-                0x98,0xc9,0x05, //     24 T1 ON, NOTE  73 VOLUME  5
-                0x98,0xc4,0x05, //     24 T1 ON, NOTE  68 VOLUME  5
-                0x98,0xc7,0x05, //     24 T1 ON, NOTE  71 VOLUME  5
-                0x98,0xc5,0x05, //     24 T1 ON, NOTE  69 VOLUME  5
-                0x98,0xc9,0x05, //     24 T1 ON, NOTE  73 VOLUME  5
-                0x98,0xc5,0x05, //     24 T1 ON, NOTE  69 VOLUME  5
-                0x98,0xc9,0x05, //     24 T1 ON, NOTE  73 VOLUME  5
-                0x98,0xc5,0x05, //     24 T1 ON, NOTE  69 VOLUME  5
-                0x98,0xc9,0x05, //     24 T1 ON, NOTE  73 VOLUME  5
-                0x98,0xc4,0x05, //     24 T1 ON, NOTE  68 VOLUME  5
-                0x98,0xc7,0x05, //     24 T1 ON, NOTE  71 VOLUME  5
-                0x98,0xc2,0x05, //     24 T1 ON, NOTE  66 VOLUME  5
-                0x98,0xc5,0x05, //     24 T1 ON, NOTE  69 VOLUME  5
-                0x98,0xc2,0x05, //     24 T1 ON, NOTE  66 VOLUME  5
-                0x98,0xc5,0x05, //     24 T1 ON, NOTE  69 VOLUME  5
-                0x98,0xc2,0x05, //     24 T1 ON, NOTE  66 VOLUME  5
-                0x98,0xc5,0x05, //     24 T1 ON, NOTE  69 VOLUME  5
-                0x98,0xc0,0x05, //     24 T1 ON, NOTE  64 VOLUME  5
-                0x98,0xc4,0x05, //     24 T1 ON, NOTE  68 VOLUME  5
-                0x98,0xc2,0x05, //     24 T1 ON, NOTE  66 VOLUME  5
-                0x98,0xc5,0x05, //     24 T1 ON, NOTE  69 VOLUME  5
-                0x98,0xc2,0x05, //     24 T1 ON, NOTE  66 VOLUME  5
-                0x98,0xc5,0x05, //     24 T1 ON, NOTE  69 VOLUME  5
-                0x98,0xc2,0x05, //     24 T1 ON, NOTE  66 VOLUME  5
-                0x98,0xc5,0x05, //     24 T1 ON, NOTE  69 VOLUME  5
-                0x98,0xc0,0x05, //     24 T1 ON, NOTE  64 VOLUME  5
-                0x98,0xc4,0x05, //     24 T1 ON, NOTE  68 VOLUME  5
-                0x98,0xbe,0x05, //     24 T1 ON, NOTE  62 VOLUME  5
-                0x86,0xd0,0x08, //      6 T1 ON, NOTE  80 VOLUME  8
-                0x86,0xd1,0x08, //      6 T1 ON, NOTE  81 VOLUME  8
-                0x8c,0xc2,0x05, //     12 T1 ON, NOTE  66 VOLUME  5
-                0x98,0xbe,0x05, //     24 T1 ON, NOTE  62 VOLUME  5
-                0x98,0xc2,0x05, //     24 T1 ON, NOTE  66 VOLUME  5
-                0x98,0xbe,0x05, //     24 T1 ON, NOTE  62 VOLUME  5
-                0x98,0xc2,0x05, //     24 T1 ON, NOTE  66 VOLUME  5
-                0x98,0xbd,0x05, //     24 T1 ON, NOTE  61 VOLUME  5
-                0x98,0xc0,0x05, //     24 T1 ON, NOTE  64 VOLUME  5
-                0x98,0xbe,0x05, //     24 T1 ON, NOTE  62 VOLUME  5
-                0x86,0xd0,0x08, //      6 T1 ON, NOTE  80 VOLUME  8
-                0x86,0xd1,0x08, //      6 T1 ON, NOTE  81 VOLUME  8
-                0x8c,0xc2,0x05, //     12 T1 ON, NOTE  66 VOLUME  5
-                0x98,0xbe,0x05, //     24 T1 ON, NOTE  62 VOLUME  5
-                0x98,0xc2,0x05, //     24 T1 ON, NOTE  66 VOLUME  5
-                0x98,0xbe,0x05, //     24 T1 ON, NOTE  62 VOLUME  5
-                0x98,0xc2,0x05, //     24 T1 ON, NOTE  66 VOLUME  5
-                0x98,0xbd,0x05, //     24 T1 ON, NOTE  61 VOLUME  5
-                0x98,0xc0,0x05, //     24 T1 ON, NOTE  64 VOLUME  5
-                0x98,0xc2,0x08, //     24 T1 ON, NOTE  66 VOLUME  8
-                0x98,0xcc,0x08, //     24 T1 ON, NOTE  76 VOLUME  8
-                0x98,0xce,0x08, //     24 T1 ON, NOTE  78 VOLUME  8
-                0x98,0xcc,0x08, //     24 T1 ON, NOTE  76 VOLUME  8
-                0x98,0xca,0x08, //     24 T1 ON, NOTE  74 VOLUME  8
-                0x98,0xc9,0x08, //     24 T1 ON, NOTE  73 VOLUME  8
-                0x98,0xc7,0x08, //     24 T1 ON, NOTE  71 VOLUME  8
-                0x98,0xc5,0x08, //     24 T1 ON, NOTE  69 VOLUME  8
-                0x98,0xb4,0x08, //     24 T1 ON, NOTE  52 VOLUME  8
-                0x98,0xd1,0x08, //     24 T1 ON, NOTE  81 VOLUME  8
-                0x98,0xd3,0x08, //     24 T1 ON, NOTE  83 VOLUME  8
-                0x98,0xd1,0x08, //     24 T1 ON, NOTE  81 VOLUME  8
-                0x98,0xd0,0x08, //     24 T1 ON, NOTE  80 VOLUME  8
-                0x98,0xce,0x08, //     24 T1 ON, NOTE  78 VOLUME  8
-                0x98,0xcc,0x08, //     24 T1 ON, NOTE  76 VOLUME  8
-                0x98,0xca,0x08, //     24 T1 ON, NOTE  74 VOLUME  8
-                0x98,0xc5,0x05, //     24 T1 ON, NOTE  69 VOLUME  5
-                0x98,0xc9,0x05, //     24 T1 ON, NOTE  73 VOLUME  5
-                0x98,0xc5,0x05, //     24 T1 ON, NOTE  69 VOLUME  5
-                0x98,0xc9,0x05, //     24 T1 ON, NOTE  73 VOLUME  5
-                0x98,0xc5,0x05, //     24 T1 ON, NOTE  69 VOLUME  5
-                0x98,0xc9,0x05, //     24 T1 ON, NOTE  73 VOLUME  5
-                0x98,0xc4,0x05, //     24 T1 ON, NOTE  68 VOLUME  5
-                0x98,0xc7,0x05, //     24 T1 ON, NOTE  71 VOLUME  5
-                0x98,0xc5,0x05, //     24 T1 ON, NOTE  69 VOLUME  5
-                0x98,0xc9,0x05, //     24 T1 ON, NOTE  73 VOLUME  5
-                0x98,0xc5,0x05, //     24 T1 ON, NOTE  69 VOLUME  5
-                0x98,0xc9,0x05, //     24 T1 ON, NOTE  73 VOLUME  5
-                0x98,0xc5,0x05, //     24 T1 ON, NOTE  69 VOLUME  5
-                0x98,0xc9,0x05, //     24 T1 ON, NOTE  73 VOLUME  5
-                0x98,0xc4,0x05, //     24 T1 ON, NOTE  68 VOLUME  5
-                0x98,0xc7,0x05, //     24 T1 ON, NOTE  71 VOLUME  5
-                0x98,0xc2,0x05, //     24 T1 ON, NOTE  66 VOLUME  5
-                0x98,0xc5,0x05, //     24 T1 ON, NOTE  69 VOLUME  5
-                0x98,0xc2,0x05, //     24 T1 ON, NOTE  66 VOLUME  5
-                0x98,0xc5,0x05, //     24 T1 ON, NOTE  69 VOLUME  5
-                0x98,0xc2,0x05, //     24 T1 ON, NOTE  66 VOLUME  5
-                0x98,0xc5,0x05, //     24 T1 ON, NOTE  69 VOLUME  5
-                0x98,0xc0,0x05, //     24 T1 ON, NOTE  64 VOLUME  5
-                0x98,0xc4,0x05, //     24 T1 ON, NOTE  68 VOLUME  5
-                0x98,0xc2,0x05, //     24 T1 ON, NOTE  66 VOLUME  5
-                0x98,0xc5,0x05, //     24 T1 ON, NOTE  69 VOLUME  5
-                0x98,0xc2,0x05, //     24 T1 ON, NOTE  66 VOLUME  5
-                0x98,0xc5,0x05, //     24 T1 ON, NOTE  69 VOLUME  5
-                0x98,0xc2,0x05, //     24 T1 ON, NOTE  66 VOLUME  5
-                0x98,0xc5,0x05, //     24 T1 ON, NOTE  69 VOLUME  5
-                0x98,0xc0,0x05, //     24 T1 ON, NOTE  64 VOLUME  5
-                0x98,0xc4,0x05, //     24 T1 ON, NOTE  68 VOLUME  5
-                0x98,0xbe,0x05, //     24 T1 ON, NOTE  62 VOLUME  5
-                0x86,0xd0,0x08, //      6 T1 ON, NOTE  80 VOLUME  8
-                0x86,0xd1,0x08, //      6 T1 ON, NOTE  81 VOLUME  8
-                0x8c,0xc2,0x05, //     12 T1 ON, NOTE  66 VOLUME  5
-                0x98,0xbe,0x05, //     24 T1 ON, NOTE  62 VOLUME  5
-                0x98,0xc2,0x05, //     24 T1 ON, NOTE  66 VOLUME  5
-                0x98,0xbe,0x05, //     24 T1 ON, NOTE  62 VOLUME  5
-                0x98,0xc2,0x05, //     24 T1 ON, NOTE  66 VOLUME  5
-                0x98,0xbd,0x05, //     24 T1 ON, NOTE  61 VOLUME  5
-                0x98,0xc0,0x05, //     24 T1 ON, NOTE  64 VOLUME  5
-                0x98,0xbe,0x05, //     24 T1 ON, NOTE  62 VOLUME  5
-                0x86,0xd0,0x08, //      6 T1 ON, NOTE  80 VOLUME  8
-                0x86,0xd1,0x08, //      6 T1 ON, NOTE  81 VOLUME  8
-                0x8c,0xc2,0x05, //     12 T1 ON, NOTE  66 VOLUME  5
-                0x98,0xbe,0x05, //     24 T1 ON, NOTE  62 VOLUME  5
-                0x98,0xc2,0x05, //     24 T1 ON, NOTE  66 VOLUME  5
-                0x98,0xbe,0x05, //     24 T1 ON, NOTE  62 VOLUME  5
-                0x98,0xc2,0x05, //     24 T1 ON, NOTE  66 VOLUME  5
-                0x98,0xbd,0x05, //     24 T1 ON, NOTE  61 VOLUME  5
-                0x98,0xc0,0x05, //     24 T1 ON, NOTE  64 VOLUME  5
-                0x98,0xc2,0x08, //     24 T1 ON, NOTE  66 VOLUME  8
-                0x98,0xcc,0x08, //     24 T1 ON, NOTE  76 VOLUME  8
-                0x98,0xce,0x08, //     24 T1 ON, NOTE  78 VOLUME  8
-                0x98,0xcc,0x08, //     24 T1 ON, NOTE  76 VOLUME  8
-                0x98,0xca,0x08, //     24 T1 ON, NOTE  74 VOLUME  8
-                0x98,0xc9,0x08, //     24 T1 ON, NOTE  73 VOLUME  8
-                0x98,0xc7,0x08, //     24 T1 ON, NOTE  71 VOLUME  8
-                0x98,0xc5,0x08, //     24 T1 ON, NOTE  69 VOLUME  8
-                0x98,0xb4,0x08, //     24 T1 ON, NOTE  52 VOLUME  8
-                0x98,0xd1,0x08, //     24 T1 ON, NOTE  81 VOLUME  8
-                0x98,0xd3,0x08, //     24 T1 ON, NOTE  83 VOLUME  8
-                0x98,0xd1,0x08, //     24 T1 ON, NOTE  81 VOLUME  8
-                0x98,0xd0,0x08, //     24 T1 ON, NOTE  80 VOLUME  8
-                0x98,0xce,0x08, //     24 T1 ON, NOTE  78 VOLUME  8
-                0x98,0xcc,0x08, //     24 T1 ON, NOTE  76 VOLUME  8
-                0x98,0xca,0x08, //     24 T1 ON, NOTE  74 VOLUME  8
-                0x98,0xb9,0x08, //     24 T1 ON, NOTE  57 VOLUME  8
-                0x98,0xbd,0x08, //     24 T1 ON, NOTE  61 VOLUME  8
-                0x98,0xb9,0x08, //     24 T1 ON, NOTE  57 VOLUME  8
-                0x98,0xbd,0x08, //     24 T1 ON, NOTE  61 VOLUME  8
-                0x98,0xc9,0x08, //     24 T1 ON, NOTE  73 VOLUME  8
-                0x98,0xbd,0x08, //     24 T1 ON, NOTE  61 VOLUME  8
-                0x98,0xb9,0x08, //     24 T1 ON, NOTE  57 VOLUME  8
-                0x98,0xbd,0x08, //     24 T1 ON, NOTE  61 VOLUME  8
-                0x98,0xb9,0x08, //     24 T1 ON, NOTE  57 VOLUME  8
-                0x98,0xbc,0x08, //     24 T1 ON, NOTE  60 VOLUME  8
-                0x98,0xb9,0x08, //     24 T1 ON, NOTE  57 VOLUME  8
-                0x98,0xbc,0x08, //     24 T1 ON, NOTE  60 VOLUME  8
-                0x98,0xb9,0x08, //     24 T1 ON, NOTE  57 VOLUME  8
-                0x98,0xbc,0x08, //     24 T1 ON, NOTE  60 VOLUME  8
-                0x98,0xb9,0x08, //     24 T1 ON, NOTE  57 VOLUME  8
-                0x98,0xbc,0x08, //     24 T1 ON, NOTE  60 VOLUME  8
-                0x98,0xb9,0x08, //     24 T1 ON, NOTE  57 VOLUME  8
-                0x98,0xbb,0x08, //     24 T1 ON, NOTE  59 VOLUME  8
-                0x98,0xb9,0x08, //     24 T1 ON, NOTE  57 VOLUME  8
-                0x98,0xbb,0x08, //     24 T1 ON, NOTE  59 VOLUME  8
-                0x98,0xc7,0x08, //     24 T1 ON, NOTE  71 VOLUME  8
-                0x98,0xbb,0x08, //     24 T1 ON, NOTE  59 VOLUME  8
-                0x98,0xb7,0x08, //     24 T1 ON, NOTE  55 VOLUME  8
-                0x98,0xbb,0x08, //     24 T1 ON, NOTE  59 VOLUME  8
-                0x98,0xb7,0x08, //     24 T1 ON, NOTE  55 VOLUME  8
-                0x98,0xba,0x08, //     24 T1 ON, NOTE  58 VOLUME  8
-                0x98,0xb7,0x08, //     24 T1 ON, NOTE  55 VOLUME  8
-                0x98,0xba,0x08, //     24 T1 ON, NOTE  58 VOLUME  8
-                0x98,0xb7,0x08, //     24 T1 ON, NOTE  55 VOLUME  8
-                0x98,0xba,0x08, //     24 T1 ON, NOTE  58 VOLUME  8
-                0x98,0xb7,0x08, //     24 T1 ON, NOTE  55 VOLUME  8
-                0x98,0xba,0x08, //     24 T1 ON, NOTE  58 VOLUME  8
-                0x98,0xb7,0x08, //     24 T1 ON, NOTE  55 VOLUME  8
-                0x98,0xb9,0x08, //     24 T1 ON, NOTE  57 VOLUME  8
-                0x98,0xb7,0x08, //     24 T1 ON, NOTE  55 VOLUME  8
-                0x98,0xb9,0x08, //     24 T1 ON, NOTE  57 VOLUME  8
-                0x98,0xc5,0x08, //     24 T1 ON, NOTE  69 VOLUME  8
-                0x98,0xb9,0x08, //     24 T1 ON, NOTE  57 VOLUME  8
-                0x98,0xb5,0x08, //     24 T1 ON, NOTE  53 VOLUME  8
-                0x98,0xb9,0x08, //     24 T1 ON, NOTE  57 VOLUME  8
-                0x98,0xb5,0x08, //     24 T1 ON, NOTE  53 VOLUME  8
-                0x98,0xb9,0x08, //     24 T1 ON, NOTE  57 VOLUME  8
-                0x98,0xb5,0x08, //     24 T1 ON, NOTE  53 VOLUME  8
-                0x98,0xb9,0x08, //     24 T1 ON, NOTE  57 VOLUME  8
-                0x98,0xb5,0x08, //     24 T1 ON, NOTE  53 VOLUME  8
-                0x98,0xb9,0x08, //     24 T1 ON, NOTE  57 VOLUME  8
-                0x98,0xb5,0x08, //     24 T1 ON, NOTE  53 VOLUME  8
-                0x98,0xb9,0x08, //     24 T1 ON, NOTE  57 VOLUME  8
-                0x98,0xb4,0x08, //     24 T1 ON, NOTE  52 VOLUME  8
-                0x98,0xbe,0x08, //     24 T1 ON, NOTE  62 VOLUME  8
-                0x98,0xb4,0x08, //     24 T1 ON, NOTE  52 VOLUME  8
-                0x98,0xbe,0x08, //     24 T1 ON, NOTE  62 VOLUME  8
-                0x98,0xb4,0x08, //     24 T1 ON, NOTE  52 VOLUME  8
-                0x98,0xbe,0x08, //     24 T1 ON, NOTE  62 VOLUME  8
-                0x98,0xb4,0x08, //     24 T1 ON, NOTE  52 VOLUME  8
-                0x98,0xbe,0x08, //     24 T1 ON, NOTE  62 VOLUME  8
-                0x98,0xb4,0x08, //     24 T1 ON, NOTE  52 VOLUME  8
-                0x98,0xbd,0x08, //     24 T1 ON, NOTE  61 VOLUME  8
-                0x98,0xb4,0x08, //     24 T1 ON, NOTE  52 VOLUME  8
-                0x98,0xbd,0x08, //     24 T1 ON, NOTE  61 VOLUME  8
-                0x98,0xb4,0x08, //     24 T1 ON, NOTE  52 VOLUME  8
-                0x98,0xbd,0x08, //     24 T1 ON, NOTE  61 VOLUME  8
-                0x98,0xb4,0x08, //     24 T1 ON, NOTE  52 VOLUME  8
-                0x98,0xbd,0x08, //     24 T1 ON, NOTE  61 VOLUME  8
-                0x98,0xb4,0x08, //     24 T1 ON, NOTE  52 VOLUME  8
-                0x98,0xbe,0x08, //     24 T1 ON, NOTE  62 VOLUME  8
-                0x98,0xb4,0x08, //     24 T1 ON, NOTE  52 VOLUME  8
-                0x98,0xbe,0x08, //     24 T1 ON, NOTE  62 VOLUME  8
-                0x98,0xb4,0x08, //     24 T1 ON, NOTE  52 VOLUME  8
-                0x98,0xbe,0x08, //     24 T1 ON, NOTE  62 VOLUME  8
-                0x98,0xb4,0x08, //     24 T1 ON, NOTE  52 VOLUME  8
-                0x98,0xbe,0x08, //     24 T1 ON, NOTE  62 VOLUME  8
-                0x98,0xb4,0x08, //     24 T1 ON, NOTE  52 VOLUME  8
-                0x98,0xbd,0x08, //     24 T1 ON, NOTE  61 VOLUME  8
-                0x98,0xb4,0x08, //     24 T1 ON, NOTE  52 VOLUME  8
-                0x98,0xbd,0x08, //     24 T1 ON, NOTE  61 VOLUME  8
-                0x98,0xb4,0x08, //     24 T1 ON, NOTE  52 VOLUME  8
-                0x98,0xbb,0x08, //     24 T1 ON, NOTE  59 VOLUME  8
-                0x98,0xb4,0x08, //     24 T1 ON, NOTE  52 VOLUME  8
-                0x98,0xbb,0x08, //     24 T1 ON, NOTE  59 VOLUME  8
-                0x98,0xad,0x08, //     24 T1 ON, NOTE  45 VOLUME  8
-                0x98,0xc9,0x08, //     24 T1 ON, NOTE  73 VOLUME  8
-                0x98,0xd1,0x05, //     24 T1 ON, NOTE  81 VOLUME  5
-                0x98,0xc9,0x08, //     24 T1 ON, NOTE  73 VOLUME  8
-                0x98,0xd1,0x05, //     24 T1 ON, NOTE  81 VOLUME  5
-                0x98,0xc9,0x08, //     24 T1 ON, NOTE  73 VOLUME  8
-                0x98,0xad,0x08, //     24 T1 ON, NOTE  45 VOLUME  8
-                0x98,0xc9,0x08, //     24 T1 ON, NOTE  73 VOLUME  8
-                0x98,0xaf,0x08, //     24 T1 ON, NOTE  47 VOLUME  8
-                0x98,0xc9,0x08, //     24 T1 ON, NOTE  73 VOLUME  8
-                0x98,0xb1,0x08, //     24 T1 ON, NOTE  49 VOLUME  8
-                0x98,0xc9,0x08, //     24 T1 ON, NOTE  73 VOLUME  8
-                0x98,0xb2,0x08, //     24 T1 ON, NOTE  50 VOLUME  8
-                0x98,0xc9,0x08, //     24 T1 ON, NOTE  73 VOLUME  8
-                0x98,0xb3,0x08, //     24 T1 ON, NOTE  51 VOLUME  8
-                0x98,0xc9,0x08, //     24 T1 ON, NOTE  73 VOLUME  8
-                0x98,0xb6,0x08, //     24 T1 ON, NOTE  54 VOLUME  8
-                0x98,0xc9,0x08, //     24 T1 ON, NOTE  73 VOLUME  8
-                0x98,0xb4,0x08, //     24 T1 ON, NOTE  52 VOLUME  8
-                0x98,0xc9,0x08, //     24 T1 ON, NOTE  73 VOLUME  8
-                0x98,0xd1,0x05, //     24 T1 ON, NOTE  81 VOLUME  5
-                0x98,0xc9,0x08, //     24 T1 ON, NOTE  73 VOLUME  8
-                0x98,0xad,0x08, //     24 T1 ON, NOTE  45 VOLUME  8
-                0x98,0xc9,0x08, //     24 T1 ON, NOTE  73 VOLUME  8
-                0x98,0xaf,0x08, //     24 T1 ON, NOTE  47 VOLUME  8
-                0x98,0xc9,0x08, //     24 T1 ON, NOTE  73 VOLUME  8
-                0x98,0xb1,0x08, //     24 T1 ON, NOTE  49 VOLUME  8
-                0x98,0xc9,0x08, //     24 T1 ON, NOTE  73 VOLUME  8
-                0x98,0xb2,0x08, //     24 T1 ON, NOTE  50 VOLUME  8
-                0x98,0xc9,0x08, //     24 T1 ON, NOTE  73 VOLUME  8
-                0x98,0xb3,0x08, //     24 T1 ON, NOTE  51 VOLUME  8
-                0x98,0xc9,0x08, //     24 T1 ON, NOTE  73 VOLUME  8
-                0x98,0xb6,0x08, //     24 T1 ON, NOTE  54 VOLUME  8
-                0x98,0xc9,0x08, //     24 T1 ON, NOTE  73 VOLUME  8
-                0x98,0xb4,0x08, //     24 T1 ON, NOTE  52 VOLUME  8
-                0x98,0xc9,0x08, //     24 T1 ON, NOTE  73 VOLUME  8
-                0x98,0xd1,0x05, //     24 T1 ON, NOTE  81 VOLUME  5
-                0x98,0xc9,0x08, //     24 T1 ON, NOTE  73 VOLUME  8
-                0x98,0xad,0x08, //     24 T1 ON, NOTE  45 VOLUME  8
-                0x98,0xc9,0x08, //     24 T1 ON, NOTE  73 VOLUME  8
-                0x98,0xaf,0x08, //     24 T1 ON, NOTE  47 VOLUME  8
-                0x98,0xc9,0x08, //     24 T1 ON, NOTE  73 VOLUME  8
-                0x98,0xb1,0x08, //     24 T1 ON, NOTE  49 VOLUME  8
-                0x98,0xc9,0x08, //     24 T1 ON, NOTE  73 VOLUME  8
-                0x98,0xb2,0x08, //     24 T1 ON, NOTE  50 VOLUME  8
-                0x98,0xc9,0x08, //     24 T1 ON, NOTE  73 VOLUME  8
-                0x98,0xb4,0x08, //     24 T1 ON, NOTE  52 VOLUME  8
-                0x98,0xc9,0x08, //     24 T1 ON, NOTE  73 VOLUME  8
-                0x98,0xb5,0x08, //     24 T1 ON, NOTE  53 VOLUME  8
-                0x98,0xc8,0x08, //     24 T1 ON, NOTE  72 VOLUME  8
-                0x98,0xd1,0x05, //     24 T1 ON, NOTE  81 VOLUME  5
-                0x98,0xc8,0x08, //     24 T1 ON, NOTE  72 VOLUME  8
-                0x98,0xb4,0x08, //     24 T1 ON, NOTE  52 VOLUME  8
-                0x98,0xc8,0x08, //     24 T1 ON, NOTE  72 VOLUME  8
-                0x98,0xd1,0x05, //     24 T1 ON, NOTE  81 VOLUME  5
-                0x98,0xc8,0x08, //     24 T1 ON, NOTE  72 VOLUME  8
-                0x98,0xb3,0x08, //     24 T1 ON, NOTE  51 VOLUME  8
-                0x98,0xce,0x08, //     24 T1 ON, NOTE  78 VOLUME  8
-                0x98,0xd1,0x05, //     24 T1 ON, NOTE  81 VOLUME  5
-                0x98,0xce,0x08, //     24 T1 ON, NOTE  78 VOLUME  8
-                0x98,0xb2,0x08, //     24 T1 ON, NOTE  50 VOLUME  8
-                0x98,0xcc,0x08, //     24 T1 ON, NOTE  76 VOLUME  8
-                0x98,0xd0,0x05, //     24 T1 ON, NOTE  80 VOLUME  5
-                0x98,0xcc,0x08, //     24 T1 ON, NOTE  76 VOLUME  8
-                0x98,0xb1,0x08, //     24 T1 ON, NOTE  49 VOLUME  8
-                0x98,0xcc,0x08, //     24 T1 ON, NOTE  76 VOLUME  8
-                0x98,0xb1,0x08, //     24 T1 ON, NOTE  49 VOLUME  8
-                0x98,0xcc,0x08, //     24 T1 ON, NOTE  76 VOLUME  8
-                0x98,0xb2,0x08, //     24 T1 ON, NOTE  50 VOLUME  8
-                0x98,0xca,0x08, //     24 T1 ON, NOTE  74 VOLUME  8
-                0x98,0xb2,0x08, //     24 T1 ON, NOTE  50 VOLUME  8
-                0x98,0xca,0x08, //     24 T1 ON, NOTE  74 VOLUME  8
-                0x98,0xb4,0x08, //     24 T1 ON, NOTE  52 VOLUME  8
-                0x98,0xc9,0x08, //     24 T1 ON, NOTE  73 VOLUME  8
-                0x98,0xb4,0x08, //     24 T1 ON, NOTE  52 VOLUME  8
-                0x98,0xc9,0x08, //     24 T1 ON, NOTE  73 VOLUME  8
-                0x98,0xa8,0x08, //     24 T1 ON, NOTE  40 VOLUME  8
-                0x98,0xc7,0x08, //     24 T1 ON, NOTE  71 VOLUME  8
-                0x98,0xa8,0x08, //     24 T1 ON, NOTE  40 VOLUME  8
-                0x98,0xc7,0x08, //     24 T1 ON, NOTE  71 VOLUME  8
-                0x98,0xad,0x08, //     24 T1 ON, NOTE  45 VOLUME  8
-                     0xb0,0x01, //     48 BOTH OFF
-                0xe0,0xb9,0x05, //     96 T1 ON, NOTE  57 VOLUME  5
-                0xb0,0xbb,0x05, //     48 T1 ON, NOTE  59 VOLUME  5
-                0xb0,0xbd,0x05, //     48 T1 ON, NOTE  61 VOLUME  5
-                0xb0,0xbe,0x05, //     48 T1 ON, NOTE  62 VOLUME  5
-                0xb0,0xbf,0x05, //     48 T1 ON, NOTE  63 VOLUME  5
-                0xb0,0xc2,0x05, //     48 T1 ON, NOTE  66 VOLUME  5
-                0xb0,0xbb,0x08, //     48 T1 ON, NOTE  59 VOLUME  8
-                0xb0,0xb9,0x08, //     48 T1 ON, NOTE  57 VOLUME  8
-                     0xb0,0x01, //     48 BOTH OFF
-                0xb0,0xbb,0x05, //     48 T1 ON, NOTE  59 VOLUME  5
-                0xb0,0xbd,0x05, //     48 T1 ON, NOTE  61 VOLUME  5
-                0xb0,0xbe,0x05, //     48 T1 ON, NOTE  62 VOLUME  5
-                0xb0,0xbf,0x05, //     48 T1 ON, NOTE  63 VOLUME  5
-                0xb0,0xc2,0x05, //     48 T1 ON, NOTE  66 VOLUME  5
-                0xb0,0xbb,0x08, //     48 T1 ON, NOTE  59 VOLUME  8
-                0xb0,0xb9,0x08, //     48 T1 ON, NOTE  57 VOLUME  8
-                     0xb0,0x01, //     48 BOTH OFF
-                0xb0,0xbb,0x05, //     48 T1 ON, NOTE  59 VOLUME  5
-                0xb0,0xbc,0x05, //     48 T1 ON, NOTE  60 VOLUME  5
-                0xb0,0xbe,0x05, //     48 T1 ON, NOTE  62 VOLUME  5
-                0xb0,0xc0,0x05, //     48 T1 ON, NOTE  64 VOLUME  5
-                0xb0,0xc1,0x05, //     48 T1 ON, NOTE  65 VOLUME  5
-           0x01,0x90,0xc7,0x05, //    144 T1 ON, NOTE  71 VOLUME  5
-                0xb0,0xc8,0x05, //     48 T1 ON, NOTE  72 VOLUME  5
-                0xb0,0xc9,0x05, //     48 T1 ON, NOTE  73 VOLUME  5
-                0xb0,0xca,0x08, //     48 T1 ON, NOTE  74 VOLUME  8
-                0xb0,0xc4,0x08, //     48 T1 ON, NOTE  68 VOLUME  8
-                0xb0,0xc3,0x08, //     48 T1 ON, NOTE  67 VOLUME  8
-                0xb0,0xc7,0x05, //     48 T1 ON, NOTE  71 VOLUME  5
-                0xb0,0xc8,0x05, //     48 T1 ON, NOTE  72 VOLUME  5
-                0xb0,0xc0,0x05, //     48 T1 ON, NOTE  64 VOLUME  5
-                0xb0,0xb2,0x08, //     48 T1 ON, NOTE  50 VOLUME  8
-                0xb0,0xc1,0x05, //     48 T1 ON, NOTE  65 VOLUME  5
-                0xb0,0xc6,0x05, //     48 T1 ON, NOTE  70 VOLUME  5
-                0xb0,0xbe,0x05, //     48 T1 ON, NOTE  62 VOLUME  5
-                0xb0,0xc4,0x05, //     48 T1 ON, NOTE  68 VOLUME  5
-                0xb0,0xc7,0x05, //     48 T1 ON, NOTE  71 VOLUME  5
-                0xb0,0xb5,0x08, //     48 T1 ON, NOTE  53 VOLUME  8
-                0xb0,0xc1,0x05, //     48 T1 ON, NOTE  65 VOLUME  5
-                0xb0,0xb2,0x08, //     48 T1 ON, NOTE  50 VOLUME  8
-                0x8c,0xc7,0x08, //     12 T1 ON, NOTE  71 VOLUME  8
-                0x8c,0xc5,0x08, //     12 T1 ON, NOTE  69 VOLUME  8
-                0x8c,0xc7,0x08, //     12 T1 ON, NOTE  71 VOLUME  8
-                0x8c,0xaf,0x08, //     12 T1 ON, NOTE  47 VOLUME  8
-                0x8c,0xc7,0x08, //     12 T1 ON, NOTE  71 VOLUME  8
-                0x8c,0xc5,0x08, //     12 T1 ON, NOTE  69 VOLUME  8
-                0x8c,0xc7,0x08, //     12 T1 ON, NOTE  71 VOLUME  8
-                0x8c,0xb4,0x08, //     12 T1 ON, NOTE  52 VOLUME  8
-                0x8c,0xc7,0x08, //     12 T1 ON, NOTE  71 VOLUME  8
-                0x8c,0xc5,0x08, //     12 T1 ON, NOTE  69 VOLUME  8
-                0x8c,0xc7,0x08, //     12 T1 ON, NOTE  71 VOLUME  8
-                0x8c,0xb4,0x08, //     12 T1 ON, NOTE  52 VOLUME  8
-                0x8c,0xc7,0x08, //     12 T1 ON, NOTE  71 VOLUME  8
-                0x8c,0xc5,0x08, //     12 T1 ON, NOTE  69 VOLUME  8
-                0x8c,0xc7,0x08, //     12 T1 ON, NOTE  71 VOLUME  8
-                0x8c,0xad,0x08, //     12 T1 ON, NOTE  45 VOLUME  8
-                0x98,0xb4,0x08, //     24 T1 ON, NOTE  52 VOLUME  8
-                0x98,0xb1,0x08, //     24 T1 ON, NOTE  49 VOLUME  8
-                0x98,0xb4,0x08, //     24 T1 ON, NOTE  52 VOLUME  8
-                0x98,0xb1,0x08, //     24 T1 ON, NOTE  49 VOLUME  8
-                0x98,0xb4,0x08, //     24 T1 ON, NOTE  52 VOLUME  8
-                0x98,0xaf,0x08, //     24 T1 ON, NOTE  47 VOLUME  8
-                0x98,0xb4,0x08, //     24 T1 ON, NOTE  52 VOLUME  8
-                0x98,0xad,0x08, //     24 T1 ON, NOTE  45 VOLUME  8
-                0x98,0xb4,0x08, //     24 T1 ON, NOTE  52 VOLUME  8
-                0x98,0xb1,0x08, //     24 T1 ON, NOTE  49 VOLUME  8
-                0x98,0xb4,0x08, //     24 T1 ON, NOTE  52 VOLUME  8
-                0x98,0xb1,0x08, //     24 T1 ON, NOTE  49 VOLUME  8
-                0x98,0xb4,0x08, //     24 T1 ON, NOTE  52 VOLUME  8
-                0x98,0xb1,0x08, //     24 T1 ON, NOTE  49 VOLUME  8
-                0x98,0xb4,0x08, //     24 T1 ON, NOTE  52 VOLUME  8
-                0x98,0xad,0x08, //     24 T1 ON, NOTE  45 VOLUME  8
-                0x98,0xb4,0x08, //     24 T1 ON, NOTE  52 VOLUME  8
-                0x98,0xb2,0x08, //     24 T1 ON, NOTE  50 VOLUME  8
-                0x98,0xb4,0x08, //     24 T1 ON, NOTE  52 VOLUME  8
-                0x98,0xaf,0x08, //     24 T1 ON, NOTE  47 VOLUME  8
-                0x98,0xb2,0x08, //     24 T1 ON, NOTE  50 VOLUME  8
-                0x98,0xb1,0x08, //     24 T1 ON, NOTE  49 VOLUME  8
-                0x98,0xb2,0x08, //     24 T1 ON, NOTE  50 VOLUME  8
-                0x98,0xad,0x08, //     24 T1 ON, NOTE  45 VOLUME  8
-                0x98,0xb4,0x08, //     24 T1 ON, NOTE  52 VOLUME  8
-                0x98,0xb1,0x08, //     24 T1 ON, NOTE  49 VOLUME  8
-                0x98,0xb4,0x08, //     24 T1 ON, NOTE  52 VOLUME  8
-                0x98,0xb2,0x08, //     24 T1 ON, NOTE  50 VOLUME  8
-                0x98,0xb4,0x08, //     24 T1 ON, NOTE  52 VOLUME  8
-                0x98,0xb2,0x08, //     24 T1 ON, NOTE  50 VOLUME  8
-                0x98,0xb4,0x08, //     24 T1 ON, NOTE  52 VOLUME  8
-                0x98,0xad,0x08, //     24 T1 ON, NOTE  45 VOLUME  8
-                0x98,0xb4,0x08, //     24 T1 ON, NOTE  52 VOLUME  8
-                0x98,0xb1,0x08, //     24 T1 ON, NOTE  49 VOLUME  8
-                0x98,0xb4,0x08, //     24 T1 ON, NOTE  52 VOLUME  8
-                0x88,0xcc,0x08, //      8 T1 ON, NOTE  76 VOLUME  8
-                0x88,0xca,0x08, //      8 T1 ON, NOTE  74 VOLUME  8
-                0x88,0xb1,0x08, //      8 T1 ON, NOTE  49 VOLUME  8
-                0x98,0xb4,0x08, //     24 T1 ON, NOTE  52 VOLUME  8
-                0x98,0xb1,0x08, //     24 T1 ON, NOTE  49 VOLUME  8
-                0x98,0xb4,0x08, //     24 T1 ON, NOTE  52 VOLUME  8
-                0x98,0xb1,0x08, //     24 T1 ON, NOTE  49 VOLUME  8
-                0x98,0xb9,0x08, //     24 T1 ON, NOTE  57 VOLUME  8
-                0x98,0xb4,0x08, //     24 T1 ON, NOTE  52 VOLUME  8
-                0x98,0xb9,0x08, //     24 T1 ON, NOTE  57 VOLUME  8
-                0x98,0xb4,0x08, //     24 T1 ON, NOTE  52 VOLUME  8
-                0x98,0xb9,0x08, //     24 T1 ON, NOTE  57 VOLUME  8
-                0x98,0xb4,0x08, //     24 T1 ON, NOTE  52 VOLUME  8
-                0x98,0xb9,0x08, //     24 T1 ON, NOTE  57 VOLUME  8
-                0x98,0xb2,0x08, //     24 T1 ON, NOTE  50 VOLUME  8
-                0x98,0xbb,0x08, //     24 T1 ON, NOTE  59 VOLUME  8
-                0x98,0xb6,0x08, //     24 T1 ON, NOTE  54 VOLUME  8
-                0x98,0xbb,0x08, //     24 T1 ON, NOTE  59 VOLUME  8
-                0x98,0xb6,0x08, //     24 T1 ON, NOTE  54 VOLUME  8
-                0x98,0xbb,0x08, //     24 T1 ON, NOTE  59 VOLUME  8
-                0x98,0xb6,0x08, //     24 T1 ON, NOTE  54 VOLUME  8
-                0x98,0xbb,0x08, //     24 T1 ON, NOTE  59 VOLUME  8
-                0x98,0xb4,0x08, //     24 T1 ON, NOTE  52 VOLUME  8
-                0x98,0xbe,0x08, //     24 T1 ON, NOTE  62 VOLUME  8
-                0x98,0xbb,0x08, //     24 T1 ON, NOTE  59 VOLUME  8
-                0x98,0xbe,0x08, //     24 T1 ON, NOTE  62 VOLUME  8
-                0x98,0xbb,0x08, //     24 T1 ON, NOTE  59 VOLUME  8
-                0x98,0xbe,0x08, //     24 T1 ON, NOTE  62 VOLUME  8
-                0x98,0xbb,0x08, //     24 T1 ON, NOTE  59 VOLUME  8
-                0x98,0xbe,0x08, //     24 T1 ON, NOTE  62 VOLUME  8
-                0x98,0xad,0x08, //     24 T1 ON, NOTE  45 VOLUME  8
-                0x98,0xb9,0x08, //     24 T1 ON, NOTE  57 VOLUME  8
-                0x98,0xb4,0x08, //     24 T1 ON, NOTE  52 VOLUME  8
-                0x98,0xb9,0x08, //     24 T1 ON, NOTE  57 VOLUME  8
-                0x98,0xb4,0x08, //     24 T1 ON, NOTE  52 VOLUME  8
-                0x98,0xb9,0x08, //     24 T1 ON, NOTE  57 VOLUME  8
-                0x98,0xb4,0x08, //     24 T1 ON, NOTE  52 VOLUME  8
-                0x98,0xb9,0x08, //     24 T1 ON, NOTE  57 VOLUME  8
-                0xb0,0xc0,0x08, //     48 T1 ON, NOTE  64 VOLUME  8
-                0x98,0xbd,0x08, //     24 T1 ON, NOTE  61 VOLUME  8
-                0x98,0xc0,0x08, //     24 T1 ON, NOTE  64 VOLUME  8
-                0x98,0xbd,0x08, //     24 T1 ON, NOTE  61 VOLUME  8
-                0x98,0xc0,0x08, //     24 T1 ON, NOTE  64 VOLUME  8
-                0x98,0xc9,0x05, //     24 T1 ON, NOTE  73 VOLUME  5
-                0x98,0xc0,0x08, //     24 T1 ON, NOTE  64 VOLUME  8
-                0x98,0xb9,0x08, //     24 T1 ON, NOTE  57 VOLUME  8
-                0x98,0xc0,0x08, //     24 T1 ON, NOTE  64 VOLUME  8
-                0x98,0xbe,0x08, //     24 T1 ON, NOTE  62 VOLUME  8
-                0x98,0xc0,0x08, //     24 T1 ON, NOTE  64 VOLUME  8
-                0x98,0xbb,0x08, //     24 T1 ON, NOTE  59 VOLUME  8
-                0x98,0xbe,0x08, //     24 T1 ON, NOTE  62 VOLUME  8
-                0x98,0xbb,0x08, //     24 T1 ON, NOTE  59 VOLUME  8
-                0x98,0xbe,0x08, //     24 T1 ON, NOTE  62 VOLUME  8
-                0x98,0xb9,0x08, //     24 T1 ON, NOTE  57 VOLUME  8
-                0x98,0xc0,0x08, //     24 T1 ON, NOTE  64 VOLUME  8
-                0x98,0xcc,0x05, //     24 T1 ON, NOTE  76 VOLUME  5
-                0x98,0xc0,0x08, //     24 T1 ON, NOTE  64 VOLUME  8
-                0x98,0xcc,0x05, //     24 T1 ON, NOTE  76 VOLUME  5
-                0x98,0xc0,0x08, //     24 T1 ON, NOTE  64 VOLUME  8
-                0x98,0xcc,0x05, //     24 T1 ON, NOTE  76 VOLUME  5
-                0x98,0xc0,0x08, //     24 T1 ON, NOTE  64 VOLUME  8
-                0x98,0xb9,0x08, //     24 T1 ON, NOTE  57 VOLUME  8
-                0x98,0xc0,0x08, //     24 T1 ON, NOTE  64 VOLUME  8
-                0x98,0xbd,0x08, //     24 T1 ON, NOTE  61 VOLUME  8
-                0x98,0xc0,0x08, //     24 T1 ON, NOTE  64 VOLUME  8
-                0x88,0xd8,0x08, //      8 T1 ON, NOTE  88 VOLUME  8
-                0x88,0xd6,0x08, //      8 T1 ON, NOTE  86 VOLUME  8
-                0x88,0xbd,0x08, //      8 T1 ON, NOTE  61 VOLUME  8
-                0x98,0xc0,0x08, //     24 T1 ON, NOTE  64 VOLUME  8
-                0x98,0xbd,0x08, //     24 T1 ON, NOTE  61 VOLUME  8
-                0x98,0xc0,0x08, //     24 T1 ON, NOTE  64 VOLUME  8
-                0x98,0xb1,0x08, //     24 T1 ON, NOTE  49 VOLUME  8
-                0x98,0xb9,0x08, //     24 T1 ON, NOTE  57 VOLUME  8
-                0x98,0xb4,0x08, //     24 T1 ON, NOTE  52 VOLUME  8
-                0x98,0xb9,0x08, //     24 T1 ON, NOTE  57 VOLUME  8
-                0x98,0xb4,0x08, //     24 T1 ON, NOTE  52 VOLUME  8
-                0x98,0xb9,0x08, //     24 T1 ON, NOTE  57 VOLUME  8
-                0x98,0xb4,0x08, //     24 T1 ON, NOTE  52 VOLUME  8
-                0x98,0xb9,0x08, //     24 T1 ON, NOTE  57 VOLUME  8
-                0x98,0xb2,0x08, //     24 T1 ON, NOTE  50 VOLUME  8
-                0x98,0xbb,0x08, //     24 T1 ON, NOTE  59 VOLUME  8
-                0x98,0xb6,0x08, //     24 T1 ON, NOTE  54 VOLUME  8
-                0x98,0xbb,0x08, //     24 T1 ON, NOTE  59 VOLUME  8
-                0x98,0xb6,0x08, //     24 T1 ON, NOTE  54 VOLUME  8
-                0x98,0xbb,0x08, //     24 T1 ON, NOTE  59 VOLUME  8
-                0x98,0xb6,0x08, //     24 T1 ON, NOTE  54 VOLUME  8
-                0x98,0xbb,0x08, //     24 T1 ON, NOTE  59 VOLUME  8
-                0x98,0xb4,0x08, //     24 T1 ON, NOTE  52 VOLUME  8
-                0x98,0xbe,0x08, //     24 T1 ON, NOTE  62 VOLUME  8
-                0x98,0xbb,0x08, //     24 T1 ON, NOTE  59 VOLUME  8
-                0x98,0xbe,0x08, //     24 T1 ON, NOTE  62 VOLUME  8
-                0x98,0xbb,0x08, //     24 T1 ON, NOTE  59 VOLUME  8
-                0x98,0xbe,0x08, //     24 T1 ON, NOTE  62 VOLUME  8
-                0x98,0xbb,0x08, //     24 T1 ON, NOTE  59 VOLUME  8
-                0x98,0xbe,0x08, //     24 T1 ON, NOTE  62 VOLUME  8
-                0x98,0xb9,0x08, //     24 T1 ON, NOTE  57 VOLUME  8
-                0x98,0xc0,0x08, //     24 T1 ON, NOTE  64 VOLUME  8
-                0x98,0xb9,0x08, //     24 T1 ON, NOTE  57 VOLUME  8
-                0x98,0xc0,0x08, //     24 T1 ON, NOTE  64 VOLUME  8
-                0x98,0xb9,0x08, //     24 T1 ON, NOTE  57 VOLUME  8
-                0x98,0xc0,0x08, //     24 T1 ON, NOTE  64 VOLUME  8
-                0x98,0xb9,0x08, //     24 T1 ON, NOTE  57 VOLUME  8
-                0x98,0xc0,0x08, //     24 T1 ON, NOTE  64 VOLUME  8
-                0x98,0xb9,0x08, //     24 T1 ON, NOTE  57 VOLUME  8
-                0x98,0xc0,0x08, //     24 T1 ON, NOTE  64 VOLUME  8
-                0x98,0xb9,0x08, //     24 T1 ON, NOTE  57 VOLUME  8
-                0x98,0xc0,0x08, //     24 T1 ON, NOTE  64 VOLUME  8
-                0x98,0xb9,0x08, //     24 T1 ON, NOTE  57 VOLUME  8
-                0x98,0xc0,0x08, //     24 T1 ON, NOTE  64 VOLUME  8
-                0x98,0xb9,0x08, //     24 T1 ON, NOTE  57 VOLUME  8
-                0x98,0xc0,0x08, //     24 T1 ON, NOTE  64 VOLUME  8
-                0x98,0xbe,0x08, //     24 T1 ON, NOTE  62 VOLUME  8
-                0x98,0xc4,0x05, //     24 T1 ON, NOTE  68 VOLUME  5
-                0x98,0xbe,0x08, //     24 T1 ON, NOTE  62 VOLUME  8
-                0x98,0xc4,0x05, //     24 T1 ON, NOTE  68 VOLUME  5
-                0x98,0xbe,0x08, //     24 T1 ON, NOTE  62 VOLUME  8
-                0x98,0xc4,0x05, //     24 T1 ON, NOTE  68 VOLUME  5
-                0x98,0xbe,0x08, //     24 T1 ON, NOTE  62 VOLUME  8
-                0x98,0xc4,0x05, //     24 T1 ON, NOTE  68 VOLUME  5
-                0x98,0xbe,0x08, //     24 T1 ON, NOTE  62 VOLUME  8
-                0x98,0xc4,0x05, //     24 T1 ON, NOTE  68 VOLUME  5
-                0x98,0xbe,0x08, //     24 T1 ON, NOTE  62 VOLUME  8
-                0x98,0xc4,0x05, //     24 T1 ON, NOTE  68 VOLUME  5
-                0x98,0xbe,0x08, //     24 T1 ON, NOTE  62 VOLUME  8
-                0x98,0xc4,0x05, //     24 T1 ON, NOTE  68 VOLUME  5
-                0x98,0xbe,0x08, //     24 T1 ON, NOTE  62 VOLUME  8
-                0x98,0xc4,0x05, //     24 T1 ON, NOTE  68 VOLUME  5
-                0x98,0xc5,0x08, //     24 T1 ON, NOTE  69 VOLUME  8
-                0x98,0xc3,0x05, //     24 T1 ON, NOTE  67 VOLUME  5
-                0x98,0xc0,0x05, //     24 T1 ON, NOTE  64 VOLUME  5
-                0x98,0xc3,0x05, //     24 T1 ON, NOTE  67 VOLUME  5
-                0x98,0xc0,0x05, //     24 T1 ON, NOTE  64 VOLUME  5
-                0x98,0xc3,0x05, //     24 T1 ON, NOTE  67 VOLUME  5
-                0x98,0xc0,0x05, //     24 T1 ON, NOTE  64 VOLUME  5
-                0x98,0xc3,0x05, //     24 T1 ON, NOTE  67 VOLUME  5
-                0x98,0xc0,0x05, //     24 T1 ON, NOTE  64 VOLUME  5
-                0x98,0xc3,0x05, //     24 T1 ON, NOTE  67 VOLUME  5
-                0x98,0xc0,0x05, //     24 T1 ON, NOTE  64 VOLUME  5
-                0x98,0xc3,0x05, //     24 T1 ON, NOTE  67 VOLUME  5
-                0x98,0xc0,0x05, //     24 T1 ON, NOTE  64 VOLUME  5
-                0x98,0xc3,0x05, //     24 T1 ON, NOTE  67 VOLUME  5
-                0x98,0xc0,0x05, //     24 T1 ON, NOTE  64 VOLUME  5
-                0x98,0xc3,0x05, //     24 T1 ON, NOTE  67 VOLUME  5
-                0x98,0xc5,0x08, //     24 T1 ON, NOTE  69 VOLUME  8
-                0x98,0xc2,0x05, //     24 T1 ON, NOTE  66 VOLUME  5
-                0x98,0xbe,0x05, //     24 T1 ON, NOTE  62 VOLUME  5
-                0x98,0xc2,0x05, //     24 T1 ON, NOTE  66 VOLUME  5
-                0x98,0xbe,0x05, //     24 T1 ON, NOTE  62 VOLUME  5
-                0x98,0xc2,0x05, //     24 T1 ON, NOTE  66 VOLUME  5
-                0x98,0xbe,0x05, //     24 T1 ON, NOTE  62 VOLUME  5
-                0x98,0xc2,0x05, //     24 T1 ON, NOTE  66 VOLUME  5
-                0x98,0xbe,0x05, //     24 T1 ON, NOTE  62 VOLUME  5
-                0x98,0xc2,0x05, //     24 T1 ON, NOTE  66 VOLUME  5
-                0x98,0xbe,0x05, //     24 T1 ON, NOTE  62 VOLUME  5
-                0x98,0xc2,0x05, //     24 T1 ON, NOTE  66 VOLUME  5
-                0x98,0xbe,0x05, //     24 T1 ON, NOTE  62 VOLUME  5
-                0x98,0xc2,0x05, //     24 T1 ON, NOTE  66 VOLUME  5
-                0x98,0xbe,0x05, //     24 T1 ON, NOTE  62 VOLUME  5
-                0x98,0xc2,0x05, //     24 T1 ON, NOTE  66 VOLUME  5
-                0x98,0xbd,0x05, //     24 T1 ON, NOTE  61 VOLUME  5
-                0x98,0xc3,0x05, //     24 T1 ON, NOTE  67 VOLUME  5
-                0x98,0xbd,0x05, //     24 T1 ON, NOTE  61 VOLUME  5
-                0x98,0xc3,0x05, //     24 T1 ON, NOTE  67 VOLUME  5
-                0x98,0xbd,0x05, //     24 T1 ON, NOTE  61 VOLUME  5
-                0x98,0xc3,0x05, //     24 T1 ON, NOTE  67 VOLUME  5
-                0x98,0xbd,0x05, //     24 T1 ON, NOTE  61 VOLUME  5
-                0x98,0xc3,0x05, //     24 T1 ON, NOTE  67 VOLUME  5
-                0x98,0xbe,0x05, //     24 T1 ON, NOTE  62 VOLUME  5
-                0x98,0xc2,0x05, //     24 T1 ON, NOTE  66 VOLUME  5
-                0x98,0xbe,0x05, //     24 T1 ON, NOTE  62 VOLUME  5
-                0x98,0xc2,0x05, //     24 T1 ON, NOTE  66 VOLUME  5
-                0x98,0xbe,0x05, //     24 T1 ON, NOTE  62 VOLUME  5
-                0x98,0xc2,0x05, //     24 T1 ON, NOTE  66 VOLUME  5
-                0x98,0xbe,0x05, //     24 T1 ON, NOTE  62 VOLUME  5
-                0x98,0xc2,0x05, //     24 T1 ON, NOTE  66 VOLUME  5
-                0x98,0xc5,0x08, //     24 T1 ON, NOTE  69 VOLUME  8
-                0x98,0xaf,0x08, //     24 T1 ON, NOTE  47 VOLUME  8
-                0x98,0xc5,0x08, //     24 T1 ON, NOTE  69 VOLUME  8
-                0x98,0xb2,0x08, //     24 T1 ON, NOTE  50 VOLUME  8
-                0x98,0xb4,0x08, //     24 T1 ON, NOTE  52 VOLUME  8
-                0x98,0xb6,0x08, //     24 T1 ON, NOTE  54 VOLUME  8
-                0x98,0xc5,0x08, //     24 T1 ON, NOTE  69 VOLUME  8
-                0x98,0xb6,0x08, //     24 T1 ON, NOTE  54 VOLUME  8
-                0x98,0xb7,0x08, //     24 T1 ON, NOTE  55 VOLUME  8
-                0x98,0xb6,0x08, //     24 T1 ON, NOTE  54 VOLUME  8
-                0x98,0xc5,0x08, //     24 T1 ON, NOTE  69 VOLUME  8
-                0x98,0xb6,0x08, //     24 T1 ON, NOTE  54 VOLUME  8
-                0x98,0xb4,0x08, //     24 T1 ON, NOTE  52 VOLUME  8
-                0x98,0xb2,0x08, //     24 T1 ON, NOTE  50 VOLUME  8
-                0x98,0xc5,0x08, //     24 T1 ON, NOTE  69 VOLUME  8
-                0x98,0xaf,0x08, //     24 T1 ON, NOTE  47 VOLUME  8
-                0x98,0xad,0x08, //     24 T1 ON, NOTE  45 VOLUME  8
-                     0xb0,0x01, //     48 BOTH OFF
-                0x98,0xcb,0x05, //     24 T1 ON, NOTE  75 VOLUME  5
-                0x98,0xcc,0x05, //     24 T1 ON, NOTE  76 VOLUME  5
-                0x98,0xcb,0x05, //     24 T1 ON, NOTE  75 VOLUME  5
-                0x98,0xcc,0x05, //     24 T1 ON, NOTE  76 VOLUME  5
-                0x98,0xcb,0x05, //     24 T1 ON, NOTE  75 VOLUME  5
-                0x98,0xcc,0x05, //     24 T1 ON, NOTE  76 VOLUME  5
-                0x98,0xcb,0x05, //     24 T1 ON, NOTE  75 VOLUME  5
-                0x98,0xcc,0x05, //     24 T1 ON, NOTE  76 VOLUME  5
-                0x98,0xcb,0x05, //     24 T1 ON, NOTE  75 VOLUME  5
-                0x98,0xcc,0x05, //     24 T1 ON, NOTE  76 VOLUME  5
-                0x98,0xcb,0x05, //     24 T1 ON, NOTE  75 VOLUME  5
-                0x98,0xcc,0x05, //     24 T1 ON, NOTE  76 VOLUME  5
-                0x98,0xcb,0x05, //     24 T1 ON, NOTE  75 VOLUME  5
-                0x98,0xcc,0x05, //     24 T1 ON, NOTE  76 VOLUME  5
-                0x98,0xca,0x05, //     24 T1 ON, NOTE  74 VOLUME  5
-                0x98,0xc9,0x05, //     24 T1 ON, NOTE  73 VOLUME  5
-                0x98,0xca,0x05, //     24 T1 ON, NOTE  74 VOLUME  5
-                0x98,0xc9,0x05, //     24 T1 ON, NOTE  73 VOLUME  5
-                0x98,0xc7,0x05, //     24 T1 ON, NOTE  71 VOLUME  5
-                0x98,0xc5,0x05, //     24 T1 ON, NOTE  69 VOLUME  5
-                0x98,0xc7,0x05, //     24 T1 ON, NOTE  71 VOLUME  5
-                0x98,0xc5,0x05, //     24 T1 ON, NOTE  69 VOLUME  5
-                0x98,0xc3,0x05, //     24 T1 ON, NOTE  67 VOLUME  5
-                0x98,0xc2,0x05, //     24 T1 ON, NOTE  66 VOLUME  5
-                0x98,0xc3,0x05, //     24 T1 ON, NOTE  67 VOLUME  5
-                0x98,0xc2,0x05, //     24 T1 ON, NOTE  66 VOLUME  5
-                0x98,0xc0,0x05, //     24 T1 ON, NOTE  64 VOLUME  5
-                0x98,0xbe,0x05, //     24 T1 ON, NOTE  62 VOLUME  5
-                0x98,0xbd,0x05, //     24 T1 ON, NOTE  61 VOLUME  5
-                0x98,0xb2,0x08, //     24 T1 ON, NOTE  50 VOLUME  8
-                0x98,0xb1,0x08, //     24 T1 ON, NOTE  49 VOLUME  8
-                0x98,0xb2,0x08, //     24 T1 ON, NOTE  50 VOLUME  8
-                0x98,0xb1,0x08, //     24 T1 ON, NOTE  49 VOLUME  8
-                0x98,0xb2,0x08, //     24 T1 ON, NOTE  50 VOLUME  8
-                     0xb0,0x01, //     48 BOTH OFF
-                0xb0,0xb2,0x08, //     48 T1 ON, NOTE  50 VOLUME  8
-                0x98,0xb1,0x08, //     24 T1 ON, NOTE  49 VOLUME  8
-                0x98,0xb2,0x08, //     24 T1 ON, NOTE  50 VOLUME  8
-                0x98,0xb4,0x08, //     24 T1 ON, NOTE  52 VOLUME  8
-                0x98,0xb6,0x08, //     24 T1 ON, NOTE  54 VOLUME  8
-                0x98,0xb4,0x08, //     24 T1 ON, NOTE  52 VOLUME  8
-                0x98,0xb6,0x08, //     24 T1 ON, NOTE  54 VOLUME  8
-                0x98,0xb7,0x08, //     24 T1 ON, NOTE  55 VOLUME  8
-                0x98,0xb9,0x08, //     24 T1 ON, NOTE  57 VOLUME  8
-                0x98,0xb8,0x08, //     24 T1 ON, NOTE  56 VOLUME  8
-                0x98,0xb9,0x08, //     24 T1 ON, NOTE  57 VOLUME  8
-                0x98,0xb8,0x08, //     24 T1 ON, NOTE  56 VOLUME  8
-                0x98,0xb9,0x08, //     24 T1 ON, NOTE  57 VOLUME  8
-                     0xb0,0x01, //     48 BOTH OFF
-                0xb0,0xb9,0x08, //     48 T1 ON, NOTE  57 VOLUME  8
-                0x98,0xb8,0x08, //     24 T1 ON, NOTE  56 VOLUME  8
-                0x98,0xb9,0x08, //     24 T1 ON, NOTE  57 VOLUME  8
-                0x98,0xba,0x08, //     24 T1 ON, NOTE  58 VOLUME  8
-                0x98,0xbb,0x08, //     24 T1 ON, NOTE  59 VOLUME  8
-                0x98,0xb9,0x08, //     24 T1 ON, NOTE  57 VOLUME  8
-                0x98,0xb7,0x08, //     24 T1 ON, NOTE  55 VOLUME  8
-                0x98,0xb6,0x08, //     24 T1 ON, NOTE  54 VOLUME  8
-                0x98,0xb4,0x08, //     24 T1 ON, NOTE  52 VOLUME  8
-                0x98,0xb3,0x08, //     24 T1 ON, NOTE  51 VOLUME  8
-                0x98,0xb4,0x08, //     24 T1 ON, NOTE  52 VOLUME  8
-                0x98,0xb6,0x08, //     24 T1 ON, NOTE  54 VOLUME  8
-                0x98,0xb7,0x08, //     24 T1 ON, NOTE  55 VOLUME  8
-                0x98,0xb6,0x08, //     24 T1 ON, NOTE  54 VOLUME  8
-                0x98,0xb4,0x08, //     24 T1 ON, NOTE  52 VOLUME  8
-                0x98,0xb2,0x08, //     24 T1 ON, NOTE  50 VOLUME  8
-                0x98,0xb1,0x08, //     24 T1 ON, NOTE  49 VOLUME  8
-                0x98,0xb2,0x08, //     24 T1 ON, NOTE  50 VOLUME  8
-                0x98,0xb4,0x08, //     24 T1 ON, NOTE  52 VOLUME  8
-                0x98,0xb2,0x08, //     24 T1 ON, NOTE  50 VOLUME  8
-                0x98,0xb1,0x08, //     24 T1 ON, NOTE  49 VOLUME  8
-                0x98,0xad,0x08, //     24 T1 ON, NOTE  45 VOLUME  8
-                0x98,0xaf,0x08, //     24 T1 ON, NOTE  47 VOLUME  8
-                0x98,0xb1,0x08, //     24 T1 ON, NOTE  49 VOLUME  8
-                0x98,0xb2,0x08, //     24 T1 ON, NOTE  50 VOLUME  8
-                0x98,0xbe,0x08, //     24 T1 ON, NOTE  62 VOLUME  8
-                0x98,0xb2,0x08, //     24 T1 ON, NOTE  50 VOLUME  8
-                0x98,0xbe,0x08, //     24 T1 ON, NOTE  62 VOLUME  8
-                0x98,0xb2,0x08, //     24 T1 ON, NOTE  50 VOLUME  8
-                0x98,0xbe,0x08, //     24 T1 ON, NOTE  62 VOLUME  8
-                0x98,0xb2,0x08, //     24 T1 ON, NOTE  50 VOLUME  8
-                0x98,0xbe,0x08, //     24 T1 ON, NOTE  62 VOLUME  8
-                0x98,0xc5,0x08, //     24 T1 ON, NOTE  69 VOLUME  8
-                0x98,0xbe,0x08, //     24 T1 ON, NOTE  62 VOLUME  8
-                0x98,0xb2,0x08, //     24 T1 ON, NOTE  50 VOLUME  8
-                0x98,0xbe,0x08, //     24 T1 ON, NOTE  62 VOLUME  8
-                0x98,0xb2,0x08, //     24 T1 ON, NOTE  50 VOLUME  8
-                0x98,0xbe,0x08, //     24 T1 ON, NOTE  62 VOLUME  8
-                0x98,0xc9,0x05, //     24 T1 ON, NOTE  73 VOLUME  5
-                0x98,0xbe,0x08, //     24 T1 ON, NOTE  62 VOLUME  8
-                0x98,0xc2,0x05, //     24 T1 ON, NOTE  66 VOLUME  5
-                0x98,0xbe,0x08, //     24 T1 ON, NOTE  62 VOLUME  8
-                0x98,0xc2,0x05, //     24 T1 ON, NOTE  66 VOLUME  5
-                0x98,0xbe,0x08, //     24 T1 ON, NOTE  62 VOLUME  8
-                0x98,0xc5,0x05, //     24 T1 ON, NOTE  69 VOLUME  5
-                0x98,0xbe,0x08, //     24 T1 ON, NOTE  62 VOLUME  8
-                0x98,0xca,0x05, //     24 T1 ON, NOTE  74 VOLUME  5
-                0x98,0xbe,0x08, //     24 T1 ON, NOTE  62 VOLUME  8
-                0x98,0xce,0x05, //     24 T1 ON, NOTE  78 VOLUME  5
-                0x98,0xbe,0x08, //     24 T1 ON, NOTE  62 VOLUME  8
-                0x98,0xb2,0x08, //     24 T1 ON, NOTE  50 VOLUME  8
-                0x98,0xbe,0x08, //     24 T1 ON, NOTE  62 VOLUME  8
-                0x98,0xb2,0x08, //     24 T1 ON, NOTE  50 VOLUME  8
-                0x98,0xbe,0x08, //     24 T1 ON, NOTE  62 VOLUME  8
-                0x98,0xcc,0x05, //     24 T1 ON, NOTE  76 VOLUME  5
-                0x98,0xbe,0x08, //     24 T1 ON, NOTE  62 VOLUME  8
-                0x98,0xca,0x05, //     24 T1 ON, NOTE  74 VOLUME  5
-                0x98,0xbe,0x08, //     24 T1 ON, NOTE  62 VOLUME  8
-                0x98,0xc5,0x05, //     24 T1 ON, NOTE  69 VOLUME  5
-                0x98,0xbe,0x08, //     24 T1 ON, NOTE  62 VOLUME  8
-                0x98,0xca,0x05, //     24 T1 ON, NOTE  74 VOLUME  5
-                0x98,0xbe,0x08, //     24 T1 ON, NOTE  62 VOLUME  8
-                0x98,0xce,0x05, //     24 T1 ON, NOTE  78 VOLUME  5
-                0x98,0xbe,0x08, //     24 T1 ON, NOTE  62 VOLUME  8
-                0x98,0xca,0x08, //     24 T1 ON, NOTE  74 VOLUME  8
-                0x98,0xbe,0x08, //     24 T1 ON, NOTE  62 VOLUME  8
-                0x98,0xb2,0x08, //     24 T1 ON, NOTE  50 VOLUME  8
-                0x98,0xbe,0x08, //     24 T1 ON, NOTE  62 VOLUME  8
-                0x98,0xb2,0x08, //     24 T1 ON, NOTE  50 VOLUME  8
-                0x98,0xbe,0x08, //     24 T1 ON, NOTE  62 VOLUME  8
-                0x98,0xb2,0x08, //     24 T1 ON, NOTE  50 VOLUME  8
-                0x98,0xbe,0x08, //     24 T1 ON, NOTE  62 VOLUME  8
-                0x98,0xcc,0x05, //     24 T1 ON, NOTE  76 VOLUME  5
-                0x98,0xbe,0x08, //     24 T1 ON, NOTE  62 VOLUME  8
-                0x98,0xb2,0x08, //     24 T1 ON, NOTE  50 VOLUME  8
-                0x98,0xbe,0x08, //     24 T1 ON, NOTE  62 VOLUME  8
-                0x98,0xb2,0x08, //     24 T1 ON, NOTE  50 VOLUME  8
-                0x98,0xbe,0x08, //     24 T1 ON, NOTE  62 VOLUME  8
-                0x98,0xcf,0x05, //     24 T1 ON, NOTE  79 VOLUME  5
-                0x98,0xbe,0x08, //     24 T1 ON, NOTE  62 VOLUME  8
-                0x98,0xce,0x05, //     24 T1 ON, NOTE  78 VOLUME  5
-                0x98,0xbe,0x08, //     24 T1 ON, NOTE  62 VOLUME  8
-                0x98,0xce,0x05, //     24 T1 ON, NOTE  78 VOLUME  5
-                0x98,0xbe,0x08, //     24 T1 ON, NOTE  62 VOLUME  8
-                0x98,0xcc,0x05, //     24 T1 ON, NOTE  76 VOLUME  5
-                0x8c,0xd5,0x08, //     12 T1 ON, NOTE  85 VOLUME  8
-                0x8c,0xbe,0x08, //     12 T1 ON, NOTE  62 VOLUME  8
-                0x8c,0xd5,0x08, //     12 T1 ON, NOTE  85 VOLUME  8
-                0x8c,0xcf,0x05, //     12 T1 ON, NOTE  79 VOLUME  5
-                0x98,0xbe,0x08, //     24 T1 ON, NOTE  62 VOLUME  8
-                0x98,0xce,0x05, //     24 T1 ON, NOTE  78 VOLUME  5
-                0x98,0xbe,0x08, //     24 T1 ON, NOTE  62 VOLUME  8
-                0x98,0xce,0x05, //     24 T1 ON, NOTE  78 VOLUME  5
-                0x98,0xbe,0x08, //     24 T1 ON, NOTE  62 VOLUME  8
-                0x98,0xcc,0x05, //     24 T1 ON, NOTE  76 VOLUME  5
-                0x8c,0xd5,0x08, //     12 T1 ON, NOTE  85 VOLUME  8
-                0x8c,0xbe,0x08, //     12 T1 ON, NOTE  62 VOLUME  8
-                0x8c,0xd5,0x08, //     12 T1 ON, NOTE  85 VOLUME  8
-                0x8c,0xcf,0x05, //     12 T1 ON, NOTE  79 VOLUME  5
-                0x98,0xbe,0x08, //     24 T1 ON, NOTE  62 VOLUME  8
-                0x98,0xce,0x05, //     24 T1 ON, NOTE  78 VOLUME  5
-                0xe0,0xc7,0x08, //     96 T1 ON, NOTE  71 VOLUME  8
-                0xe0,0xc5,0x08, //     96 T1 ON, NOTE  69 VOLUME  8
-                0xe0,0xc3,0x08, //     96 T1 ON, NOTE  67 VOLUME  8
-                0xe0,0xc2,0x05, //     96 T1 ON, NOTE  66 VOLUME  5
-                0x98,0xb1,0x08, //     24 T1 ON, NOTE  49 VOLUME  8
-                0x98,0xb2,0x08, //     24 T1 ON, NOTE  50 VOLUME  8
-                0x98,0xb1,0x08, //     24 T1 ON, NOTE  49 VOLUME  8
-                0x98,0xb2,0x08, //     24 T1 ON, NOTE  50 VOLUME  8
-                     0xb0,0x01, //     48 BOTH OFF
-                0xb0,0xce,0x05, //     48 T1 ON, NOTE  78 VOLUME  5
-                0x98,0xb1,0x08, //     24 T1 ON, NOTE  49 VOLUME  8
-                0x98,0xb2,0x08, //     24 T1 ON, NOTE  50 VOLUME  8
-                0x98,0xb4,0x08, //     24 T1 ON, NOTE  52 VOLUME  8
-                0x98,0xb6,0x08, //     24 T1 ON, NOTE  54 VOLUME  8
-                0x98,0xb4,0x08, //     24 T1 ON, NOTE  52 VOLUME  8
-                0x98,0xb6,0x08, //     24 T1 ON, NOTE  54 VOLUME  8
-                0x98,0xb8,0x08, //     24 T1 ON, NOTE  56 VOLUME  8
-                0x98,0xcc,0x05, //     24 T1 ON, NOTE  76 VOLUME  5
-                0x98,0xb8,0x08, //     24 T1 ON, NOTE  56 VOLUME  8
-                0x98,0xb9,0x08, //     24 T1 ON, NOTE  57 VOLUME  8
-                0x98,0xb8,0x08, //     24 T1 ON, NOTE  56 VOLUME  8
-                0x98,0xb9,0x08, //     24 T1 ON, NOTE  57 VOLUME  8
-                     0xb0,0x01, //     48 BOTH OFF
-                0xb0,0xce,0x05, //     48 T1 ON, NOTE  78 VOLUME  5
-                0x98,0xb1,0x08, //     24 T1 ON, NOTE  49 VOLUME  8
-                0x98,0xb2,0x08, //     24 T1 ON, NOTE  50 VOLUME  8
-                0x98,0xb4,0x08, //     24 T1 ON, NOTE  52 VOLUME  8
-                0x98,0xd1,0x05, //     24 T1 ON, NOTE  81 VOLUME  5
-                0x98,0xb4,0x08, //     24 T1 ON, NOTE  52 VOLUME  8
-                0x98,0xb6,0x08, //     24 T1 ON, NOTE  54 VOLUME  8
-                0x98,0xb2,0x08, //     24 T1 ON, NOTE  50 VOLUME  8
-                0x98,0xb7,0x08, //     24 T1 ON, NOTE  55 VOLUME  8
-                0x98,0xb6,0x08, //     24 T1 ON, NOTE  54 VOLUME  8
-                0x98,0xb7,0x08, //     24 T1 ON, NOTE  55 VOLUME  8
-                0x98,0xb6,0x08, //     24 T1 ON, NOTE  54 VOLUME  8
-                0x98,0xcf,0x05, //     24 T1 ON, NOTE  79 VOLUME  5
-                0xe0,0xaf,0x08, //     96 T1 ON, NOTE  47 VOLUME  8
-                0x98,0xae,0x08, //     24 T1 ON, NOTE  46 VOLUME  8
-                0x98,0xaf,0x08, //     24 T1 ON, NOTE  47 VOLUME  8
-                0x98,0xb1,0x08, //     24 T1 ON, NOTE  49 VOLUME  8
-                0x98,0xce,0x05, //     24 T1 ON, NOTE  78 VOLUME  5
-                0x98,0xb1,0x08, //     24 T1 ON, NOTE  49 VOLUME  8
-                0x98,0xb3,0x08, //     24 T1 ON, NOTE  51 VOLUME  8
-                0x98,0xaf,0x08, //     24 T1 ON, NOTE  47 VOLUME  8
-                0x98,0xb4,0x08, //     24 T1 ON, NOTE  52 VOLUME  8
-                0x98,0xb6,0x08, //     24 T1 ON, NOTE  54 VOLUME  8
-                0x98,0xb4,0x08, //     24 T1 ON, NOTE  52 VOLUME  8
-                0x98,0xb2,0x08, //     24 T1 ON, NOTE  50 VOLUME  8
-                0x98,0xcc,0x05, //     24 T1 ON, NOTE  76 VOLUME  5
-                0x98,0xaf,0x08, //     24 T1 ON, NOTE  47 VOLUME  8
-                0x98,0xb1,0x08, //     24 T1 ON, NOTE  49 VOLUME  8
-                0x98,0xad,0x08, //     24 T1 ON, NOTE  45 VOLUME  8
-                0x98,0xb2,0x08, //     24 T1 ON, NOTE  50 VOLUME  8
-                0x8c,0xce,0x08, //     12 T1 ON, NOTE  78 VOLUME  8
-                0x8c,0xb1,0x08, //     12 T1 ON, NOTE  49 VOLUME  8
-                0x8c,0xce,0x08, //     12 T1 ON, NOTE  78 VOLUME  8
-                0x8c,0xb2,0x08, //     12 T1 ON, NOTE  50 VOLUME  8
-                0x8c,0xce,0x08, //     12 T1 ON, NOTE  78 VOLUME  8
-                0x8c,0xb4,0x08, //     12 T1 ON, NOTE  52 VOLUME  8
-                0x8c,0xce,0x08, //     12 T1 ON, NOTE  78 VOLUME  8
-                0x8c,0xca,0x05, //     12 T1 ON, NOTE  74 VOLUME  5
-                0x8c,0xce,0x08, //     12 T1 ON, NOTE  78 VOLUME  8
-                0x8c,0xb4,0x08, //     12 T1 ON, NOTE  52 VOLUME  8
-                0x8c,0xce,0x08, //     12 T1 ON, NOTE  78 VOLUME  8
-                0x8c,0xb6,0x08, //     12 T1 ON, NOTE  54 VOLUME  8
-                0x8c,0xce,0x08, //     12 T1 ON, NOTE  78 VOLUME  8
-                0x8c,0xb8,0x08, //     12 T1 ON, NOTE  56 VOLUME  8
-                0x8c,0xce,0x08, //     12 T1 ON, NOTE  78 VOLUME  8
-                0x8c,0xc5,0x08, //     12 T1 ON, NOTE  69 VOLUME  8
-                0x98,0xb1,0x08, //     24 T1 ON, NOTE  49 VOLUME  8
-                0x98,0xb4,0x08, //     24 T1 ON, NOTE  52 VOLUME  8
-                0x98,0xb9,0x08, //     24 T1 ON, NOTE  57 VOLUME  8
-                0x98,0xad,0x08, //     24 T1 ON, NOTE  45 VOLUME  8
-                0x98,0xb1,0x08, //     24 T1 ON, NOTE  49 VOLUME  8
-                0x98,0xcc,0x08, //     24 T1 ON, NOTE  76 VOLUME  8
-                0x98,0xb9,0x08, //     24 T1 ON, NOTE  57 VOLUME  8
-                0x98,0xce,0x08, //     24 T1 ON, NOTE  78 VOLUME  8
-                0x98,0xb2,0x08, //     24 T1 ON, NOTE  50 VOLUME  8
-                0x98,0xb6,0x08, //     24 T1 ON, NOTE  54 VOLUME  8
-                0x98,0xb9,0x08, //     24 T1 ON, NOTE  57 VOLUME  8
-                0x98,0xad,0x08, //     24 T1 ON, NOTE  45 VOLUME  8
-                0x98,0xb2,0x08, //     24 T1 ON, NOTE  50 VOLUME  8
-                0x98,0xca,0x05, //     24 T1 ON, NOTE  74 VOLUME  5
-                0x98,0xb9,0x08, //     24 T1 ON, NOTE  57 VOLUME  8
-                0x98,0xc9,0x08, //     24 T1 ON, NOTE  73 VOLUME  8
-                0x98,0xb1,0x08, //     24 T1 ON, NOTE  49 VOLUME  8
-                0x98,0xb4,0x08, //     24 T1 ON, NOTE  52 VOLUME  8
-                0x98,0xb9,0x08, //     24 T1 ON, NOTE  57 VOLUME  8
-                0x98,0xab,0x08, //     24 T1 ON, NOTE  43 VOLUME  8
-                0x98,0xb1,0x08, //     24 T1 ON, NOTE  49 VOLUME  8
-                0x98,0xcc,0x08, //     24 T1 ON, NOTE  76 VOLUME  8
-                0x98,0xb9,0x08, //     24 T1 ON, NOTE  57 VOLUME  8
-                0x98,0xce,0x08, //     24 T1 ON, NOTE  78 VOLUME  8
-                0x98,0xb2,0x08, //     24 T1 ON, NOTE  50 VOLUME  8
-                0x98,0xb6,0x08, //     24 T1 ON, NOTE  54 VOLUME  8
-                0x98,0xb9,0x08, //     24 T1 ON, NOTE  57 VOLUME  8
-                0x98,0xad,0x08, //     24 T1 ON, NOTE  45 VOLUME  8
-                0x98,0xb2,0x08, //     24 T1 ON, NOTE  50 VOLUME  8
-                0x98,0xca,0x05, //     24 T1 ON, NOTE  74 VOLUME  5
-                0x98,0xb9,0x08, //     24 T1 ON, NOTE  57 VOLUME  8
-                0x98,0xc9,0x08, //     24 T1 ON, NOTE  73 VOLUME  8
-                0x98,0xb1,0x08, //     24 T1 ON, NOTE  49 VOLUME  8
-                0x98,0xcc,0x08, //     24 T1 ON, NOTE  76 VOLUME  8
-                0x98,0xb9,0x08, //     24 T1 ON, NOTE  57 VOLUME  8
-                0x98,0xce,0x08, //     24 T1 ON, NOTE  78 VOLUME  8
-                0x98,0xb2,0x08, //     24 T1 ON, NOTE  50 VOLUME  8
-                0x98,0xce,0x08, //     24 T1 ON, NOTE  78 VOLUME  8
-                0x98,0xb9,0x08, //     24 T1 ON, NOTE  57 VOLUME  8
-                0x98,0xcc,0x08, //     24 T1 ON, NOTE  76 VOLUME  8
-                0x98,0xb1,0x08, //     24 T1 ON, NOTE  49 VOLUME  8
-                0x98,0xcc,0x08, //     24 T1 ON, NOTE  76 VOLUME  8
-                0x98,0xb9,0x08, //     24 T1 ON, NOTE  57 VOLUME  8
-                0x98,0xce,0x08, //     24 T1 ON, NOTE  78 VOLUME  8
-                0x98,0xb2,0x08, //     24 T1 ON, NOTE  50 VOLUME  8
-                0x98,0xce,0x08, //     24 T1 ON, NOTE  78 VOLUME  8
-                0x98,0xb9,0x08, //     24 T1 ON, NOTE  57 VOLUME  8
-                0x98,0xad,0x08, //     24 T1 ON, NOTE  45 VOLUME  8
-                0x02,0xa0,0x01, //    288 BOTH OFF
-                0xe0,0xca,0x05, //     96 T1 ON, NOTE  74 VOLUME  5
-                0x98,0xce,0x05, //     24 T1 ON, NOTE  78 VOLUME  5
-                0x98,0xca,0x05, //     24 T1 ON, NOTE  74 VOLUME  5
-                0x98,0xce,0x05, //     24 T1 ON, NOTE  78 VOLUME  5
-                0x98,0xca,0x05, //     24 T1 ON, NOTE  74 VOLUME  5
-                0x98,0xce,0x05, //     24 T1 ON, NOTE  78 VOLUME  5
-                0x98,0xc9,0x05, //     24 T1 ON, NOTE  73 VOLUME  5
-                0x98,0xcc,0x05, //     24 T1 ON, NOTE  76 VOLUME  5
-                0x98,0xca,0x05, //     24 T1 ON, NOTE  74 VOLUME  5
-                0x98,0xce,0x05, //     24 T1 ON, NOTE  78 VOLUME  5
-                0x98,0xca,0x05, //     24 T1 ON, NOTE  74 VOLUME  5
-                0x98,0xce,0x05, //     24 T1 ON, NOTE  78 VOLUME  5
-                0x98,0xca,0x05, //     24 T1 ON, NOTE  74 VOLUME  5
-                0x98,0xce,0x05, //     24 T1 ON, NOTE  78 VOLUME  5
-                0x98,0xc9,0x05, //     24 T1 ON, NOTE  73 VOLUME  5
-                0x98,0xcc,0x05, //     24 T1 ON, NOTE  76 VOLUME  5
-                0x98,0xc7,0x05, //     24 T1 ON, NOTE  71 VOLUME  5
-                0x98,0xca,0x05, //     24 T1 ON, NOTE  74 VOLUME  5
-                0x98,0xc7,0x05, //     24 T1 ON, NOTE  71 VOLUME  5
-                0x98,0xca,0x05, //     24 T1 ON, NOTE  74 VOLUME  5
-                0x98,0xc7,0x05, //     24 T1 ON, NOTE  71 VOLUME  5
-                0x98,0xca,0x05, //     24 T1 ON, NOTE  74 VOLUME  5
-                0x98,0xc5,0x05, //     24 T1 ON, NOTE  69 VOLUME  5
-                0x98,0xc9,0x05, //     24 T1 ON, NOTE  73 VOLUME  5
-                0x98,0xc7,0x05, //     24 T1 ON, NOTE  71 VOLUME  5
-                0x98,0xca,0x05, //     24 T1 ON, NOTE  74 VOLUME  5
-                0x98,0xc7,0x05, //     24 T1 ON, NOTE  71 VOLUME  5
-                0x98,0xca,0x05, //     24 T1 ON, NOTE  74 VOLUME  5
-                0x98,0xc7,0x05, //     24 T1 ON, NOTE  71 VOLUME  5
-                0x98,0xca,0x05, //     24 T1 ON, NOTE  74 VOLUME  5
-                0x98,0xc5,0x05, //     24 T1 ON, NOTE  69 VOLUME  5
-                0x98,0xc9,0x05, //     24 T1 ON, NOTE  73 VOLUME  5
-                0x98,0xc3,0x05, //     24 T1 ON, NOTE  67 VOLUME  5
-                0x86,0xd5,0x08, //      6 T1 ON, NOTE  85 VOLUME  8
-                0x86,0xd6,0x08, //      6 T1 ON, NOTE  86 VOLUME  8
-                0x8c,0xc7,0x05, //     12 T1 ON, NOTE  71 VOLUME  5
-                0x98,0xc3,0x05, //     24 T1 ON, NOTE  67 VOLUME  5
-                0x98,0xc7,0x05, //     24 T1 ON, NOTE  71 VOLUME  5
-                0x98,0xc3,0x05, //     24 T1 ON, NOTE  67 VOLUME  5
-                0x98,0xc7,0x05, //     24 T1 ON, NOTE  71 VOLUME  5
-                0x98,0xc2,0x05, //     24 T1 ON, NOTE  66 VOLUME  5
-                0x98,0xc5,0x05, //     24 T1 ON, NOTE  69 VOLUME  5
-                0x98,0xc3,0x05, //     24 T1 ON, NOTE  67 VOLUME  5
-                0x86,0xd5,0x08, //      6 T1 ON, NOTE  85 VOLUME  8
-                0x86,0xd6,0x08, //      6 T1 ON, NOTE  86 VOLUME  8
-                0x8c,0xc7,0x05, //     12 T1 ON, NOTE  71 VOLUME  5
-                0x98,0xc3,0x05, //     24 T1 ON, NOTE  67 VOLUME  5
-                0x98,0xc7,0x05, //     24 T1 ON, NOTE  71 VOLUME  5
-                0x98,0xc3,0x05, //     24 T1 ON, NOTE  67 VOLUME  5
-                0x98,0xc7,0x05, //     24 T1 ON, NOTE  71 VOLUME  5
-                0x98,0xc2,0x05, //     24 T1 ON, NOTE  66 VOLUME  5
-                0x98,0xc5,0x05, //     24 T1 ON, NOTE  69 VOLUME  5
-                0x98,0xc0,0x08, //     24 T1 ON, NOTE  64 VOLUME  8
-                0x98,0xd1,0x08, //     24 T1 ON, NOTE  81 VOLUME  8
-                0x98,0xd3,0x08, //     24 T1 ON, NOTE  83 VOLUME  8
-                0x98,0xd1,0x08, //     24 T1 ON, NOTE  81 VOLUME  8
-                0x98,0xcf,0x08, //     24 T1 ON, NOTE  79 VOLUME  8
-                0x98,0xce,0x08, //     24 T1 ON, NOTE  78 VOLUME  8
-                0x98,0xcc,0x08, //     24 T1 ON, NOTE  76 VOLUME  8
-                0x98,0xca,0x08, //     24 T1 ON, NOTE  74 VOLUME  8
-                0x98,0xb9,0x08, //     24 T1 ON, NOTE  57 VOLUME  8
-                0x98,0xd6,0x08, //     24 T1 ON, NOTE  86 VOLUME  8
-                0x98,0xd8,0x08, //     24 T1 ON, NOTE  88 VOLUME  8
-                0x98,0xd6,0x08, //     24 T1 ON, NOTE  86 VOLUME  8
-                0x98,0xd5,0x08, //     24 T1 ON, NOTE  85 VOLUME  8
-                0x98,0xd3,0x08, //     24 T1 ON, NOTE  83 VOLUME  8
-                0x98,0xd1,0x08, //     24 T1 ON, NOTE  81 VOLUME  8
-                0x98,0xcf,0x08, //     24 T1 ON, NOTE  79 VOLUME  8
-                0x98,0xca,0x05, //     24 T1 ON, NOTE  74 VOLUME  5
-                0x98,0xce,0x05, //     24 T1 ON, NOTE  78 VOLUME  5
-                0x98,0xca,0x05, //     24 T1 ON, NOTE  74 VOLUME  5
-                0x98,0xce,0x05, //     24 T1 ON, NOTE  78 VOLUME  5
-                0x98,0xca,0x05, //     24 T1 ON, NOTE  74 VOLUME  5
-                0x98,0xce,0x05, //     24 T1 ON, NOTE  78 VOLUME  5
-                0x98,0xc9,0x05, //     24 T1 ON, NOTE  73 VOLUME  5
-                0x98,0xcc,0x05, //     24 T1 ON, NOTE  76 VOLUME  5
-                0x98,0xca,0x05, //     24 T1 ON, NOTE  74 VOLUME  5
-                0x98,0xce,0x05, //     24 T1 ON, NOTE  78 VOLUME  5
-                0x98,0xca,0x05, //     24 T1 ON, NOTE  74 VOLUME  5
-                0x98,0xce,0x05, //     24 T1 ON, NOTE  78 VOLUME  5
-                0x98,0xca,0x05, //     24 T1 ON, NOTE  74 VOLUME  5
-                0x98,0xce,0x05, //     24 T1 ON, NOTE  78 VOLUME  5
-                0x98,0xc9,0x05, //     24 T1 ON, NOTE  73 VOLUME  5
-                0x98,0xcc,0x05, //     24 T1 ON, NOTE  76 VOLUME  5
-                0x98,0xc7,0x05, //     24 T1 ON, NOTE  71 VOLUME  5
-                0x98,0xca,0x05, //     24 T1 ON, NOTE  74 VOLUME  5
-                0x98,0xc7,0x05, //     24 T1 ON, NOTE  71 VOLUME  5
-                0x98,0xca,0x05, //     24 T1 ON, NOTE  74 VOLUME  5
-                0x98,0xc7,0x05, //     24 T1 ON, NOTE  71 VOLUME  5
-                0x98,0xca,0x05, //     24 T1 ON, NOTE  74 VOLUME  5
-                0x98,0xc5,0x05, //     24 T1 ON, NOTE  69 VOLUME  5
-                0x98,0xc9,0x05, //     24 T1 ON, NOTE  73 VOLUME  5
-                0x98,0xc7,0x05, //     24 T1 ON, NOTE  71 VOLUME  5
-                0x98,0xca,0x05, //     24 T1 ON, NOTE  74 VOLUME  5
-                0x98,0xc7,0x05, //     24 T1 ON, NOTE  71 VOLUME  5
-                0x98,0xca,0x05, //     24 T1 ON, NOTE  74 VOLUME  5
-                0x98,0xc7,0x05, //     24 T1 ON, NOTE  71 VOLUME  5
-                0x98,0xca,0x05, //     24 T1 ON, NOTE  74 VOLUME  5
-                0x98,0xc5,0x05, //     24 T1 ON, NOTE  69 VOLUME  5
-                0x98,0xc9,0x05, //     24 T1 ON, NOTE  73 VOLUME  5
-                0x98,0xc3,0x05, //     24 T1 ON, NOTE  67 VOLUME  5
-                0x86,0xd5,0x08, //      6 T1 ON, NOTE  85 VOLUME  8
-                0x86,0xd6,0x08, //      6 T1 ON, NOTE  86 VOLUME  8
-                0x8c,0xc7,0x05, //     12 T1 ON, NOTE  71 VOLUME  5
-                0x98,0xc3,0x05, //     24 T1 ON, NOTE  67 VOLUME  5
-                0x98,0xc7,0x05, //     24 T1 ON, NOTE  71 VOLUME  5
-                0x98,0xc3,0x05, //     24 T1 ON, NOTE  67 VOLUME  5
-                0x98,0xc7,0x05, //     24 T1 ON, NOTE  71 VOLUME  5
-                0x98,0xc2,0x05, //     24 T1 ON, NOTE  66 VOLUME  5
-                0x98,0xc5,0x05, //     24 T1 ON, NOTE  69 VOLUME  5
-                0x98,0xc3,0x05, //     24 T1 ON, NOTE  67 VOLUME  5
-                0x86,0xd5,0x08, //      6 T1 ON, NOTE  85 VOLUME  8
-                0x86,0xd6,0x08, //      6 T1 ON, NOTE  86 VOLUME  8
-                0x8c,0xc7,0x05, //     12 T1 ON, NOTE  71 VOLUME  5
-                0x98,0xc3,0x05, //     24 T1 ON, NOTE  67 VOLUME  5
-                0x98,0xc7,0x05, //     24 T1 ON, NOTE  71 VOLUME  5
-                0x98,0xc3,0x05, //     24 T1 ON, NOTE  67 VOLUME  5
-                0x98,0xc7,0x05, //     24 T1 ON, NOTE  71 VOLUME  5
-                0x98,0xc2,0x05, //     24 T1 ON, NOTE  66 VOLUME  5
-                0x98,0xc5,0x05, //     24 T1 ON, NOTE  69 VOLUME  5
-                0x98,0xb4,0x08, //     24 T1 ON, NOTE  52 VOLUME  8
-                0x98,0xd1,0x08, //     24 T1 ON, NOTE  81 VOLUME  8
-                0x98,0xd3,0x08, //     24 T1 ON, NOTE  83 VOLUME  8
-                0x98,0xd1,0x08, //     24 T1 ON, NOTE  81 VOLUME  8
-                0x98,0xcf,0x08, //     24 T1 ON, NOTE  79 VOLUME  8
-                0x98,0xce,0x08, //     24 T1 ON, NOTE  78 VOLUME  8
-                0x98,0xcc,0x08, //     24 T1 ON, NOTE  76 VOLUME  8
-                0x98,0xca,0x08, //     24 T1 ON, NOTE  74 VOLUME  8
-                0x98,0xb9,0x08, //     24 T1 ON, NOTE  57 VOLUME  8
-                0x98,0xd6,0x08, //     24 T1 ON, NOTE  86 VOLUME  8
-                0x98,0xd8,0x08, //     24 T1 ON, NOTE  88 VOLUME  8
-                0x98,0xd6,0x08, //     24 T1 ON, NOTE  86 VOLUME  8
-                0x98,0xd5,0x08, //     24 T1 ON, NOTE  85 VOLUME  8
-                0x98,0xd3,0x08, //     24 T1 ON, NOTE  83 VOLUME  8
-                0x98,0xd1,0x08, //     24 T1 ON, NOTE  81 VOLUME  8
-                0x98,0xcf,0x08, //     24 T1 ON, NOTE  79 VOLUME  8
-                0x98,0xbe,0x05, //     24 T1 ON, NOTE  62 VOLUME  5
-                0x98,0xc2,0x05, //     24 T1 ON, NOTE  66 VOLUME  5
-                0x98,0xbe,0x05, //     24 T1 ON, NOTE  62 VOLUME  5
-                0x98,0xc2,0x05, //     24 T1 ON, NOTE  66 VOLUME  5
-                0x98,0xce,0x08, //     24 T1 ON, NOTE  78 VOLUME  8
-                0x98,0xc2,0x05, //     24 T1 ON, NOTE  66 VOLUME  5
-                0x98,0xbe,0x05, //     24 T1 ON, NOTE  62 VOLUME  5
-                0x98,0xc2,0x05, //     24 T1 ON, NOTE  66 VOLUME  5
-                0x98,0xbe,0x05, //     24 T1 ON, NOTE  62 VOLUME  5
-                0x98,0xc1,0x05, //     24 T1 ON, NOTE  65 VOLUME  5
-                0x98,0xbe,0x05, //     24 T1 ON, NOTE  62 VOLUME  5
-                0x98,0xc1,0x05, //     24 T1 ON, NOTE  65 VOLUME  5
-                0x98,0xbe,0x05, //     24 T1 ON, NOTE  62 VOLUME  5
-                0x98,0xc1,0x05, //     24 T1 ON, NOTE  65 VOLUME  5
-                0x98,0xbe,0x05, //     24 T1 ON, NOTE  62 VOLUME  5
-                0x98,0xc1,0x05, //     24 T1 ON, NOTE  65 VOLUME  5
-                0x98,0xbe,0x05, //     24 T1 ON, NOTE  62 VOLUME  5
-                0x98,0xc0,0x05, //     24 T1 ON, NOTE  64 VOLUME  5
-                0x98,0xbe,0x05, //     24 T1 ON, NOTE  62 VOLUME  5
-                0x98,0xc0,0x05, //     24 T1 ON, NOTE  64 VOLUME  5
-                0x98,0xcc,0x08, //     24 T1 ON, NOTE  76 VOLUME  8
-                0x98,0xc0,0x05, //     24 T1 ON, NOTE  64 VOLUME  5
-                0x98,0xbc,0x05, //     24 T1 ON, NOTE  60 VOLUME  5
-                0x98,0xc0,0x05, //     24 T1 ON, NOTE  64 VOLUME  5
-                0x98,0xbc,0x05, //     24 T1 ON, NOTE  60 VOLUME  5
-                0x98,0xbf,0x05, //     24 T1 ON, NOTE  63 VOLUME  5
-                0x98,0xbc,0x05, //     24 T1 ON, NOTE  60 VOLUME  5
-                0x98,0xbf,0x05, //     24 T1 ON, NOTE  63 VOLUME  5
-                0x98,0xbc,0x05, //     24 T1 ON, NOTE  60 VOLUME  5
-                0x98,0xbf,0x05, //     24 T1 ON, NOTE  63 VOLUME  5
-                0x98,0xbc,0x05, //     24 T1 ON, NOTE  60 VOLUME  5
-                0x98,0xbf,0x05, //     24 T1 ON, NOTE  63 VOLUME  5
-                0x98,0xbc,0x05, //     24 T1 ON, NOTE  60 VOLUME  5
-                0x98,0xbe,0x05, //     24 T1 ON, NOTE  62 VOLUME  5
-                0x98,0xbc,0x05, //     24 T1 ON, NOTE  60 VOLUME  5
-                0x98,0xbe,0x05, //     24 T1 ON, NOTE  62 VOLUME  5
-                0x98,0xca,0x08, //     24 T1 ON, NOTE  74 VOLUME  8
-                0x98,0xbe,0x05, //     24 T1 ON, NOTE  62 VOLUME  5
-                0x98,0xba,0x05, //     24 T1 ON, NOTE  58 VOLUME  5
-                0x98,0xbe,0x05, //     24 T1 ON, NOTE  62 VOLUME  5
-                0x98,0xba,0x05, //     24 T1 ON, NOTE  58 VOLUME  5
-                0x98,0xbe,0x05, //     24 T1 ON, NOTE  62 VOLUME  5
-                0x98,0xba,0x05, //     24 T1 ON, NOTE  58 VOLUME  5
-                0x98,0xbe,0x05, //     24 T1 ON, NOTE  62 VOLUME  5
-                0x98,0xba,0x05, //     24 T1 ON, NOTE  58 VOLUME  5
-                0x98,0xbe,0x05, //     24 T1 ON, NOTE  62 VOLUME  5
-                0x98,0xba,0x05, //     24 T1 ON, NOTE  58 VOLUME  5
-                0x98,0xbe,0x05, //     24 T1 ON, NOTE  62 VOLUME  5
-                0x98,0xb9,0x08, //     24 T1 ON, NOTE  57 VOLUME  8
-                0x98,0xc3,0x05, //     24 T1 ON, NOTE  67 VOLUME  5
-                0x98,0xb9,0x08, //     24 T1 ON, NOTE  57 VOLUME  8
-                0x98,0xc3,0x05, //     24 T1 ON, NOTE  67 VOLUME  5
-                0x98,0xb9,0x08, //     24 T1 ON, NOTE  57 VOLUME  8
-                0x98,0xc3,0x05, //     24 T1 ON, NOTE  67 VOLUME  5
-                0x98,0xb9,0x08, //     24 T1 ON, NOTE  57 VOLUME  8
-                0x98,0xc3,0x05, //     24 T1 ON, NOTE  67 VOLUME  5
-                0x98,0xb9,0x08, //     24 T1 ON, NOTE  57 VOLUME  8
-                0x98,0xc2,0x05, //     24 T1 ON, NOTE  66 VOLUME  5
-                0x98,0xb9,0x08, //     24 T1 ON, NOTE  57 VOLUME  8
-                0x98,0xc2,0x05, //     24 T1 ON, NOTE  66 VOLUME  5
-                0x98,0xb9,0x08, //     24 T1 ON, NOTE  57 VOLUME  8
-                0x98,0xc2,0x05, //     24 T1 ON, NOTE  66 VOLUME  5
-                0x98,0xb9,0x08, //     24 T1 ON, NOTE  57 VOLUME  8
-                0x98,0xc2,0x05, //     24 T1 ON, NOTE  66 VOLUME  5
-                0x98,0xb9,0x08, //     24 T1 ON, NOTE  57 VOLUME  8
-                0x98,0xc3,0x05, //     24 T1 ON, NOTE  67 VOLUME  5
-                0x98,0xb9,0x08, //     24 T1 ON, NOTE  57 VOLUME  8
-                0x98,0xc3,0x05, //     24 T1 ON, NOTE  67 VOLUME  5
-                0x98,0xb9,0x08, //     24 T1 ON, NOTE  57 VOLUME  8
-                0x98,0xc3,0x05, //     24 T1 ON, NOTE  67 VOLUME  5
-                0x98,0xb9,0x08, //     24 T1 ON, NOTE  57 VOLUME  8
-                0x98,0xc3,0x05, //     24 T1 ON, NOTE  67 VOLUME  5
-                0x98,0xb9,0x08, //     24 T1 ON, NOTE  57 VOLUME  8
-                0x98,0xc2,0x05, //     24 T1 ON, NOTE  66 VOLUME  5
-                0x98,0xb9,0x08, //     24 T1 ON, NOTE  57 VOLUME  8
-                0x98,0xc2,0x05, //     24 T1 ON, NOTE  66 VOLUME  5
-                0x98,0xb9,0x08, //     24 T1 ON, NOTE  57 VOLUME  8
-                0x98,0xc0,0x05, //     24 T1 ON, NOTE  64 VOLUME  5
-                0x98,0xb9,0x08, //     24 T1 ON, NOTE  57 VOLUME  8
-                0x98,0xc0,0x05, //     24 T1 ON, NOTE  64 VOLUME  5
-                0x98,0xb2,0x08, //     24 T1 ON, NOTE  50 VOLUME  8
-                0x98,0xca,0x08, //     24 T1 ON, NOTE  74 VOLUME  8
-                0x98,0xce,0x05, //     24 T1 ON, NOTE  78 VOLUME  5
-                0x98,0xca,0x08, //     24 T1 ON, NOTE  74 VOLUME  8
-                0x98,0xce,0x05, //     24 T1 ON, NOTE  78 VOLUME  5
-                0x98,0xca,0x08, //     24 T1 ON, NOTE  74 VOLUME  8
-                0x98,0xa6,0x08, //     24 T1 ON, NOTE  38 VOLUME  8
-                0x98,0xca,0x08, //     24 T1 ON, NOTE  74 VOLUME  8
-                0x98,0xa8,0x08, //     24 T1 ON, NOTE  40 VOLUME  8
-                0x98,0xca,0x08, //     24 T1 ON, NOTE  74 VOLUME  8
-                0x98,0xaa,0x08, //     24 T1 ON, NOTE  42 VOLUME  8
-                0x98,0xca,0x08, //     24 T1 ON, NOTE  74 VOLUME  8
-                0x98,0xab,0x08, //     24 T1 ON, NOTE  43 VOLUME  8
-                0x98,0xca,0x08, //     24 T1 ON, NOTE  74 VOLUME  8
-                0x98,0xac,0x08, //     24 T1 ON, NOTE  44 VOLUME  8
-                0x98,0xca,0x08, //     24 T1 ON, NOTE  74 VOLUME  8
-                0x98,0xaf,0x08, //     24 T1 ON, NOTE  47 VOLUME  8
-                0x98,0xca,0x08, //     24 T1 ON, NOTE  74 VOLUME  8
-                0x98,0xad,0x08, //     24 T1 ON, NOTE  45 VOLUME  8
-                0x98,0xca,0x08, //     24 T1 ON, NOTE  74 VOLUME  8
-                0x98,0xce,0x05, //     24 T1 ON, NOTE  78 VOLUME  5
-                0x98,0xca,0x08, //     24 T1 ON, NOTE  74 VOLUME  8
-                0x98,0xa6,0x08, //     24 T1 ON, NOTE  38 VOLUME  8
-                0x98,0xca,0x08, //     24 T1 ON, NOTE  74 VOLUME  8
-                0x98,0xa8,0x08, //     24 T1 ON, NOTE  40 VOLUME  8
-                0x98,0xca,0x08, //     24 T1 ON, NOTE  74 VOLUME  8
-                0x98,0xaa,0x08, //     24 T1 ON, NOTE  42 VOLUME  8
-                0x98,0xca,0x08, //     24 T1 ON, NOTE  74 VOLUME  8
-                0x98,0xab,0x08, //     24 T1 ON, NOTE  43 VOLUME  8
-                0x98,0xca,0x08, //     24 T1 ON, NOTE  74 VOLUME  8
-                0x98,0xac,0x08, //     24 T1 ON, NOTE  44 VOLUME  8
-                0x98,0xca,0x08, //     24 T1 ON, NOTE  74 VOLUME  8
-                0x98,0xaf,0x08, //     24 T1 ON, NOTE  47 VOLUME  8
-                0x98,0xca,0x08, //     24 T1 ON, NOTE  74 VOLUME  8
-                0x98,0xad,0x08, //     24 T1 ON, NOTE  45 VOLUME  8
-                0x98,0xca,0x08, //     24 T1 ON, NOTE  74 VOLUME  8
-                0x98,0xce,0x05, //     24 T1 ON, NOTE  78 VOLUME  5
-                0x98,0xca,0x08, //     24 T1 ON, NOTE  74 VOLUME  8
-                0x98,0xa6,0x08, //     24 T1 ON, NOTE  38 VOLUME  8
-                0x98,0xca,0x08, //     24 T1 ON, NOTE  74 VOLUME  8
-                0x98,0xa8,0x08, //     24 T1 ON, NOTE  40 VOLUME  8
-                0x98,0xca,0x08, //     24 T1 ON, NOTE  74 VOLUME  8
-                0x98,0xaa,0x08, //     24 T1 ON, NOTE  42 VOLUME  8
-                0x98,0xca,0x08, //     24 T1 ON, NOTE  74 VOLUME  8
-                0x98,0xab,0x08, //     24 T1 ON, NOTE  43 VOLUME  8
-                0x98,0xca,0x08, //     24 T1 ON, NOTE  74 VOLUME  8
-                0x98,0xad,0x08, //     24 T1 ON, NOTE  45 VOLUME  8
-                0x98,0xca,0x08, //     24 T1 ON, NOTE  74 VOLUME  8
-                0x98,0xae,0x08, //     24 T1 ON, NOTE  46 VOLUME  8
-                0x98,0xca,0x08, //     24 T1 ON, NOTE  74 VOLUME  8
-                0x98,0xcd,0x05, //     24 T1 ON, NOTE  77 VOLUME  5
-                0x98,0xca,0x08, //     24 T1 ON, NOTE  74 VOLUME  8
-                0x98,0xad,0x08, //     24 T1 ON, NOTE  45 VOLUME  8
-                0x98,0xca,0x08, //     24 T1 ON, NOTE  74 VOLUME  8
-                0x98,0xcd,0x05, //     24 T1 ON, NOTE  77 VOLUME  5
-                0x98,0xca,0x08, //     24 T1 ON, NOTE  74 VOLUME  8
-                0x98,0xac,0x08, //     24 T1 ON, NOTE  44 VOLUME  8
-                0x98,0xcc,0x08, //     24 T1 ON, NOTE  76 VOLUME  8
-                0x98,0xd3,0x05, //     24 T1 ON, NOTE  83 VOLUME  5
-                0x98,0xcc,0x08, //     24 T1 ON, NOTE  76 VOLUME  8
-                0x98,0xab,0x08, //     24 T1 ON, NOTE  43 VOLUME  8
-                0x98,0xcc,0x08, //     24 T1 ON, NOTE  76 VOLUME  8
-                0x98,0xd1,0x05, //     24 T1 ON, NOTE  81 VOLUME  5
-                0x98,0xcc,0x08, //     24 T1 ON, NOTE  76 VOLUME  8
-                0x98,0xaa,0x08, //     24 T1 ON, NOTE  42 VOLUME  8
-                0x98,0xca,0x08, //     24 T1 ON, NOTE  74 VOLUME  8
-                0x98,0xaa,0x08, //     24 T1 ON, NOTE  42 VOLUME  8
-                0x98,0xca,0x08, //     24 T1 ON, NOTE  74 VOLUME  8
-                0x98,0xab,0x08, //     24 T1 ON, NOTE  43 VOLUME  8
-                0x98,0xca,0x08, //     24 T1 ON, NOTE  74 VOLUME  8
-                0x98,0xab,0x08, //     24 T1 ON, NOTE  43 VOLUME  8
-                0x98,0xca,0x08, //     24 T1 ON, NOTE  74 VOLUME  8
-                0x98,0xad,0x08, //     24 T1 ON, NOTE  45 VOLUME  8
-                0x98,0xc5,0x08, //     24 T1 ON, NOTE  69 VOLUME  8
-                0x98,0xad,0x08, //     24 T1 ON, NOTE  45 VOLUME  8
-                0x98,0xc5,0x08, //     24 T1 ON, NOTE  69 VOLUME  8
-                0x98,0xa1,0x08, //     24 T1 ON, NOTE  33 VOLUME  8
-                0x98,0xc5,0x08, //     24 T1 ON, NOTE  69 VOLUME  8
-                0x98,0xa1,0x08, //     24 T1 ON, NOTE  33 VOLUME  8
-                0x98,0xc5,0x08, //     24 T1 ON, NOTE  69 VOLUME  8
-                0x98,0xa6,0x08, //     24 T1 ON, NOTE  38 VOLUME  8
-                     0xb0,0x01, //     48 BOTH OFF
-                0xe0,0xbe,0x05, //     96 T1 ON, NOTE  62 VOLUME  5
-                0xb0,0xc0,0x05, //     48 T1 ON, NOTE  64 VOLUME  5
-                0xb0,0xc2,0x05, //     48 T1 ON, NOTE  66 VOLUME  5
-                0xb0,0xc3,0x05, //     48 T1 ON, NOTE  67 VOLUME  5
-                0xb0,0xc4,0x05, //     48 T1 ON, NOTE  68 VOLUME  5
-                0xb0,0xc7,0x05, //     48 T1 ON, NOTE  71 VOLUME  5
-                0xb0,0xbd,0x08, //     48 T1 ON, NOTE  61 VOLUME  8
-                0xb0,0xc2,0x08, //     48 T1 ON, NOTE  66 VOLUME  8
-                0xb0,0xbe,0x05, //     48 T1 ON, NOTE  62 VOLUME  5
-                0xb0,0xc0,0x05, //     48 T1 ON, NOTE  64 VOLUME  5
-                0xb0,0xc2,0x05, //     48 T1 ON, NOTE  66 VOLUME  5
-                0xb0,0xc3,0x05, //     48 T1 ON, NOTE  67 VOLUME  5
-                0xb0,0xc4,0x05, //     48 T1 ON, NOTE  68 VOLUME  5
-                0xb0,0xc7,0x05, //     48 T1 ON, NOTE  71 VOLUME  5
-                0xb0,0xbd,0x08, //     48 T1 ON, NOTE  61 VOLUME  8
-                0xb0,0xc2,0x08, //     48 T1 ON, NOTE  66 VOLUME  8
-                0xb0,0xbe,0x05, //     48 T1 ON, NOTE  62 VOLUME  5
-                0xb0,0xc0,0x05, //     48 T1 ON, NOTE  64 VOLUME  5
-                0xb0,0xc1,0x05, //     48 T1 ON, NOTE  65 VOLUME  5
-                0xb0,0xc3,0x05, //     48 T1 ON, NOTE  67 VOLUME  5
-                0xb0,0xc5,0x05, //     48 T1 ON, NOTE  69 VOLUME  5
-                0xb0,0xc6,0x05, //     48 T1 ON, NOTE  70 VOLUME  5
-           0x01,0x90,0xcc,0x05, //    144 T1 ON, NOTE  76 VOLUME  5
-                0xb0,0xcd,0x05, //     48 T1 ON, NOTE  77 VOLUME  5
-                0xb0,0xce,0x05, //     48 T1 ON, NOTE  78 VOLUME  5
-                0xb0,0xcf,0x08, //     48 T1 ON, NOTE  79 VOLUME  8
-                0xb0,0xc9,0x08, //     48 T1 ON, NOTE  73 VOLUME  8
-                0xb0,0xc8,0x08, //     48 T1 ON, NOTE  72 VOLUME  8
-                0xb0,0xcc,0x05, //     48 T1 ON, NOTE  76 VOLUME  5
-                0xb0,0xcd,0x05, //     48 T1 ON, NOTE  77 VOLUME  5
-                0xb0,0xc5,0x05, //     48 T1 ON, NOTE  69 VOLUME  5
-                0xb0,0xb7,0x08, //     48 T1 ON, NOTE  55 VOLUME  8
-                0xb0,0xc6,0x05, //     48 T1 ON, NOTE  70 VOLUME  5
-                0xb0,0xcb,0x05, //     48 T1 ON, NOTE  75 VOLUME  5
-                0xb0,0xc3,0x05, //     48 T1 ON, NOTE  67 VOLUME  5
-                0xb0,0xc9,0x05, //     48 T1 ON, NOTE  73 VOLUME  5
-                0xb0,0xcc,0x05, //     48 T1 ON, NOTE  76 VOLUME  5
-                0xb0,0xba,0x08, //     48 T1 ON, NOTE  58 VOLUME  8
-                0xb0,0xc6,0x05, //     48 T1 ON, NOTE  70 VOLUME  5
-                0xb0,0xb7,0x08, //     48 T1 ON, NOTE  55 VOLUME  8
-                0x8c,0xcc,0x08, //     12 T1 ON, NOTE  76 VOLUME  8
-                0x8c,0xca,0x08, //     12 T1 ON, NOTE  74 VOLUME  8
-                0x8c,0xcc,0x08, //     12 T1 ON, NOTE  76 VOLUME  8
-                0x8c,0xb4,0x08, //     12 T1 ON, NOTE  52 VOLUME  8
-                0x8c,0xcc,0x08, //     12 T1 ON, NOTE  76 VOLUME  8
-                0x8c,0xca,0x08, //     12 T1 ON, NOTE  74 VOLUME  8
-                0x8c,0xcc,0x08, //     12 T1 ON, NOTE  76 VOLUME  8
-                0x8c,0xb9,0x08, //     12 T1 ON, NOTE  57 VOLUME  8
-                0x8c,0xcc,0x08, //     12 T1 ON, NOTE  76 VOLUME  8
-                0x8c,0xca,0x08, //     12 T1 ON, NOTE  74 VOLUME  8
-                0x8c,0xcc,0x08, //     12 T1 ON, NOTE  76 VOLUME  8
-                0x8c,0xb9,0x08, //     12 T1 ON, NOTE  57 VOLUME  8
-                0x8c,0xcc,0x08, //     12 T1 ON, NOTE  76 VOLUME  8
-                0x8c,0xca,0x08, //     12 T1 ON, NOTE  74 VOLUME  8
-                0x8c,0xcc,0x08, //     12 T1 ON, NOTE  76 VOLUME  8
-                0x8c,0xb2,0x08, //     12 T1 ON, NOTE  50 VOLUME  8
-                0x98,0xb9,0x08, //     24 T1 ON, NOTE  57 VOLUME  8
-                0x98,0xb6,0x08, //     24 T1 ON, NOTE  54 VOLUME  8
-                0x98,0xb9,0x08, //     24 T1 ON, NOTE  57 VOLUME  8
-                0x98,0xb6,0x08, //     24 T1 ON, NOTE  54 VOLUME  8
-                0x98,0xb9,0x08, //     24 T1 ON, NOTE  57 VOLUME  8
-                0x98,0xb6,0x08, //     24 T1 ON, NOTE  54 VOLUME  8
-                0x98,0xb9,0x08, //     24 T1 ON, NOTE  57 VOLUME  8
-                0x98,0xb2,0x08, //     24 T1 ON, NOTE  50 VOLUME  8
-                0x98,0xb9,0x08, //     24 T1 ON, NOTE  57 VOLUME  8
-                0x98,0xb6,0x08, //     24 T1 ON, NOTE  54 VOLUME  8
-                0x98,0xb9,0x08, //     24 T1 ON, NOTE  57 VOLUME  8
-                0x98,0xb6,0x08, //     24 T1 ON, NOTE  54 VOLUME  8
-                0x98,0xb9,0x08, //     24 T1 ON, NOTE  57 VOLUME  8
-                0x98,0xb6,0x08, //     24 T1 ON, NOTE  54 VOLUME  8
-                0x98,0xb9,0x08, //     24 T1 ON, NOTE  57 VOLUME  8
-                0x98,0xb2,0x08, //     24 T1 ON, NOTE  50 VOLUME  8
-                0x98,0xb9,0x08, //     24 T1 ON, NOTE  57 VOLUME  8
-                0x98,0xb7,0x08, //     24 T1 ON, NOTE  55 VOLUME  8
-                0x98,0xb9,0x08, //     24 T1 ON, NOTE  57 VOLUME  8
-                0x98,0xb4,0x08, //     24 T1 ON, NOTE  52 VOLUME  8
-                0x98,0xb7,0x08, //     24 T1 ON, NOTE  55 VOLUME  8
-                0x98,0xb4,0x08, //     24 T1 ON, NOTE  52 VOLUME  8
-                0x98,0xb7,0x08, //     24 T1 ON, NOTE  55 VOLUME  8
-                0x98,0xb2,0x08, //     24 T1 ON, NOTE  50 VOLUME  8
-                0x98,0xb9,0x08, //     24 T1 ON, NOTE  57 VOLUME  8
-                0x98,0xb6,0x08, //     24 T1 ON, NOTE  54 VOLUME  8
-                0x98,0xb9,0x08, //     24 T1 ON, NOTE  57 VOLUME  8
-                0x98,0xb7,0x08, //     24 T1 ON, NOTE  55 VOLUME  8
-                0x98,0xbd,0x08, //     24 T1 ON, NOTE  61 VOLUME  8
-                0x98,0xb7,0x08, //     24 T1 ON, NOTE  55 VOLUME  8
-                0x98,0xbd,0x08, //     24 T1 ON, NOTE  61 VOLUME  8
-                0x98,0xb2,0x08, //     24 T1 ON, NOTE  50 VOLUME  8
-                0x98,0xb9,0x08, //     24 T1 ON, NOTE  57 VOLUME  8
-                0x98,0xb6,0x08, //     24 T1 ON, NOTE  54 VOLUME  8
-                0x98,0xb9,0x08, //     24 T1 ON, NOTE  57 VOLUME  8
-                0x88,0xd1,0x08, //      8 T1 ON, NOTE  81 VOLUME  8
-                0x88,0xcf,0x08, //      8 T1 ON, NOTE  79 VOLUME  8
-                0x88,0xb6,0x08, //      8 T1 ON, NOTE  54 VOLUME  8
-                0x98,0xb9,0x08, //     24 T1 ON, NOTE  57 VOLUME  8
-                0x98,0xb6,0x08, //     24 T1 ON, NOTE  54 VOLUME  8
-                0x98,0xb9,0x08, //     24 T1 ON, NOTE  57 VOLUME  8
-                0x98,0xb6,0x08, //     24 T1 ON, NOTE  54 VOLUME  8
-                0x98,0xbe,0x08, //     24 T1 ON, NOTE  62 VOLUME  8
-                0x98,0xb9,0x08, //     24 T1 ON, NOTE  57 VOLUME  8
-                0x98,0xbe,0x08, //     24 T1 ON, NOTE  62 VOLUME  8
-                0x98,0xb9,0x08, //     24 T1 ON, NOTE  57 VOLUME  8
-                0x98,0xbe,0x08, //     24 T1 ON, NOTE  62 VOLUME  8
-                0x98,0xb9,0x08, //     24 T1 ON, NOTE  57 VOLUME  8
-                0x98,0xbe,0x08, //     24 T1 ON, NOTE  62 VOLUME  8
-                0x98,0xb7,0x08, //     24 T1 ON, NOTE  55 VOLUME  8
-                0x98,0xc0,0x08, //     24 T1 ON, NOTE  64 VOLUME  8
-                0x98,0xbb,0x08, //     24 T1 ON, NOTE  59 VOLUME  8
-                0x98,0xc0,0x08, //     24 T1 ON, NOTE  64 VOLUME  8
-                0x98,0xbb,0x08, //     24 T1 ON, NOTE  59 VOLUME  8
-                0x98,0xc0,0x08, //     24 T1 ON, NOTE  64 VOLUME  8
-                0x98,0xbb,0x08, //     24 T1 ON, NOTE  59 VOLUME  8
-                0x98,0xc0,0x08, //     24 T1 ON, NOTE  64 VOLUME  8
-                0x98,0xb9,0x08, //     24 T1 ON, NOTE  57 VOLUME  8
-                0x98,0xc3,0x08, //     24 T1 ON, NOTE  67 VOLUME  8
-                0x98,0xc0,0x08, //     24 T1 ON, NOTE  64 VOLUME  8
-                0x98,0xc3,0x08, //     24 T1 ON, NOTE  67 VOLUME  8
-                0x98,0xc0,0x08, //     24 T1 ON, NOTE  64 VOLUME  8
-                0x98,0xc3,0x08, //     24 T1 ON, NOTE  67 VOLUME  8
-                0x98,0xc0,0x08, //     24 T1 ON, NOTE  64 VOLUME  8
-                0x98,0xc3,0x08, //     24 T1 ON, NOTE  67 VOLUME  8
-                0x98,0xb2,0x08, //     24 T1 ON, NOTE  50 VOLUME  8
-                0x98,0xbe,0x08, //     24 T1 ON, NOTE  62 VOLUME  8
-                0x98,0xb9,0x08, //     24 T1 ON, NOTE  57 VOLUME  8
-                0x98,0xbe,0x08, //     24 T1 ON, NOTE  62 VOLUME  8
-                0x98,0xb9,0x08, //     24 T1 ON, NOTE  57 VOLUME  8
-                0x98,0xbe,0x08, //     24 T1 ON, NOTE  62 VOLUME  8
-                0x98,0xb9,0x08, //     24 T1 ON, NOTE  57 VOLUME  8
-                0x98,0xbe,0x08, //     24 T1 ON, NOTE  62 VOLUME  8
-                0x98,0xb2,0x08, //     24 T1 ON, NOTE  50 VOLUME  8
-                0x98,0xb9,0x08, //     24 T1 ON, NOTE  57 VOLUME  8
-                0x98,0xb6,0x08, //     24 T1 ON, NOTE  54 VOLUME  8
-                0x98,0xb9,0x08, //     24 T1 ON, NOTE  57 VOLUME  8
-                0x98,0xb6,0x08, //     24 T1 ON, NOTE  54 VOLUME  8
-                0x98,0xb9,0x08, //     24 T1 ON, NOTE  57 VOLUME  8
-                0x98,0xc2,0x05, //     24 T1 ON, NOTE  66 VOLUME  5
-                0x98,0xb9,0x08, //     24 T1 ON, NOTE  57 VOLUME  8
-                0x98,0xb2,0x08, //     24 T1 ON, NOTE  50 VOLUME  8
-                0x98,0xb9,0x08, //     24 T1 ON, NOTE  57 VOLUME  8
-                0x98,0xb7,0x08, //     24 T1 ON, NOTE  55 VOLUME  8
-                0x98,0xb9,0x08, //     24 T1 ON, NOTE  57 VOLUME  8
-                0x98,0xb4,0x08, //     24 T1 ON, NOTE  52 VOLUME  8
-                0x98,0xb7,0x08, //     24 T1 ON, NOTE  55 VOLUME  8
-                0x98,0xb4,0x08, //     24 T1 ON, NOTE  52 VOLUME  8
-                0x98,0xb7,0x08, //     24 T1 ON, NOTE  55 VOLUME  8
-                0x98,0xb2,0x08, //     24 T1 ON, NOTE  50 VOLUME  8
-                0x98,0xb9,0x08, //     24 T1 ON, NOTE  57 VOLUME  8
-                0x98,0xc5,0x05, //     24 T1 ON, NOTE  69 VOLUME  5
-                0x98,0xb9,0x08, //     24 T1 ON, NOTE  57 VOLUME  8
-                0x98,0xc5,0x05, //     24 T1 ON, NOTE  69 VOLUME  5
-                0x98,0xb9,0x08, //     24 T1 ON, NOTE  57 VOLUME  8
-                0x98,0xc5,0x05, //     24 T1 ON, NOTE  69 VOLUME  5
-                0x98,0xb9,0x08, //     24 T1 ON, NOTE  57 VOLUME  8
-                0x98,0xb2,0x08, //     24 T1 ON, NOTE  50 VOLUME  8
-                0x98,0xb9,0x08, //     24 T1 ON, NOTE  57 VOLUME  8
-                0x98,0xb6,0x08, //     24 T1 ON, NOTE  54 VOLUME  8
-                0x98,0xb9,0x08, //     24 T1 ON, NOTE  57 VOLUME  8
-                0x88,0xd1,0x08, //      8 T1 ON, NOTE  81 VOLUME  8
-                0x88,0xcf,0x08, //      8 T1 ON, NOTE  79 VOLUME  8
-                0x88,0xb6,0x08, //      8 T1 ON, NOTE  54 VOLUME  8
-                0x98,0xb9,0x08, //     24 T1 ON, NOTE  57 VOLUME  8
-                0x98,0xb6,0x08, //     24 T1 ON, NOTE  54 VOLUME  8
-                0x98,0xb9,0x08, //     24 T1 ON, NOTE  57 VOLUME  8
-                0x98,0xaa,0x08, //     24 T1 ON, NOTE  42 VOLUME  8
-                0x98,0xb2,0x08, //     24 T1 ON, NOTE  50 VOLUME  8
-                0x98,0xad,0x08, //     24 T1 ON, NOTE  45 VOLUME  8
-                0x98,0xb2,0x08, //     24 T1 ON, NOTE  50 VOLUME  8
-                0x98,0xad,0x08, //     24 T1 ON, NOTE  45 VOLUME  8
-                0x98,0xb2,0x08, //     24 T1 ON, NOTE  50 VOLUME  8
-                0x98,0xc2,0x05, //     24 T1 ON, NOTE  66 VOLUME  5
-                0x98,0xb2,0x08, //     24 T1 ON, NOTE  50 VOLUME  8
-                0x98,0xab,0x08, //     24 T1 ON, NOTE  43 VOLUME  8
-                0x98,0xb4,0x08, //     24 T1 ON, NOTE  52 VOLUME  8
-                0x98,0xc3,0x05, //     24 T1 ON, NOTE  67 VOLUME  5
-                0x98,0xb4,0x08, //     24 T1 ON, NOTE  52 VOLUME  8
-                0x98,0xc7,0x05, //     24 T1 ON, NOTE  71 VOLUME  5
-                0x98,0xb4,0x08, //     24 T1 ON, NOTE  52 VOLUME  8
-                0x98,0xc7,0x05, //     24 T1 ON, NOTE  71 VOLUME  5
-                0x98,0xb4,0x08, //     24 T1 ON, NOTE  52 VOLUME  8
-                0x98,0xad,0x08, //     24 T1 ON, NOTE  45 VOLUME  8
-                0x98,0xb7,0x08, //     24 T1 ON, NOTE  55 VOLUME  8
-                0x98,0xc0,0x05, //     24 T1 ON, NOTE  64 VOLUME  5
-                0x98,0xb7,0x08, //     24 T1 ON, NOTE  55 VOLUME  8
-                0x98,0xbd,0x05, //     24 T1 ON, NOTE  61 VOLUME  5
-                0x98,0xb7,0x08, //     24 T1 ON, NOTE  55 VOLUME  8
-                0x98,0xbd,0x05, //     24 T1 ON, NOTE  61 VOLUME  5
-                0x98,0xb7,0x08, //     24 T1 ON, NOTE  55 VOLUME  8
-                0x98,0xb2,0x08, //     24 T1 ON, NOTE  50 VOLUME  8
-                0x98,0xbd,0x08, //     24 T1 ON, NOTE  61 VOLUME  8
-                0x98,0xbb,0x08, //     24 T1 ON, NOTE  59 VOLUME  8
-                0x98,0xb9,0x08, //     24 T1 ON, NOTE  57 VOLUME  8
-                0x98,0xb2,0x08, //     24 T1 ON, NOTE  50 VOLUME  8
-                0x98,0xb9,0x08, //     24 T1 ON, NOTE  57 VOLUME  8
-                0x98,0xbb,0x08, //     24 T1 ON, NOTE  59 VOLUME  8
-                0x98,0xbd,0x08, //     24 T1 ON, NOTE  61 VOLUME  8
-                0x98,0xb2,0x08, //     24 T1 ON, NOTE  50 VOLUME  8
-                0x98,0xbd,0x08, //     24 T1 ON, NOTE  61 VOLUME  8
-                0x98,0xbe,0x08, //     24 T1 ON, NOTE  62 VOLUME  8
-                0x98,0xc2,0x08, //     24 T1 ON, NOTE  66 VOLUME  8
-                0x98,0xb2,0x08, //     24 T1 ON, NOTE  50 VOLUME  8
-                0x98,0xbe,0x08, //     24 T1 ON, NOTE  62 VOLUME  8
-                0x98,0xc0,0x08, //     24 T1 ON, NOTE  64 VOLUME  8
-                0x98,0xc3,0x08, //     24 T1 ON, NOTE  67 VOLUME  8
-                0x98,0xb2,0x08, //     24 T1 ON, NOTE  50 VOLUME  8
-                0x98,0xc0,0x08, //     24 T1 ON, NOTE  64 VOLUME  8
-                0x98,0xbe,0x08, //     24 T1 ON, NOTE  62 VOLUME  8
-                0x98,0xbd,0x08, //     24 T1 ON, NOTE  61 VOLUME  8
-                0x98,0xb2,0x08, //     24 T1 ON, NOTE  50 VOLUME  8
-                0x98,0xbd,0x08, //     24 T1 ON, NOTE  61 VOLUME  8
-                0x98,0xbe,0x08, //     24 T1 ON, NOTE  62 VOLUME  8
-                0x98,0xc0,0x08, //     24 T1 ON, NOTE  64 VOLUME  8
-                0x98,0xb2,0x08, //     24 T1 ON, NOTE  50 VOLUME  8
-                0x98,0xc0,0x08, //     24 T1 ON, NOTE  64 VOLUME  8
-                0x98,0xc2,0x08, //     24 T1 ON, NOTE  66 VOLUME  8
-                0x98,0xc5,0x08, //     24 T1 ON, NOTE  69 VOLUME  8
-                0x98,0xb2,0x08, //     24 T1 ON, NOTE  50 VOLUME  8
-                0x98,0xc2,0x08, //     24 T1 ON, NOTE  66 VOLUME  8
-                0x98,0xc3,0x08, //     24 T1 ON, NOTE  67 VOLUME  8
-                0x98,0xc7,0x08, //     24 T1 ON, NOTE  71 VOLUME  8
-                0x98,0xb2,0x08, //     24 T1 ON, NOTE  50 VOLUME  8
-                0x98,0xc3,0x08, //     24 T1 ON, NOTE  67 VOLUME  8
-                0x98,0xc2,0x08, //     24 T1 ON, NOTE  66 VOLUME  8
-                0x98,0xc0,0x08, //     24 T1 ON, NOTE  64 VOLUME  8
-                0x98,0xb2,0x08, //     24 T1 ON, NOTE  50 VOLUME  8
-                0x98,0xc0,0x08, //     24 T1 ON, NOTE  64 VOLUME  8
-                0x98,0xc2,0x08, //     24 T1 ON, NOTE  66 VOLUME  8
-                0x98,0xc3,0x08, //     24 T1 ON, NOTE  67 VOLUME  8
-                0x98,0xb2,0x08, //     24 T1 ON, NOTE  50 VOLUME  8
-                0x98,0xc3,0x08, //     24 T1 ON, NOTE  67 VOLUME  8
-                0x98,0xc2,0x08, //     24 T1 ON, NOTE  66 VOLUME  8
-                0x98,0xc3,0x08, //     24 T1 ON, NOTE  67 VOLUME  8
-                0x98,0xb2,0x08, //     24 T1 ON, NOTE  50 VOLUME  8
-                0x98,0xc7,0x08, //     24 T1 ON, NOTE  71 VOLUME  8
-                0x98,0xc8,0x08, //     24 T1 ON, NOTE  72 VOLUME  8
-                0x98,0xc5,0x08, //     24 T1 ON, NOTE  69 VOLUME  8
-                0x98,0xb2,0x08, //     24 T1 ON, NOTE  50 VOLUME  8
-                0x98,0xc5,0x08, //     24 T1 ON, NOTE  69 VOLUME  8
-                0x98,0xc3,0x08, //     24 T1 ON, NOTE  67 VOLUME  8
-                0x98,0xc5,0x08, //     24 T1 ON, NOTE  69 VOLUME  8
-                0x98,0xb2,0x08, //     24 T1 ON, NOTE  50 VOLUME  8
-                0x98,0xc8,0x08, //     24 T1 ON, NOTE  72 VOLUME  8
-                0x98,0xca,0x08, //     24 T1 ON, NOTE  74 VOLUME  8
-                0x98,0xc7,0x08, //     24 T1 ON, NOTE  71 VOLUME  8
-                0x98,0xb2,0x08, //     24 T1 ON, NOTE  50 VOLUME  8
-                0x98,0xc7,0x08, //     24 T1 ON, NOTE  71 VOLUME  8
-                0x98,0xc5,0x08, //     24 T1 ON, NOTE  69 VOLUME  8
-                0x98,0xc7,0x08, //     24 T1 ON, NOTE  71 VOLUME  8
-                0x98,0xb2,0x08, //     24 T1 ON, NOTE  50 VOLUME  8
-                0x98,0xca,0x08, //     24 T1 ON, NOTE  74 VOLUME  8
-                0x98,0xcc,0x08, //     24 T1 ON, NOTE  76 VOLUME  8
-                0x98,0xc9,0x08, //     24 T1 ON, NOTE  73 VOLUME  8
-                0x98,0xb2,0x08, //     24 T1 ON, NOTE  50 VOLUME  8
-                0x98,0xc9,0x08, //     24 T1 ON, NOTE  73 VOLUME  8
-                0x98,0xc7,0x08, //     24 T1 ON, NOTE  71 VOLUME  8
-                0x98,0xc5,0x08, //     24 T1 ON, NOTE  69 VOLUME  8
-                0x98,0xb2,0x08, //     24 T1 ON, NOTE  50 VOLUME  8
-                0x98,0xc5,0x08, //     24 T1 ON, NOTE  69 VOLUME  8
-                0x98,0xc7,0x08, //     24 T1 ON, NOTE  71 VOLUME  8
-                0x98,0xc9,0x08, //     24 T1 ON, NOTE  73 VOLUME  8
-                0x98,0xb2,0x08, //     24 T1 ON, NOTE  50 VOLUME  8
-                0x98,0xc9,0x08, //     24 T1 ON, NOTE  73 VOLUME  8
-                0x98,0xca,0x08, //     24 T1 ON, NOTE  74 VOLUME  8
-                0x98,0xce,0x08, //     24 T1 ON, NOTE  78 VOLUME  8
-                0x98,0xb2,0x08, //     24 T1 ON, NOTE  50 VOLUME  8
-                0x98,0xca,0x08, //     24 T1 ON, NOTE  74 VOLUME  8
-                0x98,0xcc,0x08, //     24 T1 ON, NOTE  76 VOLUME  8
-                0x98,0xcf,0x08, //     24 T1 ON, NOTE  79 VOLUME  8
-                0x98,0xb2,0x08, //     24 T1 ON, NOTE  50 VOLUME  8
-                0x98,0xcc,0x08, //     24 T1 ON, NOTE  76 VOLUME  8
-                0x98,0xca,0x08, //     24 T1 ON, NOTE  74 VOLUME  8
-                0x98,0xc9,0x08, //     24 T1 ON, NOTE  73 VOLUME  8
-                0x98,0xb2,0x08, //     24 T1 ON, NOTE  50 VOLUME  8
-                0x98,0xc9,0x08, //     24 T1 ON, NOTE  73 VOLUME  8
-                0x98,0xca,0x08, //     24 T1 ON, NOTE  74 VOLUME  8
-                0x98,0xcc,0x08, //     24 T1 ON, NOTE  76 VOLUME  8
-                0x98,0xb2,0x08, //     24 T1 ON, NOTE  50 VOLUME  8
-                0x98,0xcc,0x08, //     24 T1 ON, NOTE  76 VOLUME  8
-                0x98,0xce,0x08, //     24 T1 ON, NOTE  78 VOLUME  8
-                0x98,0xd1,0x08, //     24 T1 ON, NOTE  81 VOLUME  8
-                0x98,0xb2,0x08, //     24 T1 ON, NOTE  50 VOLUME  8
-                0x98,0xce,0x08, //     24 T1 ON, NOTE  78 VOLUME  8
-                0x98,0xcf,0x08, //     24 T1 ON, NOTE  79 VOLUME  8
-                0x98,0xd3,0x08, //     24 T1 ON, NOTE  83 VOLUME  8
-                0x98,0xb2,0x08, //     24 T1 ON, NOTE  50 VOLUME  8
-                0x98,0xcf,0x08, //     24 T1 ON, NOTE  79 VOLUME  8
-                0x98,0xbe,0x08, //     24 T1 ON, NOTE  62 VOLUME  8
-                0x98,0xcc,0x08, //     24 T1 ON, NOTE  76 VOLUME  8
-                0x98,0xb2,0x08, //     24 T1 ON, NOTE  50 VOLUME  8
-                0x98,0xcc,0x08, //     24 T1 ON, NOTE  76 VOLUME  8
-                0x98,0xbe,0x08, //     24 T1 ON, NOTE  62 VOLUME  8
-                0x98,0xcf,0x08, //     24 T1 ON, NOTE  79 VOLUME  8
-                0x98,0xb2,0x08, //     24 T1 ON, NOTE  50 VOLUME  8
-                0x98,0xcf,0x08, //     24 T1 ON, NOTE  79 VOLUME  8
-                0x98,0xbc,0x08, //     24 T1 ON, NOTE  60 VOLUME  8
-                0x98,0xcf,0x08, //     24 T1 ON, NOTE  79 VOLUME  8
-                0x98,0xb2,0x08, //     24 T1 ON, NOTE  50 VOLUME  8
-                0x98,0xd3,0x08, //     24 T1 ON, NOTE  83 VOLUME  8
-                0x98,0xbc,0x08, //     24 T1 ON, NOTE  60 VOLUME  8
-                0x98,0xd1,0x08, //     24 T1 ON, NOTE  81 VOLUME  8
-                0x98,0xcf,0x05, //     24 T1 ON, NOTE  79 VOLUME  5
-                0x98,0xbe,0x08, //     24 T1 ON, NOTE  62 VOLUME  8
-                0x98,0xcf,0x05, //     24 T1 ON, NOTE  79 VOLUME  5
-                0x98,0xbe,0x08, //     24 T1 ON, NOTE  62 VOLUME  8
-                0x98,0xce,0x05, //     24 T1 ON, NOTE  78 VOLUME  5
-                0x98,0xbe,0x08, //     24 T1 ON, NOTE  62 VOLUME  8
-                0x98,0xce,0x05, //     24 T1 ON, NOTE  78 VOLUME  5
-                0x98,0xbe,0x08, //     24 T1 ON, NOTE  62 VOLUME  8
-                0x98,0xcf,0x05, //     24 T1 ON, NOTE  79 VOLUME  5
-                0x98,0xbe,0x08, //     24 T1 ON, NOTE  62 VOLUME  8
-                0x98,0xce,0x05, //     24 T1 ON, NOTE  78 VOLUME  5
-                0x98,0xbe,0x08, //     24 T1 ON, NOTE  62 VOLUME  8
-                0x98,0xcf,0x05, //     24 T1 ON, NOTE  79 VOLUME  5
-                0x98,0xbe,0x08, //     24 T1 ON, NOTE  62 VOLUME  8
-                0x98,0xcf,0x05, //     24 T1 ON, NOTE  79 VOLUME  5
-                0x98,0xbe,0x08, //     24 T1 ON, NOTE  62 VOLUME  8
-                0x98,0xb2,0x08, //     24 T1 ON, NOTE  50 VOLUME  8
-                0x98,0xca,0x08, //     24 T1 ON, NOTE  74 VOLUME  8
-                0x98,0xd6,0x08, //     24 T1 ON, NOTE  86 VOLUME  8
-                0x98,0xca,0x08, //     24 T1 ON, NOTE  74 VOLUME  8
-                0x98,0xd6,0x08, //     24 T1 ON, NOTE  86 VOLUME  8
-                0x98,0xca,0x08, //     24 T1 ON, NOTE  74 VOLUME  8
-                0x98,0xab,0x08, //     24 T1 ON, NOTE  43 VOLUME  8
-                0x98,0xca,0x08, //     24 T1 ON, NOTE  74 VOLUME  8
-                0x98,0xaa,0x08, //     24 T1 ON, NOTE  42 VOLUME  8
-                0x98,0xca,0x08, //     24 T1 ON, NOTE  74 VOLUME  8
-                0x98,0xa6,0x08, //     24 T1 ON, NOTE  38 VOLUME  8
-                0x98,0xca,0x08, //     24 T1 ON, NOTE  74 VOLUME  8
-                0x98,0xd6,0x08, //     24 T1 ON, NOTE  86 VOLUME  8
-                0x98,0xca,0x08, //     24 T1 ON, NOTE  74 VOLUME  8
-                0x98,0xab,0x08, //     24 T1 ON, NOTE  43 VOLUME  8
-                0x98,0xca,0x08, //     24 T1 ON, NOTE  74 VOLUME  8
-                0x98,0xaa,0x08, //     24 T1 ON, NOTE  42 VOLUME  8
-                0x98,0xca,0x08, //     24 T1 ON, NOTE  74 VOLUME  8
-                0x98,0xa6,0x08, //     24 T1 ON, NOTE  38 VOLUME  8
-                0x98,0xca,0x08, //     24 T1 ON, NOTE  74 VOLUME  8
-                0x98,0xd6,0x08, //     24 T1 ON, NOTE  86 VOLUME  8
-                0x98,0xca,0x08, //     24 T1 ON, NOTE  74 VOLUME  8
-                0x98,0xab,0x08, //     24 T1 ON, NOTE  43 VOLUME  8
-                0x98,0xca,0x08, //     24 T1 ON, NOTE  74 VOLUME  8
-                0x98,0xaa,0x08, //     24 T1 ON, NOTE  42 VOLUME  8
-                0x98,0xca,0x08, //     24 T1 ON, NOTE  74 VOLUME  8
-                0x98,0xa6,0x08, //     24 T1 ON, NOTE  38 VOLUME  8
-                0x98,0xca,0x08, //     24 T1 ON, NOTE  74 VOLUME  8
-                0x98,0xaa,0x08, //     24 T1 ON, NOTE  42 VOLUME  8
-                0x98,0xca,0x08, //     24 T1 ON, NOTE  74 VOLUME  8
-                0x98,0xab,0x08, //     24 T1 ON, NOTE  43 VOLUME  8
-                0x98,0xca,0x08, //     24 T1 ON, NOTE  74 VOLUME  8
-                0x98,0xaa,0x08, //     24 T1 ON, NOTE  42 VOLUME  8
-                     0x98,0x01, //     24 BOTH OFF
-                0x98,0xa6,0x08, //     24 T1 ON, NOTE  38 VOLUME  8
-                0x98,0xd1,0x08, //     24 T1 ON, NOTE  81 VOLUME  8
-                0xc8,0xad,0x08, //     72 T1 ON, NOTE  45 VOLUME  8
-                0x98,0xd1,0x08, //     24 T1 ON, NOTE  81 VOLUME  8
-                0x98,0xaa,0x08, //     24 T1 ON, NOTE  42 VOLUME  8
-                0x98,0xd1,0x08, //     24 T1 ON, NOTE  81 VOLUME  8
-                0x98,0xa6,0x08, //     24 T1 ON, NOTE  38 VOLUME  8
-                0x98,0xd1,0x08, //     24 T1 ON, NOTE  81 VOLUME  8
-                0xc8,0xad,0x08, //     72 T1 ON, NOTE  45 VOLUME  8
-                0x98,0xd1,0x08, //     24 T1 ON, NOTE  81 VOLUME  8
-                0x98,0xaa,0x08, //     24 T1 ON, NOTE  42 VOLUME  8
-                0x98,0xd1,0x08, //     24 T1 ON, NOTE  81 VOLUME  8
-                0x98,0xa6,0x08, //     24 T1 ON, NOTE  38 VOLUME  8
-                0x98,0xd1,0x08, //     24 T1 ON, NOTE  81 VOLUME  8
-                0xc8,0xad,0x08, //     72 T1 ON, NOTE  45 VOLUME  8
-                0x98,0xd1,0x08, //     24 T1 ON, NOTE  81 VOLUME  8
-                0x98,0xaa,0x08, //     24 T1 ON, NOTE  42 VOLUME  8
-                0x98,0xd1,0x08, //     24 T1 ON, NOTE  81 VOLUME  8
-                0x98,0xad,0x08, //     24 T1 ON, NOTE  45 VOLUME  8
-                0x98,0xd1,0x08, //     24 T1 ON, NOTE  81 VOLUME  8
-                0x98,0xaa,0x08, //     24 T1 ON, NOTE  42 VOLUME  8
-                0x98,0xd1,0x08, //     24 T1 ON, NOTE  81 VOLUME  8
-                0x98,0xad,0x08, //     24 T1 ON, NOTE  45 VOLUME  8
-                0x98,0xd1,0x08, //     24 T1 ON, NOTE  81 VOLUME  8
-                0x98,0xa6,0x08, //     24 T1 ON, NOTE  38 VOLUME  8
-                0x98,0xd5,0x08, //     24 T1 ON, NOTE  85 VOLUME  8
-                0x98,0xd3,0x08, //     24 T1 ON, NOTE  83 VOLUME  8
-                0x98,0xd1,0x08, //     24 T1 ON, NOTE  81 VOLUME  8
-                0x98,0xcf,0x08, //     24 T1 ON, NOTE  79 VOLUME  8
-                0x98,0xce,0x08, //     24 T1 ON, NOTE  78 VOLUME  8
-                0x98,0xcc,0x08, //     24 T1 ON, NOTE  76 VOLUME  8
-                0x98,0xbe,0x08, //     24 T1 ON, NOTE  62 VOLUME  8
-                0x98,0xbd,0x08, //     24 T1 ON, NOTE  61 VOLUME  8
-                0x98,0xbb,0x08, //     24 T1 ON, NOTE  59 VOLUME  8
-                0x98,0xb9,0x08, //     24 T1 ON, NOTE  57 VOLUME  8
-                0x98,0xb7,0x08, //     24 T1 ON, NOTE  55 VOLUME  8
-                0x98,0xb6,0x08, //     24 T1 ON, NOTE  54 VOLUME  8
-                0x98,0xb4,0x08, //     24 T1 ON, NOTE  52 VOLUME  8
-                0x98,0xb2,0x08, //     24 T1 ON, NOTE  50 VOLUME  8
-                0x98,0xb1,0x08, //     24 T1 ON, NOTE  49 VOLUME  8
-                0x98,0xaf,0x08, //     24 T1 ON, NOTE  47 VOLUME  8
-                0x98,0xc9,0x08, //     24 T1 ON, NOTE  73 VOLUME  8
-                0x98,0xc7,0x08, //     24 T1 ON, NOTE  71 VOLUME  8
-                0x98,0xc5,0x08, //     24 T1 ON, NOTE  69 VOLUME  8
-                0x98,0xc3,0x08, //     24 T1 ON, NOTE  67 VOLUME  8
-                0x98,0xc2,0x08, //     24 T1 ON, NOTE  66 VOLUME  8
-                0x98,0xc0,0x08, //     24 T1 ON, NOTE  64 VOLUME  8
-                0x98,0xbe,0x08, //     24 T1 ON, NOTE  62 VOLUME  8
-                0x98,0xcc,0x05, //     24 T1 ON, NOTE  76 VOLUME  5
-                0x8c,0xb1,0x08, //     12 T1 ON, NOTE  49 VOLUME  8
-                0x8c,0xca,0x05, //     12 T1 ON, NOTE  74 VOLUME  5
-                0x8c,0xb1,0x08, //     12 T1 ON, NOTE  49 VOLUME  8
-                0x8c,0xc9,0x05, //     12 T1 ON, NOTE  73 VOLUME  5
-                0x8c,0xb1,0x08, //     12 T1 ON, NOTE  49 VOLUME  8
-                0x8c,0xc7,0x05, //     12 T1 ON, NOTE  71 VOLUME  5
-                0x8c,0xb1,0x08, //     12 T1 ON, NOTE  49 VOLUME  8
-                0x8c,0xc5,0x05, //     12 T1 ON, NOTE  69 VOLUME  5
-                0x8c,0xb1,0x08, //     12 T1 ON, NOTE  49 VOLUME  8
-                0x8c,0xc3,0x05, //     12 T1 ON, NOTE  67 VOLUME  5
-                0x8c,0xb1,0x08, //     12 T1 ON, NOTE  49 VOLUME  8
-                0x8c,0xc2,0x05, //     12 T1 ON, NOTE  66 VOLUME  5
-                0x8c,0xb1,0x08, //     12 T1 ON, NOTE  49 VOLUME  8
-                0x8c,0xc0,0x05, //     12 T1 ON, NOTE  64 VOLUME  5
-                0x8c,0xb1,0x08, //     12 T1 ON, NOTE  49 VOLUME  8
-                0x8c,0xbe,0x05, //     12 T1 ON, NOTE  62 VOLUME  5
-                     0xb0,0x01, //     48 BOTH OFF
-                0xb0,0xb2,0x08, //     48 T1 ON, NOTE  50 VOLUME  8
-                     0xb0,0x01, //     48 BOTH OFF
-                0xb0,0xab,0x08, //     48 T1 ON, NOTE  43 VOLUME  8
-                     0xb0,0x01, //     48 BOTH OFF
-                0xb0,0xad,0x08, //     48 T1 ON, NOTE  45 VOLUME  8
-                     0xb0,0x01, //     48 BOTH OFF
-                0xb0,0xa6,0x08, //     48 T1 ON, NOTE  38 VOLUME  8
-                0x98,0xca,0x08, //     24 T1 ON, NOTE  74 VOLUME  8
-                0x98,0xd6,0x08, //     24 T1 ON, NOTE  86 VOLUME  8
-                0x98,0xca,0x08, //     24 T1 ON, NOTE  74 VOLUME  8
-                0x98,0xd6,0x08, //     24 T1 ON, NOTE  86 VOLUME  8
-                0x98,0xca,0x08, //     24 T1 ON, NOTE  74 VOLUME  8
-                0x98,0xab,0x08, //     24 T1 ON, NOTE  43 VOLUME  8
-                0x98,0xca,0x08, //     24 T1 ON, NOTE  74 VOLUME  8
-                0x98,0xaa,0x08, //     24 T1 ON, NOTE  42 VOLUME  8
-                0x98,0xca,0x08, //     24 T1 ON, NOTE  74 VOLUME  8
-                0x98,0xa6,0x08, //     24 T1 ON, NOTE  38 VOLUME  8
-                0x98,0xca,0x08, //     24 T1 ON, NOTE  74 VOLUME  8
-                0x98,0xd6,0x08, //     24 T1 ON, NOTE  86 VOLUME  8
-                0x98,0xca,0x08, //     24 T1 ON, NOTE  74 VOLUME  8
-                0x98,0xab,0x08, //     24 T1 ON, NOTE  43 VOLUME  8
-                0x98,0xca,0x08, //     24 T1 ON, NOTE  74 VOLUME  8
-                0x98,0xaa,0x08, //     24 T1 ON, NOTE  42 VOLUME  8
-                0x98,0xca,0x08, //     24 T1 ON, NOTE  74 VOLUME  8
-                0x98,0xa6,0x08, //     24 T1 ON, NOTE  38 VOLUME  8
-                0x98,0xca,0x08, //     24 T1 ON, NOTE  74 VOLUME  8
-                0x98,0xd6,0x08, //     24 T1 ON, NOTE  86 VOLUME  8
-                0x98,0xca,0x08, //     24 T1 ON, NOTE  74 VOLUME  8
-                0x98,0xab,0x08, //     24 T1 ON, NOTE  43 VOLUME  8
-                0x98,0xca,0x08, //     24 T1 ON, NOTE  74 VOLUME  8
-                0x98,0xaa,0x08, //     24 T1 ON, NOTE  42 VOLUME  8
-                0x98,0xca,0x08, //     24 T1 ON, NOTE  74 VOLUME  8
-                0x98,0xa6,0x08, //     24 T1 ON, NOTE  38 VOLUME  8
-                0x98,0xca,0x08, //     24 T1 ON, NOTE  74 VOLUME  8
-                0x98,0xaa,0x08, //     24 T1 ON, NOTE  42 VOLUME  8
-                0x98,0xca,0x08, //     24 T1 ON, NOTE  74 VOLUME  8
-                0x98,0xab,0x08, //     24 T1 ON, NOTE  43 VOLUME  8
-                0x98,0xca,0x08, //     24 T1 ON, NOTE  74 VOLUME  8
-                0x98,0xaa,0x08, //     24 T1 ON, NOTE  42 VOLUME  8
-                     0x98,0x01, //     24 BOTH OFF
-                0x98,0xa6,0x08, //     24 T1 ON, NOTE  38 VOLUME  8
-                0x98,0xd1,0x08, //     24 T1 ON, NOTE  81 VOLUME  8
-                0xc8,0xad,0x08, //     72 T1 ON, NOTE  45 VOLUME  8
-                0x98,0xd1,0x08, //     24 T1 ON, NOTE  81 VOLUME  8
-                0x98,0xaa,0x08, //     24 T1 ON, NOTE  42 VOLUME  8
-                0x98,0xd1,0x08, //     24 T1 ON, NOTE  81 VOLUME  8
-                0x98,0xa6,0x08, //     24 T1 ON, NOTE  38 VOLUME  8
-                0x98,0xd1,0x08, //     24 T1 ON, NOTE  81 VOLUME  8
-                0xc8,0xad,0x08, //     72 T1 ON, NOTE  45 VOLUME  8
-                0x98,0xd1,0x08, //     24 T1 ON, NOTE  81 VOLUME  8
-                0x98,0xaa,0x08, //     24 T1 ON, NOTE  42 VOLUME  8
-                0x98,0xd1,0x08, //     24 T1 ON, NOTE  81 VOLUME  8
-                0x98,0xa6,0x08, //     24 T1 ON, NOTE  38 VOLUME  8
-                0x98,0xd1,0x08, //     24 T1 ON, NOTE  81 VOLUME  8
-                0xc8,0xad,0x08, //     72 T1 ON, NOTE  45 VOLUME  8
-                0x98,0xd1,0x08, //     24 T1 ON, NOTE  81 VOLUME  8
-                0x98,0xaa,0x08, //     24 T1 ON, NOTE  42 VOLUME  8
-                0x98,0xd1,0x08, //     24 T1 ON, NOTE  81 VOLUME  8
-                0x98,0xad,0x08, //     24 T1 ON, NOTE  45 VOLUME  8
-                0x98,0xd1,0x08, //     24 T1 ON, NOTE  81 VOLUME  8
-                0x98,0xaa,0x08, //     24 T1 ON, NOTE  42 VOLUME  8
-                0x98,0xd1,0x08, //     24 T1 ON, NOTE  81 VOLUME  8
-                0x98,0xad,0x08, //     24 T1 ON, NOTE  45 VOLUME  8
-                0x98,0xd1,0x08, //     24 T1 ON, NOTE  81 VOLUME  8
-                0x98,0xa6,0x08, //     24 T1 ON, NOTE  38 VOLUME  8
-                0x98,0xd5,0x08, //     24 T1 ON, NOTE  85 VOLUME  8
-                0x98,0xd3,0x08, //     24 T1 ON, NOTE  83 VOLUME  8
-                0x98,0xd1,0x08, //     24 T1 ON, NOTE  81 VOLUME  8
-                0x98,0xcf,0x08, //     24 T1 ON, NOTE  79 VOLUME  8
-                0x98,0xce,0x08, //     24 T1 ON, NOTE  78 VOLUME  8
-                0x98,0xcc,0x08, //     24 T1 ON, NOTE  76 VOLUME  8
-                0x98,0xbe,0x08, //     24 T1 ON, NOTE  62 VOLUME  8
-                0x98,0xbd,0x08, //     24 T1 ON, NOTE  61 VOLUME  8
-                0x98,0xbb,0x08, //     24 T1 ON, NOTE  59 VOLUME  8
-                0x98,0xb9,0x08, //     24 T1 ON, NOTE  57 VOLUME  8
-                0x98,0xb7,0x08, //     24 T1 ON, NOTE  55 VOLUME  8
-                0x98,0xb6,0x08, //     24 T1 ON, NOTE  54 VOLUME  8
-                0x98,0xb4,0x08, //     24 T1 ON, NOTE  52 VOLUME  8
-                0x98,0xb2,0x08, //     24 T1 ON, NOTE  50 VOLUME  8
-                0x98,0xb1,0x08, //     24 T1 ON, NOTE  49 VOLUME  8
-                0x98,0xaf,0x08, //     24 T1 ON, NOTE  47 VOLUME  8
-                0x98,0xc9,0x08, //     24 T1 ON, NOTE  73 VOLUME  8
-                0x98,0xc7,0x08, //     24 T1 ON, NOTE  71 VOLUME  8
-                0x98,0xc5,0x08, //     24 T1 ON, NOTE  69 VOLUME  8
-                0x98,0xc3,0x08, //     24 T1 ON, NOTE  67 VOLUME  8
-                0x98,0xc2,0x08, //     24 T1 ON, NOTE  66 VOLUME  8
-                0x98,0xc0,0x08, //     24 T1 ON, NOTE  64 VOLUME  8
-                0x98,0xbe,0x08, //     24 T1 ON, NOTE  62 VOLUME  8
-                0x98,0xcc,0x05, //     24 T1 ON, NOTE  76 VOLUME  5
-                0x8c,0xb1,0x08, //     12 T1 ON, NOTE  49 VOLUME  8
-                0x8c,0xca,0x05, //     12 T1 ON, NOTE  74 VOLUME  5
-                0x8c,0xb1,0x08, //     12 T1 ON, NOTE  49 VOLUME  8
-                0x8c,0xc9,0x05, //     12 T1 ON, NOTE  73 VOLUME  5
-                0x8c,0xb1,0x08, //     12 T1 ON, NOTE  49 VOLUME  8
-                0x8c,0xc7,0x05, //     12 T1 ON, NOTE  71 VOLUME  5
-                0x8c,0xb1,0x08, //     12 T1 ON, NOTE  49 VOLUME  8
-                0x8c,0xc5,0x05, //     12 T1 ON, NOTE  69 VOLUME  5
-                0x8c,0xb1,0x08, //     12 T1 ON, NOTE  49 VOLUME  8
-                0x8c,0xc3,0x05, //     12 T1 ON, NOTE  67 VOLUME  5
-                0x8c,0xb1,0x08, //     12 T1 ON, NOTE  49 VOLUME  8
-                0x8c,0xc2,0x05, //     12 T1 ON, NOTE  66 VOLUME  5
-                0x8c,0xb1,0x08, //     12 T1 ON, NOTE  49 VOLUME  8
-                0x8c,0xc0,0x05, //     12 T1 ON, NOTE  64 VOLUME  5
-                0x8c,0xb1,0x08, //     12 T1 ON, NOTE  49 VOLUME  8
-                0x8c,0xbe,0x05, //     12 T1 ON, NOTE  62 VOLUME  5
-                     0xb0,0x01, //     48 BOTH OFF
-                0xb0,0xb2,0x08, //     48 T1 ON, NOTE  50 VOLUME  8
-                     0xb0,0x01, //     48 BOTH OFF
-                0xb0,0xab,0x08, //     48 T1 ON, NOTE  43 VOLUME  8
-                     0xb0,0x01, //     48 BOTH OFF
-                0xb0,0xad,0x08, //     48 T1 ON, NOTE  45 VOLUME  8
-                     0xb0,0x01, //     48 BOTH OFF
-                0xb0,0xaf,0x08, //     48 T1 ON, NOTE  47 VOLUME  8
-                0x98,0xc9,0x08, //     24 T1 ON, NOTE  73 VOLUME  8
-                0x98,0xc7,0x08, //     24 T1 ON, NOTE  71 VOLUME  8
-                0x98,0xc5,0x08, //     24 T1 ON, NOTE  69 VOLUME  8
-                0x98,0xc3,0x08, //     24 T1 ON, NOTE  67 VOLUME  8
-                0x98,0xc2,0x08, //     24 T1 ON, NOTE  66 VOLUME  8
-                0x98,0xc0,0x08, //     24 T1 ON, NOTE  64 VOLUME  8
-                0x98,0xbe,0x08, //     24 T1 ON, NOTE  62 VOLUME  8
-                0x98,0xcc,0x05, //     24 T1 ON, NOTE  76 VOLUME  5
-                0x8c,0xb1,0x08, //     12 T1 ON, NOTE  49 VOLUME  8
-                0x8c,0xca,0x05, //     12 T1 ON, NOTE  74 VOLUME  5
-                0x8c,0xb1,0x08, //     12 T1 ON, NOTE  49 VOLUME  8
-                0x8c,0xc9,0x05, //     12 T1 ON, NOTE  73 VOLUME  5
-                0x8c,0xb1,0x08, //     12 T1 ON, NOTE  49 VOLUME  8
-                0x8c,0xc7,0x05, //     12 T1 ON, NOTE  71 VOLUME  5
-                0x8c,0xb1,0x08, //     12 T1 ON, NOTE  49 VOLUME  8
-                0x8c,0xc5,0x05, //     12 T1 ON, NOTE  69 VOLUME  5
-                0x8c,0xb1,0x08, //     12 T1 ON, NOTE  49 VOLUME  8
-                0x8c,0xc3,0x05, //     12 T1 ON, NOTE  67 VOLUME  5
-                0x8c,0xb1,0x08, //     12 T1 ON, NOTE  49 VOLUME  8
-                0x8c,0xc2,0x05, //     12 T1 ON, NOTE  66 VOLUME  5
-                0x8c,0xb1,0x08, //     12 T1 ON, NOTE  49 VOLUME  8
-                0x8c,0xc0,0x05, //     12 T1 ON, NOTE  64 VOLUME  5
-                0x8c,0xb1,0x08, //     12 T1 ON, NOTE  49 VOLUME  8
-                0x8c,0xbe,0x05, //     12 T1 ON, NOTE  62 VOLUME  5
-                     0xb0,0x01, //     48 BOTH OFF
-                0xb0,0xb2,0x08, //     48 T1 ON, NOTE  50 VOLUME  8
-                     0xb0,0x01, //     48 BOTH OFF
-                0xb0,0xab,0x08, //     48 T1 ON, NOTE  43 VOLUME  8
-                     0xb0,0x01, //     48 BOTH OFF
-                0xb0,0xad,0x08, //     48 T1 ON, NOTE  45 VOLUME  8
-                     0xb0,0x01, //     48 BOTH OFF
-                0xb0,0xb6,0x08, //     48 T1 ON, NOTE  54 VOLUME  8
-                0x98,0xbe,0x08, //     24 T1 ON, NOTE  62 VOLUME  8
-                0x98,0xb6,0x08, //     24 T1 ON, NOTE  54 VOLUME  8
-                0x98,0xbe,0x08, //     24 T1 ON, NOTE  62 VOLUME  8
-                0x98,0xb6,0x08, //     24 T1 ON, NOTE  54 VOLUME  8
-                0x98,0xbe,0x08, //     24 T1 ON, NOTE  62 VOLUME  8
-                0x98,0xb6,0x08, //     24 T1 ON, NOTE  54 VOLUME  8
-                0x98,0xce,0x05, //     24 T1 ON, NOTE  78 VOLUME  5
-                0x98,0xb6,0x08, //     24 T1 ON, NOTE  54 VOLUME  8
-                0x98,0xbe,0x08, //     24 T1 ON, NOTE  62 VOLUME  8
-                0x98,0xb6,0x08, //     24 T1 ON, NOTE  54 VOLUME  8
-                0x98,0xbe,0x08, //     24 T1 ON, NOTE  62 VOLUME  8
-                0x98,0xb6,0x08, //     24 T1 ON, NOTE  54 VOLUME  8
-                0x98,0xbe,0x08, //     24 T1 ON, NOTE  62 VOLUME  8
-                0x98,0xb6,0x08, //     24 T1 ON, NOTE  54 VOLUME  8
-                0x98,0xce,0x05, //     24 T1 ON, NOTE  78 VOLUME  5
-                0x98,0xb6,0x08, //     24 T1 ON, NOTE  54 VOLUME  8
-                0x98,0xbe,0x08, //     24 T1 ON, NOTE  62 VOLUME  8
-                0x98,0xb6,0x08, //     24 T1 ON, NOTE  54 VOLUME  8
-                0x98,0xbe,0x08, //     24 T1 ON, NOTE  62 VOLUME  8
-                0x98,0xb6,0x08, //     24 T1 ON, NOTE  54 VOLUME  8
-                0x98,0xbe,0x08, //     24 T1 ON, NOTE  62 VOLUME  8
-                0x98,0xb6,0x08, //     24 T1 ON, NOTE  54 VOLUME  8
-                0x98,0xca,0x05, //     24 T1 ON, NOTE  74 VOLUME  5
-                0x98,0xb6,0x08, //     24 T1 ON, NOTE  54 VOLUME  8
-                0x98,0xbe,0x08, //     24 T1 ON, NOTE  62 VOLUME  8
-                0x98,0xb6,0x08, //     24 T1 ON, NOTE  54 VOLUME  8
-                0x98,0xbe,0x08, //     24 T1 ON, NOTE  62 VOLUME  8
-                0x98,0xb6,0x08, //     24 T1 ON, NOTE  54 VOLUME  8
-                0x98,0xbe,0x08, //     24 T1 ON, NOTE  62 VOLUME  8
-                0x98,0xb6,0x08, //     24 T1 ON, NOTE  54 VOLUME  8
-                0x98,0xce,0x05, //     24 T1 ON, NOTE  78 VOLUME  5
-                0x98,0xb6,0x08, //     24 T1 ON, NOTE  54 VOLUME  8
-                0x98,0xbe,0x08, //     24 T1 ON, NOTE  62 VOLUME  8
-                0x98,0xb6,0x08, //     24 T1 ON, NOTE  54 VOLUME  8
-                0x98,0xbe,0x08, //     24 T1 ON, NOTE  62 VOLUME  8
-                0x98,0xb6,0x08, //     24 T1 ON, NOTE  54 VOLUME  8
-                0x98,0xbe,0x08, //     24 T1 ON, NOTE  62 VOLUME  8
-                0x98,0xb6,0x08, //     24 T1 ON, NOTE  54 VOLUME  8
-                0x98,0xc2,0x05, //     24 T1 ON, NOTE  66 VOLUME  5
-                0x98,0xb6,0x08, //     24 T1 ON, NOTE  54 VOLUME  8
-                0x98,0xbe,0x08, //     24 T1 ON, NOTE  62 VOLUME  8
-                0x98,0xb6,0x08, //     24 T1 ON, NOTE  54 VOLUME  8
-                0x98,0xbe,0x08, //     24 T1 ON, NOTE  62 VOLUME  8
-                0x98,0xb6,0x08, //     24 T1 ON, NOTE  54 VOLUME  8
-                0x98,0xbe,0x08, //     24 T1 ON, NOTE  62 VOLUME  8
-                0x98,0xb6,0x08, //     24 T1 ON, NOTE  54 VOLUME  8
-                0x98,0xc2,0x05, //     24 T1 ON, NOTE  66 VOLUME  5
-                0x98,0xb6,0x08, //     24 T1 ON, NOTE  54 VOLUME  8
-                     0xb0,0x01, //     48 BOTH OFF
-                0xb0,0xaa,0x08, //     48 T1 ON, NOTE  42 VOLUME  8
-                     0xb0,0x01, //     48 BOTH OFF
-                0xb0,0xad,0x08, //     48 T1 ON, NOTE  45 VOLUME  8
-                     0xb0,0x01, //     48 BOTH OFF
-                0xb0,0xaa,0x08, //     48 T1 ON, NOTE  42 VOLUME  8
-                     0xb0,0x01, //     48 BOTH OFF
-                0xb0,0xa6,0x08, //     48 T1 ON, NOTE  38 VOLUME  8
-                     0xb0,0x01, //     48 BOTH OFF
-           0x01,0x90,0xa6,0x08, //    144 T1 ON, NOTE  38 VOLUME  8
-                     0xb0,0x01, //     48 BOTH OFF
-           0x01,0x90,0xa6,0x08, //    144 T1 ON, NOTE  38 VOLUME  8
-                     0xe0,0x01, //     96 BOTH OFF
-                     0x80,0x05  //      0 END PROGRAM
+0x00,0x00,0x01,0x01,0x02,0x05,0x0e,0x08,0x09,0x07,0x07,0x09,0x0a,0x00,0x00,0x00, // HUFFMAN TABLE (73 symbols)
+0x18,0x15,0x32,0x3e,0x34,0x39,0x4a,0x4e,0x58,0x2d,0x31,0x35,0x36,0x38,0x40,0x42,
+0x43,0x45,0x47,0x49,0x4c,0x51,0x55,0x01,0x26,0x2a,0x37,0x3b,0x3d,0x3f,0x4f,0x2b,
+0x2f,0x3a,0x3c,0x44,0x53,0x56,0x98,0xb8,0x33,0x41,0x48,0x4b,0x50,0x78,0xd8,0x28,
+0x46,0x4d,0x75,0x90,0xf8,0xff,0x02,0x1f,0x21,0x2c,0x2e,0x80,0xa0,0xb0,0xf5,0x05,
+0x0e,0x27,0x7f,0x86,0x87,0x88,0x8c,0xc8,0xe0,
+0xff,0x3f,0xef,0xff,0x1f,0xf7,0xef,0xfe,0x7f,0xf7,0xff,0xff,0xeb,0xff,0x3f,0xfb,
+0xf7,0xfe,0xec,0x56,0x31,0x58,0xdd,0xb8,0x5c,0xc5,0x63,0x10,0x2d,0x20,0x5a,0x73,
+0x22,0x5c,0x44,0xb8,0x8f,0x6e,0x17,0x44,0xb8,0x89,0xe4,0x74,0x22,0x73,0x2d,0x20,
+0x7c,0x88,0x16,0x9c,0xcb,0x48,0x0c,0x56,0x31,0x01,0x8a,0xca,0x8f,0x12,0xb1,0x87,
+0x18,0x71,0x87,0x18,0x73,0x21,0xc6,0x1c,0x61,0xd6,0x83,0xac,0x07,0x58,0x0e,0xb2,
+0x1d,0x48,0x75,0x31,0xc6,0x1c,0x61,0xd6,0xa3,0xa9,0x0e,0xb2,0x1d,0x48,0x75,0x31,
+0xc9,0x0e,0x30,0xe3,0x0e,0x30,0xeb,0x51,0xc6,0x1c,0x61,0xd7,0x71,0xd4,0xc7,0x53,
+0x1d,0x6b,0x4d,0xe8,0xf4,0xdf,0x7e,0xe3,0xa9,0x8e,0xa6,0x3a,0xd6,0x9b,0xd1,0xe9,
+0xbe,0xfd,0xc7,0x53,0xfb,0xe7,0xf7,0xcb,0xef,0x8f,0xeb,0x81,0x58,0xc5,0x63,0x76,
+0xe1,0x64,0xca,0xc6,0x20,0x5a,0x40,0xb4,0xe6,0xb5,0x2e,0x22,0x5c,0x47,0xb7,0x05,
+0x35,0xdc,0xb8,0x89,0xe4,0xa6,0x44,0xe6,0x5a,0xbb,0x9f,0x22,0x0a,0x6b,0x52,0xd2,
+0x0a,0x6b,0xb8,0xc4,0x06,0x5a,0x95,0x1e,0x25,0x6a,0x43,0x8c,0x38,0xc3,0x8c,0x39,
+0x90,0xe3,0x0e,0x30,0xeb,0x41,0xd6,0x03,0xac,0x07,0x59,0x0e,0xa4,0x3a,0x98,0xe3,
+0x0e,0x30,0xeb,0x51,0xd4,0x87,0x59,0x0e,0xa4,0x3a,0x98,0xe4,0x87,0x18,0x71,0x87,
+0x18,0x75,0xa8,0xe3,0x0e,0x30,0xeb,0xb8,0xea,0x63,0xa9,0x8e,0xb5,0xa6,0xf4,0x7a,
+0x6f,0xbf,0x71,0xd4,0xc7,0x53,0x1d,0x6b,0x4d,0xe8,0xf4,0xdf,0x7e,0xe3,0xa9,0xfd,
+0xf3,0xfb,0xe5,0xf7,0xc7,0xee,0xc4,0x46,0x22,0x31,0x11,0x88,0x8c,0x44,0x62,0x23,
+0x11,0x18,0x88,0xc4,0x46,0x22,0x31,0x11,0x88,0x8c,0x44,0x62,0x23,0x11,0x18,0x88,
+0xc4,0x46,0x22,0x31,0x11,0x88,0x8c,0x44,0x62,0x23,0x11,0x18,0x88,0xc7,0x41,0x8e,
+0x83,0x1d,0x06,0x3a,0x12,0x20,0x5a,0x73,0x22,0x74,0x3c,0xc7,0x5d,0xc7,0x5d,0xc7,
+0x53,0x1d,0x4c,0x75,0xdc,0x75,0xdc,0x75,0xdc,0x75,0xdc,0x75,0x33,0x6f,0xdf,0xf7,
+0xa8,0xd8,0xe4,0x6c,0x71,0x36,0xfc,0x54,0x6c,0x72,0x36,0x38,0x9b,0x7e,0x2a,0x36,
+0x39,0x1b,0x15,0x1b,0x1c,0x8d,0x8a,0x8d,0x8e,0x46,0xe7,0xa9,0xb0,0xe7,0x53,0xa1,
+0x11,0xce,0xa7,0x42,0x27,0x32,0xd2,0x03,0x1a,0x15,0x90,0x22,0x54,0x56,0x77,0x22,
+0x4c,0x62,0xd2,0x25,0x43,0x29,0x11,0x34,0x2b,0x20,0x44,0xa8,0xac,0xee,0x44,0x98,
+0xc5,0xa4,0x4a,0x86,0x52,0x22,0x68,0x56,0x6a,0x44,0x98,0xc4,0xc8,0x9a,0x95,0x9a,
+0x91,0x26,0x31,0x32,0x25,0x5f,0xc7,0xf2,0xff,0x1c,0x3f,0x5c,0x96,0x8b,0x25,0xa2,
+0xc9,0x68,0xbd,0x16,0x6b,0x25,0xa2,0xc9,0x68,0xb2,0x5a,0x2f,0x45,0x9a,0xc1,0x64,
+0xb0,0x59,0x2c,0x16,0x4a,0xf5,0xe8,0xb0,0x59,0x2c,0x16,0x4b,0x05,0x92,0xbd,0x7a,
+0x27,0xf7,0xfb,0x7b,0xed,0xbe,0x09,0xd6,0x09,0xd6,0x0b,0xaa,0xbd,0x3f,0xbf,0xdb,
+0xdf,0x6d,0xf0,0x4e,0xb0,0x4e,0xb0,0x5d,0x55,0xe6,0x06,0xa4,0xcd,0x49,0x1a,0x19,
+0x99,0x10,0x36,0x3d,0x4d,0x8f,0xb1,0x33,0x52,0x4b,0x25,0xa2,0xc9,0x68,0xb2,0x5a,
+0x2f,0x45,0x9a,0xc9,0x68,0xb2,0x5a,0x2c,0x96,0x8b,0xd1,0x66,0xb0,0x59,0x2c,0x16,
+0x4b,0x05,0x92,0xbd,0x7a,0x2c,0x16,0x4b,0x05,0x92,0xc1,0x64,0xaf,0x5e,0x89,0xfd,
+0xfe,0xde,0xfb,0x6f,0x82,0x75,0x82,0x75,0x82,0xea,0xaf,0x4f,0xef,0xf6,0xf7,0xdb,
+0x7c,0x13,0xac,0x13,0xac,0x17,0x55,0x79,0x81,0xa9,0x33,0x52,0x46,0x86,0x66,0x44,
+0x0d,0x8f,0x53,0x63,0xec,0x4c,0xd4,0x91,0x13,0xa9,0x13,0xa9,0xa1,0xd4,0x89,0xd4,
+0x89,0xe6,0x44,0xf3,0x22,0x79,0x91,0x3c,0xc8,0x9d,0x08,0x9d,0x0c,0xce,0x87,0x33,
+0xa1,0xcc,0xf2,0x39,0x9e,0x47,0x33,0xc8,0xe6,0x79,0x1c,0xc8,0x9c,0xc8,0x99,0x11,
+0x2c,0x22,0x58,0x44,0xb0,0x89,0x61,0x12,0xc2,0x24,0x07,0x20,0x39,0x01,0xc8,0x0e,
+0x40,0xea,0x40,0xea,0x40,0xea,0x40,0xea,0x40,0x72,0x03,0x90,0x1c,0x80,0xe4,0x0e,
+0xa4,0x0e,0xa4,0x0e,0x84,0x0e,0x85,0x46,0x8b,0x63,0x45,0xb1,0xa1,0x51,0xa1,0xe2,
+0x68,0x56,0x68,0x31,0xa1,0xf2,0x34,0x2d,0x34,0x20,0x68,0xb6,0x34,0x2a,0x34,0x3c,
+0x4d,0x0a,0xcd,0x06,0x34,0x3e,0x46,0x85,0xa6,0x84,0x0d,0x16,0xc6,0x85,0x46,0x87,
+0x89,0xa1,0x59,0xa0,0xc6,0x84,0x0d,0x0b,0x0f,0xa2,0xd8,0xfa,0x10,0x3e,0x8b,0x63,
+0xe8,0x7c,0x89,0xad,0x89,0x8c,0x6a,0xbe,0xc6,0xa5,0x66,0xa5,0x66,0xa3,0x12,0x18,
+0x91,0x03,0x42,0x06,0x87,0xe4,0x66,0x7e,0x46,0x65,0x5d,0xb8,0x7e,0xb1,0xb3,0xa5,
+0x9d,0x6c,0x7b,0x3b,0x59,0x85,0xdd,0x2e,0x8f,0x6e,0x16,0x74,0xb3,0xad,0x8f,0x67,
+0x6b,0x30,0xbb,0xa5,0xd1,0xed,0xc2,0xce,0x96,0x79,0xd8,0xf6,0x5f,0x67,0xcf,0xfd,
+0x70,0xfd,0xb3,0xb3,0xe9,0x66,0x97,0x4a,0xef,0x4b,0xb1,0xb3,0x3b,0x3e,0x96,0x5f,
+0x73,0x59,0xf3,0xb3,0xf3,0xb1,0xec,0xf4,0xb3,0x3b,0xac,0xb3,0xe7,0x73,0x53,0x3a,
+0x65,0x4c,0xe9,0xe3,0x4c,0xe9,0x95,0x33,0xa4,0x29,0x9d,0x32,0xa6,0x74,0x85,0x33,
+0xa6,0x54,0xce,0x95,0x10,0x2b,0x20,0x56,0x40,0xf1,0x20,0x54,0x40,0xac,0x81,0x59,
+0x02,0xb2,0x05,0x44,0x06,0x20,0x78,0x8c,0x56,0x31,0x51,0x02,0xb2,0x03,0x10,0x18,
+0x81,0x51,0x02,0xb2,0x1f,0x1a,0xfc,0x4b,0xe2,0xb2,0x05,0x64,0x0a,0xc8,0x90,0x22,
+0x40,0x89,0x02,0x23,0x1d,0x0b,0x4e,0x85,0xa7,0x42,0xd3,0xa1,0x01,0xce,0x83,0x9d,
+0x07,0x3a,0x0e,0x54,0x44,0x81,0x12,0x04,0x48,0x11,0xba,0xf3,0xa9,0x79,0xd4,0xbd,
+0x68,0x5e,0x44,0xbc,0x72,0xf3,0xa0,0xe7,0x41,0xc8,0x97,0xad,0x4b,0xd6,0xa5,0xeb,
+0x52,0xf2,0x25,0xe7,0x52,0xff,0x8a,0x7c,0x7b,0x7c,0x75,0x2f,0x3a,0x97,0x95,0x91,
+0x20,0x44,0x81,0x12,0x04,0x46,0x3a,0x16,0x9d,0x0b,0x4e,0x85,0xa7,0x42,0x03,0x9d,
+0x07,0x3a,0x0e,0x74,0x1c,0x89,0x79,0x12,0xf2,0x25,0xe4,0x4b,0xc8,0x97,0x91,0x2f,
+0x22,0x5e,0x44,0xbc,0x75,0xe8,0x3a,0xf4,0x1d,0x7a,0x0e,0xbd,0x07,0x5e,0x83,0xaf,
+0x41,0xd7,0xa0,0xeb,0xd0,0xc9,0x62,0xaf,0x58,0xab,0xd6,0x2a,0xf5,0x8a,0xbd,0x62,
+0xaf,0x58,0xab,0xd6,0x2a,0xf5,0x89,0x92,0xc1,0x3a,0xc1,0x3a,0xc1,0x3a,0xc1,0x3a,
+0xc1,0x3a,0xc1,0x3a,0xc1,0x3a,0xc1,0x75,0x58,0xae,0xab,0x15,0xd5,0x62,0xba,0xac,
+0x53,0xac,0x13,0xac,0x13,0xac,0x13,0xac,0x0c,0x8f,0x13,0x21,0x88,0x16,0x99,0x16,
+0x9c,0xcb,0x4c,0x8b,0x48,0x0c,0x64,0x78,0x95,0x76,0xe0,0xbe,0xab,0x55,0xf5,0x5a,
+0xaf,0xaa,0xd5,0x7d,0x56,0xab,0xea,0xb5,0x5f,0x55,0xaa,0xfa,0xad,0x54,0x96,0x8a,
+0x4b,0x45,0x9a,0xc9,0x66,0xb2,0x58,0xac,0x16,0x2b,0x05,0x7a,0x75,0xd4,0x62,0xb1,
+0x8a,0xc6,0xed,0xc2,0xe6,0x2b,0x18,0x81,0x69,0x02,0xd3,0x99,0x12,0xe2,0x25,0xc4,
+0x7b,0x70,0xba,0x25,0xc4,0x4f,0x23,0xa1,0x13,0x99,0x69,0x03,0xe4,0x40,0xb4,0xe6,
+0x5a,0x40,0x62,0xb1,0x88,0x0c,0x56,0x54,0x78,0x95,0x8c,0x38,0xc3,0x8c,0x38,0xc3,
+0x99,0x0e,0x30,0xe3,0x0e,0xb4,0x1d,0x60,0x3a,0xc0,0x75,0x90,0xea,0x43,0xa9,0x8e,
+0x30,0xe3,0x0e,0xb5,0x1d,0x48,0x75,0x90,0xea,0x43,0xa9,0x8e,0x48,0x71,0x87,0x18,
+0x71,0x87,0x5a,0x8e,0x30,0xe3,0x0e,0xbb,0x8e,0xa6,0x3a,0x98,0xeb,0x5a,0x6f,0x47,
+0xa6,0xfb,0xf7,0x1d,0x4c,0x75,0x31,0xd6,0xb4,0xde,0x8f,0x4d,0xf7,0xee,0x3a,0x9f,
+0xdf,0x3f,0xbe,0x5f,0x7c,0x7f,0x5c,0x0a,0xc6,0x2b,0x1b,0xb7,0x0b,0x26,0x56,0x31,
+0x02,0xd2,0x05,0xa5,0xcb,0x52,0xe2,0x25,0xc4,0x7b,0x70,0xb2,0x65,0x63,0x10,0x5b,
+0x10,0x2d,0x18,0xe6,0x5a,0x73,0x2d,0x5d,0xfe,0xfe,0x27,0xf6,0x3c,0x4a,0xd4,0xca,
+0xcf,0x91,0xe2,0x40,0xb4,0x80,0xcb,0x53,0xc4,0xac,0xa8,0x6a,0x4e,0x95,0xd2,0x74,
+0x6a,0x4e,0x90,0xa4,0xf7,0x95,0x27,0x48,0x52,0x74,0xb6,0x93,0xa5,0xd4,0x9d,0x32,
+0x2b,0x20,0x44,0xa8,0xac,0xd4,0x89,0x31,0x8b,0x48,0x95,0x0c,0xa4,0x44,0xd0,0xac,
+0x81,0x13,0xc0,0xac,0xd4,0x89,0x31,0x8b,0x48,0x95,0x0c,0xa4,0x44,0xd0,0xac,0xd4,
+0x89,0x31,0x89,0x91,0x35,0x2b,0x35,0x22,0x4c,0x62,0x64,0x4a,0xbf,0x8f,0xe5,0xfe,
+0x38,0x7e,0xb2,0x53,0x52,0x53,0x52,0x53,0x5a,0x2d,0x54,0x94,0xd4,0x94,0xd4,0x94,
+0xd6,0x8b,0x55,0x9a,0x92,0xcd,0x49,0x66,0xa4,0xb2,0x5a,0x2c,0xd4,0x96,0x6a,0x4b,
+0x35,0x25,0x92,0xd1,0x63,0xef,0xbf,0xbf,0xb6,0xf9,0xac,0x56,0x6b,0x15,0x9a,0xc1,
+0x64,0xb1,0xf7,0xdf,0xdf,0xdb,0x7c,0xd6,0x2b,0x35,0x8a,0xcd,0x60,0xb2,0x2f,0x36,
+0x3d,0x4d,0x8e,0xe4,0xcd,0x49,0x11,0x3d,0x8a,0x1e,0xc6,0xe7,0xa9,0xb1,0xdd,0x49,
+0x4d,0x49,0x4d,0x49,0x4d,0x68,0xb5,0x52,0x53,0x52,0x53,0x52,0x53,0x5a,0x2d,0x56,
+0x6a,0x4b,0x35,0x25,0x9a,0x92,0xc9,0x68,0xb3,0x52,0x59,0xa9,0x2c,0xd4,0x96,0x4b,
+0x45,0x8f,0xbe,0xfe,0xfe,0xdb,0xe6,0xb1,0x59,0xac,0x56,0x6b,0x05,0x92,0xc7,0xdf,
+0x7f,0x7f,0x6d,0xf3,0x58,0xac,0xd6,0x2b,0x35,0x82,0xc8,0x81,0xb1,0xea,0x6c,0x77,
+0x26,0x6a,0x48,0x89,0xec,0x50,0xf6,0x37,0x3d,0x4d,0x8e,0xe9,0xd6,0x09,0xd6,0x04,
+0xd6,0x09,0xd6,0x09,0xd7,0xcd,0x3a,0xf9,0xa7,0x5f,0x34,0xeb,0xe6,0x9d,0x5e,0x9d,
+0x5e,0x6a,0xaf,0x5e,0x6a,0xf5,0xe6,0xbb,0x2f,0x35,0xd9,0x79,0xae,0xcb,0xcd,0x76,
+0x5e,0x69,0xd7,0x9a,0x72,0x49,0xd7,0x92,0x75,0xe4,0x9d,0x79,0x27,0x5e,0x49,0xd7,
+0x92,0x72,0x2b,0x12,0x2b,0x12,0x2b,0x12,0x2b,0x12,0x2b,0x02,0x2b,0x02,0x2b,0x02,
+0x2b,0x02,0x2b,0x12,0x2b,0x12,0x2b,0x12,0x2b,0x12,0x2b,0x02,0x2b,0x02,0x2a,0xf2,
+0x2a,0xf1,0x89,0x29,0x92,0x53,0x24,0x71,0x24,0x7e,0x44,0x8e,0x44,0x8f,0x02,0x47,
+0xf5,0x24,0x78,0x92,0x2a,0x24,0xa6,0x48,0xe2,0x48,0xfc,0x89,0x1c,0x89,0x1e,0x04,
+0x8f,0xea,0x48,0xf1,0x24,0x54,0x49,0x4c,0x91,0xc4,0x91,0xf9,0x12,0x39,0x12,0x3c,
+0x09,0x15,0x12,0x3f,0xb1,0x25,0xfa,0x12,0x2a,0x24,0xbf,0x42,0x47,0xf5,0x35,0x5e,
+0xa6,0xa7,0x81,0xaa,0xd8,0xd4,0xe4,0x48,0xe4,0x48,0xf0,0x24,0x78,0x12,0x2a,0x32,
+0x2a,0x32,0x3f,0xa1,0x91,0xfd,0x0c,0x8e,0x3d,0xb8,0x7e,0xaf,0x65,0xf6,0x61,0x66,
+0x36,0x7a,0x59,0x9d,0xdd,0x6e,0xc2,0xc7,0xb2,0xfb,0x30,0xb3,0x1b,0x3d,0x2c,0xce,
+0xee,0xb7,0x61,0x63,0xd9,0x7d,0x9f,0x3b,0x31,0xb3,0x2b,0x3f,0x3f,0xf5,0xc3,0xf6,
+0xd6,0xcf,0xd2,0xc9,0xdd,0xde,0xed,0x2e,0xfa,0x59,0xad,0x9f,0xa5,0x99,0x5d,0xce,
+0xcf,0xce,0xcf,0xad,0x98,0xd9,0xa5,0x9a,0xdd,0xe5,0x67,0xe7,0x77,0x3a,0x6b,0x49,
+0x53,0x5a,0x42,0x9a,0xd2,0x54,0xd6,0x91,0xa6,0xb4,0x95,0x35,0xa4,0x69,0xad,0x25,
+0x4d,0x68,0xc4,0x4b,0x48,0x96,0x91,0x2d,0x22,0x31,0x12,0xd2,0x25,0xa4,0x4b,0x48,
+0x8c,0x44,0xe6,0x44,0x81,0xcc,0x81,0xcc,0x62,0x25,0xa4,0x4e,0x67,0x53,0x99,0xd4,
+0x62,0x25,0xa4,0x7e,0x36,0xf8,0xef,0xf1,0x69,0x12,0xd2,0x25,0xa3,0x91,0x1c,0x88,
+0xe4,0x47,0x39,0x97,0x9d,0x0b,0xce,0x85,0xe7,0x42,0xf2,0x26,0x25,0xe6,0x25,0xe6,
+0x25,0xe6,0x23,0x0e,0x44,0x72,0x23,0x91,0x1c,0x62,0x25,0xa4,0x4b,0x48,0xac,0x08,
+0x8c,0x44,0xe6,0x44,0x81,0xcc,0x81,0xcc,0x62,0x2b,0x22,0x2b,0x22,0x2b,0x22,0x23,
+0x11,0x2d,0x23,0xf1,0xb7,0xc7,0x7f,0x8b,0x48,0x96,0x91,0x39,0x0c,0x54,0x31,0x50,
+0xcb,0x01,0x8f,0x02,0x0b,0x12,0x0b,0x32,0x0b,0x32,0x05,0x47,0x35,0x79,0xcd,0x75,
+0x39,0xae,0xa7,0x31,0x8e,0xa7,0x42,0x23,0x11,0x3a,0x1d,0x46,0x3a,0x8e,0x60,0x30,
+0xe5,0xe6,0x23,0x17,0x8e,0x75,0x18,0xea,0x39,0x78,0xc5,0xe6,0x06,0x43,0x18,0x18,
+0x99,0x8c,0x62,0x60,0x5e,0x31,0x79,0x81,0x88,0xc6,0x26,0x06,0x23,0x19,0x9f,0x43,
+0x21,0x8c,0x8c,0x4c,0x86,0x3e,0x84,0x8c,0xc6,0x33,0x32,0x33,0x18,0x91,0xa9,0xa0,
+0xc6,0x86,0x66,0x43,0x19,0x19,0x9a,0x0c,0x68,0x48,0x98,0xc4,0x8d,0x4e,0xe3,0x1a,
+0x92,0x34,0x18,0xd0,0x91,0xa8,0xc6,0xa4,0xcd,0x86,0x26,0x77,0x3d,0x46,0x3b,0x8e,
+0x6a,0x31,0xa8,0xe7,0x71,0x8e,0xe7,0x99,0xdc,0x63,0xd4,0xf3,0x36,0x5d,0xc7,0x5d,
+0xc7,0x53,0x1d,0x4c,0x75,0xdc,0x75,0x31,0xd7,0x71,0xd7,0x71,0xc6,0x24,0x7b,0x12,
+0x3d,0x89,0x1e,0x04,0x8e,0x44,0x8e,0x24,0x8f,0x62,0x47,0x81,0x23,0x91,0x23,0x89,
+0x23,0xd8,0x91,0xe0,0x48,0xe4,0x48,0xe2,0x48,0xe4,0x48,0xf0,0x24,0x72,0xfe,0x7c,
+0x0e,0x26,0xdf,0x8a,0x8d,0x8e,0x46,0xc7,0x13,0x6f,0xc5,0x46,0xc7,0x23,0x63,0x89,
+0xb7,0xe2,0xa3,0x63,0x91,0xb1,0x51,0xb1,0xc8,0xd8,0xa8,0xd8,0xe2,0x6e,0x7a,0x9b,
+0x1d,0xc9,0x9a,0x8e,0x75,0x3a,0x11,0x39,0x96,0x90,0x18,0xac,0xf1,0x34,0x33,0x32,
+0x31,0x30,0x2f,0x1d,0x6b,0x4a,0xf7,0x95,0x2b,0xdf,0x4a,0x57,0xbe,0x74,0xaf,0x7c,
+0xa9,0x5e,0xf8,0xd2,0xbd,0xf0,0xa5,0x7b,0xdf,0x4a,0xf7,0x7e,0xdc,0x2e,0x6e,0xdc,
+0x2e,0xf0,0xed,0xc2,0xea,0xbb,0x70,0xbb,0x89,0x23,0xd8,0x91,0xec,0x48,0xf0,0x24,
+0x72,0x24,0x71,0x24,0x7b,0x12,0x3c,0x09,0x1c,0x89,0x1c,0x49,0x1e,0xc4,0x8f,0x02,
+0x47,0x22,0x47,0x12,0x47,0x22,0x47,0x81,0x23,0x97,0xf3,0xe0,0x71,0x36,0xfc,0x54,
+0x6c,0x72,0x36,0x38,0x9b,0x7e,0x2a,0x36,0x39,0x1b,0x1c,0x4d,0xbf,0x15,0x1b,0x1c,
+0x8d,0x8a,0x8d,0x8e,0x46,0xc5,0x46,0xc7,0x13,0x73,0xd4,0xd8,0xee,0x4c,0xd4,0x73,
+0xa9,0xd0,0x89,0xcc,0xb4,0x80,0xc5,0x67,0x89,0xa1,0x99,0x91,0x89,0x81,0x78,0xeb,
+0x5a,0x57,0xbc,0xa9,0x5e,0xfa,0x52,0xbd,0xf3,0xa5,0x7b,0xe5,0x4a,0xf7,0xc6,0x95,
+0xef,0x85,0x2b,0xde,0xfa,0x57,0xbb,0xf6,0xe1,0x73,0x76,0xe1,0x77,0x87,0x6e,0x17,
+0x55,0xdb,0x85,0xde,0x26,0x86,0x66,0x46,0x26,0x05,0xe3,0xad,0x69,0x5e,0xf2,0xa5,
+0x7b,0xe9,0x4a,0xf7,0xce,0x95,0xef,0x95,0x2b,0xdf,0x1a,0x57,0xbe,0x14,0xaf,0x7b,
+0xe9,0x5e,0xef,0xdb,0x85,0xcd,0xdb,0x85,0xde,0x1d,0xb8,0x5d,0x57,0x6e,0x17,0x5a,
+0x39,0x68,0xe5,0xa3,0x96,0xa9,0x96,0x8e,0x5a,0x39,0x68,0xe5,0xaa,0x65,0xa3,0x96,
+0x8e,0x5a,0x39,0x6a,0x91,0x68,0xe5,0xa3,0x96,0x8e,0x5a,0xa6,0x5a,0x39,0x68,0xe5,
+0xa3,0x96,0xac,0x0b,0x47,0x2d,0x1c,0xb4,0x72,0xd5,0x81,0x6f,0x6e,0x17,0x72,0xed,
+0xc2,0xea,0xbb,0x70,0xbb,0x97,0x6e,0x17,0x71,0xed,0xc3,0xf7,0xe1,0xfb,0x71,0xed,
+0xc3,0xf7,0xe1,0xfb,0x71,0xff,0x9e,0x1f,0xc7,0xf7,0xff,0x60
 };
@@ -1,126 +1,126 @@
 #include "MIDIPlayer.h"
 
-// converted from beethoven_ode_to_joy.mid - 416 bytes total
+// converted from beethoven_ode_to_joy.mid - 283 bytes total
 extern const byte ODE_TO_JOY[] PROGMEM = 
 {
-      0x07,0xc0,0x1a,0x14,0x9b, //      0 BEGIN PROGRAM (960 ticks/beat, tempo = 428571 us/beat)
-                0x80,0xc0,0x07, //      0 T1 ON, NOTE  64 VOLUME  7
-                0x80,0x3c,0x07, //      0 T2 ON, NOTE  60 VOLUME  7
-           0x07,0xd3,0x37,0x07, //    979 T2 ON, NOTE  55 VOLUME  7
-           0x07,0xad,0x41,0x09, //    941 T2 ON, NOTE  65 VOLUME  9
-                0x93,0xb7,0x07, //     19 T1 ON, NOTE  55 VOLUME  7
-           0x07,0xad,0xc3,0x09, //    941 T1 ON, NOTE  67 VOLUME  9
-                0x93,0x30,0x07, //     19 T2 ON, NOTE  48 VOLUME  7
-           0x07,0xad,0xc3,0x08, //    941 T1 ON, NOTE  67 VOLUME  8
-                0x80,0x37,0x08, //      0 T2 ON, NOTE  55 VOLUME  8
-           0x07,0xc0,0x41,0x07, //    960 T2 ON, NOTE  65 VOLUME  7
-                0x93,0xb7,0x08, //     19 T1 ON, NOTE  55 VOLUME  8
-           0x07,0xad,0xc0,0x08, //    941 T1 ON, NOTE  64 VOLUME  8
-                0x93,0x37,0x08, //     19 T2 ON, NOTE  55 VOLUME  8
-           0x07,0xad,0x3e,0x07, //    941 T2 ON, NOTE  62 VOLUME  7
-                0x93,0xb7,0x08, //     19 T1 ON, NOTE  55 VOLUME  8
-           0x07,0xad,0xbc,0x07, //    941 T1 ON, NOTE  60 VOLUME  7
-                0x93,0x37,0x08, //     19 T2 ON, NOTE  55 VOLUME  8
-           0x07,0xad,0xbc,0x08, //    941 T1 ON, NOTE  60 VOLUME  8
-           0x07,0xc0,0x3e,0x09, //    960 T2 ON, NOTE  62 VOLUME  9
-                0x93,0xb7,0x08, //     19 T1 ON, NOTE  55 VOLUME  8
-           0x07,0xad,0xc0,0x09, //    941 T1 ON, NOTE  64 VOLUME  9
-                0x93,0x37,0x08, //     19 T2 ON, NOTE  55 VOLUME  8
-           0x0b,0xa0,0x3e,0x08, //   1440 T2 ON, NOTE  62 VOLUME  8
-                0x9a,0xb7,0x08, //     26 T1 ON, NOTE  55 VOLUME  8
-           0x03,0xc6,0xbe,0x08, //    454 T1 ON, NOTE  62 VOLUME  8
-                0x80,0x3b,0x08, //      0 T2 ON, NOTE  59 VOLUME  8
-           0x0e,0x9f,0xb7,0x08, //   1823 T1 ON, NOTE  55 VOLUME  8
-                     0x80,0x00, //      0 T2 OFF
-                0xe1,0xc0,0x08, //     97 T1 ON, NOTE  64 VOLUME  8
-                0x80,0x3c,0x08, //      0 T2 ON, NOTE  60 VOLUME  8
-           0x07,0xc0,0xc0,0x09, //    960 T1 ON, NOTE  64 VOLUME  9
-                0x93,0x37,0x08, //     19 T2 ON, NOTE  55 VOLUME  8
-           0x07,0xad,0x41,0x08, //    941 T2 ON, NOTE  65 VOLUME  8
-                0x93,0xb7,0x08, //     19 T1 ON, NOTE  55 VOLUME  8
-           0x07,0xad,0xc3,0x09, //    941 T1 ON, NOTE  67 VOLUME  9
-                0x93,0x30,0x08, //     19 T2 ON, NOTE  48 VOLUME  8
-           0x07,0xad,0xc3,0x08, //    941 T1 ON, NOTE  67 VOLUME  8
-                0x80,0x37,0x08, //      0 T2 ON, NOTE  55 VOLUME  8
-           0x07,0xc0,0x41,0x08, //    960 T2 ON, NOTE  65 VOLUME  8
-                0x93,0xb7,0x08, //     19 T1 ON, NOTE  55 VOLUME  8
-           0x07,0xad,0xc0,0x08, //    941 T1 ON, NOTE  64 VOLUME  8
-                0x93,0x37,0x08, //     19 T2 ON, NOTE  55 VOLUME  8
-           0x07,0xad,0x3e,0x07, //    941 T2 ON, NOTE  62 VOLUME  7
-                0x93,0xb7,0x08, //     19 T1 ON, NOTE  55 VOLUME  8
-           0x07,0xad,0xbc,0x08, //    941 T1 ON, NOTE  60 VOLUME  8
-                0x93,0x37,0x08, //     19 T2 ON, NOTE  55 VOLUME  8
-           0x0e,0xed,0x3e,0x09, //   1901 T2 ON, NOTE  62 VOLUME  9
-                0x93,0xb7,0x08, //     19 T1 ON, NOTE  55 VOLUME  8
-           0x07,0xad,0xc0,0x09, //    941 T1 ON, NOTE  64 VOLUME  9
-                0x93,0x37,0x08, //     19 T2 ON, NOTE  55 VOLUME  8
-           0x07,0xad,0x3e,0x08, //    941 T2 ON, NOTE  62 VOLUME  8
-                0x93,0xb7,0x08, //     19 T1 ON, NOTE  55 VOLUME  8
-           0x0b,0x8d,0xbc,0x08, //   1421 T1 ON, NOTE  60 VOLUME  8
-                0x9a,0x37,0x08, //     26 T2 ON, NOTE  55 VOLUME  8
-           0x03,0xc6,0x30,0x08, //    454 T2 ON, NOTE  48 VOLUME  8
-                0x0e,0x9f,0x80, //   1823 T1 OFF
-                0xe1,0xbe,0x06, //     97 T1 ON, NOTE  62 VOLUME  6
-                0x80,0x37,0x05, //      0 T2 ON, NOTE  55 VOLUME  5
-           0x07,0xc0,0xbe,0x05, //    960 T1 ON, NOTE  62 VOLUME  5
-           0x07,0xc0,0x40,0x06, //    960 T2 ON, NOTE  64 VOLUME  6
-                0x93,0xb7,0x05, //     19 T1 ON, NOTE  55 VOLUME  5
-           0x07,0xad,0xbc,0x05, //    941 T1 ON, NOTE  60 VOLUME  5
-                0x93,0x37,0x05, //     19 T2 ON, NOTE  55 VOLUME  5
-           0x07,0xad,0x3e,0x05, //    941 T2 ON, NOTE  62 VOLUME  5
-                0x93,0xb7,0x05, //     19 T1 ON, NOTE  55 VOLUME  5
-           0x07,0xad,0xc0,0x06, //    941 T1 ON, NOTE  64 VOLUME  6
-                0x93,0x37,0x05, //     19 T2 ON, NOTE  55 VOLUME  5
-           0x03,0xcd,0x41,0x05, //    461 T2 ON, NOTE  65 VOLUME  5
-                0x88,0xb7,0x05, //      8 T1 ON, NOTE  55 VOLUME  5
-           0x03,0xd8,0xc0,0x05, //    472 T1 ON, NOTE  64 VOLUME  5
-                0x88,0x37,0x05, //      8 T2 ON, NOTE  55 VOLUME  5
-           0x07,0xb8,0x3c,0x04, //    952 T2 ON, NOTE  60 VOLUME  4
-                0x93,0xb7,0x05, //     19 T1 ON, NOTE  55 VOLUME  5
-           0x07,0xad,0xbe,0x06, //    941 T1 ON, NOTE  62 VOLUME  6
-                0x93,0x37,0x05, //     19 T2 ON, NOTE  55 VOLUME  5
-           0x07,0xad,0x40,0x06, //    941 T2 ON, NOTE  64 VOLUME  6
-                0x93,0xb7,0x05, //     19 T1 ON, NOTE  55 VOLUME  5
-           0x03,0xcd,0xc1,0x06, //    461 T1 ON, NOTE  65 VOLUME  6
-                0x88,0x37,0x05, //      8 T2 ON, NOTE  55 VOLUME  5
-           0x03,0xd8,0x40,0x05, //    472 T2 ON, NOTE  64 VOLUME  5
-                0x88,0xb8,0x05, //      8 T1 ON, NOTE  56 VOLUME  5
-           0x07,0xb8,0xbe,0x05, //    952 T1 ON, NOTE  62 VOLUME  5
-                0x93,0x38,0x05, //     19 T2 ON, NOTE  56 VOLUME  5
-           0x07,0xad,0x3c,0x05, //    941 T2 ON, NOTE  60 VOLUME  5
-                0x93,0xb9,0x05, //     19 T1 ON, NOTE  57 VOLUME  5
-           0x07,0xad,0xbe,0x05, //    941 T1 ON, NOTE  62 VOLUME  5
-                0x93,0x36,0x05, //     19 T2 ON, NOTE  54 VOLUME  5
-                0x06,0xfc,0x80, //    892 T1 OFF
-                0xb1,0xb7,0x05, //     49 T1 ON, NOTE  55 VOLUME  5
-                     0x80,0x00, //      0 T2 OFF
-           0x07,0xc0,0x40,0x07, //    960 T2 ON, NOTE  64 VOLUME  7
-           0x07,0xc0,0xbc,0x09, //    960 T1 ON, NOTE  60 VOLUME  9
-           0x07,0xc0,0x40,0x08, //    960 T2 ON, NOTE  64 VOLUME  8
-           0x07,0xc0,0xc1,0x08, //    960 T1 ON, NOTE  65 VOLUME  8
-                0x93,0x3a,0x08, //     19 T2 ON, NOTE  58 VOLUME  8
-           0x07,0xad,0x43,0x09, //    941 T2 ON, NOTE  67 VOLUME  9
-                0x93,0xba,0x08, //     19 T1 ON, NOTE  58 VOLUME  8
-           0x07,0xad,0xc3,0x08, //    941 T1 ON, NOTE  67 VOLUME  8
-                0x80,0x39,0x08, //      0 T2 ON, NOTE  57 VOLUME  8
-           0x07,0xc0,0x41,0x07, //    960 T2 ON, NOTE  65 VOLUME  7
-                0x93,0xb9,0x08, //     19 T1 ON, NOTE  57 VOLUME  8
-           0x07,0xad,0xc0,0x08, //    941 T1 ON, NOTE  64 VOLUME  8
-                0x93,0x35,0x08, //     19 T2 ON, NOTE  53 VOLUME  8
-           0x07,0xad,0x3e,0x08, //    941 T2 ON, NOTE  62 VOLUME  8
-                0x93,0xb5,0x08, //     19 T1 ON, NOTE  53 VOLUME  8
-           0x07,0xad,0xbc,0x08, //    941 T1 ON, NOTE  60 VOLUME  8
-                0x93,0x34,0x08, //     19 T2 ON, NOTE  52 VOLUME  8
-           0x0e,0xed,0x3e,0x08, //   1901 T2 ON, NOTE  62 VOLUME  8
-                0x93,0xb7,0x08, //     19 T1 ON, NOTE  55 VOLUME  8
-           0x07,0xad,0xc0,0x09, //    941 T1 ON, NOTE  64 VOLUME  9
-                0x93,0x3c,0x09, //     19 T2 ON, NOTE  60 VOLUME  9
-           0x07,0xad,0x3e,0x08, //    941 T2 ON, NOTE  62 VOLUME  8
-                0x93,0xb7,0x08, //     19 T1 ON, NOTE  55 VOLUME  8
-           0x0b,0x8d,0xbc,0x07, //   1421 T1 ON, NOTE  60 VOLUME  7
-                0x9a,0x37,0x08, //     26 T2 ON, NOTE  55 VOLUME  8
-           0x03,0xc6,0xbc,0x08, //    454 T1 ON, NOTE  60 VOLUME  8
-           0x0e,0x9f,0xb4,0x08, //   1823 T1 ON, NOTE  52 VOLUME  8
-                     0xe1,0x01, //     97 BOTH OFF
-                     0x80,0x05  //      0 END PROGRAM
+0x07,0xc0,0x1a,0x14,0x9b,0x07,0xad,0x93,0x07,0xc0,0x80,0x03,0xc6,0x0e,0x9f,0x88, //      0 BEGIN PROGRAM (960 ticks/beat, tempo = 428571 us/beat) DELTAS 941 19 960 0 454 1823 8
+                     0x77,0x40, //      0 T1 ON, NOTE  64 VOLUME  7
+                     0x67,0x3c, //      0 T2 ON, NOTE  60 VOLUME  7
+           0xe7,0x07,0xd3,0x37, //    979 T2 ON, NOTE  55 VOLUME  7
+                     0x09,0x41, //    941 T2 ON, NOTE  65 VOLUME  9
+                     0x37,0x37, //     19 T1 ON, NOTE  55 VOLUME  7
+                     0x19,0x43, //    941 T1 ON, NOTE  67 VOLUME  9
+                     0x27,0x30, //     19 T2 ON, NOTE  48 VOLUME  7
+                     0x18,0x43, //    941 T1 ON, NOTE  67 VOLUME  8
+                     0x68,0x37, //      0 T2 ON, NOTE  55 VOLUME  8
+                     0x47,0x41, //    960 T2 ON, NOTE  65 VOLUME  7
+                     0x38,0x37, //     19 T1 ON, NOTE  55 VOLUME  8
+                     0x18,0x40, //    941 T1 ON, NOTE  64 VOLUME  8
+                     0x28,0x37, //     19 T2 ON, NOTE  55 VOLUME  8
+                     0x07,0x3e, //    941 T2 ON, NOTE  62 VOLUME  7
+                     0x38,0x37, //     19 T1 ON, NOTE  55 VOLUME  8
+                     0x17,0x3c, //    941 T1 ON, NOTE  60 VOLUME  7
+                     0x28,0x37, //     19 T2 ON, NOTE  55 VOLUME  8
+                     0x18,0x3c, //    941 T1 ON, NOTE  60 VOLUME  8
+                     0x49,0x3e, //    960 T2 ON, NOTE  62 VOLUME  9
+                     0x38,0x37, //     19 T1 ON, NOTE  55 VOLUME  8
+                     0x19,0x40, //    941 T1 ON, NOTE  64 VOLUME  9
+                     0x28,0x37, //     19 T2 ON, NOTE  55 VOLUME  8
+           0xe8,0x0b,0xa0,0x3e, //   1440 T2 ON, NOTE  62 VOLUME  8
+                0xf8,0x9a,0x37, //     26 T1 ON, NOTE  55 VOLUME  8
+                     0x98,0x3e, //    454 T1 ON, NOTE  62 VOLUME  8
+                     0x68,0x3b, //      0 T2 ON, NOTE  59 VOLUME  8
+                     0xb8,0x37, //   1823 T1 ON, NOTE  55 VOLUME  8
+                          0x60, //      0 T2 OFF
+                0xf8,0xe1,0x40, //     97 T1 ON, NOTE  64 VOLUME  8
+                     0x68,0x3c, //      0 T2 ON, NOTE  60 VOLUME  8
+                     0x59,0x40, //    960 T1 ON, NOTE  64 VOLUME  9
+                     0x28,0x37, //     19 T2 ON, NOTE  55 VOLUME  8
+                     0x08,0x41, //    941 T2 ON, NOTE  65 VOLUME  8
+                     0x38,0x37, //     19 T1 ON, NOTE  55 VOLUME  8
+                     0x19,0x43, //    941 T1 ON, NOTE  67 VOLUME  9
+                     0x28,0x30, //     19 T2 ON, NOTE  48 VOLUME  8
+                     0x18,0x43, //    941 T1 ON, NOTE  67 VOLUME  8
+                     0x68,0x37, //      0 T2 ON, NOTE  55 VOLUME  8
+                     0x48,0x41, //    960 T2 ON, NOTE  65 VOLUME  8
+                     0x38,0x37, //     19 T1 ON, NOTE  55 VOLUME  8
+                     0x18,0x40, //    941 T1 ON, NOTE  64 VOLUME  8
+                     0x28,0x37, //     19 T2 ON, NOTE  55 VOLUME  8
+                     0x07,0x3e, //    941 T2 ON, NOTE  62 VOLUME  7
+                     0x38,0x37, //     19 T1 ON, NOTE  55 VOLUME  8
+                     0x18,0x3c, //    941 T1 ON, NOTE  60 VOLUME  8
+                     0x28,0x37, //     19 T2 ON, NOTE  55 VOLUME  8
+           0xe9,0x0e,0xed,0x3e, //   1901 T2 ON, NOTE  62 VOLUME  9
+                     0x38,0x37, //     19 T1 ON, NOTE  55 VOLUME  8
+                     0x19,0x40, //    941 T1 ON, NOTE  64 VOLUME  9
+                     0x28,0x37, //     19 T2 ON, NOTE  55 VOLUME  8
+                     0x08,0x3e, //    941 T2 ON, NOTE  62 VOLUME  8
+                     0x38,0x37, //     19 T1 ON, NOTE  55 VOLUME  8
+           0xf8,0x0b,0x8d,0x3c, //   1421 T1 ON, NOTE  60 VOLUME  8
+                0xe8,0x9a,0x37, //     26 T2 ON, NOTE  55 VOLUME  8
+                     0x88,0x30, //    454 T2 ON, NOTE  48 VOLUME  8
+                          0xb0, //   1823 T1 OFF
+                0xf6,0xe1,0x3e, //     97 T1 ON, NOTE  62 VOLUME  6
+                     0x65,0x37, //      0 T2 ON, NOTE  55 VOLUME  5
+                     0x55,0x3e, //    960 T1 ON, NOTE  62 VOLUME  5
+                     0x46,0x40, //    960 T2 ON, NOTE  64 VOLUME  6
+                     0x35,0x37, //     19 T1 ON, NOTE  55 VOLUME  5
+                     0x15,0x3c, //    941 T1 ON, NOTE  60 VOLUME  5
+                     0x25,0x37, //     19 T2 ON, NOTE  55 VOLUME  5
+                     0x05,0x3e, //    941 T2 ON, NOTE  62 VOLUME  5
+                     0x35,0x37, //     19 T1 ON, NOTE  55 VOLUME  5
+                     0x16,0x40, //    941 T1 ON, NOTE  64 VOLUME  6
+                     0x25,0x37, //     19 T2 ON, NOTE  55 VOLUME  5
+           0xe5,0x03,0xcd,0x41, //    461 T2 ON, NOTE  65 VOLUME  5
+                     0xd5,0x37, //      8 T1 ON, NOTE  55 VOLUME  5
+           0xf5,0x03,0xd8,0x40, //    472 T1 ON, NOTE  64 VOLUME  5
+                     0xc5,0x37, //      8 T2 ON, NOTE  55 VOLUME  5
+           0xe4,0x07,0xb8,0x3c, //    952 T2 ON, NOTE  60 VOLUME  4
+                     0x35,0x37, //     19 T1 ON, NOTE  55 VOLUME  5
+                     0x16,0x3e, //    941 T1 ON, NOTE  62 VOLUME  6
+                     0x25,0x37, //     19 T2 ON, NOTE  55 VOLUME  5
+                     0x06,0x40, //    941 T2 ON, NOTE  64 VOLUME  6
+                     0x35,0x37, //     19 T1 ON, NOTE  55 VOLUME  5
+           0xf6,0x03,0xcd,0x41, //    461 T1 ON, NOTE  65 VOLUME  6
+                     0xc5,0x37, //      8 T2 ON, NOTE  55 VOLUME  5
+           0xe5,0x03,0xd8,0x40, //    472 T2 ON, NOTE  64 VOLUME  5
+                     0xd5,0x38, //      8 T1 ON, NOTE  56 VOLUME  5
+           0xf5,0x07,0xb8,0x3e, //    952 T1 ON, NOTE  62 VOLUME  5
+                     0x25,0x38, //     19 T2 ON, NOTE  56 VOLUME  5
+                     0x05,0x3c, //    941 T2 ON, NOTE  60 VOLUME  5
+                     0x35,0x39, //     19 T1 ON, NOTE  57 VOLUME  5
+                     0x15,0x3e, //    941 T1 ON, NOTE  62 VOLUME  5
+                     0x25,0x36, //     19 T2 ON, NOTE  54 VOLUME  5
+                0xf0,0x06,0xfc, //    892 T1 OFF
+                0xf5,0xb1,0x37, //     49 T1 ON, NOTE  55 VOLUME  5
+                          0x60, //      0 T2 OFF
+                     0x47,0x40, //    960 T2 ON, NOTE  64 VOLUME  7
+                     0x59,0x3c, //    960 T1 ON, NOTE  60 VOLUME  9
+                     0x48,0x40, //    960 T2 ON, NOTE  64 VOLUME  8
+                     0x58,0x41, //    960 T1 ON, NOTE  65 VOLUME  8
+                     0x28,0x3a, //     19 T2 ON, NOTE  58 VOLUME  8
+                     0x09,0x43, //    941 T2 ON, NOTE  67 VOLUME  9
+                     0x38,0x3a, //     19 T1 ON, NOTE  58 VOLUME  8
+                     0x18,0x43, //    941 T1 ON, NOTE  67 VOLUME  8
+                     0x68,0x39, //      0 T2 ON, NOTE  57 VOLUME  8
+                     0x47,0x41, //    960 T2 ON, NOTE  65 VOLUME  7
+                     0x38,0x39, //     19 T1 ON, NOTE  57 VOLUME  8
+                     0x18,0x40, //    941 T1 ON, NOTE  64 VOLUME  8
+                     0x28,0x35, //     19 T2 ON, NOTE  53 VOLUME  8
+                     0x08,0x3e, //    941 T2 ON, NOTE  62 VOLUME  8
+                     0x38,0x35, //     19 T1 ON, NOTE  53 VOLUME  8
+                     0x18,0x3c, //    941 T1 ON, NOTE  60 VOLUME  8
+                     0x28,0x34, //     19 T2 ON, NOTE  52 VOLUME  8
+           0xe8,0x0e,0xed,0x3e, //   1901 T2 ON, NOTE  62 VOLUME  8
+                     0x38,0x37, //     19 T1 ON, NOTE  55 VOLUME  8
+                     0x19,0x40, //    941 T1 ON, NOTE  64 VOLUME  9
+                     0x29,0x3c, //     19 T2 ON, NOTE  60 VOLUME  9
+                     0x08,0x3e, //    941 T2 ON, NOTE  62 VOLUME  8
+                     0x38,0x37, //     19 T1 ON, NOTE  55 VOLUME  8
+           0xf7,0x0b,0x8d,0x3c, //   1421 T1 ON, NOTE  60 VOLUME  7
+                0xe8,0x9a,0x37, //     26 T2 ON, NOTE  55 VOLUME  8
+                     0x98,0x3c, //    454 T1 ON, NOTE  60 VOLUME  8
+                     0xb8,0x34, //   1823 T1 ON, NOTE  52 VOLUME  8
+                0xff,0xe1,0x01, //     97 BOTH OFF
+                     0x7f,0x05  //      0 END PROGRAM
 };
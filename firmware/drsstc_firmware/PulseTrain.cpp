@@ -0,0 +1,130 @@
+#include "PulseTrain.h"
+#include "VoiceBackend.h"
+#include "EventQueue.h"
+
+// ISR cost, estimated from the expected -Os code: about 75 cycles per period
+// (5 us), plus a wait for the pulse to end before a silent period (at most
+// 20 us, once per rest). At the minimum period that is 29% CPU; the converter's
+// renders peak at 1.4-3.4k pulses/s (100 ms windows), under 2% CPU.
+// The queue holds the periods between play_midi() calls: with the loop's
+// 2 ms deadline, 16k pulses/s before an underrun (host_sim pulse-test).
+#define PULSE_TRAIN_QUEUE_SIZE 32
+#define PULSE_TRAIN_IDLE_TOP   1999   // 1 ms silent periods while idle
+#define PULSE_TRAIN_SILENT     0xffff // duty marker for a period without a pulse
+
+namespace {
+  struct PulsePeriod {
+    uint16_t top;
+    uint16_t duty; // width - 1, or PULSE_TRAIN_SILENT
+  };
+
+  // Filled by the player, drained by the ISR
+  SpscQueue<PulsePeriod, PULSE_TRAIN_QUEUE_SIZE> queue;
+
+  volatile bool train_ended = false;
+  volatile bool train_finished = false;
+  volatile bool train_paused = false;
+
+  // Period the ISR last set up, which starts at the next BOTTOM (OCR1A is
+  // buffered until then), and whether OC1A drives the pin
+  uint16_t current_top = PULSE_TRAIN_IDLE_TOP;
+  uint16_t current_duty = PULSE_TRAIN_SILENT;
+  bool output_connected = false;
+  // Duty of the period the counter is in now
+  uint16_t running_duty = PULSE_TRAIN_SILENT;
+}
+
+void pulse_train_start() {
+  TIMSK1 = 0;
+  // Timer stopped in normal mode, so the buffered registers are written directly
+  TCCR1B = 0;
+  TCCR1A = 0;
+  TCNT1 = 0;
+  ICR1 = PULSE_TRAIN_IDLE_TOP;
+  OCR1A = 0;
+  queue.clear();
+  train_ended = train_finished = train_paused = false;
+  current_top = PULSE_TRAIN_IDLE_TOP;
+  current_duty = PULSE_TRAIN_SILENT;
+  running_duty = PULSE_TRAIN_SILENT;
+  output_connected = false;
+
+  // WGM11 (0x02) + WGM13 + WGM12 (0x18) = fast PWM mode, ICR1 as TOP; OC1A
+  // disconnected until the first pulse
+  TCCR1A = _BV(WGM11);
+  TIFR1 = _BV(TOV1);
+  TIMSK1 = _BV(TOIE1);
+  // CS11 (0x02) = 8x prescale
+  TCCR1B = _BV(WGM13) | _BV(WGM12) | _BV(CS11);
+}
+
+void pulse_train_stop() {
+  TIMSK1 = 0;
+  // Disconnected mid-pulse, OC1A would stay set and drive the pin when
+  // voice 0 next connects it. current_duty is the next period's; a silent
+  // period left connected has its pin low already.
+  if (output_connected && running_duty != PULSE_TRAIN_SILENT) {
+    while (TCNT1 <= running_duty) {}
+  }
+  voice_off(0);
+}
+
+bool pulse_train_push(uint16_t top, uint8_t width) {
+  PulsePeriod period = {top, width ? (uint16_t)(width - 1) : (uint16_t)PULSE_TRAIN_SILENT};
+  return queue.push(period);
+}
+
+void pulse_train_end() {
+  train_ended = true;
+}
+
+bool pulse_train_finished() {
+  return train_finished;
+}
+
+void pulse_train_pause(bool paused) {
+  train_paused = paused;
+}
+
+// Runs at each TOP, just after the counter wrapped to start a new period.
+// ICR1 is not buffered, so this period's TOP is set now; OCR1A is, so the
+// duty written here takes effect at the next BOTTOM.
+ISR(TIMER1_OVF_vect) {
+  ICR1 = current_top;
+  running_duty = current_duty;
+
+  PulsePeriod period = {PULSE_TRAIN_IDLE_TOP, PULSE_TRAIN_SILENT};
+  if (train_paused) {
+    // Hold the queue
+  } else if (queue.pop(period)) {
+    // Next queued period
+  } else if (train_ended) {
+    train_finished = true;
+  } else {
+    pulse_train_notifications.post(NOTIFY_UNDERRUN);
+  }
+  uint16_t top = period.top;
+  uint16_t duty = period.duty;
+
+  if (duty == PULSE_TRAIN_SILENT) {
+    // Even OCR1A = 0 gives a one-count spike at BOTTOM, so the pin is
+    // disconnected instead, once this period's pulse is over
+    if (output_connected) {
+      while (TCNT1 <= running_duty) {}
+      TCCR1A = _BV(WGM11);
+      output_connected = false;
+    }
+    OCR1A = 0;
+  } else {
+    if (!output_connected) {
+      // This period is silent and OC1A already cleared at count 0, so the
+      // pin stays low until the next BOTTOM
+      // COM1A1 (0x80) = non-inverted PWM output to channel A
+      TCCR1A = _BV(COM1A1) | _BV(WGM11);
+      output_connected = true;
+    }
+    OCR1A = duty;
+  }
+  current_top = top;
+  current_duty = duty;
+}
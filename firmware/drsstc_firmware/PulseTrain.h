@@ -0,0 +1,30 @@
+#pragma once
+
+#include <arduino.h>
+
+// Pre-rendered pulse-train playback. The player decodes one queue entry per
+// Timer1 period and the Timer1 overflow ISR replays them, with no per-note
+// logic: each period starts with the gate pulse on voice 0's pin (OC1A) and
+// lasts until the next pulse. The pulse width is set by the double-buffered
+// OCR1A, so a late ISR can shift a pulse but never lengthen it.
+//
+// Timer1 runs at 8x prescale: 0.5 us ticks, periods of up to 65536 ticks
+// (32.8 ms). A period must give the ISR time to set ICR1 before it ends.
+#define PULSE_TRAIN_MIN_PERIOD  32      // ticks (16 us)
+#define PULSE_TRAIN_MAX_PERIOD  0x10000 // ticks (32.8 ms)
+
+// Takes over Timer1 from voice 0 until pulse_train_stop()
+void pulse_train_start();
+void pulse_train_stop();
+
+// Queues one period of top + 1 ticks, starting with a pulse of width ticks
+// (0 = silent). Returns false when the queue is full.
+bool pulse_train_push(uint16_t top, uint8_t width);
+// No more pulses will be queued; the train finishes when the queue drains
+void pulse_train_end();
+bool pulse_train_finished();
+// While paused the ISR plays silent periods and keeps the queue
+void pulse_train_pause(bool paused);
+
+// Periods the ISR finds no entry for while playing are posted as
+// NOTIFY_UNDERRUN and counted in pulse_train_underruns (EventQueue.h)
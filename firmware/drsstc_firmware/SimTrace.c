@@ -0,0 +1,23 @@
+#include "SimTrace.h"
+
+// Compiled as C: the simavr section macros use C99 designated initializers.
+#if defined(SIMAVR_TRACE) && defined(__AVR_ATmega328P__)
+
+#include <avr/io.h>
+#include <simavr/avr/avr_mcu_section.h>
+
+AVR_MCU(F_CPU, "atmega328p");
+AVR_MCU_VCD_FILE("drsstc_trace.vcd", 1000);
+
+// Pin numbers as in pin_definitions.h
+AVR_MCU_VCD_PORT_PIN('B', 1, "PWM_1");      // pin 9, Timer1
+AVR_MCU_VCD_PORT_PIN('D', 3, "PWM_2");      // pin 3, Timer2
+AVR_MCU_VCD_PORT_PIN('B', 0, "OCD_DETECT"); // pin 8
+AVR_MCU_VCD_PORT_PIN('B', 2, "LED1");       // pin 10
+AVR_MCU_VCD_PORT_PIN('B', 3, "LED2");       // pin 11
+AVR_MCU_VCD_PORT_PIN('C', 0, "MSTR_EN");    // A0
+AVR_MCU_VCD_PORT_PIN('C', 1, "MODE_IN");    // A1
+AVR_MCU_VCD_PORT_PIN('C', 2, "TEST_IN");    // A2
+AVR_MCU_VCD_PORT_PIN('C', 3, "TRIG_IN");    // A3
+
+#endif
@@ -0,0 +1,11 @@
+#pragma once
+
+// Define SIMAVR_TRACE to embed a simavr trace description in the firmware
+// image (ATmega328 only). Running the compiled .elf under simavr's run_avr
+// then writes drsstc_trace.vcd with both gate outputs, the OCD input, the
+// status LEDs and the panel switch inputs, for checking pulse widths,
+// periods, note timing and state changes without a coil.
+// Requires the simavr headers (avr_mcu_section.h) on the include path.
+// firmware/simavr_test builds such an image and runs a scripted front panel
+// test against it: make -C firmware/simavr_test check
+//#define SIMAVR_TRACE
@@ -0,0 +1,544 @@
+#include "SmfPlayer.h"
+
+#ifdef SMF_PLAYBACK
+
+#if !defined(__AVR_ATmega2560__)
+  #error "SMF_PLAYBACK needs the ATmega2560: the 328's SPI pins drive LED1 and LED2"
+#endif
+
+#include <SD.h>
+#include "StateMachine.h" // SERIAL_LOGGING flag
+#include "MIDIPlayer.h"
+#include "pin_definitions.h"
+#include "EventQueue.h"
+#include "VoiceBackend.h"
+
+#define SMF_HEADER_LENGTH 6
+#define SMF_DRUM_CHANNEL  9
+#define SMF_NO_VOICE      0xff
+// Status, meta type, a 4-byte length, a tempo and a 4-byte delta
+#define SMF_MAX_EVENT_BYTES 13
+
+// Status bytes and meta events
+#define MIDI_NOTE_OFF        0x80
+#define MIDI_NOTE_ON         0x90
+#define MIDI_CONTROL         0xB0
+#define MIDI_PROGRAM         0xC0
+#define MIDI_PRESSURE        0xD0
+#define MIDI_SYSEX           0xF0
+#define MIDI_SYSEX_CONTINUE  0xF7
+#define MIDI_META            0xFF
+#define META_END_OF_TRACK    0x2F
+#define META_SET_TEMPO       0x51
+#define CONTROL_SOUND_OFF    120
+#define CONTROL_NOTES_OFF    123
+
+static_assert(NUM_VOICES <= 8, "song voice mask is 8 bits");
+
+namespace {
+  File smf_file;
+  uint8_t file_count = 0;
+
+  struct Track {
+    uint32_t pos;     // file offset of the next byte to buffer
+    uint32_t end;     // file offset after the track chunk
+    uint32_t tick;    // of the pending event, whose delta has been read
+    uint8_t status;   // running status, 0 when there is none
+    uint8_t head;
+    uint8_t count;
+    uint8_t buffer[SMF_TRACK_BUFFER];
+  };
+
+  Track tracks[SMF_MAX_TRACKS];
+  // Min-heap of track indices, ordered by pending tick, then track index
+  uint8_t heap[SMF_MAX_TRACKS];
+  uint8_t heap_size = 0;
+
+  uint16_t ticks_per_beat = 0;
+  unsigned long tempo = 500000;  // us per beat
+  // Event times count from the last tempo change, so the rounding of
+  // ticks_to_us() does not build up from one event to the next
+  unsigned long tempo_us = 0;
+  uint32_t tempo_tick = 0;
+  uint32_t play_tick = 0;        // of the last event played
+  uint32_t beat_num = 0;
+
+  struct Note {
+    uint8_t channel;
+    uint8_t note;
+    uint8_t volume;
+    uint8_t song_voice;  // SMF_NO_VOICE while not among the highest
+    bool restruck;       // needs a note-on on its song voice
+  };
+
+  Note notes[SMF_MAX_NOTES];
+  uint8_t num_notes = 0;
+  uint8_t busy_voices = 0;       // song voices in use, one bit each
+  bool notes_changed = false;
+
+  // Big-endian, as every SMF header field
+  uint32_t read_be(uint8_t length) {
+    uint32_t value = 0;
+    while (length--) value = (value << 8) | (uint8_t)smf_file.read();
+    return value;
+  }
+
+  bool read_tag(const char* tag) {
+    char found[4];
+    if (smf_file.read(found, 4) != 4) return false;
+    return !memcmp(found, tag, 4);
+  }
+
+  bool track_done(const Track& track) {
+    return track.head == track.count && track.pos >= track.end;
+  }
+
+  // Buffer refills in this smf_play() call. Each seeks to its track's
+  // offset, which loads an SD block (~1 ms) whenever the last read was for
+  // another track.
+  uint8_t refills = 0;
+
+  // Moves the buffered bytes to the front and fills the rest of the buffer
+  void fill_track(Track& track) {
+    uint8_t kept = track.count - track.head;
+    memmove(track.buffer, track.buffer + track.head, kept);
+    uint32_t left = track.end - track.pos;
+    uint8_t count = left < (uint32_t)(SMF_TRACK_BUFFER - kept) ? left : SMF_TRACK_BUFFER - kept;
+    smf_file.seek(track.pos);
+    smf_file.read(track.buffer + kept, count);
+    track.pos += count;
+    track.head = 0;
+    track.count = kept + count;
+    refills++;
+  }
+
+  uint8_t read_track_byte(Track& track) {
+    if (track.head == track.count) {
+      if (track.pos >= track.end) return 0;
+      fill_track(track);
+    }
+    return track.buffer[track.head++];
+  }
+
+  void skip_track_bytes(Track& track, uint32_t length) {
+    uint8_t buffered = track.count - track.head;
+    if (length <= buffered) {
+      track.head += length;
+      return;
+    }
+    track.head = track.count;
+    length -= buffered;
+    track.pos = (track.end - track.pos > length) ? track.pos + length : track.end;
+  }
+
+  // At most 4 bytes, as the format allows
+  uint32_t read_track_varint(Track& track) {
+    uint32_t value = 0;
+    for (uint8_t i = 0; i < 4; i++) {
+      uint8_t byte_value = read_track_byte(track);
+      value = (value << 7) | (byte_value & 0x7f);
+      if (!(byte_value & 0x80)) break;
+    }
+    return value;
+  }
+
+  bool heap_before(uint8_t a, uint8_t b) {
+    return tracks[a].tick < tracks[b].tick || (tracks[a].tick == tracks[b].tick && a < b);
+  }
+
+  void sift_down(uint8_t slot) {
+    while (true) {
+      uint8_t first = slot;
+      uint8_t left = 2 * slot + 1;
+      if (left < heap_size && heap_before(heap[left], heap[first])) first = left;
+      if (left + 1 < heap_size && heap_before(heap[left + 1], heap[first])) first = left + 1;
+      if (first == slot) return;
+      uint8_t swap = heap[slot];
+      heap[slot] = heap[first];
+      heap[first] = swap;
+      slot = first;
+    }
+  }
+
+  void heap_push(uint8_t index) {
+    uint8_t slot = heap_size++;
+    heap[slot] = index;
+    while (slot && heap_before(heap[slot], heap[(slot - 1) / 2])) {
+      uint8_t parent = (slot - 1) / 2;
+      heap[slot] = heap[parent];
+      heap[parent] = index;
+      slot = parent;
+    }
+  }
+
+  // Whole beats first, so long deltas do not overflow
+  unsigned long ticks_to_us(uint32_t ticks) {
+    return (ticks / ticks_per_beat) * tempo + (ticks % ticks_per_beat) * tempo / ticks_per_beat;
+  }
+
+  unsigned long event_us(uint32_t tick) {
+    return tempo_us + ticks_to_us(tick - tempo_tick);
+  }
+
+  uint8_t scale_volume(uint8_t velocity) {
+    return ((uint16_t)velocity * SMF_VOLUME_SCALE + 127) >> 7;
+  }
+
+  void release_voice(Note& entry) {
+    if (entry.song_voice == SMF_NO_VOICE) return;
+    silence_midi(entry.song_voice);
+    busy_voices &= ~_BV(entry.song_voice);
+    entry.song_voice = SMF_NO_VOICE;
+  }
+
+  void remove_note(uint8_t i) {
+    release_voice(notes[i]);
+    notes[i] = notes[--num_notes];
+    notes_changed = true;
+  }
+
+  void note_off(uint8_t channel, uint8_t note) {
+    for (uint8_t i = 0; i < num_notes; i++) {
+      if (notes[i].channel == channel && notes[i].note == note) {
+        remove_note(i);
+        return;
+      }
+    }
+  }
+
+  void channel_off(uint8_t channel) {
+    uint8_t i = 0;
+    while (i < num_notes) {
+      if (notes[i].channel == channel) {
+        remove_note(i);
+      } else {
+        i++;
+      }
+    }
+  }
+
+  void note_on(uint8_t channel, uint8_t note, uint8_t velocity) {
+    uint8_t slot = num_notes;
+    uint8_t lowest = 0;
+    for (uint8_t i = 0; i < num_notes; i++) {
+      if (notes[i].channel == channel && notes[i].note == note) {
+        slot = i;
+        break;
+      }
+      if (notes[i].note < notes[lowest].note) lowest = i;
+    }
+    if (slot == SMF_MAX_NOTES) {
+      // Full: a higher note replaces the lowest
+      if (note <= notes[lowest].note) return;
+      release_voice(notes[lowest]);
+      slot = lowest;
+    } else if (slot == num_notes) {
+      num_notes++;
+      notes[slot].song_voice = SMF_NO_VOICE;
+    }
+    notes[slot].channel = channel;
+    notes[slot].note = note;
+    notes[slot].volume = scale_volume(velocity);
+    notes[slot].restruck = true;
+    notes_changed = true;
+  }
+
+  // Gives the NUM_VOICES highest notes a song voice; notes that stay among
+  // them keep theirs. O(SMF_MAX_NOTES^2), only after events changed the table.
+  void select_voices() {
+    if (!notes_changed) return;
+    notes_changed = false;
+    bool selected[SMF_MAX_NOTES];
+    for (uint8_t i = 0; i < num_notes; i++) {
+      uint8_t higher = 0;
+      for (uint8_t j = 0; j < num_notes; j++) {
+        if (notes[j].note > notes[i].note || (notes[j].note == notes[i].note && j < i)) higher++;
+      }
+      selected[i] = higher < NUM_VOICES;
+      if (!selected[i]) release_voice(notes[i]);
+    }
+    for (uint8_t i = 0; i < num_notes; i++) {
+      if (!selected[i]) continue;
+      Note& entry = notes[i];
+      if (entry.song_voice == SMF_NO_VOICE) {
+        uint8_t voice = 0;
+        while (busy_voices & _BV(voice)) voice++;
+        busy_voices |= _BV(voice);
+        entry.song_voice = voice;
+        entry.restruck = true;
+      }
+      if (entry.restruck) play_midi_note(entry.note, entry.volume, entry.song_voice);
+      entry.restruck = false;
+    }
+  }
+
+  void clear_notes() {
+    for (uint8_t voice = 0; voice < NUM_VOICES; voice++) silence_midi(voice);
+    num_notes = 0;
+    busy_voices = 0;
+    notes_changed = false;
+  }
+
+  void play_channel_event(uint8_t status, uint8_t data, Track& track) {
+    uint8_t channel = status & 0x0f;
+    uint8_t type = status & 0xf0;
+    if (type == MIDI_PROGRAM || type == MIDI_PRESSURE) return;
+    uint8_t data2 = read_track_byte(track);
+    if (channel == SMF_DRUM_CHANNEL) return;
+    if (type == MIDI_NOTE_ON && data2) {
+      note_on(channel, data, data2);
+    } else if (type == MIDI_NOTE_ON || type == MIDI_NOTE_OFF) {
+      note_off(channel, data);
+    } else if (type == MIDI_CONTROL && (data == CONTROL_SOUND_OFF || data == CONTROL_NOTES_OFF)) {
+      channel_off(channel);
+    }
+  }
+
+  // Plays the pending event of the track on top of the heap, then reads the
+  // track's next delta and restores the heap
+  void play_next_event() {
+    uint8_t index = heap[0];
+    Track& track = tracks[index];
+    bool ended = false;
+    uint8_t status = read_track_byte(track);
+    if (status < 0x80) {
+      // Running status: this was the first data byte
+      if (!track.status) {
+        ended = true;
+      } else {
+        play_channel_event(track.status, status, track);
+      }
+    } else if (status < MIDI_SYSEX) {
+      track.status = status;
+      play_channel_event(status, read_track_byte(track), track);
+    } else {
+      // Sysex and meta events cancel running status
+      track.status = 0;
+      uint8_t meta_type = (status == MIDI_META) ? read_track_byte(track) : 0;
+      uint32_t length = read_track_varint(track);
+      if (status == MIDI_META && meta_type == META_SET_TEMPO && length == 3) {
+        tempo_us = event_us(play_tick);
+        tempo_tick = play_tick;
+        tempo = (uint32_t)read_track_byte(track) << 16;
+        tempo |= (uint16_t)read_track_byte(track) << 8;
+        tempo |= read_track_byte(track);
+      } else {
+        skip_track_bytes(track, length);
+      }
+      ended = (status == MIDI_META && meta_type == META_END_OF_TRACK);
+    }
+    midi_instruction_count++;
+
+    if (ended || track_done(track)) {
+      heap[0] = heap[--heap_size];
+    } else {
+      track.tick += read_track_varint(track);
+    }
+    sift_down(0);
+  }
+
+  // Whether playing the track's pending event and reading the next delta
+  // could run out of buffered bytes
+  bool may_refill(const Track& track) {
+    return track.count - track.head < SMF_MAX_EVENT_BYTES && track.pos < track.end;
+  }
+
+  void top_up_track() {
+    Track* emptiest = NULL;
+    for (uint8_t i = 0; i < heap_size; i++) {
+      Track& track = tracks[heap[i]];
+      if (track.pos >= track.end || track.count - track.head > SMF_TRACK_BUFFER / 2) continue;
+      if (!emptiest || track.count - track.head < emptiest->count - emptiest->head) emptiest = &track;
+    }
+    if (emptiest) fill_track(*emptiest);
+  }
+
+  // The pending event of the heap's top track is the next one played
+  void advance_tick() {
+    play_tick = tracks[heap[0]].tick;
+  }
+
+  bool is_midi_file(File& entry) {
+    if (entry.isDirectory()) return false;
+    const char* name = entry.name();
+    size_t length = strlen(name);
+    return length > 4 && !strcasecmp(name + length - 4, ".MID");
+  }
+
+  // The file_index-th .MID file in the root directory
+  File open_midi_file(uint8_t file_index) {
+    File root = SD.open("/");
+    File entry;
+    while ((entry = root.openNextFile())) {
+      if (is_midi_file(entry) && !file_index--) break;
+      entry.close();
+    }
+    root.close();
+    return entry;
+  }
+
+  bool read_header() {
+    if (!read_tag("MThd") || read_be(4) != SMF_HEADER_LENGTH) return false;
+    uint16_t format = read_be(2);
+    uint16_t num_chunks = read_be(2);
+    ticks_per_beat = read_be(2);
+    // Format 2 holds independent sequences; SMPTE timing sets bit 15
+    if (format > 1 || !ticks_per_beat || (ticks_per_beat & 0x8000)) return false;
+
+    // Track cursors start at each MTrk chunk; other chunks are skipped
+    uint32_t pos = 8 + SMF_HEADER_LENGTH;
+    uint8_t num_tracks = 0;
+    heap_size = 0;
+    while (num_chunks-- && num_tracks < SMF_MAX_TRACKS && smf_file.seek(pos)) {
+      bool is_track = read_tag("MTrk");
+      uint32_t length = read_be(4);
+      pos += 8;
+      if (is_track) {
+        Track& track = tracks[num_tracks];
+        track.pos = pos;
+        track.end = pos + length;
+        track.status = 0;
+        track.head = 0;
+        track.count = 0;
+        track.tick = read_track_varint(track);
+        if (!track_done(track)) heap_push(num_tracks);
+        num_tracks++;
+      }
+      pos += length;
+    }
+    return heap_size > 0;
+  }
+}
+
+uint8_t init_smf_storage() {
+  file_count = 0;
+  if (!SD.begin(SD_CS)) {
+    #ifdef SERIAL_LOGGING
+      Serial.println(F("No SD card"));
+    #endif
+    return 0;
+  }
+  File root = SD.open("/");
+  File entry;
+  while ((entry = root.openNextFile())) {
+    if (is_midi_file(entry) && file_count < 0x7f) file_count++;
+    entry.close();
+  }
+  root.close();
+  #ifdef SERIAL_LOGGING
+    Serial.print(file_count);
+    Serial.println(F(" MIDI files on SD card"));
+  #endif
+  return file_count;
+}
+
+uint8_t smf_song_count() {
+  return file_count;
+}
+
+bool smf_start(uint8_t file_index, unsigned long timestamp) {
+  smf_stop();
+  smf_file = open_midi_file(file_index);
+  if (!smf_file) return false;
+  #ifdef SERIAL_LOGGING
+    Serial.print(F("Playing file: "));
+    Serial.println(smf_file.name());
+  #endif
+  tempo = 500000;
+  if (!read_header()) {
+    #ifdef SERIAL_LOGGING
+      Serial.println(F("Unsupported MIDI file"));
+    #endif
+    smf_stop();
+    return false;
+  }
+  tempo_us = timestamp;
+  tempo_tick = 0;
+  refills = 0;
+  play_tick = 0;
+  beat_num = 0;
+  // Beat 0 resets the LED metronome
+  player_notifications.post(NOTIFY_BEAT, 0);
+  return true;
+}
+
+void smf_stop() {
+  heap_size = 0;
+  clear_notes();
+  if (smf_file) smf_file.close();
+}
+
+bool smf_play(unsigned long timestamp) {
+  uint8_t events = 0;
+  while (heap_size && events++ < SMF_MAX_EVENTS_PER_CALL) {
+    // Signed difference, as play_midi()
+    unsigned long due_us = event_us(tracks[heap[0]].tick);
+    if ((long)(timestamp - due_us) < 0) break;
+    // An event that may need a refill past the bound waits for the next call
+    if (refills >= SMF_MAX_REFILLS_PER_CALL && may_refill(tracks[heap[0]])) break;
+    advance_tick();
+    play_next_event();
+  }
+  select_voices();
+  // Calls that read nothing top up the emptiest track buffer, so that the
+  // tracks seldom run dry together
+  if (!refills) top_up_track();
+  refills = 0;
+
+  uint32_t beat = play_tick / ticks_per_beat;
+  if (beat != beat_num) {
+    beat_num = beat;
+    player_notifications.post(NOTIFY_BEAT, beat_num);
+  }
+
+  if (heap_size) return true;
+  smf_stop();
+  return false;
+}
+
+void smf_shift_position(long offset_us) {
+  tempo_us -= offset_us;
+}
+
+#ifdef SONG_BENCHMARK
+// Decodes each file start to end without waiting out its timing, as
+// benchmark_song_decode(). The cycles of an event include its SD reads.
+void benchmark_smf_decode() {
+  bench_cycles_start();
+  uint32_t start = bench_cycles();
+  uint32_t overhead = bench_cycles() - start;
+
+  Serial.println(F("MIDI file decode: events, cycles, worst event, CPU"));
+  for (uint8_t i = 0; i < file_count; i++) {
+    if (!smf_start(i, 0)) continue;
+    Serial.flush();
+    unsigned long events = 0;
+    unsigned long total_cycles = 0;
+    uint32_t worst_cycles = 0;
+    while (heap_size) {
+      start = bench_cycles();
+      advance_tick();
+      play_next_event();
+      select_voices();
+      uint32_t cycles = bench_cycles() - start - overhead;
+      events++;
+      total_cycles += cycles;
+      if (cycles > worst_cycles) worst_cycles = cycles;
+    }
+    unsigned long song_us = event_us(play_tick);
+    smf_stop();
+
+    Serial.print(events);
+    Serial.print(F(", "));
+    Serial.print(total_cycles);
+    Serial.print(F(", "));
+    Serial.print(worst_cycles);
+    Serial.print(F(", "));
+    Serial.print(100.0 * total_cycles / ((float)song_us * (F_CPU / 1000000)), 3);
+    Serial.println(F("%"));
+  }
+  bench_cycles_stop();
+}
+#endif
+
+#endif
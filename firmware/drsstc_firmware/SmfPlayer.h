@@ -0,0 +1,54 @@
+#pragma once
+
+#include <arduino.h>
+
+// Plays Standard MIDI Files (format 0 and 1) straight from an SD card, with
+// no converter run. Each track has a cursor with a small read buffer and its
+// own running-status parser; a min-heap of the cursors, keyed by the tick of
+// their next event, merges the tracks in time order. Sounding notes are kept
+// in a fixed table, and after each batch of events the NUM_VOICES highest
+// become song voices 0..NUM_VOICES - 1 for the router. A note keeps its song
+// voice for as long as it stays among the highest.
+//
+// RAM is fixed by the limits below, whatever the file size (~700 bytes plus
+// the SD library's 512-byte block cache). Tracks past SMF_MAX_TRACKS are
+// ignored, and when the note table is full a new note replaces the lowest
+// one if it is higher. The drum channel (10) is skipped.
+//
+// ATmega2560 only: the card sits on the hardware SPI pins (50-53), which on
+// the 328 (10-13) carry the status LEDs. Files with a .MID extension in the
+// card's root directory follow the flash songs in the song rotation.
+//
+// A track buffer refill seeks to that track's offset, and the SD library
+// keeps a single block cache, so with several tracks each refill loads a
+// block (~1.1 ms). Without a bound, 16-track superman.mid loaded up to 9
+// blocks (~10 ms) in one call on the host model (host_sim, make smf-test).
+// smf_play() stops after SMF_MAX_REFILLS_PER_CALL refills, when the next
+// event may need another, and calls that read nothing top up the emptiest
+// buffer: the most in one call is now 3-4 blocks over the midi_converter
+// files, and the 2-track ones load at most one.
+//#define SMF_PLAYBACK
+#define SMF_MAX_TRACKS          16
+#define SMF_TRACK_BUFFER        16  // bytes per track cursor
+#define SMF_MAX_NOTES           16  // sounding notes tracked
+#define SMF_MAX_EVENTS_PER_CALL 32  // catch-up bound per smf_play() call
+#define SMF_MAX_REFILLS_PER_CALL 2  // track buffer refills per smf_play() call
+#define SMF_VOLUME_SCALE        10  // velocity 128 = 10 cycles, as midi_converter.py --vol_scale
+
+#ifdef SMF_PLAYBACK
+// Mounts the card and counts its .MID files; returns the count
+uint8_t init_smf_storage();
+uint8_t smf_song_count();
+
+// Opens the file and reads its header and track chunks; false if the file
+// is missing or not a format 0/1 file with tick-based timing
+bool smf_start(uint8_t file_index, unsigned long timestamp);
+void smf_stop();
+// Plays every event that is due; returns false at the end of the song
+bool smf_play(unsigned long timestamp);
+// Moves the song timeline, as shift_midi_position()
+void smf_shift_position(long offset_us);
+
+// SONG_BENCHMARK builds: decode cycles of each file, over serial
+void benchmark_smf_decode();
+#endif
@@ -0,0 +1,338 @@
+#pragma once
+
+#include <arduino.h>
+#include "VoiceRouter.h" // MAX_SONG_VOICES
+
+// Compile-time song builder: a short text score is parsed by constexpr
+// functions into the song format start_midi() plays (see MIDIPlayer.cpp),
+// so jingles and test patterns need no converter run and no runtime work.
+//
+//   SONG_DSL(SCALE, "t120 l4 C4/8 D4/8 E4/8 F4/8 v1 C3 v0 G4/2");
+//
+// Tokens, separated by spaces or bar lines '|':
+//   tN     tempo, N beats (quarter notes) per minute
+//   vN     voice for the following notes (0 = highest priority)
+//   lN     loudness for the following notes, 1-14 cycles
+//   C4     note on the current voice; A-G, optional # or b, octave 0-9
+//          (C4 = MIDI 60), replacing the voice's previous note
+//   -      note off on the current voice
+//   /N     advance time by 1/N of a whole note, /N. for dotted; N must
+//          divide a whole note (384 ticks), and twice for dotted (/128.
+//          would be 4.5 ticks)
+// A note or '-' may be followed directly by its duration: "C4/4 -/4".
+// Events are stamped with the time reached by the preceding '/' tokens.
+//
+// The builder is C++11 constexpr (the Arduino AVR core builds with
+// -std=gnu++11), so every token and separator is a level of recursion:
+// scores of more than ~500 of them (~900 characters of "C4/16 " steps)
+// exceed GCC's default -fconstexpr-depth of 512.
+#define SONG_DSL_TICKS_PER_BEAT 96
+#define SONG_DSL_MIN_NOTE       21   // lowest note the timer voices play
+#define SONG_DSL_MAX_NOTE       127
+#define SONG_DSL_MAX_VOLUME     14   // VOLUME_EXTENDED (15) is an escape
+#define SONG_DSL_MAX_EVENT_RATE 1000 // events/s: one per ms of main loop
+
+// Defines NAME as a pointer to the song in flash, after checking the score
+#define SONG_DSL(NAME, SCORE) \
+  namespace { \
+    struct NAME##_score { static constexpr const char* text() { return SCORE; } }; \
+    static_assert(song_dsl::check(SCORE) != SONG_DSL_ERR_SYNTAX, #NAME ": unknown token in score"); \
+    static_assert(song_dsl::check(SCORE) != SONG_DSL_ERR_NOTE, #NAME ": note outside the playable range"); \
+    static_assert(song_dsl::check(SCORE) != SONG_DSL_ERR_VOICE, #NAME ": voice above MAX_SONG_VOICES"); \
+    static_assert(song_dsl::check(SCORE) != SONG_DSL_ERR_VOLUME, #NAME ": loudness outside 1-14"); \
+    static_assert(song_dsl::check(SCORE) != SONG_DSL_ERR_TEMPO, #NAME ": tempo must be at least 1 bpm"); \
+    static_assert(song_dsl::check(SCORE) != SONG_DSL_ERR_DURATION, #NAME ": duration must divide a whole note, dotted ones into even ticks"); \
+    static_assert(song_dsl::check(SCORE) != SONG_DSL_ERR_RATE, #NAME ": events closer than SONG_DSL_MAX_EVENT_RATE allows"); \
+    const song_dsl::SongData<song_dsl::song_length(SCORE)> NAME##_data PROGMEM = \
+        song_dsl::build<NAME##_score>(song_dsl::MakeIndices<song_dsl::song_length(SCORE)>::type()); \
+  } \
+  extern const byte* const NAME = NAME##_data.bytes
+
+#define SONG_DSL_OK           0
+#define SONG_DSL_ERR_SYNTAX   1
+#define SONG_DSL_ERR_NOTE     2
+#define SONG_DSL_ERR_VOICE    3
+#define SONG_DSL_ERR_VOLUME   4
+#define SONG_DSL_ERR_TEMPO    5
+#define SONG_DSL_ERR_DURATION 6
+#define SONG_DSL_ERR_RATE     7
+
+namespace song_dsl {
+  // Song format constants, as in MIDIPlayer.cpp
+  constexpr unsigned long WHOLE = 4 * SONG_DSL_TICKS_PER_BEAT;
+  constexpr unsigned long DEFAULT_TEMPO = 500000; // us per beat
+  constexpr uint8_t DEFAULT_VOLUME = 4;
+  constexpr uint8_t DELTA_ESCAPE = 7;
+  constexpr uint8_t EVENT_VOICE0 = 0x10;
+  constexpr uint8_t VOLUME_EXTENDED = 0x0f;
+  constexpr uint8_t OPCODE_BOTH_OFF = 0x01;
+  constexpr uint8_t OPCODE_SET_TEMPO = 0x02;
+  constexpr uint8_t OPCODE_VOICE_ON = 0x03;
+  constexpr uint8_t OPCODE_VOICE_OFF = 0x04;
+  constexpr uint8_t OPCODE_END = 0x05;
+
+  // Fixed delta table: 0, 1/32, 1/16, 1/8, 1/4, 1/2 and a whole note
+  constexpr unsigned long delta_value(uint8_t code) {
+    return code == 0 ? 0 : WHOLE >> (6 - code);
+  }
+  constexpr uint8_t delta_code(unsigned long ticks, uint8_t code = 0) {
+    return code == DELTA_ESCAPE ? DELTA_ESCAPE
+        : delta_value(code) == ticks ? code : delta_code(ticks, code + 1);
+  }
+
+  // Varints are stored most significant group first; the last byte has bit 7 set
+  constexpr uint8_t varint_length(unsigned long value) {
+    return value < 0x80 ? 1 : 1 + varint_length(value >> 7);
+  }
+  constexpr uint8_t varint_byte(unsigned long value, uint8_t k) {
+    return ((value >> (7 * (varint_length(value) - 1 - k))) & 0x7f)
+        | (k == varint_length(value) - 1 ? 0x80 : 0);
+  }
+
+  // Header: ticks per beat, initial tempo and the delta table
+  constexpr unsigned long header_value(uint8_t i) {
+    return i == 0 ? SONG_DSL_TICKS_PER_BEAT : i == 1 ? DEFAULT_TEMPO : delta_value(i - 2);
+  }
+  constexpr unsigned header_length(uint8_t i = 0) {
+    return i == 2 + DELTA_ESCAPE ? 0 : varint_length(header_value(i)) + header_length(i + 1);
+  }
+  constexpr uint8_t header_byte(unsigned k, uint8_t i = 0) {
+    return k < varint_length(header_value(i)) ? varint_byte(header_value(i), k)
+        : header_byte(k - varint_length(header_value(i)), i + 1);
+  }
+
+  // Tokens
+  constexpr bool is_space(char c) {
+    return c == ' ' || c == '\t' || c == '\n' || c == '\r' || c == '|';
+  }
+  constexpr bool is_digit(char c) { return c >= '0' && c <= '9'; }
+  constexpr bool is_note(char c) { return c >= 'A' && c <= 'G'; }
+  constexpr unsigned long number(const char* s, unsigned pos, unsigned long value = 0) {
+    return is_digit(s[pos]) ? number(s, pos + 1, value * 10 + (s[pos] - '0')) : value;
+  }
+  constexpr unsigned skip_digits(const char* s, unsigned pos) {
+    return is_digit(s[pos]) ? skip_digits(s, pos + 1) : pos;
+  }
+  constexpr int pitch_class(char c) {
+    return c == 'C' ? 0 : c == 'D' ? 2 : c == 'E' ? 4 : c == 'F' ? 5
+        : c == 'G' ? 7 : c == 'A' ? 9 : 11;
+  }
+  constexpr int accidental(char c) { return c == '#' ? 1 : c == 'b' ? -1 : 0; }
+  // Position of the octave digit of the note at pos
+  constexpr unsigned octave_pos(const char* s, unsigned pos) {
+    return accidental(s[pos + 1]) ? pos + 2 : pos + 1;
+  }
+  constexpr int note_number(const char* s, unsigned pos) {
+    return pitch_class(s[pos]) + accidental(s[pos + 1])
+        + 12 * ((int)s[octave_pos(s, pos)] - '0' + 1);
+  }
+  // Duration token at pos ('/'); 0 when invalid, including a dotted one
+  // that is not a whole number of ticks
+  constexpr unsigned long duration(const char* s, unsigned pos) {
+    return number(s, pos + 1) == 0 || WHOLE % number(s, pos + 1) ? 0
+        : s[skip_digits(s, pos + 1)] != '.' ? WHOLE / number(s, pos + 1)
+        : WHOLE / number(s, pos + 1) % 2 ? 0
+        : WHOLE / number(s, pos + 1) * 3 / 2;
+  }
+  constexpr unsigned duration_end(const char* s, unsigned pos) {
+    return s[skip_digits(s, pos + 1)] == '.' ? skip_digits(s, pos + 1) + 1 : skip_digits(s, pos + 1);
+  }
+
+  // One event: its header byte, delta and payload
+  #define SONG_DSL_PAYLOAD_NONE     0
+  #define SONG_DSL_PAYLOAD_NOTE     1 // note
+  #define SONG_DSL_PAYLOAD_OPCODE   2 // opcode
+  #define SONG_DSL_PAYLOAD_VOICE_ON 3 // OPCODE_VOICE_ON, voice, note, volume
+  #define SONG_DSL_PAYLOAD_OFF      4 // OPCODE_VOICE_OFF, voice
+  #define SONG_DSL_PAYLOAD_TEMPO    5 // OPCODE_SET_TEMPO, tempo varint
+  struct Event {
+    uint8_t bits;   // T and VVVV of the event byte
+    uint8_t payload;
+    unsigned long a;
+    uint8_t b, c;
+    constexpr Event(uint8_t bits, uint8_t payload, unsigned long a = 0, uint8_t b = 0, uint8_t c = 0)
+        : bits(bits), payload(payload), a(a), b(b), c(c) {}
+  };
+
+  constexpr Event note_on(uint8_t voice, uint8_t note, uint8_t volume) {
+    return voice < 2 ? Event((voice ? 0 : EVENT_VOICE0) | volume, SONG_DSL_PAYLOAD_NOTE, note)
+        : Event(VOLUME_EXTENDED, SONG_DSL_PAYLOAD_VOICE_ON, voice, note, volume);
+  }
+  constexpr Event note_off(uint8_t voice) {
+    return voice < 2 ? Event(voice ? 0 : EVENT_VOICE0, SONG_DSL_PAYLOAD_NONE)
+        : Event(VOLUME_EXTENDED, SONG_DSL_PAYLOAD_OFF, voice);
+  }
+  constexpr Event opcode(uint8_t op) { return Event(VOLUME_EXTENDED, SONG_DSL_PAYLOAD_OPCODE, op); }
+  constexpr Event set_tempo(unsigned long tempo) {
+    return Event(VOLUME_EXTENDED, SONG_DSL_PAYLOAD_TEMPO, tempo);
+  }
+
+  constexpr unsigned payload_length(const Event& e) {
+    return e.payload == SONG_DSL_PAYLOAD_NONE ? 0
+        : e.payload == SONG_DSL_PAYLOAD_NOTE || e.payload == SONG_DSL_PAYLOAD_OPCODE ? 1
+        : e.payload == SONG_DSL_PAYLOAD_VOICE_ON ? 4
+        : e.payload == SONG_DSL_PAYLOAD_OFF ? 2
+        : 1 + varint_length(e.a);
+  }
+  constexpr uint8_t payload_byte(const Event& e, unsigned k) {
+    return e.payload == SONG_DSL_PAYLOAD_NOTE || e.payload == SONG_DSL_PAYLOAD_OPCODE ? e.a
+        : e.payload == SONG_DSL_PAYLOAD_VOICE_ON ? (k == 0 ? OPCODE_VOICE_ON : k == 1 ? e.a : k == 2 ? e.b : e.c)
+        : e.payload == SONG_DSL_PAYLOAD_OFF ? (k == 0 ? OPCODE_VOICE_OFF : e.a)
+        : k == 0 ? OPCODE_SET_TEMPO : varint_byte(e.a, k - 1);
+  }
+  constexpr unsigned delta_length(unsigned long delta) {
+    return delta_code(delta) == DELTA_ESCAPE ? varint_length(delta) : 0;
+  }
+  constexpr unsigned event_length(const Event& e, unsigned long delta) {
+    return 1 + delta_length(delta) + payload_length(e);
+  }
+  constexpr uint8_t event_byte(const Event& e, unsigned long delta, unsigned k) {
+    return k == 0 ? (delta_code(delta) << 5) | e.bits
+        : k <= delta_length(delta) ? varint_byte(delta, k - 1)
+        : payload_byte(e, k - 1 - delta_length(delta));
+  }
+
+  // Parser state between tokens
+  struct Walk {
+    const char* s;
+    unsigned pos;
+    uint8_t voice, volume;
+    unsigned long pending; // ticks since the last event
+    unsigned count;        // song bytes before this token
+    constexpr Walk(const char* s, unsigned pos, uint8_t voice, uint8_t volume,
+                   unsigned long pending, unsigned count)
+        : s(s), pos(pos), voice(voice), volume(volume), pending(pending), count(count) {}
+    constexpr char token() const { return s[pos]; }
+    constexpr Walk at(unsigned p) const { return Walk(s, p, voice, volume, pending, count); }
+    // After emitting an event of the given length
+    constexpr Walk emitted(unsigned p, unsigned length) const {
+      return Walk(s, p, voice, volume, 0, count + length);
+    }
+  };
+
+  constexpr Walk start(const char* s) {
+    return Walk(s, 0, 0, DEFAULT_VOLUME, 0, header_length());
+  }
+
+  // Whether the token emits an event, the event and the position after it
+  constexpr bool emits(const Walk& w) {
+    return w.token() == 't' || w.token() == '-' || is_note(w.token());
+  }
+  constexpr Event token_event(const Walk& w) {
+    return w.token() == 't' ? set_tempo(60000000UL / number(w.s, w.pos + 1))
+        : w.token() == '-' ? note_off(w.voice)
+        : note_on(w.voice, note_number(w.s, w.pos), w.volume);
+  }
+  constexpr unsigned token_end(const Walk& w) {
+    return w.token() == 't' || w.token() == 'l' || w.token() == 'v' ? skip_digits(w.s, w.pos + 1)
+        : w.token() == '-' ? w.pos + 1
+        : w.token() == '/' ? duration_end(w.s, w.pos)
+        : is_note(w.token()) ? octave_pos(w.s, w.pos) + (is_digit(w.s[octave_pos(w.s, w.pos)]) ? 1 : 0)
+        : w.pos + 1;
+  }
+
+  constexpr Walk next(const Walk& w) {
+    return emits(w) ? w.emitted(token_end(w), event_length(token_event(w), w.pending))
+        : w.token() == '/' ? Walk(w.s, token_end(w), w.voice, w.volume,
+                                  w.pending + duration(w.s, w.pos), w.count)
+        : w.token() == 'v' ? Walk(w.s, token_end(w), number(w.s, w.pos + 1), w.volume, w.pending, w.count)
+        : w.token() == 'l' ? Walk(w.s, token_end(w), w.voice, number(w.s, w.pos + 1), w.pending, w.count)
+        : w.at(token_end(w));
+  }
+
+  // The song ends with every voice off after the last duration, then OPCODE_END
+  constexpr unsigned end_length(const Walk& w) {
+    return event_length(opcode(OPCODE_BOTH_OFF), w.pending) + event_length(opcode(OPCODE_END), 0);
+  }
+  constexpr uint8_t end_byte(const Walk& w, unsigned k) {
+    return k < event_length(opcode(OPCODE_BOTH_OFF), w.pending)
+        ? event_byte(opcode(OPCODE_BOTH_OFF), w.pending, k)
+        : event_byte(opcode(OPCODE_END), 0, k - event_length(opcode(OPCODE_BOTH_OFF), w.pending));
+  }
+
+  constexpr unsigned walk_length(const Walk& w) {
+    return w.token() == '\0' ? w.count + end_length(w) : walk_length(next(w));
+  }
+  constexpr uint8_t walk_byte(const Walk& w, unsigned k) {
+    return w.token() == '\0' ? end_byte(w, k - w.count)
+        : emits(w) && k < w.count + event_length(token_event(w), w.pending)
+            ? event_byte(token_event(w), w.pending, k - w.count)
+        : walk_byte(next(w), k);
+  }
+
+  constexpr unsigned song_length(const char* s) { return walk_length(start(s)); }
+  constexpr uint8_t song_byte(const char* s, unsigned k) {
+    return k < header_length() ? header_byte(k) : walk_byte(start(s), k);
+  }
+
+  // Validation: the first error in the score, tracking the tempo and the
+  // events stamped at the current time for the event-rate budget
+  constexpr int token_error(const Walk& w) {
+    return w.token() == 't' ? (number(w.s, w.pos + 1) ? SONG_DSL_OK : SONG_DSL_ERR_TEMPO)
+        : w.token() == 'v' ? (is_digit(w.s[w.pos + 1]) && number(w.s, w.pos + 1) < MAX_SONG_VOICES
+                                  ? SONG_DSL_OK : SONG_DSL_ERR_VOICE)
+        : w.token() == 'l' ? (number(w.s, w.pos + 1) >= 1 && number(w.s, w.pos + 1) <= SONG_DSL_MAX_VOLUME
+                                  ? SONG_DSL_OK : SONG_DSL_ERR_VOLUME)
+        : w.token() == '/' ? (duration(w.s, w.pos) ? SONG_DSL_OK : SONG_DSL_ERR_DURATION)
+        : is_note(w.token()) ? (!is_digit(w.s[octave_pos(w.s, w.pos)]) ? SONG_DSL_ERR_SYNTAX
+                                : note_number(w.s, w.pos) < SONG_DSL_MIN_NOTE
+                                  || note_number(w.s, w.pos) > SONG_DSL_MAX_NOTE ? SONG_DSL_ERR_NOTE
+                                : SONG_DSL_OK)
+        : w.token() == '-' || is_space(w.token()) ? SONG_DSL_OK
+        : SONG_DSL_ERR_SYNTAX;
+  }
+  // events / (ticks * tempo / ticks per beat) must stay within the budget
+  constexpr bool over_rate(unsigned events, unsigned long ticks, unsigned long tempo) {
+    return (unsigned long long)events * 1000000ULL * SONG_DSL_TICKS_PER_BEAT
+        > (unsigned long long)SONG_DSL_MAX_EVENT_RATE * ticks * tempo;
+  }
+  constexpr int check_walk(const Walk& w, unsigned long tempo, unsigned events) {
+    return w.token() == '\0' ? SONG_DSL_OK
+        : token_error(w) != SONG_DSL_OK ? token_error(w)
+        : w.token() == '/' && events && over_rate(events, duration(w.s, w.pos), tempo) ? SONG_DSL_ERR_RATE
+        : check_walk(next(w),
+                     w.token() == 't' ? 60000000UL / number(w.s, w.pos + 1) : tempo,
+                     w.token() == '/' ? 0 : events + (emits(w) ? 1 : 0));
+  }
+  constexpr int check(const char* s) { return check_walk(start(s), DEFAULT_TEMPO, 0); }
+
+  // Song bytes, built into a flash object through an index pack
+  template <unsigned N>
+  struct SongData {
+    uint8_t bytes[N];
+  };
+
+  template <unsigned... I> struct Indices {};
+  template <typename A, typename B> struct Concat;
+  template <unsigned... A, unsigned... B>
+  struct Concat<Indices<A...>, Indices<B...> > {
+    typedef Indices<A..., (sizeof...(A) + B)...> type;
+  };
+  // Logarithmic depth, so long songs stay within the template depth limit
+  template <unsigned N>
+  struct MakeIndices {
+    typedef typename Concat<typename MakeIndices<N / 2>::type,
+                            typename MakeIndices<N - N / 2>::type>::type type;
+  };
+  template <> struct MakeIndices<0> { typedef Indices<> type; };
+  template <> struct MakeIndices<1> { typedef Indices<0> type; };
+
+  template <typename Score, unsigned... I>
+  constexpr SongData<sizeof...(I)> build(Indices<I...>) {
+    return SongData<sizeof...(I)>{{song_byte(Score::text(), I)...}};
+  }
+}
+
+// The checker against one score per outcome
+static_assert(song_dsl::check("t120 l4 v1 C4/8. | -/4") == SONG_DSL_OK, "valid score");
+static_assert(song_dsl::check("C4/4 x") == SONG_DSL_ERR_SYNTAX, "unknown token");
+static_assert(song_dsl::check("C/4") == SONG_DSL_ERR_SYNTAX, "note without an octave");
+static_assert(song_dsl::check("G#0/4") == SONG_DSL_ERR_NOTE, "note below SONG_DSL_MIN_NOTE");
+static_assert(song_dsl::check("A0/4") == SONG_DSL_OK, "SONG_DSL_MIN_NOTE");
+static_assert(song_dsl::check("v8 C4/4") == SONG_DSL_ERR_VOICE, "voice MAX_SONG_VOICES");
+static_assert(song_dsl::check("l15 C4/4") == SONG_DSL_ERR_VOLUME, "loudness VOLUME_EXTENDED");
+static_assert(song_dsl::check("l0 C4/4") == SONG_DSL_ERR_VOLUME, "loudness 0");
+static_assert(song_dsl::check("t0 C4/4") == SONG_DSL_ERR_TEMPO, "tempo 0");
+static_assert(song_dsl::check("C4/5") == SONG_DSL_ERR_DURATION, "1/5 of a whole note");
+static_assert(song_dsl::check("C4/128.") == SONG_DSL_ERR_DURATION, "4.5 ticks");
+static_assert(song_dsl::check("t960 v0 C4 v1 E4/384") == SONG_DSL_ERR_RATE, "3 events in 651 us");
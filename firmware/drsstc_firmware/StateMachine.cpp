@@ -3,6 +3,10 @@
 #include "pin_definitions.h"
 #include "LEDRing.h"
 #include "MIDIPlayer.h"
+#include "Timebase.h"
+#include "EventQueue.h"
+#include "FaultLog.h"
+#include "ThermalModel.h"
 
 #define MAX_TEST_MODE_INDEX 10
 namespace {
@@ -17,21 +21,32 @@ namespace {
   unsigned long test_mode_pulse_start = 0;
   bool test_mode_pulse = false;
   int test_mode_index = 0;
+  bool test_pattern = false;
+
+  void end_test_pattern() {
+    if (!test_pattern) return;
+    set_pwm_off();
+    test_pattern = false;
+  }
 }
 
 #ifdef SERIAL_LOGGING
 const String STATE_NAMES[] PROGMEM = {"STARTUP", "LIGHT_SHOW", "SLOW_PULSE", "MUSIC_PLAY", "MUSIC_PAUSE", "MUSIC_INT", "TEST_MODE", "TEST_MODE_INC", "SHUTDOWN"};
 #endif
 
+#ifdef SERIAL_LOGGING
+void log_state_change(int old_state, int new_state) {
+  Serial.print(STATE_NAMES[old_state]);
+  Serial.print(" > ");
+  Serial.println(STATE_NAMES[new_state]);
+}
+#endif
+
 void change_state(int new_state) {
-  last_state_change = millis();
-  #ifdef SERIAL_LOGGING
-    Serial.print(STATE_NAMES[current_state]);
-    Serial.print(" > ");
-    Serial.println(STATE_NAMES[new_state]);
-  #endif
+  last_state_change = timebase_ms();
+  // Logged and shown on the LEDs from the main loop
+  state_notifications.post(NOTIFY_STATE, (current_state << 8) | new_state);
   current_state = new_state;
-  led_on_state_change(new_state);
 }
 
 int get_current_state() {
@@ -45,7 +60,13 @@ int get_current_state() {
 #define SLOW_PULSE_TIMEOUT  (20 * MINUTE)
 #define MUSIC_TIMEOUT       (10 * MINUTE)
 #define MUSIC_PAUSE_TIMEOUT  (5 * MINUTE)
-#define MUSIC_INT_PERIOD     10000  // 10s between songs
+#ifdef THERMAL_MODEL
+  // The thermal model sets the rest of the gap and cuts songs instead of
+  // MUSIC_TIMEOUT (ThermalModel.h)
+  #define MUSIC_INT_PERIOD    3000  // 3s between songs at least
+#else
+  #define MUSIC_INT_PERIOD   10000  // 10s between songs
+#endif
 #define TEST_MODE_DEBOUNCE 250 // 0.25s delay for software debouncing
 
 void reset_state() {
@@ -96,20 +117,22 @@ void update_state_machine() {
             change_state(MUSIC_PLAY); 
             break;
         }
-      } else if (millis() - last_state_change > LIGHT_SHOW_TIMEOUT) {
+      } else if (timebase_ms() - last_state_change > LIGHT_SHOW_TIMEOUT) {
         #ifdef SERIAL_LOGGING
         Serial.println(F("Light show timeout"));
         #endif
+        fault_log_record(LOG_TIMEOUT, current_state);
         change_state(SHUTDOWN);
       }
       break;
     case SLOW_PULSE:
       if (digitalRead(MSTR_EN) == LOW) {
         change_state(LIGHT_SHOW);
-      } else if (millis() - last_state_change > SLOW_PULSE_TIMEOUT) {
+      } else if (timebase_ms() - last_state_change > SLOW_PULSE_TIMEOUT) {
         #ifdef SERIAL_LOGGING
         Serial.println(F("Pulse mode timeout"));
         #endif
+        fault_log_record(LOG_TIMEOUT, current_state);
         change_state(SHUTDOWN);
       }
       break;
@@ -120,12 +143,25 @@ void update_state_machine() {
         #endif
         pause_midi();
         change_state(MUSIC_PAUSE);
-      } else if (millis() - last_state_change > MUSIC_TIMEOUT) {
+      }
+      #ifdef THERMAL_MODEL
+      else if (thermal_overheated()) {
+        #ifdef SERIAL_LOGGING
+        Serial.println(F("Bridge at thermal limit, cutting song"));
+        #endif
+        fault_log_record(LOG_THERMAL, get_song_index());
+        set_pwm_off();
+        change_state(MUSIC_INT);
+      }
+      #else
+      else if (timebase_ms() - last_state_change > MUSIC_TIMEOUT) {
         #ifdef SERIAL_LOGGING
         Serial.println(F("Music mode timeout"));
         #endif
+        fault_log_record(LOG_TIMEOUT, current_state);
         change_state(SHUTDOWN);
       }
+      #endif
       break;
     case MUSIC_PAUSE:
       if (digitalRead(MODE_IN) == LOW) {
@@ -136,15 +172,16 @@ void update_state_machine() {
         Serial.println(F("Resuming music"));
         #endif
         change_state(MUSIC_PLAY);
-      } else if (millis() - last_state_change > MUSIC_PAUSE_TIMEOUT) {
+      } else if (timebase_ms() - last_state_change > MUSIC_PAUSE_TIMEOUT) {
         #ifdef SERIAL_LOGGING
         Serial.println(F("Music pause timeout"));
         #endif
+        fault_log_record(LOG_TIMEOUT, current_state);
         change_state(LIGHT_SHOW);
       }
       break;
     case MUSIC_INT:
-      if (millis() - last_state_change > MUSIC_INT_PERIOD) {
+      if (timebase_ms() - last_state_change > MUSIC_INT_PERIOD && thermal_cooled()) {
         load_next_song();
         switch (digitalRead(MSTR_EN)) {
           case LOW: 
@@ -156,7 +193,8 @@ void update_state_machine() {
       break;
     case TEST_MODE:
       if (digitalRead(TEST_IN) == LOW 
-          && millis() - last_state_change > TEST_MODE_DEBOUNCE) {
+          && timebase_ms() - last_state_change > TEST_MODE_DEBOUNCE) {
+        end_test_pattern();
         if (digitalRead(MSTR_EN) == HIGH) {
           change_state(TEST_MODE_INC);
         } else {
@@ -168,7 +206,7 @@ void update_state_machine() {
       if (digitalRead(MSTR_EN) == LOW) {
         reset_state();
       } else if (digitalRead(TEST_IN) == HIGH
-                 && millis() - last_state_change > TEST_MODE_DEBOUNCE) {
+                 && timebase_ms() - last_state_change > TEST_MODE_DEBOUNCE) {
         test_mode_index++;
         if (test_mode_index > MAX_TEST_MODE_INDEX)
           test_mode_index = MAX_TEST_MODE_INDEX;
@@ -181,8 +219,8 @@ void update_state_machine() {
 
 #define FLASH_DELAY 250
 void flash_status() {
-  unsigned long timestamp = millis();
-  bool flash_change = (last_flash_ms == 0 || timestamp >= last_flash_ms + FLASH_DELAY);
+  unsigned long timestamp = timebase_ms();
+  bool flash_change = (last_flash_ms == 0 || timestamp - last_flash_ms >= FLASH_DELAY);
   if (flash_change) last_flash_ms = timestamp;
   switch (current_state) {
     case STARTUP:
@@ -232,10 +270,10 @@ void flash_status() {
 void slow_pulse() {
   //led_ring.reset();
   set_pwm_off();
-  unsigned long timestamp = millis();
-  if (last_slow_pulse == 0 || timestamp < last_slow_pulse) 
+  unsigned long timestamp = timebase_ms();
+  if (last_slow_pulse == 0) 
     last_slow_pulse = timestamp;
-  if (timestamp >= last_slow_pulse + SLOW_PULSE_DELAY) {
+  if (timestamp - last_slow_pulse >= SLOW_PULSE_DELAY) {
     send_single_pulse(SLOW_PULSE_LENGTH);
     last_slow_pulse = timestamp;
   }
@@ -246,29 +284,42 @@ void slow_pulse() {
 #define TEST_MODE_PULSE_SPACING  2000 // milliseconds
 #define TEST_MODE_PULSE_DELAY     500 // milliseconds
 
+void test_mode_play(const byte* song) {
+  if (current_state != TEST_MODE || digitalRead(MSTR_EN) == LOW) return;
+  #ifdef SERIAL_LOGGING
+  Serial.println(F("Playing test pattern"));
+  #endif
+  start_midi(song);
+  test_pattern = true;
+}
+
 void test_mode() {
   // Red bar graph indicating the test mode index
   //led_ring.bar_graph(test_mode_index + 1, 255, 0, 0);
+  if (test_pattern) {
+    if (digitalRead(MSTR_EN) == HIGH && play_midi()) return;
+    test_pattern = false;
+  }
   set_pwm_off();
   
   if (test_mode_pulse) {
     // Force an interval between pulses
-    if (test_mode_pulse_start + TEST_MODE_PULSE_SPACING < millis()
+    if (timebase_ms() - test_mode_pulse_start > TEST_MODE_PULSE_SPACING
         && digitalRead(TRIG_IN) == LOW) {
       test_mode_pulse = false;
       test_mode_pulse_start = 0;
     }
   } else {
     if (digitalRead(MSTR_EN) == HIGH && digitalRead(TRIG_IN) == HIGH) {
-      delay(TEST_MODE_DEBOUNCE);
+      timebase_delay_ms(TEST_MODE_DEBOUNCE);
       if (digitalRead(MSTR_EN) == HIGH && digitalRead(TRIG_IN) == HIGH) {
-        delay(TEST_MODE_PULSE_DELAY - TEST_MODE_DEBOUNCE);
+        timebase_delay_ms(TEST_MODE_PULSE_DELAY - TEST_MODE_DEBOUNCE);
         if (digitalRead(MSTR_EN) == HIGH) {
           const unsigned long pulse_length = TEST_MODE_START_PULSE 
               + test_mode_index * TEST_MODE_PULSE_PER_STEP;
           send_single_pulse(pulse_length);        
           test_mode_pulse = true;
-          test_mode_pulse_start = millis();
+          test_mode_pulse_start = timebase_ms();
           #ifdef SERIAL_LOGGING
           Serial.print(F("Sent test pulse of "));
           Serial.print(pulse_length);
@@ -1,4 +1,7 @@
 #pragma once
+
+#include <arduino.h>
+
 #define SERIAL_LOGGING
 
 // State machine
@@ -14,8 +17,14 @@
 
 int get_current_state();
 void change_state(int new_state);
+#ifdef SERIAL_LOGGING
+void log_state_change(int old_state, int new_state);
+#endif
 void update_state_machine();
 void flash_status();
 
 void slow_pulse();
 void test_mode();
+// Serial command: plays a test pattern in TEST_MODE while the run switch
+// stays on
+void test_mode_play(const byte* song);
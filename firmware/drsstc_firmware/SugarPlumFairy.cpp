@@ -1,812 +1,93 @@
 #include "MIDIPlayer.h"
 
-// converted from tchaikovksy_sugar_plum.mid - 2324 bytes total
+// converted from tchaikovksy_sugar_plum.mid - 1376 bytes total (1694 bytes before Huffman coding)
 extern const byte SUGAR_PLUM_FAIRY[] PROGMEM = 
 {
-      0x02,0x80,0x1e,0x42,0xa0, //      0 BEGIN PROGRAM (256 ticks/beat, tempo = 500000 us/beat)
-                0x80,0xb2,0x04, //      0 T1 ON, NOTE  50 VOLUME  4
-                     0xff,0x01, //    127 BOTH OFF
-           0x01,0x81,0xbe,0x04, //    129 T1 ON, NOTE  62 VOLUME  4
-                0x80,0x39,0x04, //      0 T2 ON, NOTE  57 VOLUME  4
-                     0xff,0x01, //    127 BOTH OFF
-           0x01,0x81,0xb2,0x04, //    129 T1 ON, NOTE  50 VOLUME  4
-                     0xff,0x01, //    127 BOTH OFF
-           0x01,0x81,0xc0,0x04, //    129 T1 ON, NOTE  64 VOLUME  4
-                0x80,0x3a,0x04, //      0 T2 ON, NOTE  58 VOLUME  4
-                     0xff,0x01, //    127 BOTH OFF
-           0x01,0x81,0xb2,0x04, //    129 T1 ON, NOTE  50 VOLUME  4
-                     0xff,0x01, //    127 BOTH OFF
-           0x01,0x81,0xc1,0x04, //    129 T1 ON, NOTE  65 VOLUME  4
-                0x80,0x3b,0x04, //      0 T2 ON, NOTE  59 VOLUME  4
-                     0xff,0x01, //    127 BOTH OFF
-           0x01,0x81,0xb2,0x04, //    129 T1 ON, NOTE  50 VOLUME  4
-                     0xff,0x01, //    127 BOTH OFF
-           0x01,0x81,0xbd,0x04, //    129 T1 ON, NOTE  61 VOLUME  4
-                0x80,0x3a,0x04, //      0 T2 ON, NOTE  58 VOLUME  4
-                     0xff,0x01, //    127 BOTH OFF
-           0x01,0x81,0xb2,0x04, //    129 T1 ON, NOTE  50 VOLUME  4
-                     0xff,0x01, //    127 BOTH OFF
-           0x01,0x81,0xbe,0x04, //    129 T1 ON, NOTE  62 VOLUME  4
-                0x80,0x39,0x04, //      0 T2 ON, NOTE  57 VOLUME  4
-                     0xff,0x01, //    127 BOTH OFF
-           0x01,0x81,0xb2,0x04, //    129 T1 ON, NOTE  50 VOLUME  4
-                     0xff,0x01, //    127 BOTH OFF
-           0x01,0x81,0xc0,0x04, //    129 T1 ON, NOTE  64 VOLUME  4
-                0x80,0x3a,0x04, //      0 T2 ON, NOTE  58 VOLUME  4
-                     0xff,0x01, //    127 BOTH OFF
-           0x01,0x81,0xb2,0x04, //    129 T1 ON, NOTE  50 VOLUME  4
-                     0xff,0x01, //    127 BOTH OFF
-           0x01,0x81,0xc1,0x04, //    129 T1 ON, NOTE  65 VOLUME  4
-                0x80,0x3b,0x04, //      0 T2 ON, NOTE  59 VOLUME  4
-                     0xff,0x01, //    127 BOTH OFF
-           0x01,0x81,0xb2,0x04, //    129 T1 ON, NOTE  50 VOLUME  4
-                     0xff,0x01, //    127 BOTH OFF
-           0x01,0x81,0xbd,0x04, //    129 T1 ON, NOTE  61 VOLUME  4
-                0x80,0x3a,0x04, //      0 T2 ON, NOTE  58 VOLUME  4
-                     0xff,0x01, //    127 BOTH OFF
-           0x01,0x81,0xb2,0x04, //    129 T1 ON, NOTE  50 VOLUME  4
-                     0xff,0x01, //    127 BOTH OFF
-           0x01,0x81,0xd9,0x04, //    129 T1 ON, NOTE  89 VOLUME  4
-                0x80,0x51,0x04, //      0 T2 ON, NOTE  81 VOLUME  4
-                0xbf,0xb9,0x05, //     63 T1 ON, NOTE  57 VOLUME  5
-                0x80,0x35,0x05, //      0 T2 ON, NOTE  53 VOLUME  5
-                     0xc0,0x01, //     64 BOTH OFF
-                0x81,0xd6,0x04, //      1 T1 ON, NOTE  86 VOLUME  4
-                     0xbf,0x01, //     63 BOTH OFF
-                0xc1,0xd9,0x05, //     65 T1 ON, NOTE  89 VOLUME  5
-                0x80,0x51,0x05, //      0 T2 ON, NOTE  81 VOLUME  5
-                     0xff,0x01, //    127 BOTH OFF
-           0x01,0x81,0xd8,0x05, //    129 T1 ON, NOTE  88 VOLUME  5
-                0x80,0x4f,0x05, //      0 T2 ON, NOTE  79 VOLUME  5
-                     0xff,0x01, //    127 BOTH OFF
-           0x01,0x81,0xd5,0x04, //    129 T1 ON, NOTE  85 VOLUME  4
-                0x80,0x4c,0x04, //      0 T2 ON, NOTE  76 VOLUME  4
-                     0xff,0x01, //    127 BOTH OFF
-           0x01,0x81,0xd6,0x05, //    129 T1 ON, NOTE  86 VOLUME  5
-                0x80,0x4d,0x05, //      0 T2 ON, NOTE  77 VOLUME  5
-                     0xff,0x01, //    127 BOTH OFF
-           0x01,0x81,0xd4,0x04, //    129 T1 ON, NOTE  84 VOLUME  4
-                0x80,0x4e,0x04, //      0 T2 ON, NOTE  78 VOLUME  4
-                0xbf,0xb2,0x04, //     63 T1 ON, NOTE  50 VOLUME  4
-                     0x80,0x00, //      0 T2 OFF
-                     0xc0,0x01, //     64 BOTH OFF
-                0x81,0xd4,0x04, //      1 T1 ON, NOTE  84 VOLUME  4
-                0x80,0x4e,0x04, //      0 T2 ON, NOTE  78 VOLUME  4
-                     0xbf,0x01, //     63 BOTH OFF
-                0xc1,0xd4,0x04, //     65 T1 ON, NOTE  84 VOLUME  4
-                0x80,0x4e,0x04, //      0 T2 ON, NOTE  78 VOLUME  4
-                     0xff,0x01, //    127 BOTH OFF
-           0x01,0x81,0xd3,0x04, //    129 T1 ON, NOTE  83 VOLUME  4
-                0x80,0x4d,0x04, //      0 T2 ON, NOTE  77 VOLUME  4
-                0xbf,0xb2,0x04, //     63 T1 ON, NOTE  50 VOLUME  4
-                     0x80,0x00, //      0 T2 OFF
-                     0xc0,0x01, //     64 BOTH OFF
-                0x81,0xd3,0x04, //      1 T1 ON, NOTE  83 VOLUME  4
-                0x80,0x4d,0x04, //      0 T2 ON, NOTE  77 VOLUME  4
-                     0xbf,0x01, //     63 BOTH OFF
-                0xc1,0xd3,0x05, //     65 T1 ON, NOTE  83 VOLUME  5
-                0x80,0x4d,0x05, //      0 T2 ON, NOTE  77 VOLUME  5
-                     0xff,0x01, //    127 BOTH OFF
-           0x01,0x81,0xd2,0x04, //    129 T1 ON, NOTE  82 VOLUME  4
-                0x80,0x4c,0x04, //      0 T2 ON, NOTE  76 VOLUME  4
-                0xbf,0xb2,0x04, //     63 T1 ON, NOTE  50 VOLUME  4
-                     0x80,0x00, //      0 T2 OFF
-                     0xc0,0x01, //     64 BOTH OFF
-                0x81,0xd2,0x04, //      1 T1 ON, NOTE  82 VOLUME  4
-                0x80,0x4c,0x04, //      0 T2 ON, NOTE  76 VOLUME  4
-                     0xbf,0x01, //     63 BOTH OFF
-                0xc1,0xd2,0x05, //     65 T1 ON, NOTE  82 VOLUME  5
-                0x80,0x4c,0x05, //      0 T2 ON, NOTE  76 VOLUME  5
-                     0xff,0x01, //    127 BOTH OFF
-           0x01,0x81,0xd1,0x04, //    129 T1 ON, NOTE  81 VOLUME  4
-                0x80,0x4d,0x04, //      0 T2 ON, NOTE  77 VOLUME  4
-                0xbf,0xb2,0x04, //     63 T1 ON, NOTE  50 VOLUME  4
-                     0x80,0x00, //      0 T2 OFF
-                     0xc0,0x01, //     64 BOTH OFF
-                0x81,0xd6,0x05, //      1 T1 ON, NOTE  86 VOLUME  5
-                     0xbf,0x01, //     63 BOTH OFF
-                0xc1,0xd2,0x04, //     65 T1 ON, NOTE  82 VOLUME  4
-                0x80,0x4f,0x04, //      0 T2 ON, NOTE  79 VOLUME  4
-                0xbf,0xbe,0x06, //     63 T1 ON, NOTE  62 VOLUME  6
-                     0x80,0x00, //      0 T2 OFF
-                     0xc0,0x01, //     64 BOTH OFF
-                0x81,0xd6,0x05, //      1 T1 ON, NOTE  86 VOLUME  5
-                     0xbf,0x01, //     63 BOTH OFF
-                0xc1,0xd1,0x04, //     65 T1 ON, NOTE  81 VOLUME  4
-                0x80,0x4d,0x04, //      0 T2 ON, NOTE  77 VOLUME  4
-                     0xff,0x01, //    127 BOTH OFF
-           0x01,0x81,0xbe,0x04, //    129 T1 ON, NOTE  62 VOLUME  4
-                0xc0,0xbc,0x04, //     64 T1 ON, NOTE  60 VOLUME  4
-                0xc0,0xbb,0x04, //     64 T1 ON, NOTE  59 VOLUME  4
-                0xc0,0xb9,0x04, //     64 T1 ON, NOTE  57 VOLUME  4
-                0xc0,0xb8,0x04, //     64 T1 ON, NOTE  56 VOLUME  4
-                0x01,0xcd,0x01, //    205 BOTH OFF
-                0xb3,0xcd,0x04, //     51 T1 ON, NOTE  77 VOLUME  4
-                0x80,0x46,0x04, //      0 T2 ON, NOTE  70 VOLUME  4
-                0xbf,0xc1,0x05, //     63 T1 ON, NOTE  65 VOLUME  5
-                0x80,0x3e,0x05, //      0 T2 ON, NOTE  62 VOLUME  5
-                     0xc0,0x01, //     64 BOTH OFF
-                0x81,0xca,0x04, //      1 T1 ON, NOTE  74 VOLUME  4
-                     0xbf,0x01, //     63 BOTH OFF
-                0xc1,0xcd,0x04, //     65 T1 ON, NOTE  77 VOLUME  4
-                0x80,0x46,0x04, //      0 T2 ON, NOTE  70 VOLUME  4
-                     0xff,0x01, //    127 BOTH OFF
-           0x01,0x81,0xcc,0x04, //    129 T1 ON, NOTE  76 VOLUME  4
-                0x80,0x46,0x04, //      0 T2 ON, NOTE  70 VOLUME  4
-                     0xff,0x01, //    127 BOTH OFF
-           0x01,0x81,0xd2,0x05, //    129 T1 ON, NOTE  82 VOLUME  5
-                0x80,0x4c,0x05, //      0 T2 ON, NOTE  76 VOLUME  5
-                     0xff,0x01, //    127 BOTH OFF
-           0x01,0x81,0xd1,0x04, //    129 T1 ON, NOTE  81 VOLUME  4
-                0x80,0x4d,0x04, //      0 T2 ON, NOTE  77 VOLUME  4
-                     0xff,0x01, //    127 BOTH OFF
-           0x01,0x81,0xd9,0x04, //    129 T1 ON, NOTE  89 VOLUME  4
-                0x80,0x50,0x04, //      0 T2 ON, NOTE  80 VOLUME  4
-                0xbf,0xb4,0x04, //     63 T1 ON, NOTE  52 VOLUME  4
-                     0x80,0x00, //      0 T2 OFF
-                     0xc0,0x01, //     64 BOTH OFF
-                0x81,0xd9,0x04, //      1 T1 ON, NOTE  89 VOLUME  4
-                0x80,0x50,0x04, //      0 T2 ON, NOTE  80 VOLUME  4
-                     0xbf,0x01, //     63 BOTH OFF
-                0xc1,0xd9,0x04, //     65 T1 ON, NOTE  89 VOLUME  4
-                0x80,0x50,0x04, //      0 T2 ON, NOTE  80 VOLUME  4
-                     0xff,0x01, //    127 BOTH OFF
-           0x01,0x81,0xd8,0x04, //    129 T1 ON, NOTE  88 VOLUME  4
-                0x80,0x54,0x04, //      0 T2 ON, NOTE  84 VOLUME  4
-                0xbf,0xb4,0x04, //     63 T1 ON, NOTE  52 VOLUME  4
-                     0x80,0x00, //      0 T2 OFF
-                     0xc0,0x01, //     64 BOTH OFF
-                0x81,0xd8,0x04, //      1 T1 ON, NOTE  88 VOLUME  4
-                0x80,0x54,0x04, //      0 T2 ON, NOTE  84 VOLUME  4
-                     0xbf,0x01, //     63 BOTH OFF
-                0xc1,0xd8,0x05, //     65 T1 ON, NOTE  88 VOLUME  5
-                0x80,0x54,0x05, //      0 T2 ON, NOTE  84 VOLUME  5
-                     0xff,0x01, //    127 BOTH OFF
-           0x01,0x81,0xd6,0x04, //    129 T1 ON, NOTE  86 VOLUME  4
-                0x80,0x53,0x04, //      0 T2 ON, NOTE  83 VOLUME  4
-                0xbf,0xb4,0x04, //     63 T1 ON, NOTE  52 VOLUME  4
-                     0x80,0x00, //      0 T2 OFF
-                     0xc0,0x01, //     64 BOTH OFF
-                0x81,0xd6,0x05, //      1 T1 ON, NOTE  86 VOLUME  5
-                0x80,0x53,0x05, //      0 T2 ON, NOTE  83 VOLUME  5
-                     0xbf,0x01, //     63 BOTH OFF
-                0xc1,0xd6,0x04, //     65 T1 ON, NOTE  86 VOLUME  4
-                0x80,0x53,0x04, //      0 T2 ON, NOTE  83 VOLUME  4
-                     0xff,0x01, //    127 BOTH OFF
-           0x01,0x81,0xd5,0x05, //    129 T1 ON, NOTE  85 VOLUME  5
-                0x80,0x51,0x05, //      0 T2 ON, NOTE  81 VOLUME  5
-                0xbf,0xc0,0x05, //     63 T1 ON, NOTE  64 VOLUME  5
-                0x80,0x39,0x05, //      0 T2 ON, NOTE  57 VOLUME  5
-                     0xc0,0x01, //     64 BOTH OFF
-                0x81,0xd8,0x05, //      1 T1 ON, NOTE  88 VOLUME  5
-                     0xbf,0x01, //     63 BOTH OFF
-                0xc1,0xd6,0x04, //     65 T1 ON, NOTE  86 VOLUME  4
-                0x80,0x50,0x04, //      0 T2 ON, NOTE  80 VOLUME  4
-                0xbf,0xc0,0x04, //     63 T1 ON, NOTE  64 VOLUME  4
-                0x80,0x3a,0x04, //      0 T2 ON, NOTE  58 VOLUME  4
-                     0xc0,0x01, //     64 BOTH OFF
-                0x81,0xd8,0x05, //      1 T1 ON, NOTE  88 VOLUME  5
-                     0xbf,0x01, //     63 BOTH OFF
-                0xc1,0xd5,0x04, //     65 T1 ON, NOTE  85 VOLUME  4
-                0x80,0x51,0x04, //      0 T2 ON, NOTE  81 VOLUME  4
-                     0xff,0x01, //    127 BOTH OFF
-           0x01,0x81,0xb9,0x04, //    129 T1 ON, NOTE  57 VOLUME  4
-                0xc0,0xb7,0x04, //     64 T1 ON, NOTE  55 VOLUME  4
-                0xc0,0xb5,0x04, //     64 T1 ON, NOTE  53 VOLUME  4
-                0xc0,0xb4,0x04, //     64 T1 ON, NOTE  52 VOLUME  4
-                0xc0,0xb2,0x04, //     64 T1 ON, NOTE  50 VOLUME  4
-                     0xe5,0x01, //    101 BOTH OFF
-           0x01,0x9b,0xd9,0x04, //    155 T1 ON, NOTE  89 VOLUME  4
-                0x80,0x51,0x04, //      0 T2 ON, NOTE  81 VOLUME  4
-                0xbf,0xb9,0x05, //     63 T1 ON, NOTE  57 VOLUME  5
-                0x80,0x35,0x05, //      0 T2 ON, NOTE  53 VOLUME  5
-                     0xc0,0x01, //     64 BOTH OFF
-                0x81,0xd6,0x04, //      1 T1 ON, NOTE  86 VOLUME  4
-                     0xbf,0x01, //     63 BOTH OFF
-                0xc1,0xd9,0x05, //     65 T1 ON, NOTE  89 VOLUME  5
-                0x80,0x51,0x05, //      0 T2 ON, NOTE  81 VOLUME  5
-                     0xff,0x01, //    127 BOTH OFF
-           0x01,0x81,0xd8,0x04, //    129 T1 ON, NOTE  88 VOLUME  4
-                0x80,0x4f,0x04, //      0 T2 ON, NOTE  79 VOLUME  4
-                     0xff,0x01, //    127 BOTH OFF
-           0x01,0x81,0xd5,0x04, //    129 T1 ON, NOTE  85 VOLUME  4
-                0x80,0x4c,0x04, //      0 T2 ON, NOTE  76 VOLUME  4
-                     0xff,0x01, //    127 BOTH OFF
-           0x01,0x81,0xd6,0x05, //    129 T1 ON, NOTE  86 VOLUME  5
-                0x80,0x4d,0x05, //      0 T2 ON, NOTE  77 VOLUME  5
-                     0xff,0x01, //    127 BOTH OFF
-           0x01,0x81,0xd4,0x04, //    129 T1 ON, NOTE  84 VOLUME  4
-                0x80,0x4e,0x04, //      0 T2 ON, NOTE  78 VOLUME  4
-                0xbf,0xb2,0x04, //     63 T1 ON, NOTE  50 VOLUME  4
-                     0x80,0x00, //      0 T2 OFF
-                     0xc0,0x01, //     64 BOTH OFF
-                0x81,0xd4,0x05, //      1 T1 ON, NOTE  84 VOLUME  5
-                0x80,0x4e,0x05, //      0 T2 ON, NOTE  78 VOLUME  5
-                     0xbf,0x01, //     63 BOTH OFF
-                0xc1,0xd4,0x04, //     65 T1 ON, NOTE  84 VOLUME  4
-                0x80,0x4e,0x04, //      0 T2 ON, NOTE  78 VOLUME  4
-                     0xff,0x01, //    127 BOTH OFF
-           0x01,0x81,0xd3,0x05, //    129 T1 ON, NOTE  83 VOLUME  5
-                0x80,0x4d,0x05, //      0 T2 ON, NOTE  77 VOLUME  5
-                0xbf,0xb2,0x04, //     63 T1 ON, NOTE  50 VOLUME  4
-                     0x80,0x00, //      0 T2 OFF
-                     0xc0,0x01, //     64 BOTH OFF
-                0x81,0xd3,0x04, //      1 T1 ON, NOTE  83 VOLUME  4
-                0x80,0x4d,0x04, //      0 T2 ON, NOTE  77 VOLUME  4
-                     0xbf,0x01, //     63 BOTH OFF
-                0xc1,0xd3,0x05, //     65 T1 ON, NOTE  83 VOLUME  5
-                0x80,0x4d,0x05, //      0 T2 ON, NOTE  77 VOLUME  5
-                     0xff,0x01, //    127 BOTH OFF
-           0x01,0x81,0xd2,0x05, //    129 T1 ON, NOTE  82 VOLUME  5
-                0x80,0x4c,0x05, //      0 T2 ON, NOTE  76 VOLUME  5
-                0xbf,0xb2,0x04, //     63 T1 ON, NOTE  50 VOLUME  4
-                     0x80,0x00, //      0 T2 OFF
-                     0xc0,0x01, //     64 BOTH OFF
-                0x81,0xd2,0x04, //      1 T1 ON, NOTE  82 VOLUME  4
-                0x80,0x4c,0x04, //      0 T2 ON, NOTE  76 VOLUME  4
-                     0xbf,0x01, //     63 BOTH OFF
-                0xc1,0xd2,0x04, //     65 T1 ON, NOTE  82 VOLUME  4
-                0x80,0x4c,0x04, //      0 T2 ON, NOTE  76 VOLUME  4
-                     0xff,0x01, //    127 BOTH OFF
-           0x01,0x81,0xd1,0x04, //    129 T1 ON, NOTE  81 VOLUME  4
-                0x80,0x4d,0x04, //      0 T2 ON, NOTE  77 VOLUME  4
-                0xbf,0xb2,0x04, //     63 T1 ON, NOTE  50 VOLUME  4
-                     0x80,0x00, //      0 T2 OFF
-                     0xc0,0x01, //     64 BOTH OFF
-                0x81,0xd6,0x05, //      1 T1 ON, NOTE  86 VOLUME  5
-                     0xbf,0x01, //     63 BOTH OFF
-                0xc1,0xd2,0x04, //     65 T1 ON, NOTE  82 VOLUME  4
-                0x80,0x4f,0x04, //      0 T2 ON, NOTE  79 VOLUME  4
-                0xbf,0xc0,0x05, //     63 T1 ON, NOTE  64 VOLUME  5
-                0x80,0x3e,0x05, //      0 T2 ON, NOTE  62 VOLUME  5
-                     0xc0,0x01, //     64 BOTH OFF
-                0x81,0xd6,0x05, //      1 T1 ON, NOTE  86 VOLUME  5
-                     0xbf,0x01, //     63 BOTH OFF
-                0xc1,0xd1,0x04, //     65 T1 ON, NOTE  81 VOLUME  4
-                0x80,0x4d,0x04, //      0 T2 ON, NOTE  77 VOLUME  4
-                     0xff,0x01, //    127 BOTH OFF
-           0x01,0x81,0xc1,0x04, //    129 T1 ON, NOTE  65 VOLUME  4
-                0xc0,0xc0,0x05, //     64 T1 ON, NOTE  64 VOLUME  5
-                0xc0,0xbe,0x04, //     64 T1 ON, NOTE  62 VOLUME  4
-                0xc0,0xbc,0x04, //     64 T1 ON, NOTE  60 VOLUME  4
-                0xc0,0xbb,0x04, //     64 T1 ON, NOTE  59 VOLUME  4
-                0x01,0xcd,0x01, //    205 BOTH OFF
-                0xb3,0xca,0x04, //     51 T1 ON, NOTE  74 VOLUME  4
-                0x80,0x44,0x04, //      0 T2 ON, NOTE  68 VOLUME  4
-                0xbf,0xc0,0x07, //     63 T1 ON, NOTE  64 VOLUME  7
-                     0x80,0x00, //      0 T2 OFF
-                0xc1,0x47,0x04, //     65 T2 ON, NOTE  71 VOLUME  4
-                     0xbf,0x00, //     63 T2 OFF
-                0xc1,0xca,0x05, //     65 T1 ON, NOTE  74 VOLUME  5
-                0x80,0x44,0x05, //      0 T2 ON, NOTE  68 VOLUME  5
-                0xff,0xc0,0x07, //    127 T1 ON, NOTE  64 VOLUME  7
-                     0x80,0x00, //      0 T2 OFF
-           0x01,0x81,0xc9,0x04, //    129 T1 ON, NOTE  73 VOLUME  4
-                0x80,0x45,0x04, //      0 T2 ON, NOTE  69 VOLUME  4
-                0xff,0xb9,0x04, //    127 T1 ON, NOTE  57 VOLUME  4
-                     0x80,0x00, //      0 T2 OFF
-                     0xce,0x01, //     78 BOTH OFF
-                0xb3,0xb2,0x04, //     51 T1 ON, NOTE  50 VOLUME  4
-           0x02,0x80,0xc8,0x04, //    256 T1 ON, NOTE  72 VOLUME  4
-                0x80,0x42,0x04, //      0 T2 ON, NOTE  66 VOLUME  4
-                0xbf,0xbe,0x07, //     63 T1 ON, NOTE  62 VOLUME  7
-                     0x80,0x00, //      0 T2 OFF
-                0xc1,0x45,0x04, //     65 T2 ON, NOTE  69 VOLUME  4
-                     0xbf,0x00, //     63 T2 OFF
-                0xc1,0xc8,0x05, //     65 T1 ON, NOTE  72 VOLUME  5
-                0x80,0x42,0x05, //      0 T2 ON, NOTE  66 VOLUME  5
-                0xff,0xbe,0x07, //    127 T1 ON, NOTE  62 VOLUME  7
-                     0x80,0x00, //      0 T2 OFF
-           0x01,0x81,0xc7,0x04, //    129 T1 ON, NOTE  71 VOLUME  4
-                0x80,0x43,0x04, //      0 T2 ON, NOTE  67 VOLUME  4
-                0xff,0xb7,0x04, //    127 T1 ON, NOTE  55 VOLUME  4
-                     0x80,0x00, //      0 T2 OFF
-                     0xce,0x01, //     78 BOTH OFF
-                0xb3,0xb0,0x04, //     51 T1 ON, NOTE  48 VOLUME  4
-           0x02,0x80,0xc6,0x04, //    256 T1 ON, NOTE  70 VOLUME  4
-                0x80,0x40,0x04, //      0 T2 ON, NOTE  64 VOLUME  4
-                0xbf,0xbc,0x08, //     63 T1 ON, NOTE  60 VOLUME  8
-                     0x80,0x00, //      0 T2 OFF
-                0xc1,0x43,0x04, //     65 T2 ON, NOTE  67 VOLUME  4
-                     0xbf,0x00, //     63 T2 OFF
-                0xc1,0xc6,0x04, //     65 T1 ON, NOTE  70 VOLUME  4
-                0x80,0x40,0x04, //      0 T2 ON, NOTE  64 VOLUME  4
-                0xff,0xbc,0x08, //    127 T1 ON, NOTE  60 VOLUME  8
-                     0x80,0x00, //      0 T2 OFF
-           0x01,0x81,0xc5,0x04, //    129 T1 ON, NOTE  69 VOLUME  4
-                0x80,0x41,0x04, //      0 T2 ON, NOTE  65 VOLUME  4
-                0xff,0xb5,0x04, //    127 T1 ON, NOTE  53 VOLUME  4
-                     0x80,0x00, //      0 T2 OFF
-                     0xce,0x01, //     78 BOTH OFF
-                0xb3,0xb9,0x05, //     51 T1 ON, NOTE  57 VOLUME  5
-                     0xff,0x01, //    127 BOTH OFF
-           0x01,0x81,0xc5,0x04, //    129 T1 ON, NOTE  69 VOLUME  4
-                0x80,0x37,0x04, //      0 T2 ON, NOTE  55 VOLUME  4
-                0xa8,0x49,0x04, //     40 T2 ON, NOTE  73 VOLUME  4
-                0xa8,0xd1,0x04, //     40 T1 ON, NOTE  81 VOLUME  4
-           0x01,0x81,0xca,0x04, //    129 T1 ON, NOTE  74 VOLUME  4
-                0x80,0x35,0x05, //      0 T2 ON, NOTE  53 VOLUME  5
-                     0xff,0x00, //    127 T2 OFF
-           0x01,0x81,0xad,0x07, //    129 T1 ON, NOTE  45 VOLUME  7
-           0x02,0x80,0xb5,0x06, //    256 T1 ON, NOTE  53 VOLUME  6
-                0x80,0x32,0x06, //      0 T2 ON, NOTE  50 VOLUME  6
-           0x01,0x80,0x3b,0x04, //    128 T2 ON, NOTE  59 VOLUME  4
-                0xbf,0x32,0x06, //     63 T2 ON, NOTE  50 VOLUME  6
-                0xc1,0xb7,0x04, //     65 T1 ON, NOTE  55 VOLUME  4
-                0x80,0x34,0x04, //      0 T2 ON, NOTE  52 VOLUME  4
-           0x01,0x80,0x3d,0x05, //    128 T2 ON, NOTE  61 VOLUME  5
-                0xbf,0x34,0x04, //     63 T2 ON, NOTE  52 VOLUME  4
-                0xc1,0xb5,0x05, //     65 T1 ON, NOTE  53 VOLUME  5
-                0x80,0x2d,0x07, //      0 T2 ON, NOTE  45 VOLUME  7
-           0x01,0x80,0xbe,0x05, //    128 T1 ON, NOTE  62 VOLUME  5
-                0x80,0x39,0x05, //      0 T2 ON, NOTE  57 VOLUME  5
-                0xbf,0xb5,0x05, //     63 T1 ON, NOTE  53 VOLUME  5
-                0x80,0x2d,0x07, //      0 T2 ON, NOTE  45 VOLUME  7
-                0xc1,0xb7,0x06, //     65 T1 ON, NOTE  55 VOLUME  6
-           0x01,0x80,0xc0,0x06, //    128 T1 ON, NOTE  64 VOLUME  6
-                0x80,0x39,0x06, //      0 T2 ON, NOTE  57 VOLUME  6
-                0xbf,0xb7,0x06, //     63 T1 ON, NOTE  55 VOLUME  6
-                0x80,0x2d,0x07, //      0 T2 ON, NOTE  45 VOLUME  7
-                0xc1,0xb9,0x07, //     65 T1 ON, NOTE  57 VOLUME  7
-           0x01,0x80,0xc1,0x06, //    128 T1 ON, NOTE  65 VOLUME  6
-                0x80,0x3e,0x06, //      0 T2 ON, NOTE  62 VOLUME  6
-                0xbf,0xb9,0x07, //     63 T1 ON, NOTE  57 VOLUME  7
-                0x80,0x2d,0x07, //      0 T2 ON, NOTE  45 VOLUME  7
-                0xc1,0xb5,0x06, //     65 T1 ON, NOTE  53 VOLUME  6
-           0x01,0x80,0xbe,0x06, //    128 T1 ON, NOTE  62 VOLUME  6
-                0x80,0x3b,0x06, //      0 T2 ON, NOTE  59 VOLUME  6
-           0x01,0x80,0xbd,0x05, //    128 T1 ON, NOTE  61 VOLUME  5
-                0x80,0x39,0x05, //      0 T2 ON, NOTE  57 VOLUME  5
-           0x01,0xcd,0xb4,0x05, //    205 T1 ON, NOTE  52 VOLUME  5
-                0x80,0x2d,0x07, //      0 T2 ON, NOTE  45 VOLUME  7
-                0xb3,0xb9,0x07, //     51 T1 ON, NOTE  57 VOLUME  7
-                0x80,0x31,0x07, //      0 T2 ON, NOTE  49 VOLUME  7
-                0xd5,0xba,0x07, //     85 T1 ON, NOTE  58 VOLUME  7
-                0xd5,0xb9,0x07, //     85 T1 ON, NOTE  57 VOLUME  7
-                0xc4,0xad,0x07, //     68 T1 ON, NOTE  45 VOLUME  7
-                0x92,0xb7,0x07, //     18 T1 ON, NOTE  55 VOLUME  7
-                0x80,0x32,0x07, //      0 T2 ON, NOTE  50 VOLUME  7
-           0x01,0x80,0xb5,0x07, //    128 T1 ON, NOTE  53 VOLUME  7
-                     0xb2,0x80, //     50 T1 OFF
-                0xce,0xb5,0x07, //     78 T1 ON, NOTE  53 VOLUME  7
-                     0xbf,0x80, //     63 T1 OFF
-                0xc1,0xb5,0x07, //     65 T1 ON, NOTE  53 VOLUME  7
-                     0xbf,0x80, //     63 T1 OFF
-                0xc1,0xb5,0x07, //     65 T1 ON, NOTE  53 VOLUME  7
-                     0xbf,0x80, //     63 T1 OFF
-                0xc1,0xb5,0x07, //     65 T1 ON, NOTE  53 VOLUME  7
-                     0xbf,0x80, //     63 T1 OFF
-                     0x8e,0x01, //     14 BOTH OFF
-                0xb3,0xb5,0x07, //     51 T1 ON, NOTE  53 VOLUME  7
-                0x80,0x2f,0x07, //      0 T2 ON, NOTE  47 VOLUME  7
-                0xd5,0xb9,0x07, //     85 T1 ON, NOTE  57 VOLUME  7
-                0xd5,0xb7,0x07, //     85 T1 ON, NOTE  55 VOLUME  7
-                0xc4,0xab,0x07, //     68 T1 ON, NOTE  43 VOLUME  7
-                0x92,0xb5,0x07, //     18 T1 ON, NOTE  53 VOLUME  7
-                0x80,0x30,0x08, //      0 T2 ON, NOTE  48 VOLUME  8
-           0x01,0x80,0xb4,0x07, //    128 T1 ON, NOTE  52 VOLUME  7
-                     0xb2,0x80, //     50 T1 OFF
-                0xce,0xb4,0x07, //     78 T1 ON, NOTE  52 VOLUME  7
-                     0xbf,0x80, //     63 T1 OFF
-                0xc1,0xb4,0x07, //     65 T1 ON, NOTE  52 VOLUME  7
-                     0xbf,0x80, //     63 T1 OFF
-                0xc1,0xb4,0x07, //     65 T1 ON, NOTE  52 VOLUME  7
-                     0xbf,0x80, //     63 T1 OFF
-                0xc1,0xb4,0x07, //     65 T1 ON, NOTE  52 VOLUME  7
-                     0xbf,0x80, //     63 T1 OFF
-                     0x8e,0x01, //     14 BOTH OFF
-                0xb3,0xad,0x08, //     51 T1 ON, NOTE  45 VOLUME  8
-           0x02,0x80,0xb5,0x05, //    256 T1 ON, NOTE  53 VOLUME  5
-                0x80,0x32,0x05, //      0 T2 ON, NOTE  50 VOLUME  5
-           0x01,0x80,0x3b,0x04, //    128 T2 ON, NOTE  59 VOLUME  4
-                0xbf,0x32,0x05, //     63 T2 ON, NOTE  50 VOLUME  5
-                0xc1,0xb7,0x04, //     65 T1 ON, NOTE  55 VOLUME  4
-                0x80,0x34,0x04, //      0 T2 ON, NOTE  52 VOLUME  4
-           0x01,0x80,0x3d,0x05, //    128 T2 ON, NOTE  61 VOLUME  5
-                0xbf,0x34,0x04, //     63 T2 ON, NOTE  52 VOLUME  4
-                0xc1,0xb5,0x05, //     65 T1 ON, NOTE  53 VOLUME  5
-                0x80,0x2d,0x08, //      0 T2 ON, NOTE  45 VOLUME  8
-           0x01,0x80,0xbe,0x05, //    128 T1 ON, NOTE  62 VOLUME  5
-                0x80,0x39,0x05, //      0 T2 ON, NOTE  57 VOLUME  5
-                0xbf,0xb5,0x05, //     63 T1 ON, NOTE  53 VOLUME  5
-                0x80,0x2d,0x08, //      0 T2 ON, NOTE  45 VOLUME  8
-                0xc1,0xb7,0x06, //     65 T1 ON, NOTE  55 VOLUME  6
-           0x01,0x80,0xc0,0x06, //    128 T1 ON, NOTE  64 VOLUME  6
-                0x80,0x39,0x06, //      0 T2 ON, NOTE  57 VOLUME  6
-                0xbf,0xb7,0x06, //     63 T1 ON, NOTE  55 VOLUME  6
-                0x80,0x2d,0x08, //      0 T2 ON, NOTE  45 VOLUME  8
-                0xc1,0xb9,0x07, //     65 T1 ON, NOTE  57 VOLUME  7
-           0x01,0x80,0xc1,0x06, //    128 T1 ON, NOTE  65 VOLUME  6
-                0x80,0x3e,0x06, //      0 T2 ON, NOTE  62 VOLUME  6
-                0xbf,0xb9,0x07, //     63 T1 ON, NOTE  57 VOLUME  7
-                0x80,0x2d,0x08, //      0 T2 ON, NOTE  45 VOLUME  8
-                0xc1,0xb5,0x06, //     65 T1 ON, NOTE  53 VOLUME  6
-           0x01,0x80,0xbe,0x06, //    128 T1 ON, NOTE  62 VOLUME  6
-                0x80,0x3b,0x06, //      0 T2 ON, NOTE  59 VOLUME  6
-           0x01,0x80,0xbd,0x05, //    128 T1 ON, NOTE  61 VOLUME  5
-                0x80,0x39,0x05, //      0 T2 ON, NOTE  57 VOLUME  5
-           0x01,0xcd,0xb4,0x05, //    205 T1 ON, NOTE  52 VOLUME  5
-                0x80,0x2d,0x08, //      0 T2 ON, NOTE  45 VOLUME  8
-                0xb3,0xb9,0x07, //     51 T1 ON, NOTE  57 VOLUME  7
-                0x80,0x31,0x07, //      0 T2 ON, NOTE  49 VOLUME  7
-                0xd5,0xba,0x07, //     85 T1 ON, NOTE  58 VOLUME  7
-                0xd5,0xb9,0x07, //     85 T1 ON, NOTE  57 VOLUME  7
-                0xc4,0xad,0x07, //     68 T1 ON, NOTE  45 VOLUME  7
-                0x92,0xb7,0x07, //     18 T1 ON, NOTE  55 VOLUME  7
-                0x80,0x32,0x07, //      0 T2 ON, NOTE  50 VOLUME  7
-           0x01,0x80,0xb5,0x07, //    128 T1 ON, NOTE  53 VOLUME  7
-                     0xb2,0x80, //     50 T1 OFF
-                0xce,0xb5,0x07, //     78 T1 ON, NOTE  53 VOLUME  7
-                     0xbf,0x80, //     63 T1 OFF
-                0xc1,0xb5,0x07, //     65 T1 ON, NOTE  53 VOLUME  7
-                     0xbf,0x80, //     63 T1 OFF
-                0xc1,0xb5,0x07, //     65 T1 ON, NOTE  53 VOLUME  7
-                     0xbf,0x80, //     63 T1 OFF
-                0xc1,0xb5,0x07, //     65 T1 ON, NOTE  53 VOLUME  7
-                     0xbf,0x80, //     63 T1 OFF
-                     0x8e,0x01, //     14 BOTH OFF
-                0xb3,0xb5,0x07, //     51 T1 ON, NOTE  53 VOLUME  7
-                0x80,0x2f,0x07, //      0 T2 ON, NOTE  47 VOLUME  7
-                0xd5,0xb9,0x07, //     85 T1 ON, NOTE  57 VOLUME  7
-                0xd5,0xb7,0x07, //     85 T1 ON, NOTE  55 VOLUME  7
-                0xc4,0xab,0x07, //     68 T1 ON, NOTE  43 VOLUME  7
-                0x92,0xb5,0x07, //     18 T1 ON, NOTE  53 VOLUME  7
-                0x80,0x30,0x07, //      0 T2 ON, NOTE  48 VOLUME  7
-           0x01,0x80,0xb4,0x07, //    128 T1 ON, NOTE  52 VOLUME  7
-                     0xb2,0x80, //     50 T1 OFF
-                0xce,0xb4,0x07, //     78 T1 ON, NOTE  52 VOLUME  7
-                     0xbf,0x80, //     63 T1 OFF
-                0xc1,0xb4,0x07, //     65 T1 ON, NOTE  52 VOLUME  7
-                     0xbf,0x80, //     63 T1 OFF
-                0xc1,0xb4,0x07, //     65 T1 ON, NOTE  52 VOLUME  7
-                     0xbf,0x80, //     63 T1 OFF
-                0xc1,0xb4,0x07, //     65 T1 ON, NOTE  52 VOLUME  7
-                     0xbf,0x80, //     63 T1 OFF
-                     0x8e,0x01, //     14 BOTH OFF
-                0xb3,0xad,0x06, //     51 T1 ON, NOTE  45 VOLUME  6
-           0x02,0x80,0x32,0x06, //    256 T2 ON, NOTE  50 VOLUME  6
-           0x01,0x80,0xc7,0x07, //    128 T1 ON, NOTE  71 VOLUME  7
-                0x80,0x41,0x07, //      0 T2 ON, NOTE  65 VOLUME  7
-           0x01,0x80,0xb4,0x07, //    128 T1 ON, NOTE  52 VOLUME  7
-                0x80,0x2d,0x06, //      0 T2 ON, NOTE  45 VOLUME  6
-           0x01,0x80,0xc9,0x06, //    128 T1 ON, NOTE  73 VOLUME  6
-                0x80,0x43,0x06, //      0 T2 ON, NOTE  67 VOLUME  6
-           0x01,0x80,0xb5,0x07, //    128 T1 ON, NOTE  53 VOLUME  7
-                0x80,0x2d,0x06, //      0 T2 ON, NOTE  45 VOLUME  6
-           0x01,0x80,0xca,0x07, //    128 T1 ON, NOTE  74 VOLUME  7
-                0x80,0x45,0x07, //      0 T2 ON, NOTE  69 VOLUME  7
-                0xb3,0xc5,0x08, //     51 T1 ON, NOTE  69 VOLUME  8
-                0x80,0x35,0x07, //      0 T2 ON, NOTE  53 VOLUME  7
-           0x01,0xcd,0x2d,0x06, //    205 T2 ON, NOTE  45 VOLUME  6
-                0xb3,0xb4,0x07, //     51 T1 ON, NOTE  52 VOLUME  7
-           0x01,0x80,0xc9,0x07, //    128 T1 ON, NOTE  73 VOLUME  7
-                0x80,0x43,0x07, //      0 T2 ON, NOTE  67 VOLUME  7
-           0x01,0x80,0xb5,0x07, //    128 T1 ON, NOTE  53 VOLUME  7
-                0x80,0x2d,0x06, //      0 T2 ON, NOTE  45 VOLUME  6
-           0x01,0x80,0xca,0x07, //    128 T1 ON, NOTE  74 VOLUME  7
-                0x80,0x45,0x07, //      0 T2 ON, NOTE  69 VOLUME  7
-           0x01,0x80,0xb7,0x07, //    128 T1 ON, NOTE  55 VOLUME  7
-                0x80,0x2d,0x06, //      0 T2 ON, NOTE  45 VOLUME  6
-           0x01,0x80,0xcc,0x08, //    128 T1 ON, NOTE  76 VOLUME  8
-                0x80,0x49,0x08, //      0 T2 ON, NOTE  73 VOLUME  8
-                0xb3,0xc5,0x08, //     51 T1 ON, NOTE  69 VOLUME  8
-                0x80,0x37,0x07, //      0 T2 ON, NOTE  55 VOLUME  7
-           0x01,0xcd,0x2d,0x07, //    205 T2 ON, NOTE  45 VOLUME  7
-                0xb3,0xb5,0x08, //     51 T1 ON, NOTE  53 VOLUME  8
-           0x01,0x80,0xca,0x08, //    128 T1 ON, NOTE  74 VOLUME  8
-                0x80,0x47,0x08, //      0 T2 ON, NOTE  71 VOLUME  8
-           0x01,0x80,0xb7,0x08, //    128 T1 ON, NOTE  55 VOLUME  8
-                0x80,0x2d,0x07, //      0 T2 ON, NOTE  45 VOLUME  7
-           0x01,0x80,0xcc,0x08, //    128 T1 ON, NOTE  76 VOLUME  8
-                0x80,0x49,0x08, //      0 T2 ON, NOTE  73 VOLUME  8
-           0x01,0x80,0xb9,0x09, //    128 T1 ON, NOTE  57 VOLUME  9
-                0x80,0x2d,0x07, //      0 T2 ON, NOTE  45 VOLUME  7
-           0x01,0x80,0xcd,0x09, //    128 T1 ON, NOTE  77 VOLUME  9
-                0x80,0x4a,0x09, //      0 T2 ON, NOTE  74 VOLUME  9
-                0xb3,0xb9,0x08, //     51 T1 ON, NOTE  57 VOLUME  8
-                0x80,0x39,0x09, //      0 T2 ON, NOTE  57 VOLUME  9
-           0x01,0x80,0xcd,0x09, //    128 T1 ON, NOTE  77 VOLUME  9
-                0x80,0x4a,0x09, //      0 T2 ON, NOTE  74 VOLUME  9
-           0x01,0x80,0xc3,0x0a, //    128 T1 ON, NOTE  67 VOLUME 10
-                0x80,0x3e,0x0a, //      0 T2 ON, NOTE  62 VOLUME 10
-           0x01,0x80,0xcf,0x07, //    128 T1 ON, NOTE  79 VOLUME  7
-                0x80,0x4a,0x07, //      0 T2 ON, NOTE  74 VOLUME  7
-           0x01,0x80,0xc3,0x08, //    128 T1 ON, NOTE  67 VOLUME  8
-                0x80,0x3e,0x08, //      0 T2 ON, NOTE  62 VOLUME  8
-           0x01,0x80,0xcf,0x07, //    128 T1 ON, NOTE  79 VOLUME  7
-                0x80,0x4a,0x07, //      0 T2 ON, NOTE  74 VOLUME  7
-           0x01,0x80,0xd1,0x09, //    128 T1 ON, NOTE  81 VOLUME  9
-                0x80,0x49,0x09, //      0 T2 ON, NOTE  73 VOLUME  9
-           0x02,0x80,0xb9,0x07, //    256 T1 ON, NOTE  57 VOLUME  7
-                     0x80,0x00, //      0 T2 OFF
-                0xc0,0xb7,0x08, //     64 T1 ON, NOTE  55 VOLUME  8
-                0xc0,0xb5,0x08, //     64 T1 ON, NOTE  53 VOLUME  8
-                0xc0,0xb4,0x08, //     64 T1 ON, NOTE  52 VOLUME  8
-                0xc0,0xb2,0x05, //     64 T1 ON, NOTE  50 VOLUME  5
-                     0xe5,0x01, //    101 BOTH OFF
-           0x01,0x9b,0xd9,0x05, //    155 T1 ON, NOTE  89 VOLUME  5
-                0x80,0x51,0x05, //      0 T2 ON, NOTE  81 VOLUME  5
-                0xbf,0xb9,0x06, //     63 T1 ON, NOTE  57 VOLUME  6
-                0x80,0x35,0x06, //      0 T2 ON, NOTE  53 VOLUME  6
-                     0xc0,0x01, //     64 BOTH OFF
-                0x81,0xd6,0x05, //      1 T1 ON, NOTE  86 VOLUME  5
-                     0xbf,0x01, //     63 BOTH OFF
-                0xc1,0xd9,0x05, //     65 T1 ON, NOTE  89 VOLUME  5
-                0x80,0x51,0x05, //      0 T2 ON, NOTE  81 VOLUME  5
-                     0xff,0x01, //    127 BOTH OFF
-           0x01,0x81,0xd8,0x05, //    129 T1 ON, NOTE  88 VOLUME  5
-                0x80,0x4f,0x05, //      0 T2 ON, NOTE  79 VOLUME  5
-                     0xff,0x01, //    127 BOTH OFF
-           0x01,0x81,0xd5,0x04, //    129 T1 ON, NOTE  85 VOLUME  4
-                0x80,0x4c,0x04, //      0 T2 ON, NOTE  76 VOLUME  4
-                     0xff,0x01, //    127 BOTH OFF
-           0x01,0x81,0xd6,0x06, //    129 T1 ON, NOTE  86 VOLUME  6
-                0x80,0x4d,0x06, //      0 T2 ON, NOTE  77 VOLUME  6
-                     0xff,0x01, //    127 BOTH OFF
-           0x01,0x81,0xd4,0x05, //    129 T1 ON, NOTE  84 VOLUME  5
-                0x80,0x4e,0x05, //      0 T2 ON, NOTE  78 VOLUME  5
-                0xbf,0xb2,0x05, //     63 T1 ON, NOTE  50 VOLUME  5
-                     0x80,0x00, //      0 T2 OFF
-                     0xc0,0x01, //     64 BOTH OFF
-                0x81,0xd4,0x05, //      1 T1 ON, NOTE  84 VOLUME  5
-                0x80,0x4e,0x05, //      0 T2 ON, NOTE  78 VOLUME  5
-                     0xbf,0x01, //     63 BOTH OFF
-                0xc1,0xd4,0x05, //     65 T1 ON, NOTE  84 VOLUME  5
-                0x80,0x4e,0x05, //      0 T2 ON, NOTE  78 VOLUME  5
-                     0xff,0x01, //    127 BOTH OFF
-           0x01,0x81,0xd3,0x05, //    129 T1 ON, NOTE  83 VOLUME  5
-                0x80,0x4d,0x05, //      0 T2 ON, NOTE  77 VOLUME  5
-                0xbf,0xb2,0x05, //     63 T1 ON, NOTE  50 VOLUME  5
-                     0x80,0x00, //      0 T2 OFF
-                     0xc0,0x01, //     64 BOTH OFF
-                0x81,0xd3,0x05, //      1 T1 ON, NOTE  83 VOLUME  5
-                0x80,0x4d,0x05, //      0 T2 ON, NOTE  77 VOLUME  5
-                     0xbf,0x01, //     63 BOTH OFF
-                0xc1,0xd3,0x05, //     65 T1 ON, NOTE  83 VOLUME  5
-                0x80,0x4d,0x05, //      0 T2 ON, NOTE  77 VOLUME  5
-                     0xff,0x01, //    127 BOTH OFF
-           0x01,0x81,0xd2,0x05, //    129 T1 ON, NOTE  82 VOLUME  5
-                0x80,0x4c,0x05, //      0 T2 ON, NOTE  76 VOLUME  5
-                0xbf,0xb2,0x05, //     63 T1 ON, NOTE  50 VOLUME  5
-                     0x80,0x00, //      0 T2 OFF
-                     0xc0,0x01, //     64 BOTH OFF
-                0x81,0xd2,0x05, //      1 T1 ON, NOTE  82 VOLUME  5
-                0x80,0x4c,0x05, //      0 T2 ON, NOTE  76 VOLUME  5
-                     0xbf,0x01, //     63 BOTH OFF
-                0xc1,0xd2,0x05, //     65 T1 ON, NOTE  82 VOLUME  5
-                0x80,0x4c,0x05, //      0 T2 ON, NOTE  76 VOLUME  5
-                     0xff,0x01, //    127 BOTH OFF
-           0x01,0x81,0xd1,0x05, //    129 T1 ON, NOTE  81 VOLUME  5
-                0x80,0x4d,0x05, //      0 T2 ON, NOTE  77 VOLUME  5
-                0xbf,0xb2,0x05, //     63 T1 ON, NOTE  50 VOLUME  5
-                     0x80,0x00, //      0 T2 OFF
-                     0xc0,0x01, //     64 BOTH OFF
-                0x81,0xd6,0x06, //      1 T1 ON, NOTE  86 VOLUME  6
-                     0xbf,0x01, //     63 BOTH OFF
-                0xc1,0xd2,0x05, //     65 T1 ON, NOTE  82 VOLUME  5
-                0x80,0x4f,0x05, //      0 T2 ON, NOTE  79 VOLUME  5
-                0xbf,0xbe,0x06, //     63 T1 ON, NOTE  62 VOLUME  6
-                     0x80,0x00, //      0 T2 OFF
-                     0xc0,0x01, //     64 BOTH OFF
-                0x81,0xd6,0x05, //      1 T1 ON, NOTE  86 VOLUME  5
-                     0xbf,0x01, //     63 BOTH OFF
-                0xc1,0xd1,0x05, //     65 T1 ON, NOTE  81 VOLUME  5
-                0x80,0x4d,0x05, //      0 T2 ON, NOTE  77 VOLUME  5
-                     0xff,0x01, //    127 BOTH OFF
-           0x01,0x81,0xbe,0x05, //    129 T1 ON, NOTE  62 VOLUME  5
-                0xc0,0xbc,0x05, //     64 T1 ON, NOTE  60 VOLUME  5
-                0xc0,0xbb,0x05, //     64 T1 ON, NOTE  59 VOLUME  5
-                0xc0,0xb9,0x05, //     64 T1 ON, NOTE  57 VOLUME  5
-                0xc0,0xb8,0x05, //     64 T1 ON, NOTE  56 VOLUME  5
-                0x01,0xcd,0x01, //    205 BOTH OFF
-                0xb3,0xcd,0x05, //     51 T1 ON, NOTE  77 VOLUME  5
-                0x80,0x46,0x05, //      0 T2 ON, NOTE  70 VOLUME  5
-                0xbf,0xc1,0x06, //     63 T1 ON, NOTE  65 VOLUME  6
-                0x80,0x3e,0x06, //      0 T2 ON, NOTE  62 VOLUME  6
-                     0xc0,0x01, //     64 BOTH OFF
-                0x81,0xca,0x05, //      1 T1 ON, NOTE  74 VOLUME  5
-                     0xbf,0x01, //     63 BOTH OFF
-                0xc1,0xcd,0x05, //     65 T1 ON, NOTE  77 VOLUME  5
-                0x80,0x46,0x05, //      0 T2 ON, NOTE  70 VOLUME  5
-                     0xff,0x01, //    127 BOTH OFF
-           0x01,0x81,0xcc,0x05, //    129 T1 ON, NOTE  76 VOLUME  5
-                0x80,0x46,0x05, //      0 T2 ON, NOTE  70 VOLUME  5
-                     0xff,0x01, //    127 BOTH OFF
-           0x01,0x81,0xd2,0x06, //    129 T1 ON, NOTE  82 VOLUME  6
-                0x80,0x4c,0x06, //      0 T2 ON, NOTE  76 VOLUME  6
-                     0xff,0x01, //    127 BOTH OFF
-           0x01,0x81,0xd1,0x05, //    129 T1 ON, NOTE  81 VOLUME  5
-                0x80,0x4d,0x05, //      0 T2 ON, NOTE  77 VOLUME  5
-                     0xff,0x01, //    127 BOTH OFF
-           0x01,0x81,0xd9,0x05, //    129 T1 ON, NOTE  89 VOLUME  5
-                0x80,0x50,0x05, //      0 T2 ON, NOTE  80 VOLUME  5
-                0xbf,0xb4,0x05, //     63 T1 ON, NOTE  52 VOLUME  5
-                     0x80,0x00, //      0 T2 OFF
-                     0xc0,0x01, //     64 BOTH OFF
-                0x81,0xd9,0x05, //      1 T1 ON, NOTE  89 VOLUME  5
-                0x80,0x50,0x05, //      0 T2 ON, NOTE  80 VOLUME  5
-                     0xbf,0x01, //     63 BOTH OFF
-                0xc1,0xd9,0x05, //     65 T1 ON, NOTE  89 VOLUME  5
-                0x80,0x50,0x05, //      0 T2 ON, NOTE  80 VOLUME  5
-                     0xff,0x01, //    127 BOTH OFF
-           0x01,0x81,0xd8,0x05, //    129 T1 ON, NOTE  88 VOLUME  5
-                0x80,0x54,0x05, //      0 T2 ON, NOTE  84 VOLUME  5
-                0xbf,0xb4,0x04, //     63 T1 ON, NOTE  52 VOLUME  4
-                     0x80,0x00, //      0 T2 OFF
-                     0xc0,0x01, //     64 BOTH OFF
-                0x81,0xd8,0x05, //      1 T1 ON, NOTE  88 VOLUME  5
-                0x80,0x54,0x05, //      0 T2 ON, NOTE  84 VOLUME  5
-                     0xbf,0x01, //     63 BOTH OFF
-                0xc1,0xd8,0x05, //     65 T1 ON, NOTE  88 VOLUME  5
-                0x80,0x54,0x05, //      0 T2 ON, NOTE  84 VOLUME  5
-                     0xff,0x01, //    127 BOTH OFF
-           0x01,0x81,0xd6,0x05, //    129 T1 ON, NOTE  86 VOLUME  5
-                0x80,0x53,0x05, //      0 T2 ON, NOTE  83 VOLUME  5
-                0xbf,0xb4,0x05, //     63 T1 ON, NOTE  52 VOLUME  5
-                     0x80,0x00, //      0 T2 OFF
-                     0xc0,0x01, //     64 BOTH OFF
-                0x81,0xd6,0x05, //      1 T1 ON, NOTE  86 VOLUME  5
-                0x80,0x53,0x05, //      0 T2 ON, NOTE  83 VOLUME  5
-                     0xbf,0x01, //     63 BOTH OFF
-                0xc1,0xd6,0x05, //     65 T1 ON, NOTE  86 VOLUME  5
-                0x80,0x53,0x05, //      0 T2 ON, NOTE  83 VOLUME  5
-                     0xff,0x01, //    127 BOTH OFF
-           0x01,0x81,0xd5,0x05, //    129 T1 ON, NOTE  85 VOLUME  5
-                0x80,0x51,0x05, //      0 T2 ON, NOTE  81 VOLUME  5
-                0xbf,0xc0,0x06, //     63 T1 ON, NOTE  64 VOLUME  6
-                0x80,0x39,0x06, //      0 T2 ON, NOTE  57 VOLUME  6
-                     0xc0,0x01, //     64 BOTH OFF
-                0x81,0xd8,0x06, //      1 T1 ON, NOTE  88 VOLUME  6
-                     0xbf,0x01, //     63 BOTH OFF
-                0xc1,0xd6,0x05, //     65 T1 ON, NOTE  86 VOLUME  5
-                0x80,0x50,0x05, //      0 T2 ON, NOTE  80 VOLUME  5
-                0xbf,0xc0,0x05, //     63 T1 ON, NOTE  64 VOLUME  5
-                0x80,0x3a,0x05, //      0 T2 ON, NOTE  58 VOLUME  5
-                     0xc0,0x01, //     64 BOTH OFF
-                0x81,0xd8,0x05, //      1 T1 ON, NOTE  88 VOLUME  5
-                     0xbf,0x01, //     63 BOTH OFF
-                0xc1,0xd5,0x05, //     65 T1 ON, NOTE  85 VOLUME  5
-                0x80,0x51,0x05, //      0 T2 ON, NOTE  81 VOLUME  5
-                     0xff,0x01, //    127 BOTH OFF
-           0x01,0x81,0xb9,0x05, //    129 T1 ON, NOTE  57 VOLUME  5
-                0xc0,0xb7,0x05, //     64 T1 ON, NOTE  55 VOLUME  5
-                0xc0,0xb5,0x05, //     64 T1 ON, NOTE  53 VOLUME  5
-                0xc0,0xb4,0x05, //     64 T1 ON, NOTE  52 VOLUME  5
-                0xc0,0xb2,0x05, //     64 T1 ON, NOTE  50 VOLUME  5
-                     0xe5,0x01, //    101 BOTH OFF
-           0x01,0x9b,0xd9,0x05, //    155 T1 ON, NOTE  89 VOLUME  5
-                0x80,0x51,0x05, //      0 T2 ON, NOTE  81 VOLUME  5
-                0xbf,0xb9,0x06, //     63 T1 ON, NOTE  57 VOLUME  6
-                0x80,0x35,0x06, //      0 T2 ON, NOTE  53 VOLUME  6
-                     0xc0,0x01, //     64 BOTH OFF
-                0x81,0xd6,0x05, //      1 T1 ON, NOTE  86 VOLUME  5
-                     0xbf,0x01, //     63 BOTH OFF
-                0xc1,0xd9,0x05, //     65 T1 ON, NOTE  89 VOLUME  5
-                0x80,0x51,0x05, //      0 T2 ON, NOTE  81 VOLUME  5
-                     0xff,0x01, //    127 BOTH OFF
-           0x01,0x81,0xd8,0x05, //    129 T1 ON, NOTE  88 VOLUME  5
-                0x80,0x4f,0x05, //      0 T2 ON, NOTE  79 VOLUME  5
-                     0xff,0x01, //    127 BOTH OFF
-           0x01,0x81,0xd5,0x05, //    129 T1 ON, NOTE  85 VOLUME  5
-                0x80,0x4c,0x05, //      0 T2 ON, NOTE  76 VOLUME  5
-                     0xff,0x01, //    127 BOTH OFF
-           0x01,0x81,0xd6,0x05, //    129 T1 ON, NOTE  86 VOLUME  5
-                0x80,0x4d,0x05, //      0 T2 ON, NOTE  77 VOLUME  5
-                     0xff,0x01, //    127 BOTH OFF
-           0x01,0x81,0xd4,0x05, //    129 T1 ON, NOTE  84 VOLUME  5
-                0x80,0x4e,0x05, //      0 T2 ON, NOTE  78 VOLUME  5
-                0xbf,0xb2,0x05, //     63 T1 ON, NOTE  50 VOLUME  5
-                     0x80,0x00, //      0 T2 OFF
-                     0xc0,0x01, //     64 BOTH OFF
-                0x81,0xd4,0x05, //      1 T1 ON, NOTE  84 VOLUME  5
-                0x80,0x4e,0x05, //      0 T2 ON, NOTE  78 VOLUME  5
-                     0xbf,0x01, //     63 BOTH OFF
-                0xc1,0xd4,0x05, //     65 T1 ON, NOTE  84 VOLUME  5
-                0x80,0x4e,0x05, //      0 T2 ON, NOTE  78 VOLUME  5
-                     0xff,0x01, //    127 BOTH OFF
-           0x01,0x81,0xd3,0x05, //    129 T1 ON, NOTE  83 VOLUME  5
-                0x80,0x4d,0x05, //      0 T2 ON, NOTE  77 VOLUME  5
-                0xbf,0xb2,0x05, //     63 T1 ON, NOTE  50 VOLUME  5
-                     0x80,0x00, //      0 T2 OFF
-                     0xc0,0x01, //     64 BOTH OFF
-                0x81,0xd3,0x05, //      1 T1 ON, NOTE  83 VOLUME  5
-                0x80,0x4d,0x05, //      0 T2 ON, NOTE  77 VOLUME  5
-                     0xbf,0x01, //     63 BOTH OFF
-                0xc1,0xd3,0x05, //     65 T1 ON, NOTE  83 VOLUME  5
-                0x80,0x4d,0x05, //      0 T2 ON, NOTE  77 VOLUME  5
-                     0xff,0x01, //    127 BOTH OFF
-           0x01,0x81,0xd2,0x05, //    129 T1 ON, NOTE  82 VOLUME  5
-                0x80,0x4c,0x05, //      0 T2 ON, NOTE  76 VOLUME  5
-                0xbf,0xb2,0x05, //     63 T1 ON, NOTE  50 VOLUME  5
-                     0x80,0x00, //      0 T2 OFF
-                     0xc0,0x01, //     64 BOTH OFF
-                0x81,0xd2,0x05, //      1 T1 ON, NOTE  82 VOLUME  5
-                0x80,0x4c,0x05, //      0 T2 ON, NOTE  76 VOLUME  5
-                     0xbf,0x01, //     63 BOTH OFF
-                0xc1,0xd2,0x05, //     65 T1 ON, NOTE  82 VOLUME  5
-                0x80,0x4c,0x05, //      0 T2 ON, NOTE  76 VOLUME  5
-                     0xff,0x01, //    127 BOTH OFF
-           0x01,0x81,0xd1,0x05, //    129 T1 ON, NOTE  81 VOLUME  5
-                0x80,0x4d,0x05, //      0 T2 ON, NOTE  77 VOLUME  5
-                0xbf,0xb2,0x05, //     63 T1 ON, NOTE  50 VOLUME  5
-                     0x80,0x00, //      0 T2 OFF
-                     0xc0,0x01, //     64 BOTH OFF
-                0x81,0xd6,0x06, //      1 T1 ON, NOTE  86 VOLUME  6
-                     0xbf,0x01, //     63 BOTH OFF
-                0xc1,0xd2,0x05, //     65 T1 ON, NOTE  82 VOLUME  5
-                0x80,0x4f,0x05, //      0 T2 ON, NOTE  79 VOLUME  5
-                0xbf,0xc0,0x06, //     63 T1 ON, NOTE  64 VOLUME  6
-                0x80,0x3e,0x06, //      0 T2 ON, NOTE  62 VOLUME  6
-                     0xc0,0x01, //     64 BOTH OFF
-                0x81,0xd6,0x06, //      1 T1 ON, NOTE  86 VOLUME  6
-                     0xbf,0x01, //     63 BOTH OFF
-                0xc1,0xd1,0x05, //     65 T1 ON, NOTE  81 VOLUME  5
-                0x80,0x4d,0x05, //      0 T2 ON, NOTE  77 VOLUME  5
-                     0xff,0x01, //    127 BOTH OFF
-           0x01,0x81,0xc1,0x05, //    129 T1 ON, NOTE  65 VOLUME  5
-                0xc0,0xc0,0x05, //     64 T1 ON, NOTE  64 VOLUME  5
-                0xc0,0xbe,0x05, //     64 T1 ON, NOTE  62 VOLUME  5
-                0xc0,0xbc,0x05, //     64 T1 ON, NOTE  60 VOLUME  5
-                0xc0,0xbb,0x05, //     64 T1 ON, NOTE  59 VOLUME  5
-                0x01,0xcd,0x01, //    205 BOTH OFF
-                0xb3,0xca,0x05, //     51 T1 ON, NOTE  74 VOLUME  5
-                0x80,0x44,0x05, //      0 T2 ON, NOTE  68 VOLUME  5
-                0xbf,0xc0,0x08, //     63 T1 ON, NOTE  64 VOLUME  8
-                     0x80,0x00, //      0 T2 OFF
-                0xc1,0x47,0x05, //     65 T2 ON, NOTE  71 VOLUME  5
-                     0xbf,0x00, //     63 T2 OFF
-                0xc1,0xca,0x06, //     65 T1 ON, NOTE  74 VOLUME  6
-                0x80,0x44,0x06, //      0 T2 ON, NOTE  68 VOLUME  6
-                0xff,0xc0,0x08, //    127 T1 ON, NOTE  64 VOLUME  8
-                     0x80,0x00, //      0 T2 OFF
-           0x01,0x81,0xc9,0x05, //    129 T1 ON, NOTE  73 VOLUME  5
-                0x80,0x45,0x05, //      0 T2 ON, NOTE  69 VOLUME  5
-                0xff,0xb9,0x05, //    127 T1 ON, NOTE  57 VOLUME  5
-                     0x80,0x00, //      0 T2 OFF
-                     0xce,0x01, //     78 BOTH OFF
-                0xb3,0xb2,0x05, //     51 T1 ON, NOTE  50 VOLUME  5
-           0x02,0x80,0xc8,0x05, //    256 T1 ON, NOTE  72 VOLUME  5
-                0x80,0x42,0x05, //      0 T2 ON, NOTE  66 VOLUME  5
-                0xbf,0xbe,0x08, //     63 T1 ON, NOTE  62 VOLUME  8
-                     0x80,0x00, //      0 T2 OFF
-                0xc1,0x45,0x05, //     65 T2 ON, NOTE  69 VOLUME  5
-                     0xbf,0x00, //     63 T2 OFF
-                0xc1,0xc8,0x05, //     65 T1 ON, NOTE  72 VOLUME  5
-                0x80,0x42,0x05, //      0 T2 ON, NOTE  66 VOLUME  5
-                0xff,0xbe,0x08, //    127 T1 ON, NOTE  62 VOLUME  8
-                     0x80,0x00, //      0 T2 OFF
-           0x01,0x81,0xc7,0x05, //    129 T1 ON, NOTE  71 VOLUME  5
-                0x80,0x43,0x05, //      0 T2 ON, NOTE  67 VOLUME  5
-                0xff,0xb7,0x05, //    127 T1 ON, NOTE  55 VOLUME  5
-                     0x80,0x00, //      0 T2 OFF
-                     0xce,0x01, //     78 BOTH OFF
-                0xb3,0xb0,0x05, //     51 T1 ON, NOTE  48 VOLUME  5
-           0x02,0x80,0xc6,0x05, //    256 T1 ON, NOTE  70 VOLUME  5
-                0x80,0x40,0x05, //      0 T2 ON, NOTE  64 VOLUME  5
-                0xbf,0xbc,0x08, //     63 T1 ON, NOTE  60 VOLUME  8
-                     0x80,0x00, //      0 T2 OFF
-                0xc1,0x43,0x05, //     65 T2 ON, NOTE  67 VOLUME  5
-                     0xbf,0x00, //     63 T2 OFF
-                0xc1,0xc6,0x05, //     65 T1 ON, NOTE  70 VOLUME  5
-                0x80,0x40,0x05, //      0 T2 ON, NOTE  64 VOLUME  5
-                0xff,0xbc,0x08, //    127 T1 ON, NOTE  60 VOLUME  8
-                     0x80,0x00, //      0 T2 OFF
-           0x01,0x81,0xc5,0x05, //    129 T1 ON, NOTE  69 VOLUME  5
-                0x80,0x41,0x05, //      0 T2 ON, NOTE  65 VOLUME  5
-                0xff,0xb5,0x05, //    127 T1 ON, NOTE  53 VOLUME  5
-                     0x80,0x00, //      0 T2 OFF
-                     0xce,0x01, //     78 BOTH OFF
-                0xb3,0xad,0x05, //     51 T1 ON, NOTE  45 VOLUME  5
-                     0xff,0x01, //    127 BOTH OFF
-                0xa2,0xc5,0x07, //     34 T1 ON, NOTE  69 VOLUME  7
-                0xa0,0xc9,0x09, //     32 T1 ON, NOTE  73 VOLUME  9
-                0x94,0xcc,0x09, //     20 T1 ON, NOTE  76 VOLUME  9
-                0xab,0xd1,0x09, //     43 T1 ON, NOTE  81 VOLUME  9
-                0x80,0x37,0x0a, //      0 T2 ON, NOTE  55 VOLUME 10
-                0xe5,0xb9,0x0a, //    101 T1 ON, NOTE  57 VOLUME 10
-                     0x9a,0x01, //     26 BOTH OFF
-           0x01,0x81,0xd6,0x09, //    129 T1 ON, NOTE  86 VOLUME  9
-                0x80,0x39,0x0a, //      0 T2 ON, NOTE  57 VOLUME 10
-                     0xff,0x01, //    127 BOTH OFF
-                     0x80,0x05  //      0 END PROGRAM
+0x00,0x00,0x00,0x01,0x01,0x06,0x17,0x13,0x0e,0x16,0x0f,0x0a,0x00,0x00,0x00,0x00, // HUFFMAN TABLE (111 symbols)
+0x01,0x05,0x00,0x04,0x34,0x35,0x39,0x7f,0x06,0x07,0x2d,0x32,0x37,0x3e,0x40,0x4c,
+0x4d,0x50,0x51,0x54,0x55,0x56,0x5f,0x81,0xb3,0xb5,0xd5,0xdf,0xf5,0xf7,0xff,0x08,
+0x3b,0x41,0x45,0x46,0x4a,0x4e,0x4f,0x52,0x53,0x58,0x59,0x80,0x97,0xb4,0xb7,0xce,
+0xd4,0xf4,0x02,0x3a,0x3c,0x3d,0x43,0x44,0x47,0x49,0x96,0x98,0xb6,0xcd,0xf6,0xf8,
+0x09,0x0a,0x30,0x42,0x48,0x57,0x74,0x75,0x78,0x8e,0x92,0x95,0x99,0x9b,0xa4,0xa5,
+0xb2,0xc4,0xd8,0xe5,0xf0,0xf9,0x2b,0x2f,0x31,0x36,0x38,0x77,0x84,0x85,0x9a,0xa0,
+0xa8,0xe4,0xe6,0xe7,0xfa,0x14,0x1e,0x1f,0x60,0x94,0xa2,0xab,0xbf,0xc0,0xc1,
+0xe2,0xd5,0xfd,0xfc,0x7f,0xae,0xa1,0x3f,0xfd,0xb8,0x6a,0xff,0xff,0xfb,0xfb,0x36,
+0xb0,0x87,0x4e,0xa5,0x84,0x36,0xb0,0x87,0x8f,0xc6,0xb0,0x86,0xd6,0x11,0x80,0xf7,
+0xd6,0x10,0xda,0xc2,0x39,0x4f,0xc6,0xb0,0x86,0xd6,0x10,0xe9,0xd4,0xb0,0x86,0xd6,
+0x10,0xf1,0xf8,0xd6,0x10,0xda,0xc2,0x30,0x1e,0xfa,0xc2,0x1b,0x58,0x47,0x29,0xf8,
+0xd6,0x10,0xda,0xc2,0x34,0x9e,0x29,0x14,0x49,0xac,0x70,0x9e,0x59,0x85,0x3a,0x4a,
+0x25,0x84,0xe8,0x2c,0xab,0x08,0x90,0xef,0xac,0x26,0x52,0x81,0x61,0x11,0x9f,0x24,
+0x6d,0x9a,0xb1,0xc2,0x78,0xcf,0x92,0x61,0xb2,0x33,0xe4,0x58,0x46,0x73,0xc1,0x1b,
+0x66,0xac,0x70,0x9f,0x39,0xe0,0x98,0x53,0x9c,0xa0,0x58,0x46,0x63,0xbf,0x1b,0x66,
+0xac,0x70,0x9f,0x31,0xdf,0x98,0x53,0x98,0x9f,0x58,0x44,0x47,0x82,0x36,0xcd,0x58,
+0xb2,0x79,0x66,0x1b,0x33,0x1f,0x2c,0xae,0x9a,0xb1,0x64,0xf2,0xcc,0x36,0x44,0x78,
+0x16,0x10,0xee,0xfe,0x4d,0xf7,0xf7,0xab,0x7f,0xe1,0x70,0xed,0x1c,0x28,0x80,0xf8,
+0xa4,0xc0,0x4e,0xd6,0x38,0x4f,0x8e,0x61,0xb2,0x03,0xe2,0x58,0x43,0xe7,0xc4,0xb0,
+0x9c,0xc4,0xfa,0xc2,0x22,0x3c,0x0b,0x08,0xd2,0x78,0x63,0x41,0xab,0x1c,0x27,0xd2,
+0x78,0x66,0x1b,0x34,0x9e,0x15,0x84,0x68,0x3c,0x71,0xa0,0xd5,0x8e,0x13,0xe8,0x3c,
+0x73,0x0a,0x74,0x14,0x6b,0x08,0x94,0xf9,0xe3,0x41,0xab,0x16,0x4f,0x29,0x67,0x98,
+0x6c,0x94,0xf9,0xd6,0x13,0x21,0x45,0x23,0xc4,0xaa,0xc5,0x93,0xe8,0x98,0x6c,0x94,
+0xf0,0xc6,0xf1,0xf8,0xeb,0x16,0x4f,0xa2,0x61,0xb2,0x43,0xc4,0xb0,0x85,0x6f,0x73,
+0x7a,0x77,0xa3,0x7b,0x77,0x7c,0xc7,0x01,0xed,0xd2,0x78,0xa4,0x51,0x26,0xb1,0xc2,
+0x79,0x66,0x14,0xe9,0x28,0x96,0x11,0xa0,0xf9,0x56,0x11,0x21,0xdf,0x58,0x4c,0xa5,
+0x02,0xc2,0x23,0x3e,0x48,0xdb,0x35,0x62,0xc9,0xe3,0x2c,0x93,0x0d,0x91,0x9f,0x22,
+0xc2,0x73,0x94,0x11,0xb6,0x6a,0xc7,0x09,0xf3,0x9e,0x09,0x85,0x39,0xca,0x05,0x84,
+0xe6,0x27,0xe3,0x6c,0xd5,0x8e,0x13,0xe6,0x3b,0xf3,0x0d,0x99,0x8e,0xfa,0xc2,0x22,
+0x3c,0x11,0xb6,0x6a,0xc5,0x93,0xcb,0x30,0xd9,0x98,0xf9,0x64,0x78,0x9d,0xac,0x59,
+0x3c,0xb3,0x0d,0x91,0x1e,0x05,0x84,0x60,0xa9,0xed,0xee,0xef,0xe4,0xdf,0x7e,0xe1,
+0xda,0x38,0x51,0x8c,0xfc,0xfe,0x57,0x8d,0xee,0xe8,0x7a,0x9c,0x65,0xcf,0xf8,0xbc,
+0x64,0x74,0x9f,0x0f,0x99,0x46,0xbb,0x70,0xe1,0x43,0x7c,0x38,0xb5,0x79,0x0f,0xe3,
+0xf2,0xba,0x6f,0x76,0x17,0xa9,0xf2,0x17,0x8f,0xf1,0x74,0xc8,0xe8,0x3f,0x37,0x99,
+0xc3,0x5d,0xb8,0x70,0xa3,0xc5,0xc3,0x8b,0x56,0x23,0xbd,0xa3,0x90,0xde,0xee,0x67,
+0xb6,0x62,0x3b,0xde,0x8e,0x43,0x23,0x09,0xf0,0x79,0x92,0x6b,0xb7,0x0b,0x28,0x52,
+0xc2,0x30,0x9d,0xcf,0xdf,0xf6,0xe9,0xe1,0xfb,0x44,0x8c,0x64,0x9f,0xf2,0xe3,0x5d,
+0xdc,0x5a,0x92,0xc3,0x7f,0x95,0xfc,0x4d,0xec,0x70,0xe8,0xfc,0xf9,0x79,0xd1,0x4a,
+0x59,0x6b,0xd6,0xe9,0x2a,0x44,0xb2,0xd7,0x63,0x9d,0x4f,0x30,0xa9,0x5c,0x65,0xad,
+0xaa,0xea,0xc0,0xc3,0xbe,0x55,0x32,0xd7,0x62,0x7a,0x9d,0x62,0xff,0xaf,0x94,0x95,
+0x60,0xed,0x43,0x2d,0x5b,0x42,0x99,0xfb,0xad,0xab,0x8e,0xda,0x95,0x6f,0xc5,0xab,
+0x7d,0x4e,0x32,0xde,0xb4,0xfd,0x3e,0x16,0xee,0x4c,0x3b,0x53,0x0e,0xd4,0xc3,0xb5,
+0x30,0xdd,0xe9,0x16,0xd0,0x96,0x7e,0xdb,0x6a,0x55,0xb5,0x39,0x6f,0xc7,0xec,0xb7,
+0xd4,0x9b,0xde,0x2d,0x68,0xfa,0x7c,0x2d,0xdc,0x88,0x76,0xa2,0x1d,0xa8,0x87,0x6a,
+0x21,0xbb,0xd2,0x3b,0xe8,0x6a,0xce,0x2d,0x49,0x26,0xff,0x2b,0xf8,0x5b,0xd8,0xe1,
+0xd1,0xf9,0xf2,0xf3,0xa2,0x94,0xde,0x6b,0xd6,0xe9,0x2a,0x44,0xde,0x6b,0xb1,0xce,
+0xa7,0x98,0x54,0xae,0x5e,0x6b,0x6a,0xba,0xb0,0x30,0xef,0x95,0x57,0x9a,0xec,0x4f,
+0x53,0xac,0x5f,0xf5,0xf2,0x92,0xac,0x1d,0xa8,0xbc,0xd5,0xb4,0x29,0x9f,0xba,0xda,
+0xb8,0xed,0xa9,0x56,0xfc,0x5a,0xb7,0xd4,0xe3,0x2d,0xeb,0x4f,0xd3,0xe1,0x6e,0xe4,
+0xc3,0xb5,0x30,0xed,0x4c,0x3b,0x53,0x0d,0xde,0x91,0x6d,0x09,0x67,0xed,0xb6,0xa5,
+0x5b,0x53,0x96,0xfc,0x7e,0xcb,0x7d,0x49,0x67,0xc5,0xad,0x1f,0x4f,0x85,0xbb,0x91,
+0x0e,0xd4,0x43,0xb5,0x10,0xed,0x44,0x37,0x7a,0x47,0x75,0x0d,0x7f,0x1c,0x5a,0x9b,
+0xd7,0xd0,0xce,0x0d,0x68,0x61,0xae,0xae,0x96,0x39,0xb5,0xa5,0x86,0xb5,0xe3,0x67,
+0x0f,0x7d,0x18,0x59,0x4f,0xf0,0x3b,0x5a,0xb6,0x84,0x6b,0xe9,0x67,0x9b,0x5a,0x58,
+0x6b,0x5e,0x36,0x70,0xeb,0x71,0x86,0xba,0xdf,0xbd,0xd3,0xdf,0x46,0x16,0x5c,0xfe,
+0x47,0x6b,0x5d,0xf4,0x27,0xaf,0x1d,0xee,0x8e,0xb7,0x19,0x6b,0xad,0xfb,0xdd,0x3e,
+0xc5,0x32,0xd7,0xb2,0x0f,0x06,0x3e,0xfa,0x15,0xe0,0x57,0xb2,0x0f,0x06,0x3f,0xd3,
+0x9b,0xc2,0xee,0xbc,0xac,0xe3,0xeb,0xe6,0xbc,0xee,0xbc,0xac,0xe3,0xf6,0x45,0xe0,
+0xe9,0xb7,0x8b,0x52,0x8d,0xf2,0x73,0xe4,0x9f,0x92,0x2a,0x6e,0xef,0x98,0xb0,0x7b,
+0x74,0x94,0x52,0xa9,0x84,0xd6,0x2c,0x9e,0x59,0x85,0x3a,0x4a,0x25,0x84,0xe8,0x2c,
+0xab,0x08,0x90,0xef,0xac,0x7d,0xf2,0xb1,0x02,0xc2,0x63,0x2c,0x92,0x36,0x6a,0xc5,
+0x93,0xc6,0x59,0x26,0x14,0xc6,0x59,0x16,0x13,0x9c,0xa0,0x91,0xb3,0x56,0x2c,0x9f,
+0x39,0x41,0x30,0xa7,0x39,0x40,0xb0,0x9c,0xc4,0xfc,0x8d,0x9a,0xb1,0x64,0xf9,0x89,
+0xf9,0x85,0x39,0x89,0xf5,0x84,0xc4,0x50,0x48,0xd9,0xab,0x1d,0xd3,0xcb,0x30,0xa7,
+0x31,0x65,0x95,0xd3,0x56,0x2c,0x9e,0x59,0x85,0x31,0x14,0x0b,0x09,0x76,0xae,0x4a,
+0xaf,0xd4,0xaa,0xbf,0x0b,0x87,0x68,0xb2,0x88,0x0b,0x14,0xb8,0x18,0x76,0xb1,0x64,
+0xf8,0xe6,0x14,0xc0,0x58,0x96,0x12,0xf9,0x62,0x58,0xfb,0xf3,0x30,0xfa,0xc2,0x62,
+0x28,0x16,0x13,0xa4,0xa1,0x91,0x06,0xac,0x59,0x3e,0x92,0x86,0x61,0x4e,0x92,0x85,
+0x61,0x3a,0x0a,0x38,0xd0,0x6a,0xc5,0x93,0xe8,0x28,0xe6,0x14,0xe8,0x28,0xd6,0x13,
+0x29,0x67,0x91,0x06,0xac,0x59,0x3c,0xa5,0x9e,0x61,0x4c,0xa5,0x9d,0x61,0x32,0x14,
+0x52,0xbc,0xc2,0xab,0x1d,0xd3,0xe8,0x98,0x53,0x29,0x43,0x23,0xc5,0xc7,0x58,0xb2,
+0x7d,0x13,0x0a,0x64,0x28,0x96,0x12,0xaa,0x9c,0xa9,0x35,0x22,0xa6,0xee,0xf9,0x8b,
+0x07,0xb7,0x49,0x45,0x2a,0x98,0x4d,0x62,0xc9,0xe5,0x98,0x53,0xa4,0xa2,0x58,0x4e,
+0x82,0xca,0xb0,0x99,0x09,0xf5,0x84,0xca,0x50,0x2c,0x26,0x32,0xc9,0x23,0x66,0xac,
+0x59,0x3c,0x65,0x92,0x61,0x4c,0x65,0x91,0x61,0x39,0xca,0x09,0x1b,0x35,0x62,0xc9,
+0xf3,0x94,0x13,0x0a,0x73,0x94,0x0b,0x09,0xcc,0x4f,0xc8,0xd9,0xab,0x16,0x4f,0x98,
+0x9f,0x98,0x53,0x98,0x9f,0x58,0x4c,0x45,0x04,0x8d,0x9a,0xb1,0xdd,0x3c,0xb3,0x0a,
+0x73,0x16,0x59,0x5e,0x61,0xda,0xc7,0x74,0xf2,0xcc,0x29,0x88,0xa0,0x58,0x4e,0x0a,
+0x9e,0xa9,0xda,0xb9,0x2a,0xbf,0x70,0xed,0x16,0x51,0x8c,0xb9,0xf4,0x3c,0x6f,0x7f,
+0x43,0xdd,0x98,0xd8,0xe7,0xf4,0x3c,0x64,0xf4,0x96,0x1f,0x3a,0x8d,0x76,0xe1,0x65,
+0x0d,0xd9,0xc5,0xab,0xc8,0x5e,0x3d,0x0e,0x9b,0xdf,0x85,0xea,0x7c,0x85,0xe3,0xf4,
+0x3a,0x64,0xf4,0x17,0x37,0x9d,0xc3,0x5d,0xb8,0x59,0x47,0x8a,0xce,0x2d,0x58,0x89,
+0xed,0x1c,0x86,0xf7,0xf3,0x3d,0x4e,0x22,0x7b,0xd1,0xc8,0x64,0xe1,0x2c,0x1e,0x74,
+0x9a,0xed,0xc2,0xca,0x1a,0x58,0xb7,0xfd,0xe1,0xfa,0xfe,0xbd,0x3f,0x5f,0xf4,0xff,
+0xd7,0xfe,0x45,0xe1,0x73,0xfa,0xf9,0xaa,0xef,0xd0,0x2a,0x5f,0x0a,0x96,0x3f,0xc1,
+0x00
 };
@@ -0,0 +1,211 @@
+#include "SyncLink.h"
+#include <arduino.h>
+#include "StateMachine.h"
+#include "MIDIPlayer.h"
+#include "Timebase.h"
+
+// Sync frame = SYNC_FRAME_START, song index (under 128, see song_count()),
+// then the leader's song position in microseconds as 7-bit groups, most
+// significant first. Only the start byte has its high bit set, so log text
+// on the same line is skipped.
+#define SYNC_FRAME_START     0xF8
+#define SYNC_POSITION_BYTES  5
+#define SYNC_FRAME_LENGTH    (2 + SYNC_POSITION_BYTES)
+#define SYNC_PERIOD_MS       50
+
+// 10 bits per byte on the wire, at the rate the core's U2X divisor gives
+// (117647 baud for 115200)
+#define SYNC_UBRR            ((F_CPU / 4 / SYNC_BAUD - 1) / 2)
+#define SYNC_BYTE_US         (10 * 8 * (SYNC_UBRR + 1) / (F_CPU / 1000000UL))
+
+#ifdef SYNC_LEADER
+
+namespace {
+  unsigned long last_sync_ms = 0;
+}
+
+void init_sync_link() {
+  Serial.begin(SYNC_BAUD);
+}
+
+void sync_update() {
+  if (get_current_state() != MUSIC_PLAY) return;
+  unsigned long timestamp = timebase_ms();
+  if (timestamp - last_sync_ms < SYNC_PERIOD_MS) return;
+
+  // Only send into an empty TX buffer, so the frame leaves as soon as the position is sampled
+  if (Serial.availableForWrite() < SERIAL_TX_BUFFER_SIZE - 1) return;
+  last_sync_ms = timestamp;
+
+  unsigned long position = get_midi_position_us(timebase_us());
+  Serial.write(SYNC_FRAME_START);
+  Serial.write((byte)get_song_index());
+  for (int8_t shift = 7 * (SYNC_POSITION_BYTES - 1); shift >= 0; shift -= 7)
+    Serial.write((byte)((position >> shift) & 0x7f));
+}
+
+#endif
+
+#ifdef SYNC_FOLLOWER
+
+// Frames are timed by their start bit: a pin change interrupt on RX
+// timestamps the first falling edge after it is armed and disarms itself,
+// and loop() re-arms it between frames. The edge is the start byte's start
+// bit when the start byte is the first byte read since arming and the edge
+// came a byte time or more after arming (armed partway through a byte, the
+// edge could be the next byte's); other frames are not used.
+//
+// Interrupts masked elsewhere (a NeoPixel show(), other ISRs) can only delay
+// the timestamp, so of every SYNC_FILTER_FRAMES frames the one with the
+// largest error had the least delay. It corrects the timeline by
+// 1/SYNC_GAIN_DIVISOR of that error, and adds 1/SYNC_RATE_DIVISOR of it, as
+// a rate over the filter period, to a rate in ppm that steps the timeline
+// 1 us at a time in between: board clocks differ by up to 1% (ceramic
+// resonators), more drift than the corrections alone keep up with.
+// host_sim/sync_test.py checks these constants hold the skew under 100 us.
+#define SYNC_FILTER_FRAMES   4
+#define SYNC_GAIN_DIVISOR    2
+#define SYNC_RATE_DIVISOR    8
+#define SYNC_MAX_RATE_PPM    20000
+#define SYNC_SNAP_US         20000  // Larger errors are corrected in a single step
+
+// RX is digital pin 0 on both boards
+#if defined(__AVR_ATmega2560__)
+  #define SYNC_RX_PCMSK      PCMSK1
+  #define SYNC_RX_PCINT      PCINT8   // PE0
+  #define SYNC_RX_PCIE       PCIE1
+  #define SYNC_RX_PCIF       PCIF1
+  #define SYNC_RX_HIGH()     (PINE & _BV(PINE0))
+  #define SYNC_RX_vect       PCINT1_vect
+#else
+  #define SYNC_RX_PCMSK      PCMSK2
+  #define SYNC_RX_PCINT      PCINT16  // PD0
+  #define SYNC_RX_PCIE       PCIE2
+  #define SYNC_RX_PCIF       PCIF2
+  #define SYNC_RX_HIGH()     (PIND & _BV(PIND0))
+  #define SYNC_RX_vect       PCINT2_vect
+#endif
+
+namespace {
+  byte sync_frame[SYNC_FRAME_LENGTH];
+  uint8_t sync_frame_length = 0;
+
+  // Start bit capture
+  volatile unsigned long edge_us = 0;
+  volatile bool edge_captured = false;
+  unsigned long armed_us = 0;
+  bool first_byte = false;  // No byte read since arming
+  bool frame_timed = false;
+  unsigned long frame_start_us = 0;
+
+  long best_error_us = 0;
+  uint8_t filter_count = 0;
+
+  // Rate correction: a 1 us step every rate_step_us, forwards or backwards
+  long rate_ppm = 0;
+  unsigned long rate_step_us = 0;
+  unsigned long next_rate_step_us = 0;
+
+  void arm_capture() {
+    armed_us = timebase_us();
+    edge_captured = false;
+    first_byte = true;
+    PCIFR = _BV(SYNC_RX_PCIF);
+    SYNC_RX_PCMSK |= _BV(SYNC_RX_PCINT);
+  }
+
+  void set_rate(long ppm) {
+    rate_ppm = constrain(ppm, -SYNC_MAX_RATE_PPM, SYNC_MAX_RATE_PPM);
+    rate_step_us = rate_ppm ? 1000000UL / labs(rate_ppm) : 0;
+    next_rate_step_us = timebase_us() + rate_step_us;
+  }
+
+  void apply_rate() {
+    if (!rate_step_us || get_current_state() != MUSIC_PLAY) return;
+    unsigned long timestamp = timebase_us();
+    long steps = 0;
+    while ((long)(timestamp - next_rate_step_us) >= 0) {
+      next_rate_step_us += rate_step_us;
+      steps++;
+    }
+    if (steps) shift_midi_position(rate_ppm > 0 ? steps : -steps);
+  }
+
+  // start_us: timebase time of the frame's start bit
+  void on_sync_frame(unsigned long start_us) {
+    if (get_current_state() != MUSIC_PLAY) return;
+
+    // The leader sampled its position just before sending the start byte
+    unsigned long position = 0;
+    for (uint8_t i = 2; i < SYNC_FRAME_LENGTH; i++)
+      position = (position << 7) | sync_frame[i];
+
+    int song_index = sync_frame[1];
+    if (song_index != get_song_index()) {
+      #ifdef SERIAL_LOGGING
+        Serial.println(F("Sync: following leader's song"));
+      #endif
+      load_song(song_index);
+      filter_count = 0;
+    }
+
+    long error_us = (long)(position - get_midi_position_us(start_us));
+    if (error_us > SYNC_SNAP_US || error_us < -SYNC_SNAP_US) {
+      shift_midi_position(error_us);
+      filter_count = 0;
+      return;
+    }
+
+    if (filter_count == 0 || error_us > best_error_us)
+      best_error_us = error_us;
+    if (++filter_count >= SYNC_FILTER_FRAMES) {
+      shift_midi_position(best_error_us / SYNC_GAIN_DIVISOR);
+      set_rate(rate_ppm + best_error_us * 1000L / (SYNC_FILTER_FRAMES * SYNC_PERIOD_MS) / SYNC_RATE_DIVISOR);
+      filter_count = 0;
+    }
+  }
+}
+
+ISR(SYNC_RX_vect) {
+  if (SYNC_RX_HIGH()) return;
+  edge_us = timebase_us();
+  edge_captured = true;
+  SYNC_RX_PCMSK &= ~_BV(SYNC_RX_PCINT);
+}
+
+void init_sync_link() {
+  Serial.begin(SYNC_BAUD);
+  PCICR |= _BV(SYNC_RX_PCIE);
+  arm_capture();
+}
+
+void sync_update() {
+  apply_rate();
+  while (Serial.available()) {
+    byte value = Serial.read();
+    if (value == SYNC_FRAME_START) {
+      sync_frame[0] = value;
+      sync_frame_length = 1;
+      frame_timed = first_byte && edge_captured && (long)(edge_us - armed_us) >= (long)SYNC_BYTE_US;
+      frame_start_us = edge_us;
+    } else if (sync_frame_length > 0 && !(value & 0x80)) {
+      sync_frame[sync_frame_length++] = value;
+      if (sync_frame_length == SYNC_FRAME_LENGTH) {
+        if (frame_timed) on_sync_frame(frame_start_us);
+        sync_frame_length = 0;
+      }
+    } else {
+      sync_frame_length = 0;
+    }
+    first_byte = false;
+  }
+
+  // The captured edge is spent once the byte it started has been read
+  if (edge_captured && !first_byte && sync_frame_length == 0) {
+    noInterrupts();
+    if (!Serial.available()) arm_capture();
+    interrupts();
+  }
+}
+
+#endif
@@ -0,0 +1,17 @@
+#pragma once
+
+// Synchronized playback across several controllers. The leader broadcasts
+// its song index and song position on the serial TX line; each follower
+// listens on RX, starts the same song and phase-locks its song timeline to
+// the leader's. Define at most one of these per board.
+//#define SYNC_LEADER
+//#define SYNC_FOLLOWER
+
+#if defined(SYNC_LEADER) || defined(SYNC_FOLLOWER)
+  #define SYNC_LINK
+#endif
+
+#define SYNC_BAUD 115200
+
+void init_sync_link();
+void sync_update();
@@ -0,0 +1,14 @@
+#include "MIDIPlayer.h"
+#include "SongDSL.h"
+
+// Test patterns written as scores and built at compile time (see SongDSL.h),
+// played in TEST_MODE on a serial command (drsstc_firmware.ino)
+
+// One octave up and down on voice 0, for checking pitch and on-time steps
+SONG_DSL(TEST_SCALE,
+  "t120 l4 C4/8 D4/8 E4/8 F4/8 G4/8 A4/8 B4/8 C5/8 | B4/8 A4/8 G4/8 F4/8 E4/8 D4/8 C4/4 -/4");
+
+// Four-note chords, so voices 2 and 3 exercise the extended voice opcodes
+SONG_DSL(TEST_CHORDS,
+  "t90 l3 v0 C5 v1 G4 v2 E4 v3 C4/2 v0 - v1 - v2 - v3 -/4 "
+  "v0 D5 v1 A4 v2 F4 v3 D4/2 v0 - v1 - v2 - v3 -/4");
@@ -0,0 +1,98 @@
+#include "ThermalModel.h"
+
+#ifdef THERMAL_MODEL
+
+#include "StateMachine.h" // SERIAL_LOGGING flag
+#include "Timebase.h"
+#include "VoiceBackend.h"
+
+// Heat is counted in 0.5 us of on-time
+#define THERMAL_TICK_HALF_US (THERMAL_TICK_MS * 2000UL)
+// Heat at 100% load: the rated duty, held until the model settles
+#define THERMAL_LIMIT ((unsigned long)(THERMAL_RATED_DUTY * THERMAL_TICK_HALF_US * (1UL << THERMAL_DECAY_SHIFT)))
+// Throttle scale at 100% load, in 1/256
+#define THERMAL_MIN_SCALE (THERMAL_MIN_VOLUME * 256 / 100)
+
+// A voice's duty (1/65536) times the tick must fit 32 bits, as must the
+// heat of every voice at full duty
+static_assert(THERMAL_TICK_HALF_US <= 0x10000, "THERMAL_TICK_MS too long");
+static_assert((THERMAL_TICK_HALF_US * NUM_VOICES) >> (32 - THERMAL_DECAY_SHIFT) == 0,
+              "heat overflows at full duty: lower THERMAL_DECAY_SHIFT");
+static_assert(THERMAL_THROTTLE_LOAD < 100 && THERMAL_RESUME_LOAD < 100, "loads are below 100%");
+
+namespace {
+  unsigned long heat = 0;
+  unsigned long pulse_heat = 0;  // reported since the last tick
+  unsigned long last_tick_ms = 0;
+  uint8_t load = 0;
+  uint16_t scale = 256;          // throttle, in 1/256
+
+  // On-time of one tick, at the voices' current duty
+  unsigned long voice_heat() {
+    unsigned long on_time = 0;
+    for (uint8_t voice = 0; voice < NUM_VOICES; voice++)
+      on_time += ((unsigned long)voice_duty(voice) * THERMAL_TICK_HALF_US) >> 16;
+    return on_time;
+  }
+}
+
+void thermal_update() {
+  unsigned long timestamp = timebase_ms();
+  if (timestamp - last_tick_ms < THERMAL_TICK_MS) return;
+
+  // Ticks missed by a slow loop are caught up at the voices' current duty;
+  // the pulses go into the first
+  unsigned long on_time = voice_heat();
+  heat += pulse_heat;
+  pulse_heat = 0;
+  do {
+    heat += on_time;
+    heat -= heat >> THERMAL_DECAY_SHIFT;
+    last_tick_ms += THERMAL_TICK_MS;
+  } while (timestamp - last_tick_ms >= THERMAL_TICK_MS);
+
+  unsigned long percent = heat / (THERMAL_LIMIT / 100);
+  load = percent < 0xff ? percent : 0xff;
+  if (load <= THERMAL_THROTTLE_LOAD) {
+    scale = 256;
+  } else if (load >= 100) {
+    scale = THERMAL_MIN_SCALE;
+  } else {
+    scale = 256 - (uint16_t)(load - THERMAL_THROTTLE_LOAD) * (256 - THERMAL_MIN_SCALE)
+                  / (100 - THERMAL_THROTTLE_LOAD);
+  }
+}
+
+void thermal_add_pulse(uint16_t half_us) {
+  pulse_heat += half_us;
+}
+
+uint8_t thermal_load() {
+  return load;
+}
+
+bool thermal_cooled() {
+  return load <= THERMAL_RESUME_LOAD;
+}
+
+bool thermal_overheated() {
+  return load >= 100;
+}
+
+uint8_t thermal_throttle(uint8_t level) {
+  if (scale == 256 || !level) return level;
+  uint8_t scaled = ((uint16_t)level * scale) >> 8;
+  return scaled ? scaled : 1;
+}
+
+void thermal_report() {
+  #ifdef SERIAL_LOGGING
+    Serial.print(F("Bridge: "));
+    Serial.print(load);
+    Serial.print(F("% load, "));
+    Serial.print(((uint16_t)scale * 100) >> 8);
+    Serial.println(F("% volume"));
+  #endif
+}
+
+#endif
@@ -0,0 +1,58 @@
+#pragma once
+
+#include <arduino.h>
+
+// Thermal estimate of the bridge, for pacing the song rotation. The bridge
+// heats with the gate on-time it delivers and cools exponentially towards
+// ambient, which a leaky integrator of on-time models to first order. Once
+// per THERMAL_TICK_MS:
+//   heat += on-time delivered in the tick
+//   heat -= heat >> THERMAL_DECAY_SHIFT
+// a time constant of THERMAL_TICK_MS x 2^THERMAL_DECAY_SHIFT (131 s).
+// Held at a gate duty D, heat settles at D x tick x 2^THERMAL_DECAY_SHIFT;
+// the load is heat relative to where THERMAL_RATED_DUTY settles.
+//
+// The voices report their gate duty (on-time per pulse over the note
+// period). Pulse-train songs and single pulses report each pulse as it is
+// queued or sent.
+//
+// In the song rotation, the model replaces the fixed 10 s between songs and
+// the 10 minute music timeout (StateMachine.cpp):
+// - the next song starts once the load has cooled to THERMAL_RESUME_LOAD
+// - above THERMAL_THROTTLE_LOAD, note volumes and pulse widths are scaled
+//   down, to THERMAL_MIN_VOLUME at 100% load
+// - at 100% load the song is cut and LOG_THERMAL is logged
+// The rated duty and time constant are estimates for the TO-247 bridge on
+// its heatsink, to be calibrated against heatsink temperatures.
+#define THERMAL_MODEL
+#define THERMAL_TICK_MS       32
+#define THERMAL_DECAY_SHIFT   12    // 4096 ticks, 131 s time constant
+#define THERMAL_RATED_DUTY    0.015 // gate duty the bridge can hold indefinitely
+#define THERMAL_RESUME_LOAD   50    // percent
+#define THERMAL_THROTTLE_LOAD 80    // percent
+#define THERMAL_MIN_VOLUME    25    // percent of the song's volume, at 100% load
+
+#ifdef THERMAL_MODEL
+// Integrates the voices' duty and cools the model; call from the main loop
+void thermal_update();
+// On-time of a pulse played outside the voices, in 0.5 us (pulse-train ticks)
+void thermal_add_pulse(uint16_t half_us);
+
+// Percent of the rated heat, saturating at 255
+uint8_t thermal_load();
+bool thermal_cooled();
+bool thermal_overheated();
+// Scales a note volume or pulse width by the throttle; never to 0
+uint8_t thermal_throttle(uint8_t level);
+
+// Load and throttle, for the serial heartbeat
+void thermal_report();
+#else
+inline void thermal_update() {}
+inline void thermal_add_pulse(uint16_t half_us) {}
+inline uint8_t thermal_load() { return 0; }
+inline bool thermal_cooled() { return true; }
+inline bool thermal_overheated() { return false; }
+inline uint8_t thermal_throttle(uint8_t level) { return level; }
+inline void thermal_report() {}
+#endif
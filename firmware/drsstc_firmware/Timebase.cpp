@@ -0,0 +1,61 @@
+#include "Timebase.h"
+#include <avr/wdt.h>
+#include "LoopMonitor.h"
+
+#ifdef TIMER0_VOICE
+
+unsigned long timebase_us() {
+  return voice_clock_us();
+}
+
+unsigned long timebase_ms() {
+  return voice_clock_ms();
+}
+
+#else
+
+// Maintained by the Timer0 overflow ISR in the Arduino core (wiring.c)
+extern volatile unsigned long timer0_overflow_count;
+extern volatile unsigned long timer0_millis;
+
+unsigned long timebase_us() {
+  unsigned long overflows;
+  uint8_t count;
+  do {
+    overflows = timer0_overflow_count;
+    count = TCNT0;
+  } while (overflows != timer0_overflow_count);
+  // Overflow not yet serviced, when called with interrupts disabled
+  if ((TIFR0 & _BV(TOV0)) && count < 255) overflows++;
+  return ((overflows << 8) | count) * TIMEBASE_US_PER_TICK;
+}
+
+unsigned long timebase_ms() {
+  unsigned long ms;
+  do {
+    ms = timer0_millis;
+  } while (ms != timer0_millis);
+  return ms;
+}
+
+#endif
+
+namespace {
+  unsigned long epoch = 0;
+  unsigned long last_us = 0;
+}
+
+uint64_t timebase_us64() {
+  unsigned long us = timebase_us();
+  if (us < last_us) epoch++;
+  last_us = us;
+  return ((uint64_t)epoch << 32) | us;
+}
+
+// A deliberate wait, not a stall: it feeds the loop watchdog and is not
+// held to the loop deadline (LoopMonitor.h)
+void timebase_delay_ms(unsigned long ms) {
+  const unsigned long start = timebase_ms();
+  while (timebase_ms() - start < ms) wdt_reset();
+  loop_monitor_restart();
+}
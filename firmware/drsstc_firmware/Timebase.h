@@ -0,0 +1,40 @@
+#pragma once
+
+#include <arduino.h>
+#include "VoiceBackend.h"
+
+// Timebase for the player, metronome and state machine, read from Timer0
+// as Arduino configures it (64x prescale, overflow ISR every 1.024 ms).
+//
+// Resolution: 4 us, one Timer0 count. Finer ticks would need a faster Timer0
+// prescaler, which would break millis(), delay() and the NeoPixel latch.
+// Call cost: budget_check.py bounds timebase_us() at 100 cycles worst case,
+// with one retry. Unlike micros(), reads never disable interrupts; a read
+// that races the overflow ISR is simply retried.
+//
+// With TIMER0_VOICE, Timer0 plays a voice and the clocks are counted by its
+// ISR instead, one sub-period at a time (1 us resolution). Masking
+// interrupts for longer than a sub-period (64 us) loses time: a NeoPixel
+// show() masks them for about 0.5 ms per 16-LED frame.
+//
+// Both clocks wrap at 32 bits (71.6 minutes for us, 49.7 days for ms).
+// Compare timestamps only through their difference, e.g.
+// (long)(now - mark) >= 0, which stays correct across the wrap for any
+// interval shorter than half the range.
+//
+// timebase_us64() extends the us clock past 32 bits at the same resolution,
+// by counting its wraps in a 32-bit epoch. It must run at least once per
+// wrap (the serial heartbeat calls it every 5 s), and only from the main
+// loop, never from an ISR.
+#ifdef TIMER0_VOICE
+  #define TIMEBASE_US_PER_TICK 1
+#else
+  #define TIMEBASE_US_PER_TICK 4
+#endif
+
+unsigned long timebase_us();
+unsigned long timebase_ms();
+uint64_t timebase_us64();
+
+// Busy wait on timebase_ms(); delay() depends on the core's Timer0 ISR
+void timebase_delay_ms(unsigned long ms);
@@ -0,0 +1,92 @@
+#pragma once
+
+#include <arduino.h>
+
+// Hardware voices: each voice is one timer generating the gate pulse train
+// for one note. The backend is selected at compile time from the target MCU;
+// define VOICE_BACKEND_MOCK to build the host mock instead.
+//
+// On the ATmega328, TIMER0_VOICE reclaims Timer0 from the Arduino core as a
+// third voice on PWM_3. The core's overflow ISR is masked, so millis(),
+// micros() and delay() stop advancing; the Timebase clocks are then kept by
+// the Timer0 voice ISR instead.
+//#define TIMER0_VOICE
+
+// NOTE_COMPENSATION evens out power across the range. At a fixed on-time,
+// the power a note puts into the coil grows with its pulse rate (one pulse
+// per period), so melodies get louder and hotter as they climb. With it, the
+// backend scales each note's on-time by a gain from a table built at compile
+// time:
+//   gain = NOTE_GAIN_PER_OCTAVE ^ ((NOTE_GAIN_REF_NOTE - note) / 12)
+// clamped to NOTE_GAIN_FLOOR..NOTE_GAIN_CEILING. A factor of 2 per octave
+// holds average power (on-time x pulse rate) constant; a factor between 1
+// and 2 keeps part of the climb, for a more even loudness by ear. The
+// ceiling limits how much harder low notes are pushed, and is checked
+// against the longest on-time the 8-bit timers can gate. The floor must be
+// at least 1: volume 1 targets a coil half-cycle, and any less would put the
+// low volumes of the top notes under what the board's full-cycle switching
+// resolves, so notes above the reference keep their encoded on-time.
+//#define NOTE_COMPENSATION
+#define NOTE_GAIN_REF_NOTE   60   // C4 plays the encoded on-time
+#define NOTE_GAIN_PER_OCTAVE 2.0
+#define NOTE_GAIN_CEILING    2.0
+#define NOTE_GAIN_FLOOR      1.0
+
+// SONG_BENCHMARK times the decoding of every song at startup and prints it
+// over SERIAL_LOGGING (see benchmark_song_decode). It builds the mock
+// backend, so no gate is ever driven and Timer1 is free to count cycles.
+//#define SONG_BENCHMARK
+#ifdef SONG_BENCHMARK
+  #ifdef TIMER0_VOICE
+    #error "SONG_BENCHMARK needs the core's Timer0 for the timebase"
+  #endif
+  #define VOICE_BACKEND_MOCK
+#endif
+
+// Furthest a note may play from equal temperament (A4 = 440 Hz), over the
+// dither pattern and over any 50 ms: host_sim's pitch-test measures every
+// note on every voice from the gate edges and fails past it.
+#define PITCH_TOLERANCE_CENTS 2.0
+
+#if defined(VOICE_BACKEND_MOCK)
+  #ifndef MOCK_NUM_VOICES
+    #define MOCK_NUM_VOICES 2
+  #endif
+  #define NUM_VOICES MOCK_NUM_VOICES
+#elif defined(__AVR_ATmega2560__)
+  #define NUM_VOICES 4  // Timers 1, 3, 4, 5 (pins 11, 5, 6, 46)
+#elif defined(TIMER0_VOICE)
+  #define NUM_VOICES 3  // Timer1 (pin 9), Timer2 (pin 3), Timer0 (pin 5)
+#else
+  #define NUM_VOICES 2  // Timer1 (pin 9), Timer2 (pin 3)
+#endif
+
+void setup_voices();
+void voice_note_on(uint8_t voice, uint8_t note, uint8_t volume);
+void voice_off(uint8_t voice);
+uint8_t voice_pin(uint8_t voice);
+
+// Gate on-time per pulse over the note period, in 1/65536; 0 while the
+// voice is silent. For the thermal model (ThermalModel.h).
+uint16_t voice_duty(uint8_t voice);
+
+// Stops every voice timer with its gate output low; safe from any ISR (the
+// loop watchdog's). Only setup_voices() restarts them.
+void voice_kill_all();
+
+// Router hint: log2 of the gate on-time step, in CPU cycles, when the voice
+// plays the note; VOICE_CANNOT_PLAY outside the voice's range
+#define VOICE_CANNOT_PLAY 0xff
+uint8_t voice_note_cost(uint8_t voice, uint8_t note);
+
+#if defined(TIMER0_VOICE) && !defined(VOICE_BACKEND_MOCK)
+  // Time counted by the Timer0 voice ISR, for Timebase
+  unsigned long voice_clock_us();
+  unsigned long voice_clock_ms();
+#endif
+
+#ifdef VOICE_BACKEND_MOCK
+  // Last note and volume set on each voice; 0 when silent
+  extern uint8_t mock_voice_note[NUM_VOICES];
+  extern uint8_t mock_voice_volume[NUM_VOICES];
+#endif
@@ -0,0 +1,746 @@
+#include "VoiceBackend.h"
+
+#ifndef VOICE_BACKEND_MOCK
+
+#include "pin_definitions.h"
+
+// Coil frequency = 250 kHz
+// Arduino frequency = 16 MHz = 64 * (250 kHz)
+// Coil half-cycle = 32 Arduino clock cycles
+#define COIL_FREQ_CYCLES_HALF 32
+#define MAX_VOLUME 10
+
+// Each timer is described by a traits struct, so register addresses, counter
+// width, prescaler table and MIDI note range are all resolved at compile time.
+// Voice<Timer> is the note on/off code for one timer; the 16-bit timers share
+// the primary template and the 8-bit timers (Timer2, and Timer0 with
+// TIMER0_VOICE) share the Voice8 template.
+//
+// Approximate cycle counts (16 MHz, counted from the expected -Os code):
+//   Voice<16-bit>::note_on  ~90 cycles (+5 per prescaler shift bit, at most 6),
+//                           plus waiting out a pulse in progress: at most
+//                           ~480 (a 20 us on-time and the wrap guard)
+//   Voice8<*>::note_on      ~90 cycles (+5 per period shift bit, at most 11)
+//   Voice<16-bit>::off      ~25 cycles, plus the same wait
+//   TIMERn_COMPA_vect       ~30 cycles, twice per period of notes 21-22 on a
+//                           16-bit voice, under 0.01% CPU
+//   Voice8<*>::off           ~6 cycles
+//   TIMER2_OVF_vect         ~55 cycles per sub-period while a note plays; at
+//                           most ~5.5% CPU (one ISR per 64 us, or per period
+//                           at the top notes, 12.5 kHz)
+//   TIMER0_COMPA_vect       ~80 cycles per sub-period, always running: ~4%
+//                           CPU when silent (one ISR per 127.5 us), at most
+//                           ~8% while a note plays
+// The previous shared path divided by the prescaler (~200 cycles) and called
+// digitalWrite() (~70 cycles) on every note.
+
+namespace {
+  // Prescaler values are powers of two; tables hold log2(prescale) indexed by CS bits - 1
+  const uint8_t PRESCALE16_SHIFTS[] = {0, 3, 6, 8, 10};  // 1, 8, 64, 256, 1024
+
+  #define TIMER16_MIDI_OFFSET 21
+  // Lookup table in Flash memory for 107 MIDI notes
+  const uint16_t timer16_frequencies[] PROGMEM = 
+    {9090,8580,64792,                                                            // octave 0
+     61155,57723,54483,51425,48539,45814,43243,40816,38525,36363,34322,32395,
+     30577,28861,27241,25712,24269,22907,21621,20407,19262,18181,17160,16197,
+     15288,14430,13620,12855,12134,11453,10810,10203,9630,9090,8580,64792,
+     61155,57723,54483,51425,48539,45814,43243,40816,38525,36363,34322,32395,
+     30577,28861,27241,25712,24269,22907,21621,20407,19262,18181,17160,16197,
+     15288,14430,13620,12855,12134,11453,10810,10203,9630,9090,8580,8098,
+     7644,7214,6809,6427,6066,5726,5404,5101,4815,4544,4289,4049,
+     3821,3607,3404,3213,3033,2862,2702,2550,2407,2272,2144,2024,
+     1910,1803,1702,1606,1516,1431,1350,1275};                                   // octave 9
+     
+  // Prescaler of a note's timer16_frequencies entry. Notes 21 and 22 need a
+  // TOP above 65535 at 8x, so their entries are at 64x; the 16-bit timers
+  // still play them at 8x, for 0.5 us on-time steps (timer16_split()).
+  inline uint8_t timer16_prescale_cs_bits(uint8_t midi_note) {
+    if (midi_note <= 22) {
+      return 3;
+    } else if (midi_note <= 58) {
+      return 2;
+    } else {
+      return 1;
+    }
+  }
+
+  // Notes a 16-bit timer plays at 8x over two timer periods of half the note
+  // period each, TOP = 4 x (64x TOP + 1) - 1. The channel A match ISR
+  // disconnects the output after the first period's pulse and connects it
+  // again at the same count of the second, with the latch low, so only every
+  // other BOTTOM starts a pulse.
+  inline bool timer16_split(uint8_t midi_note) {
+    return midi_note <= 22;
+  }
+
+  // 8-bit timers always run at 8x prescale, so every note gets the same
+  // 0.5 us on-time resolution. The note period, taken from Timer1's table with
+  // an 8-bit fraction, is split into 128-count (64 us) sub-periods counted by
+  // the timer's ISR. The first sub-period carries the remainder of the period
+  // and the gate pulse; the others are silent. The ISR dithers the first
+  // sub-period between TOP and TOP + 1 so the average period is exact.
+  #define TIMER8_CS_BITS              2  // 8x
+  #define TIMER8_PRESCALE_SHIFT       3
+  #define TIMER8_SUB_PERIOD_SHIFT     7  // 128 counts = 64 us
+  #define TIMER8_SUB_PERIOD_TOP       ((1 << TIMER8_SUB_PERIOD_SHIFT) - 1)
+  // Longest sub-period that can still be silent
+  #define TIMER8_IDLE_TOP             254
+  // OCRnB above TOP never matches, so the inverted output stays low
+  #define TIMER8_SILENT_DUTY          0xff
+
+  #ifdef NOTE_COMPENSATION
+    // On-time per volume level in CPU cycles, COIL_FREQ_CYCLES_HALF x gain,
+    // for each note from TIMER16_MIDI_OFFSET up. Built from the NOTE_GAIN_*
+    // settings (VoiceBackend.h) by constexpr functions; C++11 has no
+    // constexpr pow, so the semitone ratio is a Newton 12th root.
+    constexpr double power(double x, uint8_t n) {
+      return n ? x * power(x, n - 1) : 1.0;
+    }
+    constexpr double root12(double x, double y = 1.0, uint8_t steps = 16) {
+      return steps ? root12(x, (11 * y + x / power(y, 11)) / 12, steps - 1) : y;
+    }
+    constexpr double note_gain(int semitones_below_ref) {
+      return semitones_below_ref >= 0
+        ? power(root12(NOTE_GAIN_PER_OCTAVE), semitones_below_ref)
+        : 1.0 / power(root12(NOTE_GAIN_PER_OCTAVE), -semitones_below_ref);
+    }
+    constexpr double clamp_gain(double gain) {
+      return gain > NOTE_GAIN_CEILING ? NOTE_GAIN_CEILING : gain < NOTE_GAIN_FLOOR ? NOTE_GAIN_FLOOR : gain;
+    }
+    constexpr uint8_t on_time_step_cycles(uint8_t note) {
+      return COIL_FREQ_CYCLES_HALF * clamp_gain(note_gain(NOTE_GAIN_REF_NOTE - note)) + 0.5;
+    }
+
+    static_assert(COIL_FREQ_CYCLES_HALF * NOTE_GAIN_CEILING < 256, "NOTE_GAIN_CEILING overflows the table");
+    static_assert(COIL_FREQ_CYCLES_HALF * NOTE_GAIN_FLOOR >= COIL_FREQ_CYCLES_HALF,
+                  "NOTE_GAIN_FLOOR puts volume 1 under a coil half-cycle");
+
+    template <uint8_t... N>
+    struct OnTimeSteps {
+      static const uint8_t table[sizeof...(N)];
+    };
+    template <uint8_t... N>
+    const uint8_t OnTimeSteps<N...>::table[sizeof...(N)] PROGMEM =
+      {on_time_step_cycles(N + TIMER16_MIDI_OFFSET)...};
+
+    // OnTimeSteps<0, 1, ..., COUNT - 1>
+    template <uint8_t COUNT, uint8_t... N>
+    struct MakeOnTimeSteps : MakeOnTimeSteps<COUNT - 1, COUNT - 1, N...> {};
+    template <uint8_t... N>
+    struct MakeOnTimeSteps<0, N...> { typedef OnTimeSteps<N...> type; };
+
+    typedef MakeOnTimeSteps<128 - TIMER16_MIDI_OFFSET>::type on_time_steps;
+    #define MAX_ON_TIME_STEP (uint8_t)(COIL_FREQ_CYCLES_HALF * NOTE_GAIN_CEILING + 0.5)
+
+    inline uint8_t on_time_step(uint8_t note) {
+      return pgm_read_byte(&on_time_steps::table[note - TIMER16_MIDI_OFFSET]);
+    }
+  #else
+    #define MAX_ON_TIME_STEP COIL_FREQ_CYCLES_HALF
+
+    inline uint8_t on_time_step(uint8_t note) {
+      return COIL_FREQ_CYCLES_HALF;
+    }
+  #endif
+
+  // Gate on-time in timer counts, minus one for OCRnx
+  // Logic on the board forces switching on the full cycle only; so a volume level of 1 targets a 0.5 cycle ON time
+  inline uint16_t on_time_counts(uint8_t volume, uint8_t note, uint8_t prescale_shift) {
+    uint16_t counts = (uint16_t)min(volume, MAX_VOLUME) * on_time_step(note) >> prescale_shift;
+    return (counts > 0) ? counts - 1 : 0;
+  }
+
+  // 16-bit timers: fast PWM mode with ICRn as TOP, gating through channel A
+  #define TIMER16_TRAITS(n, port_reg, port_bit, pin_number) \
+    struct Timer##n { \
+      typedef uint16_t counter_t; \
+      static volatile uint8_t& tccra() { return TCCR##n##A; } \
+      static volatile uint8_t& tccrb() { return TCCR##n##B; } \
+      static volatile uint16_t& duty() { return OCR##n##A; } \
+      static volatile uint16_t& top() { return ICR##n; } \
+      static volatile uint16_t& tcnt() { return TCNT##n; } \
+      static volatile uint8_t& timsk() { return TIMSK##n; } \
+      static volatile uint8_t& tifr() { return TIFR##n; } \
+      static const uint8_t INT_MASK = _BV(OCIE##n##A); \
+      static const uint8_t INT_FLAG = _BV(OCF##n##A); \
+      static volatile uint8_t& port() { return port_reg; } \
+      static const uint8_t PORT_MASK = _BV(port_bit); \
+      static const uint8_t PIN = pin_number; \
+    };
+
+  #if defined(__AVR_ATmega2560__)
+    TIMER16_TRAITS(1, PORTB, PORTB5, 11)
+    TIMER16_TRAITS(3, PORTE, PORTE3, 5)
+    TIMER16_TRAITS(4, PORTH, PORTH3, 6)
+    TIMER16_TRAITS(5, PORTL, PORTL3, 46)
+  #else
+    TIMER16_TRAITS(1, PORTB, PORTB1, PWM_1)
+
+    // 8-bit timers: fast PWM mode with OCRnA as TOP, gating through channel B.
+    // Timer0 and Timer2 have the same control register layout. A CLOCK timer
+    // also keeps the Timebase clocks, so its ISR never stops.
+    struct Timer2 {
+      typedef uint8_t counter_t;
+      static volatile uint8_t& tccra() { return TCCR2A; }
+      static volatile uint8_t& tccrb() { return TCCR2B; }
+      static volatile uint8_t& duty() { return OCR2B; }
+      static volatile uint8_t& top() { return OCR2A; }
+      static volatile uint8_t& timsk() { return TIMSK2; }
+      static volatile uint8_t& tifr() { return TIFR2; }
+      static const uint8_t INT_MASK = _BV(TOIE2);  // overflow, at TOP
+      static const uint8_t INT_FLAG = _BV(TOV2);
+      static const bool CLOCK = false;
+      static const uint8_t PIN = PWM_2;
+    };
+
+    #ifdef TIMER0_VOICE
+    // The core defines TIMER0_OVF_vect, so Timer0 interrupts on the channel A
+    // match instead; with OCR0A as TOP it is set at the same count
+    struct Timer0 {
+      typedef uint8_t counter_t;
+      static volatile uint8_t& tccra() { return TCCR0A; }
+      static volatile uint8_t& tccrb() { return TCCR0B; }
+      static volatile uint8_t& duty() { return OCR0B; }
+      static volatile uint8_t& top() { return OCR0A; }
+      static volatile uint8_t& timsk() { return TIMSK0; }
+      static volatile uint8_t& tifr() { return TIFR0; }
+      static const uint8_t INT_MASK = _BV(OCIE0A);
+      static const uint8_t INT_FLAG = _BV(OCF0A);
+      static const bool CLOCK = true;
+      static const uint8_t PIN = PWM_3;
+    };
+
+    // Timebase kept by the Timer0 ISR, in whole us plus a half-count carry.
+    // active_top is the TOP of the running sub-period, next_top the value
+    // buffered for the one after it.
+    volatile unsigned long clock_us = 0;
+    volatile unsigned long clock_ms = 0;
+    uint16_t clock_us_in_ms = 0;
+    volatile uint8_t clock_half = 0;
+    volatile uint8_t clock_active_top = TIMER8_IDLE_TOP;
+    uint8_t clock_next_top = TIMER8_IDLE_TOP;
+
+    // Called at each Timer0 TOP, after the counter has wrapped and latched
+    // the buffered TOP for the next sub-period
+    inline void clock_tick() {
+      uint16_t halves = clock_active_top + 1 + clock_half;
+      clock_active_top = clock_next_top;
+      clock_half = halves & 1;
+      uint8_t us = halves >> 1;
+      clock_us += us;
+      clock_us_in_ms += us;
+      if (clock_us_in_ms >= 1000) {
+        clock_us_in_ms -= 1000;
+        clock_ms++;
+      }
+    }
+    #endif
+  #endif
+
+  // A gate pin that is also another output would be cut by its
+  // digitalWrite() (the core's turnOffPWM() clears the channel) or drive it
+  constexpr bool gate_pin_free(uint8_t pin) {
+    return pin != LED1 && pin != LED2 && pin != NEOPIXEL && pin != OCD_DETECT;
+  }
+  #if defined(__AVR_ATmega2560__)
+    static_assert(gate_pin_free(Timer1::PIN) && gate_pin_free(Timer3::PIN) &&
+                  gate_pin_free(Timer4::PIN) && gate_pin_free(Timer5::PIN),
+                  "A voice gate pin is also an LED, NeoPixel or OCD pin");
+  #else
+    static_assert(gate_pin_free(Timer1::PIN) && gate_pin_free(Timer2::PIN),
+                  "A voice gate pin is also an LED, NeoPixel or OCD pin");
+    #ifdef TIMER0_VOICE
+    static_assert(gate_pin_free(Timer0::PIN), "A voice gate pin is also an LED, NeoPixel or OCD pin");
+    #endif
+  #endif
+
+  // Cycles from end_pulse()'s last counter read to its caller's register
+  // writes, with interrupts masked
+  #define TIMER16_WRAP_GUARD_CYCLES 16
+
+  template <class Timer>
+  struct Voice {
+    // Gate on-time and period of the playing note, in timer counts; kept
+    // here, as Timer1's registers also play pulse trains
+    static uint16_t gate_on;
+    static uint16_t gate_period;
+    // Playing a timer16_split() note, with the match interrupt enabled
+    static bool split;
+
+    static inline void set_prescale(uint8_t CS_bits) {
+      // WGMn3 + WGMn2 (0x18) = fast PWM mode, ICRn as TOP
+      Timer::tccrb() = _BV(WGM13) | _BV(WGM12) | CS_bits;
+    }
+
+    static inline void setup() {
+      pinMode(Timer::PIN, OUTPUT);
+      digitalWrite(Timer::PIN, LOW);
+      // WGMn1  (0x02) = fast PWM mode, ICRn as TOP
+      Timer::tccra() = _BV(WGM11);
+      set_prescale(1);
+      Timer::duty() = 0;
+      Timer::top() = 65535; // Lowest frequency at 1x prescale = 244 Hz
+      gate_on = 0;
+      split = false;
+    }
+
+    // Called with interrupts masked. Waits until the pulse in progress is
+    // over and the counter is not about to wrap and start the next one, so
+    // the output compare latch is low through the caller's next register
+    // writes. Disconnected mid-pulse, the latch would stay high and drive the
+    // pin as soon as the output connects again. PulseTrain waits out its
+    // pulses the same way.
+    static inline void end_pulse() {
+      if (!gate_on) return;
+      uint8_t shift = PRESCALE16_SHIFTS[(Timer::tccrb() & 0x07) - 1];
+      uint16_t last = gate_period - 2 - (TIMER16_WRAP_GUARD_CYCLES >> shift);
+      uint16_t count;
+      do {
+        count = Timer::tcnt();
+      } while (count < gate_on || count > last);
+    }
+
+    static inline void off() {
+      uint8_t sreg = SREG;
+      cli();
+      end_pulse();
+      Timer::timsk() &= ~Timer::INT_MASK;
+      Timer::tccra() = _BV(WGM11);
+      Timer::port() &= ~Timer::PORT_MASK;
+      gate_on = 0;
+      split = false;
+      SREG = sreg;
+    }
+
+    // Stopped and disconnected at once, so the pin follows its cleared port
+    // bit. A pulse cut here leaves the latch high; the watchdog reset that
+    // follows (LoopMonitor.cpp) clears it.
+    static inline void kill() {
+      Timer::timsk() = 0;
+      Timer::tccrb() = 0;
+      Timer::tccra() = 0;
+      Timer::port() &= ~Timer::PORT_MASK;
+      gate_on = 0;
+      split = false;
+    }
+
+    static inline uint8_t play_cs_bits(uint8_t note) {
+      return timer16_split(note) ? 2 : timer16_prescale_cs_bits(note);
+    }
+
+    static inline uint8_t note_cost(uint8_t note) {
+      if (note < TIMER16_MIDI_OFFSET) return VOICE_CANNOT_PLAY;
+      return PRESCALE16_SHIFTS[play_cs_bits(note) - 1];
+    }
+
+    // Volume is interpreted as a number of cycles
+    static inline void note_on(uint8_t note, uint8_t volume) {
+      if (note < TIMER16_MIDI_OFFSET) return;
+      bool split_note = timer16_split(note);
+      uint8_t cs_bits = play_cs_bits(note);
+      typename Timer::counter_t tgt_duty = on_time_counts(volume, note, PRESCALE16_SHIFTS[cs_bits - 1]);
+      typename Timer::counter_t freq = pgm_read_word(&timer16_frequencies[note - TIMER16_MIDI_OFFSET]);
+      // Half the 64x period, in 8x counts
+      if (split_note) freq = ((freq + 1) << 2) - 1;
+      if (tgt_duty >= freq) tgt_duty = freq - 1;
+
+      // The note restarts the period. ICRn is not double buffered and a new
+      // prescaler applies at once, so either changed mid-pulse would run the
+      // pulse on to a later match. Stopped at TOP, the next count is BOTTOM,
+      // which starts the first pulse and latches the buffered duty.
+      uint8_t sreg = SREG;
+      cli();
+      end_pulse();
+      Timer::timsk() &= ~Timer::INT_MASK;
+      Timer::tccrb() = _BV(WGM13) | _BV(WGM12);
+      Timer::top() = freq;
+      Timer::tcnt() = freq;
+      Timer::duty() = tgt_duty;
+      gate_on = tgt_duty + 1;
+      gate_period = freq + 1;
+      split = split_note;
+      if (split_note) {
+        // A stale flag would toggle the output before the first pulse
+        Timer::tifr() = Timer::INT_FLAG;
+        Timer::timsk() |= Timer::INT_MASK;
+      }
+
+      // COMnA1 (0x80) = non-inverted PWM output to channel A
+      // WGMn1  (0x02) = fast PWM mode, ICRn as TOP
+      Timer::tccra() = _BV(COM1A1) | _BV(WGM11);
+      set_prescale(cs_bits);
+      SREG = sreg;
+    }
+
+    static inline uint16_t gate_duty() {
+      if (!gate_on) return 0;
+      uint16_t duty = ((uint32_t)gate_on << 16) / gate_period;
+      return split ? duty >> 1 : duty;
+    }
+
+    // Called from the channel A match ISR of a split note: the end of the
+    // pulse, or the same count in the silent period
+    static inline void compare_match() {
+      Timer::tccra() ^= _BV(COM1A1);
+    }
+  };
+
+  template <class Timer> uint16_t Voice<Timer>::gate_on = 0;
+  template <class Timer> uint16_t Voice<Timer>::gate_period = 0;
+  template <class Timer> bool Voice<Timer>::split = false;
+
+  #if !defined(__AVR_ATmega2560__)
+  // 8-bit timers run with their output inverted, so each pulse ends at TOP
+  // and both its start and the period are set by double-buffered registers.
+  // Notes and silence only take effect at a BOTTOM, never mid-pulse, and the
+  // output never needs to be disconnected.
+  //
+  // Timer2 writes the registers directly and masks its ISR while silent. A
+  // CLOCK timer leaves every register write to its ISR, which then always
+  // knows the TOP of each sub-period it counts; a note starts at the next
+  // sub-period instead, at most 128 us later.
+  // The pulse must fit in the first sub-period, whose TOP is at least the
+  // sub-period TOP
+  static_assert((MAX_VOLUME * MAX_ON_TIME_STEP >> TIMER8_PRESCALE_SHIFT) <= TIMER8_SUB_PERIOD_TOP,
+                "on-time too long for the 8-bit timers: lower NOTE_GAIN_CEILING");
+
+  template <class Timer>
+  struct Voice8 {
+    // State shared with the timer's ISR
+    static volatile uint8_t top;           // first sub-period, without dither
+    static volatile uint8_t pulse;         // on-time counts
+    static volatile uint8_t fraction;
+    static uint8_t phase;
+    static volatile uint16_t sub_periods;  // per note period, 0 when silent
+    static uint16_t sub_count;
+
+    static inline void set_prescale(uint8_t CS_bits) {
+      // WGMn2 (0x08) = fast PWM mode, OCRnA as TOP
+      Timer::tccrb() = _BV(WGM22) | CS_bits;
+    }
+
+    static inline void setup() {
+      pinMode(Timer::PIN, OUTPUT);
+      digitalWrite(Timer::PIN, LOW);
+      set_prescale(TIMER8_CS_BITS);
+      Timer::duty() = TIMER8_SILENT_DUTY;
+      Timer::top() = TIMER8_IDLE_TOP;
+      sub_periods = 0;
+      // COMnB1 + COMnB0 (0x30) = inverted PWM output to channel B
+      // WGMn1 + WGMn0 (0x03) = fast PWM mode, OCRnA as TOP
+      Timer::tccra() = _BV(COM2B1) | _BV(COM2B0) | _BV(WGM21) | _BV(WGM20);
+      // Also masks the core's overflow ISR on Timer0
+      Timer::timsk() = Timer::CLOCK ? Timer::INT_MASK : 0;
+    }
+
+    static inline void off() {
+      if (Timer::CLOCK) {
+        uint8_t sreg = SREG;
+        cli();
+        sub_periods = 0;
+        sub_count = 1;
+        SREG = sreg;
+      } else {
+        Timer::timsk() = 0;
+        sub_periods = 0;
+        // A dithered TOP can reach 255, where the silent duty would still match
+        Timer::top() = TIMER8_SUB_PERIOD_TOP;
+        Timer::duty() = TIMER8_SILENT_DUTY;
+      }
+    }
+
+    // Stopped and disconnected; setup() left the port bit low. A CLOCK
+    // timer stops the Timebase clocks with it.
+    static inline void kill() {
+      Timer::timsk() = 0;
+      Timer::tccrb() = 0;
+      Timer::tccra() = 0;
+      sub_periods = 0;
+    }
+
+    static inline uint8_t note_cost(uint8_t note) {
+      return note < TIMER16_MIDI_OFFSET ? VOICE_CANNOT_PLAY : TIMER8_PRESCALE_SHIFT;
+    }
+
+    static inline void note_on(uint8_t note, uint8_t volume) {
+      if (note < TIMER16_MIDI_OFFSET) return;
+      // Period in 1/256 counts at 8x, the same as Timer1 plays (TOP + 1 counts at its prescaler)
+      uint8_t cs_bits = timer16_prescale_cs_bits(note);
+      uint32_t period = ((uint32_t)pgm_read_word(&timer16_frequencies[note - TIMER16_MIDI_OFFSET]) + 1)
+        << (PRESCALE16_SHIFTS[cs_bits - 1] + 8 - TIMER8_PRESCALE_SHIFT);
+      uint8_t first_top = TIMER8_SUB_PERIOD_TOP + ((period >> 8) & TIMER8_SUB_PERIOD_TOP);
+      // Inverted, the output is high from the count after OCRnB to TOP
+      uint8_t on_counts = on_time_counts(volume, note, TIMER8_PRESCALE_SHIFT) + 1;
+
+      if (Timer::CLOCK) {
+        uint8_t sreg = SREG;
+        cli();
+        pulse = on_counts;
+        fraction = period;
+        sub_periods = period >> (8 + TIMER8_SUB_PERIOD_SHIFT);
+        top = first_top;
+        // The pulse sub-period is the next one the ISR writes
+        sub_count = 1;
+        SREG = sreg;
+      } else {
+        Timer::timsk() = 0;
+        pulse = on_counts;
+        fraction = period;
+        sub_periods = period >> (8 + TIMER8_SUB_PERIOD_SHIFT);
+        sub_count = sub_periods;
+        top = first_top;
+
+        // A stale interrupt flag would run the ISR before the first period starts
+        Timer::tifr() = Timer::INT_FLAG;
+        Timer::top() = first_top;
+        Timer::duty() = first_top - on_counts;
+        Timer::timsk() = Timer::INT_MASK;
+      }
+    }
+
+    // The period is sub_periods whole sub-periods plus the first one's
+    // remainder over TOP; the dither is under a count
+    static inline uint16_t gate_duty() {
+      uint16_t periods = sub_periods;
+      if (!periods) return 0;
+      uint32_t period = ((uint32_t)periods << TIMER8_SUB_PERIOD_SHIFT) + top - TIMER8_SUB_PERIOD_TOP;
+      return ((uint32_t)pulse << 16) / period;
+    }
+
+    // Called from the ISR at each TOP. OCRnA and OCRnB are double buffered,
+    // so the values written here set the following period.
+    static inline void sub_period() {
+      uint8_t next_top;
+      if (--sub_count == 0) {
+        sub_count = sub_periods;
+        if (Timer::CLOCK && sub_count == 0) {
+          next_top = TIMER8_IDLE_TOP;
+          Timer::duty() = TIMER8_SILENT_DUTY;
+        } else {
+          // Next is the pulse sub-period; the accumulator carry spreads
+          // fraction/256 long ones evenly over the pattern
+          uint8_t next_phase = phase + fraction;
+          next_top = top + (next_phase < phase ? 1 : 0);
+          phase = next_phase;
+          Timer::duty() = next_top - pulse;
+        }
+      } else if (sub_count == sub_periods - 1) {
+        next_top = TIMER8_SUB_PERIOD_TOP;
+        Timer::duty() = TIMER8_SILENT_DUTY;
+      } else {
+        return;
+      }
+      Timer::top() = next_top;
+      #ifdef TIMER0_VOICE
+      if (Timer::CLOCK) clock_next_top = next_top;
+      #endif
+    }
+  };
+
+  template <class Timer> volatile uint8_t Voice8<Timer>::top = TIMER8_IDLE_TOP;
+  template <class Timer> volatile uint8_t Voice8<Timer>::pulse = 0;
+  template <class Timer> volatile uint8_t Voice8<Timer>::fraction = 0;
+  template <class Timer> uint8_t Voice8<Timer>::phase = 0;
+  template <class Timer> volatile uint16_t Voice8<Timer>::sub_periods = 0;
+  template <class Timer> uint16_t Voice8<Timer>::sub_count = 0;
+
+  template <>
+  struct Voice<Timer2> : Voice8<Timer2> {};
+  #ifdef TIMER0_VOICE
+  template <>
+  struct Voice<Timer0> : Voice8<Timer0> {};
+  #endif
+  #endif
+} // namespace
+
+#if defined(__AVR_ATmega2560__)
+ISR(TIMER1_COMPA_vect) {
+  Voice<Timer1>::compare_match();
+}
+
+ISR(TIMER3_COMPA_vect) {
+  Voice<Timer3>::compare_match();
+}
+
+ISR(TIMER4_COMPA_vect) {
+  Voice<Timer4>::compare_match();
+}
+
+ISR(TIMER5_COMPA_vect) {
+  Voice<Timer5>::compare_match();
+}
+#else
+ISR(TIMER1_COMPA_vect) {
+  Voice<Timer1>::compare_match();
+}
+
+ISR(TIMER2_OVF_vect) {
+  Voice<Timer2>::sub_period();
+}
+
+#ifdef TIMER0_VOICE
+ISR(TIMER0_COMPA_vect) {
+  clock_tick();
+  Voice<Timer0>::sub_period();
+}
+
+unsigned long voice_clock_us() {
+  unsigned long us;
+  uint8_t half, top, count;
+  do {
+    us = clock_us;
+    half = clock_half;
+    top = clock_active_top;
+    count = TCNT0;
+  } while (us != clock_us);
+  uint16_t halves = half + count;
+  // Sub-period ended but not yet counted, when called with interrupts disabled
+  if ((TIFR0 & _BV(OCF0A)) && count < top) halves += top + 1;
+  return us + (halves >> 1);
+}
+
+unsigned long voice_clock_ms() {
+  unsigned long ms;
+  do {
+    ms = clock_ms;
+  } while (ms != clock_ms);
+  return ms;
+}
+#endif
+#endif
+
+#if defined(__AVR_ATmega2560__)
+
+void setup_voices() {
+  Voice<Timer1>::setup();
+  Voice<Timer3>::setup();
+  Voice<Timer4>::setup();
+  Voice<Timer5>::setup();
+}
+
+void voice_note_on(uint8_t voice, uint8_t note, uint8_t volume) {
+  if (note & 0x80) return;
+  switch (voice) {
+    case 0: Voice<Timer1>::note_on(note, volume); break;
+    case 1: Voice<Timer3>::note_on(note, volume); break;
+    case 2: Voice<Timer4>::note_on(note, volume); break;
+    case 3: Voice<Timer5>::note_on(note, volume); break;
+  }
+}
+
+void voice_off(uint8_t voice) {
+  switch (voice) {
+    case 0: Voice<Timer1>::off(); break;
+    case 1: Voice<Timer3>::off(); break;
+    case 2: Voice<Timer4>::off(); break;
+    case 3: Voice<Timer5>::off(); break;
+  }
+}
+
+void voice_kill_all() {
+  Voice<Timer1>::kill();
+  Voice<Timer3>::kill();
+  Voice<Timer4>::kill();
+  Voice<Timer5>::kill();
+}
+
+uint16_t voice_duty(uint8_t voice) {
+  switch (voice) {
+    case 0: return Voice<Timer1>::gate_duty();
+    case 1: return Voice<Timer3>::gate_duty();
+    case 2: return Voice<Timer4>::gate_duty();
+    case 3: return Voice<Timer5>::gate_duty();
+  }
+  return 0;
+}
+
+uint8_t voice_pin(uint8_t voice) {
+  const uint8_t pins[NUM_VOICES] = {Timer1::PIN, Timer3::PIN, Timer4::PIN, Timer5::PIN};
+  return pins[voice];
+}
+
+uint8_t voice_note_cost(uint8_t voice, uint8_t note) {
+  if (voice >= NUM_VOICES || (note & 0x80)) return VOICE_CANNOT_PLAY;
+  // The four 16-bit timers are identical
+  return Voice<Timer1>::note_cost(note);
+}
+
+#else // ATmega328: Timer1 on PWM_1, Timer2 on PWM_2, Timer0 on PWM_3
+
+void setup_voices() {
+  // Initialize PWM_1 timer
+  Voice<Timer1>::setup();
+  // Initialize PWM_2 timer
+  Voice<Timer2>::setup();
+  #ifdef TIMER0_VOICE
+  // Initialize PWM_3 timer, taking over Timer0 from the core
+  Voice<Timer0>::setup();
+  #endif
+}
+
+void voice_note_on(uint8_t voice, uint8_t note, uint8_t volume) {
+  if (note & 0x80) return;
+  if (voice == 0) {
+    Voice<Timer1>::note_on(note, volume);
+  } else if (voice == 1) {
+    Voice<Timer2>::note_on(note, volume);
+  }
+  #ifdef TIMER0_VOICE
+  else if (voice == 2) {
+    Voice<Timer0>::note_on(note, volume);
+  }
+  #endif
+}
+
+void voice_off(uint8_t voice) {
+  if (voice == 0) {
+    Voice<Timer1>::off();
+  } else if (voice == 1) {
+    Voice<Timer2>::off();
+  }
+  #ifdef TIMER0_VOICE
+  else if (voice == 2) {
+    Voice<Timer0>::off();
+  }
+  #endif
+}
+
+// Timer1 also plays pulse-train songs; stopping it ends those too
+void voice_kill_all() {
+  Voice<Timer1>::kill();
+  Voice<Timer2>::kill();
+  #ifdef TIMER0_VOICE
+  Voice<Timer0>::kill();
+  #endif
+}
+
+uint16_t voice_duty(uint8_t voice) {
+  if (voice == 0) return Voice<Timer1>::gate_duty();
+  if (voice == 1) return Voice<Timer2>::gate_duty();
+  #ifdef TIMER0_VOICE
+  if (voice == 2) return Voice<Timer0>::gate_duty();
+  #endif
+  return 0;
+}
+
+uint8_t voice_pin(uint8_t voice) {
+  #ifdef TIMER0_VOICE
+  if (voice == 2) return Timer0::PIN;
+  #endif
+  return voice == 0 ? Timer1::PIN : Timer2::PIN;
+}
+
+uint8_t voice_note_cost(uint8_t voice, uint8_t note) {
+  if (note & 0x80) return VOICE_CANNOT_PLAY;
+  if (voice == 0) return Voice<Timer1>::note_cost(note);
+  if (voice == 1) return Voice<Timer2>::note_cost(note);
+  #ifdef TIMER0_VOICE
+  if (voice == 2) return Voice<Timer0>::note_cost(note);
+  #endif
+  return VOICE_CANNOT_PLAY;
+}
+
+#endif
+
+#endif
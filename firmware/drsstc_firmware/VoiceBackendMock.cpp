@@ -0,0 +1,43 @@
+#include "VoiceBackend.h"
+
+#ifdef VOICE_BACKEND_MOCK
+
+uint8_t mock_voice_note[NUM_VOICES];
+uint8_t mock_voice_volume[NUM_VOICES];
+
+void setup_voices() {
+  for (uint8_t voice = 0; voice < NUM_VOICES; voice++)
+    voice_off(voice);
+}
+
+void voice_note_on(uint8_t voice, uint8_t note, uint8_t volume) {
+  if (voice >= NUM_VOICES || (note & 0x80)) return;
+  mock_voice_note[voice] = note;
+  mock_voice_volume[voice] = volume;
+}
+
+void voice_off(uint8_t voice) {
+  if (voice >= NUM_VOICES) return;
+  mock_voice_note[voice] = 0;
+  mock_voice_volume[voice] = 0;
+}
+
+void voice_kill_all() {
+  for (uint8_t voice = 0; voice < NUM_VOICES; voice++)
+    voice_off(voice);
+}
+
+// No gate is ever driven
+uint16_t voice_duty(uint8_t voice) {
+  return 0;
+}
+
+uint8_t voice_pin(uint8_t voice) {
+  return 0;
+}
+
+uint8_t voice_note_cost(uint8_t voice, uint8_t note) {
+  return (voice >= NUM_VOICES || (note & 0x80)) ? VOICE_CANNOT_PLAY : 0;
+}
+
+#endif
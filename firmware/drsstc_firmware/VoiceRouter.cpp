@@ -0,0 +1,75 @@
+#include "VoiceRouter.h"
+#include "VoiceBackend.h"
+
+#define NO_VOICE 0xff
+// Added to a busy voice's cost, so any free voice that can play the note wins
+#define STEAL_COST 0x20
+
+namespace {
+  uint8_t voice_of_song_voice[MAX_SONG_VOICES] =
+    {NO_VOICE, NO_VOICE, NO_VOICE, NO_VOICE, NO_VOICE, NO_VOICE, NO_VOICE, NO_VOICE};
+  uint8_t song_voice_of_voice[NUM_VOICES];
+  bool router_ready = false;
+
+  void reset_router() {
+    for (uint8_t song_voice = 0; song_voice < MAX_SONG_VOICES; song_voice++)
+      voice_of_song_voice[song_voice] = NO_VOICE;
+    for (uint8_t voice = 0; voice < NUM_VOICES; voice++)
+      song_voice_of_voice[voice] = NO_VOICE;
+    router_ready = true;
+  }
+
+  // Cheapest hardware voice for the note; a voice held by a song voice of
+  // equal or higher priority is never taken
+  uint8_t pick_voice(uint8_t song_voice, uint8_t note) {
+    uint8_t best = NO_VOICE;
+    uint8_t best_cost = NO_VOICE;
+    for (uint8_t voice = 0; voice < NUM_VOICES; voice++) {
+      uint8_t cost = voice_note_cost(voice, note);
+      if (cost == VOICE_CANNOT_PLAY) continue;
+      uint8_t owner = song_voice_of_voice[voice];
+      if (owner != NO_VOICE) {
+        if (owner <= song_voice) continue;
+        // Prefer stealing from the least important song voice
+        cost += STEAL_COST + (MAX_SONG_VOICES - owner);
+      }
+      if (cost < best_cost) {
+        best = voice;
+        best_cost = cost;
+      }
+    }
+    return best;
+  }
+}
+
+void router_note_on(uint8_t song_voice, uint8_t note, uint8_t volume) {
+  if (song_voice >= MAX_SONG_VOICES) return;
+  if (!router_ready) reset_router();
+  uint8_t voice = voice_of_song_voice[song_voice];
+  if (voice == NO_VOICE || voice_note_cost(voice, note) == VOICE_CANNOT_PLAY) {
+    router_note_off(song_voice);
+    voice = pick_voice(song_voice, note);
+    // Every voice that could play it is busy with a more important song voice
+    if (voice == NO_VOICE) return;
+    uint8_t owner = song_voice_of_voice[voice];
+    if (owner != NO_VOICE) voice_of_song_voice[owner] = NO_VOICE;
+    voice_of_song_voice[song_voice] = voice;
+    song_voice_of_voice[voice] = song_voice;
+  }
+  voice_note_on(voice, note, volume);
+}
+
+void router_note_off(uint8_t song_voice) {
+  if (song_voice >= MAX_SONG_VOICES) return;
+  uint8_t voice = voice_of_song_voice[song_voice];
+  if (voice == NO_VOICE) return;
+  voice_off(voice);
+  voice_of_song_voice[song_voice] = NO_VOICE;
+  song_voice_of_voice[voice] = NO_VOICE;
+}
+
+void router_all_off() {
+  for (uint8_t voice = 0; voice < NUM_VOICES; voice++)
+    voice_off(voice);
+  reset_router();
+}
@@ -0,0 +1,14 @@
+#pragma once
+
+#include <arduino.h>
+
+// Maps the song's voices onto the backend's hardware voices. Songs number
+// their voices by priority (0 = most important) and may use more voices
+// than the board has; each note-on takes the free hardware voice that plays
+// the note with the finest on-time step, or steals the voice of the lowest
+// priority song voice that is playing. Every call is O(NUM_VOICES).
+#define MAX_SONG_VOICES 8
+
+void router_note_on(uint8_t song_voice, uint8_t note, uint8_t volume);
+void router_note_off(uint8_t song_voice);
+void router_all_off();
@@ -1,1528 +1,164 @@
 #include "MIDIPlayer.h"
 
-// converted from rossini_overture_wtellrecorders.mid - 5329 bytes total
+// converted from rossini_overture_wtellrecorders.mid - 2506 bytes total (3194 bytes before Huffman coding)
 extern const byte WILLIAM_TELL[] PROGMEM = 
 {
-      0x07,0xc0,0x24,0x4f,0xc0, //      0 BEGIN PROGRAM (960 ticks/beat, tempo = 600000 us/beat)
-                0x80,0xd6,0x06, //      0 T1 ON, NOTE  86 VOLUME  6
-                0x07,0xc0,0x01, //    960 BOTH OFF
-           0x03,0xe0,0xd6,0x06, //    480 T1 ON, NOTE  86 VOLUME  6
-           0x03,0xe0,0xd6,0x07, //    480 T1 ON, NOTE  86 VOLUME  7
-                0x07,0xc0,0x01, //    960 BOTH OFF
-           0x03,0xe0,0xd6,0x07, //    480 T1 ON, NOTE  86 VOLUME  7
-           0x07,0xc0,0xd3,0x07, //    960 T1 ON, NOTE  83 VOLUME  7
-           0x03,0xe0,0xcf,0x06, //    480 T1 ON, NOTE  79 VOLUME  6
-           0x03,0xe0,0xd3,0x08, //    480 T1 ON, NOTE  83 VOLUME  8
-           0x03,0xe0,0xd6,0x08, //    480 T1 ON, NOTE  86 VOLUME  8
-           0x03,0xe0,0xd3,0x07, //    480 T1 ON, NOTE  83 VOLUME  7
-           0x03,0xe0,0xd6,0x08, //    480 T1 ON, NOTE  86 VOLUME  8
-           0x03,0xe0,0xdb,0x08, //    480 T1 ON, NOTE  91 VOLUME  8
-           0x03,0xe0,0xd6,0x06, //    480 T1 ON, NOTE  86 VOLUME  6
-                0x80,0x53,0x07, //      0 T2 ON, NOTE  83 VOLUME  7
-           0x03,0xe0,0xd3,0x06, //    480 T1 ON, NOTE  83 VOLUME  6
-                0x80,0x4f,0x06, //      0 T2 ON, NOTE  79 VOLUME  6
-                0x03,0xe0,0x01, //    480 BOTH OFF
-           0x03,0xe0,0xd3,0x08, //    480 T1 ON, NOTE  83 VOLUME  8
-                0x80,0x4f,0x06, //      0 T2 ON, NOTE  79 VOLUME  6
-           0x01,0xf0,0xd3,0x07, //    240 T1 ON, NOTE  83 VOLUME  7
-                0x80,0x4f,0x07, //      0 T2 ON, NOTE  79 VOLUME  7
-           0x01,0xf0,0xd6,0x08, //    240 T1 ON, NOTE  86 VOLUME  8
-                0x80,0x53,0x07, //      0 T2 ON, NOTE  83 VOLUME  7
-           0x03,0xe0,0xd3,0x07, //    480 T1 ON, NOTE  83 VOLUME  7
-                0x80,0x4f,0x07, //      0 T2 ON, NOTE  79 VOLUME  7
-           0x03,0xe0,0xd6,0x07, //    480 T1 ON, NOTE  86 VOLUME  7
-                     0x80,0x00, //      0 T2 OFF
-           0x03,0xe0,0xdb,0x07, //    480 T1 ON, NOTE  91 VOLUME  7
-                0x80,0x53,0x06, //      0 T2 ON, NOTE  83 VOLUME  6
-           0x01,0xf0,0x53,0x07, //    240 T2 ON, NOTE  83 VOLUME  7
-           0x01,0xf0,0xd6,0x07, //    240 T1 ON, NOTE  86 VOLUME  7
-           0x03,0xe0,0x51,0x07, //    480 T2 ON, NOTE  81 VOLUME  7
-           0x03,0xe0,0xcf,0x06, //    480 T1 ON, NOTE  79 VOLUME  6
-                0x80,0x47,0x06, //      0 T2 ON, NOTE  71 VOLUME  6
-           0x03,0xe0,0xd6,0x06, //    480 T1 ON, NOTE  86 VOLUME  6
-                0x80,0x51,0x07, //      0 T2 ON, NOTE  81 VOLUME  7
-           0x01,0xf0,0xd6,0x07, //    240 T1 ON, NOTE  86 VOLUME  7
-           0x01,0xf0,0x53,0x08, //    240 T2 ON, NOTE  83 VOLUME  8
-           0x07,0xc0,0xd4,0x07, //    960 T1 ON, NOTE  84 VOLUME  7
-                0x80,0x51,0x07, //      0 T2 ON, NOTE  81 VOLUME  7
-           0x03,0xe0,0xd6,0x07, //    480 T1 ON, NOTE  86 VOLUME  7
-                0x80,0x53,0x07, //      0 T2 ON, NOTE  83 VOLUME  7
-           0x03,0xe0,0x51,0x07, //    480 T2 ON, NOTE  81 VOLUME  7
-           0x03,0xe0,0x53,0x08, //    480 T2 ON, NOTE  83 VOLUME  8
-           0x03,0xe0,0xd1,0x06, //    480 T1 ON, NOTE  81 VOLUME  6
-                     0x80,0x00, //      0 T2 OFF
-           0x03,0xe0,0xd6,0x06, //    480 T1 ON, NOTE  86 VOLUME  6
-                0x80,0x54,0x08, //      0 T2 ON, NOTE  84 VOLUME  8
-           0x01,0xf0,0xd6,0x07, //    240 T1 ON, NOTE  86 VOLUME  7
-           0x01,0xf0,0x53,0x07, //    240 T2 ON, NOTE  83 VOLUME  7
-           0x03,0xe0,0x51,0x07, //    480 T2 ON, NOTE  81 VOLUME  7
-           0x03,0xe0,0xcf,0x06, //    480 T1 ON, NOTE  79 VOLUME  6
-                0x80,0x47,0x06, //      0 T2 ON, NOTE  71 VOLUME  6
-           0x03,0xe0,0xd6,0x06, //    480 T1 ON, NOTE  86 VOLUME  6
-                0x80,0x53,0x07, //      0 T2 ON, NOTE  83 VOLUME  7
-           0x01,0xf0,0xd6,0x07, //    240 T1 ON, NOTE  86 VOLUME  7
-           0x01,0xf0,0x51,0x07, //    240 T2 ON, NOTE  81 VOLUME  7
-           0x23,0xd0,0xd6,0x08, //   4560 T1 ON, NOTE  86 VOLUME  8
-           0x01,0xf0,0xd6,0x07, //    240 T1 ON, NOTE  86 VOLUME  7
-           0x03,0xe0,0xd6,0x08, //    480 T1 ON, NOTE  86 VOLUME  8
-           0x03,0xe0,0xd6,0x07, //    480 T1 ON, NOTE  86 VOLUME  7
-                0x2d,0x80,0x01, //   5760 BOTH OFF
-           0x1a,0xa0,0xca,0x06, //   3360 T1 ON, NOTE  74 VOLUME  6
-                0x80,0x47,0x06, //      0 T2 ON, NOTE  71 VOLUME  6
-           0x0f,0x80,0x47,0x07, //   1920 T2 ON, NOTE  71 VOLUME  7
-           0x01,0xf0,0x47,0x06, //    240 T2 ON, NOTE  71 VOLUME  6
-           0x01,0xf0,0xcf,0x06, //    240 T1 ON, NOTE  79 VOLUME  6
-                0x80,0x4a,0x06, //      0 T2 ON, NOTE  74 VOLUME  6
-           0x03,0xe0,0xd1,0x06, //    480 T1 ON, NOTE  81 VOLUME  6
-           0x03,0xe0,0xd3,0x07, //    480 T1 ON, NOTE  83 VOLUME  7
-           0x03,0xe0,0xca,0x06, //    480 T1 ON, NOTE  74 VOLUME  6
-                0x80,0x43,0x06, //      0 T2 ON, NOTE  67 VOLUME  6
-           0x01,0xf0,0x47,0x06, //    240 T2 ON, NOTE  71 VOLUME  6
-           0x09,0xb0,0xcf,0x07, //   1200 T1 ON, NOTE  79 VOLUME  7
-                0x80,0x4a,0x06, //      0 T2 ON, NOTE  74 VOLUME  6
-           0x03,0xe0,0xd3,0x07, //    480 T1 ON, NOTE  83 VOLUME  7
-           0x01,0xf0,0xd3,0x06, //    240 T1 ON, NOTE  83 VOLUME  6
-           0x01,0xf0,0xd1,0x06, //    240 T1 ON, NOTE  81 VOLUME  6
-           0x03,0xe0,0xce,0x05, //    480 T1 ON, NOTE  78 VOLUME  5
-                0x80,0x45,0x06, //      0 T2 ON, NOTE  69 VOLUME  6
-           0x03,0xe0,0xca,0x06, //    480 T1 ON, NOTE  74 VOLUME  6
-           0x03,0xe0,0xc7,0x06, //    480 T1 ON, NOTE  71 VOLUME  6
-                0x80,0x43,0x05, //      0 T2 ON, NOTE  67 VOLUME  5
-           0x01,0xf0,0xca,0x06, //    240 T1 ON, NOTE  74 VOLUME  6
-                0x80,0x47,0x06, //      0 T2 ON, NOTE  71 VOLUME  6
-           0x0f,0x80,0x47,0x07, //   1920 T2 ON, NOTE  71 VOLUME  7
-           0x01,0xf0,0xcf,0x07, //    240 T1 ON, NOTE  79 VOLUME  7
-                0x80,0x4a,0x06, //      0 T2 ON, NOTE  74 VOLUME  6
-           0x03,0xe0,0xd1,0x06, //    480 T1 ON, NOTE  81 VOLUME  6
-           0x03,0xe0,0xd3,0x07, //    480 T1 ON, NOTE  83 VOLUME  7
-           0x03,0xe0,0xcf,0x05, //    480 T1 ON, NOTE  79 VOLUME  5
-           0x01,0xf0,0xd3,0x07, //    240 T1 ON, NOTE  83 VOLUME  7
-           0x01,0xf0,0xd6,0x07, //    240 T1 ON, NOTE  86 VOLUME  7
-                0x80,0x4e,0x07, //      0 T2 ON, NOTE  78 VOLUME  7
-           0x03,0xe0,0x4e,0x06, //    480 T2 ON, NOTE  78 VOLUME  6
-           0x03,0xe0,0xce,0x06, //    480 T1 ON, NOTE  78 VOLUME  6
-                0x80,0x4a,0x06, //      0 T2 ON, NOTE  74 VOLUME  6
-           0x03,0xe0,0xd4,0x06, //    480 T1 ON, NOTE  84 VOLUME  6
-                0x80,0x4e,0x06, //      0 T2 ON, NOTE  78 VOLUME  6
-           0x01,0xf0,0xd1,0x05, //    240 T1 ON, NOTE  81 VOLUME  5
-           0x01,0xf0,0xcf,0x06, //    240 T1 ON, NOTE  79 VOLUME  6
-                0x80,0x47,0x06, //      0 T2 ON, NOTE  71 VOLUME  6
-           0x03,0xe0,0xd3,0x07, //    480 T1 ON, NOTE  83 VOLUME  7
-                0x80,0x4f,0x06, //      0 T2 ON, NOTE  79 VOLUME  6
-           0x03,0xe0,0xcf,0x06, //    480 T1 ON, NOTE  79 VOLUME  6
-                0x80,0x4a,0x06, //      0 T2 ON, NOTE  74 VOLUME  6
-           0x03,0xe0,0xd6,0x07, //    480 T1 ON, NOTE  86 VOLUME  7
-                0x80,0x4f,0x08, //      0 T2 ON, NOTE  79 VOLUME  8
-           0x03,0xe0,0xd6,0x08, //    480 T1 ON, NOTE  86 VOLUME  8
-                0x80,0x43,0x07, //      0 T2 ON, NOTE  67 VOLUME  7
-           0x03,0xe0,0x47,0x07, //    480 T2 ON, NOTE  71 VOLUME  7
-           0x01,0xf0,0x47,0x08, //    240 T2 ON, NOTE  71 VOLUME  8
-           0x09,0xb0,0xdb,0x09, //   1200 T1 ON, NOTE  91 VOLUME  9
-                0x80,0x4a,0x08, //      0 T2 ON, NOTE  74 VOLUME  8
-           0x03,0xe0,0xdd,0x08, //    480 T1 ON, NOTE  93 VOLUME  8
-           0x03,0xe0,0xdf,0x09, //    480 T1 ON, NOTE  95 VOLUME  9
-           0x03,0xe0,0xd6,0x07, //    480 T1 ON, NOTE  86 VOLUME  7
-                0x80,0x47,0x08, //      0 T2 ON, NOTE  71 VOLUME  8
-           0x01,0xf0,0xd6,0x08, //    240 T1 ON, NOTE  86 VOLUME  8
-           0x09,0xb0,0xdb,0x09, //   1200 T1 ON, NOTE  91 VOLUME  9
-                0x80,0x4a,0x08, //      0 T2 ON, NOTE  74 VOLUME  8
-           0x03,0xe0,0xdf,0x09, //    480 T1 ON, NOTE  95 VOLUME  9
-                0x80,0x4f,0x0a, //      0 T2 ON, NOTE  79 VOLUME 10
-           0x01,0xf0,0xdf,0x08, //    240 T1 ON, NOTE  95 VOLUME  8
-                0x80,0x4f,0x08, //      0 T2 ON, NOTE  79 VOLUME  8
-           0x01,0xf0,0xdd,0x08, //    240 T1 ON, NOTE  93 VOLUME  8
-                0x80,0x4e,0x08, //      0 T2 ON, NOTE  78 VOLUME  8
-           0x03,0xe0,0xda,0x07, //    480 T1 ON, NOTE  90 VOLUME  7
-                0x80,0x4a,0x08, //      0 T2 ON, NOTE  74 VOLUME  8
-           0x03,0xe0,0xd6,0x07, //    480 T1 ON, NOTE  86 VOLUME  7
-                0x80,0x45,0x08, //      0 T2 ON, NOTE  69 VOLUME  8
-           0x03,0xe0,0xd6,0x08, //    480 T1 ON, NOTE  86 VOLUME  8
-                0x80,0x47,0x08, //      0 T2 ON, NOTE  71 VOLUME  8
-           0x03,0xe0,0x47,0x09, //    480 T2 ON, NOTE  71 VOLUME  9
-           0x03,0xe0,0x47,0x08, //    480 T2 ON, NOTE  71 VOLUME  8
-           0x0b,0xa0,0xdb,0x09, //   1440 T1 ON, NOTE  91 VOLUME  9
-                0x80,0x4f,0x09, //      0 T2 ON, NOTE  79 VOLUME  9
-           0x03,0xe0,0xdd,0x09, //    480 T1 ON, NOTE  93 VOLUME  9
-                0x80,0x51,0x09, //      0 T2 ON, NOTE  81 VOLUME  9
-           0x03,0xe0,0xdf,0x09, //    480 T1 ON, NOTE  95 VOLUME  9
-                0x80,0x4f,0x08, //      0 T2 ON, NOTE  79 VOLUME  8
-           0x03,0xe0,0xdb,0x07, //    480 T1 ON, NOTE  91 VOLUME  7
-                0x80,0x4a,0x09, //      0 T2 ON, NOTE  74 VOLUME  9
-           0x01,0xf0,0xdf,0x08, //    240 T1 ON, NOTE  95 VOLUME  8
-                0x80,0x4f,0x08, //      0 T2 ON, NOTE  79 VOLUME  8
-           0x01,0xf0,0xe2,0x09, //    240 T1 ON, NOTE  98 VOLUME  9
-                0x80,0x54,0x09, //      0 T2 ON, NOTE  84 VOLUME  9
-           0x03,0xe0,0x54,0x08, //    480 T2 ON, NOTE  84 VOLUME  8
-           0x03,0xe0,0xd4,0x08, //    480 T1 ON, NOTE  84 VOLUME  8
-                0x80,0x51,0x08, //      0 T2 ON, NOTE  81 VOLUME  8
-           0x03,0xe0,0xe0,0x07, //    480 T1 ON, NOTE  96 VOLUME  7
-           0x01,0xf0,0xdd,0x07, //    240 T1 ON, NOTE  93 VOLUME  7
-                0x80,0x54,0x08, //      0 T2 ON, NOTE  84 VOLUME  8
-           0x01,0xf0,0xdb,0x08, //    240 T1 ON, NOTE  91 VOLUME  8
-                0x80,0x56,0x08, //      0 T2 ON, NOTE  86 VOLUME  8
-           0x03,0xe0,0xdf,0x09, //    480 T1 ON, NOTE  95 VOLUME  9
-           0x03,0xe0,0xdb,0x07, //    480 T1 ON, NOTE  91 VOLUME  7
-           0x03,0xe0,0xd3,0x07, //    480 T1 ON, NOTE  83 VOLUME  7
-                0x80,0x4f,0x07, //      0 T2 ON, NOTE  79 VOLUME  7
-           0x01,0xf0,0xd3,0x08, //    240 T1 ON, NOTE  83 VOLUME  8
-                0x80,0x4f,0x08, //      0 T2 ON, NOTE  79 VOLUME  8
-           0x01,0xf0,0xdf,0x07, //    240 T1 ON, NOTE  95 VOLUME  7
-                0x80,0x4f,0x07, //      0 T2 ON, NOTE  79 VOLUME  7
-           0x03,0xe0,0xdf,0x08, //    480 T1 ON, NOTE  95 VOLUME  8
-                0x80,0x4f,0x08, //      0 T2 ON, NOTE  79 VOLUME  8
-           0x0f,0x80,0xe4,0x09, //   1920 T1 ON, NOTE 100 VOLUME  9
-                0x80,0x4c,0x08, //      0 T2 ON, NOTE  76 VOLUME  8
-           0x03,0xe0,0xdf,0x07, //    480 T1 ON, NOTE  95 VOLUME  7
-                0x80,0x4f,0x09, //      0 T2 ON, NOTE  79 VOLUME  9
-           0x03,0xe0,0xe4,0x09, //    480 T1 ON, NOTE 100 VOLUME  9
-                0x80,0x4c,0x08, //      0 T2 ON, NOTE  76 VOLUME  8
-           0x03,0xe0,0xdf,0x07, //    480 T1 ON, NOTE  95 VOLUME  7
-                0x80,0x4f,0x09, //      0 T2 ON, NOTE  79 VOLUME  9
-           0x03,0xe0,0xe4,0x09, //    480 T1 ON, NOTE 100 VOLUME  9
-                0x80,0x4c,0x08, //      0 T2 ON, NOTE  76 VOLUME  8
-           0x03,0xe0,0xdf,0x08, //    480 T1 ON, NOTE  95 VOLUME  8
-                0x80,0x4f,0x09, //      0 T2 ON, NOTE  79 VOLUME  9
-           0x03,0xe0,0xdd,0x08, //    480 T1 ON, NOTE  93 VOLUME  8
-                0x80,0x4e,0x08, //      0 T2 ON, NOTE  78 VOLUME  8
-           0x03,0xe0,0xdb,0x08, //    480 T1 ON, NOTE  91 VOLUME  8
-                0x80,0x4c,0x07, //      0 T2 ON, NOTE  76 VOLUME  7
-           0x03,0xe0,0xda,0x07, //    480 T1 ON, NOTE  90 VOLUME  7
-                0x80,0x4b,0x08, //      0 T2 ON, NOTE  75 VOLUME  8
-           0x03,0xe0,0xd8,0x08, //    480 T1 ON, NOTE  88 VOLUME  8
-                0x80,0x4c,0x06, //      0 T2 ON, NOTE  76 VOLUME  6
-           0x03,0xe0,0xdf,0x09, //    480 T1 ON, NOTE  95 VOLUME  9
-                0x80,0x4f,0x08, //      0 T2 ON, NOTE  79 VOLUME  8
-           0x01,0xf0,0xdf,0x08, //    240 T1 ON, NOTE  95 VOLUME  8
-           0x05,0xd0,0xdf,0x09, //    720 T1 ON, NOTE  95 VOLUME  9
-           0x01,0xf0,0xdf,0x08, //    240 T1 ON, NOTE  95 VOLUME  8
-           0x07,0xc0,0x4f,0x09, //    960 T2 ON, NOTE  79 VOLUME  9
-           0x01,0xf0,0xdf,0x09, //    240 T1 ON, NOTE  95 VOLUME  9
-                0x80,0x4f,0x08, //      0 T2 ON, NOTE  79 VOLUME  8
-           0x03,0xe0,0xe4,0x09, //    480 T1 ON, NOTE 100 VOLUME  9
-                0x80,0x4c,0x08, //      0 T2 ON, NOTE  76 VOLUME  8
-           0x03,0xe0,0xdf,0x08, //    480 T1 ON, NOTE  95 VOLUME  8
-                0x80,0x4f,0x09, //      0 T2 ON, NOTE  79 VOLUME  9
-           0x03,0xe0,0xe4,0x09, //    480 T1 ON, NOTE 100 VOLUME  9
-                0x80,0x4c,0x08, //      0 T2 ON, NOTE  76 VOLUME  8
-           0x03,0xe0,0xdf,0x07, //    480 T1 ON, NOTE  95 VOLUME  7
-                0x80,0x4f,0x09, //      0 T2 ON, NOTE  79 VOLUME  9
-           0x03,0xe0,0xe4,0x09, //    480 T1 ON, NOTE 100 VOLUME  9
-                0x80,0x4c,0x08, //      0 T2 ON, NOTE  76 VOLUME  8
-           0x03,0xe0,0xe2,0x08, //    480 T1 ON, NOTE  98 VOLUME  8
-                0x80,0x4e,0x08, //      0 T2 ON, NOTE  78 VOLUME  8
-           0x03,0xe0,0xe1,0x08, //    480 T1 ON, NOTE  97 VOLUME  8
-                0x80,0x4c,0x08, //      0 T2 ON, NOTE  76 VOLUME  8
-           0x03,0xe0,0xe2,0x09, //    480 T1 ON, NOTE  98 VOLUME  9
-                0x80,0x4e,0x09, //      0 T2 ON, NOTE  78 VOLUME  9
-           0x03,0xe0,0xe1,0x08, //    480 T1 ON, NOTE  97 VOLUME  8
-                0x80,0x4f,0x09, //      0 T2 ON, NOTE  79 VOLUME  9
-           0x03,0xe0,0xe2,0x08, //    480 T1 ON, NOTE  98 VOLUME  8
-                0x80,0x4e,0x08, //      0 T2 ON, NOTE  78 VOLUME  8
-           0x03,0xe0,0xdf,0x08, //    480 T1 ON, NOTE  95 VOLUME  8
-                0x80,0x4f,0x09, //      0 T2 ON, NOTE  79 VOLUME  9
-           0x01,0xf0,0x4f,0x08, //    240 T2 ON, NOTE  79 VOLUME  8
-           0x14,0xd0,0xe4,0x09, //   2640 T1 ON, NOTE 100 VOLUME  9
-                0x80,0x4c,0x07, //      0 T2 ON, NOTE  76 VOLUME  7
-           0x03,0xe0,0xdf,0x07, //    480 T1 ON, NOTE  95 VOLUME  7
-                0x80,0x4f,0x09, //      0 T2 ON, NOTE  79 VOLUME  9
-           0x03,0xe0,0xe4,0x09, //    480 T1 ON, NOTE 100 VOLUME  9
-                0x80,0x4c,0x08, //      0 T2 ON, NOTE  76 VOLUME  8
-           0x03,0xe0,0xdf,0x07, //    480 T1 ON, NOTE  95 VOLUME  7
-                0x80,0x4f,0x09, //      0 T2 ON, NOTE  79 VOLUME  9
-           0x03,0xe0,0xe4,0x09, //    480 T1 ON, NOTE 100 VOLUME  9
-                0x80,0x4c,0x08, //      0 T2 ON, NOTE  76 VOLUME  8
-           0x03,0xe0,0xdf,0x07, //    480 T1 ON, NOTE  95 VOLUME  7
-                0x80,0x4f,0x09, //      0 T2 ON, NOTE  79 VOLUME  9
-           0x03,0xe0,0xdd,0x07, //    480 T1 ON, NOTE  93 VOLUME  7
-                0x80,0x4e,0x08, //      0 T2 ON, NOTE  78 VOLUME  8
-           0x03,0xe0,0xdb,0x07, //    480 T1 ON, NOTE  91 VOLUME  7
-                0x80,0x4c,0x07, //      0 T2 ON, NOTE  76 VOLUME  7
-           0x03,0xe0,0xda,0x08, //    480 T1 ON, NOTE  90 VOLUME  8
-                0x80,0x4b,0x08, //      0 T2 ON, NOTE  75 VOLUME  8
-           0x03,0xe0,0xd8,0x08, //    480 T1 ON, NOTE  88 VOLUME  8
-                0x80,0x4c,0x08, //      0 T2 ON, NOTE  76 VOLUME  8
-           0x03,0xe0,0xdf,0x09, //    480 T1 ON, NOTE  95 VOLUME  9
-                0x80,0x4f,0x09, //      0 T2 ON, NOTE  79 VOLUME  9
-           0x01,0xf0,0xdf,0x08, //    240 T1 ON, NOTE  95 VOLUME  8
-                0x80,0x4f,0x08, //      0 T2 ON, NOTE  79 VOLUME  8
-           0x0b,0xa0,0x4f,0x09, //   1440 T2 ON, NOTE  79 VOLUME  9
-           0x01,0xf0,0x4f,0x08, //    240 T2 ON, NOTE  79 VOLUME  8
-           0x03,0xe0,0xe4,0x09, //    480 T1 ON, NOTE 100 VOLUME  9
-                0x80,0x4c,0x08, //      0 T2 ON, NOTE  76 VOLUME  8
-           0x03,0xe0,0xdf,0x07, //    480 T1 ON, NOTE  95 VOLUME  7
-                0x80,0x4f,0x09, //      0 T2 ON, NOTE  79 VOLUME  9
-           0x03,0xe0,0xe4,0x09, //    480 T1 ON, NOTE 100 VOLUME  9
-                0x80,0x4c,0x07, //      0 T2 ON, NOTE  76 VOLUME  7
-           0x03,0xe0,0xdf,0x07, //    480 T1 ON, NOTE  95 VOLUME  7
-                0x80,0x4f,0x09, //      0 T2 ON, NOTE  79 VOLUME  9
-           0x03,0xe0,0xe4,0x09, //    480 T1 ON, NOTE 100 VOLUME  9
-                0x80,0x4c,0x08, //      0 T2 ON, NOTE  76 VOLUME  8
-           0x03,0xe0,0xe2,0x08, //    480 T1 ON, NOTE  98 VOLUME  8
-                0x80,0x4e,0x08, //      0 T2 ON, NOTE  78 VOLUME  8
-           0x03,0xe0,0xe1,0x08, //    480 T1 ON, NOTE  97 VOLUME  8
-                0x80,0x4c,0x08, //      0 T2 ON, NOTE  76 VOLUME  8
-           0x03,0xe0,0xe2,0x08, //    480 T1 ON, NOTE  98 VOLUME  8
-                0x80,0x4e,0x09, //      0 T2 ON, NOTE  78 VOLUME  9
-                0x07,0xc0,0x01, //    960 BOTH OFF
-           0x03,0xe0,0xc5,0x06, //    480 T1 ON, NOTE  69 VOLUME  6
-                0x80,0x3e,0x06, //      0 T2 ON, NOTE  62 VOLUME  6
-           0x01,0xf0,0xc5,0x07, //    240 T1 ON, NOTE  69 VOLUME  7
-                0x80,0x3e,0x07, //      0 T2 ON, NOTE  62 VOLUME  7
-           0x0d,0x90,0xc7,0x08, //   1680 T1 ON, NOTE  71 VOLUME  8
-                0x80,0x43,0x08, //      0 T2 ON, NOTE  67 VOLUME  8
-           0x03,0xe0,0xc8,0x07, //    480 T1 ON, NOTE  72 VOLUME  7
-                0x80,0x45,0x07, //      0 T2 ON, NOTE  69 VOLUME  7
-           0x03,0xe0,0xc5,0x08, //    480 T1 ON, NOTE  69 VOLUME  8
-                0x80,0x3e,0x06, //      0 T2 ON, NOTE  62 VOLUME  6
-                0x01,0xf0,0x00, //    240 T2 OFF
-           0x01,0xf0,0x40,0x07, //    240 T2 ON, NOTE  64 VOLUME  7
-                0x01,0xf0,0x00, //    240 T2 OFF
-           0x01,0xf0,0xc8,0x08, //    240 T1 ON, NOTE  72 VOLUME  8
-                0x80,0x45,0x08, //      0 T2 ON, NOTE  69 VOLUME  8
-           0x01,0xf0,0xc7,0x07, //    240 T1 ON, NOTE  71 VOLUME  7
-                0x80,0x43,0x07, //      0 T2 ON, NOTE  67 VOLUME  7
-                0x01,0xf0,0x00, //    240 T2 OFF
-           0x01,0xf0,0xc5,0x08, //    240 T1 ON, NOTE  69 VOLUME  8
-                0x80,0x43,0x08, //      0 T2 ON, NOTE  67 VOLUME  8
-                0x01,0xf0,0x80, //    240 T1 OFF
-           0x01,0xf0,0xc7,0x08, //    240 T1 ON, NOTE  71 VOLUME  8
-                0x01,0xf0,0x80, //    240 T1 OFF
-           0x01,0xf0,0xc9,0x07, //    240 T1 ON, NOTE  73 VOLUME  7
-                0x80,0x47,0x08, //      0 T2 ON, NOTE  71 VOLUME  8
-           0x01,0xf0,0xc3,0x08, //    240 T1 ON, NOTE  67 VOLUME  8
-           0x01,0xf0,0xca,0x08, //    240 T1 ON, NOTE  74 VOLUME  8
-                0x80,0x45,0x07, //      0 T2 ON, NOTE  69 VOLUME  7
-           0x01,0xf0,0xc2,0x07, //    240 T1 ON, NOTE  66 VOLUME  7
-           0x01,0xf0,0xc5,0x07, //    240 T1 ON, NOTE  69 VOLUME  7
-                0x80,0x42,0x07, //      0 T2 ON, NOTE  66 VOLUME  7
-           0x05,0xd0,0xd1,0x06, //    720 T1 ON, NOTE  81 VOLUME  6
-                0x80,0x4a,0x06, //      0 T2 ON, NOTE  74 VOLUME  6
-           0x01,0xf0,0xd1,0x07, //    240 T1 ON, NOTE  81 VOLUME  7
-                0x80,0x4a,0x07, //      0 T2 ON, NOTE  74 VOLUME  7
-           0x0d,0x90,0xd3,0x08, //   1680 T1 ON, NOTE  83 VOLUME  8
-                0x80,0x4f,0x08, //      0 T2 ON, NOTE  79 VOLUME  8
-           0x03,0xe0,0xd4,0x08, //    480 T1 ON, NOTE  84 VOLUME  8
-                0x80,0x51,0x08, //      0 T2 ON, NOTE  81 VOLUME  8
-           0x03,0xe0,0xd1,0x08, //    480 T1 ON, NOTE  81 VOLUME  8
-                0x80,0x4a,0x08, //      0 T2 ON, NOTE  74 VOLUME  8
-           0x01,0xf0,0xd4,0x07, //    240 T1 ON, NOTE  84 VOLUME  7
-                0x80,0x51,0x07, //      0 T2 ON, NOTE  81 VOLUME  7
-           0x01,0xf0,0xd3,0x06, //    240 T1 ON, NOTE  83 VOLUME  6
-                0x80,0x4f,0x06, //      0 T2 ON, NOTE  79 VOLUME  6
-           0x01,0xf0,0xcf,0x08, //    240 T1 ON, NOTE  79 VOLUME  8
-                0x80,0x4a,0x08, //      0 T2 ON, NOTE  74 VOLUME  8
-           0x01,0xf0,0xd3,0x08, //    240 T1 ON, NOTE  83 VOLUME  8
-                0x80,0x4f,0x08, //      0 T2 ON, NOTE  79 VOLUME  8
-           0x01,0xf0,0xd1,0x07, //    240 T1 ON, NOTE  81 VOLUME  7
-                0x80,0x4e,0x07, //      0 T2 ON, NOTE  78 VOLUME  7
-                0x07,0xc0,0x01, //    960 BOTH OFF
-           0x03,0xe0,0xca,0x06, //    480 T1 ON, NOTE  74 VOLUME  6
-                0x80,0x47,0x07, //      0 T2 ON, NOTE  71 VOLUME  7
-                     0xf8,0x01, //    120 BOTH OFF
-                0xf8,0xca,0x07, //    120 T1 ON, NOTE  74 VOLUME  7
-                0x80,0x47,0x07, //      0 T2 ON, NOTE  71 VOLUME  7
-                     0xf8,0x01, //    120 BOTH OFF
-                0xf8,0xca,0x07, //    120 T1 ON, NOTE  74 VOLUME  7
-                0x80,0x47,0x07, //      0 T2 ON, NOTE  71 VOLUME  7
-                0x01,0xf0,0x01, //    240 BOTH OFF
-           0x01,0xf0,0xca,0x07, //    240 T1 ON, NOTE  74 VOLUME  7
-                0x80,0x47,0x07, //      0 T2 ON, NOTE  71 VOLUME  7
-                     0xf8,0x01, //    120 BOTH OFF
-                0xf8,0xca,0x07, //    120 T1 ON, NOTE  74 VOLUME  7
-                0x80,0x47,0x07, //      0 T2 ON, NOTE  71 VOLUME  7
-                     0xf8,0x01, //    120 BOTH OFF
-                0xf8,0xca,0x07, //    120 T1 ON, NOTE  74 VOLUME  7
-                0x80,0x47,0x07, //      0 T2 ON, NOTE  71 VOLUME  7
-                0x01,0xf0,0x01, //    240 BOTH OFF
-           0x01,0xf0,0xca,0x07, //    240 T1 ON, NOTE  74 VOLUME  7
-                0x80,0x47,0x07, //      0 T2 ON, NOTE  71 VOLUME  7
-                     0xf8,0x01, //    120 BOTH OFF
-                0xf8,0xca,0x07, //    120 T1 ON, NOTE  74 VOLUME  7
-                0x80,0x47,0x07, //      0 T2 ON, NOTE  71 VOLUME  7
-                     0xf8,0x01, //    120 BOTH OFF
-                0xf8,0xcf,0x08, //    120 T1 ON, NOTE  79 VOLUME  8
-                0x80,0x47,0x07, //      0 T2 ON, NOTE  71 VOLUME  7
-                0x01,0xf0,0x01, //    240 BOTH OFF
-           0x01,0xf0,0xd1,0x08, //    240 T1 ON, NOTE  81 VOLUME  8
-                0x80,0x43,0x07, //      0 T2 ON, NOTE  67 VOLUME  7
-                0x01,0xf0,0x01, //    240 BOTH OFF
-           0x01,0xf0,0xd3,0x08, //    240 T1 ON, NOTE  83 VOLUME  8
-                0x80,0x43,0x07, //      0 T2 ON, NOTE  67 VOLUME  7
-                0x01,0xf0,0x01, //    240 BOTH OFF
-           0x01,0xf0,0xca,0x06, //    240 T1 ON, NOTE  74 VOLUME  6
-                0x80,0x47,0x07, //      0 T2 ON, NOTE  71 VOLUME  7
-                     0xf8,0x01, //    120 BOTH OFF
-                0xf8,0xca,0x07, //    120 T1 ON, NOTE  74 VOLUME  7
-                0x80,0x47,0x07, //      0 T2 ON, NOTE  71 VOLUME  7
-                     0xf8,0x01, //    120 BOTH OFF
-                0xf8,0xca,0x07, //    120 T1 ON, NOTE  74 VOLUME  7
-                0x80,0x47,0x07, //      0 T2 ON, NOTE  71 VOLUME  7
-           0x07,0xc0,0xcf,0x08, //    960 T1 ON, NOTE  79 VOLUME  8
-                0x80,0x43,0x07, //      0 T2 ON, NOTE  67 VOLUME  7
-           0x03,0xe0,0xd3,0x08, //    480 T1 ON, NOTE  83 VOLUME  8
-           0x01,0xf0,0xd3,0x07, //    240 T1 ON, NOTE  83 VOLUME  7
-           0x01,0xf0,0xd1,0x06, //    240 T1 ON, NOTE  81 VOLUME  6
-                0x80,0x3e,0x06, //      0 T2 ON, NOTE  62 VOLUME  6
-           0x03,0xe0,0xce,0x06, //    480 T1 ON, NOTE  78 VOLUME  6
-                0x80,0x45,0x08, //      0 T2 ON, NOTE  69 VOLUME  8
-           0x03,0xe0,0xca,0x06, //    480 T1 ON, NOTE  74 VOLUME  6
-                0x80,0x45,0x07, //      0 T2 ON, NOTE  69 VOLUME  7
-           0x03,0xe0,0xca,0x07, //    480 T1 ON, NOTE  74 VOLUME  7
-                0x80,0x43,0x07, //      0 T2 ON, NOTE  67 VOLUME  7
-           0x12,0xe0,0xcf,0x08, //   2400 T1 ON, NOTE  79 VOLUME  8
-                0x80,0x47,0x06, //      0 T2 ON, NOTE  71 VOLUME  6
-           0x03,0xe0,0xd1,0x07, //    480 T1 ON, NOTE  81 VOLUME  7
-                0x80,0x43,0x07, //      0 T2 ON, NOTE  67 VOLUME  7
-           0x03,0xe0,0xd3,0x07, //    480 T1 ON, NOTE  83 VOLUME  7
-           0x03,0xe0,0xcf,0x06, //    480 T1 ON, NOTE  79 VOLUME  6
-           0x01,0xf0,0xd3,0x08, //    240 T1 ON, NOTE  83 VOLUME  8
-           0x01,0xf0,0xd6,0x08, //    240 T1 ON, NOTE  86 VOLUME  8
-                0x80,0x45,0x07, //      0 T2 ON, NOTE  69 VOLUME  7
-           0x03,0xe0,0x45,0x08, //    480 T2 ON, NOTE  69 VOLUME  8
-           0x01,0xf0,0x45,0x07, //    240 T2 ON, NOTE  69 VOLUME  7
-           0x01,0xf0,0xc5,0x07, //    240 T1 ON, NOTE  69 VOLUME  7
-                0x80,0x3e,0x07, //      0 T2 ON, NOTE  62 VOLUME  7
-           0x03,0xe0,0xd4,0x06, //    480 T1 ON, NOTE  84 VOLUME  6
-                0x80,0x45,0x07, //      0 T2 ON, NOTE  69 VOLUME  7
-           0x01,0xf0,0xd1,0x06, //    240 T1 ON, NOTE  81 VOLUME  6
-                0x80,0x3e,0x07, //      0 T2 ON, NOTE  62 VOLUME  7
-           0x01,0xf0,0xcf,0x07, //    240 T1 ON, NOTE  79 VOLUME  7
-                0x80,0x43,0x07, //      0 T2 ON, NOTE  67 VOLUME  7
-           0x03,0xe0,0xd3,0x08, //    480 T1 ON, NOTE  83 VOLUME  8
-           0x03,0xe0,0xcf,0x06, //    480 T1 ON, NOTE  79 VOLUME  6
-           0x03,0xe0,0xd6,0x05, //    480 T1 ON, NOTE  86 VOLUME  5
-                0x80,0x4a,0x05, //      0 T2 ON, NOTE  74 VOLUME  5
-           0x01,0xf0,0xd6,0x06, //    240 T1 ON, NOTE  86 VOLUME  6
-                0x80,0x47,0x06, //      0 T2 ON, NOTE  71 VOLUME  6
-           0x07,0xc0,0xd6,0x07, //    960 T1 ON, NOTE  86 VOLUME  7
-           0x01,0xf0,0xd6,0x06, //    240 T1 ON, NOTE  86 VOLUME  6
-           0x05,0xd0,0xd6,0x05, //    720 T1 ON, NOTE  86 VOLUME  5
-           0x01,0xf0,0xdb,0x07, //    240 T1 ON, NOTE  91 VOLUME  7
-           0x03,0xe0,0xdd,0x07, //    480 T1 ON, NOTE  93 VOLUME  7
-           0x03,0xe0,0xdf,0x06, //    480 T1 ON, NOTE  95 VOLUME  6
-                0x80,0x47,0x07, //      0 T2 ON, NOTE  71 VOLUME  7
-           0x03,0xe0,0xd6,0x05, //    480 T1 ON, NOTE  86 VOLUME  5
-                0x80,0x43,0x06, //      0 T2 ON, NOTE  67 VOLUME  6
-           0x01,0xf0,0xd6,0x06, //    240 T1 ON, NOTE  86 VOLUME  6
-                0x80,0x47,0x07, //      0 T2 ON, NOTE  71 VOLUME  7
-           0x01,0xf0,0x4a,0x07, //    240 T2 ON, NOTE  74 VOLUME  7
-           0x03,0xe0,0x47,0x06, //    480 T2 ON, NOTE  71 VOLUME  6
-           0x03,0xe0,0xdb,0x07, //    480 T1 ON, NOTE  91 VOLUME  7
-           0x03,0xe0,0xdf,0x07, //    480 T1 ON, NOTE  95 VOLUME  7
-                0x80,0x4f,0x07, //      0 T2 ON, NOTE  79 VOLUME  7
-           0x01,0xf0,0xdf,0x06, //    240 T1 ON, NOTE  95 VOLUME  6
-                0x80,0x4f,0x06, //      0 T2 ON, NOTE  79 VOLUME  6
-           0x01,0xf0,0xdd,0x06, //    240 T1 ON, NOTE  93 VOLUME  6
-                0x80,0x4e,0x06, //      0 T2 ON, NOTE  78 VOLUME  6
-           0x03,0xe0,0xda,0x06, //    480 T1 ON, NOTE  90 VOLUME  6
-                0x80,0x4a,0x05, //      0 T2 ON, NOTE  74 VOLUME  5
-           0x03,0xe0,0xd6,0x05, //    480 T1 ON, NOTE  86 VOLUME  5
-                0x80,0x3e,0x06, //      0 T2 ON, NOTE  62 VOLUME  6
-           0x03,0xe0,0xd6,0x06, //    480 T1 ON, NOTE  86 VOLUME  6
-                0x80,0x53,0x08, //      0 T2 ON, NOTE  83 VOLUME  8
-           0x01,0xf0,0x53,0x06, //    240 T2 ON, NOTE  83 VOLUME  6
-           0x10,0xf0,0xdb,0x07, //   2160 T1 ON, NOTE  91 VOLUME  7
-           0x03,0xe0,0xdd,0x07, //    480 T1 ON, NOTE  93 VOLUME  7
-           0x03,0xe0,0xdf,0x06, //    480 T1 ON, NOTE  95 VOLUME  6
-                0x80,0x47,0x07, //      0 T2 ON, NOTE  71 VOLUME  7
-           0x03,0xe0,0xdb,0x06, //    480 T1 ON, NOTE  91 VOLUME  6
-                0x80,0x53,0x06, //      0 T2 ON, NOTE  83 VOLUME  6
-           0x01,0xf0,0xdf,0x06, //    240 T1 ON, NOTE  95 VOLUME  6
-                0x80,0x4f,0x05, //      0 T2 ON, NOTE  79 VOLUME  5
-           0x01,0xf0,0xe2,0x07, //    240 T1 ON, NOTE  98 VOLUME  7
-                0x80,0x48,0x05, //      0 T2 ON, NOTE  72 VOLUME  5
-           0x03,0xe0,0x48,0x06, //    480 T2 ON, NOTE  72 VOLUME  6
-           0x03,0xe0,0xc8,0x06, //    480 T1 ON, NOTE  72 VOLUME  6
-                0x80,0x45,0x06, //      0 T2 ON, NOTE  69 VOLUME  6
-           0x03,0xe0,0xe0,0x05, //    480 T1 ON, NOTE  96 VOLUME  5
-                0x80,0x48,0x06, //      0 T2 ON, NOTE  72 VOLUME  6
-           0x01,0xf0,0xdd,0x06, //    240 T1 ON, NOTE  93 VOLUME  6
-           0x01,0xf0,0xdb,0x06, //    240 T1 ON, NOTE  91 VOLUME  6
-                0x80,0x4a,0x06, //      0 T2 ON, NOTE  74 VOLUME  6
-           0x03,0xe0,0xdf,0x07, //    480 T1 ON, NOTE  95 VOLUME  7
-           0x03,0xe0,0xdb,0x06, //    480 T1 ON, NOTE  91 VOLUME  6
-           0x03,0xe0,0xc7,0x06, //    480 T1 ON, NOTE  71 VOLUME  6
-           0x03,0xe0,0xdb,0x07, //    480 T1 ON, NOTE  91 VOLUME  7
-                0x80,0x4f,0x07, //      0 T2 ON, NOTE  79 VOLUME  7
-           0x03,0xe0,0xdb,0x08, //    480 T1 ON, NOTE  91 VOLUME  8
-                0x80,0x4a,0x08, //      0 T2 ON, NOTE  74 VOLUME  8
-           0x0b,0xa0,0xdf,0x09, //   1440 T1 ON, NOTE  95 VOLUME  9
-                0x80,0x53,0x09, //      0 T2 ON, NOTE  83 VOLUME  9
-           0x03,0xe0,0xdd,0x08, //    480 T1 ON, NOTE  93 VOLUME  8
-                0x80,0x51,0x08, //      0 T2 ON, NOTE  81 VOLUME  8
-           0x03,0xe0,0xdb,0x08, //    480 T1 ON, NOTE  91 VOLUME  8
-                0x80,0x4f,0x08, //      0 T2 ON, NOTE  79 VOLUME  8
-           0x03,0xe0,0xda,0x08, //    480 T1 ON, NOTE  90 VOLUME  8
-                0x80,0x4e,0x08, //      0 T2 ON, NOTE  78 VOLUME  8
-           0x03,0xe0,0xdb,0x09, //    480 T1 ON, NOTE  91 VOLUME  9
-                0x80,0x4f,0x08, //      0 T2 ON, NOTE  79 VOLUME  8
-           0x03,0xe0,0xd8,0x08, //    480 T1 ON, NOTE  88 VOLUME  8
-                0x80,0x48,0x07, //      0 T2 ON, NOTE  72 VOLUME  7
-           0x03,0xe0,0xe2,0x08, //    480 T1 ON, NOTE  98 VOLUME  8
-                0x80,0x4a,0x0a, //      0 T2 ON, NOTE  74 VOLUME 10
-           0x01,0xf0,0x64,0x08, //    240 T2 ON, NOTE 100 VOLUME  8
-                0x84,0xd6,0x0a, //      4 T1 ON, NOTE  86 VOLUME 10
-           0x01,0xec,0xe2,0x08, //    236 T1 ON, NOTE  98 VOLUME  8
-                0x84,0x4a,0x0a, //      4 T2 ON, NOTE  74 VOLUME 10
-           0x01,0xec,0x64,0x08, //    236 T2 ON, NOTE 100 VOLUME  8
-                0x84,0xd6,0x0a, //      4 T1 ON, NOTE  86 VOLUME 10
-           0x01,0xe1,0x47,0x0a, //    225 T2 ON, NOTE  71 VOLUME 10
-                0x8b,0xe2,0x08, //     11 T1 ON, NOTE  98 VOLUME  8
-                0x80,0x53,0x0a, //      0 T2 ON, NOTE  83 VOLUME 10
-           0x01,0xf0,0x64,0x08, //    240 T2 ON, NOTE 100 VOLUME  8
-                0x84,0xd6,0x0a, //      4 T1 ON, NOTE  86 VOLUME 10
-           0x01,0xec,0xe2,0x08, //    236 T1 ON, NOTE  98 VOLUME  8
-                0x84,0x53,0x0a, //      4 T2 ON, NOTE  83 VOLUME 10
-           0x01,0xec,0x64,0x08, //    236 T2 ON, NOTE 100 VOLUME  8
-                0x84,0xd6,0x0a, //      4 T1 ON, NOTE  86 VOLUME 10
-           0x01,0xdd,0x53,0x0a, //    221 T2 ON, NOTE  83 VOLUME 10
-                0x8f,0xe0,0x08, //     15 T1 ON, NOTE  96 VOLUME  8
-                0x80,0x51,0x0a, //      0 T2 ON, NOTE  81 VOLUME 10
-           0x01,0xf0,0x62,0x08, //    240 T2 ON, NOTE  98 VOLUME  8
-                0x84,0xd4,0x0a, //      4 T1 ON, NOTE  84 VOLUME 10
-           0x01,0xec,0xe0,0x07, //    236 T1 ON, NOTE  96 VOLUME  7
-                0x84,0x51,0x0a, //      4 T2 ON, NOTE  81 VOLUME 10
-           0x01,0xec,0x62,0x08, //    236 T2 ON, NOTE  98 VOLUME  8
-                0x84,0xd4,0x0a, //      4 T1 ON, NOTE  84 VOLUME 10
-           0x01,0xdd,0x51,0x0a, //    221 T2 ON, NOTE  81 VOLUME 10
-                0x8f,0xe0,0x08, //     15 T1 ON, NOTE  96 VOLUME  8
-           0x01,0xf0,0x62,0x08, //    240 T2 ON, NOTE  98 VOLUME  8
-                0x84,0xd4,0x0a, //      4 T1 ON, NOTE  84 VOLUME 10
-           0x01,0xec,0xe0,0x08, //    236 T1 ON, NOTE  96 VOLUME  8
-                0x84,0x51,0x0a, //      4 T2 ON, NOTE  81 VOLUME 10
-           0x01,0xec,0x62,0x08, //    236 T2 ON, NOTE  98 VOLUME  8
-                0x84,0xd4,0x0a, //      4 T1 ON, NOTE  84 VOLUME 10
-           0x01,0xdd,0x51,0x0a, //    221 T2 ON, NOTE  81 VOLUME 10
-                0x8f,0xdf,0x08, //     15 T1 ON, NOTE  95 VOLUME  8
-                0x80,0x4f,0x0a, //      0 T2 ON, NOTE  79 VOLUME 10
-           0x01,0xf0,0x60,0x08, //    240 T2 ON, NOTE  96 VOLUME  8
-                0x84,0xd3,0x0a, //      4 T1 ON, NOTE  83 VOLUME 10
-           0x01,0xec,0xdf,0x08, //    236 T1 ON, NOTE  95 VOLUME  8
-                0x84,0x4f,0x0a, //      4 T2 ON, NOTE  79 VOLUME 10
-           0x01,0xec,0x60,0x08, //    236 T2 ON, NOTE  96 VOLUME  8
-                0x84,0xd3,0x0a, //      4 T1 ON, NOTE  83 VOLUME 10
-           0x01,0xdd,0x4f,0x0a, //    221 T2 ON, NOTE  79 VOLUME 10
-                0x8f,0xdf,0x08, //     15 T1 ON, NOTE  95 VOLUME  8
-           0x01,0xf0,0x60,0x08, //    240 T2 ON, NOTE  96 VOLUME  8
-                0x84,0xd3,0x0a, //      4 T1 ON, NOTE  83 VOLUME 10
-           0x01,0xec,0xdf,0x08, //    236 T1 ON, NOTE  95 VOLUME  8
-                0x84,0x4f,0x0a, //      4 T2 ON, NOTE  79 VOLUME 10
-           0x01,0xec,0x60,0x08, //    236 T2 ON, NOTE  96 VOLUME  8
-                0x84,0xd3,0x0a, //      4 T1 ON, NOTE  83 VOLUME 10
-           0x01,0xdd,0x4f,0x0a, //    221 T2 ON, NOTE  79 VOLUME 10
-                0x8f,0xdd,0x07, //     15 T1 ON, NOTE  93 VOLUME  7
-                0x80,0x51,0x0a, //      0 T2 ON, NOTE  81 VOLUME 10
-           0x01,0xf0,0x5f,0x07, //    240 T2 ON, NOTE  95 VOLUME  7
-                0x84,0xd1,0x0a, //      4 T1 ON, NOTE  81 VOLUME 10
-           0x01,0xdd,0x4f,0x0a, //    221 T2 ON, NOTE  79 VOLUME 10
-                0x8f,0xdd,0x08, //     15 T1 ON, NOTE  93 VOLUME  8
-                0x80,0x51,0x0a, //      0 T2 ON, NOTE  81 VOLUME 10
-           0x01,0xf0,0xdf,0x09, //    240 T1 ON, NOTE  95 VOLUME  9
-           0x01,0xf0,0xdd,0x07, //    240 T1 ON, NOTE  93 VOLUME  7
-                0x80,0x4f,0x0a, //      0 T2 ON, NOTE  79 VOLUME 10
-           0x01,0xf0,0x5f,0x08, //    240 T2 ON, NOTE  95 VOLUME  8
-                0x84,0xcf,0x0a, //      4 T1 ON, NOTE  79 VOLUME 10
-           0x01,0xec,0xdd,0x08, //    236 T1 ON, NOTE  93 VOLUME  8
-                0x84,0x4f,0x0a, //      4 T2 ON, NOTE  79 VOLUME 10
-           0x01,0xec,0x5f,0x08, //    236 T2 ON, NOTE  95 VOLUME  8
-                0x84,0xcf,0x0a, //      4 T1 ON, NOTE  79 VOLUME 10
-           0x01,0xdd,0x4c,0x0a, //    221 T2 ON, NOTE  76 VOLUME 10
-                0x8f,0xdd,0x07, //     15 T1 ON, NOTE  93 VOLUME  7
-                0x80,0x4e,0x0a, //      0 T2 ON, NOTE  78 VOLUME 10
-           0x03,0xe0,0xd1,0x0a, //    480 T1 ON, NOTE  81 VOLUME 10
-                0x03,0xe0,0x01, //    480 BOTH OFF
-           0x03,0xe0,0xd6,0x07, //    480 T1 ON, NOTE  86 VOLUME  7
-                0x80,0x56,0x07, //      0 T2 ON, NOTE  86 VOLUME  7
-           0x03,0xe0,0xdb,0x09, //    480 T1 ON, NOTE  91 VOLUME  9
-                0x80,0x4f,0x07, //      0 T2 ON, NOTE  79 VOLUME  7
-           0x03,0xe0,0xdb,0x08, //    480 T1 ON, NOTE  91 VOLUME  8
-                0x80,0x4a,0x07, //      0 T2 ON, NOTE  74 VOLUME  7
-           0x0b,0xa0,0xdf,0x09, //   1440 T1 ON, NOTE  95 VOLUME  9
-                0x80,0x53,0x09, //      0 T2 ON, NOTE  83 VOLUME  9
-           0x03,0xe0,0xdd,0x08, //    480 T1 ON, NOTE  93 VOLUME  8
-                0x80,0x51,0x08, //      0 T2 ON, NOTE  81 VOLUME  8
-           0x03,0xe0,0xdb,0x08, //    480 T1 ON, NOTE  91 VOLUME  8
-                0x80,0x4f,0x08, //      0 T2 ON, NOTE  79 VOLUME  8
-           0x03,0xe0,0xda,0x08, //    480 T1 ON, NOTE  90 VOLUME  8
-                0x80,0x4b,0x07, //      0 T2 ON, NOTE  75 VOLUME  7
-           0x03,0xe0,0xdb,0x08, //    480 T1 ON, NOTE  91 VOLUME  8
-                0x80,0x4f,0x08, //      0 T2 ON, NOTE  79 VOLUME  8
-           0x03,0xe0,0xd8,0x07, //    480 T1 ON, NOTE  88 VOLUME  7
-                0x80,0x48,0x08, //      0 T2 ON, NOTE  72 VOLUME  8
-           0x03,0xe0,0xe2,0x07, //    480 T1 ON, NOTE  98 VOLUME  7
-                0x80,0x4a,0x0a, //      0 T2 ON, NOTE  74 VOLUME 10
-           0x01,0xf0,0x64,0x07, //    240 T2 ON, NOTE 100 VOLUME  7
-                0x84,0xd6,0x0a, //      4 T1 ON, NOTE  86 VOLUME 10
-           0x01,0xec,0xe2,0x08, //    236 T1 ON, NOTE  98 VOLUME  8
-                0x84,0x4a,0x0a, //      4 T2 ON, NOTE  74 VOLUME 10
-           0x01,0xec,0x64,0x08, //    236 T2 ON, NOTE 100 VOLUME  8
-                0x84,0xd6,0x0a, //      4 T1 ON, NOTE  86 VOLUME 10
-           0x01,0xe1,0x4a,0x0a, //    225 T2 ON, NOTE  74 VOLUME 10
-                0x8b,0xe2,0x08, //     11 T1 ON, NOTE  98 VOLUME  8
-                0x80,0x53,0x0a, //      0 T2 ON, NOTE  83 VOLUME 10
-           0x01,0xf0,0x64,0x08, //    240 T2 ON, NOTE 100 VOLUME  8
-                0x84,0xd6,0x0a, //      4 T1 ON, NOTE  86 VOLUME 10
-           0x01,0xec,0xe2,0x08, //    236 T1 ON, NOTE  98 VOLUME  8
-                0x84,0x53,0x0a, //      4 T2 ON, NOTE  83 VOLUME 10
-           0x01,0xec,0x64,0x09, //    236 T2 ON, NOTE 100 VOLUME  9
-                0x84,0xd6,0x0a, //      4 T1 ON, NOTE  86 VOLUME 10
-           0x01,0xdd,0x53,0x0a, //    221 T2 ON, NOTE  83 VOLUME 10
-                0x8f,0xe0,0x08, //     15 T1 ON, NOTE  96 VOLUME  8
-                0x80,0x51,0x0a, //      0 T2 ON, NOTE  81 VOLUME 10
-           0x01,0xf0,0x62,0x08, //    240 T2 ON, NOTE  98 VOLUME  8
-                0x84,0xd4,0x0a, //      4 T1 ON, NOTE  84 VOLUME 10
-           0x01,0xec,0xe0,0x08, //    236 T1 ON, NOTE  96 VOLUME  8
-                0x84,0x51,0x0a, //      4 T2 ON, NOTE  81 VOLUME 10
-           0x01,0xec,0x62,0x08, //    236 T2 ON, NOTE  98 VOLUME  8
-                0x84,0xd4,0x0a, //      4 T1 ON, NOTE  84 VOLUME 10
-           0x01,0xdd,0x51,0x0a, //    221 T2 ON, NOTE  81 VOLUME 10
-                0x8f,0xe0,0x08, //     15 T1 ON, NOTE  96 VOLUME  8
-           0x01,0xf0,0x62,0x08, //    240 T2 ON, NOTE  98 VOLUME  8
-                0x84,0xd4,0x0a, //      4 T1 ON, NOTE  84 VOLUME 10
-           0x01,0xec,0xe0,0x07, //    236 T1 ON, NOTE  96 VOLUME  7
-                0x84,0x51,0x0a, //      4 T2 ON, NOTE  81 VOLUME 10
-           0x01,0xec,0x62,0x08, //    236 T2 ON, NOTE  98 VOLUME  8
-                0x84,0xd4,0x0a, //      4 T1 ON, NOTE  84 VOLUME 10
-           0x01,0xdd,0x51,0x0a, //    221 T2 ON, NOTE  81 VOLUME 10
-                0x8f,0xdf,0x08, //     15 T1 ON, NOTE  95 VOLUME  8
-                0x80,0x4f,0x0a, //      0 T2 ON, NOTE  79 VOLUME 10
-           0x01,0xf0,0x60,0x08, //    240 T2 ON, NOTE  96 VOLUME  8
-                0x84,0xd3,0x0a, //      4 T1 ON, NOTE  83 VOLUME 10
-           0x01,0xec,0xdf,0x08, //    236 T1 ON, NOTE  95 VOLUME  8
-                0x84,0x4f,0x0a, //      4 T2 ON, NOTE  79 VOLUME 10
-           0x01,0xec,0x60,0x08, //    236 T2 ON, NOTE  96 VOLUME  8
-                0x84,0xd3,0x0a, //      4 T1 ON, NOTE  83 VOLUME 10
-           0x01,0xdd,0x4f,0x0a, //    221 T2 ON, NOTE  79 VOLUME 10
-                0x8f,0xdf,0x08, //     15 T1 ON, NOTE  95 VOLUME  8
-           0x01,0xf0,0x60,0x09, //    240 T2 ON, NOTE  96 VOLUME  9
-                0x84,0xd3,0x0a, //      4 T1 ON, NOTE  83 VOLUME 10
-           0x01,0xec,0xdf,0x07, //    236 T1 ON, NOTE  95 VOLUME  7
-                0x84,0x4f,0x0a, //      4 T2 ON, NOTE  79 VOLUME 10
-           0x01,0xec,0x60,0x08, //    236 T2 ON, NOTE  96 VOLUME  8
-                0x84,0xd3,0x0a, //      4 T1 ON, NOTE  83 VOLUME 10
-           0x01,0xdd,0x4f,0x0a, //    221 T2 ON, NOTE  79 VOLUME 10
-                0x8f,0xdd,0x07, //     15 T1 ON, NOTE  93 VOLUME  7
-                0x80,0x58,0x0a, //      0 T2 ON, NOTE  88 VOLUME 10
-           0x01,0xf0,0x5f,0x07, //    240 T2 ON, NOTE  95 VOLUME  7
-                0x84,0xd8,0x0a, //      4 T1 ON, NOTE  88 VOLUME 10
-           0x01,0xdd,0x51,0x0a, //    221 T2 ON, NOTE  81 VOLUME 10
-                0x8f,0x5d,0x08, //     15 T2 ON, NOTE  93 VOLUME  8
-           0x01,0xf0,0x5f,0x09, //    240 T2 ON, NOTE  95 VOLUME  9
-           0x01,0xf0,0xdd,0x08, //    240 T1 ON, NOTE  93 VOLUME  8
-                0x80,0x5a,0x0a, //      0 T2 ON, NOTE  90 VOLUME 10
-           0x01,0xf0,0x5f,0x09, //    240 T2 ON, NOTE  95 VOLUME  9
-                0x84,0xda,0x0a, //      4 T1 ON, NOTE  90 VOLUME 10
-           0x01,0xec,0xdd,0x08, //    236 T1 ON, NOTE  93 VOLUME  8
-                0x84,0x5a,0x0a, //      4 T2 ON, NOTE  90 VOLUME 10
-           0x01,0xec,0x5f,0x08, //    236 T2 ON, NOTE  95 VOLUME  8
-                0x84,0xda,0x0a, //      4 T1 ON, NOTE  90 VOLUME 10
-           0x01,0xdd,0x51,0x0a, //    221 T2 ON, NOTE  81 VOLUME 10
-                0x8f,0xdb,0x07, //     15 T1 ON, NOTE  91 VOLUME  7
-                0x80,0x56,0x0a, //      0 T2 ON, NOTE  86 VOLUME 10
-           0x03,0xe0,0xcf,0x0a, //    480 T1 ON, NOTE  79 VOLUME 10
-                0x03,0xe0,0x01, //    480 BOTH OFF
-           0x07,0xc0,0xd3,0x05, //    960 T1 ON, NOTE  83 VOLUME  5
-                0x80,0x43,0x05, //      0 T2 ON, NOTE  67 VOLUME  5
-                0x03,0xe0,0x01, //    480 BOTH OFF
-           0x03,0xe0,0xd4,0x06, //    480 T1 ON, NOTE  84 VOLUME  6
-                0x80,0x45,0x05, //      0 T2 ON, NOTE  69 VOLUME  5
-                0x03,0xe0,0x01, //    480 BOTH OFF
-           0x03,0xe0,0xd3,0x05, //    480 T1 ON, NOTE  83 VOLUME  5
-                0x80,0x4f,0x04, //      0 T2 ON, NOTE  79 VOLUME  4
-                0x03,0xe0,0x80, //    480 T1 OFF
-           0x07,0xc0,0xcc,0x05, //    960 T1 ON, NOTE  76 VOLUME  5
-                0x01,0xf0,0x01, //    240 BOTH OFF
-           0x01,0xf0,0xd1,0x05, //    240 T1 ON, NOTE  81 VOLUME  5
-                0x80,0x4e,0x05, //      0 T2 ON, NOTE  78 VOLUME  5
-                0x03,0xe0,0x01, //    480 BOTH OFF
-           0x07,0xc0,0xce,0x05, //    960 T1 ON, NOTE  78 VOLUME  5
-                0x80,0x4b,0x05, //      0 T2 ON, NOTE  75 VOLUME  5
-                0x01,0xf0,0x01, //    240 BOTH OFF
-           0x01,0xf0,0xcf,0x05, //    240 T1 ON, NOTE  79 VOLUME  5
-                0x80,0x4f,0x06, //      0 T2 ON, NOTE  79 VOLUME  6
-                0x03,0xe0,0x01, //    480 BOTH OFF
-           0x0b,0xa0,0xd3,0x05, //   1440 T1 ON, NOTE  83 VOLUME  5
-                0x80,0x43,0x05, //      0 T2 ON, NOTE  67 VOLUME  5
-                0x03,0xe0,0x01, //    480 BOTH OFF
-           0x03,0xe0,0xd4,0x05, //    480 T1 ON, NOTE  84 VOLUME  5
-                0x80,0x45,0x05, //      0 T2 ON, NOTE  69 VOLUME  5
-                0x03,0xe0,0x01, //    480 BOTH OFF
-           0x03,0xe0,0xd3,0x05, //    480 T1 ON, NOTE  83 VOLUME  5
-                0x80,0x43,0x05, //      0 T2 ON, NOTE  67 VOLUME  5
-                0x03,0xe0,0x01, //    480 BOTH OFF
-           0x07,0xc0,0xcf,0x05, //    960 T1 ON, NOTE  79 VOLUME  5
-                0x80,0x4c,0x04, //      0 T2 ON, NOTE  76 VOLUME  4
-                0x01,0xf0,0x01, //    240 BOTH OFF
-           0x01,0xf0,0xd1,0x06, //    240 T1 ON, NOTE  81 VOLUME  6
-                0x80,0x4e,0x06, //      0 T2 ON, NOTE  78 VOLUME  6
-                0x03,0xe0,0x01, //    480 BOTH OFF
-           0x07,0xc0,0xce,0x05, //    960 T1 ON, NOTE  78 VOLUME  5
-                0x80,0x4b,0x05, //      0 T2 ON, NOTE  75 VOLUME  5
-                0x01,0xf0,0x01, //    240 BOTH OFF
-           0x01,0xf0,0xcf,0x05, //    240 T1 ON, NOTE  79 VOLUME  5
-                0x80,0x4c,0x05, //      0 T2 ON, NOTE  76 VOLUME  5
-                0x03,0xe0,0x01, //    480 BOTH OFF
-           0x0b,0xa0,0xce,0x05, //   1440 T1 ON, NOTE  78 VOLUME  5
-                0x80,0x4b,0x05, //      0 T2 ON, NOTE  75 VOLUME  5
-                0x03,0xe0,0x01, //    480 BOTH OFF
-           0x07,0xc0,0xcf,0x05, //    960 T1 ON, NOTE  79 VOLUME  5
-                0x80,0x4c,0x05, //      0 T2 ON, NOTE  76 VOLUME  5
-                0x01,0xf0,0x01, //    240 BOTH OFF
-           0x01,0xf0,0xce,0x04, //    240 T1 ON, NOTE  78 VOLUME  4
-                0x80,0x4b,0x05, //      0 T2 ON, NOTE  75 VOLUME  5
-                0x03,0xe0,0x01, //    480 BOTH OFF
-           0x07,0xc0,0xcf,0x05, //    960 T1 ON, NOTE  79 VOLUME  5
-                0x80,0x4c,0x05, //      0 T2 ON, NOTE  76 VOLUME  5
-                0x01,0xf0,0x01, //    240 BOTH OFF
-           0x01,0xf0,0xce,0x05, //    240 T1 ON, NOTE  78 VOLUME  5
-                0x80,0x4a,0x05, //      0 T2 ON, NOTE  74 VOLUME  5
-                0x03,0xe0,0x01, //    480 BOTH OFF
-           0x03,0xe0,0xcc,0x05, //    480 T1 ON, NOTE  76 VOLUME  5
-                0x80,0x49,0x05, //      0 T2 ON, NOTE  73 VOLUME  5
-                0x03,0xe0,0x01, //    480 BOTH OFF
-           0x03,0xe0,0xca,0x05, //    480 T1 ON, NOTE  74 VOLUME  5
-                0x80,0x47,0x05, //      0 T2 ON, NOTE  71 VOLUME  5
-                0x03,0xe0,0x01, //    480 BOTH OFF
-           0x0b,0xa0,0xca,0x06, //   1440 T1 ON, NOTE  74 VOLUME  6
-                0x80,0x47,0x05, //      0 T2 ON, NOTE  71 VOLUME  5
-           0x07,0xc0,0xc7,0x06, //    960 T1 ON, NOTE  71 VOLUME  6
-                0x80,0x43,0x05, //      0 T2 ON, NOTE  67 VOLUME  5
-           0x03,0xe0,0xca,0x06, //    480 T1 ON, NOTE  74 VOLUME  6
-                0x80,0x45,0x06, //      0 T2 ON, NOTE  69 VOLUME  6
-           0x03,0xe0,0xcf,0x07, //    480 T1 ON, NOTE  79 VOLUME  7
-                0x80,0x47,0x07, //      0 T2 ON, NOTE  71 VOLUME  7
-           0x07,0xc0,0xcf,0x06, //    960 T1 ON, NOTE  79 VOLUME  6
-           0x03,0xe0,0xd1,0x06, //    480 T1 ON, NOTE  81 VOLUME  6
-                0x80,0x48,0x07, //      0 T2 ON, NOTE  72 VOLUME  7
-           0x03,0xe0,0xd3,0x06, //    480 T1 ON, NOTE  83 VOLUME  6
-                0x80,0x4a,0x05, //      0 T2 ON, NOTE  74 VOLUME  5
-           0x07,0xc0,0xd5,0x06, //    960 T1 ON, NOTE  85 VOLUME  6
-                0x80,0x4c,0x06, //      0 T2 ON, NOTE  76 VOLUME  6
-           0x07,0xc0,0xd6,0x06, //    960 T1 ON, NOTE  86 VOLUME  6
-                0x80,0x4f,0x06, //      0 T2 ON, NOTE  79 VOLUME  6
-           0x07,0xc0,0xd3,0x06, //    960 T1 ON, NOTE  83 VOLUME  6
-           0x07,0xc0,0xd4,0x07, //    960 T1 ON, NOTE  84 VOLUME  7
-                0x80,0x51,0x06, //      0 T2 ON, NOTE  81 VOLUME  6
-           0x07,0xc0,0xd4,0x06, //    960 T1 ON, NOTE  84 VOLUME  6
-           0x07,0xc0,0xd3,0x06, //    960 T1 ON, NOTE  83 VOLUME  6
-                0x80,0x4f,0x06, //      0 T2 ON, NOTE  79 VOLUME  6
-           0x0f,0x80,0xcc,0x05, //   1920 T1 ON, NOTE  76 VOLUME  5
-                0x80,0x45,0x05, //      0 T2 ON, NOTE  69 VOLUME  5
-           0x07,0xc0,0xcc,0x06, //    960 T1 ON, NOTE  76 VOLUME  6
-                0x80,0x45,0x06, //      0 T2 ON, NOTE  69 VOLUME  6
-           0x07,0xc0,0xce,0x06, //    960 T1 ON, NOTE  78 VOLUME  6
-                0x80,0x4a,0x04, //      0 T2 ON, NOTE  74 VOLUME  4
-                0x07,0xc0,0x01, //    960 BOTH OFF
-           0x07,0xc0,0xca,0x05, //    960 T1 ON, NOTE  74 VOLUME  5
-                0x80,0x47,0x05, //      0 T2 ON, NOTE  71 VOLUME  5
-                0x07,0xc0,0x01, //    960 BOTH OFF
-           0x03,0xe0,0xca,0x07, //    480 T1 ON, NOTE  74 VOLUME  7
-           0x03,0xe0,0xcf,0x07, //    480 T1 ON, NOTE  79 VOLUME  7
-                0x80,0x47,0x05, //      0 T2 ON, NOTE  71 VOLUME  5
-           0x07,0xc0,0xcf,0x06, //    960 T1 ON, NOTE  79 VOLUME  6
-                     0x80,0x00, //      0 T2 OFF
-           0x03,0xe0,0xd1,0x06, //    480 T1 ON, NOTE  81 VOLUME  6
-           0x03,0xe0,0xd3,0x07, //    480 T1 ON, NOTE  83 VOLUME  7
-                0x80,0x43,0x05, //      0 T2 ON, NOTE  67 VOLUME  5
-           0x07,0xc0,0xd5,0x06, //    960 T1 ON, NOTE  85 VOLUME  6
-                0x80,0x4c,0x07, //      0 T2 ON, NOTE  76 VOLUME  7
-           0x07,0xc0,0xd6,0x07, //    960 T1 ON, NOTE  86 VOLUME  7
-                0x80,0x4f,0x07, //      0 T2 ON, NOTE  79 VOLUME  7
-           0x07,0xc0,0xd3,0x05, //    960 T1 ON, NOTE  83 VOLUME  5
-                0x80,0x4f,0x06, //      0 T2 ON, NOTE  79 VOLUME  6
-           0x07,0xc0,0xd4,0x06, //    960 T1 ON, NOTE  84 VOLUME  6
-                0x80,0x45,0x04, //      0 T2 ON, NOTE  69 VOLUME  4
-           0x07,0xc0,0x45,0x06, //    960 T2 ON, NOTE  69 VOLUME  6
-           0x07,0xc0,0xd3,0x06, //    960 T1 ON, NOTE  83 VOLUME  6
-                0x80,0x4f,0x06, //      0 T2 ON, NOTE  79 VOLUME  6
-           0x0f,0x80,0xd1,0x05, //   1920 T1 ON, NOTE  81 VOLUME  5
-                0x03,0xe0,0x80, //    480 T1 OFF
-           0x03,0xe0,0xce,0x06, //    480 T1 ON, NOTE  78 VOLUME  6
-                0x80,0x4a,0x05, //      0 T2 ON, NOTE  74 VOLUME  5
-                0x03,0xe0,0x80, //    480 T1 OFF
-           0x03,0xe0,0xcf,0x07, //    480 T1 ON, NOTE  79 VOLUME  7
-                0x80,0x47,0x06, //      0 T2 ON, NOTE  71 VOLUME  6
-           0x01,0xf0,0xc3,0x07, //    240 T1 ON, NOTE  67 VOLUME  7
-                0x01,0xf0,0x01, //    240 BOTH OFF
-           0x03,0xe0,0xc8,0x07, //    480 T1 ON, NOTE  72 VOLUME  7
-           0x01,0xf0,0x4a,0x07, //    240 T2 ON, NOTE  74 VOLUME  7
-                     0x84,0x80, //      4 T1 OFF
-                0x01,0xdd,0x01, //    221 BOTH OFF
-                0x8f,0xcc,0x09, //     15 T1 ON, NOTE  76 VOLUME  9
-           0x01,0xf0,0xce,0x08, //    240 T1 ON, NOTE  78 VOLUME  8
-           0x01,0xf0,0xdb,0x07, //    240 T1 ON, NOTE  91 VOLUME  7
-                0x80,0x4f,0x08, //      0 T2 ON, NOTE  79 VOLUME  8
-           0x03,0xe0,0xdb,0x08, //    480 T1 ON, NOTE  91 VOLUME  8
-                0x80,0x4a,0x07, //      0 T2 ON, NOTE  74 VOLUME  7
-           0x0b,0xa0,0xdf,0x09, //   1440 T1 ON, NOTE  95 VOLUME  9
-                0x80,0x53,0x09, //      0 T2 ON, NOTE  83 VOLUME  9
-           0x03,0xe0,0xdd,0x08, //    480 T1 ON, NOTE  93 VOLUME  8
-                0x80,0x51,0x08, //      0 T2 ON, NOTE  81 VOLUME  8
-           0x03,0xe0,0xdb,0x08, //    480 T1 ON, NOTE  91 VOLUME  8
-                0x80,0x4f,0x08, //      0 T2 ON, NOTE  79 VOLUME  8
-           0x03,0xe0,0xda,0x08, //    480 T1 ON, NOTE  90 VOLUME  8
-                0x80,0x4e,0x08, //      0 T2 ON, NOTE  78 VOLUME  8
-           0x03,0xe0,0xdb,0x08, //    480 T1 ON, NOTE  91 VOLUME  8
-                0x80,0x4f,0x08, //      0 T2 ON, NOTE  79 VOLUME  8
-           0x03,0xe0,0xd8,0x07, //    480 T1 ON, NOTE  88 VOLUME  7
-                0x80,0x48,0x07, //      0 T2 ON, NOTE  72 VOLUME  7
-           0x03,0xe0,0xe2,0x08, //    480 T1 ON, NOTE  98 VOLUME  8
-                0x80,0x4a,0x08, //      0 T2 ON, NOTE  74 VOLUME  8
-           0x01,0xf0,0x64,0x08, //    240 T2 ON, NOTE 100 VOLUME  8
-                0x84,0xd6,0x0a, //      4 T1 ON, NOTE  86 VOLUME 10
-           0x01,0xec,0xe2,0x08, //    236 T1 ON, NOTE  98 VOLUME  8
-                0x84,0x4a,0x08, //      4 T2 ON, NOTE  74 VOLUME  8
-           0x01,0xec,0x64,0x09, //    236 T2 ON, NOTE 100 VOLUME  9
-                0x84,0xd6,0x0a, //      4 T1 ON, NOTE  86 VOLUME 10
-           0x01,0xdd,0x4a,0x08, //    221 T2 ON, NOTE  74 VOLUME  8
-                0x8f,0xe2,0x08, //     15 T1 ON, NOTE  98 VOLUME  8
-                0x80,0x53,0x0a, //      0 T2 ON, NOTE  83 VOLUME 10
-           0x01,0xf0,0x64,0x08, //    240 T2 ON, NOTE 100 VOLUME  8
-                0x84,0xd6,0x0a, //      4 T1 ON, NOTE  86 VOLUME 10
-           0x01,0xec,0xe2,0x08, //    236 T1 ON, NOTE  98 VOLUME  8
-                0x84,0x53,0x0a, //      4 T2 ON, NOTE  83 VOLUME 10
-           0x01,0xec,0x64,0x08, //    236 T2 ON, NOTE 100 VOLUME  8
-                0x84,0xd6,0x0a, //      4 T1 ON, NOTE  86 VOLUME 10
-           0x01,0xdd,0x53,0x0a, //    221 T2 ON, NOTE  83 VOLUME 10
-                0x8f,0xe0,0x08, //     15 T1 ON, NOTE  96 VOLUME  8
-                0x80,0x51,0x0a, //      0 T2 ON, NOTE  81 VOLUME 10
-           0x01,0xf0,0x62,0x08, //    240 T2 ON, NOTE  98 VOLUME  8
-                0x84,0xd4,0x0a, //      4 T1 ON, NOTE  84 VOLUME 10
-           0x01,0xec,0xe0,0x08, //    236 T1 ON, NOTE  96 VOLUME  8
-                0x84,0x51,0x0a, //      4 T2 ON, NOTE  81 VOLUME 10
-           0x01,0xec,0x62,0x08, //    236 T2 ON, NOTE  98 VOLUME  8
-                0x84,0xd4,0x0a, //      4 T1 ON, NOTE  84 VOLUME 10
-           0x01,0xdd,0x51,0x0a, //    221 T2 ON, NOTE  81 VOLUME 10
-                0x8f,0xe0,0x08, //     15 T1 ON, NOTE  96 VOLUME  8
-           0x01,0xf0,0x62,0x08, //    240 T2 ON, NOTE  98 VOLUME  8
-                0x84,0xd4,0x0a, //      4 T1 ON, NOTE  84 VOLUME 10
-           0x01,0xec,0xe0,0x08, //    236 T1 ON, NOTE  96 VOLUME  8
-                0x84,0x51,0x0a, //      4 T2 ON, NOTE  81 VOLUME 10
-           0x01,0xec,0x62,0x08, //    236 T2 ON, NOTE  98 VOLUME  8
-                0x84,0xd4,0x0a, //      4 T1 ON, NOTE  84 VOLUME 10
-           0x01,0xdd,0x51,0x0a, //    221 T2 ON, NOTE  81 VOLUME 10
-                0x8f,0xdf,0x08, //     15 T1 ON, NOTE  95 VOLUME  8
-                0x80,0x4f,0x0a, //      0 T2 ON, NOTE  79 VOLUME 10
-           0x01,0xf0,0x60,0x08, //    240 T2 ON, NOTE  96 VOLUME  8
-                0x84,0xd3,0x0a, //      4 T1 ON, NOTE  83 VOLUME 10
-           0x01,0xec,0xdf,0x08, //    236 T1 ON, NOTE  95 VOLUME  8
-                0x84,0x4f,0x0a, //      4 T2 ON, NOTE  79 VOLUME 10
-           0x01,0xec,0x60,0x08, //    236 T2 ON, NOTE  96 VOLUME  8
-                0x84,0xd3,0x0a, //      4 T1 ON, NOTE  83 VOLUME 10
-           0x01,0xdd,0x4f,0x0a, //    221 T2 ON, NOTE  79 VOLUME 10
-                0x8f,0xdf,0x08, //     15 T1 ON, NOTE  95 VOLUME  8
-           0x01,0xf0,0x60,0x08, //    240 T2 ON, NOTE  96 VOLUME  8
-                0x84,0xd3,0x0a, //      4 T1 ON, NOTE  83 VOLUME 10
-           0x01,0xec,0xdf,0x08, //    236 T1 ON, NOTE  95 VOLUME  8
-                0x84,0x4f,0x0a, //      4 T2 ON, NOTE  79 VOLUME 10
-           0x01,0xec,0x60,0x08, //    236 T2 ON, NOTE  96 VOLUME  8
-                0x84,0xd3,0x0a, //      4 T1 ON, NOTE  83 VOLUME 10
-           0x01,0xdd,0x4f,0x0a, //    221 T2 ON, NOTE  79 VOLUME 10
-                0x8f,0xdd,0x07, //     15 T1 ON, NOTE  93 VOLUME  7
-                0x80,0x51,0x0a, //      0 T2 ON, NOTE  81 VOLUME 10
-           0x01,0xf0,0x5f,0x08, //    240 T2 ON, NOTE  95 VOLUME  8
-                0x84,0xd1,0x0a, //      4 T1 ON, NOTE  81 VOLUME 10
-           0x01,0xdd,0x4f,0x0a, //    221 T2 ON, NOTE  79 VOLUME 10
-                0x8f,0xdd,0x08, //     15 T1 ON, NOTE  93 VOLUME  8
-                0x80,0x51,0x0a, //      0 T2 ON, NOTE  81 VOLUME 10
-           0x01,0xf0,0xdf,0x08, //    240 T1 ON, NOTE  95 VOLUME  8
-           0x01,0xf0,0xdd,0x07, //    240 T1 ON, NOTE  93 VOLUME  7
-                0x80,0x4f,0x0a, //      0 T2 ON, NOTE  79 VOLUME 10
-           0x01,0xf0,0x5f,0x08, //    240 T2 ON, NOTE  95 VOLUME  8
-                0x84,0xcf,0x0a, //      4 T1 ON, NOTE  79 VOLUME 10
-           0x01,0xec,0xdd,0x07, //    236 T1 ON, NOTE  93 VOLUME  7
-                0x84,0x4f,0x0a, //      4 T2 ON, NOTE  79 VOLUME 10
-           0x01,0xec,0x5f,0x08, //    236 T2 ON, NOTE  95 VOLUME  8
-                0x84,0xcf,0x0a, //      4 T1 ON, NOTE  79 VOLUME 10
-           0x01,0xdd,0x4c,0x0a, //    221 T2 ON, NOTE  76 VOLUME 10
-                0x8f,0xdd,0x08, //     15 T1 ON, NOTE  93 VOLUME  8
-                0x80,0x4e,0x0a, //      0 T2 ON, NOTE  78 VOLUME 10
-           0x03,0xe0,0xd1,0x0a, //    480 T1 ON, NOTE  81 VOLUME 10
-                0x03,0xe0,0x01, //    480 BOTH OFF
-           0x03,0xe0,0xd6,0x07, //    480 T1 ON, NOTE  86 VOLUME  7
-                0x80,0x56,0x07, //      0 T2 ON, NOTE  86 VOLUME  7
-           0x03,0xe0,0xdb,0x07, //    480 T1 ON, NOTE  91 VOLUME  7
-                0x80,0x4f,0x08, //      0 T2 ON, NOTE  79 VOLUME  8
-           0x03,0xe0,0xdb,0x08, //    480 T1 ON, NOTE  91 VOLUME  8
-                0x80,0x4a,0x07, //      0 T2 ON, NOTE  74 VOLUME  7
-           0x09,0xb0,0xdf,0x09, //   1200 T1 ON, NOTE  95 VOLUME  9
-                0x80,0x53,0x09, //      0 T2 ON, NOTE  83 VOLUME  9
-           0x03,0xe0,0xdd,0x08, //    480 T1 ON, NOTE  93 VOLUME  8
-                0x80,0x51,0x0a, //      0 T2 ON, NOTE  81 VOLUME 10
-           0x03,0xe0,0xdb,0x07, //    480 T1 ON, NOTE  91 VOLUME  7
-                0x80,0x4f,0x07, //      0 T2 ON, NOTE  79 VOLUME  7
-           0x03,0xe0,0xda,0x08, //    480 T1 ON, NOTE  90 VOLUME  8
-                0x80,0x4e,0x08, //      0 T2 ON, NOTE  78 VOLUME  8
-           0x03,0xe0,0xdb,0x09, //    480 T1 ON, NOTE  91 VOLUME  9
-                0x80,0x4f,0x09, //      0 T2 ON, NOTE  79 VOLUME  9
-           0x03,0xe0,0xd8,0x07, //    480 T1 ON, NOTE  88 VOLUME  7
-                0x80,0x48,0x08, //      0 T2 ON, NOTE  72 VOLUME  8
-           0x03,0xe0,0xe2,0x07, //    480 T1 ON, NOTE  98 VOLUME  7
-                0x80,0x4a,0x09, //      0 T2 ON, NOTE  74 VOLUME  9
-           0x01,0xf0,0x64,0x08, //    240 T2 ON, NOTE 100 VOLUME  8
-                0x84,0xd6,0x0a, //      4 T1 ON, NOTE  86 VOLUME 10
-           0x01,0xec,0xe2,0x08, //    236 T1 ON, NOTE  98 VOLUME  8
-                0x84,0x4a,0x09, //      4 T2 ON, NOTE  74 VOLUME  9
-           0x01,0xec,0x64,0x09, //    236 T2 ON, NOTE 100 VOLUME  9
-                0x84,0xd6,0x0a, //      4 T1 ON, NOTE  86 VOLUME 10
-           0x01,0xdd,0x4a,0x08, //    221 T2 ON, NOTE  74 VOLUME  8
-                0x8f,0xe2,0x07, //     15 T1 ON, NOTE  98 VOLUME  7
-                0x80,0x53,0x0a, //      0 T2 ON, NOTE  83 VOLUME 10
-           0x01,0xf0,0x64,0x08, //    240 T2 ON, NOTE 100 VOLUME  8
-                0x84,0xd6,0x0a, //      4 T1 ON, NOTE  86 VOLUME 10
-           0x01,0xec,0xe2,0x08, //    236 T1 ON, NOTE  98 VOLUME  8
-                0x84,0x53,0x0a, //      4 T2 ON, NOTE  83 VOLUME 10
-           0x01,0xec,0x64,0x08, //    236 T2 ON, NOTE 100 VOLUME  8
-                0x84,0xd6,0x0a, //      4 T1 ON, NOTE  86 VOLUME 10
-           0x01,0xdd,0x53,0x0a, //    221 T2 ON, NOTE  83 VOLUME 10
-                0x8f,0xe0,0x07, //     15 T1 ON, NOTE  96 VOLUME  7
-                0x80,0x51,0x0a, //      0 T2 ON, NOTE  81 VOLUME 10
-           0x01,0xf0,0x62,0x08, //    240 T2 ON, NOTE  98 VOLUME  8
-                0x84,0xd4,0x0a, //      4 T1 ON, NOTE  84 VOLUME 10
-           0x01,0xec,0xe0,0x08, //    236 T1 ON, NOTE  96 VOLUME  8
-                0x84,0x51,0x0a, //      4 T2 ON, NOTE  81 VOLUME 10
-           0x01,0xec,0x62,0x08, //    236 T2 ON, NOTE  98 VOLUME  8
-                0x84,0xd4,0x0a, //      4 T1 ON, NOTE  84 VOLUME 10
-           0x01,0xdd,0x51,0x0a, //    221 T2 ON, NOTE  81 VOLUME 10
-                0x8f,0xe0,0x08, //     15 T1 ON, NOTE  96 VOLUME  8
-           0x01,0xf0,0x62,0x08, //    240 T2 ON, NOTE  98 VOLUME  8
-                0x84,0xd4,0x0a, //      4 T1 ON, NOTE  84 VOLUME 10
-           0x01,0xec,0xe0,0x08, //    236 T1 ON, NOTE  96 VOLUME  8
-                0x84,0x51,0x0a, //      4 T2 ON, NOTE  81 VOLUME 10
-           0x01,0xec,0x62,0x09, //    236 T2 ON, NOTE  98 VOLUME  9
-                0x84,0xd4,0x0a, //      4 T1 ON, NOTE  84 VOLUME 10
-           0x01,0xdd,0x51,0x0a, //    221 T2 ON, NOTE  81 VOLUME 10
-                0x8f,0xdf,0x07, //     15 T1 ON, NOTE  95 VOLUME  7
-                0x80,0x4f,0x0a, //      0 T2 ON, NOTE  79 VOLUME 10
-           0x01,0xf0,0x60,0x08, //    240 T2 ON, NOTE  96 VOLUME  8
-                0x84,0xd3,0x0a, //      4 T1 ON, NOTE  83 VOLUME 10
-           0x01,0xec,0xdf,0x08, //    236 T1 ON, NOTE  95 VOLUME  8
-                0x84,0x4f,0x0a, //      4 T2 ON, NOTE  79 VOLUME 10
-           0x01,0xec,0x60,0x08, //    236 T2 ON, NOTE  96 VOLUME  8
-                0x84,0xd3,0x0a, //      4 T1 ON, NOTE  83 VOLUME 10
-           0x01,0xdd,0x4f,0x0a, //    221 T2 ON, NOTE  79 VOLUME 10
-                0x8f,0xdf,0x08, //     15 T1 ON, NOTE  95 VOLUME  8
-           0x01,0xf0,0x60,0x08, //    240 T2 ON, NOTE  96 VOLUME  8
-                0x84,0xd3,0x0a, //      4 T1 ON, NOTE  83 VOLUME 10
-           0x01,0xec,0xdf,0x08, //    236 T1 ON, NOTE  95 VOLUME  8
-                0x84,0x4f,0x0a, //      4 T2 ON, NOTE  79 VOLUME 10
-           0x01,0xec,0x60,0x08, //    236 T2 ON, NOTE  96 VOLUME  8
-                0x84,0xd3,0x0a, //      4 T1 ON, NOTE  83 VOLUME 10
-           0x01,0xdd,0x4f,0x0a, //    221 T2 ON, NOTE  79 VOLUME 10
-                0x8f,0xdd,0x07, //     15 T1 ON, NOTE  93 VOLUME  7
-                0x80,0x58,0x0a, //      0 T2 ON, NOTE  88 VOLUME 10
-           0x01,0xf0,0x5f,0x08, //    240 T2 ON, NOTE  95 VOLUME  8
-                0x84,0xd8,0x0a, //      4 T1 ON, NOTE  88 VOLUME 10
-           0x01,0xdd,0x51,0x0a, //    221 T2 ON, NOTE  81 VOLUME 10
-                0x8f,0x5d,0x08, //     15 T2 ON, NOTE  93 VOLUME  8
-           0x01,0xf0,0x5f,0x08, //    240 T2 ON, NOTE  95 VOLUME  8
-           0x01,0xf0,0xdd,0x08, //    240 T1 ON, NOTE  93 VOLUME  8
-                0x80,0x5a,0x0a, //      0 T2 ON, NOTE  90 VOLUME 10
-           0x01,0xf0,0x5f,0x09, //    240 T2 ON, NOTE  95 VOLUME  9
-                0x84,0xda,0x0a, //      4 T1 ON, NOTE  90 VOLUME 10
-           0x01,0xec,0xdd,0x08, //    236 T1 ON, NOTE  93 VOLUME  8
-                0x84,0x5a,0x0a, //      4 T2 ON, NOTE  90 VOLUME 10
-           0x01,0xec,0x5f,0x08, //    236 T2 ON, NOTE  95 VOLUME  8
-                0x84,0xda,0x0a, //      4 T1 ON, NOTE  90 VOLUME 10
-           0x01,0xdd,0x51,0x0a, //    221 T2 ON, NOTE  81 VOLUME 10
-                0x8f,0xdb,0x07, //     15 T1 ON, NOTE  91 VOLUME  7
-                0x80,0x56,0x0a, //      0 T2 ON, NOTE  86 VOLUME 10
-           0x03,0xe0,0xcf,0x0a, //    480 T1 ON, NOTE  79 VOLUME 10
-           0x03,0xe0,0xd3,0x07, //    480 T1 ON, NOTE  83 VOLUME  7
-                     0x80,0x00, //      0 T2 OFF
-           0x03,0xe0,0xd3,0x08, //    480 T1 ON, NOTE  83 VOLUME  8
-                0x80,0x4f,0x08, //      0 T2 ON, NOTE  79 VOLUME  8
-           0x03,0xe0,0xdf,0x07, //    480 T1 ON, NOTE  95 VOLUME  7
-           0x03,0xe0,0xdf,0x08, //    480 T1 ON, NOTE  95 VOLUME  8
-           0x0b,0xa0,0x4f,0x09, //   1440 T2 ON, NOTE  79 VOLUME  9
-           0x03,0xe0,0xe4,0x09, //    480 T1 ON, NOTE 100 VOLUME  9
-                0x80,0x4c,0x07, //      0 T2 ON, NOTE  76 VOLUME  7
-           0x03,0xe0,0xdf,0x08, //    480 T1 ON, NOTE  95 VOLUME  8
-                0x80,0x4f,0x09, //      0 T2 ON, NOTE  79 VOLUME  9
-           0x03,0xe0,0xe4,0x09, //    480 T1 ON, NOTE 100 VOLUME  9
-                0x80,0x4c,0x07, //      0 T2 ON, NOTE  76 VOLUME  7
-           0x03,0xe0,0xdf,0x08, //    480 T1 ON, NOTE  95 VOLUME  8
-                0x80,0x4f,0x09, //      0 T2 ON, NOTE  79 VOLUME  9
-           0x03,0xe0,0xe4,0x09, //    480 T1 ON, NOTE 100 VOLUME  9
-                0x80,0x4c,0x08, //      0 T2 ON, NOTE  76 VOLUME  8
-           0x03,0xe0,0xdf,0x07, //    480 T1 ON, NOTE  95 VOLUME  7
-                0x80,0x4f,0x09, //      0 T2 ON, NOTE  79 VOLUME  9
-           0x03,0xe0,0xdd,0x08, //    480 T1 ON, NOTE  93 VOLUME  8
-                0x80,0x4e,0x08, //      0 T2 ON, NOTE  78 VOLUME  8
-           0x03,0xe0,0xdb,0x08, //    480 T1 ON, NOTE  91 VOLUME  8
-                0x80,0x4c,0x08, //      0 T2 ON, NOTE  76 VOLUME  8
-           0x03,0xe0,0xda,0x08, //    480 T1 ON, NOTE  90 VOLUME  8
-                0x80,0x4b,0x08, //      0 T2 ON, NOTE  75 VOLUME  8
-           0x03,0xe0,0xd8,0x08, //    480 T1 ON, NOTE  88 VOLUME  8
-                0x80,0x4c,0x08, //      0 T2 ON, NOTE  76 VOLUME  8
-           0x03,0xe0,0xdf,0x0a, //    480 T1 ON, NOTE  95 VOLUME 10
-                0x80,0x4f,0x09, //      0 T2 ON, NOTE  79 VOLUME  9
-           0x01,0xf0,0xdf,0x09, //    240 T1 ON, NOTE  95 VOLUME  9
-                0x80,0x4f,0x08, //      0 T2 ON, NOTE  79 VOLUME  8
-           0x01,0xf0,0xdf,0x08, //    240 T1 ON, NOTE  95 VOLUME  8
-           0x12,0xe0,0xe4,0x09, //   2400 T1 ON, NOTE 100 VOLUME  9
-                0x80,0x4c,0x08, //      0 T2 ON, NOTE  76 VOLUME  8
-           0x03,0xe0,0xdf,0x07, //    480 T1 ON, NOTE  95 VOLUME  7
-                0x80,0x4f,0x09, //      0 T2 ON, NOTE  79 VOLUME  9
-           0x03,0xe0,0xe4,0x09, //    480 T1 ON, NOTE 100 VOLUME  9
-                0x80,0x4c,0x08, //      0 T2 ON, NOTE  76 VOLUME  8
-           0x03,0xe0,0xdf,0x07, //    480 T1 ON, NOTE  95 VOLUME  7
-                0x80,0x5b,0x09, //      0 T2 ON, NOTE  91 VOLUME  9
-           0x03,0xe0,0xe4,0x09, //    480 T1 ON, NOTE 100 VOLUME  9
-                0x80,0x4c,0x08, //      0 T2 ON, NOTE  76 VOLUME  8
-           0x03,0xe0,0xe2,0x08, //    480 T1 ON, NOTE  98 VOLUME  8
-                0x80,0x5a,0x08, //      0 T2 ON, NOTE  90 VOLUME  8
-           0x03,0xe0,0xe1,0x07, //    480 T1 ON, NOTE  97 VOLUME  7
-                0x80,0x58,0x08, //      0 T2 ON, NOTE  88 VOLUME  8
-           0x03,0xe0,0xe2,0x09, //    480 T1 ON, NOTE  98 VOLUME  9
-                0x80,0x4e,0x08, //      0 T2 ON, NOTE  78 VOLUME  8
-           0x03,0xe0,0xe1,0x08, //    480 T1 ON, NOTE  97 VOLUME  8
-                0x80,0x4f,0x08, //      0 T2 ON, NOTE  79 VOLUME  8
-           0x03,0xe0,0xe2,0x09, //    480 T1 ON, NOTE  98 VOLUME  9
-                0x80,0x4e,0x08, //      0 T2 ON, NOTE  78 VOLUME  8
-           0x03,0xe0,0xdf,0x07, //    480 T1 ON, NOTE  95 VOLUME  7
-                0x80,0x5b,0x09, //      0 T2 ON, NOTE  91 VOLUME  9
-           0x01,0xf0,0xdf,0x08, //    240 T1 ON, NOTE  95 VOLUME  8
-                0x80,0x5b,0x08, //      0 T2 ON, NOTE  91 VOLUME  8
-           0x0d,0x90,0xdf,0x09, //   1680 T1 ON, NOTE  95 VOLUME  9
-           0x01,0xf0,0xdf,0x08, //    240 T1 ON, NOTE  95 VOLUME  8
-           0x05,0xd0,0xe4,0x09, //    720 T1 ON, NOTE 100 VOLUME  9
-                0x80,0x58,0x07, //      0 T2 ON, NOTE  88 VOLUME  7
-           0x03,0xe0,0xdf,0x07, //    480 T1 ON, NOTE  95 VOLUME  7
-                0x80,0x5b,0x09, //      0 T2 ON, NOTE  91 VOLUME  9
-           0x03,0xe0,0xe4,0x09, //    480 T1 ON, NOTE 100 VOLUME  9
-                0x80,0x58,0x07, //      0 T2 ON, NOTE  88 VOLUME  7
-           0x03,0xe0,0xdf,0x07, //    480 T1 ON, NOTE  95 VOLUME  7
-                0x80,0x5b,0x09, //      0 T2 ON, NOTE  91 VOLUME  9
-           0x03,0xe0,0xe4,0x09, //    480 T1 ON, NOTE 100 VOLUME  9
-                0x80,0x58,0x08, //      0 T2 ON, NOTE  88 VOLUME  8
-           0x03,0xe0,0xdf,0x07, //    480 T1 ON, NOTE  95 VOLUME  7
-                0x80,0x5b,0x08, //      0 T2 ON, NOTE  91 VOLUME  8
-           0x03,0xe0,0xdd,0x07, //    480 T1 ON, NOTE  93 VOLUME  7
-                0x80,0x5a,0x08, //      0 T2 ON, NOTE  90 VOLUME  8
-           0x03,0xe0,0xdb,0x08, //    480 T1 ON, NOTE  91 VOLUME  8
-                0x80,0x58,0x08, //      0 T2 ON, NOTE  88 VOLUME  8
-           0x03,0xe0,0xda,0x08, //    480 T1 ON, NOTE  90 VOLUME  8
-                0x80,0x57,0x08, //      0 T2 ON, NOTE  87 VOLUME  8
-           0x03,0xe0,0xd8,0x07, //    480 T1 ON, NOTE  88 VOLUME  7
-                0x80,0x4c,0x08, //      0 T2 ON, NOTE  76 VOLUME  8
-           0x03,0xe0,0xdf,0x09, //    480 T1 ON, NOTE  95 VOLUME  9
-                0x80,0x5b,0x09, //      0 T2 ON, NOTE  91 VOLUME  9
-           0x01,0xf0,0xdf,0x08, //    240 T1 ON, NOTE  95 VOLUME  8
-                0x80,0x5b,0x08, //      0 T2 ON, NOTE  91 VOLUME  8
-           0x12,0xe0,0xe4,0x09, //   2400 T1 ON, NOTE 100 VOLUME  9
-                0x80,0x58,0x07, //      0 T2 ON, NOTE  88 VOLUME  7
-           0x03,0xe0,0xdf,0x07, //    480 T1 ON, NOTE  95 VOLUME  7
-                0x80,0x5b,0x09, //      0 T2 ON, NOTE  91 VOLUME  9
-           0x03,0xe0,0xe4,0x09, //    480 T1 ON, NOTE 100 VOLUME  9
-                0x80,0x58,0x09, //      0 T2 ON, NOTE  88 VOLUME  9
-           0x03,0xe0,0xdf,0x07, //    480 T1 ON, NOTE  95 VOLUME  7
-                0x80,0x5b,0x09, //      0 T2 ON, NOTE  91 VOLUME  9
-           0x03,0xe0,0xe4,0x09, //    480 T1 ON, NOTE 100 VOLUME  9
-                0x80,0x58,0x07, //      0 T2 ON, NOTE  88 VOLUME  7
-           0x03,0xe0,0xe2,0x08, //    480 T1 ON, NOTE  98 VOLUME  8
-                0x80,0x5a,0x08, //      0 T2 ON, NOTE  90 VOLUME  8
-           0x03,0xe0,0xe1,0x08, //    480 T1 ON, NOTE  97 VOLUME  8
-                0x80,0x58,0x08, //      0 T2 ON, NOTE  88 VOLUME  8
-           0x03,0xe0,0xe2,0x09, //    480 T1 ON, NOTE  98 VOLUME  9
-                0x80,0x56,0x08, //      0 T2 ON, NOTE  86 VOLUME  8
-                0x07,0xc0,0x01, //    960 BOTH OFF
-           0x03,0xe0,0xc5,0x06, //    480 T1 ON, NOTE  69 VOLUME  6
-                0x80,0x3e,0x06, //      0 T2 ON, NOTE  62 VOLUME  6
-           0x0f,0x80,0xc7,0x07, //   1920 T1 ON, NOTE  71 VOLUME  7
-                0x80,0x43,0x07, //      0 T2 ON, NOTE  67 VOLUME  7
-           0x03,0xe0,0xc8,0x06, //    480 T1 ON, NOTE  72 VOLUME  6
-                0x80,0x45,0x06, //      0 T2 ON, NOTE  69 VOLUME  6
-           0x03,0xe0,0xc5,0x06, //    480 T1 ON, NOTE  69 VOLUME  6
-                0x80,0x3e,0x05, //      0 T2 ON, NOTE  62 VOLUME  5
-           0x03,0xe0,0x40,0x06, //    480 T2 ON, NOTE  64 VOLUME  6
-           0x03,0xe0,0xc8,0x07, //    480 T1 ON, NOTE  72 VOLUME  7
-                0x80,0x45,0x07, //      0 T2 ON, NOTE  69 VOLUME  7
-           0x03,0xe0,0xc7,0x06, //    480 T1 ON, NOTE  71 VOLUME  6
-                0x80,0x43,0x06, //      0 T2 ON, NOTE  67 VOLUME  6
-           0x03,0xe0,0xc5,0x06, //    480 T1 ON, NOTE  69 VOLUME  6
-                0x80,0x40,0x07, //      0 T2 ON, NOTE  64 VOLUME  7
-           0x03,0xe0,0xc7,0x07, //    480 T1 ON, NOTE  71 VOLUME  7
-           0x03,0xe0,0xc9,0x07, //    480 T1 ON, NOTE  73 VOLUME  7
-                0x80,0x43,0x07, //      0 T2 ON, NOTE  67 VOLUME  7
-           0x03,0xe0,0xca,0x06, //    480 T1 ON, NOTE  74 VOLUME  6
-                0x80,0x45,0x06, //      0 T2 ON, NOTE  69 VOLUME  6
-           0x03,0xe0,0xc5,0x06, //    480 T1 ON, NOTE  69 VOLUME  6
-                0x80,0x42,0x06, //      0 T2 ON, NOTE  66 VOLUME  6
-           0x03,0xe0,0x4a,0x07, //    480 T2 ON, NOTE  74 VOLUME  7
-           0x03,0xe0,0xd1,0x06, //    480 T1 ON, NOTE  81 VOLUME  6
-           0x01,0xf0,0x4a,0x06, //    240 T2 ON, NOTE  74 VOLUME  6
-           0x01,0xf0,0x3e,0x06, //    240 T2 ON, NOTE  62 VOLUME  6
-           0x03,0xe0,0x4a,0x06, //    480 T2 ON, NOTE  74 VOLUME  6
-           0x07,0xc0,0xd3,0x06, //    960 T1 ON, NOTE  83 VOLUME  6
-                0x80,0x4f,0x06, //      0 T2 ON, NOTE  79 VOLUME  6
-           0x03,0xe0,0xd4,0x07, //    480 T1 ON, NOTE  84 VOLUME  7
-                0x80,0x51,0x07, //      0 T2 ON, NOTE  81 VOLUME  7
-           0x03,0xe0,0xca,0x07, //    480 T1 ON, NOTE  74 VOLUME  7
-           0x03,0xe0,0xd4,0x06, //    480 T1 ON, NOTE  84 VOLUME  6
-                0x80,0x51,0x06, //      0 T2 ON, NOTE  81 VOLUME  6
-           0x03,0xe0,0xd3,0x06, //    480 T1 ON, NOTE  83 VOLUME  6
-                0x80,0x4f,0x06, //      0 T2 ON, NOTE  79 VOLUME  6
-           0x03,0xe0,0xcf,0x06, //    480 T1 ON, NOTE  79 VOLUME  6
-                0x80,0x4a,0x06, //      0 T2 ON, NOTE  74 VOLUME  6
-           0x03,0xe0,0xd3,0x07, //    480 T1 ON, NOTE  83 VOLUME  7
-                0x80,0x4f,0x07, //      0 T2 ON, NOTE  79 VOLUME  7
-           0x03,0xe0,0xd1,0x05, //    480 T1 ON, NOTE  81 VOLUME  5
-                0x80,0x4e,0x05, //      0 T2 ON, NOTE  78 VOLUME  5
-                0x07,0xc0,0x01, //    960 BOTH OFF
-           0x03,0xe0,0xc3,0x05, //    480 T1 ON, NOTE  67 VOLUME  5
-                0x80,0x3e,0x05, //      0 T2 ON, NOTE  62 VOLUME  5
-           0x01,0xf0,0x3e,0x06, //    240 T2 ON, NOTE  62 VOLUME  6
-           0x01,0xf0,0x3e,0x05, //    240 T2 ON, NOTE  62 VOLUME  5
-           0x05,0xd0,0x3e,0x06, //    720 T2 ON, NOTE  62 VOLUME  6
-           0x01,0xf0,0x3e,0x05, //    240 T2 ON, NOTE  62 VOLUME  5
-                0x07,0xc0,0x00, //    960 T2 OFF
-           0x03,0xe0,0xc5,0x05, //    480 T1 ON, NOTE  69 VOLUME  5
-                0x80,0x43,0x05, //      0 T2 ON, NOTE  67 VOLUME  5
-           0x03,0xe0,0xc7,0x06, //    480 T1 ON, NOTE  71 VOLUME  6
-                0x80,0x43,0x06, //      0 T2 ON, NOTE  67 VOLUME  6
-           0x03,0xe0,0xc3,0x05, //    480 T1 ON, NOTE  67 VOLUME  5
-                0x80,0x3e,0x04, //      0 T2 ON, NOTE  62 VOLUME  4
-           0x01,0xf0,0x3e,0x05, //    240 T2 ON, NOTE  62 VOLUME  5
-                0x09,0xb0,0x00, //   1200 T2 OFF
-           0x03,0xe0,0xc7,0x06, //    480 T1 ON, NOTE  71 VOLUME  6
-                0x80,0x43,0x05, //      0 T2 ON, NOTE  67 VOLUME  5
-           0x01,0xf0,0xc7,0x05, //    240 T1 ON, NOTE  71 VOLUME  5
-           0x01,0xf0,0xc5,0x05, //    240 T1 ON, NOTE  69 VOLUME  5
-                0x80,0x3e,0x05, //      0 T2 ON, NOTE  62 VOLUME  5
-           0x03,0xe0,0xc2,0x05, //    480 T1 ON, NOTE  66 VOLUME  5
-           0x03,0xe0,0xbe,0x05, //    480 T1 ON, NOTE  62 VOLUME  5
-                     0x80,0x00, //      0 T2 OFF
-           0x03,0xe0,0xc3,0x06, //    480 T1 ON, NOTE  67 VOLUME  6
-           0x01,0xf0,0xc3,0x05, //    240 T1 ON, NOTE  67 VOLUME  5
-                0x80,0x3e,0x06, //      0 T2 ON, NOTE  62 VOLUME  6
-           0x01,0xf0,0x3e,0x05, //    240 T2 ON, NOTE  62 VOLUME  5
-           0x0b,0xa0,0xc3,0x06, //   1440 T1 ON, NOTE  67 VOLUME  6
-           0x01,0xf0,0xc3,0x05, //    240 T1 ON, NOTE  67 VOLUME  5
-                0x01,0xf0,0x00, //    240 T2 OFF
-           0x03,0xe0,0x45,0x06, //    480 T2 ON, NOTE  69 VOLUME  6
-           0x03,0xe0,0x47,0x06, //    480 T2 ON, NOTE  71 VOLUME  6
-                0x03,0xe0,0x00, //    480 T2 OFF
-           0x01,0xf0,0xc7,0x06, //    240 T1 ON, NOTE  71 VOLUME  6
-                0x80,0x43,0x05, //      0 T2 ON, NOTE  67 VOLUME  5
-           0x01,0xf0,0xca,0x06, //    240 T1 ON, NOTE  74 VOLUME  6
-                0x80,0x3e,0x05, //      0 T2 ON, NOTE  62 VOLUME  5
-           0x05,0xd0,0x3e,0x06, //    720 T2 ON, NOTE  62 VOLUME  6
-           0x01,0xf0,0xbe,0x05, //    240 T1 ON, NOTE  62 VOLUME  5
-                     0x80,0x00, //      0 T2 OFF
-           0x03,0xe0,0xc8,0x05, //    480 T1 ON, NOTE  72 VOLUME  5
-                0x80,0x3e,0x06, //      0 T2 ON, NOTE  62 VOLUME  6
-           0x01,0xf0,0xc5,0x05, //    240 T1 ON, NOTE  69 VOLUME  5
-                0x80,0x3e,0x05, //      0 T2 ON, NOTE  62 VOLUME  5
-           0x01,0xf0,0xc3,0x05, //    240 T1 ON, NOTE  67 VOLUME  5
-                0x80,0x43,0x06, //      0 T2 ON, NOTE  67 VOLUME  6
-           0x03,0xe0,0xc7,0x06, //    480 T1 ON, NOTE  71 VOLUME  6
-                0x80,0x43,0x05, //      0 T2 ON, NOTE  67 VOLUME  5
-                0x03,0xe0,0x80, //    480 T1 OFF
-           0x03,0xe0,0xd6,0x07, //    480 T1 ON, NOTE  86 VOLUME  7
-                0x80,0x4a,0x07, //      0 T2 ON, NOTE  74 VOLUME  7
-           0x01,0xf0,0xd6,0x08, //    240 T1 ON, NOTE  86 VOLUME  8
-                0x80,0x4a,0x09, //      0 T2 ON, NOTE  74 VOLUME  9
-           0x01,0xf0,0x47,0x08, //    240 T2 ON, NOTE  71 VOLUME  8
-           0x03,0xe0,0xd6,0x09, //    480 T1 ON, NOTE  86 VOLUME  9
-                0x80,0x53,0x08, //      0 T2 ON, NOTE  83 VOLUME  8
-           0x01,0xf0,0xd6,0x08, //    240 T1 ON, NOTE  86 VOLUME  8
-           0x01,0xf0,0x47,0x08, //    240 T2 ON, NOTE  71 VOLUME  8
-           0x03,0xe0,0x53,0x07, //    480 T2 ON, NOTE  83 VOLUME  7
-           0x03,0xe0,0xdb,0x09, //    480 T1 ON, NOTE  91 VOLUME  9
-                0x80,0x4f,0x09, //      0 T2 ON, NOTE  79 VOLUME  9
-           0x03,0xe0,0xdd,0x09, //    480 T1 ON, NOTE  93 VOLUME  9
-                0x80,0x53,0x08, //      0 T2 ON, NOTE  83 VOLUME  8
-           0x03,0xe0,0xdf,0x09, //    480 T1 ON, NOTE  95 VOLUME  9
-                0x80,0x4a,0x08, //      0 T2 ON, NOTE  74 VOLUME  8
-           0x03,0xe0,0xd6,0x06, //    480 T1 ON, NOTE  86 VOLUME  6
-                0x80,0x53,0x07, //      0 T2 ON, NOTE  83 VOLUME  7
-           0x01,0xf0,0xd6,0x08, //    240 T1 ON, NOTE  86 VOLUME  8
-           0x01,0xf0,0x47,0x08, //    240 T2 ON, NOTE  71 VOLUME  8
-           0x03,0xe0,0x53,0x07, //    480 T2 ON, NOTE  83 VOLUME  7
-                0x01,0xf0,0x00, //    240 T2 OFF
-           0x01,0xf0,0xdb,0x09, //    240 T1 ON, NOTE  91 VOLUME  9
-                0x80,0x4f,0x09, //      0 T2 ON, NOTE  79 VOLUME  9
-           0x03,0xe0,0xdf,0x09, //    480 T1 ON, NOTE  95 VOLUME  9
-                0x80,0x53,0x09, //      0 T2 ON, NOTE  83 VOLUME  9
-           0x01,0xf0,0xdf,0x08, //    240 T1 ON, NOTE  95 VOLUME  8
-                     0x80,0x00, //      0 T2 OFF
-           0x01,0xf0,0xdd,0x08, //    240 T1 ON, NOTE  93 VOLUME  8
-                0x80,0x51,0x07, //      0 T2 ON, NOTE  81 VOLUME  7
-           0x03,0xe0,0xda,0x07, //    480 T1 ON, NOTE  90 VOLUME  7
-           0x01,0xf0,0x4e,0x07, //    240 T2 ON, NOTE  78 VOLUME  7
-           0x01,0xf0,0xd6,0x07, //    240 T1 ON, NOTE  86 VOLUME  7
-                0x80,0x4a,0x08, //      0 T2 ON, NOTE  74 VOLUME  8
-           0x03,0xe0,0xd6,0x08, //    480 T1 ON, NOTE  86 VOLUME  8
-                0x80,0x51,0x07, //      0 T2 ON, NOTE  81 VOLUME  7
-                0x01,0xf0,0x00, //    240 T2 OFF
-           0x01,0xf0,0x4a,0x08, //    240 T2 ON, NOTE  74 VOLUME  8
-           0x03,0xe0,0x53,0x07, //    480 T2 ON, NOTE  83 VOLUME  7
-                0x01,0xf0,0x00, //    240 T2 OFF
-           0x01,0xf0,0x4a,0x08, //    240 T2 ON, NOTE  74 VOLUME  8
-           0x03,0xe0,0x53,0x07, //    480 T2 ON, NOTE  83 VOLUME  7
-                0x01,0xf0,0x00, //    240 T2 OFF
-           0x01,0xf0,0xdb,0x09, //    240 T1 ON, NOTE  91 VOLUME  9
-                0x80,0x4f,0x09, //      0 T2 ON, NOTE  79 VOLUME  9
-           0x03,0xe0,0xdd,0x09, //    480 T1 ON, NOTE  93 VOLUME  9
-                0x80,0x53,0x07, //      0 T2 ON, NOTE  83 VOLUME  7
-           0x01,0xf0,0x51,0x09, //    240 T2 ON, NOTE  81 VOLUME  9
-           0x01,0xf0,0xdf,0x09, //    240 T1 ON, NOTE  95 VOLUME  9
-                0x80,0x53,0x09, //      0 T2 ON, NOTE  83 VOLUME  9
-           0x03,0xe0,0xdb,0x07, //    480 T1 ON, NOTE  91 VOLUME  7
-                0x80,0x53,0x07, //      0 T2 ON, NOTE  83 VOLUME  7
-           0x01,0xf0,0xdf,0x09, //    240 T1 ON, NOTE  95 VOLUME  9
-                0x80,0x37,0x08, //      0 T2 ON, NOTE  55 VOLUME  8
-           0x01,0xf0,0xe2,0x08, //    240 T1 ON, NOTE  98 VOLUME  8
-                0x80,0x56,0x09, //      0 T2 ON, NOTE  86 VOLUME  9
-           0x07,0xc0,0xc8,0x0a, //    960 T1 ON, NOTE  72 VOLUME 10
-                0x80,0x45,0x0a, //      0 T2 ON, NOTE  69 VOLUME 10
-           0x01,0xf0,0xe0,0x07, //    240 T1 ON, NOTE  96 VOLUME  7
-                0x80,0x54,0x08, //      0 T2 ON, NOTE  84 VOLUME  8
-           0x01,0xf0,0xdd,0x07, //    240 T1 ON, NOTE  93 VOLUME  7
-                0x80,0x48,0x08, //      0 T2 ON, NOTE  72 VOLUME  8
-           0x01,0xf0,0xdb,0x07, //    240 T1 ON, NOTE  91 VOLUME  7
-                0x80,0x53,0x08, //      0 T2 ON, NOTE  83 VOLUME  8
-           0x01,0xf0,0xe0,0x09, //    240 T1 ON, NOTE  96 VOLUME  9
-                0x80,0x54,0x09, //      0 T2 ON, NOTE  84 VOLUME  9
-           0x01,0xf0,0xdf,0x08, //    240 T1 ON, NOTE  95 VOLUME  8
-                0x80,0x4a,0x08, //      0 T2 ON, NOTE  74 VOLUME  8
-           0x03,0xe0,0xd6,0x06, //    480 T1 ON, NOTE  86 VOLUME  6
-                0x80,0x4f,0x08, //      0 T2 ON, NOTE  79 VOLUME  8
-           0x01,0xf0,0x58,0x06, //    240 T2 ON, NOTE  88 VOLUME  6
-                0x84,0xcf,0x08, //      4 T1 ON, NOTE  79 VOLUME  8
-                0x01,0xdd,0x00, //    221 T2 OFF
-                0x8f,0x5a,0x09, //     15 T2 ON, NOTE  90 VOLUME  9
-           0x01,0xf0,0xdb,0x09, //    240 T1 ON, NOTE  91 VOLUME  9
-                0x84,0x4f,0x08, //      4 T2 ON, NOTE  79 VOLUME  8
-                0x01,0xdd,0x01, //    221 BOTH OFF
-                0x8f,0xda,0x08, //     15 T1 ON, NOTE  90 VOLUME  8
-                0x80,0x4e,0x08, //      0 T2 ON, NOTE  78 VOLUME  8
-           0x01,0xf0,0x5b,0x08, //    240 T2 ON, NOTE  91 VOLUME  8
-                0x84,0xcf,0x08, //      4 T1 ON, NOTE  79 VOLUME  8
-                0x01,0xdd,0x01, //    221 BOTH OFF
-                0x8f,0xdd,0x09, //     15 T1 ON, NOTE  93 VOLUME  9
-                0x80,0x47,0x08, //      0 T2 ON, NOTE  71 VOLUME  8
-           0x01,0xf0,0x5f,0x09, //    240 T2 ON, NOTE  95 VOLUME  9
-                0x84,0xd3,0x09, //      4 T1 ON, NOTE  83 VOLUME  9
-                0x01,0xdd,0x01, //    221 BOTH OFF
-                0x8f,0xe0,0x08, //     15 T1 ON, NOTE  96 VOLUME  8
-                0x80,0x54,0x09, //      0 T2 ON, NOTE  84 VOLUME  9
-           0x03,0xe0,0x51,0x0a, //    480 T2 ON, NOTE  81 VOLUME 10
-           0x03,0xe0,0x51,0x08, //    480 T2 ON, NOTE  81 VOLUME  8
-           0x01,0xf0,0x51,0x09, //    240 T2 ON, NOTE  81 VOLUME  9
-           0x03,0xe0,0x51,0x08, //    480 T2 ON, NOTE  81 VOLUME  8
-           0x03,0xe0,0xd3,0x08, //    480 T1 ON, NOTE  83 VOLUME  8
-                0x80,0x4f,0x08, //      0 T2 ON, NOTE  79 VOLUME  8
-           0x01,0xf0,0xd4,0x09, //    240 T1 ON, NOTE  84 VOLUME  9
-                0x80,0x54,0x09, //      0 T2 ON, NOTE  84 VOLUME  9
-           0x01,0xf0,0xd3,0x08, //    240 T1 ON, NOTE  83 VOLUME  8
-                0x80,0x53,0x08, //      0 T2 ON, NOTE  83 VOLUME  8
-           0x07,0xc0,0xd6,0x09, //    960 T1 ON, NOTE  86 VOLUME  9
-                0x80,0x4a,0x07, //      0 T2 ON, NOTE  74 VOLUME  7
-           0x01,0xf0,0x58,0x0a, //    240 T2 ON, NOTE  88 VOLUME 10
-                0x84,0xc7,0x08, //      4 T1 ON, NOTE  71 VOLUME  8
-           0x01,0xdd,0x43,0x08, //    221 T2 ON, NOTE  67 VOLUME  8
-                0x8f,0xda,0x09, //     15 T1 ON, NOTE  90 VOLUME  9
-                0x80,0x4e,0x09, //      0 T2 ON, NOTE  78 VOLUME  9
-           0x01,0xf0,0x5b,0x0a, //    240 T2 ON, NOTE  91 VOLUME 10
-                0x84,0xc7,0x08, //      4 T1 ON, NOTE  71 VOLUME  8
-                0x01,0xdd,0x00, //    221 T2 OFF
-                0x8f,0xda,0x08, //     15 T1 ON, NOTE  90 VOLUME  8
-                0x80,0x4e,0x08, //      0 T2 ON, NOTE  78 VOLUME  8
-           0x01,0xf0,0x5b,0x08, //    240 T2 ON, NOTE  91 VOLUME  8
-                0x84,0xc7,0x08, //      4 T1 ON, NOTE  71 VOLUME  8
-           0x01,0xdd,0x43,0x08, //    221 T2 ON, NOTE  67 VOLUME  8
-                0x8f,0xdd,0x09, //     15 T1 ON, NOTE  93 VOLUME  9
-                0x80,0x51,0x09, //      0 T2 ON, NOTE  81 VOLUME  9
-           0x01,0xf0,0x5f,0x0a, //    240 T2 ON, NOTE  95 VOLUME 10
-                0x84,0xc7,0x08, //      4 T1 ON, NOTE  71 VOLUME  8
-           0x01,0xdd,0x43,0x08, //    221 T2 ON, NOTE  67 VOLUME  8
-                0x8f,0xe0,0x09, //     15 T1 ON, NOTE  96 VOLUME  9
-                0x80,0x54,0x08, //      0 T2 ON, NOTE  84 VOLUME  8
-           0x03,0xe0,0x51,0x09, //    480 T2 ON, NOTE  81 VOLUME  9
-           0x03,0xe0,0x51,0x08, //    480 T2 ON, NOTE  81 VOLUME  8
-           0x03,0xe0,0x51,0x0a, //    480 T2 ON, NOTE  81 VOLUME 10
-           0x03,0xe0,0x51,0x08, //    480 T2 ON, NOTE  81 VOLUME  8
-           0x03,0xe0,0xdf,0x09, //    480 T1 ON, NOTE  95 VOLUME  9
-                0x80,0x53,0x09, //      0 T2 ON, NOTE  83 VOLUME  9
-           0x07,0xc0,0xda,0x08, //    960 T1 ON, NOTE  90 VOLUME  8
-                0x80,0x53,0x0a, //      0 T2 ON, NOTE  83 VOLUME 10
-           0x07,0xc0,0xdb,0x0a, //    960 T1 ON, NOTE  91 VOLUME 10
-                0x80,0x4f,0x0a, //      0 T2 ON, NOTE  79 VOLUME 10
-           0x07,0xc0,0xdd,0x0a, //    960 T1 ON, NOTE  93 VOLUME 10
-                0x80,0x56,0x0a, //      0 T2 ON, NOTE  86 VOLUME 10
-           0x07,0xc0,0xdf,0x0a, //    960 T1 ON, NOTE  95 VOLUME 10
-                0x80,0x53,0x09, //      0 T2 ON, NOTE  83 VOLUME  9
-           0x07,0xc0,0xda,0x08, //    960 T1 ON, NOTE  90 VOLUME  8
-                0x80,0x53,0x0a, //      0 T2 ON, NOTE  83 VOLUME 10
-           0x07,0xc0,0xdb,0x0a, //    960 T1 ON, NOTE  91 VOLUME 10
-                0x80,0x4f,0x09, //      0 T2 ON, NOTE  79 VOLUME  9
-           0x07,0xc0,0xdd,0x0a, //    960 T1 ON, NOTE  93 VOLUME 10
-                0x80,0x4e,0x09, //      0 T2 ON, NOTE  78 VOLUME  9
-           0x07,0xc0,0xde,0x0a, //    960 T1 ON, NOTE  94 VOLUME 10
-                0x80,0x52,0x0a, //      0 T2 ON, NOTE  82 VOLUME 10
-           0x0f,0x80,0xcb,0x09, //   1920 T1 ON, NOTE  75 VOLUME  9
-                0x80,0x43,0x0a, //      0 T2 ON, NOTE  67 VOLUME 10
-           0x03,0xe0,0xdb,0x08, //    480 T1 ON, NOTE  91 VOLUME  8
-                0x80,0x4f,0x07, //      0 T2 ON, NOTE  79 VOLUME  7
-           0x01,0xf0,0x4b,0x09, //    240 T2 ON, NOTE  75 VOLUME  9
-           0x01,0xf0,0xd7,0x07, //    240 T1 ON, NOTE  87 VOLUME  7
-                     0x80,0x00, //      0 T2 OFF
-           0x03,0xe0,0xdb,0x09, //    480 T1 ON, NOTE  91 VOLUME  9
-                0x80,0x4f,0x09, //      0 T2 ON, NOTE  79 VOLUME  9
-           0x03,0xe0,0xdf,0x09, //    480 T1 ON, NOTE  95 VOLUME  9
-                0x80,0x56,0x07, //      0 T2 ON, NOTE  86 VOLUME  7
-           0x0f,0x80,0xd6,0x0a, //   1920 T1 ON, NOTE  86 VOLUME 10
-                0x80,0x4f,0x0a, //      0 T2 ON, NOTE  79 VOLUME 10
-           0x03,0xe0,0x5b,0x07, //    480 T2 ON, NOTE  91 VOLUME  7
-           0x01,0xf0,0x5b,0x08, //    240 T2 ON, NOTE  91 VOLUME  8
-                0x01,0xf0,0x01, //    240 BOTH OFF
-           0x03,0xe0,0xdb,0x09, //    480 T1 ON, NOTE  91 VOLUME  9
-                0x80,0x4f,0x09, //      0 T2 ON, NOTE  79 VOLUME  9
-           0x03,0xe0,0xdf,0x09, //    480 T1 ON, NOTE  95 VOLUME  9
-                0x80,0x53,0x0a, //      0 T2 ON, NOTE  83 VOLUME 10
-           0x0f,0x80,0xd3,0x09, //   1920 T1 ON, NOTE  83 VOLUME  9
-                0x80,0x50,0x09, //      0 T2 ON, NOTE  80 VOLUME  9
-           0x03,0xe0,0x5c,0x08, //    480 T2 ON, NOTE  92 VOLUME  8
-           0x03,0xe0,0xd8,0x07, //    480 T1 ON, NOTE  88 VOLUME  7
-                     0x80,0x00, //      0 T2 OFF
-           0x03,0xe0,0xdc,0x09, //    480 T1 ON, NOTE  92 VOLUME  9
-                0x80,0x50,0x09, //      0 T2 ON, NOTE  80 VOLUME  9
-           0x03,0xe0,0xe1,0x09, //    480 T1 ON, NOTE  97 VOLUME  9
-                0x80,0x55,0x09, //      0 T2 ON, NOTE  85 VOLUME  9
-           0x0f,0x80,0xd2,0x09, //   1920 T1 ON, NOTE  82 VOLUME  9
-                0x80,0x49,0x07, //      0 T2 ON, NOTE  73 VOLUME  7
-           0x03,0xe0,0xde,0x07, //    480 T1 ON, NOTE  94 VOLUME  7
-                0x80,0x52,0x07, //      0 T2 ON, NOTE  82 VOLUME  7
-           0x01,0xf0,0xde,0x08, //    240 T1 ON, NOTE  94 VOLUME  8
-                0x80,0x46,0x07, //      0 T2 ON, NOTE  70 VOLUME  7
-           0x01,0xf0,0xdb,0x08, //    240 T1 ON, NOTE  91 VOLUME  8
-                0x80,0x4f,0x07, //      0 T2 ON, NOTE  79 VOLUME  7
-           0x03,0xe0,0xde,0x09, //    480 T1 ON, NOTE  94 VOLUME  9
-                0x80,0x46,0x08, //      0 T2 ON, NOTE  70 VOLUME  8
-           0x03,0xe0,0xe2,0x09, //    480 T1 ON, NOTE  98 VOLUME  9
-                0x80,0x56,0x09, //      0 T2 ON, NOTE  86 VOLUME  9
-           0x01,0xf0,0xd3,0x07, //    240 T1 ON, NOTE  83 VOLUME  7
-                0x80,0x4a,0x09, //      0 T2 ON, NOTE  74 VOLUME  9
-           0x01,0xf0,0xe1,0x07, //    240 T1 ON, NOTE  97 VOLUME  7
-                0x80,0x55,0x08, //      0 T2 ON, NOTE  85 VOLUME  8
-           0x01,0xf0,0xd3,0x07, //    240 T1 ON, NOTE  83 VOLUME  7
-                0x80,0x4a,0x09, //      0 T2 ON, NOTE  74 VOLUME  9
-           0x01,0xf0,0xe0,0x08, //    240 T1 ON, NOTE  96 VOLUME  8
-                0x80,0x54,0x08, //      0 T2 ON, NOTE  84 VOLUME  8
-           0x01,0xf0,0xd3,0x07, //    240 T1 ON, NOTE  83 VOLUME  7
-                0x80,0x4a,0x09, //      0 T2 ON, NOTE  74 VOLUME  9
-           0x01,0xf0,0x5f,0x08, //    240 T2 ON, NOTE  95 VOLUME  8
-           0x01,0xf0,0xca,0x09, //    240 T1 ON, NOTE  74 VOLUME  9
-                0x80,0x3e,0x08, //      0 T2 ON, NOTE  62 VOLUME  8
-           0x01,0xf0,0xdd,0x08, //    240 T1 ON, NOTE  93 VOLUME  8
-                0x80,0x51,0x08, //      0 T2 ON, NOTE  81 VOLUME  8
-           0x01,0xf0,0xcf,0x07, //    240 T1 ON, NOTE  79 VOLUME  7
-                0x80,0x4a,0x09, //      0 T2 ON, NOTE  74 VOLUME  9
-           0x01,0xf0,0x5b,0x08, //    240 T2 ON, NOTE  91 VOLUME  8
-           0x01,0xf0,0xca,0x09, //    240 T1 ON, NOTE  74 VOLUME  9
-                0x80,0x3e,0x08, //      0 T2 ON, NOTE  62 VOLUME  8
-           0x01,0xf0,0xda,0x07, //    240 T1 ON, NOTE  90 VOLUME  7
-                0x80,0x4e,0x08, //      0 T2 ON, NOTE  78 VOLUME  8
-           0x01,0xf0,0xca,0x09, //    240 T1 ON, NOTE  74 VOLUME  9
-                0x80,0x3e,0x08, //      0 T2 ON, NOTE  62 VOLUME  8
-           0x01,0xf0,0x58,0x08, //    240 T2 ON, NOTE  88 VOLUME  8
-           0x01,0xf0,0x3e,0x08, //    240 T2 ON, NOTE  62 VOLUME  8
-           0x01,0xf0,0xe2,0x0a, //    240 T1 ON, NOTE  98 VOLUME 10
-                0x80,0x56,0x0a, //      0 T2 ON, NOTE  86 VOLUME 10
-           0x01,0xf0,0xd1,0x09, //    240 T1 ON, NOTE  81 VOLUME  9
-                0x80,0x48,0x08, //      0 T2 ON, NOTE  72 VOLUME  8
-           0x01,0xf0,0xe1,0x08, //    240 T1 ON, NOTE  97 VOLUME  8
-                0x80,0x55,0x08, //      0 T2 ON, NOTE  85 VOLUME  8
-           0x01,0xf0,0xd1,0x09, //    240 T1 ON, NOTE  81 VOLUME  9
-                0x80,0x48,0x08, //      0 T2 ON, NOTE  72 VOLUME  8
-           0x01,0xf0,0xe0,0x08, //    240 T1 ON, NOTE  96 VOLUME  8
-                0x80,0x54,0x08, //      0 T2 ON, NOTE  84 VOLUME  8
-           0x01,0xf0,0xd1,0x09, //    240 T1 ON, NOTE  81 VOLUME  9
-                0x80,0x48,0x08, //      0 T2 ON, NOTE  72 VOLUME  8
-           0x01,0xf0,0xdf,0x08, //    240 T1 ON, NOTE  95 VOLUME  8
-                0x80,0x53,0x07, //      0 T2 ON, NOTE  83 VOLUME  7
-           0x01,0xf0,0xd1,0x09, //    240 T1 ON, NOTE  81 VOLUME  9
-                0x80,0x48,0x08, //      0 T2 ON, NOTE  72 VOLUME  8
-           0x01,0xf0,0xdd,0x08, //    240 T1 ON, NOTE  93 VOLUME  8
-                0x80,0x4e,0x08, //      0 T2 ON, NOTE  78 VOLUME  8
-           0x01,0xf0,0xca,0x0a, //    240 T1 ON, NOTE  74 VOLUME 10
-           0x01,0xf0,0xdb,0x07, //    240 T1 ON, NOTE  91 VOLUME  7
-                0x80,0x4f,0x08, //      0 T2 ON, NOTE  79 VOLUME  8
-           0x01,0xf0,0xce,0x08, //    240 T1 ON, NOTE  78 VOLUME  8
-                0x80,0x4a,0x08, //      0 T2 ON, NOTE  74 VOLUME  8
-           0x01,0xf0,0xda,0x08, //    240 T1 ON, NOTE  90 VOLUME  8
-                0x80,0x4e,0x08, //      0 T2 ON, NOTE  78 VOLUME  8
-           0x01,0xf0,0xca,0x08, //    240 T1 ON, NOTE  74 VOLUME  8
-                0x80,0x48,0x09, //      0 T2 ON, NOTE  72 VOLUME  9
-           0x01,0xf0,0xdd,0x08, //    240 T1 ON, NOTE  93 VOLUME  8
-                0x80,0x51,0x08, //      0 T2 ON, NOTE  81 VOLUME  8
-           0x01,0xf0,0xca,0x08, //    240 T1 ON, NOTE  74 VOLUME  8
-                0x80,0x48,0x09, //      0 T2 ON, NOTE  72 VOLUME  9
-           0x01,0xf0,0xdb,0x07, //    240 T1 ON, NOTE  91 VOLUME  7
-                0x80,0x53,0x09, //      0 T2 ON, NOTE  83 VOLUME  9
-           0x01,0xf0,0x5a,0x07, //    240 T2 ON, NOTE  90 VOLUME  7
-                0x84,0xd3,0x09, //      4 T1 ON, NOTE  83 VOLUME  9
-           0x01,0xdd,0x43,0x07, //    221 T2 ON, NOTE  67 VOLUME  7
-                0x8f,0x5b,0x09, //     15 T2 ON, NOTE  91 VOLUME  9
-           0x01,0xf0,0xda,0x09, //    240 T1 ON, NOTE  90 VOLUME  9
-                0x84,0x53,0x09, //      4 T2 ON, NOTE  83 VOLUME  9
-           0x01,0xdd,0xc3,0x07, //    221 T1 ON, NOTE  67 VOLUME  7
-                0x8f,0xdb,0x08, //     15 T1 ON, NOTE  91 VOLUME  8
-           0x03,0xe0,0xd6,0x07, //    480 T1 ON, NOTE  86 VOLUME  7
-                0x80,0x4a,0x07, //      0 T2 ON, NOTE  74 VOLUME  7
-           0x01,0xf0,0xd6,0x08, //    240 T1 ON, NOTE  86 VOLUME  8
-                0x80,0x3e,0x08, //      0 T2 ON, NOTE  62 VOLUME  8
-           0x0d,0x90,0xdb,0x09, //   1680 T1 ON, NOTE  91 VOLUME  9
-                0x80,0x4f,0x09, //      0 T2 ON, NOTE  79 VOLUME  9
-           0x03,0xe0,0xdd,0x09, //    480 T1 ON, NOTE  93 VOLUME  9
-                0x80,0x51,0x09, //      0 T2 ON, NOTE  81 VOLUME  9
-           0x03,0xe0,0xdf,0x09, //    480 T1 ON, NOTE  95 VOLUME  9
-                0x80,0x53,0x09, //      0 T2 ON, NOTE  83 VOLUME  9
-           0x03,0xe0,0xd6,0x09, //    480 T1 ON, NOTE  86 VOLUME  9
-                0x80,0x4a,0x06, //      0 T2 ON, NOTE  74 VOLUME  6
-           0x01,0xf0,0xd6,0x08, //    240 T1 ON, NOTE  86 VOLUME  8
-                0x80,0x3e,0x08, //      0 T2 ON, NOTE  62 VOLUME  8
-           0x10,0xf0,0xd3,0x08, //   2160 T1 ON, NOTE  83 VOLUME  8
-                0x80,0x53,0x0a, //      0 T2 ON, NOTE  83 VOLUME 10
-                0x01,0xf0,0x01, //    240 BOTH OFF
-           0x01,0xf0,0xd4,0x09, //    240 T1 ON, NOTE  84 VOLUME  9
-                0x80,0x54,0x08, //      0 T2 ON, NOTE  84 VOLUME  8
-                0x01,0xf0,0x01, //    240 BOTH OFF
-           0x01,0xf0,0xd6,0x09, //    240 T1 ON, NOTE  86 VOLUME  9
-                0x80,0x56,0x09, //      0 T2 ON, NOTE  86 VOLUME  9
-                0x03,0xe0,0x01, //    480 BOTH OFF
-           0x03,0xe0,0xdb,0x09, //    480 T1 ON, NOTE  91 VOLUME  9
-                0x80,0x4f,0x07, //      0 T2 ON, NOTE  79 VOLUME  7
-                0x01,0xf0,0x01, //    240 BOTH OFF
-           0x01,0xf0,0xdd,0x09, //    240 T1 ON, NOTE  93 VOLUME  9
-                0x80,0x51,0x08, //      0 T2 ON, NOTE  81 VOLUME  8
-                0x01,0xf0,0x01, //    240 BOTH OFF
-           0x01,0xf0,0xdf,0x09, //    240 T1 ON, NOTE  95 VOLUME  9
-                0x80,0x53,0x08, //      0 T2 ON, NOTE  83 VOLUME  8
-                0x03,0xe0,0x01, //    480 BOTH OFF
-           0x03,0xe0,0xd3,0x08, //    480 T1 ON, NOTE  83 VOLUME  8
-                0x80,0x53,0x08, //      0 T2 ON, NOTE  83 VOLUME  8
-                0x01,0xf0,0x01, //    240 BOTH OFF
-           0x01,0xf0,0xd4,0x08, //    240 T1 ON, NOTE  84 VOLUME  8
-                0x80,0x54,0x08, //      0 T2 ON, NOTE  84 VOLUME  8
-                0x01,0xf0,0x01, //    240 BOTH OFF
-           0x01,0xf0,0xd6,0x08, //    240 T1 ON, NOTE  86 VOLUME  8
-                0x80,0x56,0x09, //      0 T2 ON, NOTE  86 VOLUME  9
-                0x03,0xe0,0x01, //    480 BOTH OFF
-           0x12,0xe0,0xda,0x08, //   2400 T1 ON, NOTE  90 VOLUME  8
-                0x80,0x56,0x08, //      0 T2 ON, NOTE  86 VOLUME  8
-           0x03,0xe0,0xdb,0x0a, //    480 T1 ON, NOTE  91 VOLUME 10
-                0x80,0x53,0x08, //      0 T2 ON, NOTE  83 VOLUME  8
-           0x03,0xe0,0xda,0x09, //    480 T1 ON, NOTE  90 VOLUME  9
-                0x80,0x56,0x0a, //      0 T2 ON, NOTE  86 VOLUME 10
-           0x03,0xe0,0xdb,0x0a, //    480 T1 ON, NOTE  91 VOLUME 10
-                0x80,0x53,0x08, //      0 T2 ON, NOTE  83 VOLUME  8
-           0x03,0xe0,0xda,0x09, //    480 T1 ON, NOTE  90 VOLUME  9
-                0x80,0x56,0x0a, //      0 T2 ON, NOTE  86 VOLUME 10
-           0x03,0xe0,0xdb,0x0a, //    480 T1 ON, NOTE  91 VOLUME 10
-                0x80,0x53,0x09, //      0 T2 ON, NOTE  83 VOLUME  9
-           0x03,0xe0,0xda,0x09, //    480 T1 ON, NOTE  90 VOLUME  9
-                0x80,0x56,0x0a, //      0 T2 ON, NOTE  86 VOLUME 10
-           0x03,0xe0,0xdb,0x0a, //    480 T1 ON, NOTE  91 VOLUME 10
-                0x80,0x53,0x08, //      0 T2 ON, NOTE  83 VOLUME  8
-           0x03,0xe0,0xda,0x09, //    480 T1 ON, NOTE  90 VOLUME  9
-                0x80,0x56,0x0a, //      0 T2 ON, NOTE  86 VOLUME 10
-           0x03,0xe0,0xdb,0x0a, //    480 T1 ON, NOTE  91 VOLUME 10
-                0x80,0x53,0x09, //      0 T2 ON, NOTE  83 VOLUME  9
-           0x03,0xe0,0xda,0x09, //    480 T1 ON, NOTE  90 VOLUME  9
-                0x80,0x56,0x0a, //      0 T2 ON, NOTE  86 VOLUME 10
-           0x03,0xe0,0xdb,0x0a, //    480 T1 ON, NOTE  91 VOLUME 10
-                0x80,0x53,0x09, //      0 T2 ON, NOTE  83 VOLUME  9
-           0x03,0xe0,0xda,0x09, //    480 T1 ON, NOTE  90 VOLUME  9
-                0x80,0x56,0x0a, //      0 T2 ON, NOTE  86 VOLUME 10
-           0x03,0xe0,0xdb,0x0a, //    480 T1 ON, NOTE  91 VOLUME 10
-                0x80,0x53,0x09, //      0 T2 ON, NOTE  83 VOLUME  9
-           0x03,0xe0,0xda,0x0a, //    480 T1 ON, NOTE  90 VOLUME 10
-                0x80,0x56,0x0a, //      0 T2 ON, NOTE  86 VOLUME 10
-           0x03,0xe0,0xdb,0x0a, //    480 T1 ON, NOTE  91 VOLUME 10
-                0x80,0x53,0x09, //      0 T2 ON, NOTE  83 VOLUME  9
-           0x03,0xe0,0xda,0x09, //    480 T1 ON, NOTE  90 VOLUME  9
-                0x80,0x56,0x0a, //      0 T2 ON, NOTE  86 VOLUME 10
-           0x03,0xe0,0xdb,0x0a, //    480 T1 ON, NOTE  91 VOLUME 10
-                0x80,0x4f,0x08, //      0 T2 ON, NOTE  79 VOLUME  8
-           0x03,0xe0,0xdb,0x09, //    480 T1 ON, NOTE  91 VOLUME  9
-                0x80,0x47,0x09, //      0 T2 ON, NOTE  71 VOLUME  9
-           0x01,0xf0,0xdb,0x0a, //    240 T1 ON, NOTE  91 VOLUME 10
-           0x01,0xf0,0xdb,0x09, //    240 T1 ON, NOTE  91 VOLUME  9
-           0x07,0xc0,0x4f,0x0a, //    960 T2 ON, NOTE  79 VOLUME 10
-           0x03,0xe0,0xe2,0x0a, //    480 T1 ON, NOTE  98 VOLUME 10
-                0x80,0x4f,0x09, //      0 T2 ON, NOTE  79 VOLUME  9
-           0x03,0xe0,0xe2,0x09, //    480 T1 ON, NOTE  98 VOLUME  9
-                0x80,0x4f,0x0a, //      0 T2 ON, NOTE  79 VOLUME 10
-           0x07,0xc0,0x47,0x08, //    960 T2 ON, NOTE  71 VOLUME  8
-           0x03,0xe0,0xdf,0x09, //    480 T1 ON, NOTE  95 VOLUME  9
-                0x80,0x53,0x08, //      0 T2 ON, NOTE  83 VOLUME  8
-           0x01,0xf0,0x4f,0x09, //    240 T2 ON, NOTE  79 VOLUME  9
-           0x05,0xd0,0x4f,0x0a, //    720 T2 ON, NOTE  79 VOLUME 10
-           0x07,0xc0,0xdb,0x08, //    960 T1 ON, NOTE  91 VOLUME  8
-                0x80,0x47,0x0a, //      0 T2 ON, NOTE  71 VOLUME 10
-           0x01,0xf0,0xdb,0x09, //    240 T1 ON, NOTE  91 VOLUME  9
-           0x09,0xb0,0x4a,0x08, //   1200 T2 ON, NOTE  74 VOLUME  8
-           0x03,0xe0,0x4f,0x0a, //    480 T2 ON, NOTE  79 VOLUME 10
-           0x01,0xf0,0xdb,0x0a, //    240 T1 ON, NOTE  91 VOLUME 10
-                0x80,0x4a,0x08, //      0 T2 ON, NOTE  74 VOLUME  8
-           0x01,0xf0,0xdb,0x09, //    240 T1 ON, NOTE  91 VOLUME  9
-                0x80,0x4a,0x09, //      0 T2 ON, NOTE  74 VOLUME  9
-           0x0b,0xa0,0xe2,0x0a, //   1440 T1 ON, NOTE  98 VOLUME 10
-                0x80,0x56,0x08, //      0 T2 ON, NOTE  86 VOLUME  8
-           0x01,0xf0,0x4f,0x09, //    240 T2 ON, NOTE  79 VOLUME  9
-           0x01,0xf0,0xe2,0x09, //    240 T1 ON, NOTE  98 VOLUME  9
-           0x0b,0xa0,0xdf,0x09, //   1440 T1 ON, NOTE  95 VOLUME  9
-                0x80,0x53,0x09, //      0 T2 ON, NOTE  83 VOLUME  9
-           0x01,0xf0,0x4f,0x0a, //    240 T2 ON, NOTE  79 VOLUME 10
-           0x01,0xf0,0x4f,0x09, //    240 T2 ON, NOTE  79 VOLUME  9
-           0x03,0xe0,0x4f,0x0a, //    480 T2 ON, NOTE  79 VOLUME 10
-           0x03,0xe0,0xdb,0x09, //    480 T1 ON, NOTE  91 VOLUME  9
-                0x80,0x4a,0x09, //      0 T2 ON, NOTE  74 VOLUME  9
-           0x07,0xc0,0x53,0x0a, //    960 T2 ON, NOTE  83 VOLUME 10
-           0x07,0xc0,0xc3,0x0a, //    960 T1 ON, NOTE  67 VOLUME 10
-                     0x80,0x00, //      0 T2 OFF
-           0x03,0xe0,0xbe,0x0a, //    480 T1 ON, NOTE  62 VOLUME 10
-                0x80,0x3e,0x0a, //      0 T2 ON, NOTE  62 VOLUME 10
-           0x03,0xe0,0xc7,0x0a, //    480 T1 ON, NOTE  71 VOLUME 10
-                0x80,0x3b,0x0a, //      0 T2 ON, NOTE  59 VOLUME 10
-           0x03,0xe0,0xc3,0x0a, //    480 T1 ON, NOTE  67 VOLUME 10
-                     0x80,0x00, //      0 T2 OFF
-           0x03,0xe0,0xca,0x0a, //    480 T1 ON, NOTE  74 VOLUME 10
-                0x80,0x3e,0x0a, //      0 T2 ON, NOTE  62 VOLUME 10
-           0x03,0xe0,0xc7,0x0a, //    480 T1 ON, NOTE  71 VOLUME 10
-                     0x80,0x00, //      0 T2 OFF
-           0x03,0xe0,0xc3,0x0a, //    480 T1 ON, NOTE  67 VOLUME 10
-                0x80,0x43,0x09, //      0 T2 ON, NOTE  67 VOLUME  9
-           0x03,0xe0,0xd6,0x0a, //    480 T1 ON, NOTE  86 VOLUME 10
-                0x80,0x4a,0x0a, //      0 T2 ON, NOTE  74 VOLUME 10
-           0x03,0xe0,0xdb,0x0a, //    480 T1 ON, NOTE  91 VOLUME 10
-                0x80,0x43,0x0a, //      0 T2 ON, NOTE  67 VOLUME 10
-           0x03,0xe0,0xd6,0x0a, //    480 T1 ON, NOTE  86 VOLUME 10
-                0x80,0x4a,0x0a, //      0 T2 ON, NOTE  74 VOLUME 10
-           0x03,0xe0,0xdf,0x0a, //    480 T1 ON, NOTE  95 VOLUME 10
-                0x80,0x47,0x0a, //      0 T2 ON, NOTE  71 VOLUME 10
-           0x03,0xe0,0xdb,0x0a, //    480 T1 ON, NOTE  91 VOLUME 10
-                0x80,0x4f,0x0a, //      0 T2 ON, NOTE  79 VOLUME 10
-           0x03,0xe0,0xe2,0x0a, //    480 T1 ON, NOTE  98 VOLUME 10
-                0x80,0x4a,0x0a, //      0 T2 ON, NOTE  74 VOLUME 10
-           0x03,0xe0,0xdf,0x0a, //    480 T1 ON, NOTE  95 VOLUME 10
-                0x80,0x53,0x0a, //      0 T2 ON, NOTE  83 VOLUME 10
-           0x03,0xe0,0xe7,0x0a, //    480 T1 ON, NOTE 103 VOLUME 10
-                0x80,0x4f,0x0a, //      0 T2 ON, NOTE  79 VOLUME 10
-                0x07,0xc0,0x01, //    960 BOTH OFF
-           0x03,0xe0,0xdb,0x0a, //    480 T1 ON, NOTE  91 VOLUME 10
-                0x80,0x56,0x0a, //      0 T2 ON, NOTE  86 VOLUME 10
-                0x09,0xb0,0x01, //   1200 BOTH OFF
-           0x07,0xc0,0xdb,0x08, //    960 T1 ON, NOTE  91 VOLUME  8
-                0x80,0x53,0x09, //      0 T2 ON, NOTE  83 VOLUME  9
-                0x07,0xc0,0x01, //    960 BOTH OFF
-           0x05,0xd0,0xcf,0x08, //    720 T1 ON, NOTE  79 VOLUME  8
-                0x80,0x4f,0x09, //      0 T2 ON, NOTE  79 VOLUME  9
-           0x01,0xf0,0xcf,0x09, //    240 T1 ON, NOTE  79 VOLUME  9
-                0x80,0x47,0x09, //      0 T2 ON, NOTE  71 VOLUME  9
-                0x16,0xc0,0x01, //   2880 BOTH OFF
-                     0x80,0x05  //      0 END PROGRAM
+0x00,0x00,0x00,0x00,0x04,0x07,0x13,0x0d,0x11,0x13,0x13,0x0d,0x12,0x00,0x00,0x00, // HUFFMAN TABLE (129 symbols)
+0x47,0x48,0x4a,0x4f,0x17,0x49,0x51,0x53,0x56,0x5b,0x5f,0x01,0x16,0x18,0x19,0x28,
+0x37,0x38,0x43,0x45,0x46,0x4e,0x54,0x5a,0x5d,0x60,0x62,0x8f,0xba,0xf8,0x1a,0x1f,
+0x39,0x3e,0x4c,0x58,0x64,0x88,0x98,0xaa,0xca,0xf7,0xf9,0x07,0x0b,0x0f,0x15,0x27,
+0x29,0x35,0x36,0x3f,0x40,0x4b,0x76,0x7f,0x80,0xa0,0xd0,0xff,0x05,0x06,0x08,0x09,
+0x10,0x20,0x26,0x55,0x61,0x75,0x77,0x78,0x7a,0xb0,0xb8,0xc0,0xc8,0xe0,0xf5,0x0a,
+0x0d,0x12,0x25,0x2a,0x3a,0x42,0x44,0x52,0x5e,0x89,0x90,0x97,0xdf,0xe8,0xe9,0xea,
+0xf0,0xf6,0x30,0x50,0x57,0x5c,0x6a,0x8b,0xa8,0xa9,0xb9,0xe1,0xe6,0xe7,0xfa,0x00,
+0x03,0x14,0x23,0x24,0x2d,0x34,0x3b,0x66,0x67,0x68,0x69,0x79,0x84,0xc7,0xd7,0xdd,
+0xec,
+0xde,0xf6,0xff,0x91,0xfb,0x7f,0xbf,0xde,0xf7,0xe7,0xd7,0xbd,0xed,0x7b,0xff,0xff,
+0xed,0xef,0xfe,0x63,0x3a,0x9e,0x7d,0x88,0x67,0x53,0xc8,0x67,0xa1,0x6f,0x9c,0x0b,
+0x81,0x88,0x5c,0x0c,0x81,0xaf,0xb0,0x16,0xfa,0xe7,0x3c,0x6f,0x40,0xb9,0xce,0x35,
+0x81,0xc8,0xc0,0x5a,0x16,0x06,0x86,0x73,0xa1,0xb3,0xaf,0x89,0x71,0xb3,0x79,0x4f,
+0x9c,0xe0,0xfb,0x01,0x51,0xb2,0x25,0xfa,0x29,0x05,0x21,0x80,0xbd,0xe5,0x78,0x16,
+0xfa,0xb9,0xdf,0x60,0xd3,0x1b,0x38,0x97,0xbc,0xa7,0xce,0x70,0x7d,0x80,0xb8,0xd9,
+0xc4,0xac,0x3f,0xc7,0xb5,0x91,0xb2,0x06,0x21,0x9d,0xdf,0xe7,0xd6,0xf7,0xe9,0x8b,
+0xb0,0xa7,0x0f,0xeb,0xc1,0xd6,0x1e,0x40,0xe5,0x39,0xc9,0xf5,0x21,0x6f,0x94,0xf2,
+0xf9,0x03,0x6f,0x87,0xd6,0x73,0x92,0x17,0xca,0xbe,0x55,0x70,0xd1,0x3c,0xcf,0x93,
+0xe1,0x34,0xbc,0xa5,0x38,0x7f,0x5e,0x0e,0xb0,0x8c,0xe7,0x27,0xd4,0x85,0xf0,0x9c,
+0x6b,0x8d,0x81,0x47,0x7e,0x87,0xe8,0x9c,0x9f,0xa6,0x7a,0x39,0x15,0xca,0x73,0x82,
+0x17,0x39,0xbe,0x73,0x92,0x18,0x27,0x03,0x02,0x5d,0xe0,0x88,0x37,0x78,0x7d,0x6d,
+0x12,0x82,0xb8,0x5c,0x86,0x08,0x48,0xcd,0xde,0x1f,0x5b,0x44,0xa1,0x71,0x1c,0x8e,
+0x13,0x92,0xb1,0xa1,0x15,0x09,0x21,0x83,0x34,0x0c,0x10,0xf0,0x87,0x80,0x37,0x6f,
+0xf6,0x35,0x27,0x0d,0x69,0x54,0x2e,0x13,0x43,0x52,0x52,0x38,0x4f,0x25,0xa9,0xa7,
+0xc1,0x4c,0x14,0x8a,0x91,0x64,0x75,0x8d,0x32,0x34,0x59,0x0b,0x90,0xd4,0x2c,0x0e,
+0x45,0x89,0xc6,0xe0,0x38,0x1c,0x27,0xbb,0x83,0xaf,0x40,0xe6,0x43,0x92,0x70,0xe8,
+0x1c,0xc8,0x72,0x4e,0x1d,0x03,0x9a,0x07,0x24,0xe0,0xac,0x68,0x81,0xa1,0x99,0x15,
+0x0f,0x44,0x19,0xe7,0xcd,0x0b,0x84,0xe4,0x76,0xee,0xf7,0x6b,0xa4,0x77,0xfc,0x9e,
+0x47,0x09,0xc3,0xa0,0x73,0x40,0xe4,0x9c,0x3a,0x07,0x32,0x1c,0x93,0x87,0x40,0xe6,
+0x82,0xd1,0xa2,0x0f,0x30,0xe6,0x86,0xd4,0xd1,0x07,0x99,0x27,0x05,0xa3,0x44,0x0e,
+0x49,0xc4,0x7b,0xbf,0xc3,0xb7,0x40,0x66,0x43,0x92,0x70,0xe8,0x1c,0xc8,0x72,0x4e,
+0x1d,0x03,0x99,0x0e,0x49,0xa2,0xb1,0xa1,0x0d,0x0c,0xd0,0x54,0x3d,0x10,0x67,0x1c,
+0xd0,0xb9,0x27,0x23,0x84,0xff,0x1d,0xfe,0xc3,0x88,0xe1,0xd0,0x39,0x90,0xe4,0x9c,
+0x3a,0x03,0x32,0x1c,0x93,0x87,0x40,0xe6,0x82,0xd1,0xa2,0x0f,0x30,0xe6,0x82,0xd4,
+0xd1,0xd4,0xf3,0xf3,0x4f,0x96,0x39,0x83,0x2e,0x1f,0x1f,0xda,0x03,0x2a,0x04,0x26,
+0x82,0x69,0xf2,0xf8,0xf8,0xb9,0xfc,0x72,0x08,0xcd,0x18,0x04,0xbe,0x39,0x26,0x19,
+0x7f,0x54,0x81,0xfa,0xa3,0x48,0x84,0x92,0xc8,0x41,0x34,0x7f,0x44,0x73,0x07,0xd1,
+0xfa,0x77,0xbb,0x55,0x39,0x46,0xa0,0x2c,0x3e,0x3f,0xb5,0x62,0x70,0x52,0x2a,0x81,
+0x42,0x51,0xd2,0x0a,0xe5,0x5c,0xe7,0x21,0x89,0x48,0xb1,0x38,0xd4,0x14,0x75,0x3c,
+0xf9,0x00,0x77,0x60,0xf6,0xdc,0x08,0x03,0xbb,0x07,0xb6,0xe0,0x40,0x1c,0xcf,0x46,
+0x40,0x1d,0xd8,0x3d,0xb7,0x02,0x00,0xee,0xc1,0xed,0xb8,0x10,0x07,0x33,0xd1,0x90,
+0x07,0x76,0x0f,0x6d,0xc0,0x80,0x3b,0xb0,0x7b,0x0c,0x0c,0x03,0x99,0xe9,0x14,0x12,
+0xf3,0x3d,0x22,0xc2,0x5e,0x67,0xb9,0x48,0x03,0xbb,0x07,0xb6,0xe0,0x40,0x1d,0xd8,
+0x3d,0xb7,0x02,0x00,0xf4,0x98,0x4b,0x02,0xe3,0x5f,0x2a,0xa7,0xca,0xfd,0x03,0x33,
+0xe4,0x13,0x20,0x82,0x5c,0x3e,0x4f,0x79,0xce,0x08,0x50,0x4a,0x85,0xbe,0x72,0x2e,
+0x46,0x04,0xde,0x09,0xb8,0xa6,0x8e,0x60,0xca,0xfd,0x21,0x37,0x2a,0x83,0x2c,0x66,
+0x12,0xc0,0xb7,0xcf,0x85,0x93,0x17,0x2b,0x27,0x0f,0x43,0x39,0x59,0xf0,0xef,0x76,
+0xb2,0x36,0xa2,0xb7,0xdc,0x01,0xc2,0xc9,0xe5,0xe5,0x60,0x07,0x11,0x77,0xc1,0x0d,
+0x43,0x80,0xf9,0x5d,0x39,0xf2,0xd7,0x3d,0x0f,0xd5,0x31,0x70,0xb2,0x7c,0xaf,0xb0,
+0x57,0xe4,0x5e,0xdf,0x17,0xe6,0xd4,0x56,0xfb,0x80,0x1f,0x6c,0xeb,0xe5,0x74,0xc7,
+0x1d,0xb3,0x0f,0x7c,0x5f,0x19,0xe6,0xe1,0xb2,0x71,0xe5,0xaf,0x95,0xb3,0x92,0x1c,
+0xfb,0x5f,0x04,0x34,0x0e,0x06,0x89,0x6e,0xdf,0xec,0x72,0x57,0x05,0x62,0xa8,0x1a,
+0x27,0x05,0x43,0x44,0x2d,0x13,0x83,0x38,0x0c,0x16,0x91,0x45,0xa2,0xf6,0x6a,0xb7,
+0x59,0x69,0xd1,0x7b,0x3f,0x27,0xbf,0x98,0x61,0xfb,0xed,0x25,0xc5,0xa2,0xf6,0x6a,
+0xb7,0x5a,0xf4,0xe8,0xbd,0x9b,0x17,0x85,0xd6,0x12,0xa2,0xb6,0xfa,0x7e,0xeb,0x35,
+0xab,0x4d,0xb7,0xd3,0xb1,0x58,0x5d,0x64,0x56,0xdf,0x4e,0xab,0x35,0xab,0x4d,0xb7,
+0xd3,0xb1,0x58,0x5c,0xe2,0x38,0xac,0xbd,0x7a,0x9d,0xac,0xf4,0xd9,0x7a,0xf6,0x1e,
+0x17,0x3a,0x2b,0x2f,0x5e,0xa7,0x6b,0x3d,0x36,0x5e,0xbd,0x87,0xb6,0xea,0xc9,0x5c,
+0x4e,0xbd,0x5b,0x0f,0x0b,0xab,0x25,0x64,0x74,0x75,0x91,0xc4,0xeb,0xcf,0x55,0x7a,
+0xcf,0x4b,0xaf,0x3d,0x99,0xb6,0xdd,0x59,0x51,0x89,0x58,0xde,0x43,0x01,0x90,0xb4,
+0x0e,0x06,0x81,0x6e,0xdf,0xec,0x72,0x57,0x05,0x62,0xa8,0x1a,0x27,0x05,0x41,0xd1,
+0x03,0x44,0xd1,0x9c,0x45,0x16,0x91,0x71,0x68,0xbd,0x9a,0xad,0xd6,0x5a,0x74,0x5e,
+0xcf,0xc9,0xef,0xe6,0x58,0x7e,0xfb,0x49,0x71,0x68,0xbd,0x9a,0xad,0xd6,0xbf,0xb3,
+0x45,0xec,0xd8,0xbc,0x2e,0xb0,0x95,0x15,0xb7,0xd3,0xaa,0xcd,0x6a,0xd3,0x6d,0xf4,
+0xec,0x56,0x17,0x59,0x15,0xb7,0xd3,0xf7,0x59,0xad,0x5a,0x6d,0xbe,0x9d,0x8a,0xc2,
+0xe7,0x11,0xc5,0x65,0xeb,0xd4,0xed,0x67,0xa6,0xcb,0xd7,0xb0,0xf0,0xb9,0xdc,0x76,
+0x5e,0xbf,0xb9,0xda,0xcf,0x4d,0x97,0xaf,0x61,0xed,0xba,0xb2,0xcf,0xc4,0xeb,0xf3,
+0xec,0x57,0xe1,0x75,0x7c,0x6e,0x92,0xb2,0xab,0x8d,0xd7,0xd5,0xaa,0xbd,0x75,0x69,
+0x75,0xf5,0x6c,0x56,0xdb,0x9a,0x4c,0xc4,0x78,0xde,0xf3,0xae,0x69,0x71,0xbc,0xfd,
+0x33,0x4d,0x8d,0xee,0x15,0xfd,0x27,0xe2,0xf3,0xe6,0xe6,0x7b,0x91,0x53,0x51,0x8d,
+0xef,0x3d,0x13,0x74,0x73,0x3d,0xc8,0x73,0x9e,0x37,0xbe,0x1b,0xfd,0x8b,0x9a,0x5c,
+0x6f,0x70,0xd3,0x34,0xd8,0xde,0xe1,0x5c,0xd2,0xe3,0x7b,0xce,0x7f,0x4e,0x6e,0x67,
+0xb9,0x55,0x3d,0x18,0xde,0xf3,0xd1,0x37,0x47,0x33,0xdc,0x87,0x36,0x6c,0x6f,0x7c,
+0x37,0xfb,0x28,0x9b,0xa3,0x1b,0xde,0x73,0x9b,0x37,0x33,0xdf,0xe9,0x44,0xdd,0x18,
+0xde,0xf3,0x9c,0xd9,0xb9,0x9e,0xe4,0xa2,0x62,0xc6,0xf7,0x0e,0x69,0x93,0x8d,0xee,
+0x12,0x98,0x31,0xbd,0xfa,0x6f,0xf6,0x14,0xc1,0xd2,0x13,0x4a,0xf9,0x4f,0x32,0x0c,
+0x03,0xa4,0xdf,0x50,0x0b,0xeb,0x98,0xba,0x7c,0xb3,0xe6,0xe9,0x64,0xe7,0xd2,0xbf,
+0x45,0x33,0xab,0xa6,0x9e,0x95,0xce,0x7f,0x0e,0x0e,0xbc,0xd3,0x4d,0xd3,0x9a,0x79,
+0xba,0x68,0xfa,0x4b,0xa9,0xef,0x39,0x4c,0x1d,0x4f,0x20,0x90,0x73,0x07,0x49,0xf3,
+0xbe,0xa4,0x2e,0x69,0x7a,0x7c,0xa1,0x9b,0xd0,0xc0,0x3f,0x3a,0xe7,0x3e,0x9a,0x7e,
+0x99,0xbf,0xda,0x6e,0x95,0xce,0x7f,0x0e,0x0e,0xb5,0x78,0x9f,0xa2,0x62,0xf1,0x20,
+0xe7,0x08,0xe5,0xe6,0x79,0x03,0xc4,0x5e,0xbf,0xbd,0xed,0xd7,0x66,0x92,0x88,0xda,
+0x27,0x03,0x40,0xb7,0x6f,0xf6,0x39,0x2b,0x82,0xb1,0x54,0x0d,0x13,0x82,0xa1,0xa2,
+0x06,0x89,0xa3,0x38,0x0c,0x16,0x89,0x45,0xa2,0xf6,0x6a,0xb7,0xf8,0x17,0xd9,0xa2,
+0xf6,0x7b,0x8b,0x0b,0xad,0x25,0xc5,0xa2,0xf6,0x6a,0xb7,0x5a,0xf4,0xe8,0xbd,0x9b,
+0x17,0x85,0xd6,0x12,0xa2,0xb6,0xfa,0x75,0x59,0xad,0x5a,0x6d,0xbe,0x9d,0x8a,0xc2,
+0xeb,0x22,0xb6,0xfa,0x75,0x59,0xad,0x5a,0x6d,0xbe,0x9d,0x8a,0xc2,0xe7,0x11,0xc5,
+0x65,0xeb,0xd4,0xed,0x67,0xa6,0xcb,0xd7,0xb0,0xf0,0xb9,0xd1,0x59,0x7a,0xf5,0x3b,
+0x59,0xe9,0xb2,0xf5,0xec,0x3d,0xb7,0x56,0x4a,0x89,0xd7,0xab,0x61,0xe1,0x75,0x64,
+0xa9,0x1d,0x1d,0x64,0x71,0x3a,0xf3,0xfb,0xab,0xd6,0x7a,0x5d,0x79,0xec,0xcd,0x85,
+0xd5,0x95,0x18,0x95,0x8d,0xe4,0x30,0x18,0x86,0x89,0xc0,0xd0,0x2d,0xde,0x1f,0x5b,
+0x92,0xb8,0x2b,0x25,0x21,0xa0,0x70,0x54,0x34,0x42,0xd4,0x9a,0x33,0x88,0xa2,0xd4,
+0x94,0x5a,0x2f,0x66,0xab,0x7f,0x89,0x7d,0x9a,0x2f,0x67,0xb8,0xb6,0xdd,0x69,0x2e,
+0x2d,0x17,0xb3,0x55,0xba,0xd7,0xa7,0x45,0xec,0xd8,0xbd,0xb7,0x58,0x4a,0x8a,0xdb,
+0xe9,0xd5,0x66,0xb5,0x69,0xb6,0xfa,0x76,0x2b,0x0b,0xac,0x8a,0xdb,0xe9,0xd5,0x66,
+0xb5,0x7d,0x96,0xdf,0x4e,0xc5,0x6d,0xb9,0xc4,0x71,0x59,0x7a,0xf5,0x3b,0x59,0xe9,
+0xb2,0xf5,0xec,0x3c,0x2e,0x74,0x56,0x5e,0xbd,0x4e,0xd6,0x7a,0x6c,0xbd,0x7b,0x0f,
+0x6d,0xd5,0x96,0x78,0x9d,0x7e,0x7d,0x8a,0xfc,0x2e,0xae,0x27,0x49,0x59,0x55,0xc6,
+0xeb,0xea,0xd5,0x5e,0xba,0xb4,0xba,0xfa,0xb6,0x2b,0x6d,0xcd,0x26,0x62,0x34,0x2f,
+0x9e,0x05,0x89,0xa1,0xd0,0x3b,0xf1,0xdf,0xec,0x38,0x74,0x06,0x68,0x1c,0x93,0x87,
+0x40,0x66,0x81,0xc9,0x38,0x74,0x0e,0x64,0x39,0x27,0x05,0x63,0x44,0x0d,0x1c,0xd0,
+0x54,0x3d,0x10,0x67,0x1c,0xd8,0x9c,0x93,0xc8,0xe1,0x39,0x1d,0xbb,0xe4,0xf7,0xe8,
+0x1c,0xc8,0x72,0x4e,0x1d,0x03,0x99,0x0e,0x4b,0x61,0xd0,0x39,0xa0,0xb4,0x6a,0x47,
+0x98,0x73,0xc3,0x68,0xd1,0x07,0x98,0x4e,0x1b,0x46,0x84,0x39,0x2d,0x91,0xc2,0xdd,
+0xdf,0x1f,0xda,0xe9,0x1d,0xbb,0xbd,0xdb,0xa0,0x33,0xa1,0xc9,0x6c,0x3a,0x03,0x3a,
+0x1c,0x96,0xc3,0xa0,0x73,0xa1,0xc2,0xd4,0x56,0x35,0x40,0xd1,0xcf,0x05,0x43,0xfb,
+0x11,0x9c,0x73,0x42,0xe4,0xb6,0x47,0x0b,0x77,0x7c,0x9e,0xfd,0x01,0x9d,0x0e,0x4b,
+0x61,0xd0,0x9c,0xe8,0x72,0x5b,0x0e,0x80,0xcf,0x05,0xa3,0x54,0x1e,0x61,0xcf,0x0d,
+0xa2,0xce,0xa7,0x9f,0x9a,0x7c,0xbb,0x78,0x3a,0xc0,0x25,0x7c,0x67,0x99,0xf9,0xa6,
+0xcb,0xdf,0xe7,0x40,0x84,0xcf,0x84,0xf2,0xbf,0x30,0x73,0xa0,0x10,0x90,0x95,0xf2,
+0x9e,0x67,0xe6,0x9f,0xe8,0xde,0x27,0xd5,0xe4,0x2f,0x26,0x5e,0xf9,0x74,0xae,0x73,
+0x45,0x20,0xa4,0x13,0xf4,0xce,0xa7,0xd7,0x39,0xbe,0x73,0x92,0x16,0x07,0xc2,0xa9,
+0xa8,0xea,0x7b,0x86,0x59,0xb2,0xf9,0x32,0xfc,0xb9,0x7f,0xa7,0x7b,0xb7,0x2f,0xcb,
+0x96,0xce,0x19,0xa6,0x95,0xf0,0x9e,0x5e,0x19,0x7e,0x9c,0xbf,0x2e,0x5f,0x7f,0x87,
+0xd6,0xf8,0x4d,0x2f,0x20,0x72,0x4d,0x36,0x5e,0x1f,0xa3,0x87,0x2f,0x3b,0xf2,0xf2,
+0x4b,0x3e,0x5f,0x97,0x2f,0xe9,0xbf,0xd9,0x2f,0x24,0xbe,0x3e,0xfc,0xdd,0xf0,0xfe,
+0xee,0x50,0x9a,0x5e,0x52,0x9b,0x2f,0xf4,0xef,0x76,0xe5,0xe4,0xcb,0xcf,0xc2,0x33,
+0xe5,0xe4,0x9a,0x6c,0xbc,0x92,0xcf,0x2b,0xe1,0x34,0xbe,0x24,0x30,0x0a,0x46,0x24,
+0xa2,0x08,0x58,0x2b,0x91,0x91,0x06,0xf2,0xe1,0x6a,0x4e,0x1a,0xc5,0x70,0xb8,0x49,
+0xf6,0x02,0xe4,0x64,0x41,0xbc,0xbf,0x1e,0x46,0xa4,0xe1,0x72,0x57,0x23,0xb9,0xe4,
+0xac,0x14,0x8a,0xb8,0xa8,0x8d,0x82,0x50,0x30,0x15,0xe3,0x88,0xb7,0x97,0xe3,0x88,
+0xb7,0x97,0xe3,0xc8,0xd4,0x9c,0x35,0x82,0xf8,0xd5,0x91,0xc9,0x5a,0x1a,0x0b,0xc8,
+0xe1,0x8e,0x4b,0x52,0xcf,0x50,0x94,0xd1,0xd8,0x34,0xc7,0x58,0x8c,0x6d,0x15,0xe4,
+0xb1,0x34,0xc8,0xe1,0x27,0xd8,0x27,0xe4,0xcf,0xec,0x3f,0x6f,0xe3,0x75,0x59,0x1b,
+0xfc,0x0f,0xef,0x7b,0x0b,0xaa,0x1a,0x22,0x6f,0xb0,0xfe,0xf7,0xb7,0x5d,0x58,0x87,
+0x1b,0xbf,0x92,0xfe,0xf7,0xb0,0xba,0xc4,0xd3,0xf1,0x2b,0xc0,0xae,0x35,0x78,0x15,
+0x02,0xc4,0xf2,0x52,0x9a,0x64,0x58,0xaf,0xfe,0x98,0x05,0xf3,0x67,0xf6,0x07,0xba,
+0x5d,0xd7,0x54,0x9a,0x3e,0x66,0xfb,0x03,0xdb,0x85,0xd5,0x0d,0x11,0x37,0xd8,0x1e,
+0xe9,0x77,0x5d,0x5a,0x55,0xf3,0x3b,0xd8,0x1e,0xe9,0x77,0x5d,0x60,0xd3,0xe1,0x57,
+0x81,0x5f,0x12,0xbc,0x0a,0x85,0xc9,0x5f,0xa6,0xa2,0x5f,0xa9,0xa4,0x7e,0xaa,0xc9,
+0x9e,0xa7,0x25,0x7e,0x9a,0x89,0x7e,0xa6,0xa4,0xfd,0x55,0xa6,0x8f,0x57,0xd6,0x5f,
+0x56,0xee,0x0e,0xbe,0x82,0x96,0x06,0x81,0xf1,0xf4,0x47,0xfb,0x39,0xe1,0x6a,0x4e,
+0x17,0x03,0x3f,0xb7,0x07,0x5b,0x08,0xf7,0x9b,0x13,0x79,0x9e,0x85,0xa9,0x38,0x5c,
+0x4b,0xdd,0xc1,0xd6,0xb4,0xfe,0xbf,0x07,0xed,0x46,0x7e,0x78,0x7f,0x6a,0x7f,0x5c,
+0x3e,0x64,0xf9,0x77,0x70,0x75,0xfd,0x40,0x94,0x7d,0x61,0xf5,0x49,0xf5,0x84,0xf2,
+0x34,0x0e,0x1f,0xac,0x67,0x86,0xd4,0xb2,0x35,0xa4,0xa3,0xf3,0x0f,0x96,0x35,0xa4,
+0xa4,0xb0,0x69,0x8d,0x69,0x28,0x9d,0x90,0x87,0x2c,0x95,0x8a,0xa3,0x34,0x94,0x4d,
+0xc8,0x43,0x96,0x3a,0x86,0x8c,0x84,0x39,0x62,0xcf,0x16,0x5f,0x9e,0xd2,0x66,0x45,
+0x08,0xc9,0xe6,0x1f,0x2e,0x45,0x08,0xc9,0x60,0xd3,0x91,0x42,0x32,0x38,0x17,0x91,
+0x42,0x32,0x56,0x34,0x7c,0xe5,0x1b,0x44,0xe4,0xa0,0x4a,0x4a,0x86,0x89,0x09,0x23,
+0x25,0x62,0xa9,0x09,0x23,0x1b,0x52,0xbe,0x2a,0xbf,0x92,0xff,0xf2,0x5f,0xc6,0xe6,
+0xe4,0xab,0xf8,0xaf,0xff,0x65,0xc2,0xe6,0xa1,0x80,0x52,0x30,0x72,0xee,0xf8,0xfe,
+0xd6,0xa4,0xe1,0xad,0x2a,0x85,0xc9,0x5c,0x2c,0x9c,0xa4,0x60,0xe5,0xc3,0xc5,0xf9,
+0xac,0x97,0xcc,0xf6,0x4a,0x46,0x9e,0x67,0xb2,0x31,0x2c,0xc6,0xf4,0x2d,0x03,0xe6,
+0x7b,0x25,0x62,0xae,0x67,0xb2,0x38,0x57,0x8d,0xe8,0x16,0x2b,0xe6,0x7a,0x4a,0x46,
+0x9e,0x67,0xa4,0x62,0x59,0x8d,0xec,0x3e,0x4f,0x7d,0x42,0xcc,0x4d,0x15,0xc3,0x51,
+0x33,0x13,0x45,0x70,0xd4,0x4c,0xc4,0xd4,0xae,0x1a,0x89,0x98,0x9a,0x2b,0x86,0xa2,
+0x66,0x26,0xa5,0x70,0xd4,0x4c,0xc4,0xd4,0xae,0x1a,0x89,0x98,0x9a,0x95,0xe2,0xa8,
+0x99,0x89,0xa9,0x5c,0x35,0x13,0x31,0x34,0x4e,0x16,0xa4,0x3e,0x76,0xe4,0x6f,0xee,
+0x3c,0x56,0xa4,0xe1,0xb4,0x8f,0xfe,0x02,0x17,0x0a,0xf8,0xcf,0xf2,0xef,0x76,0x9f,
+0xa5,0xa4,0x19,0x1b,0xf8,0x78,0x7d,0x65,0xf1,0x1f,0xce,0xd1,0x2c,0x8d,0x49,0x7f,
+0x6d,0xfe,0xcb,0x45,0x9c,0x67,0x92,0xdd,0xdb,0xfd,0x8e,0x4a,0xfe,0x63,0xe3,0x3f,
+0x88,0xe1,0x6a,0x4b,0xf7,0x2f,0xd5,0x2f,0x3e,0x2c,0xa5,0x97,0x10,0x17,0xfa,0xe2,
+0x97,0x9f,0x11,0x16,0x5c,0x41,0xcf,0x8a,0x54,0xcb,0x89,0x84,0x58,0x9a,0x52,0xe2,
+0x61,0x16,0x27,0x10,0x62,0x69,0x1e,0x2b,0x48,0xb1,0x38,0x97,0x8b,0xfd,0xc8,0xfa,
+0x9e,0xc4,0xd2,0x67,0x77,0x87,0xd6,0xf7,0xa5,0xa9,0x5f,0x53,0xd8,0x77,0xbb,0x4d,
+0x27,0x90,0xd2,0x1d,0xcf,0xfb,0x5e,0x77,0x78
 };
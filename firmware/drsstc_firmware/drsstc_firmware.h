@@ -5,5 +5,14 @@
 #include "StateMachine.h"     // Define states
 #include "LEDRing.h"          // Neopixel
 #include "MIDIPlayer.h"       // MIDI->timers
+#include "VoiceBackend.h"     // Timer voices
+#include "VoiceRouter.h"      // Song voices -> timer voices
+#include "SyncLink.h"         // Multi-coil sync
+#include "Timebase.h"         // Timer0 timebase
+#include "EventQueue.h"       // ISR -> main loop notifications
+#include "FaultLog.h"         // EEPROM fault log
+#include "LoopMonitor.h"      // Loop deadlines and watchdog
+#include "SmfPlayer.h"        // MIDI files from SD card
+#include "ThermalModel.h"     // Bridge heating
 #include <Wire.h>             // I2C (for DAC)
 #include <MCP47X6.h>          // DAC
@@ -5,10 +5,19 @@
 const uint8_t INITIAL_DAC_VALUE = 0x80;
 MCP47X6 DAC = MCP47X6(DAC_ADDRESS);
 
-unsigned long ocd_count = 0;
-void ocd_int() { ocd_count++; }
+// Counted into ocd_count by dispatch_notifications()
+void ocd_int() { ocd_notifications.post(NOTIFY_OCD); }
+
+#if !defined(__AVR_ATmega2560__)
+// OCD_DETECT's pin change interrupt; rising edges only, as on the 2560
+ISR(PCINT0_vect) {
+  if (PINB & _BV(PINB0)) ocd_int();
+}
+#endif
 
 void setup() {  
+  init_loop_monitor();
+
   // Set pin directions
   pinMode(NEOPIXEL, OUTPUT);
   pinMode(PWM_1, OUTPUT);
@@ -21,8 +30,16 @@ void setup() {
   pinMode(TEST_IN, INPUT);
   pinMode(TRIG_IN, INPUT);
 
-  // Set OCD interrupt
+  // Set OCD interrupt. OCD_DETECT has no external interrupt on the 328
+  // (pin 8, PB0), so it uses its pin change interrupt (ISR below).
+  #if defined(__AVR_ATmega2560__)
   attachInterrupt(digitalPinToInterrupt(OCD_DETECT), ocd_int, RISING);
+  #else
+  static_assert(OCD_DETECT == 8, "OCD_DETECT is read as PCINT0 (PB0)");
+  PCMSK0 |= _BV(PCINT0);
+  PCIFR = _BV(PCIF0);
+  PCICR |= _BV(PCIE0);
+  #endif
 
   // Initialize output pins
   digitalWrite(PWM_1, LOW);
@@ -30,8 +47,12 @@ void setup() {
   digitalWrite(LED1, LOW);
   digitalWrite(LED2, LOW);
 
-  #ifdef SERIAL_LOGGING
+  #ifdef SYNC_LINK
+  init_sync_link();
+  #elif defined(SERIAL_LOGGING)
   Serial.begin(9600);
+  #endif
+  #ifdef SERIAL_LOGGING
   Serial.println(F("DRSSTC Firmware v1.0 - written by Brian Boucher, June 2019"));
   #endif
 
@@ -51,20 +72,101 @@ void setup() {
   Serial.println(INITIAL_DAC_VALUE);
   #endif
 
-  // Initialize timer1/timer2 outputs for interrupter
-  setup_timers();
+  // Initialize voice timer outputs for interrupter
+  setup_voices();
+
+  #ifdef SMF_PLAYBACK
+  init_smf_storage();
+  #endif
+
+  #ifdef SONG_BENCHMARK
+  benchmark_song_decode();
+    #ifdef SMF_PLAYBACK
+    benchmark_smf_decode();
+    #endif
+  #endif
+
+  init_fault_log();
 
   init_led_strip();
+
+  start_loop_monitor();
 }
 
 #ifdef SERIAL_LOGGING
   #define SERIAL_HEARTBEAT_TIME 5000
   unsigned long last_serial_heartbeat = 0;
+
+  // The heartbeat goes out a line per loop, each into an empty TX buffer:
+  // at 9600 baud the whole report would wait ~100 ms for the UART. Every
+  // line fits the buffer (SERIAL_TX_BUFFER_SIZE - 1 bytes).
+  #define REPORT_HEARTBEAT 0
+  #define REPORT_QUEUES    1
+  #define REPORT_LOOP      2
+  #define REPORT_THERMAL   3
+  #define REPORT_DONE      4
+  uint8_t report_line = REPORT_DONE;
+
+  void report_next_line() {
+    if (report_line == REPORT_DONE || Serial.availableForWrite() < SERIAL_TX_BUFFER_SIZE - 1) return;
+    switch (report_line++) {
+      case REPORT_HEARTBEAT:
+        Serial.print(F("Heartbeat: "));
+        Serial.print(ocd_count);
+        Serial.print(F(" OCD, "));
+        Serial.print(midi_instruction_count);
+        Serial.print(F(" MIDI, up "));
+        Serial.print((unsigned long)(timebase_us64() / 1000000));
+        Serial.println(F(" s"));
+        break;
+      case REPORT_QUEUES:
+        Serial.print(F("Queues: "));
+        Serial.print(pulse_train_underruns);
+        Serial.print(F(" underruns, "));
+        Serial.print(player_notifications_dropped);
+        Serial.println(F(" dropped"));
+        break;
+      case REPORT_LOOP:
+        loop_monitor_report();
+        break;
+      case REPORT_THERMAL:
+        thermal_report();
+        break;
+    }
+  }
 #endif
 
+// Serial commands: dump the fault log, outside of pulsing states; play a
+// test pattern, in TEST_MODE with the run switch on
+#define FAULT_LOG_DUMP_COMMAND 'L'
+#define TEST_SCALE_COMMAND     'S'
+#define TEST_CHORDS_COMMAND    'C'
+
 void loop() {
+  loop_monitor_begin();
+  #ifdef SYNC_LINK
+  sync_update();
+  #elif defined(SERIAL_LOGGING)
+  if (Serial.available()) {
+    int command = Serial.read();
+    if (command == FAULT_LOG_DUMP_COMMAND
+        && get_current_state() != MUSIC_PLAY && get_current_state() != SLOW_PULSE) {
+      fault_log_dump();
+    } else if (command == TEST_SCALE_COMMAND) {
+      test_mode_play(TEST_SCALE);
+    } else if (command == TEST_CHORDS_COMMAND) {
+      test_mode_play(TEST_CHORDS);
+    }
+  }
+  #endif
+  loop_phase(LOOP_PHASE_STATE);
+  thermal_update();
   update_state_machine();
+  loop_phase(LOOP_PHASE_NOTIFY);
+  dispatch_notifications();
+  loop_phase(LOOP_PHASE_LEDS);
   led_update();
+  loop_phase(LOOP_PHASE_OUTPUT);
   switch (get_current_state()) {
     case SLOW_PULSE: 
       slow_pulse();
@@ -77,16 +179,13 @@ void loop() {
       break;
   }
 
+  loop_phase(LOOP_PHASE_REPORT);
   #ifdef SERIAL_LOGGING
-  unsigned long timestamp = millis();
-  if (last_serial_heartbeat == 0 || last_serial_heartbeat > timestamp)
+  unsigned long timestamp = timebase_ms();
+  if (timestamp - last_serial_heartbeat > SERIAL_HEARTBEAT_TIME) {
     last_serial_heartbeat = timestamp;
-  if (timestamp > last_serial_heartbeat + SERIAL_HEARTBEAT_TIME) {
-    Serial.print(F("Heartbeat: "));
-    Serial.print(ocd_count);
-    Serial.print(F(" OCD, "));
-    Serial.print(midi_instruction_count);
-    Serial.println(F(" MIDI"));
+    report_line = REPORT_HEARTBEAT;
   }
+  report_next_line();
   #endif
 }
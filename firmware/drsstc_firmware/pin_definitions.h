@@ -5,10 +5,20 @@
 #define NEOPIXEL    2   // Output data pin for neopixels
 #define PWM_1       9   // Labeled 'B' on board, connected to Timer1
 #define PWM_2       3   // Labeled 'A' on board, connected to Timer2
-#define OCD_DETECT  8   // Input for overcurrent detection
+#define PWM_3       5   // Timer0, TIMER0_VOICE builds only; OR into the interrupter with PWM_1/PWM_2
+#if defined(__AVR_ATmega2560__)
+  #define OCD_DETECT 19  // Input for overcurrent detection (INT2); pin 8 has no external interrupt
+#else
+  #define OCD_DETECT  8  // Input for overcurrent detection (PCINT0)
+#endif
 #define LED1       10   // Status LED 1 output
-#define LED2       11   // Status LED 2 output
+#if defined(__AVR_ATmega2560__)
+  #define LED2     13   // Status LED 2 output; pin 11 is voice 0's gate (OC1A) on the 2560
+#else
+  #define LED2     11   // Status LED 2 output
+#endif
 #define MSTR_EN    A0   // Master switch input
 #define MODE_IN    A1   // Mode switch input
 #define TEST_IN    A2   // Test switch input
 #define TRIG_IN    A3   // Trigger switch input
+#define SD_CS      53   // SD card chip select, SMF_PLAYBACK builds (ATmega2560 hardware SS)
@@ -0,0 +1,139 @@
+import argparse
+import struct
+
+from typing import List, NamedTuple, Optional
+
+# Decodes the fault log dumped by the firmware's 'L' serial command
+# (FaultLog.h): a ring of 8-byte records, each a 16-bit sequence number,
+# a type, an argument and a timestamp in ms since boot.
+RECORD_FORMAT = '<HBBI'
+RECORD_SIZE = struct.calcsize(RECORD_FORMAT)
+SEQ_EMPTY = 0xffff
+
+DUMP_COMMAND = b'L'
+DUMP_BAUD = 9600
+
+STATE_NAMES = ['STARTUP', 'LIGHT_SHOW', 'SLOW_PULSE', 'MUSIC_PLAY', 'MUSIC_PAUSE',
+               'MUSIC_INT', 'TEST_MODE', 'TEST_MODE_INC', 'SHUTDOWN']
+
+
+def state_name(state: int) -> str:
+    return STATE_NAMES[state] if state < len(STATE_NAMES) else 'STATE %d' % state
+
+
+# Phases of the firmware's loop() (LoopMonitor.h)
+PHASE_NAMES = ['comms', 'state', 'notify', 'leds', 'output', 'report']
+
+
+def phase_name(phase: int) -> str:
+    return PHASE_NAMES[phase] if phase < len(PHASE_NAMES) else 'phase %d' % phase
+
+
+def describe_overrun(arg: int) -> str:
+    steps = arg & 0x1f
+    duration = '>=248 ms' if steps == 0x1f else '%d-%d ms' % (steps * 8, steps * 8 + 8)
+    return '%s in %s' % (duration, phase_name(arg >> 5))
+
+
+RECORD_TYPES = {
+    1: ('BOOT', lambda arg: ''),
+    2: ('STATE', lambda arg: '> %s' % state_name(arg)),
+    3: ('TIMEOUT', lambda arg: 'in %s' % state_name(arg)),
+    4: ('OCD', lambda arg: '%s%d trips' % ('>=' if arg == 0xff else '', arg)),
+    5: ('DROPPED', lambda arg: '%d records lost' % arg),
+    6: ('OVERRUN', describe_overrun),
+    7: ('WATCHDOG', lambda arg: 'stalled in %s' % phase_name(arg)),
+    8: ('THERMAL', lambda arg: 'cut song %d' % arg),
+    9: ('STATES_DROPPED', lambda arg: '%d state changes lost' % arg),
+}
+
+
+class LogRecord(NamedTuple):
+    seq: int
+    type: int
+    arg: int
+    time_ms: int
+
+
+def next_in_sequence(seq: int) -> int:
+    seq = (seq + 1) & 0xffff
+    return 0 if seq == SEQ_EMPTY else seq
+
+
+def parse_dump(lines: List[str]) -> bytes:
+    data = bytearray()
+    size = None
+    for line in lines:
+        line = line.strip()
+        if line.startswith('FAULT LOG'):
+            size = int(line.split()[-1])
+            data = bytearray()
+        elif size is not None and line == 'END':
+            break
+        elif size is not None:
+            data += bytes.fromhex(line)
+    if size is None or len(data) != size:
+        raise ValueError('No complete fault log dump found')
+    return bytes(data)
+
+
+def get_records(data: bytes) -> List[LogRecord]:
+    # Oldest first: the ring starts after the record whose successor breaks
+    # the sequence, as the firmware's boot scan finds it
+    slots = [LogRecord(*struct.unpack_from(RECORD_FORMAT, data, i))
+             for i in range(0, len(data) - RECORD_SIZE + 1, RECORD_SIZE)]
+    start = 0
+    for i, rec in enumerate(slots):
+        if rec.seq != SEQ_EMPTY and slots[(i + 1) % len(slots)].seq != next_in_sequence(rec.seq):
+            start = i + 1
+            break
+    ordered = slots[start:] + slots[:start]
+    return [rec for rec in ordered if rec.seq != SEQ_EMPTY]
+
+
+def format_record(rec: LogRecord) -> str:
+    name, describe = RECORD_TYPES.get(rec.type, ('TYPE %d' % rec.type, lambda arg: 'arg %d' % arg))
+    return '%5d  %10.3f s  %-8s %s' % (rec.seq, rec.time_ms / 1000.0, name, describe(rec.arg))
+
+
+def read_serial(port: str, timeout: float) -> List[str]:
+    import serial  # pyserial, only needed to read from the board
+    with serial.Serial(port, DUMP_BAUD, timeout=timeout) as conn:
+        conn.reset_input_buffer()
+        conn.write(DUMP_COMMAND)
+        lines = list()
+        while True:
+            line = conn.readline().decode('ascii', errors='replace')
+            if not line:
+                break
+            lines.append(line)
+            if line.strip() == 'END':
+                break
+        return lines
+
+
+if __name__ == '__main__':
+    parser = argparse.ArgumentParser(description='Decode the DRSSTC firmware fault log',
+                                     add_help=True)
+    parser.add_argument('-i', '--input', metavar='PATH', type=str, nargs='?', required=False,
+                        help='Saved serial output containing a fault log dump')
+    parser.add_argument('-p', '--port', metavar='PORT', type=str, nargs='?', required=False,
+                        help='Serial port to request the dump from')
+    parser.add_argument('--timeout', metavar='S', type=float, nargs='?', required=False, default=10.0,
+                        help='Serial read timeout in seconds')
+    args = parser.parse_args()
+    if bool(args.input) == bool(args.port):
+        parser.error('give exactly one of --input and --port')
+
+    if args.input:
+        with open(args.input) as inf:
+            dump_lines = inf.readlines()
+    else:
+        dump_lines = read_serial(args.port, args.timeout)
+
+    records = get_records(parse_dump(dump_lines))
+    print('%d records' % len(records))
+    for record in records:
+        if record.type == 1:
+            print('-' * 40)
+        print(format_record(record))
@@ -0,0 +1,923 @@
+#include "AvrModel.h"
+#include <avr/io.h>
+#include <avr/interrupt.h>
+#include <avr/wdt.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#define AVR_DEFINE_REGISTER8(name) volatile uint8_t name;
+#define AVR_DEFINE_REGISTER16(name) volatile uint16_t name;
+#define AVR_DEFINE_HOOKED8(name) volatile uint8_t avr_reg_##name;
+#define AVR_DEFINE_HOOKED16(name) volatile uint16_t avr_reg_##name;
+AVR_PLAIN_REGISTERS8(AVR_DEFINE_REGISTER8)
+AVR_PLAIN_REGISTERS16(AVR_DEFINE_REGISTER16)
+AVR_HOOKED_REGISTERS8(AVR_DEFINE_HOOKED8)
+AVR_HOOKED_REGISTERS16(AVR_DEFINE_HOOKED16)
+
+// Handlers defined with ISR() by the firmware or the host core, if any
+#define AVR_WEAK_ISR(vector) extern "C" void avr_isr_##vector(void) __attribute__((weak));
+AVR_WEAK_ISR(WDT_vect)
+AVR_WEAK_ISR(TIMER0_COMPA_vect) AVR_WEAK_ISR(TIMER0_COMPB_vect) AVR_WEAK_ISR(TIMER0_OVF_vect)
+AVR_WEAK_ISR(TIMER1_COMPA_vect) AVR_WEAK_ISR(TIMER1_COMPB_vect) AVR_WEAK_ISR(TIMER1_COMPC_vect)
+AVR_WEAK_ISR(TIMER1_OVF_vect)
+AVR_WEAK_ISR(TIMER2_COMPA_vect) AVR_WEAK_ISR(TIMER2_COMPB_vect) AVR_WEAK_ISR(TIMER2_OVF_vect)
+AVR_WEAK_ISR(TIMER3_COMPA_vect) AVR_WEAK_ISR(TIMER3_COMPB_vect) AVR_WEAK_ISR(TIMER3_COMPC_vect)
+AVR_WEAK_ISR(TIMER3_OVF_vect)
+AVR_WEAK_ISR(TIMER4_COMPA_vect) AVR_WEAK_ISR(TIMER4_COMPB_vect) AVR_WEAK_ISR(TIMER4_COMPC_vect)
+AVR_WEAK_ISR(TIMER4_OVF_vect)
+AVR_WEAK_ISR(TIMER5_COMPA_vect) AVR_WEAK_ISR(TIMER5_COMPB_vect) AVR_WEAK_ISR(TIMER5_COMPC_vect)
+AVR_WEAK_ISR(TIMER5_OVF_vect)
+AVR_WEAK_ISR(USART_RX_vect) AVR_WEAK_ISR(USART_UDRE_vect)
+AVR_WEAK_ISR(USART0_RX_vect) AVR_WEAK_ISR(USART0_UDRE_vect)
+AVR_WEAK_ISR(EE_READY_vect)
+AVR_WEAK_ISR(PCINT0_vect) AVR_WEAK_ISR(PCINT1_vect) AVR_WEAK_ISR(PCINT2_vect)
+
+void avr_cli() {
+  avr_model::disable_interrupts();
+}
+
+void avr_sei() {
+  avr_model::enable_interrupts();
+}
+
+void avr_wdt_reset() {
+  avr_model::run(1);
+  avr_model::watchdog_reset();
+}
+
+namespace avr_model {
+
+namespace {
+  const cycles_t NEVER = ~(cycles_t)0;
+
+  #if defined(__AVR_ATmega2560__)
+    const uint8_t NUM_PINS = 70;
+    const uint8_t NUM_TIMERS = 6;
+    const uint8_t NUM_EXTERNAL = 6;
+    const cycles_t ISR_ENTRY_CYCLES = 5;  // 3-byte return address
+  #else
+    const uint8_t NUM_PINS = 20;
+    const uint8_t NUM_TIMERS = 3;
+    const uint8_t NUM_EXTERNAL = 2;
+    const cycles_t ISR_ENTRY_CYCLES = 4;
+  #endif
+  const cycles_t EEPROM_WRITE_CYCLES = F_CPU / 1000000 * 3300;
+  // Flag bits no timer has, set in the TIFRn variables so a firmware write
+  // (write one to clear) can be told from the model's own update
+  const uint8_t TIFR_SENTINEL = 0xc0;
+
+  cycles_t current = 0;
+  cycles_t isr_cycles = 40;
+  bool in_isr = false;
+
+  // ---- Pins ----
+
+  volatile uint8_t* const PORTS[] = {&PORTA, &PORTB, &PORTC, &PORTD, &PORTE, &PORTF,
+                                     &PORTG, &PORTH, &PORTJ, &PORTK, &PORTL};
+  volatile uint8_t* const DDRS[] = {&DDRA, &DDRB, &DDRC, &DDRD, &DDRE, &DDRF,
+                                    &DDRG, &DDRH, &DDRJ, &DDRK, &DDRL};
+  enum { PA, PB, PC, PD, PE, PF, PG, PH, PJ, PK, PL };
+
+  struct PinInfo {
+    uint8_t port;
+    uint8_t bit;
+    int8_t timer;    // output compare unit on the pin, or -1
+    int8_t channel;  // 0-2 = A-C
+  };
+
+  #if defined(__AVR_ATmega2560__)
+  const PinInfo PINS[NUM_PINS] = {
+    {PE, 0, -1, 0}, {PE, 1, -1, 0}, {PE, 4, 3, 1}, {PE, 5, 3, 2}, {PG, 5, 0, 1},
+    {PE, 3, 3, 0}, {PH, 3, 4, 0}, {PH, 4, 4, 1}, {PH, 5, 4, 2}, {PH, 6, 2, 1},
+    {PB, 4, 2, 0}, {PB, 5, 1, 0}, {PB, 6, 1, 1}, {PB, 7, 0, 0}, {PJ, 1, -1, 0},
+    {PJ, 0, -1, 0}, {PH, 1, -1, 0}, {PH, 0, -1, 0}, {PD, 3, -1, 0}, {PD, 2, -1, 0},
+    {PD, 1, -1, 0}, {PD, 0, -1, 0}, {PA, 0, -1, 0}, {PA, 1, -1, 0}, {PA, 2, -1, 0},
+    {PA, 3, -1, 0}, {PA, 4, -1, 0}, {PA, 5, -1, 0}, {PA, 6, -1, 0}, {PA, 7, -1, 0},
+    {PC, 7, -1, 0}, {PC, 6, -1, 0}, {PC, 5, -1, 0}, {PC, 4, -1, 0}, {PC, 3, -1, 0},
+    {PC, 2, -1, 0}, {PC, 1, -1, 0}, {PC, 0, -1, 0}, {PD, 7, -1, 0}, {PG, 2, -1, 0},
+    {PG, 1, -1, 0}, {PG, 0, -1, 0}, {PL, 7, -1, 0}, {PL, 6, -1, 0}, {PL, 5, 5, 2},
+    {PL, 4, 5, 1}, {PL, 3, 5, 0}, {PL, 2, -1, 0}, {PL, 1, -1, 0}, {PL, 0, -1, 0},
+    {PB, 3, -1, 0}, {PB, 2, -1, 0}, {PB, 1, -1, 0}, {PB, 0, -1, 0}, {PF, 0, -1, 0},
+    {PF, 1, -1, 0}, {PF, 2, -1, 0}, {PF, 3, -1, 0}, {PF, 4, -1, 0}, {PF, 5, -1, 0},
+    {PF, 6, -1, 0}, {PF, 7, -1, 0}, {PK, 0, -1, 0}, {PK, 1, -1, 0}, {PK, 2, -1, 0},
+    {PK, 3, -1, 0}, {PK, 4, -1, 0}, {PK, 5, -1, 0}, {PK, 6, -1, 0}, {PK, 7, -1, 0}};
+  #else
+  const PinInfo PINS[NUM_PINS] = {
+    {PD, 0, -1, 0}, {PD, 1, -1, 0}, {PD, 2, -1, 0}, {PD, 3, 2, 1}, {PD, 4, -1, 0},
+    {PD, 5, 0, 1}, {PD, 6, 0, 0}, {PD, 7, -1, 0}, {PB, 0, -1, 0}, {PB, 1, 1, 0},
+    {PB, 2, 1, 1}, {PB, 3, 2, 0}, {PB, 4, -1, 0}, {PB, 5, -1, 0}, {PC, 0, -1, 0},
+    {PC, 1, -1, 0}, {PC, 2, -1, 0}, {PC, 3, -1, 0}, {PC, 4, -1, 0}, {PC, 5, -1, 0}};
+  #endif
+
+  volatile uint8_t* const PIN_REGISTERS[] = {
+    &avr_reg_PINA, &avr_reg_PINB, &avr_reg_PINC, &avr_reg_PIND, &avr_reg_PINE, &avr_reg_PINF,
+    &avr_reg_PING, &avr_reg_PINH, &avr_reg_PINJ, &avr_reg_PINK, &avr_reg_PINL};
+
+  bool inputs[NUM_PINS];
+  bool levels[NUM_PINS];
+  PinListener listeners[NUM_PINS];
+
+  // ---- Pin change interrupts ----
+
+  volatile uint8_t* const PCMSKS[] = {&PCMSK0, &PCMSK1, &PCMSK2};
+  // Flag bits PCIFR does not have, as TIFR_SENTINEL
+  const uint8_t PCIFR_SENTINEL = 0xf8;
+  const uint8_t RX_PIN = 0;
+
+  int8_t pcint_pins[3][8];    // pin on each PCINT line, or -1
+  uint8_t pcint_flags = 0;
+  uint8_t pcint_masks[3];     // PCMSKn as of the last update
+  bool pcint_levels[NUM_PINS];
+
+  void map_pcint_pins() {
+    memset(pcint_pins, -1, sizeof pcint_pins);
+    for (uint8_t pin = 0; pin < NUM_PINS; pin++) {
+      const PinInfo& info = PINS[pin];
+      #if defined(__AVR_ATmega2560__)
+        // PCINT8 is PE0, PCINT9-15 are PJ0-6
+        if (info.port == PB) pcint_pins[0][info.bit] = pin;
+        else if (info.port == PE && info.bit == 0) pcint_pins[1][0] = pin;
+        else if (info.port == PJ && info.bit < 7) pcint_pins[1][info.bit + 1] = pin;
+        else if (info.port == PK) pcint_pins[2][info.bit] = pin;
+      #else
+        if (info.port == PB) pcint_pins[0][info.bit] = pin;
+        else if (info.port == PC) pcint_pins[1][info.bit] = pin;
+        else if (info.port == PD) pcint_pins[2][info.bit] = pin;
+      #endif
+    }
+  }
+
+  bool pcint_enabled(uint8_t pin) {
+    for (uint8_t group = 0; group < 3; group++) {
+      for (uint8_t bit = 0; bit < 8; bit++)
+        if (pcint_pins[group][bit] == pin) return *PCMSKS[group] & _BV(bit);
+    }
+    return false;
+  }
+
+  // ---- Timers ----
+
+  struct Timer {
+    bool present;
+    bool wide;
+    bool timer2_prescaler;
+    uint8_t channels;
+    volatile uint8_t* tccra;
+    volatile uint8_t* tccrb;
+    volatile uint8_t* timsk;
+    volatile uint8_t* tifr;
+    volatile uint8_t* tcnt8;
+    volatile uint16_t* tcnt16;
+    volatile uint8_t* ocr8[3];
+    volatile uint16_t* ocr16[3];
+    volatile uint16_t* icr;
+
+    uint8_t flags;
+    uint16_t active[3];  // compare values in use; buffered in PWM modes
+    bool oc[3];          // output compare latches
+    cycles_t last;       // cycle the count was last brought up to
+  };
+
+  Timer timers[6] = {
+    {true, false, false, 2, &TCCR0A, &TCCR0B, &TIMSK0, &avr_reg_TIFR0,
+     &avr_reg_TCNT0, nullptr, {&OCR0A, &OCR0B, nullptr}, {}, nullptr},
+    {true, true, false, 2, &TCCR1A, &TCCR1B, &TIMSK1, &avr_reg_TIFR1,
+     nullptr, &avr_reg_TCNT1, {}, {&OCR1A, &OCR1B, &OCR1C}, &ICR1},
+    {true, false, true, 2, &TCCR2A, &TCCR2B, &TIMSK2, &avr_reg_TIFR2,
+     &avr_reg_TCNT2, nullptr, {&OCR2A, &OCR2B, nullptr}, {}, nullptr},
+    {true, true, false, 3, &TCCR3A, &TCCR3B, &TIMSK3, &avr_reg_TIFR3,
+     nullptr, &avr_reg_TCNT3, {}, {&OCR3A, &OCR3B, &OCR3C}, &ICR3},
+    {true, true, false, 3, &TCCR4A, &TCCR4B, &TIMSK4, &avr_reg_TIFR4,
+     nullptr, &avr_reg_TCNT4, {}, {&OCR4A, &OCR4B, &OCR4C}, &ICR4},
+    {true, true, false, 3, &TCCR5A, &TCCR5B, &TIMSK5, &avr_reg_TIFR5,
+     nullptr, &avr_reg_TCNT5, {}, {&OCR5A, &OCR5B, &OCR5C}, &ICR5}};
+
+  struct Shape {
+    bool counting;
+    bool pwm;       // fast PWM: compare registers buffered, outputs set or cleared at BOTTOM
+    bool toggle_a;  // COMnA = 1 toggles OCnA, in the modes with OCRnA as TOP
+    uint16_t top;
+    bool tov_at_top;
+  };
+
+  uint16_t count(const Timer& t) { return t.wide ? *t.tcnt16 : *t.tcnt8; }
+  void set_count(Timer& t, uint16_t value) {
+    if (t.wide) *t.tcnt16 = value; else *t.tcnt8 = value;
+  }
+  uint16_t ocr(const Timer& t, uint8_t channel) {
+    return t.wide ? *t.ocr16[channel] : *t.ocr8[channel];
+  }
+  uint16_t max_count(const Timer& t) { return t.wide ? 0xffff : 0xff; }
+
+  unsigned prescale(const Timer& t) {
+    static const unsigned TIMER_PRESCALES[] = {1, 8, 64, 256, 1024, 0, 0};
+    static const unsigned TIMER2_PRESCALES[] = {1, 8, 32, 64, 128, 256, 1024};
+    uint8_t cs = *t.tccrb & 0x07;
+    if (!cs) return 0;
+    // CS 6-7 clock Timers 0, 1 and 3-5 from a pin, which is not modelled
+    return t.timer2_prescaler ? TIMER2_PRESCALES[cs - 1] : TIMER_PRESCALES[cs - 1];
+  }
+
+  Shape shape(const Timer& t) {
+    uint8_t wgm = (*t.tccra & 0x03) | (((*t.tccrb >> 3) & (t.wide ? 0x03 : 0x01)) << 2);
+    uint16_t max = max_count(t);
+    if (!t.wide) {
+      switch (wgm) {
+        case 0: return {true, false, false, max, true};
+        case 2: return {true, false, false, ocr(t, 0), false};
+        case 3: return {true, true, false, 0xff, true};
+        case 7: return {true, true, true, t.active[0], true};
+      }
+    } else {
+      switch (wgm) {
+        case 0: return {true, false, false, max, true};
+        case 4: return {true, false, false, ocr(t, 0), false};
+        case 5: return {true, true, false, 0x00ff, true};
+        case 6: return {true, true, false, 0x01ff, true};
+        case 7: return {true, true, false, 0x03ff, true};
+        case 12: return {true, false, false, *t.icr, false};
+        case 14: return {true, true, false, *t.icr, true};
+        case 15: return {true, true, true, t.active[0], true};
+      }
+    }
+    // Phase correct modes
+    return {false, false, false, max, false};
+  }
+
+  uint8_t com_bits(const Timer& t, uint8_t channel) {
+    return (*t.tccra >> (6 - 2 * channel)) & 0x03;
+  }
+
+  bool connected(const Timer& t, uint8_t channel, const Shape& s) {
+    uint8_t com = com_bits(t, channel);
+    if (!com) return false;
+    // In fast PWM, COM = 1 only drives OCnA, in the OCRnA-as-TOP modes
+    return !(s.pwm && com == 1 && !(channel == 0 && s.toggle_a));
+  }
+
+  uint16_t compare_value(const Timer& t, uint8_t channel, const Shape& s) {
+    return s.pwm ? t.active[channel] : ocr(t, channel);
+  }
+
+  // Cycle of the next count transition that matters: leaving a compare
+  // value, or the wrap. The counter ticks on multiples of the prescaler.
+  cycles_t next_transition(const Timer& t, uint16_t& leaving) {
+    if (!t.present) return NEVER;
+    unsigned p = prescale(t);
+    Shape s = shape(t);
+    if (!p || !s.counting) return NEVER;
+    uint16_t c = count(t);
+    // A counter above TOP (written there, or TOP lowered under it) runs on to MAX
+    uint16_t v = c <= s.top ? s.top : max_count(t);
+    for (uint8_t i = 0; i < t.channels; i++) {
+      uint16_t value = compare_value(t, i, s);
+      if (value >= c && value < v) v = value;
+    }
+    leaving = v;
+    return (t.last / p + (cycles_t)(v - c) + 1) * p;
+  }
+
+  void transition(Timer& t, uint16_t leaving) {
+    Shape s = shape(t);
+    for (uint8_t i = 0; i < t.channels; i++) {
+      if (compare_value(t, i, s) != leaving) continue;
+      t.flags |= _BV(i + 1);
+      if (!connected(t, i, s)) continue;
+      uint8_t com = com_bits(t, i);
+      if (com == 1) t.oc[i] = !t.oc[i];
+      else t.oc[i] = (com == 3);
+    }
+    uint16_t wrap = leaving <= s.top ? s.top : max_count(t);
+    if (leaving != wrap) {
+      set_count(t, leaving + 1);
+      return;
+    }
+    set_count(t, 0);
+    if (s.tov_at_top ? leaving == s.top : leaving == max_count(t)) t.flags |= _BV(0);
+    if (s.pwm) {
+      // BOTTOM: the buffered compare values take effect
+      for (uint8_t i = 0; i < t.channels; i++) {
+        t.active[i] = ocr(t, i);
+        if (connected(t, i, s)) t.oc[i] = (com_bits(t, i) == 2);
+      }
+    }
+  }
+
+  void advance_timer(Timer& t, cycles_t to) {
+    uint16_t leaving;
+    cycles_t at = next_transition(t, leaving);
+    if (at == to) {
+      set_count(t, leaving);
+      transition(t, leaving);
+      *t.tifr = t.flags | TIFR_SENTINEL;
+    } else if (at != NEVER) {
+      unsigned p = prescale(t);
+      set_count(t, count(t) + (uint16_t)(to / p - t.last / p));
+    }
+    t.last = to;
+  }
+
+  void sync_timer(Timer& t) {
+    if (!t.present) return;
+    uint8_t tifr = *t.tifr;
+    if ((tifr & TIFR_SENTINEL) != TIFR_SENTINEL) t.flags &= ~tifr;
+    *t.tifr = t.flags | TIFR_SENTINEL;
+    Shape s = shape(t);
+    if (!s.pwm) {
+      for (uint8_t i = 0; i < t.channels; i++) t.active[i] = ocr(t, i);
+    }
+  }
+
+  bool timer_pin_connected(const PinInfo& info) {
+    if (info.timer < 0 || info.timer >= NUM_TIMERS) return false;
+    const Timer& t = timers[info.timer];
+    return connected(t, info.channel, shape(t));
+  }
+
+  // ---- USART0 ----
+
+  struct Incoming {
+    uint8_t value;
+    cycles_t end;
+  };
+  const int INCOMING_CAPACITY = 4096;
+
+  struct Usart {
+    bool enabled;
+    cycles_t byte_cycles;
+    bool udr_full;
+    uint8_t udr;
+    bool shifting;
+    uint8_t shift;
+    cycles_t shift_end;
+    bool rx_interrupt;
+    bool udre_interrupt;
+    uint8_t rx[3];  // two-level UDR FIFO plus the receive shift register
+    uint8_t rx_count;
+    Incoming incoming[INCOMING_CAPACITY];
+    int incoming_head;
+    int incoming_count;
+    UsartListener listener;
+    unsigned long overruns;
+  } usart;
+
+  void usart_tx_complete() {
+    if (usart.listener) usart.listener(usart.shift, usart.shift_end);
+    if (usart.udr_full) {
+      usart.shift = usart.udr;
+      usart.udr_full = false;
+      usart.shift_end += usart.byte_cycles;
+    } else {
+      usart.shifting = false;
+    }
+  }
+
+  // The RX line as the byte on the wire drives it: start bit, data bits
+  // LSB first, stop bit
+  bool rx_line() {
+    if (!usart.enabled || !usart.incoming_count) return true;
+    const Incoming& in = usart.incoming[usart.incoming_head];
+    cycles_t bit_cycles = usart.byte_cycles / 10;
+    if (in.end < usart.byte_cycles || current < in.end - usart.byte_cycles) return true;
+    cycles_t bit = (current - (in.end - usart.byte_cycles)) / bit_cycles;
+    if (bit == 0) return false;
+    return bit > 8 || ((in.value >> (bit - 1)) & 1);
+  }
+
+  // Next bit boundary on the RX line, only while a pin change interrupt
+  // watches it
+  cycles_t next_rx_edge() {
+    if (!usart.enabled || !usart.incoming_count || !pcint_enabled(RX_PIN)) return NEVER;
+    const Incoming& in = usart.incoming[usart.incoming_head];
+    cycles_t bit_cycles = usart.byte_cycles / 10;
+    if (in.end < usart.byte_cycles) return NEVER;
+    cycles_t start = in.end - usart.byte_cycles;
+    if (current < start) return start;
+    return start + ((current - start) / bit_cycles + 1) * bit_cycles;
+  }
+
+  void usart_arrival() {
+    Incoming& in = usart.incoming[usart.incoming_head];
+    usart.incoming_head = (usart.incoming_head + 1) % INCOMING_CAPACITY;
+    usart.incoming_count--;
+    if (!usart.enabled) return;
+    if (usart.rx_count < sizeof usart.rx) {
+      usart.rx[usart.rx_count++] = in.value;
+    } else {
+      usart.overruns++;
+    }
+  }
+
+  // ---- EEPROM ----
+
+  uint8_t eeprom[E2END + 1];
+  bool eeprom_writing = false;
+  cycles_t eeprom_end = 0;
+  uint16_t eeprom_address = 0;
+  uint8_t eeprom_data = 0;
+
+  void sync_eeprom() {
+    uint8_t control = avr_reg_EECR;
+    if (control & _BV(EERE)) {
+      avr_reg_EEDR = eeprom[EEAR & E2END];
+      control &= ~_BV(EERE);
+    }
+    if ((control & _BV(EEPE)) && !eeprom_writing) {
+      eeprom_writing = true;
+      eeprom_end = current + EEPROM_WRITE_CYCLES;
+      eeprom_address = EEAR & E2END;
+      eeprom_data = avr_reg_EEDR;
+      control &= ~_BV(EEMPE);
+    }
+    avr_reg_EECR = control;
+  }
+
+  // ---- Watchdog ----
+
+  uint8_t wdt_control = 0;
+  bool wdt_flag = false;
+  cycles_t wdt_start = 0;
+
+  void default_reset_handler(const char* cause) {
+    fprintf(stderr, "avr_model: %s reset at cycle %llu\n", cause, (unsigned long long)current);
+    exit(70);
+  }
+  ResetHandler reset_handler = default_reset_handler;
+
+  bool wdt_running() { return wdt_control & (_BV(WDE) | _BV(WDIE)); }
+
+  cycles_t wdt_timeout() {
+    uint8_t p = (wdt_control & 0x07) | ((wdt_control >> WDP3) & 1) << 3;
+    // 2K cycles of the 128 kHz oscillator at WDP = 0
+    return ((cycles_t)2048 << p) * (F_CPU / 128000);
+  }
+
+  void sync_wdt() {
+    uint8_t control = WDTCSR & ~(_BV(WDIF) | _BV(WDCE));
+    if (WDTCSR & _BV(WDIF)) wdt_flag = false;
+    if (control != wdt_control) {
+      wdt_control = control;
+      wdt_start = current;
+    }
+    WDTCSR = control;
+  }
+
+  void wdt_expired() {
+    wdt_start += wdt_timeout();
+    if (wdt_control & _BV(WDIE)) {
+      wdt_flag = true;
+    } else if (wdt_control & _BV(WDE)) {
+      reset_handler("watchdog");
+    }
+  }
+
+  // ---- External interrupts ----
+
+  struct External {
+    uint8_t pin;
+    void (*handler)();
+    uint8_t mode;
+    bool flag;
+  };
+  #if defined(__AVR_ATmega2560__)
+  External externals[NUM_EXTERNAL] = {{2}, {3}, {21}, {20}, {19}, {18}};
+  #else
+  External externals[NUM_EXTERNAL] = {{2}, {3}};
+  #endif
+
+  // ---- Interrupt vectors, highest priority first ----
+
+  enum Source {
+    SOURCE_EXTERNAL, SOURCE_PCINT, SOURCE_WDT, SOURCE_TIMER, SOURCE_USART_RX, SOURCE_USART_UDRE,
+    SOURCE_EE_READY
+  };
+
+  struct Vector {
+    Source source;
+    uint8_t unit;  // external interrupt or timer number
+    uint8_t flag;  // timer flag bit
+    void (*handler)();
+  };
+
+  #define TIMER_VECTOR(n, flag, name) {SOURCE_TIMER, n, flag, avr_isr_##name}
+  #define TIMER16_VECTORS(n) TIMER_VECTOR(n, 1, TIMER##n##_COMPA_vect), \
+    TIMER_VECTOR(n, 2, TIMER##n##_COMPB_vect), TIMER_VECTOR(n, 3, TIMER##n##_COMPC_vect), \
+    TIMER_VECTOR(n, 0, TIMER##n##_OVF_vect)
+  #define TIMER8_VECTORS(n) TIMER_VECTOR(n, 1, TIMER##n##_COMPA_vect), \
+    TIMER_VECTOR(n, 2, TIMER##n##_COMPB_vect), TIMER_VECTOR(n, 0, TIMER##n##_OVF_vect)
+  #define PCINT_VECTORS {SOURCE_PCINT, 0, 0, avr_isr_PCINT0_vect}, \
+    {SOURCE_PCINT, 1, 0, avr_isr_PCINT1_vect}, {SOURCE_PCINT, 2, 0, avr_isr_PCINT2_vect}
+
+  #if defined(__AVR_ATmega2560__)
+  // INT0-3 are on pins 21-18 (numbers 2-5), INT4-5 on pins 2-3 (numbers 0-1)
+  const Vector VECTORS[] = {
+    {SOURCE_EXTERNAL, 2}, {SOURCE_EXTERNAL, 3}, {SOURCE_EXTERNAL, 4}, {SOURCE_EXTERNAL, 5},
+    {SOURCE_EXTERNAL, 0}, {SOURCE_EXTERNAL, 1},
+    PCINT_VECTORS,
+    {SOURCE_WDT, 0, 0, avr_isr_WDT_vect},
+    TIMER8_VECTORS(2), TIMER16_VECTORS(1), TIMER8_VECTORS(0),
+    {SOURCE_USART_RX, 0, 0, avr_isr_USART0_RX_vect},
+    {SOURCE_USART_UDRE, 0, 0, avr_isr_USART0_UDRE_vect},
+    {SOURCE_EE_READY, 0, 0, avr_isr_EE_READY_vect},
+    TIMER16_VECTORS(3), TIMER16_VECTORS(4), TIMER16_VECTORS(5)};
+  #else
+  const Vector VECTORS[] = {
+    {SOURCE_EXTERNAL, 0}, {SOURCE_EXTERNAL, 1},
+    PCINT_VECTORS,
+    {SOURCE_WDT, 0, 0, avr_isr_WDT_vect},
+    TIMER8_VECTORS(2), TIMER_VECTOR(1, 1, TIMER1_COMPA_vect), TIMER_VECTOR(1, 2, TIMER1_COMPB_vect),
+    TIMER_VECTOR(1, 0, TIMER1_OVF_vect), TIMER8_VECTORS(0),
+    {SOURCE_USART_RX, 0, 0, avr_isr_USART_RX_vect},
+    {SOURCE_USART_UDRE, 0, 0, avr_isr_USART_UDRE_vect},
+    {SOURCE_EE_READY, 0, 0, avr_isr_EE_READY_vect}};
+  #endif
+
+  bool pending(const Vector& v) {
+    switch (v.source) {
+      case SOURCE_EXTERNAL: return externals[v.unit].handler && externals[v.unit].flag;
+      case SOURCE_PCINT: return PCICR & pcint_flags & _BV(v.unit);
+      case SOURCE_WDT: return (wdt_control & _BV(WDIE)) && wdt_flag;
+      case SOURCE_TIMER: return timers[v.unit].flags & *timers[v.unit].timsk & _BV(v.flag);
+      case SOURCE_USART_RX: return usart.enabled && usart.rx_interrupt && usart.rx_count;
+      case SOURCE_USART_UDRE: return usart.enabled && usart.udre_interrupt && !usart.udr_full;
+      case SOURCE_EE_READY: return (avr_reg_EECR & _BV(EERIE)) && !(avr_reg_EECR & _BV(EEPE));
+    }
+    return false;
+  }
+
+  typedef void (*Handler)();
+
+  // Entry clears the edge-triggered flags; the level-triggered sources
+  // stay pending until their handler acts
+  Handler acknowledge(const Vector& v) {
+    switch (v.source) {
+      case SOURCE_EXTERNAL:
+        externals[v.unit].flag = false;
+        return externals[v.unit].handler;
+      case SOURCE_PCINT:
+        pcint_flags &= ~_BV(v.unit);
+        avr_reg_PCIFR = pcint_flags | PCIFR_SENTINEL;
+        break;
+      case SOURCE_WDT:
+        wdt_flag = false;
+        // Interrupt and system reset mode: the next timeout resets
+        if (wdt_control & _BV(WDE)) WDTCSR = wdt_control = wdt_control & ~_BV(WDIE);
+        break;
+      case SOURCE_TIMER:
+        timers[v.unit].flags &= ~_BV(v.flag);
+        *timers[v.unit].tifr = timers[v.unit].flags | TIFR_SENTINEL;
+        break;
+      default:
+        break;
+    }
+    return v.handler;
+  }
+
+  // ---- Scheduling ----
+
+  void update_pins() {
+    for (uint8_t pin = 0; pin < NUM_PINS; pin++) {
+      if (!listeners[pin]) continue;
+      bool level = pin_level(pin);
+      if (level == levels[pin]) continue;
+      levels[pin] = level;
+      listeners[pin](pin, level, current);
+    }
+  }
+
+  // A change on a masked line sets its group's flag; a line just unmasked
+  // starts from its current level
+  void update_pcint() {
+    for (uint8_t group = 0; group < 3; group++) {
+      uint8_t mask = *PCMSKS[group];
+      for (uint8_t bit = 0; mask >> bit; bit++) {
+        int8_t pin = pcint_pins[group][bit];
+        if (!(mask & _BV(bit)) || pin < 0) continue;
+        bool level = pin_level(pin);
+        if ((pcint_masks[group] & _BV(bit)) && level != pcint_levels[pin]) pcint_flags |= _BV(group);
+        pcint_levels[pin] = level;
+      }
+      pcint_masks[group] = mask;
+    }
+  }
+
+  void sync_pcint() {
+    uint8_t written = avr_reg_PCIFR;
+    if ((written & PCIFR_SENTINEL) != PCIFR_SENTINEL) pcint_flags &= ~written;
+    update_pcint();
+    avr_reg_PCIFR = pcint_flags | PCIFR_SENTINEL;
+  }
+
+  void sync() {
+    for (uint8_t i = 0; i < NUM_TIMERS; i++) sync_timer(timers[i]);
+    sync_eeprom();
+    sync_wdt();
+    sync_pcint();
+    update_pins();
+  }
+
+  cycles_t next_event() {
+    cycles_t next = NEVER;
+    uint16_t leaving;
+    for (uint8_t i = 0; i < NUM_TIMERS; i++) {
+      cycles_t at = next_transition(timers[i], leaving);
+      if (at < next) next = at;
+    }
+    if (usart.shifting && usart.shift_end < next) next = usart.shift_end;
+    if (usart.incoming_count && usart.incoming[usart.incoming_head].end < next)
+      next = usart.incoming[usart.incoming_head].end;
+    cycles_t edge = next_rx_edge();
+    if (edge < next) next = edge;
+    if (eeprom_writing && eeprom_end < next) next = eeprom_end;
+    if (wdt_running() && wdt_start + wdt_timeout() < next) next = wdt_start + wdt_timeout();
+    return next;
+  }
+
+  // No event falls before the given cycle
+  void step_to(cycles_t to) {
+    for (uint8_t i = 0; i < NUM_TIMERS; i++) advance_timer(timers[i], to);
+    current = to;
+    while (usart.shifting && usart.shift_end <= to) usart_tx_complete();
+    while (usart.incoming_count && usart.incoming[usart.incoming_head].end <= to) usart_arrival();
+    if (eeprom_writing && eeprom_end <= to) {
+      eeprom[eeprom_address] = eeprom_data;
+      eeprom_writing = false;
+      avr_reg_EECR &= ~_BV(EEPE);
+    }
+    if (wdt_running() && wdt_start + wdt_timeout() <= to) wdt_expired();
+    update_pcint();
+    avr_reg_PCIFR = pcint_flags | PCIFR_SENTINEL;
+    update_pins();
+  }
+
+  bool dispatch() {
+    if (in_isr || !(SREG & 0x80)) return false;
+    for (const Vector& v : VECTORS) {
+      if (!pending(v)) continue;
+      Handler handler = acknowledge(v);
+      if (!handler) {
+        // __bad_interrupt jumps to the reset vector
+        reset_handler("unhandled interrupt");
+        return false;
+      }
+      in_isr = true;
+      SREG &= ~0x80;
+      run(ISR_ENTRY_CYCLES);
+      handler();
+      run(isr_cycles);
+      SREG |= 0x80;
+      in_isr = false;
+      return true;
+    }
+    return false;
+  }
+}
+
+void reset() {
+  #define AVR_CLEAR(name) name = 0;
+  #define AVR_CLEAR_HOOKED(name) avr_reg_##name = 0;
+  AVR_PLAIN_REGISTERS8(AVR_CLEAR)
+  AVR_PLAIN_REGISTERS16(AVR_CLEAR)
+  AVR_HOOKED_REGISTERS8(AVR_CLEAR_HOOKED)
+  AVR_HOOKED_REGISTERS16(AVR_CLEAR_HOOKED)
+  current = 0;
+  in_isr = false;
+  for (uint8_t i = 0; i < 6; i++) {
+    Timer& t = timers[i];
+    t.present = i < NUM_TIMERS;
+    t.flags = 0;
+    memset(t.active, 0, sizeof t.active);
+    memset(t.oc, 0, sizeof t.oc);
+    t.last = 0;
+    *t.tifr = TIFR_SENTINEL;
+  }
+  memset(inputs, 0, sizeof inputs);
+  memset(levels, 0, sizeof levels);
+  memset(listeners, 0, sizeof listeners);
+  map_pcint_pins();
+  pcint_flags = 0;
+  memset(pcint_masks, 0, sizeof pcint_masks);
+  avr_reg_PCIFR = PCIFR_SENTINEL;
+  memset(&usart, 0, sizeof usart);
+  memset(eeprom, 0xff, sizeof eeprom);
+  eeprom_writing = false;
+  wdt_control = 0;
+  wdt_flag = false;
+  for (External& e : externals) {
+    e.handler = nullptr;
+    e.flag = false;
+  }
+}
+
+cycles_t now() {
+  return current;
+}
+
+void run(cycles_t cycles) {
+  run_until(current + cycles);
+}
+
+void run_until(cycles_t cycle) {
+  while (true) {
+    sync();
+    if (dispatch()) continue;
+    if (current >= cycle) return;
+    cycles_t next = next_event();
+    step_to(next < cycle ? next : cycle);
+  }
+}
+
+void set_isr_cycles(cycles_t cycles) {
+  isr_cycles = cycles;
+}
+
+void disable_interrupts() {
+  SREG &= ~0x80;
+}
+
+void enable_interrupts() {
+  SREG |= 0x80;
+  // One more instruction runs before a pending interrupt
+  run(1);
+}
+
+bool interrupts_enabled() {
+  return SREG & 0x80;
+}
+
+bool pin_level(uint8_t pin) {
+  if (pin >= NUM_PINS) return false;
+  const PinInfo& info = PINS[pin];
+  uint8_t mask = _BV(info.bit);
+  // The receiver overrides the pin while enabled
+  if (pin == RX_PIN && usart.enabled) return rx_line();
+  if (!(*DDRS[info.port] & mask)) return inputs[pin];
+  if (timer_pin_connected(info)) return timers[info.timer].oc[info.channel];
+  return *PORTS[info.port] & mask;
+}
+
+void set_input(uint8_t pin, bool high) {
+  if (pin >= NUM_PINS) return;
+  bool was = inputs[pin];
+  inputs[pin] = high;
+  for (External& e : externals) {
+    if (e.pin != pin || was == high) continue;
+    // CHANGE = 1, FALLING = 2, RISING = 3
+    if (e.mode == 1 || (e.mode == 3) == high) e.flag = true;
+  }
+  run(0);
+}
+
+void watch_pin(uint8_t pin, PinListener listener) {
+  if (pin >= NUM_PINS) return;
+  listeners[pin] = listener;
+  levels[pin] = pin_level(pin);
+}
+
+uint8_t pin_port_mask(uint8_t pin) {
+  return pin < NUM_PINS ? _BV(PINS[pin].bit) : 0;
+}
+
+volatile uint8_t* pin_port(uint8_t pin) {
+  return pin < NUM_PINS ? PORTS[PINS[pin].port] : nullptr;
+}
+
+volatile uint8_t* pin_ddr(uint8_t pin) {
+  return pin < NUM_PINS ? DDRS[PINS[pin].port] : nullptr;
+}
+
+void disconnect_pwm(uint8_t pin) {
+  if (pin >= NUM_PINS || PINS[pin].timer < 0 || PINS[pin].timer >= NUM_TIMERS) return;
+  *timers[PINS[pin].timer].tccra &= ~_BV(7 - 2 * PINS[pin].channel);
+}
+
+void attach_external(uint8_t number, void (*handler)(), uint8_t mode) {
+  if (number >= NUM_EXTERNAL) return;
+  externals[number].handler = handler;
+  externals[number].mode = mode;
+  externals[number].flag = false;
+}
+
+void detach_external(uint8_t number) {
+  if (number < NUM_EXTERNAL) externals[number].handler = nullptr;
+}
+
+void usart_begin(unsigned long baud) {
+  // As HardwareSerial::begin() picks UBRR: double speed unless out of range
+  uint16_t setting = (F_CPU / 4 / baud - 1) / 2;
+  cycles_t bit_cycles = 8 * ((cycles_t)setting + 1);
+  if ((F_CPU == 16000000UL && baud == 57600) || setting > 4095) {
+    setting = (F_CPU / 8 / baud - 1) / 2;
+    bit_cycles = 16 * ((cycles_t)setting + 1);
+  }
+  usart.enabled = true;
+  usart.byte_cycles = 10 * bit_cycles;
+  usart.udr_full = false;
+  usart.shifting = false;
+  usart.rx_count = 0;
+}
+
+void usart_end() {
+  usart.enabled = false;
+  usart.rx_interrupt = usart.udre_interrupt = false;
+}
+
+cycles_t usart_byte_cycles() {
+  return usart.byte_cycles;
+}
+
+bool usart_udr_empty() {
+  return !usart.udr_full;
+}
+
+bool usart_tx_idle() {
+  return !usart.shifting && !usart.udr_full;
+}
+
+void usart_write_udr(uint8_t value) {
+  if (!usart.enabled) return;
+  if (!usart.shifting) {
+    usart.shift = value;
+    usart.shifting = true;
+    usart.shift_end = current + usart.byte_cycles;
+  } else {
+    usart.udr = value;
+    usart.udr_full = true;
+  }
+}
+
+bool usart_rx_complete() {
+  return usart.rx_count;
+}
+
+uint8_t usart_read_udr() {
+  if (!usart.rx_count) return 0;
+  uint8_t value = usart.rx[0];
+  memmove(usart.rx, usart.rx + 1, --usart.rx_count);
+  return value;
+}
+
+void usart_set_interrupts(bool rx_complete, bool udr_empty) {
+  usart.rx_interrupt = rx_complete;
+  usart.udre_interrupt = udr_empty;
+}
+
+void usart_receive(uint8_t value, cycles_t end) {
+  if (usart.incoming_count == INCOMING_CAPACITY) {
+    fprintf(stderr, "avr_model: USART receive queue full\n");
+    exit(70);
+  }
+  // Keep arrivals in time order; a byte already due arrives now
+  if (end < current) end = current;
+  int i = usart.incoming_count++;
+  while (i > 0) {
+    Incoming& before = usart.incoming[(usart.incoming_head + i - 1) % INCOMING_CAPACITY];
+    if (before.end <= end) break;
+    usart.incoming[(usart.incoming_head + i) % INCOMING_CAPACITY] = before;
+    i--;
+  }
+  usart.incoming[(usart.incoming_head + i) % INCOMING_CAPACITY] = {value, end};
+}
+
+void usart_set_tx_listener(UsartListener listener) {
+  usart.listener = listener;
+}
+
+unsigned long usart_overruns() {
+  return usart.overruns;
+}
+
+void watchdog_reset() {
+  wdt_start = current;
+}
+
+void set_reset_handler(ResetHandler handler) {
+  reset_handler = handler ? handler : default_reset_handler;
+}
+
+uint8_t eeprom_byte(uint16_t address) {
+  return eeprom[address & E2END];
+}
+
+}
+
+volatile uint8_t& avr_access(volatile uint8_t& reg) {
+  avr_model::run(2);
+  // An input pin register reads the levels at this cycle
+  for (uint8_t port = 0; port < sizeof avr_model::PIN_REGISTERS / sizeof avr_model::PIN_REGISTERS[0]; port++) {
+    if (&reg != avr_model::PIN_REGISTERS[port]) continue;
+    uint8_t value = 0;
+    for (uint8_t pin = 0; pin < avr_model::NUM_PINS; pin++) {
+      if (avr_model::PINS[pin].port == port && avr_model::pin_level(pin))
+        value |= _BV(avr_model::PINS[pin].bit);
+    }
+    reg = value;
+  }
+  return reg;
+}
+
+volatile uint16_t& avr_access(volatile uint16_t& reg) {
+  avr_model::run(4);
+  return reg;
+}
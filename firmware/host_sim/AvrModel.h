@@ -0,0 +1,84 @@
+#pragma once
+
+// Cycle-level host model of the ATmega328P/ATmega2560 peripherals the
+// firmware drives, so the sketch and its ISRs can run unmodified on the
+// host:
+//   - Timers 0-5 in normal, CTC and fast PWM modes, with the double
+//     buffered compare registers, TOV/OCF flags and output compare pins
+//   - interrupt dispatch in vector priority order, honouring the I bit
+//   - USART0 with its UDR, shift register and 3-byte receive buffer
+//     (overruns drop bytes), at the baud rate the core's UBRR gives
+//   - the EEPROM (3.3 ms writes, EE_READY), the watchdog, external
+//     interrupt pins and pin change interrupts; the RX pin follows the bits
+//     of the byte being received
+//
+// Firmware code takes no time of its own, except at the hooked register
+// accesses (avr/io.h) and the core calls that wait; a harness charges the
+// rest with run(). Phase-correct PWM modes are not modelled: a timer left in
+// one holds its count. Neither are input capture, SPI or the ADC.
+
+#include <stdint.h>
+
+namespace avr_model {
+  typedef uint64_t cycles_t;
+
+  // Power-on state, at cycle 0
+  void reset();
+  cycles_t now();
+
+  // The CPU is busy for the given cycles in the current context; timers,
+  // the USART and enabled interrupts run meanwhile
+  void run(cycles_t cycles);
+  void run_until(cycles_t cycle);
+
+  // Body cost charged per ISR, on top of the entry sequence and the hooked
+  // accesses inside the handler
+  void set_isr_cycles(cycles_t cycles);
+
+  void disable_interrupts();
+  void enable_interrupts();
+  bool interrupts_enabled();
+
+  // Pins: the level driven by the port or a connected output compare unit,
+  // or for an input the level applied by the harness
+  bool pin_level(uint8_t pin);
+  void set_input(uint8_t pin, bool high);
+  typedef void (*PinListener)(uint8_t pin, bool high, cycles_t cycle);
+  void watch_pin(uint8_t pin, PinListener listener);
+  uint8_t pin_port_mask(uint8_t pin);
+  volatile uint8_t* pin_port(uint8_t pin);
+  volatile uint8_t* pin_ddr(uint8_t pin);
+  // Clears the COMnx1 bit of the pin's timer channel, as the core's
+  // turnOffPWM() does on every digitalWrite()/digitalRead()
+  void disconnect_pwm(uint8_t pin);
+
+  // External interrupt number as digitalPinToInterrupt() gives it;
+  // mode is CHANGE, FALLING or RISING
+  void attach_external(uint8_t number, void (*handler)(), uint8_t mode);
+  void detach_external(uint8_t number);
+
+  // USART0, driven by the core's HardwareSerial
+  void usart_begin(unsigned long baud);
+  void usart_end();
+  cycles_t usart_byte_cycles();
+  bool usart_udr_empty();
+  // Nothing in UDR or the shift register
+  bool usart_tx_idle();
+  void usart_write_udr(uint8_t value);
+  bool usart_rx_complete();
+  uint8_t usart_read_udr();
+  void usart_set_interrupts(bool rx_complete, bool udr_empty);
+  // Harness side: a byte whose stop bit ends at the given cycle, and the
+  // bytes the TX line finishes sending
+  void usart_receive(uint8_t value, cycles_t end);
+  typedef void (*UsartListener)(uint8_t value, cycles_t end);
+  void usart_set_tx_listener(UsartListener listener);
+  unsigned long usart_overruns();
+
+  void watchdog_reset();
+  // Called on a watchdog system reset; the default prints and exits
+  typedef void (*ResetHandler)(const char* cause);
+  void set_reset_handler(ResetHandler handler);
+
+  uint8_t eeprom_byte(uint16_t address);
+}
@@ -0,0 +1,162 @@
+// Plays the test patterns built by SongDSL.h (TestPatterns.cpp) through
+// start_midi() and play_midi() on a host build with the mock voice backend
+// (four voices, one per song voice of TEST_CHORDS), calling play_midi()
+// every STEP_US. After each call the notes sounding on the mock voices are
+// compared with the last call's; every change must match the score's next
+// one, in notes, loudness and time, and the song must end when the score
+// does.
+//
+//   dsl_model
+//
+// Prints each pattern's changes as they are matched, stops a pattern at its
+// first difference, and exits non-zero if any pattern had one.
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <Arduino.h>
+#include <avr/wdt.h>
+#include <Wire.h>
+#include "AvrModel.h"
+#include "MIDIPlayer.h"
+#include "Timebase.h"
+#include "VoiceBackend.h"
+
+#define STEP_US   100
+// A change is seen at the first play_midi() call at or after its time, on
+// the timebase's 4 us ticks
+#define LATE_US   (STEP_US + TIMEBASE_US_PER_TICK)
+#define MAX_NOTES NUM_VOICES
+
+namespace {
+  struct Change {
+    unsigned long us;            // from start_midi()
+    uint8_t notes[MAX_NOTES];    // sounding notes, ascending, 0 after the last
+  };
+
+  struct Pattern {
+    const char* name;
+    const byte* song;
+    uint8_t volume;
+    const Change* changes;
+    size_t count;
+    unsigned long end_us;        // play_midi() returns false
+  };
+
+  // t120: eighth notes of 48 ticks, 250 ms
+  const Change SCALE_CHANGES[] = {
+    {0, {60}}, {250000, {62}}, {500000, {64}}, {750000, {65}},
+    {1000000, {67}}, {1250000, {69}}, {1500000, {71}}, {1750000, {72}},
+    {2000000, {71}}, {2250000, {69}}, {2500000, {67}}, {2750000, {65}},
+    {3000000, {64}}, {3250000, {62}}, {3500000, {60}}, {4000000, {}},
+  };
+
+  // t90: 666666 us per beat, so half notes of 1333332 us and quarters of
+  // 666666, summed as the player sums them
+  const Change CHORD_CHANGES[] = {
+    {0, {60, 64, 67, 72}},
+    {1333332, {}},
+    {1999998, {62, 65, 69, 74}},
+    {3333330, {}},
+  };
+
+  const Pattern PATTERNS[] = {
+    {"TEST_SCALE", TEST_SCALE, 4, SCALE_CHANGES, sizeof(SCALE_CHANGES) / sizeof(Change), 4500000},
+    {"TEST_CHORDS", TEST_CHORDS, 3, CHORD_CHANGES, sizeof(CHORD_CHANGES) / sizeof(Change), 3999996},
+  };
+
+  // Sounding notes, ascending; false if a voice plays at another loudness
+  bool sounding(uint8_t* notes, uint8_t volume) {
+    memset(notes, 0, MAX_NOTES);
+    uint8_t count = 0;
+    bool volumes_ok = true;
+    for (uint8_t voice = 0; voice < NUM_VOICES; voice++) {
+      uint8_t note = mock_voice_note[voice];
+      if (!note) continue;
+      if (mock_voice_volume[voice] != volume) volumes_ok = false;
+      uint8_t i = count++;
+      while (i && notes[i - 1] > note) {
+        notes[i] = notes[i - 1];
+        i--;
+      }
+      notes[i] = note;
+    }
+    return volumes_ok;
+  }
+
+  void print_notes(const uint8_t* notes) {
+    if (!notes[0]) printf(" -");
+    for (uint8_t i = 0; i < MAX_NOTES && notes[i]; i++) printf(" %u", notes[i]);
+  }
+
+  bool play(const Pattern& pattern) {
+    printf("%s:\n", pattern.name);
+    unsigned long start_us = timebase_us();
+    start_midi(pattern.song);
+    uint8_t last[MAX_NOTES] = {0};
+    size_t next = 0;
+    while (true) {
+      bool playing = play_midi();
+      unsigned long t_us = timebase_us() - start_us;
+      uint8_t notes[MAX_NOTES];
+      bool volumes_ok = sounding(notes, pattern.volume);
+      if (memcmp(notes, last, MAX_NOTES)) {
+        printf("  %8lu us:", t_us);
+        print_notes(notes);
+        if (next == pattern.count) {
+          printf(", after the score's last change\n");
+          return false;
+        }
+        const Change& want = pattern.changes[next++];
+        if (memcmp(notes, want.notes, MAX_NOTES)) {
+          printf(", want");
+          print_notes(want.notes);
+          printf("\n");
+          return false;
+        }
+        if (t_us < want.us || t_us > want.us + LATE_US) {
+          printf(", want at %lu us\n", want.us);
+          return false;
+        }
+        if (!volumes_ok) {
+          printf(", want loudness %u\n", pattern.volume);
+          return false;
+        }
+        printf("\n");
+        memcpy(last, notes, MAX_NOTES);
+      }
+      if (!playing) {
+        printf("  %8lu us: end\n", t_us);
+        if (next < pattern.count) {
+          printf("  %zu of %zu changes played\n", next, pattern.count);
+          return false;
+        }
+        if (t_us < pattern.end_us || t_us > pattern.end_us + LATE_US) {
+          printf("  want the end at %lu us\n", pattern.end_us);
+          return false;
+        }
+        return true;
+      }
+      // As loop() does each pass
+      wdt_reset();
+      avr_model::run((avr_model::cycles_t)STEP_US * 16);
+    }
+  }
+}
+
+int main(int argc, char** argv) {
+  if (argc != 1) {
+    fprintf(stderr, "usage: dsl_model\n");
+    return 2;
+  }
+  avr_model::reset();
+  Wire.attach_device(0x60);
+  init();
+  setup();
+
+  int failures = 0;
+  for (size_t i = 0; i < sizeof(PATTERNS) / sizeof(PATTERNS[0]); i++) {
+    if (!play(PATTERNS[i])) failures++;
+  }
+  printf("%d patterns failed\n", failures);
+  return failures ? 1 : 0;
+}
@@ -0,0 +1,163 @@
+// Runs the whole sketch on the peripheral model, as one controller in a
+// simulated multi-controller setup. A coordinator (sync_test.py) drives
+// several of these processes in lockstep over their stdin/stdout:
+//
+//   coordinator -> instance
+//     pin <t_ns> <pin> <level>   set an input pin at global time t
+//     rx <t_ns> <byte>           a byte whose stop bit ends at t
+//     run <t_ns>                 run loop() until global time t
+//     quit
+//   instance -> coordinator, in answer to run
+//     tx <t_ns> <byte>           a byte sent on the TX line, ending at t
+//     state <t_ns> <state>       a state change
+//     pos <t_ns> <song> <us>     song position, every POSITION_REPORT_US
+//     done <t_ns>
+//   and on quit: stats <overruns> <late_rx> <loops>
+//
+// Each instance has its own crystal error (--ppm), so its cycles run at
+// 16 MHz * (1 + ppm / 1e6) of global time. The firmware itself takes no
+// time outside its register accesses and waits; each loop() is charged
+// --loop-us plus a uniform random 0..--jitter-us on top.
+#include <stdarg.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <random>  // before Arduino's min/max macros
+#include <vector>
+#include <Arduino.h>
+#include <Wire.h>
+#include "AvrModel.h"
+
+// Firmware globals the harness reads
+extern unsigned long get_midi_position_us(unsigned long timestamp);
+extern unsigned long timebase_us();
+extern int get_current_state();
+extern int get_song_index();
+
+#define MUSIC_PLAY 3
+#define POSITION_REPORT_US 10000
+
+namespace {
+  double cycles_per_ns = 0.016;
+
+  struct PinChange {
+    uint64_t cycle;
+    uint8_t pin;
+    bool level;
+  };
+  std::vector<PinChange> pin_changes;
+  std::vector<char> output;
+  unsigned long late_rx = 0;
+  unsigned long loops = 0;
+
+  avr_model::cycles_t to_cycles(unsigned long long ns) {
+    return (avr_model::cycles_t)(ns * cycles_per_ns + 0.5);
+  }
+
+  unsigned long long to_ns(avr_model::cycles_t cycles) {
+    return (unsigned long long)(cycles / cycles_per_ns + 0.5);
+  }
+
+  void emit(const char* format, ...) {
+    char line[96];
+    va_list args;
+    va_start(args, format);
+    int length = vsnprintf(line, sizeof line, format, args);
+    va_end(args);
+    output.insert(output.end(), line, line + length);
+  }
+
+  void on_tx(uint8_t value, avr_model::cycles_t end) {
+    emit("tx %llu %u\n", to_ns(end), value);
+  }
+
+  void on_reset(const char* cause) {
+    printf("reset %llu %s\n", to_ns(avr_model::now()), cause);
+    fflush(stdout);
+    exit(70);
+  }
+
+  void apply_pin_changes() {
+    for (size_t i = 0; i < pin_changes.size();) {
+      if (pin_changes[i].cycle <= avr_model::now()) {
+        avr_model::set_input(pin_changes[i].pin, pin_changes[i].level);
+        pin_changes.erase(pin_changes.begin() + i);
+      } else {
+        i++;
+      }
+    }
+  }
+
+  void usage() {
+    fprintf(stderr, "usage: firmware_host [--ppm N] [--loop-us N] [--jitter-us N] [--seed N]\n");
+    exit(2);
+  }
+}
+
+int main(int argc, char** argv) {
+  double ppm = 0;
+  double loop_us = 100;
+  double jitter_us = 0;
+  unsigned long seed = 1;
+  for (int i = 1; i < argc; i++) {
+    if (i + 1 >= argc) usage();
+    if (!strcmp(argv[i], "--ppm")) ppm = atof(argv[++i]);
+    else if (!strcmp(argv[i], "--loop-us")) loop_us = atof(argv[++i]);
+    else if (!strcmp(argv[i], "--jitter-us")) jitter_us = atof(argv[++i]);
+    else if (!strcmp(argv[i], "--seed")) seed = strtoul(argv[++i], 0, 10);
+    else usage();
+  }
+  cycles_per_ns = 0.016 * (1 + ppm * 1e-6);
+  std::mt19937 jitter_random(seed);
+  std::uniform_real_distribution<double> jitter(0, jitter_us);
+
+  avr_model::reset();
+  avr_model::usart_set_tx_listener(on_tx);
+  avr_model::set_reset_handler(on_reset);
+  Wire.attach_device(0x60);
+  init();
+  setup();
+
+  int state = get_current_state();
+  unsigned long long next_report_ns = 0;
+  char line[128];
+  while (fgets(line, sizeof line, stdin)) {
+    unsigned long long t_ns;
+    unsigned int pin, level, value;
+    if (sscanf(line, "pin %llu %u %u", &t_ns, &pin, &level) == 3) {
+      pin_changes.push_back({to_cycles(t_ns), (uint8_t)pin, level != 0});
+    } else if (sscanf(line, "rx %llu %u", &t_ns, &value) == 2) {
+      // The coordinator runs the sender ahead, so bytes never arrive in the past
+      if (to_cycles(t_ns) < avr_model::now()) late_rx++;
+      avr_model::usart_receive(value, to_cycles(t_ns));
+    } else if (sscanf(line, "run %llu", &t_ns) == 1) {
+      avr_model::cycles_t target = to_cycles(t_ns);
+      while (avr_model::now() < target) {
+        apply_pin_changes();
+        loop();
+        loops++;
+        avr_model::run((avr_model::cycles_t)((loop_us + jitter(jitter_random)) * 16));
+
+        unsigned long long now_ns = to_ns(avr_model::now());
+        if (get_current_state() != state) {
+          state = get_current_state();
+          emit("state %llu %d\n", now_ns, state);
+        }
+        if (state == MUSIC_PLAY && now_ns >= next_report_ns) {
+          unsigned long position = get_midi_position_us(timebase_us());
+          emit("pos %llu %d %lu\n", to_ns(avr_model::now()), get_song_index(), position);
+          next_report_ns = now_ns + POSITION_REPORT_US * 1000ULL;
+        }
+      }
+      fwrite(output.data(), 1, output.size(), stdout);
+      output.clear();
+      printf("done %llu\n", to_ns(avr_model::now()));
+      fflush(stdout);
+    } else if (!strncmp(line, "quit", 4)) {
+      printf("stats %lu %lu %lu\n", avr_model::usart_overruns(), late_rx, loops);
+      fflush(stdout);
+      return 0;
+    }
+  }
+  return 0;
+}
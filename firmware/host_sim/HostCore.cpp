@@ -0,0 +1,404 @@
+// Host build of the Arduino AVR core functions the firmware calls, on the
+// peripheral model. Timing follows the core: millis() and micros() count
+// Timer0 overflows as wiring.c does, digitalWrite() and digitalRead()
+// disconnect the pin's PWM output, and Serial keeps the core's ring buffers
+// in front of the USART.
+#include <math.h>
+#include <Arduino.h>
+#include "AvrModel.h"
+
+// Cycles charged per digitalWrite()/digitalRead() and per pass of a
+// polling loop in the core
+#define DIGITAL_IO_CYCLES 60
+#define POLL_CYCLES        8
+
+namespace {
+  // Restores SREG on scope exit, as the core's ATOMIC blocks do
+  struct Atomic {
+    uint8_t sreg;
+    Atomic() : sreg(SREG) { cli(); }
+    ~Atomic() { SREG = sreg; }
+  };
+}
+
+// ---- wiring.c ----
+
+// 64x prescale: one overflow per 1024 us
+#define MICROSECONDS_PER_TIMER0_OVERFLOW (clockCyclesToMicroseconds(64 * 256))
+#define MILLIS_INC (MICROSECONDS_PER_TIMER0_OVERFLOW / 1000)
+#define FRACT_INC  ((MICROSECONDS_PER_TIMER0_OVERFLOW % 1000) >> 3)
+#define FRACT_MAX  (1000 >> 3)
+
+volatile unsigned long timer0_overflow_count = 0;
+volatile unsigned long timer0_millis = 0;
+static unsigned char timer0_fract = 0;
+
+ISR(TIMER0_OVF_vect) {
+  unsigned long m = timer0_millis;
+  unsigned char f = timer0_fract;
+  m += MILLIS_INC;
+  f += FRACT_INC;
+  if (f >= FRACT_MAX) {
+    f -= FRACT_MAX;
+    m += 1;
+  }
+  timer0_fract = f;
+  timer0_millis = m;
+  timer0_overflow_count++;
+}
+
+unsigned long millis() {
+  Atomic atomic;
+  return timer0_millis;
+}
+
+unsigned long micros() {
+  unsigned long m;
+  uint8_t t;
+  {
+    Atomic atomic;
+    m = timer0_overflow_count;
+    t = TCNT0;
+    if ((TIFR0 & _BV(TOV0)) && (t < 255)) m++;
+  }
+  return ((m << 8) + t) * (64 / clockCyclesPerMicrosecond());
+}
+
+void delay(unsigned long ms) {
+  uint32_t start = micros();
+  while (ms > 0) {
+    while (ms > 0 && (uint32_t)(micros() - start) >= 1000) {
+      ms--;
+      start += 1000;
+    }
+  }
+}
+
+void delayMicroseconds(unsigned int us) {
+  avr_model::run((avr_model::cycles_t)us * clockCyclesPerMicrosecond());
+}
+
+void init() {
+  timer0_overflow_count = 0;
+  timer0_millis = 0;
+  timer0_fract = 0;
+  sei();
+  // Timer0: fast PWM, 64x, overflow interrupt for millis()
+  TCCR0A = _BV(WGM01) | _BV(WGM00);
+  TCCR0B = _BV(CS01) | _BV(CS00);
+  TIMSK0 = _BV(TOIE0);
+  // The other timers: phase correct 8-bit PWM, 64x
+  TCCR1B = _BV(CS11) | _BV(CS10);
+  TCCR1A = _BV(WGM10);
+  TCCR2B = _BV(CS22);
+  TCCR2A = _BV(WGM20);
+  #if defined(__AVR_ATmega2560__)
+  TCCR3B = _BV(CS31) | _BV(CS30);
+  TCCR3A = _BV(WGM30);
+  TCCR4B = _BV(CS41) | _BV(CS40);
+  TCCR4A = _BV(WGM40);
+  TCCR5B = _BV(CS51) | _BV(CS50);
+  TCCR5A = _BV(WGM50);
+  #endif
+}
+
+// ---- wiring_digital.c ----
+
+void pinMode(uint8_t pin, uint8_t mode) {
+  volatile uint8_t* ddr = avr_model::pin_ddr(pin);
+  volatile uint8_t* out = avr_model::pin_port(pin);
+  uint8_t mask = avr_model::pin_port_mask(pin);
+  if (!ddr) return;
+  Atomic atomic;
+  if (mode == INPUT) {
+    *ddr &= ~mask;
+    *out &= ~mask;
+  } else if (mode == INPUT_PULLUP) {
+    *ddr &= ~mask;
+    *out |= mask;
+  } else {
+    *ddr |= mask;
+  }
+}
+
+void digitalWrite(uint8_t pin, uint8_t val) {
+  volatile uint8_t* out = avr_model::pin_port(pin);
+  uint8_t mask = avr_model::pin_port_mask(pin);
+  if (!out) return;
+  avr_model::disconnect_pwm(pin);
+  {
+    Atomic atomic;
+    if (val == LOW) *out &= ~mask;
+    else *out |= mask;
+  }
+  avr_model::run(DIGITAL_IO_CYCLES);
+}
+
+int digitalRead(uint8_t pin) {
+  avr_model::disconnect_pwm(pin);
+  avr_model::run(DIGITAL_IO_CYCLES);
+  return avr_model::pin_level(pin) ? HIGH : LOW;
+}
+
+// ---- WInterrupts.c ----
+
+void attachInterrupt(uint8_t interrupt_num, void (*user_func)(), int mode) {
+  avr_model::attach_external(interrupt_num, user_func, mode);
+}
+
+void detachInterrupt(uint8_t interrupt_num) {
+  avr_model::detach_external(interrupt_num);
+}
+
+// ---- WMath.cpp, over avr-libc's random() ----
+
+namespace {
+  unsigned long random_next = 1;
+
+  // Park-Miller minimal standard generator, as avr-libc computes it
+  long do_random(unsigned long* context) {
+    long x = *context;
+    if (x == 0) x = 123459876L;
+    long hi = x / 127773L;
+    long lo = x % 127773L;
+    x = 16807L * lo - 2836L * hi;
+    if (x < 0) x += 0x7fffffffL;
+    *context = x;
+    return x % (0x7fffffffUL + 1);
+  }
+}
+
+void randomSeed(unsigned long seed) {
+  if (seed != 0) random_next = seed;
+}
+
+long random(long howbig) {
+  if (howbig == 0) return 0;
+  return do_random(&random_next) % howbig;
+}
+
+long random(long howsmall, long howbig) {
+  if (howsmall >= howbig) return howsmall;
+  return random(howbig - howsmall) + howsmall;
+}
+
+// ---- Print.cpp ----
+
+size_t Print::write(const uint8_t* buffer, size_t size) {
+  size_t n = 0;
+  while (size--) {
+    if (write(*buffer++)) n++;
+    else break;
+  }
+  return n;
+}
+
+size_t Print::print(const __FlashStringHelper* text) {
+  return write(reinterpret_cast<const char*>(text));
+}
+
+size_t Print::print(const String& text) {
+  return write(text.c_str(), text.length());
+}
+
+size_t Print::print(const char text[]) {
+  return write(text);
+}
+
+size_t Print::print(char value) {
+  return write((uint8_t)value);
+}
+
+size_t Print::print(unsigned char value, int base) {
+  return print((unsigned long)value, base);
+}
+
+size_t Print::print(int value, int base) {
+  return print((long)value, base);
+}
+
+size_t Print::print(unsigned int value, int base) {
+  return print((unsigned long)value, base);
+}
+
+size_t Print::print(long value, int base) {
+  if (base == 0) return write((uint8_t)value);
+  if (base == 10 && value < 0) {
+    size_t t = print('-');
+    return printNumber(-value, 10) + t;
+  }
+  return printNumber(value, base);
+}
+
+size_t Print::print(unsigned long value, int base) {
+  if (base == 0) return write((uint8_t)value);
+  return printNumber(value, base);
+}
+
+size_t Print::print(double value, int digits) {
+  return printFloat(value, digits);
+}
+
+size_t Print::println() {
+  return write("\r\n");
+}
+
+size_t Print::println(const __FlashStringHelper* text) { size_t n = print(text); return n + println(); }
+size_t Print::println(const String& text) { size_t n = print(text); return n + println(); }
+size_t Print::println(const char text[]) { size_t n = print(text); return n + println(); }
+size_t Print::println(char value) { size_t n = print(value); return n + println(); }
+size_t Print::println(unsigned char value, int base) { size_t n = print(value, base); return n + println(); }
+size_t Print::println(int value, int base) { size_t n = print(value, base); return n + println(); }
+size_t Print::println(unsigned int value, int base) { size_t n = print(value, base); return n + println(); }
+size_t Print::println(long value, int base) { size_t n = print(value, base); return n + println(); }
+size_t Print::println(unsigned long value, int base) { size_t n = print(value, base); return n + println(); }
+size_t Print::println(double value, int digits) { size_t n = print(value, digits); return n + println(); }
+
+size_t Print::printNumber(unsigned long value, uint8_t base) {
+  char buffer[8 * sizeof(long) + 1];
+  char* text = &buffer[sizeof(buffer) - 1];
+  *text = '\0';
+  if (base < 2) base = 10;
+  do {
+    char digit = value % base;
+    value /= base;
+    *--text = digit < 10 ? digit + '0' : digit + 'A' - 10;
+  } while (value);
+  return write(text);
+}
+
+size_t Print::printFloat(double number, uint8_t digits) {
+  size_t n = 0;
+  if (isnan(number)) return print("nan");
+  if (isinf(number)) return print("inf");
+  if (number > 4294967040.0 || number < -4294967040.0) return print("ovf");
+  if (number < 0.0) {
+    n += print('-');
+    number = -number;
+  }
+  double rounding = 0.5;
+  for (uint8_t i = 0; i < digits; ++i) rounding /= 10.0;
+  number += rounding;
+  unsigned long int_part = (unsigned long)number;
+  double remainder = number - (double)int_part;
+  n += print(int_part);
+  if (digits > 0) n += print('.');
+  while (digits-- > 0) {
+    remainder *= 10.0;
+    unsigned int digit = (unsigned int)remainder;
+    n += print(digit);
+    remainder -= digit;
+  }
+  return n;
+}
+
+// ---- HardwareSerial.cpp ----
+
+HardwareSerial Serial;
+
+namespace {
+  bool udr_empty_interrupt = false;
+
+  void set_udr_empty_interrupt(bool enabled) {
+    udr_empty_interrupt = enabled;
+    avr_model::usart_set_interrupts(true, enabled);
+  }
+}
+
+void HardwareSerial::begin(unsigned long baud, uint8_t config) {
+  avr_model::usart_begin(baud);
+  written_ = false;
+  rx_head_ = rx_tail_ = tx_head_ = tx_tail_ = 0;
+  set_udr_empty_interrupt(false);
+}
+
+void HardwareSerial::end() {
+  flush();
+  avr_model::usart_end();
+  udr_empty_interrupt = false;
+  rx_head_ = rx_tail_;
+}
+
+int HardwareSerial::available() {
+  return ((unsigned int)(SERIAL_RX_BUFFER_SIZE + rx_head_ - rx_tail_)) % SERIAL_RX_BUFFER_SIZE;
+}
+
+int HardwareSerial::peek() {
+  if (rx_head_ == rx_tail_) return -1;
+  return rx_buffer_[rx_tail_];
+}
+
+int HardwareSerial::read() {
+  if (rx_head_ == rx_tail_) return -1;
+  uint8_t value = rx_buffer_[rx_tail_];
+  rx_tail_ = (uint8_t)(rx_tail_ + 1) % SERIAL_RX_BUFFER_SIZE;
+  return value;
+}
+
+int HardwareSerial::availableForWrite() {
+  uint8_t head, tail;
+  {
+    Atomic atomic;
+    head = tx_head_;
+    tail = tx_tail_;
+  }
+  if (head >= tail) return SERIAL_TX_BUFFER_SIZE - 1 - head + tail;
+  return tail - head - 1;
+}
+
+void HardwareSerial::flush() {
+  if (!written_) return;
+  while (udr_empty_interrupt || !avr_model::usart_tx_idle()) {
+    if (!avr_model::interrupts_enabled() && udr_empty_interrupt && avr_model::usart_udr_empty())
+      tx_udr_empty_irq();
+    avr_model::run(POLL_CYCLES);
+  }
+}
+
+size_t HardwareSerial::write(uint8_t value) {
+  written_ = true;
+  // Straight into UDR when nothing is queued
+  if (tx_head_ == tx_tail_ && avr_model::usart_udr_empty()) {
+    Atomic atomic;
+    avr_model::usart_write_udr(value);
+    return 1;
+  }
+  uint8_t i = (tx_head_ + 1) % SERIAL_TX_BUFFER_SIZE;
+  // Buffer full: wait for the ISR, or with interrupts masked, do its work here
+  while (i == tx_tail_) {
+    if (!avr_model::interrupts_enabled() && avr_model::usart_udr_empty()) tx_udr_empty_irq();
+    avr_model::run(POLL_CYCLES);
+  }
+  tx_buffer_[tx_head_] = value;
+  {
+    Atomic atomic;
+    tx_head_ = i;
+    set_udr_empty_interrupt(true);
+  }
+  return 1;
+}
+
+void HardwareSerial::rx_complete_irq() {
+  uint8_t value = avr_model::usart_read_udr();
+  uint8_t i = (uint8_t)(rx_head_ + 1) % SERIAL_RX_BUFFER_SIZE;
+  // A full buffer drops the byte
+  if (i != rx_tail_) {
+    rx_buffer_[rx_head_] = value;
+    rx_head_ = i;
+  }
+}
+
+void HardwareSerial::tx_udr_empty_irq() {
+  uint8_t value = tx_buffer_[tx_tail_];
+  tx_tail_ = (tx_tail_ + 1) % SERIAL_TX_BUFFER_SIZE;
+  avr_model::usart_write_udr(value);
+  if (tx_head_ == tx_tail_) set_udr_empty_interrupt(false);
+}
+
+#if defined(__AVR_ATmega2560__)
+ISR(USART0_RX_vect) { Serial.rx_complete_irq(); }
+ISR(USART0_UDRE_vect) { Serial.tx_udr_empty_irq(); }
+#else
+ISR(USART_RX_vect) { Serial.rx_complete_irq(); }
+ISR(USART_UDRE_vect) { Serial.tx_udr_empty_irq(); }
+#endif
@@ -0,0 +1,411 @@
+// Host builds of the libraries the firmware links: Wire, the MCP47X6 DAC,
+// Adafruit_NeoPixel and SD, charging the bus and interrupt-masked time their
+// AVR versions take.
+#include <Arduino.h>
+#include <Wire.h>
+#include <MCP47X6.h>
+#include <Adafruit_NeoPixel.h>
+#include <SD.h>
+#include <dirent.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include "AvrModel.h"
+
+// ---- Wire ----
+
+TwoWire Wire;
+
+namespace {
+  bool device_present[128];
+  // Address byte, START and STOP overhead in bit times
+  const uint8_t TWI_FRAME_BITS = 9 + 2;
+
+  // One byte and its ACK at the clock TWBR sets
+  void twi_wait_bits(uint16_t bits) {
+    avr_model::run((avr_model::cycles_t)bits * (16 + 2 * TWBR));
+  }
+}
+
+void TwoWire::begin() {
+  TWBR = ((F_CPU / 100000) - 16) / 2;
+}
+
+void TwoWire::setClock(uint32_t clock) {
+  TWBR = ((F_CPU / clock) - 16) / 2;
+}
+
+void TwoWire::beginTransmission(uint8_t address) {
+  address_ = address;
+  length_ = 0;
+}
+
+size_t TwoWire::write(uint8_t value) {
+  length_++;
+  return 1;
+}
+
+size_t TwoWire::write(const uint8_t* data, size_t length) {
+  length_ += length;
+  return length;
+}
+
+uint8_t TwoWire::endTransmission(bool stop) {
+  bool present = device_present[address_ & 0x7F];
+  // A missing device NACKs the address byte
+  twi_wait_bits(present ? TWI_FRAME_BITS + 9 * length_ : TWI_FRAME_BITS);
+  length_ = 0;
+  return present ? 0 : 2;
+}
+
+uint8_t TwoWire::requestFrom(uint8_t address, uint8_t quantity) {
+  bool present = device_present[address & 0x7F];
+  twi_wait_bits(present ? TWI_FRAME_BITS + 9 * quantity : TWI_FRAME_BITS);
+  received_ = present ? quantity : 0;
+  return received_;
+}
+
+int TwoWire::available() {
+  return received_;
+}
+
+int TwoWire::read() {
+  if (!received_) return -1;
+  received_--;
+  return 0;
+}
+
+void TwoWire::attach_device(uint8_t address) {
+  device_present[address & 0x7F] = true;
+}
+
+// ---- MCP47X6 ----
+
+bool MCP47X6::begin() {
+  return testConnection();
+}
+
+bool MCP47X6::testConnection() {
+  Wire.beginTransmission(address_);
+  return Wire.endTransmission() == 0;
+}
+
+void MCP47X6::setGain(uint8_t gain) {
+  config_ = (config_ & ~0x01) | (gain & 0x01);
+}
+
+void MCP47X6::setVReference(uint8_t reference) {
+  config_ = (config_ & ~0x18) | (reference & 0x18);
+}
+
+bool MCP47X6::saveSettings() {
+  return send(3);
+}
+
+bool MCP47X6::setOutputLevel(uint8_t level) {
+  level_ = level;
+  return send(2);
+}
+
+bool MCP47X6::setOutputLevel(uint16_t level) {
+  level_ = level;
+  return send(2);
+}
+
+bool MCP47X6::send(uint8_t length) {
+  Wire.beginTransmission(address_);
+  for (uint8_t i = 0; i < length; i++) Wire.write((uint8_t)0);
+  return Wire.endTransmission() == 0;
+}
+
+// ---- Adafruit_NeoPixel ----
+
+// 24 bits at 1.25 us each
+#define NEOPIXEL_CYCLES_PER_PIXEL (24 * 20)
+#define NEOPIXEL_LATCH_US 300
+
+Adafruit_NeoPixel::Adafruit_NeoPixel(uint16_t num_pixels, int16_t pin, neoPixelType type)
+    : num_pixels_(num_pixels) {
+  pixels_ = (uint32_t*)calloc(num_pixels, sizeof(uint32_t));
+}
+
+Adafruit_NeoPixel::~Adafruit_NeoPixel() {
+  free(pixels_);
+}
+
+void Adafruit_NeoPixel::begin() {
+}
+
+bool Adafruit_NeoPixel::canShow() {
+  uint32_t now = micros();
+  if (end_time_ > now) end_time_ = now;
+  return (now - end_time_) >= NEOPIXEL_LATCH_US;
+}
+
+void Adafruit_NeoPixel::show() {
+  while (!canShow()) {
+  }
+  noInterrupts();
+  avr_model::run((avr_model::cycles_t)num_pixels_ * NEOPIXEL_CYCLES_PER_PIXEL);
+  interrupts();
+  end_time_ = micros();
+  shows_++;
+}
+
+void Adafruit_NeoPixel::setPixelColor(uint16_t n, uint8_t r, uint8_t g, uint8_t b) {
+  if (n < num_pixels_) pixels_[n] = Color(r, g, b);
+}
+
+void Adafruit_NeoPixel::setPixelColor(uint16_t n, uint32_t color) {
+  if (n < num_pixels_) pixels_[n] = color;
+}
+
+void Adafruit_NeoPixel::fill(uint32_t color, uint16_t first, uint16_t count) {
+  if (first >= num_pixels_) return;
+  uint16_t end = (count == 0) ? num_pixels_ : first + count;
+  if (end > num_pixels_) end = num_pixels_;
+  for (uint16_t i = first; i < end; i++) pixels_[i] = color;
+}
+
+uint32_t Adafruit_NeoPixel::getPixelColor(uint16_t n) const {
+  return n < num_pixels_ ? pixels_[n] : 0;
+}
+
+// The library's integer HSV conversion
+uint32_t Adafruit_NeoPixel::ColorHSV(uint16_t hue, uint8_t sat, uint8_t val) {
+  uint8_t r, g, b;
+  hue = (hue * 1530L + 32768) / 65536;
+  if (hue < 510) {
+    b = 0;
+    if (hue < 255) { r = 255; g = hue; }
+    else { r = 510 - hue; g = 255; }
+  } else if (hue < 1020) {
+    r = 0;
+    if (hue < 765) { g = 255; b = hue - 510; }
+    else { g = 1020 - hue; b = 255; }
+  } else if (hue < 1530) {
+    g = 0;
+    if (hue < 1275) { r = hue - 1020; b = 255; }
+    else { r = 255; b = 1530 - hue; }
+  } else {
+    r = 255; g = b = 0;
+  }
+  uint32_t v1 = 1 + val;
+  uint16_t s1 = 1 + sat;
+  uint8_t s2 = 255 - sat;
+  return ((((((r * s1) >> 8) + s2) * v1) & 0xff00) << 8) |
+         (((((g * s1) >> 8) + s2) * v1) & 0xff00) |
+         (((((b * s1) >> 8) + s2) * v1) >> 8);
+}
+
+// ---- SD ----
+
+SDClass SD;
+
+#define SD_MAX_FILES 64
+#define SD_MAX_HANDLES 8
+#define SD_DIR_ENTRY_SIZE 32
+// Card layout: one FAT block, then the root directory, then the files from
+// SD_DATA_BLOCK on, each starting on a cluster
+#define SD_FAT_BLOCK 1
+#define SD_ROOT_BLOCK 2
+#define SD_DATA_BLOCK 64
+#define SD_BLOCKS_PER_CLUSTER (SD_CLUSTER_SIZE / SD_BLOCK_SIZE)
+
+namespace {
+  struct SdEntry {
+    char name[64];
+    uint8_t* data;
+    uint32_t size;
+    uint32_t first_block;
+  };
+  SdEntry sd_entries[SD_MAX_FILES];
+  int sd_entry_count = 0;
+  bool sd_card = false;
+
+  struct SdHandle {
+    bool open;
+    bool directory;
+    int entry;           // the file's, or the directory's next one
+    uint32_t position;
+    uint32_t cluster;    // index in the file's chain, as SdFile::curCluster_
+  };
+  SdHandle sd_handles[SD_MAX_HANDLES];
+
+  long cached_block = -1;
+  unsigned long block_reads = 0;
+
+  void cache_block(long block) {
+    if (block == cached_block) return;
+    cached_block = block;
+    block_reads++;
+    avr_model::run(SD_BLOCK_READ_CYCLES);
+  }
+
+  // SdFile::fatGet() for the next cluster of the chain
+  void next_cluster(SdHandle& handle) {
+    cache_block(SD_FAT_BLOCK);
+    handle.cluster++;
+  }
+
+  int compare_entries(const void* a, const void* b) {
+    return strcmp(((const SdEntry*)a)->name, ((const SdEntry*)b)->name);
+  }
+
+  int open_handle(bool directory, int entry) {
+    for (int i = 0; i < SD_MAX_HANDLES; i++) {
+      if (sd_handles[i].open) continue;
+      sd_handles[i] = {true, directory, entry, 0, 0};
+      return i;
+    }
+    return -1;
+  }
+}
+
+void sd_set_root(const char* directory) {
+  for (int i = 0; i < sd_entry_count; i++) free(sd_entries[i].data);
+  sd_entry_count = 0;
+  sd_card = false;
+  DIR* dir = opendir(directory);
+  if (!dir) return;
+  sd_card = true;
+  while (struct dirent* found = readdir(dir)) {
+    if (found->d_name[0] == '.' || sd_entry_count == SD_MAX_FILES) continue;
+    char path[512];
+    snprintf(path, sizeof(path), "%s/%s", directory, found->d_name);
+    FILE* file = fopen(path, "rb");
+    if (!file) continue;
+    SdEntry& entry = sd_entries[sd_entry_count];
+    fseek(file, 0, SEEK_END);
+    entry.size = ftell(file);
+    fseek(file, 0, SEEK_SET);
+    entry.data = (uint8_t*)malloc(entry.size ? entry.size : 1);
+    if (fread(entry.data, 1, entry.size, file) == entry.size) {
+      snprintf(entry.name, sizeof(entry.name), "%s", found->d_name);
+      sd_entry_count++;
+    } else {
+      free(entry.data);
+    }
+    fclose(file);
+  }
+  closedir(dir);
+  qsort(sd_entries, sd_entry_count, sizeof(SdEntry), compare_entries);
+  uint32_t block = SD_DATA_BLOCK;
+  for (int i = 0; i < sd_entry_count; i++) {
+    sd_entries[i].first_block = block;
+    uint32_t clusters = (sd_entries[i].size + SD_CLUSTER_SIZE - 1) / SD_CLUSTER_SIZE;
+    block += (clusters ? clusters : 1) * SD_BLOCKS_PER_CLUSTER;
+  }
+}
+
+unsigned long sd_block_reads() {
+  return block_reads;
+}
+
+bool SDClass::begin(uint8_t cs_pin) {
+  memset(sd_handles, 0, sizeof(sd_handles));
+  cached_block = -1;
+  if (!sd_card) return false;
+  // The MBR, then the volume's boot sector
+  cache_block(0);
+  cache_block(SD_DATA_BLOCK - 1);
+  return true;
+}
+
+File SDClass::open(const char* path, uint8_t mode) {
+  if (!sd_card) return File();
+  if (!strcmp(path, "/")) return File(open_handle(true, 0));
+  if (*path == '/') path++;
+  for (int i = 0; i < sd_entry_count; i++) {
+    if (strcasecmp(sd_entries[i].name, path)) continue;
+    cache_block(SD_ROOT_BLOCK + i * SD_DIR_ENTRY_SIZE / SD_BLOCK_SIZE);
+    return File(open_handle(false, i));
+  }
+  return File();
+}
+
+File::operator bool() const {
+  return handle_ >= 0 && sd_handles[handle_].open;
+}
+
+int File::read() {
+  uint8_t value;
+  return read(&value, 1) == 1 ? value : -1;
+}
+
+// SdFile::read(): a read from a cluster's first byte moves on down the chain
+int File::read(void* buffer, uint16_t length) {
+  if (!*this || sd_handles[handle_].directory) return -1;
+  SdHandle& handle = sd_handles[handle_];
+  const SdEntry& entry = sd_entries[handle.entry];
+  if (length > entry.size - handle.position) length = entry.size - handle.position;
+  uint8_t* out = (uint8_t*)buffer;
+  uint16_t left = length;
+  while (left) {
+    uint32_t offset = handle.position % SD_BLOCK_SIZE;
+    if (handle.position % SD_CLUSTER_SIZE == 0) {
+      if (handle.position == 0) {
+        handle.cluster = 0;
+      } else {
+        next_cluster(handle);
+      }
+    }
+    cache_block(entry.first_block + handle.position / SD_BLOCK_SIZE);
+    uint16_t count = SD_BLOCK_SIZE - offset < left ? SD_BLOCK_SIZE - offset : left;
+    memcpy(out, entry.data + handle.position, count);
+    out += count;
+    handle.position += count;
+    left -= count;
+  }
+  return length;
+}
+
+// SdFile::seekSet(): follows the chain from the current cluster, or from
+// the first one when the new position is in an earlier cluster
+bool File::seek(uint32_t position) {
+  if (!*this || sd_handles[handle_].directory) return false;
+  SdHandle& handle = sd_handles[handle_];
+  if (position > sd_entries[handle.entry].size) return false;
+  if (position == 0) {
+    handle.cluster = 0;
+    handle.position = 0;
+    return true;
+  }
+  uint32_t current = (handle.position - 1) / SD_CLUSTER_SIZE;
+  uint32_t target = (position - 1) / SD_CLUSTER_SIZE;
+  if (target < current || handle.position == 0) handle.cluster = 0;
+  while (handle.cluster < target) next_cluster(handle);
+  handle.position = position;
+  return true;
+}
+
+uint32_t File::position() const {
+  return *this ? sd_handles[handle_].position : 0;
+}
+
+uint32_t File::size() const {
+  return *this && !sd_handles[handle_].directory ? sd_entries[sd_handles[handle_].entry].size : 0;
+}
+
+const char* File::name() const {
+  return *this && !sd_handles[handle_].directory ? sd_entries[sd_handles[handle_].entry].name : "/";
+}
+
+bool File::isDirectory() const {
+  return *this && sd_handles[handle_].directory;
+}
+
+// Reads the next directory entry, then opens its file
+File File::openNextFile(uint8_t mode) {
+  if (!*this || !sd_handles[handle_].directory) return File();
+  SdHandle& handle = sd_handles[handle_];
+  if (handle.entry == sd_entry_count) return File();
+  int entry = handle.entry++;
+  cache_block(SD_ROOT_BLOCK + entry * SD_DIR_ENTRY_SIZE / SD_BLOCK_SIZE);
+  return File(open_handle(false, entry));
+}
+
+void File::close() {
+  if (*this) sd_handles[handle_].open = false;
+  handle_ = -1;
+}
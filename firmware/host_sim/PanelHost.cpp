@@ -0,0 +1,74 @@
+// Runs the front panel scenario (simavr_test/panel_scenario.c) on the
+// peripheral model: the same script and checks the simavr harness runs
+// against the real image, here against the host build of the sketch.
+// loop() passes are charged --loop-us each, so inputs are applied at that
+// granularity.
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <Arduino.h>
+#include <Wire.h>
+#include "AvrModel.h"
+#include "pin_definitions.h"
+#include "../simavr_test/panel_scenario.h"
+
+namespace {
+  double loop_us = 100;
+
+  uint64_t to_ns(avr_model::cycles_t cycles) {
+    return cycles * 1000 / 16;
+  }
+
+  void on_pin(uint8_t pin, bool high, avr_model::cycles_t cycle) {
+    switch (pin) {
+      case PWM_1: panel_output_changed(PANEL_PWM_1, high, to_ns(cycle)); break;
+      case PWM_2: panel_output_changed(PANEL_PWM_2, high, to_ns(cycle)); break;
+      case LED1: panel_output_changed(PANEL_LED1, high, to_ns(cycle)); break;
+      case LED2: panel_output_changed(PANEL_LED2, high, to_ns(cycle)); break;
+    }
+  }
+
+  void on_tx(uint8_t value, avr_model::cycles_t end) {
+    panel_serial_byte(value, to_ns(end));
+  }
+
+  void on_reset(const char* cause) {
+    printf("FAIL  %s reset at %.3f ms\n", cause, to_ns(avr_model::now()) / 1e6);
+    exit(1);
+  }
+}
+
+void sim_input(enum panel_input input, int high) {
+  static const uint8_t PINS[] = {MSTR_EN, MODE_IN, TEST_IN, TRIG_IN, OCD_DETECT};
+  avr_model::set_input(PINS[input], high);
+}
+
+void sim_run_until(uint64_t t_ns) {
+  while (to_ns(avr_model::now()) < t_ns) {
+    loop();
+    avr_model::run((avr_model::cycles_t)(loop_us * 16));
+  }
+}
+
+int main(int argc, char** argv) {
+  for (int i = 1; i < argc; i++) {
+    if (!strcmp(argv[i], "--loop-us") && i + 1 < argc) {
+      loop_us = atof(argv[++i]);
+    } else {
+      fprintf(stderr, "usage: panel_test [--loop-us N]\n");
+      return 2;
+    }
+  }
+
+  avr_model::reset();
+  avr_model::usart_set_tx_listener(on_tx);
+  avr_model::set_reset_handler(on_reset);
+  avr_model::watch_pin(PWM_1, on_pin);
+  avr_model::watch_pin(PWM_2, on_pin);
+  avr_model::watch_pin(LED1, on_pin);
+  avr_model::watch_pin(LED2, on_pin);
+  Wire.attach_device(0x60);
+  init();
+  setup();
+  return panel_run_scenario() ? 1 : 0;
+}
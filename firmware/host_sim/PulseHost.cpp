@@ -0,0 +1,140 @@
+// Plays a pre-rendered pulse-train song (PulseTrain.h) on the host build of
+// the sketch: start_midi() on the song bytes, then play_midi() and
+// dispatch_notifications() every --step-us as loop() calls them. Prints
+// voice 0's gate pulses in Timer1 ticks (0.5 us) from start_midi(), for
+// pulse_test.py to compare with the records it encoded.
+//
+//   pulse_model <song file> [--step-us N] [--stop-pulse N]
+//
+// With --stop-pulse, set_pwm_off() is called in gate pulse N (from 0),
+// STOP_INTO_PULSE cycles after its rising edge, and voice 0 then plays a
+// note: the pulse must keep its width, and the note's first pulse must not
+// start early.
+//
+// Output lines:
+//   pulse <start> <width>
+//   stop <tick>          when set_pwm_off() was called
+//   note <tick>          when the note started
+//   underruns <count>    NOTIFY_UNDERRUN periods while playing
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <vector>  // before Arduino's min/max macros
+#include <Arduino.h>
+#include <avr/wdt.h>
+#include <Wire.h>
+#include "AvrModel.h"
+#include "MIDIPlayer.h"
+#include "EventQueue.h"
+#include "VoiceBackend.h"
+
+#define CYCLES_PER_TICK 8
+#define STOP_INTO_PULSE (3 * CYCLES_PER_TICK)
+#define NOTE_MS 20
+
+namespace {
+  avr_model::cycles_t song_start = 0;
+  unsigned long step_us = 1000;
+  unsigned long pulse_count = 0;
+
+  unsigned long ticks(avr_model::cycles_t cycle) {
+    return (unsigned long)((cycle - song_start) / CYCLES_PER_TICK);
+  }
+
+  void on_gate(uint8_t pin, bool high, avr_model::cycles_t cycle) {
+    static avr_model::cycles_t rise = 0;
+    if (high) {
+      rise = cycle;
+    } else {
+      pulse_count++;
+      printf("pulse %lu %lu\n", ticks(rise), (unsigned long)((cycle - rise) / CYCLES_PER_TICK));
+    }
+  }
+
+  void on_reset(const char* cause) {
+    fprintf(stderr, "%s reset at %lu ticks\n", cause, ticks(avr_model::now()));
+    exit(1);
+  }
+
+  // One loop() pass's worth of playback
+  bool step() {
+    bool playing = play_midi();
+    dispatch_notifications();
+    wdt_reset();
+    avr_model::run((avr_model::cycles_t)step_us * 16);
+    return playing;
+  }
+}
+
+int main(int argc, char** argv) {
+  const char* path = NULL;
+  long stop_pulse = -1;
+  for (int i = 1; i < argc; i++) {
+    if (!strcmp(argv[i], "--step-us") && i + 1 < argc) {
+      step_us = atol(argv[++i]);
+    } else if (!strcmp(argv[i], "--stop-pulse") && i + 1 < argc) {
+      stop_pulse = atol(argv[++i]);
+    } else if (!path) {
+      path = argv[i];
+    } else {
+      path = NULL;
+      break;
+    }
+  }
+  if (!path || !step_us) {
+    fprintf(stderr, "usage: pulse_model <song file> [--step-us N] [--stop-pulse N]\n");
+    return 2;
+  }
+
+  std::vector<byte> song;
+  FILE* file = fopen(path, "rb");
+  if (!file) {
+    perror(path);
+    return 1;
+  }
+  int c;
+  while ((c = fgetc(file)) != EOF) song.push_back((byte)c);
+  fclose(file);
+
+  avr_model::reset();
+  avr_model::set_reset_handler(on_reset);
+  Wire.attach_device(0x60);
+  init();
+  setup();
+  uint8_t pin = voice_pin(0);
+  avr_model::watch_pin(pin, on_gate);
+
+  unsigned long underruns = pulse_train_underruns;
+  song_start = avr_model::now();
+  start_midi(song.data());
+  if (stop_pulse < 0) {
+    while (step()) {}
+  } else {
+    // As step(), a cycle at a time until the pulse starts
+    while (true) {
+      play_midi();
+      dispatch_notifications();
+      wdt_reset();
+      avr_model::cycles_t step_end = avr_model::now() + (avr_model::cycles_t)step_us * 16;
+      while (avr_model::now() < step_end &&
+             !(pulse_count == (unsigned long)stop_pulse && avr_model::pin_level(pin))) {
+        avr_model::run(1);
+      }
+      if (avr_model::now() < step_end) break;
+    }
+    avr_model::run(STOP_INTO_PULSE);
+    printf("stop %lu\n", ticks(avr_model::now()));
+    set_pwm_off();
+    avr_model::run(NOTE_MS * 16000);
+    wdt_reset();
+    printf("note %lu\n", ticks(avr_model::now()));
+    voice_note_on(0, 60, 1);
+    avr_model::run(NOTE_MS * 16000);
+    wdt_reset();
+    voice_off(0);
+    avr_model::run(NOTE_MS * 16000);
+  }
+  dispatch_notifications();
+  printf("underruns %lu\n", pulse_train_underruns - underruns);
+  return 0;
+}
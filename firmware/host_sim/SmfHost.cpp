@@ -0,0 +1,110 @@
+// Plays every .MID file of a host directory through SmfPlayer on the host
+// build (an ATmega2560 with SMF_PLAYBACK), at song speed, calling smf_play()
+// every --step-us as the loop does, and counts the SD blocks each call loads
+// into the library's single block cache (stubs/SD.h). Each track's buffer
+// refill seeks to that track's offset, so with several tracks the refills
+// of one call can each load a different block.
+//
+//   smf_model <directory> [--step-us N]
+//
+// Prints per file: calls, blocks loaded, the most in one call and how many
+// calls loaded two or more, and the most SD time one call took. Exits
+// non-zero if a call loads more than MAX_CALL_BLOCKS.
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <Arduino.h>
+#include <avr/wdt.h>
+#include <Wire.h>
+#include <SD.h>
+#include "AvrModel.h"
+#include "SmfPlayer.h"
+
+#define MAX_LOADS_COUNTED 16
+// SMF_MAX_REFILLS_PER_CALL refills, each a data block and a FAT block when
+// it seeks into another cluster, and one more refill by the event that
+// skips a long meta event past its buffer
+#define MAX_CALL_BLOCKS (2 * SMF_MAX_REFILLS_PER_CALL + 2)
+
+namespace {
+  // The file_index-th .MID file, in the order SmfPlayer counts them
+  void file_name(uint8_t file_index, char* name, size_t size) {
+    snprintf(name, size, "?");
+    File root = SD.open("/");
+    File entry;
+    while ((entry = root.openNextFile())) {
+      size_t length = strlen(entry.name());
+      if (!entry.isDirectory() && length > 4 && !strcasecmp(entry.name() + length - 4, ".MID") &&
+          !file_index--) {
+        snprintf(name, size, "%s", entry.name());
+      }
+      entry.close();
+    }
+    root.close();
+  }
+}
+
+int main(int argc, char** argv) {
+  unsigned long step_us = 1000;
+  const char* directory = NULL;
+  for (int i = 1; i < argc; i++) {
+    if (!strcmp(argv[i], "--step-us") && i + 1 < argc) {
+      step_us = atol(argv[++i]);
+    } else if (!directory) {
+      directory = argv[i];
+    } else {
+      directory = NULL;
+      break;
+    }
+  }
+  if (!directory || !step_us) {
+    fprintf(stderr, "usage: smf_model <directory> [--step-us N]\n");
+    return 2;
+  }
+
+  sd_set_root(directory);
+  avr_model::reset();
+  Wire.attach_device(0x60);
+  init();
+  setup();
+  if (!smf_song_count()) {
+    fprintf(stderr, "%s: no .MID files\n", directory);
+    return 1;
+  }
+
+  int failures = 0;
+  printf("file: calls, blocks loaded, most in one call, calls loading 2+, most SD ms in one call\n");
+  for (uint8_t i = 0; i < smf_song_count(); i++) {
+    char name[64];
+    file_name(i, name, sizeof(name));
+    if (!smf_start(i, micros())) {
+      printf("%s: not played\n", name);
+      failures++;
+      continue;
+    }
+    unsigned long calls = 0, start_reads = sd_block_reads(), worst = 0, multiple = 0;
+    unsigned long histogram[MAX_LOADS_COUNTED + 1] = {0};
+    bool playing = true;
+    while (playing) {
+      unsigned long reads = sd_block_reads();
+      playing = smf_play(micros());
+      unsigned long loads = sd_block_reads() - reads;
+      calls++;
+      if (loads > worst) worst = loads;
+      if (loads >= 2) multiple++;
+      histogram[loads < MAX_LOADS_COUNTED ? loads : MAX_LOADS_COUNTED]++;
+      // As loop() does each pass
+      wdt_reset();
+      avr_model::run((avr_model::cycles_t)step_us * 16);
+    }
+    printf("%s: %lu, %lu, %lu, %lu, %.1f\n", name, calls, sd_block_reads() - start_reads, worst, multiple,
+           worst * (SD_BLOCK_READ_CYCLES / 16000.0));
+    printf("  calls by blocks loaded:");
+    for (unsigned long loads = 0; loads <= worst && loads <= MAX_LOADS_COUNTED; loads++) {
+      printf(" %lu:%lu", loads, histogram[loads]);
+    }
+    printf("\n");
+    if (worst > MAX_CALL_BLOCKS) failures++;
+  }
+  return failures ? 1 : 0;
+}
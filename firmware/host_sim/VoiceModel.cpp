@@ -0,0 +1,283 @@
+// Tick-level model of the voice timers: the AVR backend (VoiceBackendAVR.cpp)
+// on the peripheral model, with its real ISRs, timer double buffering and
+// output compare pins. Each note is played through voice_note_on() and
+// measured from the edges on the voice's gate pin.
+//
+//   voice_model pitch [--table FILE]
+//                       each note's period against equal temperament
+//                       (A4 = 440 Hz), in cents, per voice: the mean over
+//                       the 8-bit voices' 256-period dither pattern and the
+//                       worst 50 ms window, both within
+//                       PITCH_TOLERANCE_CENTS, written as CSV to FILE; and
+//                       each single period against that mean, which must be
+//                       under one timer count (the 8-bit voices count whole
+//                       sub-periods in their ISR, and one missed or counted
+//                       twice is 128 counts off)
+//   voice_model gates   gate pulse widths for every note at volumes 1, 3 and
+//                       10, then random note changes and off() at random
+//                       points in the period: no pulse longer than the top
+//                       volume's, every one the on-time of a note set before
+//                       it (the last one on the 16-bit voices, which restart
+//                       the period; one set before its period began on the
+//                       8-bit voices, which double buffer it), and none
+//                       after off() once its period is over
+#include <math.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <random>  // before Arduino's min/max macros
+#include <vector>
+#include <Arduino.h>
+#include "AvrModel.h"
+#include "VoiceBackend.h"
+
+// VoiceBackendAVR.cpp's MAX_VOLUME and COIL_FREQ_CYCLES_HALF
+#define TOP_VOLUME 10
+#define ON_TIME_STEP_CYCLES 32
+// The phase accumulator's full cycle (Voice8::sub_period)
+#define DITHER_PERIODS 256
+#define WINDOW_CYCLES (50 * 16000)
+
+namespace {
+  struct Pulse {
+    avr_model::cycles_t start;
+    avr_model::cycles_t width;
+  };
+  std::vector<Pulse> pulses;
+
+  void on_gate(uint8_t pin, bool high, avr_model::cycles_t cycle) {
+    if (high) {
+      pulses.push_back({cycle, 0});
+    } else if (!pulses.empty() && !pulses.back().width) {
+      pulses.back().width = cycle - pulses.back().start;
+    }
+  }
+
+  double target_hz(uint8_t note) {
+    return 440.0 * pow(2.0, (note - 69) / 12.0);
+  }
+
+  double cents(double cycles_per_period, uint8_t note) {
+    return 1200 * log2(F_CPU / cycles_per_period / target_hz(note));
+  }
+
+  // Plays the note from a fresh reset for at least the given periods and
+  // cycles, skipping the first pulse, which may come from the previous
+  // register state
+  void play(uint8_t voice, uint8_t note, uint8_t volume, size_t periods, avr_model::cycles_t cycles) {
+    avr_model::reset();
+    init();
+    setup_voices();
+    avr_model::watch_pin(voice_pin(voice), on_gate);
+    pulses.clear();
+    voice_note_on(voice, note, volume);
+    while (pulses.size() < periods + 2 || pulses.back().start - pulses[1].start < cycles) avr_model::run(16000);
+    pulses.erase(pulses.begin());
+  }
+
+  struct Pitch {
+    double mean_cents;
+    double window_cents;  // furthest from equal temperament over any 50 ms
+    double period_error;  // furthest single period from the mean, in timer counts
+  };
+
+  Pitch measure_pitch(uint8_t voice, uint8_t note) {
+    play(voice, note, TOP_VOLUME, DITHER_PERIODS, 2 * WINDOW_CYCLES);
+    Pitch pitch;
+    double mean = (double)(pulses[DITHER_PERIODS].start - pulses[0].start) / DITHER_PERIODS;
+    pitch.mean_cents = cents(mean, note);
+    pitch.period_error = 0;
+    for (size_t i = 0; i + 1 < pulses.size(); i++) {
+      double error = ((double)(pulses[i + 1].start - pulses[i].start) - mean) / (1 << voice_note_cost(voice, note));
+      if (fabs(error) > fabs(pitch.period_error)) pitch.period_error = error;
+    }
+    pitch.window_cents = 0;
+    // Windows of whole periods, each the shortest reaching 50 ms
+    for (size_t i = 0, j = 1; i < pulses.size(); i++) {
+      if (j <= i) j = i + 1;
+      while (j < pulses.size() && pulses[j].start - pulses[i].start < WINDOW_CYCLES) j++;
+      if (j == pulses.size()) break;
+      double window = cents((double)(pulses[j].start - pulses[i].start) / (j - i), note);
+      if (fabs(window) > fabs(pitch.window_cents)) pitch.window_cents = window;
+    }
+    return pitch;
+  }
+
+  // 8-bit voices: Timer2, and Timer0 with TIMER0_VOICE
+  bool is_8bit(uint8_t voice) {
+    #if defined(__AVR_ATmega2560__)
+    return false;
+    #else
+    return voice > 0;
+    #endif
+  }
+
+  // The on-time note_on() targets, at the note's prescaler: whole counts,
+  // at least one
+  avr_model::cycles_t expected_width(uint8_t voice, uint8_t note, uint8_t volume) {
+    uint8_t shift = voice_note_cost(voice, note);
+    avr_model::cycles_t counts = ((avr_model::cycles_t)volume * ON_TIME_STEP_CYCLES) >> shift;
+    return (counts ? counts : 1) << shift;
+  }
+
+  const uint8_t WIDTH_VOLUMES[] = {1, 3, TOP_VOLUME};
+  #define TRANSITIONS 2000
+  // Longest 8-bit sub-period, 255 counts at 8x: registers written in one
+  // take effect at the next
+  #define TIMER8_SETTLE_CYCLES (256 * 8)
+
+  // How long before a pulse a change may still set it. Timer0 leaves its
+  // register writes to its ISR, a sub-period later.
+  avr_model::cycles_t settle_cycles(uint8_t voice) {
+    if (!is_8bit(voice)) return 0;
+    #ifdef TIMER0_VOICE
+    if (voice == 2) return 2 * TIMER8_SETTLE_CYCLES;
+    #endif
+    return TIMER8_SETTLE_CYCLES;
+  }
+
+  int run_gates() {
+    int failures = 0;
+    for (uint8_t voice = 0; voice < NUM_VOICES; voice++) {
+      // Widths: every pulse of a steady note
+      size_t checked = 0, wrong = 0;
+      avr_model::cycles_t shortest = UINT64_MAX, longest = 0;
+      for (uint8_t note = 21; note < 128; note++) {
+        for (uint8_t volume : WIDTH_VOLUMES) {
+          play(voice, note, volume, 8, 0);
+          avr_model::cycles_t expected = expected_width(voice, note, volume);
+          for (const Pulse& pulse : pulses) {
+            if (!pulse.width) continue;
+            checked++;
+            if (pulse.width < shortest) shortest = pulse.width;
+            if (pulse.width > longest) longest = pulse.width;
+            if (pulse.width != expected) {
+              if (wrong++ < 10) {
+                printf("voice %u note %u volume %u: pulse of %llu cycles, expected %llu\n", voice, note, volume,
+                       (unsigned long long)pulse.width, (unsigned long long)expected);
+              }
+            }
+          }
+        }
+      }
+      printf("voice %u (pin %u): %zu pulses over notes 21-127 at volumes 1, 3, 10: %zu off target, "
+             "%.2f..%.2f us\n", voice, voice_pin(voice), checked, wrong, shortest / 16.0, longest / 16.0);
+      if (wrong) failures++;
+
+      // Transitions: a random note change or off() every 0-2 periods
+      std::mt19937 random(voice + 1);
+      avr_model::reset();
+      init();
+      setup_voices();
+      avr_model::watch_pin(voice_pin(voice), on_gate);
+      pulses.clear();
+      struct Change {
+        avr_model::cycles_t cycle;
+        avr_model::cycles_t width;  // 0 for off()
+      };
+      std::vector<Change> changes;
+      for (int i = 0; i < TRANSITIONS; i++) {
+        uint8_t note = 21 + random() % 107;
+        avr_model::cycles_t period = F_CPU / target_hz(note);
+        avr_model::run(1 + random() % (2 * period));
+        if (random() % 5 == 0) {
+          voice_off(voice);
+          changes.push_back({avr_model::now(), 0});
+        } else {
+          uint8_t volume = 1 + random() % TOP_VOLUME;
+          voice_note_on(voice, note, volume);
+          changes.push_back({avr_model::now(), expected_width(voice, note, volume)});
+        }
+      }
+      voice_off(voice);
+      changes.push_back({avr_model::now(), 0});
+      avr_model::cycles_t settle = settle_cycles(voice);
+      avr_model::run(2 * settle + 16000);
+
+      size_t too_long = 0, unknown = 0, after_off = 0;
+      size_t change = 0;
+      for (const Pulse& pulse : pulses) {
+        while (change + 1 < changes.size() && changes[change + 1].cycle <= pulse.start) change++;
+        avr_model::cycles_t width = pulse.width;
+        if (width > expected_width(voice, 127, TOP_VOLUME)) too_long++;
+        // The last change before the pulse's period began, or any since
+        size_t first = change;
+        while (first > 0 && changes[first].cycle > pulse.start + width - settle) first--;
+        bool known = false;
+        for (size_t c = first; c <= change; c++) known |= changes[c].width == width;
+        if (!known) unknown++;
+        if (changes[change].width == 0 && pulse.start - changes[change].cycle > settle) after_off++;
+      }
+      printf("voice %u (pin %u): %zu pulses over %d changes: %zu too long, %zu of no note set, %zu after off()\n",
+             voice, voice_pin(voice), pulses.size(), TRANSITIONS, too_long, unknown, after_off);
+      if (too_long || unknown || after_off) failures++;
+    }
+    return failures ? 1 : 0;
+  }
+
+  int run_pitch(const char* table_path) {
+    FILE* table = NULL;
+    if (table_path) {
+      table = fopen(table_path, "w");
+      if (!table) {
+        perror(table_path);
+        return 2;
+      }
+      fprintf(table, "note,target_hz");
+      for (uint8_t voice = 0; voice < NUM_VOICES; voice++) fprintf(table, ",v%u_mean_cents,v%u_50ms_cents", voice, voice);
+      fprintf(table, "\n");
+    }
+    double worst_mean[NUM_VOICES] = {0}, worst_window[NUM_VOICES] = {0}, worst_from_v0[NUM_VOICES] = {0};
+    double worst_period[NUM_VOICES] = {0};
+    int notes_over = 0;
+    printf("note  target Hz");
+    for (uint8_t voice = 0; voice < NUM_VOICES; voice++) printf("   v%u mean  v%u 50ms", voice, voice);
+    printf("\n");
+    for (uint8_t note = 21; note < 128; note++) {
+      printf("%4u %10.2f", note, target_hz(note));
+      if (table) fprintf(table, "%u,%.3f", note, target_hz(note));
+      double v0_cents = 0;
+      bool over = false;
+      for (uint8_t voice = 0; voice < NUM_VOICES; voice++) {
+        Pitch pitch = measure_pitch(voice, note);
+        printf(" %+9.3f %+8.3f", pitch.mean_cents, pitch.window_cents);
+        if (table) fprintf(table, ",%.4f,%.4f", pitch.mean_cents, pitch.window_cents);
+        over |= fabs(pitch.mean_cents) > PITCH_TOLERANCE_CENTS || fabs(pitch.window_cents) > PITCH_TOLERANCE_CENTS;
+        if (voice == 0) v0_cents = pitch.mean_cents;
+        if (fabs(pitch.mean_cents) > fabs(worst_mean[voice])) worst_mean[voice] = pitch.mean_cents;
+        if (fabs(pitch.window_cents) > fabs(worst_window[voice])) worst_window[voice] = pitch.window_cents;
+        if (fabs(pitch.period_error) > fabs(worst_period[voice])) worst_period[voice] = pitch.period_error;
+        // The 8-bit voices take their periods from Timer1's table
+        if (fabs(pitch.mean_cents - v0_cents) > fabs(worst_from_v0[voice])) {
+          worst_from_v0[voice] = pitch.mean_cents - v0_cents;
+        }
+      }
+      printf("%s\n", over ? "  over" : "");
+      if (table) fprintf(table, "\n");
+      if (over) notes_over++;
+    }
+    if (table) fclose(table);
+    int failures = 0;
+    for (uint8_t voice = 0; voice < NUM_VOICES; voice++) {
+      printf("voice %u (pin %u): worst mean %+.4f cents, worst 50 ms window %+.4f cents, %+.4f from voice 0, "
+             "single periods within %+.3f counts of the mean\n", voice, voice_pin(voice), worst_mean[voice],
+             worst_window[voice], worst_from_v0[voice], worst_period[voice]);
+      if (fabs(worst_period[voice]) >= 1) failures++;
+    }
+    if (notes_over) {
+      printf("notes over %.2f cents: %d\n", PITCH_TOLERANCE_CENTS, notes_over);
+      failures++;
+    } else {
+      printf("every note within %.2f cents\n", PITCH_TOLERANCE_CENTS);
+    }
+    return failures ? 1 : 0;
+  }
+}
+
+int main(int argc, char** argv) {
+  if (argc == 2 && !strcmp(argv[1], "pitch")) return run_pitch(NULL);
+  if (argc == 4 && !strcmp(argv[1], "pitch") && !strcmp(argv[2], "--table")) return run_pitch(argv[3]);
+  if (argc == 2 && !strcmp(argv[1], "gates")) return run_gates();
+  fprintf(stderr, "usage: voice_model pitch [--table FILE] | gates\n");
+  return 2;
+}
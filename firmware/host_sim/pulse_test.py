@@ -0,0 +1,161 @@
+import argparse
+import os
+import subprocess
+import sys
+import tempfile
+
+from typing import List, NamedTuple, Tuple
+
+# Pulse-train playback test: trains encoded by the converter's
+# encode_pulse_train() are played on the host build (PulseHost.cpp), and
+# the gate pulses on voice 0's pin must match the records tick for tick.
+#   - a train with width changes, a silent record, a rest split into
+#     PULSE_TRAIN_SPLIT periods and a run at the minimum period
+#   - set_pwm_off() part way through a pulse whose successor is narrower:
+#     the pulse keeps its width and voice 0's next note starts clean
+#   - uniform trains at rising rates, with play_midi() called every
+#     --step-us: the highest rate played without NOTIFY_UNDERRUN, which must
+#     cover the converter's renders (PulseTrain.cpp)
+
+MIN_PERIOD = 32            # PulseTrain.h, in 0.5 us ticks
+SPLIT = 0x8000             # MIDIPlayer.cpp
+TICKS_PER_S = 2000000
+RENDER_PEAK_RATE = 3400    # pulses/s, PulseTrain.cpp
+RATE_TRAIN_S = 0.25
+RATES = [1000, 2000, 4000, 8000, 12000, 16000, 20000, 25000, 31250, 40000, 50000, 62500]
+STOP_INDEX = 41            # a 40-tick pulse before a 4-tick one
+
+
+class Run(NamedTuple):
+    pulses: List[Tuple[int, int]]
+    stop: int
+    note: int
+    underruns: int
+
+
+def playback_train() -> List[Tuple[int, int]]:
+    train = []
+    t = 0
+    # Width changes every few pulses, and alternating wide and narrow pulses
+    for width in [20, 20, 20, 8, 8, 1, 40, 40, 13]:
+        train.append((t, width))
+        t += 400
+    train.append((t, 0))  # silent record
+    t += 1000
+    for i in range(40):
+        train.append((t, 40 if i % 2 == 0 else 4))
+        t += 600
+    # A rest longer than one timer period, then a burst at the minimum
+    # period, short enough for the queue to cover a step
+    t += 3 * SPLIT + 1234
+    for i in range(24):
+        train.append((t, 10 + i % 3))
+        t += MIN_PERIOD
+    train.append((t + 5000, 30))
+    return train
+
+
+def uniform_train(rate: int) -> List[Tuple[int, int]]:
+    period = TICKS_PER_S // rate
+    return [(i * period, 4) for i in range(int(RATE_TRAIN_S * rate))]
+
+
+def play(model: str, song: List[int], *options: str) -> Run:
+    with tempfile.NamedTemporaryFile(suffix='.bin', delete=False) as file:
+        file.write(bytes(song))
+    try:
+        output = subprocess.run([model, file.name] + list(options), stdout=subprocess.PIPE, text=True,
+                                check=True).stdout
+    finally:
+        os.unlink(file.name)
+    pulses, stop, note, underruns = [], None, None, None
+    for line in output.splitlines():
+        fields = line.split()
+        if fields[0] == 'pulse':
+            pulses.append((int(fields[1]), int(fields[2])))
+        elif fields[0] == 'stop':
+            stop = int(fields[1])
+        elif fields[0] == 'note':
+            note = int(fields[1])
+        elif fields[0] == 'underruns':
+            underruns = int(fields[1])
+    return Run(pulses, stop, note, underruns)
+
+
+def compare(expected: List[Tuple[int, int]], measured: List[Tuple[int, int]]) -> List[str]:
+    """Pulses from the first one on, as offsets from it"""
+    errors = []
+    if len(measured) != len(expected):
+        errors.append('%d pulses, expected %d' % (len(measured), len(expected)))
+    for i, ((start, width), (got_start, got_width)) in enumerate(zip(expected, measured)):
+        offset = start - expected[0][0]
+        got_offset = got_start - measured[0][0]
+        if offset != got_offset or width != got_width:
+            errors.append('pulse %d at %d ticks, %d wide; expected at %d, %d wide' % (
+                i, got_offset, got_width, offset, width))
+    return errors[:10]
+
+
+def check_playback(model: str, train: List[Tuple[int, int]]) -> bool:
+    run = play(model, encode_pulse_train(train))
+    expected = [pulse for pulse in train if pulse[1]]
+    errors = compare(expected, run.pulses)
+    if run.underruns:
+        errors.append('%d underruns' % run.underruns)
+    print('playback: %d pulses, %d records %s' % (len(run.pulses), len(train), 'ok' if not errors else 'FAIL'))
+    for error in errors:
+        print('  ' + error)
+    return not errors
+
+
+def check_stop(model: str, train: List[Tuple[int, int]]) -> bool:
+    expected = [pulse for pulse in train if pulse[1]][:STOP_INDEX + 1]
+    run = play(model, encode_pulse_train(train), '--stop-pulse', str(STOP_INDEX))
+    errors = []
+    before = [pulse for pulse in run.pulses if pulse[0] < run.stop]
+    after = [pulse for pulse in run.pulses if pulse[0] >= run.stop]
+    errors += compare(expected, before)
+    if any(start < run.note for start, _ in after):
+        errors.append('pulse after set_pwm_off() before the note')
+    note = [pulse for pulse in after if pulse[0] >= run.note]
+    if len(note) < 2:
+        errors.append('the note played %d pulses' % len(note))
+    elif note[0][1] != note[1][1]:
+        errors.append("the note's first pulse is %d ticks, the next %d" % (note[0][1], note[1][1]))
+    print('stop mid-pulse: pulse %d (%d ticks), stopped %d ticks in %s' % (
+        len(before) - 1, before[-1][1] if before else 0, run.stop - before[-1][0] if before else 0,
+        'ok' if not errors else 'FAIL'))
+    for error in errors:
+        print('  ' + error)
+    return not errors
+
+
+def check_rate(model: str, step_us: int) -> bool:
+    sustained = 0
+    for rate in RATES:
+        run = play(model, encode_pulse_train(uniform_train(rate)), '--step-us', str(step_us))
+        print('  %6d pulses/s: %d underruns' % (rate, run.underruns))
+        if run.underruns:
+            break
+        sustained = rate
+    ok = sustained >= RENDER_PEAK_RATE
+    print('rate: %d pulses/s without underruns, play_midi() every %d us %s' % (
+        sustained, step_us, 'ok' if ok else 'FAIL'))
+    return ok
+
+
+if __name__ == '__main__':
+    parser = argparse.ArgumentParser(description='Check pulse-train playback against the encoded records')
+    parser.add_argument('--model', required=True, help='pulse_model build')
+    parser.add_argument('--converter', required=True, help='midi_converter directory, for arduino_midi')
+    parser.add_argument('--step-us', type=int, default=2000, help='play_midi() interval for the rate sweep')
+    args = parser.parse_args()
+
+    sys.path.insert(0, args.converter)
+    from arduino_midi import encode_pulse_train
+
+    train = playback_train()
+    ok = check_playback(args.model, train)
+    ok &= check_stop(args.model, train)
+    ok &= check_rate(args.model, args.step_us)
+    sys.exit(0 if ok else 1)
@@ -0,0 +1,43 @@
+#pragma once
+
+// Host build of the Adafruit_NeoPixel calls the firmware makes. show()
+// waits out the 300 us latch and masks interrupts for the frame's 30 us per
+// pixel at 800 kHz, as the AVR bit-banging code does.
+#include <stdint.h>
+
+typedef uint16_t neoPixelType;
+#define NEO_RGB    ((0 << 6) | (0 << 4) | (1 << 2) | (2))
+#define NEO_GRB    ((1 << 6) | (1 << 4) | (0 << 2) | (2))
+#define NEO_KHZ800 0x0000
+#define NEO_KHZ400 0x0100
+
+class Adafruit_NeoPixel {
+ public:
+  Adafruit_NeoPixel(uint16_t num_pixels, int16_t pin = 6, neoPixelType type = NEO_GRB + NEO_KHZ800);
+  ~Adafruit_NeoPixel();
+  void begin();
+  void show();
+  bool canShow();
+  void setPixelColor(uint16_t n, uint8_t r, uint8_t g, uint8_t b);
+  void setPixelColor(uint16_t n, uint32_t color);
+  void fill(uint32_t color = 0, uint16_t first = 0, uint16_t count = 0);
+  void clear() { fill(0); }
+  void setBrightness(uint8_t brightness) { brightness_ = brightness; }
+  uint8_t getBrightness() const { return brightness_; }
+  uint32_t getPixelColor(uint16_t n) const;
+  uint16_t numPixels() const { return num_pixels_; }
+  static uint32_t Color(uint8_t r, uint8_t g, uint8_t b) {
+    return ((uint32_t)r << 16) | ((uint32_t)g << 8) | b;
+  }
+  static uint32_t ColorHSV(uint16_t hue, uint8_t sat = 255, uint8_t val = 255);
+
+  // Host: frames shown so far
+  unsigned long shows() const { return shows_; }
+
+ private:
+  uint16_t num_pixels_;
+  uint8_t brightness_ = 0;
+  uint32_t* pixels_;
+  uint32_t end_time_ = 0;
+  unsigned long shows_ = 0;
+};
@@ -0,0 +1,107 @@
+#pragma once
+
+// Host build of the Arduino AVR core API the firmware uses, running on the
+// peripheral model (AvrModel.h). HostCore.cpp follows wiring.c,
+// wiring_digital.c, WInterrupts.c and HardwareSerial.cpp.
+
+#include <stdint.h>
+#include <stdlib.h>
+#include <string.h>
+#include <math.h>
+#include <string>  // before the min/max macros
+#include <avr/io.h>
+#include <avr/pgmspace.h>
+#include <avr/interrupt.h>
+
+typedef uint8_t byte;
+typedef bool boolean;
+typedef unsigned int word;
+
+#define HIGH 0x1
+#define LOW  0x0
+
+#define INPUT        0x0
+#define OUTPUT       0x1
+#define INPUT_PULLUP 0x2
+
+#define CHANGE  1
+#define FALLING 2
+#define RISING  3
+
+#define DEC 10
+#define HEX 16
+#define OCT 8
+#define BIN 2
+
+#define min(a, b) ((a) < (b) ? (a) : (b))
+#define max(a, b) ((a) > (b) ? (a) : (b))
+#define constrain(amt, low, high) ((amt) < (low) ? (low) : ((amt) > (high) ? (high) : (amt)))
+#define lowByte(w) ((uint8_t)((w) & 0xff))
+#define highByte(w) ((uint8_t)((w) >> 8))
+#define bitRead(value, bit) (((value) >> (bit)) & 0x01)
+#define bitSet(value, bit) ((value) |= (1UL << (bit)))
+#define bitClear(value, bit) ((value) &= ~(1UL << (bit)))
+#define bit(b) (1UL << (b))
+
+#define clockCyclesPerMicrosecond() (F_CPU / 1000000L)
+#define clockCyclesToMicroseconds(a) ((a) / clockCyclesPerMicrosecond())
+#define microsecondsToClockCycles(a) ((a) * clockCyclesPerMicrosecond())
+
+#define interrupts() sei()
+#define noInterrupts() cli()
+
+#define NOT_AN_INTERRUPT -1
+#if defined(__AVR_ATmega2560__)
+  #define NUM_DIGITAL_PINS 70
+  #define digitalPinToInterrupt(p) ((p) == 2 ? 0 : ((p) == 3 ? 1 : \
+    ((p) >= 18 && (p) <= 21 ? 23 - (p) : NOT_AN_INTERRUPT)))
+  #define A0 54
+  #define A1 55
+  #define A2 56
+  #define A3 57
+  #define A4 58
+  #define A5 59
+  #define A6 60
+  #define A7 61
+  #define SS   53
+  #define MOSI 51
+  #define MISO 50
+  #define SCK  52
+#else
+  #define NUM_DIGITAL_PINS 20
+  #define digitalPinToInterrupt(p) ((p) == 2 ? 0 : ((p) == 3 ? 1 : NOT_AN_INTERRUPT))
+  #define A0 14
+  #define A1 15
+  #define A2 16
+  #define A3 17
+  #define A4 18
+  #define A5 19
+  #define SS   10
+  #define MOSI 11
+  #define MISO 12
+  #define SCK  13
+#endif
+#define LED_BUILTIN 13
+
+class __FlashStringHelper;
+#define F(string_literal) (reinterpret_cast<const __FlashStringHelper*>(PSTR(string_literal)))
+
+void init();
+void pinMode(uint8_t pin, uint8_t mode);
+void digitalWrite(uint8_t pin, uint8_t val);
+int digitalRead(uint8_t pin);
+unsigned long millis();
+unsigned long micros();
+void delay(unsigned long ms);
+void delayMicroseconds(unsigned int us);
+void attachInterrupt(uint8_t interrupt_num, void (*user_func)(), int mode);
+void detachInterrupt(uint8_t interrupt_num);
+long random(long howbig);
+long random(long howsmall, long howbig);
+void randomSeed(unsigned long seed);
+
+void setup();
+void loop();
+
+#include "WString.h"
+#include "HardwareSerial.h"
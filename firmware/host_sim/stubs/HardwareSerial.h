@@ -0,0 +1,43 @@
+#pragma once
+
+// Host build of HardwareSerial: the core's ring buffers, over the USART
+// model's UDR and shift register
+#include <stdint.h>
+#include "Print.h"
+
+#define SERIAL_TX_BUFFER_SIZE 64
+#define SERIAL_RX_BUFFER_SIZE 64
+
+class HardwareSerial : public Print {
+ public:
+  void begin(unsigned long baud) { begin(baud, 0); }
+  void begin(unsigned long baud, uint8_t config);
+  void end();
+  int available();
+  int peek();
+  int read();
+  int availableForWrite() override;
+  void flush();
+  size_t write(uint8_t value) override;
+  size_t write(unsigned long value) { return write((uint8_t)value); }
+  size_t write(long value) { return write((uint8_t)value); }
+  size_t write(unsigned int value) { return write((uint8_t)value); }
+  size_t write(int value) { return write((uint8_t)value); }
+  using Print::write;
+  operator bool() { return true; }
+
+  // Interrupt handlers, called from the USART vectors
+  void rx_complete_irq();
+  void tx_udr_empty_irq();
+
+ private:
+  volatile uint8_t rx_head_ = 0;
+  volatile uint8_t rx_tail_ = 0;
+  volatile uint8_t tx_head_ = 0;
+  volatile uint8_t tx_tail_ = 0;
+  bool written_ = false;
+  uint8_t rx_buffer_[SERIAL_RX_BUFFER_SIZE];
+  uint8_t tx_buffer_[SERIAL_TX_BUFFER_SIZE];
+};
+
+extern HardwareSerial Serial;
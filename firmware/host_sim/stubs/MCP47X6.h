@@ -0,0 +1,30 @@
+#pragma once
+
+// Host build of the MCP47X6 DAC library (github.com/uChip/MCP47X6): the
+// same calls, sending transactions of the same length over the Wire model
+#include <stdint.h>
+
+#define MCP47X6_DEFAULT_ADDRESS 0x60
+#define MCP47X6_VREF_VDD        0x00
+#define MCP47X6_VREF_VREFPIN    0x10
+#define MCP47X6_GAIN_1X         0x00
+#define MCP47X6_GAIN_2X         0x01
+
+class MCP47X6 {
+ public:
+  MCP47X6(uint8_t address = MCP47X6_DEFAULT_ADDRESS) : address_(address) {}
+  bool begin();
+  bool testConnection();
+  void setGain(uint8_t gain);
+  void setVReference(uint8_t reference);
+  bool saveSettings();
+  bool setOutputLevel(uint8_t level);
+  bool setOutputLevel(uint16_t level);
+  uint16_t getOutputLevel() const { return level_; }
+
+ private:
+  bool send(uint8_t length);
+  uint8_t address_;
+  uint8_t config_ = 0;
+  uint16_t level_ = 0;
+};
@@ -0,0 +1,53 @@
+#pragma once
+
+// Host build of Arduino's Print, with the same number and float formatting
+#include <stddef.h>
+#include <stdint.h>
+#include <string.h>
+#include "WString.h"
+
+#define DEC 10
+#define HEX 16
+#define OCT 8
+#define BIN 2
+
+class Print {
+ public:
+  virtual ~Print() {}
+  virtual size_t write(uint8_t value) = 0;
+  size_t write(const char* str) {
+    return str ? write((const uint8_t*)str, strlen(str)) : 0;
+  }
+  virtual size_t write(const uint8_t* buffer, size_t size);
+  size_t write(const char* buffer, size_t size) {
+    return write((const uint8_t*)buffer, size);
+  }
+  virtual int availableForWrite() { return 0; }
+
+  size_t print(const __FlashStringHelper* text);
+  size_t print(const String& text);
+  size_t print(const char text[]);
+  size_t print(char value);
+  size_t print(unsigned char value, int base = DEC);
+  size_t print(int value, int base = DEC);
+  size_t print(unsigned int value, int base = DEC);
+  size_t print(long value, int base = DEC);
+  size_t print(unsigned long value, int base = DEC);
+  size_t print(double value, int digits = 2);
+
+  size_t println(const __FlashStringHelper* text);
+  size_t println(const String& text);
+  size_t println(const char text[]);
+  size_t println(char value);
+  size_t println(unsigned char value, int base = DEC);
+  size_t println(int value, int base = DEC);
+  size_t println(unsigned int value, int base = DEC);
+  size_t println(long value, int base = DEC);
+  size_t println(unsigned long value, int base = DEC);
+  size_t println(double value, int digits = 2);
+  size_t println();
+
+ private:
+  size_t printNumber(unsigned long value, uint8_t base);
+  size_t printFloat(double value, uint8_t digits);
+};
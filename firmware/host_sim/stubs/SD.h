@@ -0,0 +1,50 @@
+#pragma once
+
+// Host build of the Arduino SD library calls SmfPlayer makes, on the files
+// of a host directory (sd_set_root()). Reads go through a single 512-byte
+// block cache, as the library's SdVolume keeps one for data, directory and
+// FAT blocks alike: each block loaded into it is counted and charged
+// SD_BLOCK_READ_CYCLES. Files take whole SD_CLUSTER_SIZE clusters, and a seek
+// or read into another cluster follows the FAT chain as SdFile does, from
+// the first cluster when it goes backwards; the chain is taken to sit in one
+// FAT block.
+#include <stdint.h>
+#include <stddef.h>
+
+#define FILE_READ 0
+#define SD_BLOCK_SIZE 512
+#define SD_CLUSTER_SIZE 32768  // SD Formatter's default for 2-32 GB cards
+// CMD17 and a block at the library's default SPI_HALF_SPEED (4 MHz): ~1.1 ms
+#define SD_BLOCK_READ_CYCLES 17600
+
+class File {
+ public:
+  File() {}
+  operator bool() const;
+  int read();
+  int read(void* buffer, uint16_t length);
+  bool seek(uint32_t position);
+  uint32_t position() const;
+  uint32_t size() const;
+  const char* name() const;
+  bool isDirectory() const;
+  File openNextFile(uint8_t mode = FILE_READ);
+  void close();
+
+ private:
+  friend class SDClass;
+  explicit File(int handle) : handle_(handle) {}
+  int handle_ = -1;
+};
+
+class SDClass {
+ public:
+  bool begin(uint8_t cs_pin);
+  File open(const char* path, uint8_t mode = FILE_READ);
+};
+
+extern SDClass SD;
+
+// Host only: the card's root directory, and the blocks loaded so far
+void sd_set_root(const char* directory);
+unsigned long sd_block_reads();
@@ -0,0 +1,18 @@
+#pragma once
+
+// Host build: the parts of Arduino's String the firmware uses
+#include <string>
+
+class __FlashStringHelper;
+
+class String {
+ public:
+  String(const char* text = "") : text_(text ? text : "") {}
+  String(const __FlashStringHelper* text) : text_(reinterpret_cast<const char*>(text)) {}
+  const char* c_str() const { return text_.c_str(); }
+  unsigned int length() const { return text_.length(); }
+  bool operator==(const String& other) const { return text_ == other.text_; }
+
+ private:
+  std::string text_;
+};
@@ -0,0 +1,30 @@
+#pragma once
+
+// Host build of the Wire master calls the firmware and the DAC library
+// make. A transaction takes the bus time of its bytes at the TWBR clock;
+// only addresses registered with attach_device() acknowledge.
+#include <stddef.h>
+#include <stdint.h>
+
+class TwoWire {
+ public:
+  void begin();
+  void setClock(uint32_t clock);
+  void beginTransmission(uint8_t address);
+  size_t write(uint8_t value);
+  size_t write(const uint8_t* data, size_t length);
+  uint8_t endTransmission(bool stop = true);
+  uint8_t requestFrom(uint8_t address, uint8_t quantity);
+  int available();
+  int read();
+
+  // Host: a device that acknowledges its address
+  void attach_device(uint8_t address);
+
+ private:
+  uint8_t address_ = 0;
+  uint8_t length_ = 0;
+  uint8_t received_ = 0;
+};
+
+extern TwoWire Wire;
@@ -0,0 +1,4 @@
+#pragma once
+
+// The firmware includes the core header in lower case
+#include "Arduino.h"
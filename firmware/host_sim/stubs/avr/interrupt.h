@@ -0,0 +1,17 @@
+#pragma once
+
+// Host build: handlers are plain functions the model (AvrModel.h) calls by
+// vector priority; the I bit lives in SREG as on the AVR
+#include <avr/io.h>
+
+// The extra step expands a vector given through a macro, as avr-libc's does
+#define ISR(vector, ...) AVR_ISR_HANDLER(vector)
+#define AVR_ISR_HANDLER(vector) extern "C" void avr_isr_##vector(void)
+#define ISR_BLOCK
+#define ISR_NOBLOCK
+#define ISR_NAKED
+
+void avr_cli();
+void avr_sei();
+#define cli() avr_cli()
+#define sei() avr_sei()
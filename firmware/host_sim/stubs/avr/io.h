@@ -0,0 +1,576 @@
+#pragma once
+
+// Host build: the AVR registers the firmware and the Arduino core use, as
+// variables the peripheral model (AvrModel.h) reads and updates. Counters,
+// flag registers, input pins and EEPROM control have side effects on access,
+// so they go through a hook that first brings the model up to the current
+// cycle and charges the access's own cycles. Build with
+// -D__AVR_ATmega328P__ (the default) or -D__AVR_ATmega2560__.
+
+#include <stdint.h>
+
+#if !defined(__AVR_ATmega328P__) && !defined(__AVR_ATmega2560__)
+  #define __AVR_ATmega328P__ 1
+#endif
+#ifndef F_CPU
+  #define F_CPU 16000000UL
+#endif
+
+#define _BV(bit) (1 << (bit))
+#define bit_is_set(sfr, bit) ((sfr) & _BV(bit))
+#define bit_is_clear(sfr, bit) (!((sfr) & _BV(bit)))
+
+#define AVR_PLAIN_REGISTERS8(X) \
+  X(TCCR0A) X(TCCR0B) X(OCR0A) X(OCR0B) X(TIMSK0) X(TCCR1A) X(TCCR1B) X(TCCR1C) \
+  X(TIMSK1) X(TCCR2A) X(TCCR2B) X(OCR2A) X(OCR2B) X(TIMSK2) X(ASSR) X(TCCR3A) \
+  X(TCCR3B) X(TCCR3C) X(TIMSK3) X(TCCR4A) X(TCCR4B) X(TCCR4C) X(TIMSK4) X(TCCR5A) \
+  X(TCCR5B) X(TCCR5C) X(TIMSK5) X(SREG) X(MCUSR) X(WDTCSR) X(TWBR) X(TWSR) \
+  X(GPIOR0) X(GPIOR1) X(GPIOR2) X(EIMSK) X(EICRA) X(EICRB) X(EIFR) X(SPCR) \
+  X(SPSR) X(SPDR) X(ADCSRA) X(PRR) X(PRR0) X(PRR1) X(PCICR) X(PCMSK0) \
+  X(PCMSK1) X(PCMSK2) X(PORTA) X(PORTB) X(PORTC) X(PORTD) X(PORTE) X(PORTF) \
+  X(PORTG) X(PORTH) X(PORTJ) X(PORTK) X(PORTL) X(DDRA) X(DDRB) X(DDRC) \
+  X(DDRD) X(DDRE) X(DDRF) X(DDRG) X(DDRH) X(DDRJ) X(DDRK) X(DDRL)
+#define AVR_PLAIN_REGISTERS16(X) \
+  X(OCR1A) X(OCR1B) X(OCR1C) X(ICR1) X(OCR3A) X(OCR3B) X(OCR3C) X(ICR3) \
+  X(OCR4A) X(OCR4B) X(OCR4C) X(ICR4) X(OCR5A) X(OCR5B) X(OCR5C) X(ICR5) \
+  X(EEAR)
+#define AVR_HOOKED_REGISTERS8(X) \
+  X(TCNT0) X(TCNT2) X(TIFR0) X(TIFR1) X(TIFR2) X(TIFR3) X(TIFR4) X(TIFR5) \
+  X(PCIFR) X(EECR) X(EEDR) X(PINA) X(PINB) X(PINC) X(PIND) X(PINE) \
+  X(PINF) X(PING) X(PINH) X(PINJ) X(PINK) X(PINL)
+#define AVR_HOOKED_REGISTERS16(X) \
+  X(TCNT1) X(TCNT3) X(TCNT4) X(TCNT5)
+
+#define AVR_DECLARE_REGISTER8(name) extern volatile uint8_t name;
+#define AVR_DECLARE_REGISTER16(name) extern volatile uint16_t name;
+#define AVR_DECLARE_HOOKED8(name) extern volatile uint8_t avr_reg_##name;
+#define AVR_DECLARE_HOOKED16(name) extern volatile uint16_t avr_reg_##name;
+AVR_PLAIN_REGISTERS8(AVR_DECLARE_REGISTER8)
+AVR_PLAIN_REGISTERS16(AVR_DECLARE_REGISTER16)
+AVR_HOOKED_REGISTERS8(AVR_DECLARE_HOOKED8)
+AVR_HOOKED_REGISTERS16(AVR_DECLARE_HOOKED16)
+
+volatile uint8_t& avr_access(volatile uint8_t& reg);
+volatile uint16_t& avr_access(volatile uint16_t& reg);
+#define TCNT0 avr_access(avr_reg_TCNT0)
+#define TCNT2 avr_access(avr_reg_TCNT2)
+#define TIFR0 avr_access(avr_reg_TIFR0)
+#define TIFR1 avr_access(avr_reg_TIFR1)
+#define TIFR2 avr_access(avr_reg_TIFR2)
+#define TIFR3 avr_access(avr_reg_TIFR3)
+#define TIFR4 avr_access(avr_reg_TIFR4)
+#define TIFR5 avr_access(avr_reg_TIFR5)
+#define PCIFR avr_access(avr_reg_PCIFR)
+#define EECR avr_access(avr_reg_EECR)
+#define EEDR avr_access(avr_reg_EEDR)
+#define PINA avr_access(avr_reg_PINA)
+#define PINB avr_access(avr_reg_PINB)
+#define PINC avr_access(avr_reg_PINC)
+#define PIND avr_access(avr_reg_PIND)
+#define PINE avr_access(avr_reg_PINE)
+#define PINF avr_access(avr_reg_PINF)
+#define PING avr_access(avr_reg_PING)
+#define PINH avr_access(avr_reg_PINH)
+#define PINJ avr_access(avr_reg_PINJ)
+#define PINK avr_access(avr_reg_PINK)
+#define PINL avr_access(avr_reg_PINL)
+#define TCNT1 avr_access(avr_reg_TCNT1)
+#define TCNT3 avr_access(avr_reg_TCNT3)
+#define TCNT4 avr_access(avr_reg_TCNT4)
+#define TCNT5 avr_access(avr_reg_TCNT5)
+
+// Timer control bits; the 16-bit timers share Timer1's layout
+#define WGM00    0
+#define WGM01    1
+#define COM0C0   2
+#define COM0C1   3
+#define COM0B0   4
+#define COM0B1   5
+#define COM0A0   6
+#define COM0A1   7
+#define CS00     0
+#define CS01     1
+#define CS02     2
+#define WGM02    3
+#define WGM03    4
+#define ICES0    6
+#define ICNC0    7
+#define FOC0C    5
+#define FOC0B    6
+#define FOC0A    7
+#define TOIE0    0
+#define OCIE0A   1
+#define OCIE0B   2
+#define OCIE0C   3
+#define ICIE0    5
+#define TOV0     0
+#define OCF0A    1
+#define OCF0B    2
+#define OCF0C    3
+#define ICF0     5
+#define WGM10    0
+#define WGM11    1
+#define COM1C0   2
+#define COM1C1   3
+#define COM1B0   4
+#define COM1B1   5
+#define COM1A0   6
+#define COM1A1   7
+#define CS10     0
+#define CS11     1
+#define CS12     2
+#define WGM12    3
+#define WGM13    4
+#define ICES1    6
+#define ICNC1    7
+#define FOC1C    5
+#define FOC1B    6
+#define FOC1A    7
+#define TOIE1    0
+#define OCIE1A   1
+#define OCIE1B   2
+#define OCIE1C   3
+#define ICIE1    5
+#define TOV1     0
+#define OCF1A    1
+#define OCF1B    2
+#define OCF1C    3
+#define ICF1     5
+#define WGM20    0
+#define WGM21    1
+#define COM2C0   2
+#define COM2C1   3
+#define COM2B0   4
+#define COM2B1   5
+#define COM2A0   6
+#define COM2A1   7
+#define CS20     0
+#define CS21     1
+#define CS22     2
+#define WGM22    3
+#define WGM23    4
+#define ICES2    6
+#define ICNC2    7
+#define FOC2C    5
+#define FOC2B    6
+#define FOC2A    7
+#define TOIE2    0
+#define OCIE2A   1
+#define OCIE2B   2
+#define OCIE2C   3
+#define ICIE2    5
+#define TOV2     0
+#define OCF2A    1
+#define OCF2B    2
+#define OCF2C    3
+#define ICF2     5
+#define WGM30    0
+#define WGM31    1
+#define COM3C0   2
+#define COM3C1   3
+#define COM3B0   4
+#define COM3B1   5
+#define COM3A0   6
+#define COM3A1   7
+#define CS30     0
+#define CS31     1
+#define CS32     2
+#define WGM32    3
+#define WGM33    4
+#define ICES3    6
+#define ICNC3    7
+#define FOC3C    5
+#define FOC3B    6
+#define FOC3A    7
+#define TOIE3    0
+#define OCIE3A   1
+#define OCIE3B   2
+#define OCIE3C   3
+#define ICIE3    5
+#define TOV3     0
+#define OCF3A    1
+#define OCF3B    2
+#define OCF3C    3
+#define ICF3     5
+#define WGM40    0
+#define WGM41    1
+#define COM4C0   2
+#define COM4C1   3
+#define COM4B0   4
+#define COM4B1   5
+#define COM4A0   6
+#define COM4A1   7
+#define CS40     0
+#define CS41     1
+#define CS42     2
+#define WGM42    3
+#define WGM43    4
+#define ICES4    6
+#define ICNC4    7
+#define FOC4C    5
+#define FOC4B    6
+#define FOC4A    7
+#define TOIE4    0
+#define OCIE4A   1
+#define OCIE4B   2
+#define OCIE4C   3
+#define ICIE4    5
+#define TOV4     0
+#define OCF4A    1
+#define OCF4B    2
+#define OCF4C    3
+#define ICF4     5
+#define WGM50    0
+#define WGM51    1
+#define COM5C0   2
+#define COM5C1   3
+#define COM5B0   4
+#define COM5B1   5
+#define COM5A0   6
+#define COM5A1   7
+#define CS50     0
+#define CS51     1
+#define CS52     2
+#define WGM52    3
+#define WGM53    4
+#define ICES5    6
+#define ICNC5    7
+#define FOC5C    5
+#define FOC5B    6
+#define FOC5A    7
+#define TOIE5    0
+#define OCIE5A   1
+#define OCIE5B   2
+#define OCIE5C   3
+#define ICIE5    5
+#define TOV5     0
+#define OCF5A    1
+#define OCF5B    2
+#define OCF5C    3
+#define ICF5     5
+
+// EEPROM, watchdog and reset flags
+#define EERE     0
+#define EEPE     1
+#define EEMPE    2
+#define EERIE    3
+#define EEPM0    4
+#define EEPM1    5
+#define WDP0     0
+#define WDP1     1
+#define WDP2     2
+#define WDE      3
+#define WDCE     4
+#define WDP3     5
+#define WDIE     6
+#define WDIF     7
+#define PORF     0
+#define EXTRF    1
+#define BORF     2
+#define WDRF     3
+
+// Pin change interrupts
+#define PCIE0    0
+#define PCIE1    1
+#define PCIE2    2
+#define PCIF0    0
+#define PCIF1    1
+#define PCIF2    2
+#define PCINT0   0
+#define PCINT1   1
+#define PCINT2   2
+#define PCINT3   3
+#define PCINT4   4
+#define PCINT5   5
+#define PCINT6   6
+#define PCINT7   7
+#define PCINT8   0
+#define PCINT9   1
+#define PCINT10  2
+#define PCINT11  3
+#define PCINT12  4
+#define PCINT13  5
+#define PCINT14  6
+#define PCINT15  7
+#define PCINT16  0
+#define PCINT17  1
+#define PCINT18  2
+#define PCINT19  3
+#define PCINT20  4
+#define PCINT21  5
+#define PCINT22  6
+#define PCINT23  7
+
+// Port bits
+#define PORTA0 0
+#define PA0 0
+#define PINA0 0
+#define PORTA1 1
+#define PA1 1
+#define PINA1 1
+#define PORTA2 2
+#define PA2 2
+#define PINA2 2
+#define PORTA3 3
+#define PA3 3
+#define PINA3 3
+#define PORTA4 4
+#define PA4 4
+#define PINA4 4
+#define PORTA5 5
+#define PA5 5
+#define PINA5 5
+#define PORTA6 6
+#define PA6 6
+#define PINA6 6
+#define PORTA7 7
+#define PA7 7
+#define PINA7 7
+#define PORTB0 0
+#define PB0 0
+#define PINB0 0
+#define PORTB1 1
+#define PB1 1
+#define PINB1 1
+#define PORTB2 2
+#define PB2 2
+#define PINB2 2
+#define PORTB3 3
+#define PB3 3
+#define PINB3 3
+#define PORTB4 4
+#define PB4 4
+#define PINB4 4
+#define PORTB5 5
+#define PB5 5
+#define PINB5 5
+#define PORTB6 6
+#define PB6 6
+#define PINB6 6
+#define PORTB7 7
+#define PB7 7
+#define PINB7 7
+#define PORTC0 0
+#define PC0 0
+#define PINC0 0
+#define PORTC1 1
+#define PC1 1
+#define PINC1 1
+#define PORTC2 2
+#define PC2 2
+#define PINC2 2
+#define PORTC3 3
+#define PC3 3
+#define PINC3 3
+#define PORTC4 4
+#define PC4 4
+#define PINC4 4
+#define PORTC5 5
+#define PC5 5
+#define PINC5 5
+#define PORTC6 6
+#define PC6 6
+#define PINC6 6
+#define PORTC7 7
+#define PC7 7
+#define PINC7 7
+#define PORTD0 0
+#define PD0 0
+#define PIND0 0
+#define PORTD1 1
+#define PD1 1
+#define PIND1 1
+#define PORTD2 2
+#define PD2 2
+#define PIND2 2
+#define PORTD3 3
+#define PD3 3
+#define PIND3 3
+#define PORTD4 4
+#define PD4 4
+#define PIND4 4
+#define PORTD5 5
+#define PD5 5
+#define PIND5 5
+#define PORTD6 6
+#define PD6 6
+#define PIND6 6
+#define PORTD7 7
+#define PD7 7
+#define PIND7 7
+#define PORTE0 0
+#define PE0 0
+#define PINE0 0
+#define PORTE1 1
+#define PE1 1
+#define PINE1 1
+#define PORTE2 2
+#define PE2 2
+#define PINE2 2
+#define PORTE3 3
+#define PE3 3
+#define PINE3 3
+#define PORTE4 4
+#define PE4 4
+#define PINE4 4
+#define PORTE5 5
+#define PE5 5
+#define PINE5 5
+#define PORTE6 6
+#define PE6 6
+#define PINE6 6
+#define PORTE7 7
+#define PE7 7
+#define PINE7 7
+#define PORTF0 0
+#define PF0 0
+#define PINF0 0
+#define PORTF1 1
+#define PF1 1
+#define PINF1 1
+#define PORTF2 2
+#define PF2 2
+#define PINF2 2
+#define PORTF3 3
+#define PF3 3
+#define PINF3 3
+#define PORTF4 4
+#define PF4 4
+#define PINF4 4
+#define PORTF5 5
+#define PF5 5
+#define PINF5 5
+#define PORTF6 6
+#define PF6 6
+#define PINF6 6
+#define PORTF7 7
+#define PF7 7
+#define PINF7 7
+#define PORTG0 0
+#define PG0 0
+#define PING0 0
+#define PORTG1 1
+#define PG1 1
+#define PING1 1
+#define PORTG2 2
+#define PG2 2
+#define PING2 2
+#define PORTG3 3
+#define PG3 3
+#define PING3 3
+#define PORTG4 4
+#define PG4 4
+#define PING4 4
+#define PORTG5 5
+#define PG5 5
+#define PING5 5
+#define PORTG6 6
+#define PG6 6
+#define PING6 6
+#define PORTG7 7
+#define PG7 7
+#define PING7 7
+#define PORTH0 0
+#define PH0 0
+#define PINH0 0
+#define PORTH1 1
+#define PH1 1
+#define PINH1 1
+#define PORTH2 2
+#define PH2 2
+#define PINH2 2
+#define PORTH3 3
+#define PH3 3
+#define PINH3 3
+#define PORTH4 4
+#define PH4 4
+#define PINH4 4
+#define PORTH5 5
+#define PH5 5
+#define PINH5 5
+#define PORTH6 6
+#define PH6 6
+#define PINH6 6
+#define PORTH7 7
+#define PH7 7
+#define PINH7 7
+#define PORTJ0 0
+#define PJ0 0
+#define PINJ0 0
+#define PORTJ1 1
+#define PJ1 1
+#define PINJ1 1
+#define PORTJ2 2
+#define PJ2 2
+#define PINJ2 2
+#define PORTJ3 3
+#define PJ3 3
+#define PINJ3 3
+#define PORTJ4 4
+#define PJ4 4
+#define PINJ4 4
+#define PORTJ5 5
+#define PJ5 5
+#define PINJ5 5
+#define PORTJ6 6
+#define PJ6 6
+#define PINJ6 6
+#define PORTJ7 7
+#define PJ7 7
+#define PINJ7 7
+#define PORTK0 0
+#define PK0 0
+#define PINK0 0
+#define PORTK1 1
+#define PK1 1
+#define PINK1 1
+#define PORTK2 2
+#define PK2 2
+#define PINK2 2
+#define PORTK3 3
+#define PK3 3
+#define PINK3 3
+#define PORTK4 4
+#define PK4 4
+#define PINK4 4
+#define PORTK5 5
+#define PK5 5
+#define PINK5 5
+#define PORTK6 6
+#define PK6 6
+#define PINK6 6
+#define PORTK7 7
+#define PK7 7
+#define PINK7 7
+#define PORTL0 0
+#define PL0 0
+#define PINL0 0
+#define PORTL1 1
+#define PL1 1
+#define PINL1 1
+#define PORTL2 2
+#define PL2 2
+#define PINL2 2
+#define PORTL3 3
+#define PL3 3
+#define PINL3 3
+#define PORTL4 4
+#define PL4 4
+#define PINL4 4
+#define PORTL5 5
+#define PL5 5
+#define PINL5 5
+#define PORTL6 6
+#define PL6 6
+#define PINL6 6
+#define PORTL7 7
+#define PL7 7
+#define PINL7 7
+
+#if defined(__AVR_ATmega2560__)
+  #define E2END 4095
+  #define RAMEND 0x21FF
+#else
+  #define E2END 1023
+  #define RAMEND 0x08FF
+#endif
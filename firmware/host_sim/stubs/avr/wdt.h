@@ -0,0 +1,20 @@
+#pragma once
+
+// Host build: the watchdog is part of the peripheral model (AvrModel.h)
+#include <avr/io.h>
+
+#define WDTO_15MS  0
+#define WDTO_30MS  1
+#define WDTO_60MS  2
+#define WDTO_120MS 3
+#define WDTO_250MS 4
+#define WDTO_500MS 5
+#define WDTO_1S    6
+#define WDTO_2S    7
+#define WDTO_4S    8
+#define WDTO_8S    9
+
+void avr_wdt_reset();
+#define wdt_reset() avr_wdt_reset()
+#define wdt_enable(timeout) (WDTCSR = _BV(WDE) | ((timeout) & 0x08 ? _BV(WDP3) : 0) | ((timeout) & 0x07))
+#define wdt_disable() (WDTCSR = 0)
@@ -0,0 +1,178 @@
+import argparse
+import bisect
+import random
+import subprocess
+import sys
+
+from typing import Dict, List, NamedTuple, Tuple
+
+# Multi-controller sync test: a SYNC_LEADER build and SYNC_FOLLOWER builds of
+# the firmware (FirmwareHost.cpp), each on its own simulated crystal, with
+# the leader's TX line wired to every follower's RX. All are switched into
+# music mode from the panel pins, and each follower's song timeline must
+# stay within MAX_SKEW_US of the leader's once locked.
+#
+# The leader runs LEAD_NS ahead of the followers, longer than any loop(), so
+# every byte it sends is delivered before a follower's clock reaches it.
+
+MAX_SKEW_US = 100
+LOCK_TIME_NS = 5 * 10**9      # from entering MUSIC_PLAY
+STEP_NS = 5 * 10**6
+LEAD_NS = 20 * 10**6
+
+# Pins on the ATmega328P build (pin_definitions.h)
+MSTR_EN = 14  # A0
+MODE_IN = 15  # A1
+
+MUSIC_PLAY = 3
+
+
+class Scenario(NamedTuple):
+    name: str
+    loop_us: float
+    jitter_us: float
+    leader_ppm: float
+    follower_ppm: List[float]
+
+
+SCENARIOS = [
+    Scenario('short loops', 100, 100, 0, [0, 0]),
+    Scenario('typical loops', 200, 200, 50, [-50, 30]),
+    Scenario('long loops', 300, 300, -100, [100, 0]),
+    Scenario('resonators', 200, 200, 3000, [-2000, 1500]),
+    Scenario('resonators, long loops', 400, 400, 5000, [-5000, 2000]),
+]
+
+
+class Instance:
+    def __init__(self, binary: str, ppm: float, loop_us: float, jitter_us: float, seed: int):
+        self.process = subprocess.Popen(
+            [binary, '--ppm', str(ppm), '--loop-us', str(loop_us), '--jitter-us', str(jitter_us),
+             '--seed', str(seed)],
+            stdin=subprocess.PIPE, stdout=subprocess.PIPE, text=True, bufsize=1)
+        self.positions = []  # type: List[Tuple[int, int, int]]
+        self.states = []  # type: List[Tuple[int, int]]
+        self.stats = None  # type: Tuple[int, int, int]
+
+    def send(self, line: str):
+        self.process.stdin.write(line + '\n')
+
+    def run(self, t_ns: int) -> List[Tuple[int, int]]:
+        """Runs to global time t_ns; returns the bytes sent as (end_ns, value)"""
+        self.send('run %d' % t_ns)
+        self.process.stdin.flush()
+        sent = []
+        while True:
+            line = self.process.stdout.readline()
+            if not line:
+                raise RuntimeError('instance exited: %s' % self.process.wait())
+            fields = line.split()
+            if fields[0] == 'done':
+                return sent
+            elif fields[0] == 'tx':
+                sent.append((int(fields[1]), int(fields[2])))
+            elif fields[0] == 'state':
+                self.states.append((int(fields[1]), int(fields[2])))
+            elif fields[0] == 'pos':
+                self.positions.append((int(fields[1]), int(fields[2]), int(fields[3])))
+            elif fields[0] == 'reset':
+                raise RuntimeError('instance reset: %s' % line.strip())
+
+    def quit(self):
+        self.send('quit')
+        self.process.stdin.flush()
+        fields = self.process.stdout.readline().split()
+        self.stats = tuple(int(field) for field in fields[1:])
+        self.process.wait()
+
+    def music_start_ns(self) -> int:
+        for t_ns, state in self.states:
+            if state == MUSIC_PLAY:
+                return t_ns
+        return None
+
+    def offsets(self) -> Tuple[List[int], List[float]]:
+        """Song position minus global time, in us, at each report"""
+        times = [t_ns for t_ns, _, _ in self.positions]
+        return times, [position - t_ns / 1000 for t_ns, _, position in self.positions]
+
+
+def run_scenario(scenario: Scenario, leader_binary: str, follower_binary: str, duration_ns: int,
+                 seed: int) -> Dict[str, float]:
+    rng = random.Random(seed)
+    leader = Instance(leader_binary, scenario.leader_ppm, scenario.loop_us, scenario.jitter_us, seed)
+    followers = [Instance(follower_binary, ppm, scenario.loop_us, scenario.jitter_us, seed + 1 + i)
+                 for i, ppm in enumerate(scenario.follower_ppm)]
+
+    # Startup with the run switch off, then music mode. Each controller sees
+    # the switch a little apart, so the followers start out of step.
+    switch_ns = 500 * 10**6
+    for i, instance in enumerate([leader] + followers):
+        instance.send('pin 0 %d 0' % MSTR_EN)
+        instance.send('pin %d %d 1' % (switch_ns, MODE_IN))
+        instance.send('pin %d %d 1' % (switch_ns + (rng.randrange(50 * 10**6) if i else 0), MSTR_EN))
+
+    # The leader's boot banner goes out while the followers are still in
+    # setup(); only what it sends after the first step is delivered
+    t_ns = 0
+    while t_ns < duration_ns:
+        t_ns += STEP_NS
+        sent = leader.run(t_ns + LEAD_NS)
+        for end_ns, value in sent if t_ns > STEP_NS else []:
+            for follower in followers:
+                follower.send('rx %d %d' % (end_ns, value))
+        for follower in followers:
+            follower.run(t_ns)
+    for instance in [leader] + followers:
+        instance.quit()
+
+    leader_start = leader.music_start_ns()
+    if leader_start is None:
+        raise RuntimeError('leader never reached MUSIC_PLAY')
+    leader_times, leader_offsets = leader.offsets()
+    result = {'worst': 0.0, 'samples': 0, 'overruns': 0, 'late': 0}
+    for follower in followers:
+        overruns, late_rx, _ = follower.stats
+        result['overruns'] += overruns
+        result['late'] += late_rx
+        follower_start = follower.music_start_ns()
+        if follower_start is None:
+            raise RuntimeError('follower never reached MUSIC_PLAY')
+        lock_ns = max(leader_start, follower_start) + LOCK_TIME_NS
+        skews = []
+        for t, offset in zip(*follower.offsets()):
+            if t < lock_ns:
+                continue
+            # Leader's offset at the same instant, between its reports
+            i = bisect.bisect_left(leader_times, t)
+            if i == 0 or i >= len(leader_times):
+                continue
+            t0, t1 = leader_times[i - 1], leader_times[i]
+            o0, o1 = leader_offsets[i - 1], leader_offsets[i]
+            skews.append(offset - (o0 + (o1 - o0) * (t - t0) / (t1 - t0)))
+        if not skews:
+            raise RuntimeError('no follower samples after lock')
+        result['samples'] += len(skews)
+        result['worst'] = max(result['worst'], max(abs(skew) for skew in skews))
+        result.setdefault('means', []).append(sum(skews) / len(skews))
+    return result
+
+
+if __name__ == '__main__':
+    parser = argparse.ArgumentParser(description='Check leader/follower song skew over simulated sync links')
+    parser.add_argument('--leader', required=True, help='SYNC_LEADER build of firmware_host')
+    parser.add_argument('--follower', required=True, help='SYNC_FOLLOWER build of firmware_host')
+    parser.add_argument('--seconds', type=float, default=20, help='simulated time per scenario')
+    parser.add_argument('--seed', type=int, default=1)
+    args = parser.parse_args()
+
+    failed = False
+    print('%-22s %10s %12s %9s %6s %9s' % ('scenario', 'worst us', 'mean us', 'overruns', 'late', 'samples'))
+    for scenario in SCENARIOS:
+        result = run_scenario(scenario, args.leader, args.follower, int(args.seconds * 10**9), args.seed)
+        ok = result['worst'] < MAX_SKEW_US and result['late'] == 0
+        failed |= not ok
+        print('%-22s %10.1f %12s %9d %6d %9d %s' % (
+            scenario.name, result['worst'], '/'.join('%+.1f' % mean for mean in result['means']),
+            result['overruns'], result['late'], result['samples'], 'ok' if ok else 'FAIL'))
+    sys.exit(1 if failed else 0)
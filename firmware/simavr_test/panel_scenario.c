@@ -0,0 +1,352 @@
+#include "panel_scenario.h"
+#include <stdarg.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#define US 1000ULL
+#define MS 1000000ULL
+
+// Firmware figures the checks hold it to (StateMachine.cpp, VoiceBackendAVR.cpp)
+#define SLOW_PULSE_US          20
+#define SLOW_PULSE_PERIOD_MS  500
+#define TEST_PULSE_US           2   // test_mode_index 0
+#define TEST_PULSE_DELAY_MS   500
+#define MAX_NOTE_PULSE_US      25   // MAX_VOLUME x COIL_FREQ_CYCLES_HALF cycles, plus a prescaler step
+#define SERIAL_HEARTBEAT_MS  5000   // drsstc_firmware.ino
+
+// digitalWrite() and delayMicroseconds() overhead around a software pulse
+#define PULSE_SLACK_US          5
+// A loop() pass, including the serial log a state change prints
+#define LOOP_SLACK_MS          10
+// A log line is recorded when its newline has gone out at 9600 baud
+#define LOG_SLACK_MS          100
+
+// ---- Recording ----
+
+typedef struct {
+  uint64_t t_ns;
+  int high;
+} edge_t;
+
+typedef struct {
+  edge_t* edges;
+  size_t count;
+  size_t capacity;
+} trace_t;
+
+#define MAX_LOG_LINES 256
+#define MAX_LINE_LENGTH 96
+
+static trace_t traces[PANEL_NUM_OUTPUTS];
+static const char* const OUTPUT_NAMES[PANEL_NUM_OUTPUTS] = {"PWM_1", "PWM_2", "LED1", "LED2"};
+
+static struct {
+  char text[MAX_LINE_LENGTH];
+  uint64_t t_ns;  // when the newline went out
+} log_lines[MAX_LOG_LINES];
+static size_t log_count = 0;
+static size_t line_length = 0;
+
+void panel_output_changed(enum panel_output output, int high, uint64_t t_ns) {
+  trace_t* trace = &traces[output];
+  if (trace->count && trace->edges[trace->count - 1].high == high) return;
+  if (trace->count == trace->capacity) {
+    trace->capacity = trace->capacity ? trace->capacity * 2 : 1024;
+    trace->edges = (edge_t*)realloc(trace->edges, trace->capacity * sizeof(edge_t));
+    if (!trace->edges) {
+      fprintf(stderr, "out of memory recording %s\n", OUTPUT_NAMES[output]);
+      exit(2);
+    }
+  }
+  trace->edges[trace->count].t_ns = t_ns;
+  trace->edges[trace->count].high = high;
+  trace->count++;
+}
+
+void panel_serial_byte(uint8_t value, uint64_t t_ns) {
+  if (log_count == MAX_LOG_LINES || value == '\r') return;
+  if (value == '\n') {
+    log_lines[log_count].text[line_length] = 0;
+    log_lines[log_count].t_ns = t_ns;
+    log_count++;
+    line_length = 0;
+  } else if (line_length < MAX_LINE_LENGTH - 1) {
+    log_lines[log_count].text[line_length++] = value;
+  }
+}
+
+// ---- Queries over the recording, times in ns, windows [t0, t1) ----
+
+static int level_at(enum panel_output output, uint64_t t) {
+  int level = 0;
+  for (size_t i = 0; i < traces[output].count && traces[output].edges[i].t_ns <= t; i++) {
+    level = traces[output].edges[i].high;
+  }
+  return level;
+}
+
+static size_t edges_in(enum panel_output output, uint64_t t0, uint64_t t1) {
+  size_t count = 0;
+  for (size_t i = 0; i < traces[output].count; i++) {
+    if (traces[output].edges[i].t_ns >= t0 && traces[output].edges[i].t_ns < t1) count++;
+  }
+  return count;
+}
+
+typedef struct {
+  size_t count;
+  uint64_t first_ns;
+  uint64_t min_width_ns, max_width_ns;
+  uint64_t min_interval_ns, max_interval_ns;  // rising edge to rising edge
+} pulse_stats_t;
+
+// High pulses whose rising edge is in the window
+static pulse_stats_t pulses_in(enum panel_output output, uint64_t t0, uint64_t t1) {
+  pulse_stats_t stats = {0, 0, UINT64_MAX, 0, UINT64_MAX, 0};
+  const trace_t* trace = &traces[output];
+  uint64_t last_rise = 0;
+  for (size_t i = 0; i < trace->count; i++) {
+    const edge_t* edge = &trace->edges[i];
+    if (!edge->high || edge->t_ns < t0 || edge->t_ns >= t1) continue;
+    uint64_t width = (i + 1 < trace->count) ? trace->edges[i + 1].t_ns - edge->t_ns : UINT64_MAX;
+    if (width < stats.min_width_ns) stats.min_width_ns = width;
+    if (width > stats.max_width_ns) stats.max_width_ns = width;
+    if (stats.count) {
+      uint64_t interval = edge->t_ns - last_rise;
+      if (interval < stats.min_interval_ns) stats.min_interval_ns = interval;
+      if (interval > stats.max_interval_ns) stats.max_interval_ns = interval;
+    } else {
+      stats.first_ns = edge->t_ns;
+    }
+    last_rise = edge->t_ns;
+    stats.count++;
+  }
+  return stats;
+}
+
+// First log line in the window containing the text, or NULL
+static const char* line_in(const char* text, uint64_t t0, uint64_t t1) {
+  for (size_t i = 0; i < log_count; i++) {
+    if (log_lines[i].t_ns >= t0 && log_lines[i].t_ns < t1 && strstr(log_lines[i].text, text)) {
+      return log_lines[i].text;
+    }
+  }
+  return NULL;
+}
+
+static size_t lines_containing(const char* text) {
+  size_t count = 0;
+  for (size_t i = 0; i < log_count; i++) {
+    if (strstr(log_lines[i].text, text)) count++;
+  }
+  return count;
+}
+
+// ---- Checks ----
+
+static int failures = 0;
+
+static void check(int ok, const char* format, ...) {
+  va_list args;
+  printf("%s  ", ok ? "pass" : "FAIL");
+  va_start(args, format);
+  vprintf(format, args);
+  va_end(args);
+  printf("\n");
+  if (!ok) failures++;
+}
+
+static double us(uint64_t ns) {
+  return ns == UINT64_MAX ? -1 : ns / 1000.0;
+}
+
+static double ms(uint64_t ns) {
+  return ns == UINT64_MAX ? -1 : ns / 1e6;
+}
+
+static void check_logged(const char* text, uint64_t t0_ms, uint64_t t1_ms) {
+  check(line_in(text, t0_ms * MS, t1_ms * MS) != NULL, "\"%s\" logged in %llu..%llu ms",
+        text, (unsigned long long)t0_ms, (unsigned long long)t1_ms);
+}
+
+// An LED that is flashing, which check_flashing() covers
+#define LED_ANY -1
+
+static const char* led_want(int level) {
+  return level == LED_ANY ? "any" : level ? "1" : "0";
+}
+
+static void check_leds(const char* state, int led1, int led2, uint64_t t_ms) {
+  int actual1 = level_at(PANEL_LED1, t_ms * MS), actual2 = level_at(PANEL_LED2, t_ms * MS);
+  check((led1 == LED_ANY || actual1 == led1) && (led2 == LED_ANY || actual2 == led2),
+        "%s: LED1 %d, LED2 %d at %llu ms (want %s, %s)",
+        state, actual1, actual2, (unsigned long long)t_ms, led_want(led1), led_want(led2));
+}
+
+// FLASH_DELAY toggles: 4 per second
+static void check_flashing(const char* state, enum panel_output led, uint64_t t0_ms, uint64_t t1_ms) {
+  size_t edges = edges_in(led, t0_ms * MS, t1_ms * MS);
+  size_t expected = (t1_ms - t0_ms) / 250;
+  check(edges + 1 >= expected && edges <= expected + 1, "%s: %s toggled %zu times in %llu..%llu ms (want %zu)",
+        state, OUTPUT_NAMES[led], edges, (unsigned long long)t0_ms, (unsigned long long)t1_ms, expected);
+}
+
+static void check_no_gates(const char* state, uint64_t t0_ms, uint64_t t1_ms) {
+  size_t edges = edges_in(PANEL_PWM_1, t0_ms * MS, t1_ms * MS) + edges_in(PANEL_PWM_2, t0_ms * MS, t1_ms * MS);
+  check(edges == 0, "%s: %zu gate edges in %llu..%llu ms (want none)",
+        state, edges, (unsigned long long)t0_ms, (unsigned long long)t1_ms);
+}
+
+static void at_ms(uint64_t t_ms) {
+  sim_run_until(t_ms * MS);
+}
+
+// Heartbeat lines ("Heartbeat: N OCD, ...") after the given time
+static void check_ocd_count(unsigned long expected, uint64_t after_ms) {
+  size_t heartbeats = 0;
+  for (size_t i = 0; i < log_count; i++) {
+    unsigned long count;
+    if (log_lines[i].t_ns < after_ms * MS || sscanf(log_lines[i].text, "Heartbeat: %lu OCD", &count) != 1) continue;
+    heartbeats++;
+    check(count == expected, "OCD: heartbeat at %.0f ms reports %lu trips (want %lu)",
+          ms(log_lines[i].t_ns), count, expected);
+  }
+  check(heartbeats > 0, "OCD: %zu heartbeats after %llu ms", heartbeats, (unsigned long long)after_ms);
+}
+
+// Loop monitor lines ("Loop: N overruns, ...") up to the given time: the
+// loop meets its deadline throughout, its serial report included
+static void check_no_overruns(uint64_t until_ms) {
+  size_t reports = 0;
+  for (size_t i = 0; i < log_count; i++) {
+    unsigned long count;
+    if (sscanf(log_lines[i].text, "Loop: %lu overruns", &count) != 1) continue;
+    reports++;
+    check(count == 0, "loop: report at %.0f ms counts %lu overruns (want 0)", ms(log_lines[i].t_ns), count);
+  }
+  check(reports >= until_ms / SERIAL_HEARTBEAT_MS, "loop: %zu reports in %llu ms", reports,
+        (unsigned long long)until_ms);
+}
+
+int panel_run_scenario(void) {
+  // Power up with every switch off: STARTUP, then LIGHT_SHOW
+  sim_input(PANEL_MSTR_EN, 0);
+  sim_input(PANEL_MODE_IN, 0);
+  sim_input(PANEL_TEST_IN, 0);
+  sim_input(PANEL_TRIG_IN, 0);
+  sim_input(PANEL_OCD_DETECT, 0);
+
+  // Run switch on in pulse mode: SLOW_PULSE
+  at_ms(1000);
+  sim_input(PANEL_MSTR_EN, 1);
+
+  // Off again: LIGHT_SHOW, with three OCD trips 10 ms apart
+  at_ms(3000);
+  sim_input(PANEL_MSTR_EN, 0);
+  for (int trip = 0; trip < 3; trip++) {
+    at_ms(3500 + 10 * trip);
+    sim_input(PANEL_OCD_DETECT, 1);
+    sim_run_until((3500 + 10 * trip) * MS + 10 * US);
+    sim_input(PANEL_OCD_DETECT, 0);
+  }
+
+  // Music mode, run switch on: MUSIC_PLAY; off: MUSIC_PAUSE; mode off: LIGHT_SHOW
+  at_ms(4000);
+  sim_input(PANEL_MODE_IN, 1);
+  at_ms(4100);
+  sim_input(PANEL_MSTR_EN, 1);
+  at_ms(9000);
+  sim_input(PANEL_MSTR_EN, 0);
+  at_ms(10000);
+  sim_input(PANEL_MODE_IN, 0);
+
+  // Test switch: TEST_MODE; run and trigger on: one test pulse after the delay
+  at_ms(11000);
+  sim_input(PANEL_TEST_IN, 1);
+  at_ms(11500);
+  sim_input(PANEL_MSTR_EN, 1);
+  sim_input(PANEL_TRIG_IN, 1);
+  at_ms(12500);
+  sim_input(PANEL_TRIG_IN, 0);
+  // Past the next heartbeat, whose loop report covers TEST_MODE's delay
+  at_ms(15500);
+
+  for (size_t i = 0; i < log_count; i++) printf("%10.3f ms  %s\n", ms(log_lines[i].t_ns), log_lines[i].text);
+
+  check(lines_containing("DRSSTC Firmware") == 1, "boot: one startup banner (no watchdog resets)");
+
+  // STARTUP, LIGHT_SHOW
+  check_logged("Startup in normal mode", 0, 1000);
+  check_leds("LIGHT_SHOW", 0, LED_ANY, 900);
+  check_flashing("LIGHT_SHOW", PANEL_LED2, 250, 1000);
+  check_no_gates("LIGHT_SHOW", 0, 1000);
+
+  // SLOW_PULSE: 20 us on PWM_1 every 500 ms, from 500 ms after the switch
+  check_logged("Pulse mode selected", 1000, 1000 + LOG_SLACK_MS);
+  check_leds("SLOW_PULSE", 1, 0, 1500);
+  check_leds("SLOW_PULSE", 1, 0, 2990);
+  pulse_stats_t slow = pulses_in(PANEL_PWM_1, 1000 * MS, 3000 * MS);
+  check(slow.count == 3, "SLOW_PULSE: %zu pulses (want 3)", slow.count);
+  check(slow.min_width_ns >= SLOW_PULSE_US * US && slow.max_width_ns <= (SLOW_PULSE_US + PULSE_SLACK_US) * US,
+        "SLOW_PULSE: widths %.2f..%.2f us (want %d..%d)", us(slow.min_width_ns), us(slow.max_width_ns),
+        SLOW_PULSE_US, SLOW_PULSE_US + PULSE_SLACK_US);
+  check(slow.count > 1 && slow.min_interval_ns + LOOP_SLACK_MS * MS / 2 >= SLOW_PULSE_PERIOD_MS * MS
+        && slow.max_interval_ns <= (SLOW_PULSE_PERIOD_MS + LOOP_SLACK_MS / 2) * MS,
+        "SLOW_PULSE: periods %.2f..%.2f ms (want %d +- %d)", ms(slow.min_interval_ns), ms(slow.max_interval_ns),
+        SLOW_PULSE_PERIOD_MS, LOOP_SLACK_MS / 2);
+  check(slow.count && slow.first_ns >= (1000 + SLOW_PULSE_PERIOD_MS) * MS
+        && slow.first_ns < (1000 + SLOW_PULSE_PERIOD_MS + LOOP_SLACK_MS) * MS,
+        "SLOW_PULSE: first pulse at %.2f ms (want %d)", ms(slow.first_ns), 1000 + SLOW_PULSE_PERIOD_MS);
+  check(edges_in(PANEL_PWM_2, 1000 * MS, 3000 * MS) == 0, "SLOW_PULSE: PWM_2 idle");
+
+  // LIGHT_SHOW again, and the OCD trips counted once each on their rising edge
+  check_leds("LIGHT_SHOW", 0, LED_ANY, 3600);
+  check_flashing("LIGHT_SHOW", PANEL_LED2, 3000 + LOOP_SLACK_MS, 4000);
+  check_no_gates("LIGHT_SHOW", 3000 + LOOP_SLACK_MS, 4100);
+  check_ocd_count(3, 3600);
+
+  // MUSIC_PLAY: note gates on both voices, none longer than the top volume
+  check_logged("Music mode selected", 4100, 4100 + LOG_SLACK_MS);
+  check_leds("MUSIC_PLAY", 0, 1, 5000);
+  check_leds("MUSIC_PLAY", 0, 1, 8990);
+  for (int output = PANEL_PWM_1; output <= PANEL_PWM_2; output++) {
+    pulse_stats_t music = pulses_in((enum panel_output)output, 4100 * MS, 9000 * MS);
+    printf("      MUSIC_PLAY: %s %zu pulses, widths %.2f..%.2f us, periods from %.2f us\n", OUTPUT_NAMES[output],
+           music.count, us(music.min_width_ns), us(music.max_width_ns), us(music.min_interval_ns));
+    check(music.count >= 50, "MUSIC_PLAY: %s gated %zu times (want 50 or more)", OUTPUT_NAMES[output], music.count);
+    check(music.count && music.max_width_ns <= MAX_NOTE_PULSE_US * US,
+          "MUSIC_PLAY: %s widths up to %.2f us (want %d at most)", OUTPUT_NAMES[output], us(music.max_width_ns),
+          MAX_NOTE_PULSE_US);
+  }
+
+  // MUSIC_PAUSE: silent once the switch is seen
+  check_logged("Pausing music", 9000, 9000 + LOG_SLACK_MS);
+  check_leds("MUSIC_PAUSE", 0, 1, 9500);
+  check_no_gates("MUSIC_PAUSE", 9000 + LOOP_SLACK_MS, 10000);
+  check(level_at(PANEL_PWM_1, 9000 * MS + LOOP_SLACK_MS * MS) == 0 && level_at(PANEL_PWM_2, 9000 * MS + LOOP_SLACK_MS * MS) == 0,
+        "MUSIC_PAUSE: both gates low");
+
+  // LIGHT_SHOW from the mode switch
+  check_flashing("LIGHT_SHOW", PANEL_LED2, 10000 + LOOP_SLACK_MS, 11000);
+  check_no_gates("LIGHT_SHOW", 10000, 11500);
+
+  // TEST_MODE: LED1 flashes; one 2 us pulse TEST_PULSE_DELAY_MS after run + trigger
+  check_flashing("TEST_MODE", PANEL_LED1, 11000 + LOOP_SLACK_MS, 12500);
+  pulse_stats_t test = pulses_in(PANEL_PWM_1, 11500 * MS, 13000 * MS);
+  check(test.count == 1, "TEST_MODE: %zu test pulses (want 1)", test.count);
+  check(test.count && test.first_ns + LOOP_SLACK_MS * MS / 2 >= (11500 + TEST_PULSE_DELAY_MS) * MS
+        && test.first_ns < (11500 + TEST_PULSE_DELAY_MS + LOOP_SLACK_MS) * MS,
+        "TEST_MODE: pulse at %.2f ms (want %d)", ms(test.first_ns), 11500 + TEST_PULSE_DELAY_MS);
+  check(test.count && test.min_width_ns >= (TEST_PULSE_US - 1) * US
+        && test.max_width_ns <= (TEST_PULSE_US + PULSE_SLACK_US) * US,
+        "TEST_MODE: width %.2f us (want %d..%d)", us(test.min_width_ns), TEST_PULSE_US - 1, TEST_PULSE_US + PULSE_SLACK_US);
+  check(edges_in(PANEL_PWM_2, 11000 * MS, 13000 * MS) == 0, "TEST_MODE: PWM_2 idle");
+  check_logged("Sent test pulse of 2 us", 12000, 12000 + LOG_SLACK_MS);
+  check_leds("TEST_MODE", LED_ANY, 1, 12200);
+
+  check_no_overruns(15500);
+
+  printf("%d checks failed\n", failures);
+  return failures;
+}
@@ -0,0 +1,33 @@
+#pragma once
+
+// Front panel test scenario for a simulated ATmega328P running the whole
+// firmware: drives the switch inputs and the OCD line on a fixed script,
+// records the gate outputs, status LEDs and serial log, then checks gate
+// timing, the OCD count and the state transitions. The same script runs
+// under simavr (simavr_test.c) and on the host model (host_sim/PanelHost.cpp),
+// each supplying the two sim_ functions.
+
+#include <stdint.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+enum panel_input { PANEL_MSTR_EN, PANEL_MODE_IN, PANEL_TEST_IN, PANEL_TRIG_IN, PANEL_OCD_DETECT };
+enum panel_output { PANEL_PWM_1, PANEL_PWM_2, PANEL_LED1, PANEL_LED2, PANEL_NUM_OUTPUTS };
+
+// Implemented by the harness: set an input pin now, and run the firmware
+// until at least the given simulated time
+void sim_input(enum panel_input input, int high);
+void sim_run_until(uint64_t t_ns);
+
+// Called by the harness as the firmware runs
+void panel_output_changed(enum panel_output output, int high, uint64_t t_ns);
+void panel_serial_byte(uint8_t value, uint64_t t_ns);
+
+// Runs the script and prints each check; returns the number that failed
+int panel_run_scenario(void);
+
+#ifdef __cplusplus
+}
+#endif
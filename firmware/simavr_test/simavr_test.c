@@ -0,0 +1,123 @@
+// Runs the front panel scenario (panel_scenario.c) against the real
+// firmware image under simavr. The image must be built with SIMAVR_TRACE:
+// its .mmcu section names the MCU and clock and has simavr write
+// drsstc_trace.vcd (SimTrace.c) for the whole run.
+//
+//   simavr_test drsstc_firmware.ino.elf
+//
+// Exits non-zero if any check fails; see the Makefile for the build.
+#include <stdint.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <sim_avr.h>
+#include <sim_elf.h>
+#include <sim_io.h>
+#include <avr_ioport.h>
+#include <avr_uart.h>
+#include <avr_twi.h>
+#include "panel_scenario.h"
+
+// Pins on the ATmega328P build (pin_definitions.h)
+static const struct { char port; uint8_t bit; } INPUT_PINS[] = {
+  {'C', 0},  // MSTR_EN, A0
+  {'C', 1},  // MODE_IN, A1
+  {'C', 2},  // TEST_IN, A2
+  {'C', 3},  // TRIG_IN, A3
+  {'B', 0},  // OCD_DETECT, pin 8
+};
+static const struct { char port; uint8_t bit; } OUTPUT_PINS[PANEL_NUM_OUTPUTS] = {
+  {'B', 1},  // PWM_1, pin 9
+  {'D', 3},  // PWM_2, pin 3
+  {'B', 2},  // LED1, pin 10
+  {'B', 3},  // LED2, pin 11
+};
+
+// The MCP47X6 DAC's address (drsstc_firmware.ino); the harness ACKs it
+#define DAC_ADDRESS 0x60
+
+static avr_t* avr = NULL;
+static avr_irq_t* twi_input = NULL;
+static uint8_t dac_selected = 0;
+
+static uint64_t now_ns(void) {
+  return avr_cycles_to_nsec(avr, avr->cycle);
+}
+
+static void on_output(struct avr_irq_t* irq, uint32_t value, void* param) {
+  panel_output_changed((enum panel_output)(intptr_t)param, value != 0, now_ns());
+}
+
+static void on_uart(struct avr_irq_t* irq, uint32_t value, void* param) {
+  panel_serial_byte(value, now_ns());
+}
+
+// A write-only device at DAC_ADDRESS: ACKs its address and every byte
+static void on_twi(struct avr_irq_t* irq, uint32_t value, void* param) {
+  avr_twi_msg_irq_t msg;
+  msg.u.v = value;
+  if (msg.u.twi.msg & TWI_COND_STOP) dac_selected = 0;
+  if (msg.u.twi.msg & TWI_COND_START) {
+    dac_selected = (msg.u.twi.addr >> 1) == DAC_ADDRESS ? msg.u.twi.addr : 0;
+  }
+  if (dac_selected && (msg.u.twi.msg & (TWI_COND_START | TWI_COND_WRITE))) {
+    avr_raise_irq(twi_input, avr_twi_irq_msg(TWI_COND_ACK, dac_selected, 1));
+  }
+}
+
+void sim_input(enum panel_input input, int high) {
+  avr_raise_irq(avr_io_getirq(avr, AVR_IOCTL_IOPORT_GETIRQ(INPUT_PINS[input].port), INPUT_PINS[input].bit),
+                high ? 1 : 0);
+}
+
+void sim_run_until(uint64_t t_ns) {
+  while (now_ns() < t_ns) {
+    int state = avr_run(avr);
+    if (state == cpu_Done || state == cpu_Crashed) {
+      printf("FAIL  firmware stopped (state %d) at %.3f ms\n", state, now_ns() / 1e6);
+      exit(1);
+    }
+  }
+}
+
+int main(int argc, char** argv) {
+  if (argc != 2) {
+    fprintf(stderr, "usage: simavr_test <firmware.elf>\n");
+    return 2;
+  }
+  elf_firmware_t firmware = {{0}};
+  if (elf_read_firmware(argv[1], &firmware)) {
+    fprintf(stderr, "%s: cannot read the firmware\n", argv[1]);
+    return 2;
+  }
+  if (!firmware.mmcu[0] || !firmware.frequency) {
+    fprintf(stderr, "%s: no .mmcu section; build with SIMAVR_TRACE\n", argv[1]);
+    return 2;
+  }
+  avr = avr_make_mcu_by_name(firmware.mmcu);
+  if (!avr) {
+    fprintf(stderr, "simavr has no %s\n", firmware.mmcu);
+    return 2;
+  }
+  avr_init(avr);
+  avr_load_firmware(avr, &firmware);
+
+  for (int output = 0; output < PANEL_NUM_OUTPUTS; output++) {
+    avr_irq_register_notify(
+        avr_io_getirq(avr, AVR_IOCTL_IOPORT_GETIRQ(OUTPUT_PINS[output].port), OUTPUT_PINS[output].bit),
+        on_output, (void*)(intptr_t)output);
+  }
+
+  // The serial log goes to the checks, not simavr's console
+  uint32_t uart_flags = 0;
+  avr_ioctl(avr, AVR_IOCTL_UART_GET_FLAGS('0'), &uart_flags);
+  uart_flags &= ~AVR_UART_FLAG_STDIO;
+  avr_ioctl(avr, AVR_IOCTL_UART_SET_FLAGS('0'), &uart_flags);
+  avr_irq_register_notify(avr_io_getirq(avr, AVR_IOCTL_UART_GETIRQ('0'), UART_IRQ_OUTPUT), on_uart, NULL);
+
+  twi_input = avr_io_getirq(avr, AVR_IOCTL_TWI_GETIRQ(0), TWI_IRQ_INPUT);
+  avr_irq_register_notify(avr_io_getirq(avr, AVR_IOCTL_TWI_GETIRQ(0), TWI_IRQ_OUTPUT), on_twi, NULL);
+
+  int failures = panel_run_scenario();
+  avr_terminate(avr);
+  return failures ? 1 : 0;
+}
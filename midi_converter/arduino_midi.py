@@ -1,8 +1,9 @@
+import heapq
 import mido
 
 from math import ceil
-from collections import namedtuple
-from typing import NamedTuple, List
+from collections import namedtuple, Counter
+from typing import NamedTuple, List, Optional, Tuple
 
 
 class MIDINote(NamedTuple):
@@ -35,41 +36,138 @@ def varint_encode(value):
     return bytes
 
 
+# Song event encoding
+#
+# Each event starts with one byte DDDTVVVV:
+#   DDD  - index into the per-song delta table (7 = varint delta follows)
+#   T    - 1 for voice 0, 0 for voice 1
+#   VVVV - volume of a note_on (note byte follows), 0 = note_off,
+#          15 = extended opcode byte follows
+# Voices 2 and up are addressed through the VOICE_ON/VOICE_OFF opcodes.
+# Voices are song voices numbered by priority, not timers: the firmware's
+# router maps them onto whatever timers the board has.
+# The program header holds ticks/beat, the initial tempo and the delta table.
+DELTA_TABLE_SIZE = 7
+DELTA_ESCAPE = 7
+MAX_TABLE_DELTA = 0xffff
+EVENT_VOICE0 = 0x10
+VOLUME_NOTE_OFF = 0x00
+VOLUME_EXTENDED = 0x0f
+MAX_EVENT_VOLUME = 14
+OPCODE_BOTH_OFF = 0x01
+OPCODE_SET_TEMPO = 0x02
+OPCODE_VOICE_ON = 0x03
+OPCODE_VOICE_OFF = 0x04
+OPCODE_END_PROGRAM = 0x05
+OPCODE_LED_CUE = 0x06
+MAX_SONG_VOICES = 8  # Song voices the firmware router tracks
+
+# LED cues, pre-rendered ring frames played at song events (LEDRing.h)
+#
+# A cue is one byte KKKAAAAA, the kind and its argument:
+#   FILL      - every pixel from palette index A
+#   RUNS      - A + 1 run bytes follow, LLLLPPPP: length - 1, palette index
+#   ROTATE    - the frame turned A pixels towards higher pixels
+#   METRONOME - the ring back to the firmware's beat display
+# Palette index 0 is off and 1-12 are the pitch classes from C.
+LED_CUE_FILL = 0x00
+LED_CUE_RUNS = 0x20
+LED_CUE_ROTATE = 0x40
+LED_CUE_METRONOME = 0x60
+LED_CUE_KIND_MASK = 0xe0
+LED_CUE_ARG_MASK = 0x1f
+LED_RUN_SHIFT = 4
+LED_PALETTE_OFF = 0
+LED_PALETTE_PITCH = 1
+NUM_LEDS = 16
+LED_CUE_MIN_INTERVAL = 0.04  # s; each cue is a show(), ~0.5 ms with interrupts masked
+LED_CUE_MIN_HOLD = 0.01  # s; shorter voice states are not cued
+
+
 class MIDICommand:
     def __init__(self, time: int, type: str, **kwargs):
         self.time = time
         self.type = type
-        self.cmd_bytes = varint_encode(time)
+        self.cmd_bytes = list()
         if type == 'note_on':
-            self.timer = kwargs.get('timer', 1)
+            self.voice = kwargs.get('voice', 0)
             self.note = kwargs['note']
             self.volume = kwargs['volume']
-            self.cmd_bytes.append((0x80 if self.timer == 1 else 0) + self.note)
-            self.cmd_bytes.append(self.volume)
-            self.cmd_str = 'T%d ON, NOTE %3d VOLUME %2d' % (self.timer, self.note, self.volume)
+            self.cmd_str = 'V%d ON, NOTE %3d VOLUME %2d' % (self.voice, self.note, self.volume)
         elif type == 'note_off':
-            self.timer = kwargs.get('timer', 1)
-            self.cmd_bytes.append(0x80 if self.timer == 1 else 0x00)
-            self.cmd_str = 'T%d OFF' % (self.timer)
+            self.voice = kwargs.get('voice', 0)
+            self.cmd_str = 'V%d OFF' % (self.voice)
         elif type == 'both_off':
-            self.cmd_bytes.append(0x01)
             self.cmd_str = 'BOTH OFF'
         elif type == 'set_tempo':
             self.tempo = kwargs['tempo']
-            self.cmd_bytes.append(0x02)
-            self.cmd_bytes += varint_encode(self.tempo)
             self.cmd_str = 'TEMPO > %d' % self.tempo
         elif type == 'end_program':
-            self.cmd_bytes.append(0x05)
             self.cmd_str = 'END PROGRAM'
+        elif type == 'led_cue':
+            self.cue = kwargs['cue']
+            self.cmd_str = 'LED %s' % describe_led_cue(self.cue)
         elif type == 'begin_program':
             self.ticks_per_beat = kwargs['ticks_per_beat']
             self.tempo = kwargs['tempo']
-            self.cmd_bytes = varint_encode(self.ticks_per_beat) + varint_encode(self.tempo)
             self.cmd_str = 'BEGIN PROGRAM (%d ticks/beat, tempo = %d us/beat)' % (self.ticks_per_beat, self.tempo)
         else:
             print('UNKNOWN COMMAND TYPE')
 
+    def encode(self, delta_table: List[int]):
+        if self.type == 'begin_program':
+            self.cmd_bytes = varint_encode(self.ticks_per_beat) + varint_encode(self.tempo)
+            for delta in delta_table:
+                self.cmd_bytes += varint_encode(delta)
+            return
+
+        if self.time in delta_table:
+            delta_code = delta_table.index(self.time)
+            delta_bytes = list()
+        else:
+            delta_code = DELTA_ESCAPE
+            delta_bytes = varint_encode(self.time)
+
+        voice = getattr(self, 'voice', 0)
+        voice_bit = EVENT_VOICE0 if voice == 0 else 0
+        opcode_bytes = list()
+        if self.type == 'note_on' and voice <= 1:
+            volume = min(max(self.volume, 1), MAX_EVENT_VOLUME)
+            opcode_bytes.append(self.note)
+        elif self.type == 'note_off' and voice <= 1:
+            volume = VOLUME_NOTE_OFF
+        else:
+            volume = VOLUME_EXTENDED
+            if self.type == 'note_on':
+                opcode_bytes += [OPCODE_VOICE_ON, voice, self.note, min(max(self.volume, 1), MAX_EVENT_VOLUME)]
+            elif self.type == 'note_off':
+                opcode_bytes += [OPCODE_VOICE_OFF, voice]
+            elif self.type == 'both_off':
+                opcode_bytes.append(OPCODE_BOTH_OFF)
+            elif self.type == 'set_tempo':
+                opcode_bytes.append(OPCODE_SET_TEMPO)
+                opcode_bytes += varint_encode(self.tempo)
+            elif self.type == 'end_program':
+                opcode_bytes.append(OPCODE_END_PROGRAM)
+            elif self.type == 'led_cue':
+                opcode_bytes += [OPCODE_LED_CUE] + self.cue
+        self.cmd_bytes = [(delta_code << 5) | voice_bit | volume] + delta_bytes + opcode_bytes
+
+    def varint_size(self) -> int:
+        # Size of this command in the previous varint-delta format, for comparison
+        if self.type == 'begin_program':
+            return len(varint_encode(self.ticks_per_beat)) + len(varint_encode(self.tempo))
+        size = len(varint_encode(self.time)) + 1
+        if getattr(self, 'voice', 0) > 1:
+            size += 3 if self.type == 'note_on' else 1
+        if self.type == 'note_on':
+            size += 1
+        elif self.type == 'set_tempo':
+            size += len(varint_encode(self.tempo))
+        elif self.type == 'led_cue':
+            size += len(self.cue)
+        return size
+
     def __str__(self):
         if self.type == 'end_program':
             fmt_str = '%30s  // %6d %s'
@@ -78,46 +176,188 @@ class MIDICommand:
         return fmt_str % (get_byte_str(self.cmd_bytes), self.time, self.cmd_str)
 
 
-def encode_midi_note_on(time, note, volume, timer1):
-    bytes = varint_encode(time)
-    bytes.append((0x80 if timer1 else 0) + note)
-    bytes.append(volume)
-    return '%30s, //%6d %s ON, NOTE %d VOLUME %d' % (
-        get_byte_str(bytes), time, 'T1' if timer1 else 'T2', note, volume)
-
-
-def encode_midi_note_off(time, timer1):
-    bytes = varint_encode(time)
-    bytes.append(0x80 if timer1 else 0x00)
-    return '%30s, //%6d %s OFF' % (
-        get_byte_str(bytes), time, 'T1' if timer1 else 'T2')
-
-
-def encode_midi_both_off(time):
-    bytes = varint_encode(time)
-    bytes.append(0x01)
-    return '%30s, //%6d BOTH OFF' % (
-        get_byte_str(bytes), time)
-
-
-def encode_midi_change_tempo(time, tempo):
-    bytes = varint_encode(time)
-    bytes.append(0x02)
-    bytes += varint_encode(tempo)
-    return '%30s, //%6d TEMPO > %d' % (
-        get_byte_str(bytes), time, tempo)
-
-
-def encode_midi_end_program(time):
-    bytes = varint_encode(time)
-    bytes.append(0x04)
-    return '%30s  //%6d END OF FILE' % (
-        get_byte_str(bytes), time)
-
+def describe_led_cue(cue: List[int]) -> str:
+    kind = cue[0] & LED_CUE_KIND_MASK
+    arg = cue[0] & LED_CUE_ARG_MASK
+    if kind == LED_CUE_FILL:
+        return 'FILL %d' % arg
+    elif kind == LED_CUE_RUNS:
+        return 'RUNS %s' % ' '.join('%dx%d' % ((run >> LED_RUN_SHIFT) + 1, run & 0x0f) for run in cue[1:])
+    elif kind == LED_CUE_ROTATE:
+        return 'ROTATE %d' % arg
+    return 'METRONOME'
+
+
+def get_led_cue(notes: List[Optional[int]]) -> List[int]:
+    # The ring is split evenly between the sounding voices, in voice order,
+    # each part in its note's pitch class
+    colors = [LED_PALETTE_PITCH + note % 12 for note in notes if note is not None]
+    if not colors:
+        return [LED_CUE_FILL | LED_PALETTE_OFF]
+    if len(set(colors)) == 1:
+        return [LED_CUE_FILL | colors[0]]
+    runs = list()
+    for i, color in enumerate(colors):
+        length = NUM_LEDS // len(colors) + (1 if i < NUM_LEDS % len(colors) else 0)
+        runs.append((length - 1) << LED_RUN_SHIFT | color)
+    return [LED_CUE_RUNS | (len(runs) - 1)] + runs
+
+
+def add_led_cues(cmds: List[MIDICommand], voices: int,
+                 min_interval: float = LED_CUE_MIN_INTERVAL) -> List[MIDICommand]:
+    # Follows each instant's note changes with a cue for the new voice state.
+    # A re-struck chord turns the ring by a pixel. Cues are at least
+    # min_interval apart; a state that comes too soon is shown when the
+    # interval is up, in the middle of the next delta, and a state that does
+    # not hold for LED_CUE_MIN_HOLD (a legato gap) is not shown at all.
+    ticks_per_beat = cmds[0].ticks_per_beat
+    tempo = cmds[0].tempo
+    notes: List[Optional[int]] = [None] * voices
+    shown = None
+    last_cue = -min_interval
+    pending = None
+    t = 0.0
+    out = [cmds[0]]
+    i = 1
+    while i < len(cmds):
+        delta = float(cmds[i].time * tempo) / (1e6 * ticks_per_beat)
+        if pending:
+            cue_ticks = int(ceil(max(0.0, last_cue + min_interval - t) * 1e6 * ticks_per_beat / tempo))
+            cue_t = t + float(cue_ticks * tempo) / (1e6 * ticks_per_beat)
+            if cue_t + LED_CUE_MIN_HOLD <= t + delta:
+                out.append(MIDICommand(cue_ticks, 'led_cue', cue=pending))
+                cmds[i].time -= cue_ticks
+                if pending[0] & LED_CUE_KIND_MASK != LED_CUE_ROTATE:
+                    shown = pending
+                last_cue = cue_t
+            pending = None
+        t += delta
+
+        # Every command at this instant
+        struck = False
+        ending = False
+        while True:
+            cmd = cmds[i]
+            out.append(cmd)
+            if cmd.type == 'note_on':
+                notes[cmd.voice] = cmd.note
+                struck = True
+            elif cmd.type == 'note_off':
+                notes[cmd.voice] = None
+            elif cmd.type == 'both_off':
+                notes = [None] * voices
+            elif cmd.type == 'set_tempo':
+                tempo = cmd.tempo
+            elif cmd.type == 'end_program':
+                ending = True
+            i += 1
+            if i >= len(cmds) or cmds[i].time:
+                break
+        if ending:
+            break
 
-def get_midi_commands(mid: mido.MidiFile, vol_scale: float) -> List[MIDICommand]:
+        cue = get_led_cue(notes)
+        if cue != shown:
+            pending = cue
+        elif struck and cue[0] & LED_CUE_KIND_MASK == LED_CUE_RUNS:
+            pending = [LED_CUE_ROTATE | 1]
+    return out
+
+
+def get_delta_table(cmds: List[MIDICommand]) -> List[int]:
+    # Pick the deltas that save the most bytes when replaced by a table index
+    counts = Counter(cmd.time for cmd in cmds
+                     if cmd.type != 'begin_program' and cmd.time <= MAX_TABLE_DELTA)
+    savings = {delta: (count - 1) * len(varint_encode(delta)) for delta, count in counts.items()}
+    delta_table = sorted(savings, key=lambda delta: (-savings[delta], delta))[:DELTA_TABLE_SIZE]
+    return delta_table + [0] * (DELTA_TABLE_SIZE - len(delta_table))
+
+
+def encode_midi_commands(cmds: List[MIDICommand]):
+    delta_table = get_delta_table(cmds)
+    for cmd in cmds:
+        cmd.encode(delta_table)
+    cmds[0].cmd_str += ' DELTAS %s' % ' '.join(map(str, delta_table))
+
+
+# Optional static Huffman coding of the encoded song bytes
+#
+# A coded song starts with HUFFMAN_MARKER, followed by the number of codes of
+# each length 1..HUFFMAN_MAX_BITS, the symbols in canonical code order, and the
+# MSB-first bit stream. Plain songs never start with 0x00.
+HUFFMAN_MARKER = 0x00
+HUFFMAN_MAX_BITS = 15
+
+
+def huffman_code_lengths(data: List[int]) -> dict:
+    freq = Counter(data)
+    while True:
+        lengths = {symbol: 0 for symbol in freq}
+        if len(freq) == 1:
+            return {symbol: 1 for symbol in freq}
+        heap = [(count, i, [symbol]) for i, (symbol, count) in enumerate(sorted(freq.items()))]
+        heapq.heapify(heap)
+        order = len(heap)
+        while len(heap) > 1:
+            count_a, _, symbols_a = heapq.heappop(heap)
+            count_b, _, symbols_b = heapq.heappop(heap)
+            for symbol in symbols_a + symbols_b:
+                lengths[symbol] += 1
+            heapq.heappush(heap, (count_a + count_b, order, symbols_a + symbols_b))
+            order += 1
+        if max(lengths.values()) <= HUFFMAN_MAX_BITS:
+            return lengths
+        # Flatten the distribution until the longest code fits the decoder
+        freq = Counter({symbol: (count >> 1) + 1 for symbol, count in freq.items()})
+
+
+def huffman_encode(data: List[int]) -> Tuple[List[int], List[int]]:
+    lengths = huffman_code_lengths(data)
+    symbols = sorted(lengths, key=lambda symbol: (lengths[symbol], symbol))
+    counts = [0] * HUFFMAN_MAX_BITS
+    for symbol in symbols:
+        counts[lengths[symbol] - 1] += 1
+    assert max(counts) < 0x100
+
+    # Assign canonical codes
+    codes = dict()
+    code = 0
+    prev_length = lengths[symbols[0]]
+    for symbol in symbols:
+        code <<= lengths[symbol] - prev_length
+        codes[symbol] = code
+        prev_length = lengths[symbol]
+        code += 1
+
+    bits = ''.join(format(codes[symbol], '0%db' % lengths[symbol]) for symbol in data)
+    bits += '0' * (-len(bits) % 8)
+    stream = [int(bits[i:i + 8], 2) for i in range(0, len(bits), 8)]
+    return [HUFFMAN_MARKER] + counts + symbols, stream
+
+
+def peak_event_rate(cmds: List[MIDICommand], window: float = 0.1) -> float:
+    # Highest number of events per second over any window, in seconds
+    times = list()
+    t = 0.0
+    tempo = cmds[0].tempo
+    for cmd in cmds[1:]:
+        t += float(cmd.time * tempo) / (1e6 * cmds[0].ticks_per_beat)
+        if cmd.type == 'set_tempo':
+            tempo = cmd.tempo
+        times.append(t)
+    peak = 0
+    start = 0
+    for end in range(len(times)):
+        while times[end] - times[start] > window:
+            start += 1
+        peak = max(peak, end - start + 1)
+    return peak / window
+
+
+def get_midi_commands(mid: mido.MidiFile, vol_scale: float, voices: int = 2,
+                      led_cues: bool = False) -> List[MIDICommand]:
     cmds = list()
-    timer_notes = [None] * 2
+    voice_notes = [None] * voices
     i = 0
     init_tempo = 0
     while mid.tracks[0][i].time == 0:
@@ -147,51 +387,171 @@ def get_midi_commands(mid: mido.MidiFile, vol_scale: float) -> List[MIDICommand]
             # Simply consume change tempo messages
             mark_cmd('set_tempo', tempo=msg.tempo)
         else:
-            new_timer_notes = timer_notes.copy()
+            new_voice_notes = voice_notes.copy()
+
+            def silence_note(note):
+                # Silence the first voice still playing this note
+                for t in range(voices):
+                    if voice_notes[t] and new_voice_notes[t] and voice_notes[t].note == note:
+                        new_voice_notes[t] = None
+                        return
+
             if msg.type == 'note_off':
+                silence_note(msg.note)
                 # Advance to consume additional note_off messages
-                if i + 1 < len(mid.tracks[0]) and \
+                while i + 1 < len(mid.tracks[0]) and \
                         mid.tracks[0][i + 1].type == 'note_off' and \
                         mid.tracks[0][i + 1].time == 0:
                     i += 1
-                    new_timer_notes = [None] * 2
-                else:
-                    timer_idx = next(t for t in range(2) if timer_notes[t] and timer_notes[t].note == msg.note)
-                    new_timer_notes[timer_idx] = None
+                    msg = mid.tracks[0][i]
+                    silence_note(msg.note)
 
                 # Advance to consume any note_on messages
                 if i + 1 < len(mid.tracks[0]) and mid.tracks[0][i + 1].time == 0:
                     i += 1
                     msg = mid.tracks[0][i]
             if msg.type == 'note_on':
-                # Find destination index; prefer timer1
-                dest_idx = new_timer_notes.index(None) if None in new_timer_notes else 0
-                new_timer_notes[dest_idx] = MIDINote(msg.note, scale_volume(msg.velocity))
-                # Advance to consume remaining note_on messages
-                if i + 1 < len(mid.tracks[0]) and \
-                        mid.tracks[0][i + 1].time == 0 and \
-                        mid.tracks[0][i + 1].type == 'note_on':
-                    i += 1
-                    msg = mid.tracks[0][i]
-                    new_timer_notes[1 - dest_idx] = MIDINote(msg.note, scale_volume(msg.velocity))
+                # Each note goes to the first free voice (preferring voice 0), or else
+                # replaces the first voice not already assigned at this instant
+                assigned = list()
+                while True:
+                    free = [t for t in range(voices) if t not in assigned]
+                    dest_idx = next((t for t in free if new_voice_notes[t] is None), free[0])
+                    new_voice_notes[dest_idx] = MIDINote(msg.note, scale_volume(msg.velocity))
+                    assigned.append(dest_idx)
+                    # Advance to consume remaining note_on messages
+                    if len(assigned) < voices and i + 1 < len(mid.tracks[0]) and \
+                            mid.tracks[0][i + 1].time == 0 and \
+                            mid.tracks[0][i + 1].type == 'note_on':
+                        i += 1
+                        msg = mid.tracks[0][i]
+                    else:
+                        break
 
             # Calculate messages
-            if new_timer_notes == [None] * 2 and len([n for n in timer_notes if n]) > 0:
+            if new_voice_notes == [None] * voices and len([n for n in voice_notes if n]) > 0:
                 mark_cmd('both_off')
             else:
-                for t in range(2):
-                    if new_timer_notes[t]:
-                        if not timer_notes[t] or timer_notes[t] != new_timer_notes[t]:
-                            n = new_timer_notes[t]
-                            mark_cmd('note_on', note=n.note, volume=n.volume, timer=t + 1)
+                for t in range(voices):
+                    if new_voice_notes[t]:
+                        if not voice_notes[t] or voice_notes[t] != new_voice_notes[t]:
+                            n = new_voice_notes[t]
+                            mark_cmd('note_on', note=n.note, volume=n.volume, voice=t)
                     else:
-                        if timer_notes[t]:
-                            mark_cmd('note_off', timer=t + 1)
-            timer_notes = new_timer_notes
+                        if voice_notes[t]:
+                            mark_cmd('note_off', voice=t)
+            voice_notes = new_voice_notes
         i += 1
     cmds.append(MIDICommand(0, 'end_program'))
+    if led_cues:
+        cmds = add_led_cues(cmds, voices)
+    encode_midi_commands(cmds)
     return cmds
 
 
 def encode_simple_midi(mid: mido.MidiFile):
     return list(map(str, get_midi_commands(mid)))
+
+
+# Pre-rendered pulse trains
+#
+# A pulse-train song starts with PULSE_TRAIN_MARKER, which never starts a
+# plain song's ticks/beat varint, then one record per gate pulse in Timer1
+# ticks (0.5 us at 8x):
+#   varint (period << 1 | new_width) - ticks from this pulse to the next
+#   width byte                       - pulse ticks, only when new_width is set
+# The first record has width 0 and holds the lead-in; a zero varint ends the
+# song. Pulses closer than PULSE_TRAIN_MIN_PERIOD are merged, as the ISR
+# needs that long to reload the timer between them.
+PULSE_TRAIN_MARKER = 0x80
+PULSE_TRAIN_TICK = 0.5e-6
+PULSE_TRAIN_MIN_PERIOD = 32
+PULSE_TRAIN_MAX_WIDTH = 40  # 20 us
+PULSE_TRAIN_MAX_BYTES = 32767  # avr-gcc limit for one PROGMEM array
+
+
+def get_pulse_train(pulses: List[Tuple[float, float]]) -> List[Tuple[int, int]]:
+    # (start, width) in ticks, merging pulses the playback ISR cannot separate
+    train = list()
+    for start_t, end_t in pulses:
+        start = int(round(start_t / PULSE_TRAIN_TICK))
+        end = max(int(round(end_t / PULSE_TRAIN_TICK)), start + 1)
+        if train:
+            prev_start, prev_width = train[-1]
+            if start - prev_start < max(PULSE_TRAIN_MIN_PERIOD, prev_width + 1):
+                width = min(max(prev_start + prev_width, end) - prev_start, PULSE_TRAIN_MAX_WIDTH)
+                train[-1] = (prev_start, width)
+                continue
+        train.append((start, min(end - start, PULSE_TRAIN_MAX_WIDTH)))
+    return train
+
+
+def encode_pulse_train(train: List[Tuple[int, int]]) -> List[int]:
+    data = [PULSE_TRAIN_MARKER]
+    width = 0
+    # The silent lead-in starts a minimum period early, so a pulse at 0 still has one
+    records = [(-PULSE_TRAIN_MIN_PERIOD, 0)] + train
+    for i, (start, new_width) in enumerate(records):
+        next_start = records[i + 1][0] if i + 1 < len(records) else start + PULSE_TRAIN_MIN_PERIOD
+        period = next_start - start
+        if new_width != width or i == 0:
+            data += varint_encode(period << 1 | 1) + [new_width]
+            width = new_width
+        else:
+            data += varint_encode(period << 1)
+    return data + varint_encode(0)
+
+
+def peak_pulse_rate(train: List[Tuple[int, int]], window: float = 0.1) -> float:
+    window_ticks = int(window / PULSE_TRAIN_TICK)
+    peak = 0
+    start = 0
+    for end in range(len(train)):
+        while train[end][0] - train[start][0] > window_ticks:
+            start += 1
+        peak = max(peak, end - start + 1)
+    return peak / window
+
+
+def get_bytes_cpp(name: str, source: str, data: List[int], huffman: bool = False) -> str:
+    # Song data without per-command comments, 16 bytes per row
+    header = '#include "MIDIPlayer.h"\n\n'
+    if huffman:
+        table, stream = huffman_encode(data)
+        comment = '// converted from %s - %d bytes total (%d bytes before Huffman coding)\n' % (
+            source, len(table) + len(stream), len(data))
+        data = table + stream
+    else:
+        comment = '// converted from %s - %d bytes total\n' % (source, len(data))
+    rows = ['%s,' % get_byte_str(data[i:i + 16]) for i in range(0, len(data), 16)]
+    rows[-1] = rows[-1][:-1]
+    return header + comment + \
+        'extern const byte %s[] PROGMEM = \n{\n' % name + \
+        '\n'.join(rows) + \
+        '\n};\n'
+
+
+def get_song_cpp(name: str, source: str, cmds: List[MIDICommand], huffman: bool = False) -> str:
+    total_bytes = sum(map(lambda cmd: len(cmd.cmd_bytes), cmds))
+    header = '#include "MIDIPlayer.h"\n\n'
+    if not huffman:
+        return header + \
+            '// converted from %s - %d bytes total\n' % (source, total_bytes) + \
+            'extern const byte %s[] PROGMEM = \n{\n' % name + \
+            '\n'.join(map(str, cmds)) + \
+            '\n};\n'
+
+    table, stream = huffman_encode([b for cmd in cmds for b in cmd.cmd_bytes])
+    rows = ['%30s, // HUFFMAN TABLE (%d symbols)' % (get_byte_str(table[:1 + HUFFMAN_MAX_BITS]),
+                                                     len(table) - 1 - HUFFMAN_MAX_BITS)]
+    for i in range(1 + HUFFMAN_MAX_BITS, len(table), 16):
+        rows.append('%s,' % get_byte_str(table[i:i + 16]))
+    for i in range(0, len(stream), 16):
+        rows.append('%s,' % get_byte_str(stream[i:i + 16]))
+    rows[-1] = rows[-1][:-1]
+    return header + \
+        '// converted from %s - %d bytes total (%d bytes before Huffman coding)\n' % (
+            source, len(table) + len(stream), total_bytes) + \
+        'extern const byte %s[] PROGMEM = \n{\n' % name + \
+        '\n'.join(rows) + \
+        '\n};\n'
@@ -1,7 +1,8 @@
 import argparse
 import mido
 
-from tesla_wav_simulator import generate_wav
+from tesla_wav_simulator import generate_wav, generate_logic_signal, predict_ocd, ocd_threshold, \
+    PrimaryModel, BUS_VOLTAGE, OCD_DAC_DEFAULT
 from arduino_midi import *
 
 from copy import deepcopy
@@ -162,6 +163,30 @@ if __name__ == '__main__':
                         help='Generate simulated WAV output')
     parser.add_argument('--channel_lock', action='store_true',
                         help='Assume note_off for subsequent note_on messages on the same channel')
+    parser.add_argument('--huffman', action='store_true',
+                        help='Huffman code the song bytes (smaller, slower to decode)')
+    parser.add_argument('--pulse_train', action='store_true',
+                        help='Pre-render the merged gate signal and encode it as pulse deltas')
+    parser.add_argument('--led_cues', action='store_true',
+                        help='Add LED ring cues following the notes (event songs only)')
+    parser.add_argument('--voices', metavar='N', type=int,
+                        nargs='?', required=False, default=2,
+                        help='Number of song voices to encode; the firmware maps them onto the board\'s timers')
+    parser.add_argument('--board_voices', metavar='N', type=int,
+                        nargs='?', required=False, default=2,
+                        help='Timer voices of the board for --wav (2 = ATmega328, '
+                             '3 = ATmega328 with TIMER0_VOICE, 4 = ATmega2560)')
+    parser.add_argument('--ocd', action='store_true',
+                        help='Predict OCD trips with the primary current model')
+    parser.add_argument('--ocd_dac', metavar='N', type=lambda x: int(x, 0),
+                        nargs='?', required=False, default=OCD_DAC_DEFAULT,
+                        help='OCD threshold DAC value for --ocd, as set in the firmware')
+    parser.add_argument('--bus_voltage', metavar='V', type=float,
+                        nargs='?', required=False, default=BUS_VOLTAGE,
+                        help='Bridge supply voltage for --ocd')
+    parser.add_argument('--voice_split', metavar='N', type=int,
+                        nargs='?', required=False, default=0,
+                        help='Voice group for board N of a synchronized set (0 = top voices)')
     parser.add_argument('--midi_port', metavar='PORT', type=str,
                         nargs='?', required=False,
                         default=mido.get_output_names()[0],
@@ -176,6 +201,8 @@ if __name__ == '__main__':
                         nargs='?', required=False, default=10.0,
                         help='Scale factor for volume (lower=more amplification)')
     args = parser.parse_args()
+    if not 1 <= args.voices <= MAX_SONG_VOICES:
+        parser.error('--voices must be between 1 and %d' % MAX_SONG_VOICES)
 
     print('Reading MIDI file %s ...' % args.input)
     input_midi = mido.MidiFile(args.input)
@@ -190,32 +217,89 @@ if __name__ == '__main__':
           (len(state_array), total_notes, state_array[-1].time))
     print('\n'.join('%s' % str(s) for s in state_array))
 
+    # Each board plays its own voices; board N takes the next group of ranked notes
+    first_note = args.voices * args.voice_split
     state_array = list(map(
-        lambda s: MIDIState(s.time, s.notes[:2], s.tempo), state_array))
+        lambda s: MIDIState(s.time, s.notes[first_note:first_note + args.voices], s.tempo), state_array))
     rem_notes = sum(len(s.notes) for s in state_array)
-    print('Removed %d lower notes' % (total_notes - rem_notes))
+    print('Removed %d notes outside voice split %d' % (total_notes - rem_notes, args.voice_split))
 
     mid = get_simple_midi(input_midi.ticks_per_beat, state_array, args.tempo_factor)
     input_mod_path = path.splitext(args.input)[0] + '_output.mid'
     print('Saving modified MIDI data to %s' % input_mod_path)
     mid.save(input_mod_path)
 
-    cmds = get_midi_commands(mid, args.vol_scale)
+    cmds = get_midi_commands(mid, args.vol_scale, args.voices, args.led_cues)
     total_bytes = sum(map(lambda cmd: len(cmd.cmd_bytes), cmds))
-    print('%d bytes total' % total_bytes)
+    if args.led_cues:
+        cues = [cmd for cmd in cmds if cmd.type == 'led_cue']
+        print('%d LED cues in %d bytes' % (len(cues), sum(len(cmd.cmd_bytes) for cmd in cues)))
+        if args.pulse_train:
+            print('Pulse trains carry no LED cues')
+    varint_bytes = sum(map(lambda cmd: cmd.varint_size(), cmds))
+    print('%d bytes total (%d bytes with varint deltas, %.1f%% saved)' %
+          (total_bytes, varint_bytes, 100.0 * (varint_bytes - total_bytes) / varint_bytes))
+
+    print('Peak event rate %.0f events/s' % peak_event_rate(cmds))
+
+    huffman = args.huffman
+    if huffman:
+        table, stream = huffman_encode([b for cmd in cmds for b in cmd.cmd_bytes])
+        coded_bytes = len(table) + len(stream)
+        print('%d bytes Huffman coded (%d byte table, ratio %.2f, %.2f bits per byte)' %
+              (coded_bytes, len(table), float(total_bytes) / coded_bytes, 8.0 * len(stream) / total_bytes))
+        if coded_bytes >= total_bytes:
+            print('Huffman coding does not reduce size; writing uncoded song')
+            huffman = False
 
     output_path = args.output or path.splitext(args.input)[0] + '.cpp'
-    with open(output_path, 'w') as outf:
-        outf.write('#include "MIDIPlayer.h"\n\n' +
-                   '// converted from %s - %d bytes total\n' % (args.input, total_bytes) +
-                   'extern const byte %s[] PROGMEM = \n{\n' % args.name +
-                   '\n'.join(map(str, cmds)) +
-                   '\n};\n')
+    if args.pulse_train:
+        # Every song voice on its own 16-bit timer; the board just replays the edges
+        pulses = generate_logic_signal(mid, args.vol_scale, args.voices, board_voices=max(args.voices, 4))
+        train = get_pulse_train(pulses)
+        data = encode_pulse_train(train)
+        print('Pulse train: %d pulses (%d merged) in %d bytes, %.2f bytes per pulse' %
+              (len(train), len(pulses) - len(train), len(data), float(len(data)) / max(len(train), 1)))
+        print('Compression ratio %.1f vs 32-bit edge times, %.2f vs event song' %
+              (8.0 * len(pulses) / len(data), float(total_bytes) / len(data)))
+        print('Peak pulse rate %.0f pulses/s' % peak_pulse_rate(train))
+        if len(data) > PULSE_TRAIN_MAX_BYTES:
+            print('Warning: %d bytes exceeds the %d byte PROGMEM array limit; shorten the song' %
+                  (len(data), PULSE_TRAIN_MAX_BYTES))
+        huffman = args.huffman
+        if huffman:
+            table, stream = huffman_encode(data)
+            coded_bytes = len(table) + len(stream)
+            print('%d bytes Huffman coded (%d byte table, ratio %.2f)' %
+                  (coded_bytes, len(table), float(len(data)) / coded_bytes))
+            if coded_bytes >= len(data):
+                print('Huffman coding does not reduce size; writing uncoded song')
+                huffman = False
+        with open(output_path, 'w') as outf:
+            outf.write(get_bytes_cpp(args.name, args.input, data, huffman))
+    else:
+        with open(output_path, 'w') as outf:
+            outf.write(get_song_cpp(args.name, args.input, cmds, huffman))
+
+    if args.ocd:
+        model = PrimaryModel(args.bus_voltage)
+        trip = ocd_threshold(args.ocd_dac)
+        max_on = model.max_on_time(trip)
+        print('OCD model: trip at %.0f A (DAC 0x%02x), %s from a quiet tank' %
+              (trip, args.ocd_dac, 'max on-time %.1f us' % (max_on * 1e6) if max_on else 'no on-time trips'))
+        trips, peak = predict_ocd(generate_logic_signal(mid, args.vol_scale, args.voices, args.board_voices),
+                                  trip, model)
+        print('Peak primary current %.0f A (%.0f%% of trip), %d predicted OCD trips' %
+              (peak, 100.0 * peak / trip, len(trips)))
+        for trip_t, current in trips[:20]:
+            print('   %8.3f s  %4.0f A' % (trip_t, current))
+        if len(trips) > 20:
+            print('   ... %d more' % (len(trips) - 20))
 
     if args.wav:
         wav_path = path.splitext(args.input)[0] + '_tesla.wav'
         print('Generating simulated WAV file at %s' % wav_path)
-        generate_wav(mid, args.vol_scale, wav_path)
+        generate_wav(mid, args.vol_scale, wav_path, args.voices, args.board_voices)
 
     if args.play:
         print('Opening MIDI port %s' % args.midi_port)
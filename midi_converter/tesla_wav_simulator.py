@@ -1,8 +1,8 @@
 import wave
 import struct
 
-from typing import Tuple
-from math import cos, pi
+from typing import List, Optional, Tuple
+from math import cos, exp, log, pi, log2
 
 from arduino_midi import *
 
@@ -57,6 +57,13 @@ class ArduinoTimerSim:
     def set_off(self):
         self.duty = 0
 
+    def note_cost(self, note) -> Optional[int]:
+        # log2 of the prescaler set_note() would pick, or None if out of range
+        tgt_freq = get_midi_freq(note)
+        if tgt_freq < self.min_freq:
+            return None
+        return int(log2(next(v for v in self.prescale_values if ARDUINO_FREQ / (self.max * v) < tgt_freq)))
+
     def current_state(self) -> bool:
         return self.current < self.duty
 
@@ -73,12 +80,75 @@ class ArduinoTimerSim:
         self.current_t = t
 
 
-Timer1 = ArduinoTimerSim(1 << 16, [1, 8, 64, 256, 1024])
-Timer2 = ArduinoTimerSim(1 << 8, [1, 8, 32, 64, 128, 256, 1024])
-ArduinoTimers = [Timer1, Timer2]
-
-
-def generate_logic_signal(mid: mido.MidiFile, vol_scale: float) -> List[Tuple[float, float]]:
+def arduino_timers(voices: int) -> List[ArduinoTimerSim]:
+    # ATmega328: Timer1 (16-bit) + Timer2 and, with TIMER0_VOICE, Timer0 (8-bit with a
+    # software-extended period, always at 8x); 4 voices are the ATmega2560's 16-bit timers
+    if voices <= 3:
+        return [ArduinoTimerSim(1 << 16, [1, 8, 64, 256, 1024]),
+                ArduinoTimerSim(1 << 17, [8]),
+                ArduinoTimerSim(1 << 17, [8])][:voices]
+    return [ArduinoTimerSim(1 << 16, [1, 8, 64, 256, 1024]) for _ in range(voices)]
+
+
+ROUTER_STEAL_COST = 0x20
+
+
+class VoiceRouter:
+    # Mirror of the firmware's VoiceRouter: song voices take the free timer with the
+    # finest on-time step for the note, or steal from a less important song voice
+    def __init__(self, timers: List[ArduinoTimerSim]):
+        self.timers = timers
+        self.timer_of_voice = dict()
+        self.voice_of_timer = [None] * len(timers)
+
+    def pick_timer(self, voice: int, note: int) -> Optional[int]:
+        best, best_cost = None, None
+        for t, timer in enumerate(self.timers):
+            cost = timer.note_cost(note)
+            if cost is None:
+                continue
+            owner = self.voice_of_timer[t]
+            if owner is not None:
+                if owner <= voice:
+                    continue
+                cost += ROUTER_STEAL_COST + (MAX_SONG_VOICES - owner)
+            if best_cost is None or cost < best_cost:
+                best, best_cost = t, cost
+        return best
+
+    def note_on(self, voice: int, note: int, volume: int):
+        if voice >= MAX_SONG_VOICES:
+            return
+        t = self.timer_of_voice.get(voice)
+        if t is None or self.timers[t].note_cost(note) is None:
+            self.note_off(voice)
+            t = self.pick_timer(voice, note)
+            if t is None:
+                return
+            owner = self.voice_of_timer[t]
+            if owner is not None:
+                del self.timer_of_voice[owner]
+            self.timer_of_voice[voice] = t
+            self.voice_of_timer[t] = voice
+        self.timers[t].set_note(note, volume)
+
+    def note_off(self, voice: int):
+        t = self.timer_of_voice.pop(voice, None)
+        if t is not None:
+            self.timers[t].set_off()
+            self.voice_of_timer[t] = None
+
+    def all_off(self):
+        for timer in self.timers:
+            timer.set_off()
+        self.timer_of_voice.clear()
+        self.voice_of_timer = [None] * len(self.timers)
+
+
+def generate_logic_signal(mid: mido.MidiFile, vol_scale: float, voices: int = 2,
+                          board_voices: int = 2) -> List[Tuple[float, float]]:
+    timers = arduino_timers(board_voices)
+    router = VoiceRouter(timers)
     current_state = True
     current_pulse_start = 0.0
     pulses = list()
@@ -89,9 +159,9 @@ def generate_logic_signal(mid: mido.MidiFile, vol_scale: float) -> List[Tuple[fl
     def update_state(t):
         nonlocal current_t, current_pulse_start, current_state
         current_t = t
-        Timer1.update(current_t)
-        Timer2.update(current_t)
-        new_state = Timer1.current_state() or Timer2.current_state()
+        for timer in timers:
+            timer.update(current_t)
+        new_state = any(timer.current_state() for timer in timers)
         if new_state != current_state:
             if new_state:
                 current_pulse_start = current_t
@@ -101,12 +171,12 @@ def generate_logic_signal(mid: mido.MidiFile, vol_scale: float) -> List[Tuple[fl
             current_state = new_state
 
     last_cmd_t = 0.0
-    cmds = get_midi_commands(mid, vol_scale)
+    cmds = get_midi_commands(mid, vol_scale, voices)
     for cmd in cmds:
         cmd_t = last_cmd_t + float(cmd.time * current_tempo) / (1e6 * mid.ticks_per_beat)
         last_cmd_t = cmd_t
         while current_t < cmd_t:
-            next_timer_change = min(Timer1.next_change(), Timer2.next_change())
+            next_timer_change = min(timer.next_change() for timer in timers)
             if next_timer_change < cmd_t:
                 update_state(next_timer_change)
             else:
@@ -114,17 +184,96 @@ def generate_logic_signal(mid: mido.MidiFile, vol_scale: float) -> List[Tuple[fl
         if cmd.type in ['begin_program', 'set_tempo']:
             current_tempo = cmd.tempo
         elif cmd.type == 'note_off':
-            ArduinoTimers[cmd.timer - 1].set_off()
+            router.note_off(cmd.voice)
         elif cmd.type == 'both_off':
-            Timer1.set_off()
-            Timer2.set_off()
+            router.all_off()
         elif cmd.type == 'note_on':
-            ArduinoTimers[cmd.timer - 1].set_note(cmd.note, cmd.volume)
+            router.note_on(cmd.voice, cmd.note, cmd.volume)
         update_state(cmd_t)
 
     return pulses
 
 
+# Primary tank model for OCD prediction. The half-bridge drives the series
+# primary tank at resonance; the square wave's fundamental (2 Vbus / pi)
+# grows the current envelope as di/dt = (Vf - R i) / 2L. When the pulse ends
+# the bridge's diodes clamp the tank against the bus, so the envelope rings
+# down as di/dt = -(Vf + R i) / 2L until the energy is returned. Estimates
+# for our coil; calibrate against the scope before trusting absolute amps.
+BUS_VOLTAGE = 170.0  # V, rectified 120 V mains
+PRIMARY_INDUCTANCE = 6e-6  # H
+PRIMARY_RESISTANCE = 0.5  # ohm, including the spark load reflected from the secondary
+
+# OCD comparator: current transformer (1:500 into 10 ohm) against the DAC
+OCD_AMPS_PER_VOLT = 50.0
+OCD_DAC_VREF = 5.0  # MCP47X6_VREF_VDD
+OCD_DAC_STEPS = 256  # 8-bit MCP4706
+OCD_DAC_DEFAULT = 0x80  # INITIAL_DAC_VALUE in the firmware
+
+
+def ocd_threshold(dac_value: int) -> float:
+    return dac_value * OCD_DAC_VREF / OCD_DAC_STEPS * OCD_AMPS_PER_VOLT
+
+
+class PrimaryModel:
+    def __init__(self, bus_voltage: float = BUS_VOLTAGE, inductance: float = PRIMARY_INDUCTANCE,
+                 resistance: float = PRIMARY_RESISTANCE):
+        self.tau = 2 * inductance / resistance
+        self.steady_current = 2 * bus_voltage / (pi * resistance)
+        self.current = 0.0
+        self.current_t = 0.0
+
+    def ring_down(self, t: float):
+        if self.current > 0.0:
+            decay = exp(-(t - self.current_t) / self.tau)
+            self.current = max((self.current + self.steady_current) * decay - self.steady_current, 0.0)
+        self.current_t = t
+
+    def uncut_current(self, on_time: float) -> float:
+        # Current after driving the tank for on_time from its present state
+        return self.steady_current + (self.current - self.steady_current) * exp(-on_time / self.tau)
+
+    def pulse(self, start: float, end: float, trip: Optional[float] = None) -> Optional[float]:
+        # Drives the tank from start to end; returns the time OCD cuts the pulse, if it does
+        self.ring_down(start)
+        i_end = self.uncut_current(end - start)
+        if trip is not None and i_end >= trip:
+            if self.current >= trip:
+                trip_t = start
+            else:
+                trip_t = start - self.tau * log((self.steady_current - trip) / (self.steady_current - self.current))
+            self.current = trip
+            self.current_t = trip_t
+            return trip_t
+        self.current = i_end
+        self.current_t = end
+        return None
+
+    def max_on_time(self, trip: float) -> Optional[float]:
+        # Longest pulse from a quiet tank that stays below the trip current
+        if trip >= self.steady_current:
+            return None
+        return -self.tau * log(1.0 - trip / self.steady_current)
+
+
+def predict_ocd(pulses: List[Tuple[float, float]], trip: float,
+                model: Optional[PrimaryModel] = None) -> Tuple[List[Tuple[float, float]], float]:
+    # Runs the pulses through the primary model. Returns the predicted OCD trips as
+    # (time, current the pulse would have reached) and the song's peak current
+    # without OCD, which sets how far the volume can be scaled
+    model = model or PrimaryModel()
+    trips = list()
+    peak = 0.0
+    for start, end in pulses:
+        model.ring_down(start)
+        uncut = model.uncut_current(end - start)
+        peak = max(peak, uncut)
+        trip_t = model.pulse(start, end, trip)
+        if trip_t is not None:
+            trips.append((trip_t, uncut))
+    return trips, peak
+
+
 ENERGY_TRANSFER_HALF_CYCLES = 8
 ENERGY_TRANSFER_TIME = ENERGY_TRANSFER_HALF_CYCLES * HALF_CYCLE_LENGTH
 ENERGY_TRANSFER_SPARK_DECAY = 0.5
@@ -148,14 +297,14 @@ def envelope(current_t: float, pulse_start: float, pulse_end: float) -> int:
 FIRST_PULSE_ON_TIME = 1.0
 LAST_PULSE_OFF_TIME = 1.0
 
-def generate_wav(mid: mido.MidiFile, vol_scale: float, path: str):
+def generate_wav(mid: mido.MidiFile, vol_scale: float, path: str, voices: int = 2, board_voices: int = 2):
     wav = wave.open(path, 'w')
     wav.setnchannels(1)  # mono
     wav.setsampwidth(2)  # 2 bytes per frame
     wav.setframerate(SAMPLE_RATE)
 
     # Generate a list of (start, stop) tuples for the interrupter logic signal
-    logic_pulses = generate_logic_signal(mid, vol_scale)
+    logic_pulses = generate_logic_signal(mid, vol_scale, voices, board_voices)
     print('Found %d pulses - up to t = %5.2f' % (len(logic_pulses), logic_pulses[-1][-1]))
 
     # Generate volumes from pulses